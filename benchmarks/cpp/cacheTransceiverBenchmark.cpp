@@ -0,0 +1,496 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmark for the KV cache transfer layer used by disaggregated serving. Unlike
+// disaggServerBenchmark, no engines are involved: ranks are paired into synthetic
+// context/generation instances that drive CacheSender/CacheReceiver directly, so the
+// MPI/UCX/NIXL/Mooncake fabrics can be qualified in isolation.
+//
+// Launch with an even number of ranks; even ranks send, odd ranks receive from rank - 1:
+//   mpirun -n 2 cacheTransceiverBenchmark --backend ucx --seq_lens 1024,4096 --concurrency 4
+
+#define UCX_WRAPPER_LIB_NAME "tensorrt_llm_ucx_wrapper"
+
+#if defined(_WIN32)
+#include <windows.h>
+#define dllOpen(name) LoadLibrary(name ".dll")
+#define dllGetSym(handle, name) static_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle), name))
+#else
+#include <dlfcn.h>
+#define dllOpen(name) dlopen("lib" name ".so", RTLD_LAZY)
+#define dllGetSym(handle, name) dlsym(handle, name)
+#endif // defined(_WIN32)
+
+#include "tensorrt_llm/batch_manager/cacheFormatter.h"
+#include "tensorrt_llm/batch_manager/cacheTransBuffer.h"
+#include "tensorrt_llm/batch_manager/cacheTransferLayer.h"
+#include "tensorrt_llm/batch_manager/dataTransceiver.h"
+#include "tensorrt_llm/batch_manager/kvCacheManager.h"
+#include "tensorrt_llm/batch_manager/kvCacheUtils.h"
+#include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/executor/cache_transmission/agent_utils/connection.h"
+#include "tensorrt_llm/executor/cache_transmission/mpi_utils/connection.h"
+#include "tensorrt_llm/executor/dataTransceiverState.h"
+#include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/executor/serializeUtils.h"
+#include "tensorrt_llm/runtime/utils/mpiUtils.h"
+
+#include "cxxopts.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tr = tensorrt_llm::runtime;
+namespace texec = tensorrt_llm::executor;
+using SizeType32 = tensorrt_llm::runtime::SizeType32;
+using LlmRequest = tensorrt_llm::batch_manager::LlmRequest;
+using VecTokens = texec::VecTokens;
+using namespace tensorrt_llm::batch_manager;
+using namespace tensorrt_llm::batch_manager::kv_cache_manager;
+
+namespace
+{
+
+struct BenchmarkConfig
+{
+    std::string backend{"mpi"};
+    SizeType32 numLayers{16};
+    SizeType32 numHeads{8};
+    SizeType32 sizePerHead{128};
+    SizeType32 tokensPerBlock{32};
+    nvinfer1::DataType dataType{nvinfer1::DataType::kHALF};
+    std::vector<SizeType32> seqLens{512, 1024, 4096};
+    SizeType32 numRequests{32};
+    SizeType32 warmUp{4};
+    SizeType32 concurrency{4};
+    SizeType32 transferBufferTokens{8192};
+    std::string outputCsv;
+};
+
+double percentile(std::vector<double> const& sortedValues, double p)
+{
+    TLLM_CHECK(!sortedValues.empty());
+    auto const index = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(sortedValues.size()))) - 1;
+    return sortedValues.at(std::min(index, sortedValues.size() - 1));
+}
+
+nvinfer1::DataType parseDataType(std::string const& name)
+{
+    if (name == "float")
+    {
+        return nvinfer1::DataType::kFLOAT;
+    }
+    if (name == "half")
+    {
+        return nvinfer1::DataType::kHALF;
+    }
+    if (name == "fp8")
+    {
+        return nvinfer1::DataType::kFP8;
+    }
+    TLLM_THROW("Unsupported --dtype: %s (expected float/half/fp8)", name.c_str());
+}
+
+size_t dataTypeSize(nvinfer1::DataType dataType)
+{
+    switch (dataType)
+    {
+    case nvinfer1::DataType::kFLOAT: return 4;
+    case nvinfer1::DataType::kHALF: return 2;
+    case nvinfer1::DataType::kFP8: return 1;
+    default: TLLM_THROW("Unsupported data type");
+    }
+}
+
+class CacheTransceiverBenchmark
+{
+public:
+    explicit CacheTransceiverBenchmark(BenchmarkConfig config)
+        : mConfig(std::move(config))
+    {
+        setUpCommunicator();
+        setUpCacheManager();
+        setUpCacheTransceiver();
+    }
+
+    void run()
+    {
+        for (auto const seqLen : mConfig.seqLens)
+        {
+            runConfig(seqLen, mConfig.warmUp, /*report=*/false);
+            runConfig(seqLen, mConfig.numRequests, /*report=*/true);
+        }
+        mComm->barrier();
+    }
+
+private:
+    void setUpCommunicator()
+    {
+        tensorrt_llm::mpi::initialize(tensorrt_llm::mpi::MpiThreadSupport::THREAD_MULTIPLE);
+        mComm = std::addressof(tensorrt_llm::mpi::MpiComm::world());
+        auto const worldSize = mComm->getSize();
+        TLLM_CHECK_WITH_INFO(
+            worldSize >= 2 && worldSize % 2 == 0, "cacheTransceiverBenchmark requires an even number of ranks");
+        mRank = mComm->getRank();
+        mIsSender = mRank % 2 == 0;
+        mPeerRank = mIsSender ? mRank + 1 : mRank - 1;
+        // Each rank forms its own single-rank instance so pairs transfer independently.
+        tensorrt_llm::mpi::MpiComm::setSession(mComm->split(mRank, 0));
+
+        int deviceCount{0};
+        TLLM_CUDA_CHECK(cudaGetDeviceCount(&deviceCount));
+        TLLM_CUDA_CHECK(cudaSetDevice(mRank % deviceCount));
+    }
+
+    void setUpCacheManager()
+    {
+        auto const maxSeqLen = *std::max_element(mConfig.seqLens.begin(), mConfig.seqLens.end());
+        auto const maxBlocksPerSeq = (maxSeqLen + mConfig.tokensPerBlock - 1) / mConfig.tokensPerBlock;
+        auto const maxNumTokens = maxBlocksPerSeq * mConfig.tokensPerBlock;
+        auto constexpr maxBeamWidth = 1;
+        auto constexpr sinkTokenLength = 0;
+        auto constexpr enableBlockReuse = false;
+        auto const totalNumBlocks = mConfig.concurrency * maxBlocksPerSeq;
+        auto const stream = std::make_shared<tr::CudaStream>();
+
+        using BlocksPerWindow = std::map<SizeType32, std::tuple<SizeType32, SizeType32>>;
+        auto const blocksPerWindow = BlocksPerWindow{{maxNumTokens, {totalNumBlocks, 0}}};
+
+        mManager = std::make_unique<KVCacheManager>(mConfig.numLayers, mConfig.numHeads, mConfig.sizePerHead,
+            mConfig.tokensPerBlock, blocksPerWindow, mConfig.concurrency, maxBeamWidth,
+            std::vector<BlockManager::SizeType32>{maxNumTokens}, std::nullopt, mConfig.dataType, sinkTokenLength,
+            stream, maxNumTokens, enableBlockReuse, CacheType::kSELF, std::nullopt, nullptr, true);
+        auto const attentionLayerNumPerPP = std::vector<SizeType32>{mConfig.numLayers};
+        mCacheState = std::make_unique<texec::kv_cache::CacheState>(mConfig.numLayers, mConfig.numHeads,
+            mConfig.sizePerHead, mConfig.tokensPerBlock, 1, 1, 1, attentionLayerNumPerPP, mConfig.dataType);
+        mManager->allocatePools(/*useUvm=*/false);
+    }
+
+    void setUpCacheTransceiver()
+    {
+        mCacheTransBufferManager
+            = std::make_unique<CacheTransBufferManager>(mManager.get(), mConfig.transferBufferTokens);
+        std::vector<CacheTransBufferManager*> bufferManagers{mCacheTransBufferManager.get()};
+
+        if (mConfig.backend == "ucx")
+        {
+            void* wrapperLibHandle = dllOpen(UCX_WRAPPER_LIB_NAME);
+            TLLM_CHECK_WITH_INFO(wrapperLibHandle != nullptr, "UCX wrapper library could not be opened.");
+            std::unique_ptr<texec::kv_cache::ConnectionManager> (*makeUcxConnectionManager)();
+            *(void**) (&makeUcxConnectionManager) = dllGetSym(wrapperLibHandle, "makeUcxConnectionManager");
+            TLLM_CHECK_WITH_INFO(makeUcxConnectionManager != nullptr,
+                "Unable to load UCX wrapper library symbol, please rebuild in a UCX-enabled environment.");
+            mConnectionManager = makeUcxConnectionManager();
+        }
+        else if (mConfig.backend == "nixl" || mConfig.backend == "mooncake")
+        {
+            std::vector<BaseTransBufferManager*> baseBufferManagers(bufferManagers.begin(), bufferManagers.end());
+            mConnectionManager = std::make_unique<texec::kv_cache::AgentConnectionManager>(
+                baseBufferManagers, *mCacheState, mConfig.backend);
+        }
+        else
+        {
+            TLLM_CHECK_WITH_INFO(mConfig.backend == "mpi", "Unsupported --backend: %s", mConfig.backend.c_str());
+            mConnectionManager = std::make_unique<texec::kv_cache::MpiConnectionManager>(mComm);
+        }
+
+        auto makeFormatter
+            = [this, &bufferManagers]() { return createCacheFormatter(mManager.get(), bufferManagers, false); };
+        if (mIsSender)
+        {
+            mSender = std::make_unique<CacheSender>(
+                mConnectionManager.get(), 0, CacheTransferLayer(*mCacheState, makeFormatter()));
+        }
+        else
+        {
+            mReceiver = std::make_unique<CacheReceiver>(
+                mConnectionManager.get(), 0, CacheTransferLayer(*mCacheState, makeFormatter()));
+        }
+        exchangeContextCommState();
+    }
+
+    // The receiver addresses its paired sender through the sender's communicator state; for MPI
+    // that is just the peer world rank, the dynamic fabrics publish theirs over an MPI exchange.
+    void exchangeContextCommState()
+    {
+        if (mConfig.backend == "mpi")
+        {
+            auto const contextRank = mIsSender ? mRank : mPeerRank;
+            mContextCommState = std::make_unique<texec::kv_cache::CommState>(std::vector<int>{contextRank});
+            return;
+        }
+        namespace su = texec::serialize_utils;
+        if (mIsSender)
+        {
+            std::ostringstream oStream;
+            su::serialize(mConnectionManager->getCommState(), oStream);
+            auto const str = oStream.str();
+            std::vector<char> buffer(str.begin(), str.end());
+            int64_t bufferSize = static_cast<int64_t>(buffer.size());
+            mComm->sendRawTag(&bufferSize, 1, tensorrt_llm::mpi::MpiType::kINT64, mPeerRank, 0x1F);
+            mComm->sendRawTag(buffer.data(), buffer.size(), tensorrt_llm::mpi::MpiType::kCHAR, mPeerRank, 0x2F);
+            mContextCommState = std::make_unique<texec::kv_cache::CommState>(mConnectionManager->getCommState());
+        }
+        else
+        {
+            int64_t bufferSize{0};
+            mComm->recvRawTag(&bufferSize, 1, tensorrt_llm::mpi::MpiType::kINT64, mPeerRank, 0x1F);
+            std::vector<char> buffer(bufferSize);
+            mComm->recvRawTag(buffer.data(), buffer.size(), tensorrt_llm::mpi::MpiType::kCHAR, mPeerRank, 0x2F);
+            su::VectorWrapBuf<char> strbuf(buffer);
+            std::istream is(&strbuf);
+            mContextCommState = std::make_unique<texec::kv_cache::CommState>(
+                su::deserialize<texec::kv_cache::CommState>(is));
+        }
+    }
+
+    std::shared_ptr<LlmRequest> makeLlmRequest(SizeType32 length)
+    {
+        constexpr SizeType32 maxNewTokens{1};
+        texec::Request request{VecTokens(length, length % 100), maxNewTokens};
+        auto state = std::make_unique<texec::DataTransceiverState>();
+        state->setCommState(*mContextCommState);
+        state->setCacheState(*mCacheState);
+        auto stats = texec::ContextPhaseParams({}, mRequestId, state.release(), std::nullopt);
+        request.setContextPhaseParams(std::move(stats));
+        return std::make_shared<LlmRequest>(mRequestId++, std::move(request));
+    }
+
+    [[nodiscard]] size_t bytesPerRequest(SizeType32 seqLen) const
+    {
+        auto const numBlocks = (seqLen + mConfig.tokensPerBlock - 1) / mConfig.tokensPerBlock;
+        return static_cast<size_t>(numBlocks) * mConfig.tokensPerBlock * mConfig.numLayers * 2 * mConfig.numHeads
+            * mConfig.sizePerHead * dataTypeSize(mConfig.dataType);
+    }
+
+    void fillRequestBlocks(std::shared_ptr<LlmRequest> const& llmRequest)
+    {
+        auto blockRange = BlockRange::fromAllBlockIds(*mManager, llmRequest->mRequestId);
+        for (auto const& windowSize : blockRange.getWindowSizes())
+        {
+            auto blockRangeForWindow = blockRange.getBlockRangeForWindow(windowSize);
+            for (auto it = blockRangeForWindow.begin(); it != blockRangeForWindow.end(); ++it)
+            {
+                TLLM_CUDA_CHECK(cudaMemset(it->data(), llmRequest->getPromptLen() & 0xff, it->getSizeInBytes()));
+            }
+        }
+    }
+
+    void runConfig(SizeType32 seqLen, SizeType32 numRequests, bool report)
+    {
+        std::vector<double> latenciesMs;
+        double elapsedSec{0.0};
+        auto constexpr beamWidth = 1;
+
+        for (SizeType32 issued = 0; issued < numRequests; issued += mConfig.concurrency)
+        {
+            auto const batchSize = std::min(mConfig.concurrency, numRequests - issued);
+            std::vector<std::shared_ptr<LlmRequest>> requests;
+            std::vector<std::future<void>> futures;
+            requests.reserve(batchSize);
+            futures.reserve(batchSize);
+
+            mComm->barrier();
+            auto const batchStart = std::chrono::steady_clock::now();
+            for (SizeType32 i = 0; i < batchSize; ++i)
+            {
+                auto const& llmRequest = requests.emplace_back(makeLlmRequest(seqLen));
+                mManager->addSequence(llmRequest->mRequestId, llmRequest->getNumTokens(0), beamWidth, llmRequest);
+                if (mIsSender)
+                {
+                    fillRequestBlocks(llmRequest);
+                    futures.emplace_back(mSender->sendAsync(*llmRequest));
+                }
+                else
+                {
+                    futures.emplace_back(mReceiver->receiveAsync(*llmRequest));
+                }
+            }
+            for (auto& future : futures)
+            {
+                future.get();
+                auto const now = std::chrono::steady_clock::now();
+                latenciesMs.push_back(std::chrono::duration<double, std::milli>(now - batchStart).count());
+            }
+            TLLM_CUDA_CHECK(cudaDeviceSynchronize());
+            elapsedSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+            for (auto const& llmRequest : requests)
+            {
+                mManager->removeSequence(llmRequest->mRequestId, llmRequest);
+            }
+        }
+
+        if (report && !mIsSender)
+        {
+            reportResults(seqLen, latenciesMs, elapsedSec);
+        }
+    }
+
+    void reportResults(SizeType32 seqLen, std::vector<double> latenciesMs, double elapsedSec) const
+    {
+        std::sort(latenciesMs.begin(), latenciesMs.end());
+        auto const numRequests = latenciesMs.size();
+        auto const avgMs = std::accumulate(latenciesMs.begin(), latenciesMs.end(), 0.0) / numRequests;
+        auto const bytes = bytesPerRequest(seqLen);
+        auto const totalGiB = static_cast<double>(bytes) * numRequests / (1024.0 * 1024.0 * 1024.0);
+        auto const bandwidthGiBs = totalGiB / elapsedSec;
+
+        printf("[rank %d] backend %s seq_len %d concurrency %d requests %zu bytes/request %.2f MiB\n", mRank,
+            mConfig.backend.c_str(), seqLen, mConfig.concurrency, numRequests,
+            static_cast<double>(bytes) / (1024.0 * 1024.0));
+        printf("[rank %d]   latency ms: avg %.3f p50 %.3f p90 %.3f p95 %.3f p99 %.3f max %.3f\n", mRank, avgMs,
+            percentile(latenciesMs, 50), percentile(latenciesMs, 90), percentile(latenciesMs, 95),
+            percentile(latenciesMs, 99), latenciesMs.back());
+        printf("[rank %d]   bandwidth: %.3f GiB/s\n", mRank, bandwidthGiBs);
+        fflush(stdout);
+
+        if (!mConfig.outputCsv.empty())
+        {
+            bool const writeHeader = !std::ifstream(mConfig.outputCsv).good();
+            std::ofstream csv(mConfig.outputCsv, std::ios::app);
+            if (writeHeader)
+            {
+                csv << "rank,backend,num_layers,num_heads,size_per_head,tokens_per_block,seq_len,concurrency,"
+                       "num_requests,bytes_per_request,avg_ms,p50_ms,p90_ms,p95_ms,p99_ms,max_ms,bandwidth_gib_s\n";
+            }
+            csv << mRank << "," << mConfig.backend << "," << mConfig.numLayers << "," << mConfig.numHeads << ","
+                << mConfig.sizePerHead << "," << mConfig.tokensPerBlock << "," << seqLen << "," << mConfig.concurrency
+                << "," << numRequests << "," << bytes << "," << avgMs << "," << percentile(latenciesMs, 50) << ","
+                << percentile(latenciesMs, 90) << "," << percentile(latenciesMs, 95) << ","
+                << percentile(latenciesMs, 99) << "," << latenciesMs.back() << "," << bandwidthGiBs << "\n";
+        }
+    }
+
+    BenchmarkConfig mConfig;
+    tensorrt_llm::mpi::MpiComm const* mComm{nullptr};
+    int mRank{0};
+    int mPeerRank{0};
+    bool mIsSender{false};
+    LlmRequest::RequestIdType mRequestId{0};
+    std::unique_ptr<KVCacheManager> mManager;
+    std::unique_ptr<CacheTransBufferManager> mCacheTransBufferManager;
+    std::unique_ptr<texec::kv_cache::CacheState> mCacheState;
+    std::unique_ptr<texec::kv_cache::CommState> mContextCommState;
+    std::unique_ptr<texec::kv_cache::ConnectionManager> mConnectionManager;
+    std::unique_ptr<CacheSender> mSender;
+    std::unique_ptr<CacheReceiver> mReceiver;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options options(
+        "cacheTransceiverBenchmark", "Benchmark the disaggregated KV cache transfer layer in isolation.");
+    options.add_options()("h,help", "Print usage");
+    options.add_options()(
+        "backend", "Transfer backend: mpi/ucx/nixl/mooncake.", cxxopts::value<std::string>()->default_value("mpi"));
+    options.add_options()("num_layers", "Number of attention layers.", cxxopts::value<int>()->default_value("16"));
+    options.add_options()("num_heads", "Number of KV heads per layer.", cxxopts::value<int>()->default_value("8"));
+    options.add_options()("size_per_head", "Head dimension.", cxxopts::value<int>()->default_value("128"));
+    options.add_options()("tokens_per_block", "Tokens per KV cache block.", cxxopts::value<int>()->default_value("32"));
+    options.add_options()("dtype", "KV cache data type: float/half/fp8.",
+        cxxopts::value<std::string>()->default_value("half"));
+    options.add_options()("seq_lens", "Comma-separated sequence lengths to sweep.",
+        cxxopts::value<std::vector<int>>()->default_value("512,1024,4096"));
+    options.add_options()(
+        "num_requests", "Measured transfers per sequence length.", cxxopts::value<int>()->default_value("32"));
+    options.add_options()("warm_up", "Warm-up transfers per sequence length before measuring.",
+        cxxopts::value<int>()->default_value("4"));
+    options.add_options()(
+        "concurrency", "In-flight transfers per rank pair.", cxxopts::value<int>()->default_value("4"));
+    options.add_options()("transfer_buffer_tokens", "Token capacity of the cache transfer staging buffers.",
+        cxxopts::value<int>()->default_value("8192"));
+    options.add_options()("output_csv", "Append results to this CSV file.",
+        cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("log_level", "Choose log level between verbose/info/warning/error/internal_error.",
+        cxxopts::value<std::string>()->default_value("warning"));
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        printf("%s\n", options.help().c_str());
+        return 0;
+    }
+
+    auto const logLevel = result["log_level"].as<std::string>();
+    auto* logger = tensorrt_llm::common::Logger::getLogger();
+    if (logLevel == "verbose")
+    {
+        logger->setLevel(tensorrt_llm::common::Logger::TRACE);
+    }
+    else if (logLevel == "info")
+    {
+        logger->setLevel(tensorrt_llm::common::Logger::INFO);
+    }
+    else if (logLevel == "warning")
+    {
+        logger->setLevel(tensorrt_llm::common::Logger::WARNING);
+    }
+    else if (logLevel == "error")
+    {
+        logger->setLevel(tensorrt_llm::common::Logger::ERROR);
+    }
+    else if (logLevel == "internal_error")
+    {
+        logger->setLevel(tensorrt_llm::common::Logger::INTERNAL_ERROR);
+    }
+    else
+    {
+        TLLM_THROW("Unexpected log level: %s", logLevel.c_str());
+    }
+
+    BenchmarkConfig config;
+    config.backend = result["backend"].as<std::string>();
+    config.numLayers = result["num_layers"].as<int>();
+    config.numHeads = result["num_heads"].as<int>();
+    config.sizePerHead = result["size_per_head"].as<int>();
+    config.tokensPerBlock = result["tokens_per_block"].as<int>();
+    config.dataType = parseDataType(result["dtype"].as<std::string>());
+    auto const seqLens = result["seq_lens"].as<std::vector<int>>();
+    config.seqLens.assign(seqLens.begin(), seqLens.end());
+    config.numRequests = result["num_requests"].as<int>();
+    config.warmUp = result["warm_up"].as<int>();
+    config.concurrency = result["concurrency"].as<int>();
+    config.transferBufferTokens = result["transfer_buffer_tokens"].as<int>();
+    config.outputCsv = result["output_csv"].as<std::string>();
+
+    try
+    {
+        CacheTransceiverBenchmark benchmark(std::move(config));
+        benchmark.run();
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_ERROR(e.what());
+        return 1;
+    }
+    return 0;
+}
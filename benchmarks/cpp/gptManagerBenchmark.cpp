@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -29,6 +29,7 @@
 #include "tensorrt_llm/runtime/worldConfig.h"
 #include "utils/utils.h"
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <cxxopts.hpp>
@@ -167,12 +168,17 @@ class Recorder
 
 public:
     explicit Recorder(std::string opCsvFile, bool streaming = false, int beamWidth = 1,
-        std::string responsesJsonFile = "", bool excludeInputInOutput = false)
+        std::string responsesJsonFile = "", bool excludeInputInOutput = false,
+        std::optional<float> ttftSloMs = std::nullopt, std::optional<float> tpotSloMs = std::nullopt,
+        float steadyStateDelayMs = 0.F)
         : mOpCsvFile(std::move(opCsvFile))
         , mStreaming(streaming)
         , mBeamWidth(beamWidth)
         , mRespJsonFile(std::move(responsesJsonFile))
         , mOutputHasInput(!excludeInputInOutput)
+        , mTtftSloMs(ttftSloMs)
+        , mTpotSloMs(tpotSloMs)
+        , mSteadyStateDelayMs(steadyStateDelayMs)
     {
     }
 
@@ -310,8 +316,22 @@ public:
         int totalDecodingIter{0};
         mNumErrorSamples = 0;
         mNumSamples = 0;
+        mNumWarmupSamples = 0;
+
+        // Requests started before the steady-state point are warmup/ramp and excluded from metrics.
+        auto const steadyStart = mStart + std::chrono::milliseconds(static_cast<int64_t>(mSteadyStateDelayMs));
+        std::vector<std::vector<float>> bucketFtLatencies(kNumIslBuckets);
+        std::vector<std::vector<float>> bucketTpotLatencies(kNumIslBuckets);
+        std::vector<int> bucketSamples(kNumIslBuckets, 0);
+        std::vector<int> bucketMeetingSlo(kNumIslBuckets, 0);
+
         for (auto reqInfo : mRequestBenchInfos)
         {
+            if (mSteadyStateDelayMs > 0.F && reqInfo.second.start < steadyStart)
+            {
+                ++mNumWarmupSamples;
+                continue;
+            }
             if (!reqInfo.second.hasError)
             {
                 reqLatencies.push_back(reqInfo.second.latency);
@@ -330,6 +350,21 @@ public:
                     {
                         userTokensPerSecond.push_back(1000.F / reqInfo.second.avgGenT2TLatency.value());
                     }
+
+                    auto const bucket = islBucket(reqInfo.second.inputLength);
+                    ++bucketSamples[bucket];
+                    bucketFtLatencies[bucket].push_back(reqInfo.second.firstTokenLatency);
+                    bool meetsSlo = !mTtftSloMs || reqInfo.second.firstTokenLatency <= mTtftSloMs.value();
+                    if (reqInfo.second.avgGenT2TLatency)
+                    {
+                        bucketTpotLatencies[bucket].push_back(reqInfo.second.avgGenT2TLatency.value());
+                        meetsSlo = meetsSlo
+                            && (!mTpotSloMs || reqInfo.second.avgGenT2TLatency.value() <= mTpotSloMs.value());
+                    }
+                    if (meetsSlo)
+                    {
+                        ++bucketMeetingSlo[bucket];
+                    }
                 }
                 ++mNumSamples;
             }
@@ -339,7 +374,29 @@ public:
             }
         }
 
-        mTotalLatency = std::chrono::duration<float, std::milli>(mEnd - mStart).count();
+        mSloBucketStats.assign(kNumIslBuckets, SloBucketStats{});
+        for (size_t bucket = 0; bucket < kNumIslBuckets; ++bucket)
+        {
+            auto& stats = mSloBucketStats[bucket];
+            stats.numSamples = bucketSamples[bucket];
+            stats.numMeetingSlo = bucketMeetingSlo[bucket];
+            if (!bucketFtLatencies[bucket].empty())
+            {
+                std::sort(bucketFtLatencies[bucket].begin(), bucketFtLatencies[bucket].end());
+                stats.p50Ttft = calcPercentile(bucketFtLatencies[bucket], 50);
+                stats.p99Ttft = calcPercentile(bucketFtLatencies[bucket], 99);
+            }
+            if (!bucketTpotLatencies[bucket].empty())
+            {
+                std::sort(bucketTpotLatencies[bucket].begin(), bucketTpotLatencies[bucket].end());
+                stats.hasTpot = true;
+                stats.p50Tpot = calcPercentile(bucketTpotLatencies[bucket], 50);
+                stats.p99Tpot = calcPercentile(bucketTpotLatencies[bucket], 99);
+            }
+        }
+
+        // Throughput over the steady-state window only.
+        mTotalLatency = std::chrono::duration<float, std::milli>(mEnd - steadyStart).count();
         mSeqThroughput = mNumSamples / (mTotalLatency / 1000);
         mTokenThroughput = totalOutputTokens / (mTotalLatency / 1000);
         mAcceptanceRate = totalDecodingIter
@@ -454,6 +511,38 @@ public:
             printf("[BENCHMARK] p90_request_queueing_latency(ms) %.2f\n", mP90ReqQueueingLatency);
             printf("[BENCHMARK] p50_request_queueing_latency(ms) %.2f\n\n", mP50ReqQueueingLatency);
         }
+
+        if (mSteadyStateDelayMs > 0.F)
+        {
+            printf("[BENCHMARK] num_warmup_samples_excluded %d\n\n", mNumWarmupSamples);
+        }
+
+        if (mStreaming && (mTtftSloMs || mTpotSloMs))
+        {
+            int totalSamples = 0;
+            int totalMeetingSlo = 0;
+            for (size_t bucket = 0; bucket < kNumIslBuckets; ++bucket)
+            {
+                auto const& stats = mSloBucketStats[bucket];
+                if (stats.numSamples == 0)
+                {
+                    continue;
+                }
+                totalSamples += stats.numSamples;
+                totalMeetingSlo += stats.numMeetingSlo;
+                printf("[BENCHMARK] %s num_samples %d p50_ttft(ms) %.2f p99_ttft(ms) %.2f", islBucketLabel(bucket).c_str(),
+                    stats.numSamples, stats.p50Ttft, stats.p99Ttft);
+                if (stats.hasTpot)
+                {
+                    printf(" p50_tpot(ms) %.2f p99_tpot(ms) %.2f", stats.p50Tpot, stats.p99Tpot);
+                }
+                printf(" slo_attainment(%%) %.2f\n", 100.F * stats.numMeetingSlo / stats.numSamples);
+            }
+            if (totalSamples > 0)
+            {
+                printf("[BENCHMARK] overall_slo_attainment(%%) %.2f\n\n", 100.F * totalMeetingSlo / totalSamples);
+            }
+        }
     }
 
     void writeOpMetricsToCsv()
@@ -556,6 +645,37 @@ public:
     }
 
 private:
+    // Input-length class boundaries for per-class SLO reporting.
+    static constexpr std::array<int32_t, 4> kIslBucketBounds{128, 512, 2048, 8192};
+    static constexpr size_t kNumIslBuckets = kIslBucketBounds.size() + 1;
+
+    struct SloBucketStats
+    {
+        int numSamples{0};
+        int numMeetingSlo{0};
+        float p50Ttft{};
+        float p99Ttft{};
+        float p50Tpot{};
+        float p99Tpot{};
+        bool hasTpot{false};
+    };
+
+    static size_t islBucket(int inputLength)
+    {
+        size_t bucket = 0;
+        while (bucket < kIslBucketBounds.size() && inputLength > kIslBucketBounds[bucket])
+        {
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    static std::string islBucketLabel(size_t bucket)
+    {
+        return bucket < kIslBucketBounds.size() ? "isl<=" + std::to_string(kIslBucketBounds[bucket])
+                                                : "isl>" + std::to_string(kIslBucketBounds.back());
+    }
+
     std::unordered_map<uint64_t, BenchInfo> mRequestBenchInfos;
 
     std::chrono::time_point<std::chrono::steady_clock> mStart;
@@ -604,6 +724,11 @@ private:
     std::string mRespJsonFile;
     std::unordered_map<uint64_t, texec::VecTokens> mResponseTensors;
     bool mOutputHasInput;
+    std::optional<float> mTtftSloMs;
+    std::optional<float> mTpotSloMs;
+    float mSteadyStateDelayMs;
+    int mNumWarmupSamples{};
+    std::vector<SloBucketStats> mSloBucketStats;
     std::mutex mRequestBenchInfosMutex;
 
 }; // class Recorder
@@ -857,7 +982,8 @@ void benchmarkExecutor(std::optional<std::filesystem::path> const& decoderEngine
     auto const samples = parseWorkloadJson(datasetPath, maxNumSamples, maxPromptLen);
     auto const numSamples = samples.size();
 
-    auto recorder = std::make_shared<Recorder>(opCsvFile, benchmarkParams.streaming, beamWidth, responsesJsonFile);
+    auto recorder = std::make_shared<Recorder>(opCsvFile, benchmarkParams.streaming, beamWidth, responsesJsonFile,
+        false, benchmarkParams.ttftSlo, benchmarkParams.tpotSlo, benchmarkParams.steadyStateDelay * 1000.F);
     int32_t decoderStartTokenId = 0;
     std::shared_ptr<ExecutorServer> executorServer;
 
@@ -968,7 +1094,7 @@ void benchmarkExecutor(std::optional<std::filesystem::path> const& decoderEngine
 
         // Benchmark
         {
-            auto timeDelays = computeTimeDelays(benchmarkParams, numSamples - 1);
+            auto timeDelays = computeArrivalDelays(benchmarkParams, samples);
 
             // Create requests
             recorder->initialize();
@@ -1103,6 +1229,23 @@ int main(int argc, char* argv[])
         cxxopts::value<bool>()->default_value("false"));
     options.add_options()("enable_exp_delays", "Enables exponential delay distr to mimic real world request arrival",
         cxxopts::value<bool>()->default_value("false"));
+    options.add_options()("arrival_process",
+        "Arrival process for sustained-load benchmarking: constant (request_rate/enable_exp_delays behavior), "
+        "poisson, bursty (two-state MMPP) or trace (replay 'timestamp' fields from the dataset).",
+        cxxopts::value<std::string>()->default_value("constant"));
+    options.add_options()("burstiness", "Peak-to-mean rate ratio of the bursty arrival process.",
+        cxxopts::value<float>()->default_value("4.0"));
+    options.add_options()("burst_fraction", "Fraction of time the bursty arrival process spends in the burst state.",
+        cxxopts::value<float>()->default_value("0.2"));
+    options.add_options()("steady_state_delay",
+        "Exclude requests enqueued during the first given seconds from metrics, separating ramp-up from steady state.",
+        cxxopts::value<float>()->default_value("0.0"));
+    options.add_options()(
+        "ttft_slo", "Time-to-first-token SLO in milliseconds for attainment reporting (streaming mode only).",
+        cxxopts::value<float>());
+    options.add_options()(
+        "tpot_slo", "Time-per-output-token SLO in milliseconds for attainment reporting (streaming mode only).",
+        cxxopts::value<float>());
     options.add_options()("streaming",
         "Operate in streaming mode. Note: it reflects time-to-first-token and inter-token-latency",
         cxxopts::value<bool>()->default_value("false"));
@@ -1320,6 +1463,35 @@ int main(int argc, char* argv[])
 
     benchmarkParams.enableExpDelays = result["enable_exp_delays"].as<bool>();
 
+    // Argument: arrival process for sustained-load benchmarking
+    benchmarkParams.arrivalProcess = result["arrival_process"].as<std::string>();
+    if (benchmarkParams.arrivalProcess != "constant" && benchmarkParams.arrivalProcess != "poisson"
+        && benchmarkParams.arrivalProcess != "bursty" && benchmarkParams.arrivalProcess != "trace")
+    {
+        TLLM_LOG_ERROR("Unexpected arrival process: " + benchmarkParams.arrivalProcess);
+        return 1;
+    }
+    benchmarkParams.burstiness = result["burstiness"].as<float>();
+    benchmarkParams.burstFraction = result["burst_fraction"].as<float>();
+
+    // Argument: warmup/steady-state separation
+    benchmarkParams.steadyStateDelay = result["steady_state_delay"].as<float>();
+
+    // Argument: SLO thresholds for attainment reporting
+    if (result.count("ttft_slo"))
+    {
+        benchmarkParams.ttftSlo = result["ttft_slo"].as<float>();
+    }
+    if (result.count("tpot_slo"))
+    {
+        benchmarkParams.tpotSlo = result["tpot_slo"].as<float>();
+    }
+    if ((benchmarkParams.ttftSlo || benchmarkParams.tpotSlo) && !benchmarkParams.streaming)
+    {
+        TLLM_LOG_ERROR("ttft_slo and tpot_slo require streaming mode.");
+        return 1;
+    }
+
     // Argument: Enable batch stats output
     bool logIterationData = result["log_iteration_data"].as<bool>();
 
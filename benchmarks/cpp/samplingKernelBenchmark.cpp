@@ -0,0 +1,562 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmarks for the decode-path kernels: TopK sampling, Air TopP sampling, penalty
+// application and beam search. Each kernel is swept over (batch, vocab, k/p, beams) with
+// CUDA-event timing, so decode-kernel regressions can be caught directly instead of through
+// end-to-end TPOT graphs. The GiB/s column divides the dominant logits traffic by the runtime;
+// compare it against the printed device DRAM bandwidth for a roofline estimate of how close
+// each configuration is to being memory bound.
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/memoryUtils.h"
+#include "tensorrt_llm/kernels/beamSearchKernels.h"
+#include "tensorrt_llm/kernels/decodingCommon.h"
+#include "tensorrt_llm/kernels/penaltyKernels.h"
+#include "tensorrt_llm/kernels/samplingTopKKernels.h"
+#include "tensorrt_llm/kernels/samplingTopPKernels.h"
+#include "tensorrt_llm/kernels/topkLastDim.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
+#include "tensorrt_llm/runtime/cudaStream.h"
+
+#include "cxxopts.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace tc = tensorrt_llm::common;
+namespace tk = tensorrt_llm::kernels;
+namespace tr = tensorrt_llm::runtime;
+
+using tr::BufferManager;
+using tr::ITensor;
+using tr::SizeType32;
+using tr::TokenIdType;
+
+namespace
+{
+
+struct BenchmarkConfig
+{
+    std::vector<SizeType32> batchSizes{1, 8, 32, 128};
+    std::vector<SizeType32> vocabSizes{32000, 128256};
+    std::vector<SizeType32> topKs{1, 8, 64, 1024};
+    std::vector<float> topPs{0.5f, 0.9f, 1.0f};
+    std::vector<SizeType32> beamWidths{2, 4, 8};
+    SizeType32 warmUp{10};
+    SizeType32 iterations{100};
+};
+
+struct BenchmarkContext
+{
+    std::shared_ptr<tr::CudaStream> stream;
+    std::unique_ptr<BufferManager> bufferManager;
+    std::mt19937 rng{42};
+    int smCount{0};
+    size_t maxSharedMemoryPerBlock{0};
+};
+
+template <typename F>
+double timeKernelMs(BenchmarkContext& ctx, BenchmarkConfig const& config, F&& launch)
+{
+    for (SizeType32 i = 0; i < config.warmUp; ++i)
+    {
+        launch();
+    }
+    cudaEvent_t start;
+    cudaEvent_t stop;
+    TLLM_CUDA_CHECK(cudaEventCreate(&start));
+    TLLM_CUDA_CHECK(cudaEventCreate(&stop));
+    TLLM_CUDA_CHECK(cudaEventRecord(start, ctx.stream->get()));
+    for (SizeType32 i = 0; i < config.iterations; ++i)
+    {
+        launch();
+    }
+    TLLM_CUDA_CHECK(cudaEventRecord(stop, ctx.stream->get()));
+    TLLM_CUDA_CHECK(cudaEventSynchronize(stop));
+    float elapsedMs{0.0f};
+    TLLM_CUDA_CHECK(cudaEventElapsedTime(&elapsedMs, start, stop));
+    TLLM_CUDA_CHECK(cudaEventDestroy(start));
+    TLLM_CUDA_CHECK(cudaEventDestroy(stop));
+    return static_cast<double>(elapsedMs) / config.iterations;
+}
+
+void reportLine(char const* kernel, std::string const& configStr, double msPerCall, size_t logitsBytes)
+{
+    auto const gibPerSecond = static_cast<double>(logitsBytes) / (msPerCall * 1e-3) / (1024.0 * 1024.0 * 1024.0);
+    printf("%-12s %-48s %10.4f ms %10.2f GiB/s\n", kernel, configStr.c_str(), msPerCall, gibPerSecond);
+    fflush(stdout);
+}
+
+template <typename T>
+void fillRandomLogits(BenchmarkContext& ctx, T* devicePtr, size_t numElements)
+{
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+    std::vector<T> host(numElements);
+    for (auto& value : host)
+    {
+        value = T(dist(ctx.rng));
+    }
+    TLLM_CUDA_CHECK(cudaMemcpy(devicePtr, host.data(), numElements * sizeof(T), cudaMemcpyHostToDevice));
+}
+
+//! Fills [batchSize, vocabSize] with row-wise softmax of random logits; the TopP kernels consume
+//! probabilities, and a peaked distribution exercises the data-dependent selection realistically.
+template <typename T>
+void fillRandomProbs(BenchmarkContext& ctx, T* devicePtr, SizeType32 batchSize, SizeType32 vocabSize)
+{
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+    std::vector<T> host(static_cast<size_t>(batchSize) * vocabSize);
+    std::vector<float> row(vocabSize);
+    for (SizeType32 bi = 0; bi < batchSize; ++bi)
+    {
+        float sum = 0.0f;
+        for (SizeType32 vi = 0; vi < vocabSize; ++vi)
+        {
+            row[vi] = std::exp(dist(ctx.rng));
+            sum += row[vi];
+        }
+        for (SizeType32 vi = 0; vi < vocabSize; ++vi)
+        {
+            host[static_cast<size_t>(bi) * vocabSize + vi] = T(row[vi] / sum);
+        }
+    }
+    TLLM_CUDA_CHECK(cudaMemcpy(devicePtr, host.data(), host.size() * sizeof(T), cudaMemcpyHostToDevice));
+}
+
+tr::ITensor::SharedPtr initCurandStates(BenchmarkContext& ctx, SizeType32 batchSize)
+{
+    auto states = ctx.bufferManager->gpu(
+        ITensor::makeShape({batchSize, static_cast<SizeType32>(sizeof(curandState_t))}), nvinfer1::DataType::kUINT8);
+    tk::invokeCurandInitialize(
+        reinterpret_cast<curandState_t*>(tr::bufferCast<uint8_t>(*states)), nullptr, batchSize, 42, ctx.stream->get());
+    return states;
+}
+
+template <typename T>
+void benchTopK(BenchmarkContext& ctx, BenchmarkConfig const& config, SizeType32 batchSize, SizeType32 vocabSize,
+    SizeType32 topK, nvinfer1::DataType dataType)
+{
+    // Output ids are indexed by the growing sequence length, so leave room for every timed call.
+    auto const maxSeqLen = config.warmUp + config.iterations + 1;
+
+    auto logits = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, vocabSize}), dataType);
+    fillRandomLogits(ctx, tr::bufferCast<T>(*logits), static_cast<size_t>(batchSize) * vocabSize);
+    auto outputIds = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, maxSeqLen}), nvinfer1::DataType::kINT32);
+    auto seqLens = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    ctx.bufferManager->setZero(*seqLens);
+    auto endIds = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    // endId -1 never matches a sampled token, so no request finishes mid-benchmark.
+    std::fill_n(tr::bufferCast<TokenIdType>(*endIds), batchSize, -1);
+    auto finished = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kUINT8);
+    ctx.bufferManager->setZero(*finished);
+    auto const workspaceSize
+        = tk::getTopKWorkspaceSize<T>(batchSize, /*maxTokensPerStep=*/1, topK, vocabSize);
+    auto workspace = ctx.bufferManager->gpu(workspaceSize);
+    auto curandStates = initCurandStates(ctx, batchSize);
+
+    tk::TopKSamplingKernelParams<T> params;
+    params.logProbs = tr::bufferCast<T>(*logits);
+    params.outputIds = tr::bufferCast<TokenIdType>(*outputIds);
+    params.workspace = workspace->data();
+    params.endIds = tr::bufferCast<TokenIdType>(*endIds);
+    params.sequenceLengths = tr::bufferCast<SizeType32>(*seqLens);
+    params.finishedOutput = reinterpret_cast<tk::FinishedState*>(tr::bufferCast<uint8_t>(*finished));
+    params.curandState = reinterpret_cast<curandState_t*>(tr::bufferCast<uint8_t>(*curandStates));
+    params.maxTopK = topK;
+    params.maxTopP = 1.0f;
+    params.batchSize = batchSize;
+    params.maxBatchSize = batchSize;
+    params.vocabSizePadded = vocabSize;
+    params.maxTokensPerStep = 1;
+    params.maxSeqLen = maxSeqLen;
+
+    auto const msPerCall
+        = timeKernelMs(ctx, config, [&]() { tk::invokeBatchTopKSampling(params, ctx.stream->get()); });
+    auto const configStr = "batch " + std::to_string(batchSize) + " vocab " + std::to_string(vocabSize) + " k "
+        + std::to_string(topK);
+    reportLine("topk", configStr, msPerCall, static_cast<size_t>(batchSize) * vocabSize * sizeof(T));
+}
+
+template <typename T>
+void benchAirTopP(BenchmarkContext& ctx, BenchmarkConfig const& config, SizeType32 batchSize, SizeType32 vocabSize,
+    float topP, nvinfer1::DataType dataType)
+{
+    auto const maxSeqLen = config.warmUp + config.iterations + 1;
+
+    auto probs = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, vocabSize}), dataType);
+    fillRandomProbs(ctx, tr::bufferCast<T>(*probs), batchSize, vocabSize);
+    auto outputIds = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, maxSeqLen}), nvinfer1::DataType::kINT32);
+    auto seqLens = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    ctx.bufferManager->setZero(*seqLens);
+    auto endIds = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    std::fill_n(tr::bufferCast<TokenIdType>(*endIds), batchSize, -1);
+    auto finished = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kUINT8);
+    ctx.bufferManager->setZero(*finished);
+    auto topPsBuf = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*topPsBuf), batchSize, topP);
+    auto workspace = ctx.bufferManager->gpu(tk::getAirTopPWorkspaceSize<T>(batchSize, vocabSize));
+    auto curandStates = initCurandStates(ctx, batchSize);
+
+    tk::TopPSamplingKernelParams<T> params;
+    params.probs = tr::bufferCast<T>(*probs);
+    params.outputIds = tr::bufferCast<TokenIdType>(*outputIds);
+    params.workspace = workspace->data();
+    params.topPs = tr::bufferCast<float>(*topPsBuf);
+    params.sequenceLength = tr::bufferCast<SizeType32>(*seqLens);
+    params.endIds = tr::bufferCast<TokenIdType>(*endIds);
+    params.finishedOutput = reinterpret_cast<tk::FinishedState*>(tr::bufferCast<uint8_t>(*finished));
+    params.curandState = reinterpret_cast<curandState_t*>(tr::bufferCast<uint8_t>(*curandStates));
+    params.blockNum = tk::calcAirTopPBlockNum<T>(batchSize, vocabSize, ctx.smCount);
+    params.isDeterministic = false;
+    params.batchSize = batchSize;
+    params.maxBatchSize = batchSize;
+    params.vocabSizePadded = vocabSize;
+    params.maxSeqLen = maxSeqLen;
+
+    auto const msPerCall
+        = timeKernelMs(ctx, config, [&]() { tk::invokeBatchAirTopPSampling(params, ctx.stream->get()); });
+    auto const configStr
+        = "batch " + std::to_string(batchSize) + " vocab " + std::to_string(vocabSize) + " p " + std::to_string(topP);
+    reportLine("airtopp", configStr, msPerCall, static_cast<size_t>(batchSize) * vocabSize * sizeof(T));
+}
+
+template <typename T>
+void benchPenalty(BenchmarkContext& ctx, BenchmarkConfig const& config, SizeType32 batchSize, SizeType32 vocabSize,
+    nvinfer1::DataType dataType)
+{
+    // Fixed token history per request; the kernel rebuilds the occurrence table from it each step.
+    SizeType32 constexpr historyLen = 256;
+    auto const ptrType = tr::TRTDataType<T*>::value;
+
+    auto logits = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, vocabSize}), dataType);
+    fillRandomLogits(ctx, tr::bufferCast<T>(*logits), static_cast<size_t>(batchSize) * vocabSize);
+    auto outLogits = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, vocabSize}), dataType);
+    auto logitsPtrs = BufferManager::pinned(ITensor::makeShape({batchSize}), ptrType);
+    auto logitsPtrsRange = tr::BufferRange<T*>(*logitsPtrs);
+    for (SizeType32 bi = 0; bi < batchSize; ++bi)
+    {
+        logitsPtrsRange[bi] = tr::bufferCast<T>(*logits) + static_cast<size_t>(bi) * vocabSize;
+    }
+
+    auto outputIds = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, historyLen}), nvinfer1::DataType::kINT32);
+    {
+        std::uniform_int_distribution<TokenIdType> dist(0, vocabSize - 1);
+        std::vector<TokenIdType> host(static_cast<size_t>(batchSize) * historyLen);
+        for (auto& token : host)
+        {
+            token = dist(ctx.rng);
+        }
+        TLLM_CUDA_CHECK(cudaMemcpy(tr::bufferCast<TokenIdType>(*outputIds), host.data(),
+            host.size() * sizeof(TokenIdType), cudaMemcpyHostToDevice));
+    }
+    auto idsPtrs = BufferManager::pinned(ITensor::makeShape({batchSize}), tr::TRTDataType<TokenIdType*>::value);
+    auto idsPtrsRange = tr::BufferRange<TokenIdType*>(*idsPtrs);
+    for (SizeType32 bi = 0; bi < batchSize; ++bi)
+    {
+        idsPtrsRange[bi] = tr::bufferCast<TokenIdType>(*outputIds) + static_cast<size_t>(bi) * historyLen;
+    }
+
+    auto seqLens = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    std::fill_n(tr::bufferCast<SizeType32>(*seqLens), batchSize, historyLen);
+    auto penaltyWorkspace
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, 2 * vocabSize}), nvinfer1::DataType::kINT32);
+
+    auto temperatures = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*temperatures), batchSize, 0.8f);
+    auto repetitionPenalties = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*repetitionPenalties), batchSize, 1.1f);
+    auto presencePenalties = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*presencePenalties), batchSize, 0.1f);
+    auto frequencyPenalties = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*frequencyPenalties), batchSize, 0.1f);
+
+    tk::InvokeBatchApplyPenaltyParams<T> params{};
+    params.inputLogits = const_cast<T const* const*>(logitsPtrsRange.begin());
+    params.outputLogits = tr::bufferCast<T>(*outLogits);
+    params.penaltyWorkspace = tr::bufferCast<TokenIdType>(*penaltyWorkspace);
+    params.temperatures = tr::bufferCast<float>(*temperatures);
+    params.repetitionPenalties = tr::bufferCast<float>(*repetitionPenalties);
+    params.presencePenalties = tr::bufferCast<float>(*presencePenalties);
+    params.frequencyPenalties = tr::bufferCast<float>(*frequencyPenalties);
+    params.batchSize = batchSize;
+    params.beamWidth = 1;
+    params.maxSeqLen = historyLen;
+    params.vocabSize = vocabSize;
+    params.vocabSizePadded = vocabSize;
+    params.outputIdsPtr = const_cast<TokenIdType const**>(idsPtrsRange.begin());
+    params.inputLengths = tr::bufferCast<SizeType32>(*seqLens);
+    params.sequenceLengths = tr::bufferCast<SizeType32>(*seqLens);
+    params.maxTokensPerStep = 1;
+    params.stream = ctx.stream->get();
+
+    auto const msPerCall = timeKernelMs(ctx, config, [&]() { tk::invokeBatchApplyPenalty(params); });
+    auto const configStr = "batch " + std::to_string(batchSize) + " vocab " + std::to_string(vocabSize) + " history "
+        + std::to_string(historyLen);
+    // Logits are read and written back once each.
+    reportLine("penalty", configStr, msPerCall, 2 * static_cast<size_t>(batchSize) * vocabSize * sizeof(T));
+}
+
+template <typename T>
+void benchBeamSearch(BenchmarkContext& ctx, BenchmarkConfig const& config, SizeType32 batchSize, SizeType32 vocabSize,
+    SizeType32 beamWidth, nvinfer1::DataType dataType)
+{
+    auto const maxSeqLen = config.warmUp + config.iterations + 2;
+    auto const paddedBeamWidth = tk::padToNextPowerOfTwo(beamWidth);
+
+    auto logProbs = ctx.bufferManager->gpu(ITensor::makeShape({batchSize * beamWidth, vocabSize}), dataType);
+    fillRandomLogits(ctx, tr::bufferCast<T>(*logProbs), static_cast<size_t>(batchSize) * beamWidth * vocabSize);
+
+    auto cumLogProbs = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, beamWidth}), nvinfer1::DataType::kFLOAT);
+    ctx.bufferManager->setZero(*cumLogProbs);
+    auto finished = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, beamWidth}), nvinfer1::DataType::kUINT8);
+    ctx.bufferManager->setZero(*finished);
+    auto seqLens = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, beamWidth}), nvinfer1::DataType::kINT32);
+    ctx.bufferManager->setZero(*seqLens);
+    auto inputLengths = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, beamWidth}), nvinfer1::DataType::kINT32);
+    ctx.bufferManager->setZero(*inputLengths);
+    auto endIds = BufferManager::pinned(ITensor::makeShape({batchSize, beamWidth}), nvinfer1::DataType::kINT32);
+    std::fill_n(tr::bufferCast<TokenIdType>(*endIds), static_cast<size_t>(batchSize) * beamWidth, -1);
+    auto batchSlots = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    std::iota(tr::bufferCast<SizeType32>(*batchSlots), tr::bufferCast<SizeType32>(*batchSlots) + batchSize, 0);
+    auto diversityRates = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*diversityRates), batchSize, 0.0f);
+    auto lengthPenalties = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    std::fill_n(tr::bufferCast<float>(*lengthPenalties), batchSize, 0.0f);
+    auto earlyStoppings = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    std::fill_n(tr::bufferCast<SizeType32>(*earlyStoppings), batchSize, 0);
+
+    auto outputIds
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, beamWidth, maxSeqLen}), nvinfer1::DataType::kINT32);
+    auto parentIds
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, beamWidth, maxSeqLen}), nvinfer1::DataType::kINT32);
+    ctx.bufferManager->setZero(*parentIds);
+    auto outputIdsPtrs = BufferManager::pinned(ITensor::makeShape({batchSize}), tr::TRTDataType<TokenIdType*>::value);
+    auto parentIdsPtrs = BufferManager::pinned(ITensor::makeShape({batchSize}), tr::TRTDataType<SizeType32*>::value);
+    for (SizeType32 bi = 0; bi < batchSize; ++bi)
+    {
+        tr::BufferRange<TokenIdType*>(*outputIdsPtrs)[bi]
+            = tr::bufferCast<TokenIdType>(*outputIds) + static_cast<size_t>(bi) * beamWidth * maxSeqLen;
+        tr::BufferRange<SizeType32*>(*parentIdsPtrs)[bi]
+            = tr::bufferCast<SizeType32>(*parentIds) + static_cast<size_t>(bi) * beamWidth * maxSeqLen;
+    }
+    auto logProbsTiled = ctx.bufferManager->gpu(
+        ITensor::makeShape({maxSeqLen, batchSize, beamWidth}), nvinfer1::DataType::kFLOAT);
+
+    // Candidate-Beam-Array buffers, sized for 2x beam width like the decoder does.
+    auto outputIdsCBA
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, 2 * beamWidth, maxSeqLen}), nvinfer1::DataType::kINT32);
+    auto logProbsCBA
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, 2 * beamWidth, maxSeqLen}), nvinfer1::DataType::kFLOAT);
+    auto seqLensCBA = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, 2 * beamWidth}), nvinfer1::DataType::kINT32);
+    auto cumLogProbsCBA
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, 2 * beamWidth}), nvinfer1::DataType::kFLOAT);
+    auto normedScoresCBA
+        = ctx.bufferManager->gpu(ITensor::makeShape({batchSize, 2 * beamWidth}), nvinfer1::DataType::kFLOAT);
+    auto numBeamsCBA = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    ctx.bufferManager->setZero(*numBeamsCBA);
+    auto minNormedScoresCBA = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kFLOAT);
+    auto batchDones = ctx.bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kBOOL);
+    ctx.bufferManager->setZero(*batchDones);
+
+    tk::BeamHypotheses bh;
+    bh.nMaxBatchSize = batchSize;
+    bh.nBatchSize = batchSize;
+    bh.nBeamWidth = beamWidth;
+    bh.nMaxSeqLen = maxSeqLen;
+    bh.nVocabSize = vocabSize;
+    bh.nByteMaxSharedMemoryPerBlock = ctx.maxSharedMemoryPerBlock;
+    bh.diversityRates = tr::bufferCast<float>(*diversityRates);
+    bh.lengthPenalties = tr::bufferCast<float>(*lengthPenalties);
+    bh.earlyStoppings = tr::bufferCast<SizeType32>(*earlyStoppings);
+    bh.inputLengths = tr::bufferCast<SizeType32>(*inputLengths);
+    bh.endIds = tr::bufferCast<TokenIdType>(*endIds);
+    bh.batchSlots = tr::bufferCast<SizeType32>(*batchSlots);
+    bh.logProbsTiled = tr::bufferCast<float>(*logProbsTiled);
+    bh.sequenceLengths = tr::bufferCast<SizeType32>(*seqLens);
+    bh.cumLogProbs = tr::bufferCast<float>(*cumLogProbs);
+    bh.outputIdsCBA = tr::bufferCast<TokenIdType>(*outputIdsCBA);
+    bh.logProbsCBA = tr::bufferCast<float>(*logProbsCBA);
+    bh.sequenceLengthsCBA = tr::bufferCast<SizeType32>(*seqLensCBA);
+    bh.cumLogProbsCBA = tr::bufferCast<float>(*cumLogProbsCBA);
+    bh.normedScoresCBA = tr::bufferCast<float>(*normedScoresCBA);
+    bh.numBeamsCBA = tr::bufferCast<SizeType32>(*numBeamsCBA);
+    bh.minNormedScoresCBA = tr::bufferCast<float>(*minNormedScoresCBA);
+    bh.batchDones = tr::bufferCast<bool>(*batchDones);
+    bh.finished = reinterpret_cast<tk::FinishedState*>(tr::bufferCast<uint8_t>(*finished));
+    bh.outputIdsPtr = tr::bufferCast<TokenIdType*>(*outputIdsPtrs);
+    bh.parentIdsPtr = tr::bufferCast<SizeType32*>(*parentIdsPtrs);
+
+    // Workspace layout of the V2 workflow; see BeamSearchLayer<T>::configureBeamSearchLayer.
+    auto const nByteStage1LogProbs = tc::roundUp(sizeof(T) * batchSize * paddedBeamWidth * paddedBeamWidth * 2, 4);
+    auto const nByteStage1Ids = tc::roundUp(sizeof(int) * batchSize * paddedBeamWidth * paddedBeamWidth * 2, 4);
+    auto const nByteStage2LogProbs = tc::roundUp(sizeof(T) * batchSize * paddedBeamWidth * 2, 4);
+    auto const nByteStage2Ids = tc::roundUp(sizeof(int) * batchSize * paddedBeamWidth * 2, 4);
+    auto const nByteStage1TopK
+        = tk::invokeComputeTopkLastDimWorkspaceSize<T>(batchSize * beamWidth, vocabSize, paddedBeamWidth * 2, true);
+    auto const nByteStage2TopK = tk::invokeComputeTopkLastDimWorkspaceSize<T>(
+        batchSize, paddedBeamWidth * paddedBeamWidth * 2, beamWidth * 2, true);
+    auto const nByteStage3 = sizeof(T) * beamWidth * beamWidth * 2;
+    auto const workspaceSize = nByteStage2LogProbs + nByteStage2Ids
+        + std::max(nByteStage1LogProbs + nByteStage1Ids + std::max(nByteStage1TopK, nByteStage2TopK), nByteStage3);
+    auto workspace = ctx.bufferManager->gpu(workspaceSize);
+
+    auto const msPerCall = timeKernelMs(ctx, config,
+        [&]()
+        {
+            tk::invokeTopkBeamSearch<T, true>(
+                tr::bufferCast<T>(*logProbs), nullptr, workspace->data(), bh, ctx.stream->get());
+        });
+    auto const configStr = "batch " + std::to_string(batchSize) + " vocab " + std::to_string(vocabSize) + " beams "
+        + std::to_string(beamWidth);
+    reportLine("beamsearch", configStr, msPerCall, static_cast<size_t>(batchSize) * beamWidth * vocabSize * sizeof(T));
+}
+
+template <typename T>
+void runBenchmarks(
+    BenchmarkContext& ctx, BenchmarkConfig const& config, std::string const& kernels, nvinfer1::DataType dataType)
+{
+    for (auto const batchSize : config.batchSizes)
+    {
+        for (auto const vocabSize : config.vocabSizes)
+        {
+            if (kernels.find("topk") != std::string::npos)
+            {
+                for (auto const topK : config.topKs)
+                {
+                    benchTopK<T>(ctx, config, batchSize, vocabSize, topK, dataType);
+                }
+            }
+            if (kernels.find("airtopp") != std::string::npos)
+            {
+                for (auto const topP : config.topPs)
+                {
+                    benchAirTopP<T>(ctx, config, batchSize, vocabSize, topP, dataType);
+                }
+            }
+            if (kernels.find("penalty") != std::string::npos)
+            {
+                benchPenalty<T>(ctx, config, batchSize, vocabSize, dataType);
+            }
+            if (kernels.find("beamsearch") != std::string::npos)
+            {
+                for (auto const beamWidth : config.beamWidths)
+                {
+                    benchBeamSearch<T>(ctx, config, batchSize, vocabSize, beamWidth, dataType);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options options(
+        "samplingKernelBenchmark", "Microbenchmarks for the decode-path sampling and beam search kernels.");
+    options.add_options()("h,help", "Print usage");
+    options.add_options()("kernels", "Comma-separated subset of topk,airtopp,penalty,beamsearch.",
+        cxxopts::value<std::string>()->default_value("topk,airtopp,penalty,beamsearch"));
+    options.add_options()(
+        "dtype", "Logits data type: float/half.", cxxopts::value<std::string>()->default_value("half"));
+    options.add_options()(
+        "batch_sizes", "Batch sizes to sweep.", cxxopts::value<std::vector<int>>()->default_value("1,8,32,128"));
+    options.add_options()(
+        "vocab_sizes", "Vocab sizes to sweep.", cxxopts::value<std::vector<int>>()->default_value("32000,128256"));
+    options.add_options()(
+        "top_ks", "TopK values to sweep.", cxxopts::value<std::vector<int>>()->default_value("1,8,64,1024"));
+    options.add_options()(
+        "top_ps", "TopP values to sweep.", cxxopts::value<std::vector<float>>()->default_value("0.5,0.9,1.0"));
+    options.add_options()(
+        "beam_widths", "Beam widths to sweep.", cxxopts::value<std::vector<int>>()->default_value("2,4,8"));
+    options.add_options()(
+        "warm_up", "Warm-up launches per configuration.", cxxopts::value<int>()->default_value("10"));
+    options.add_options()(
+        "iterations", "Timed launches per configuration.", cxxopts::value<int>()->default_value("100"));
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        printf("%s\n", options.help().c_str());
+        return 0;
+    }
+
+    BenchmarkConfig config;
+    auto const assignSizes = [](std::vector<SizeType32>& dst, std::vector<int> const& src)
+    { dst.assign(src.begin(), src.end()); };
+    assignSizes(config.batchSizes, result["batch_sizes"].as<std::vector<int>>());
+    assignSizes(config.vocabSizes, result["vocab_sizes"].as<std::vector<int>>());
+    assignSizes(config.topKs, result["top_ks"].as<std::vector<int>>());
+    config.topPs = result["top_ps"].as<std::vector<float>>();
+    assignSizes(config.beamWidths, result["beam_widths"].as<std::vector<int>>());
+    config.warmUp = result["warm_up"].as<int>();
+    config.iterations = result["iterations"].as<int>();
+
+    auto const dtype = result["dtype"].as<std::string>();
+    auto const kernels = result["kernels"].as<std::string>();
+
+    BenchmarkContext ctx;
+    ctx.stream = std::make_shared<tr::CudaStream>();
+    ctx.bufferManager = std::make_unique<BufferManager>(ctx.stream);
+
+    int device{0};
+    TLLM_CUDA_CHECK(cudaGetDevice(&device));
+    TLLM_CUDA_CHECK(cudaDeviceGetAttribute(&ctx.smCount, cudaDevAttrMultiProcessorCount, device));
+    int sharedMemoryPerBlockOptin{0};
+    TLLM_CUDA_CHECK(
+        cudaDeviceGetAttribute(&sharedMemoryPerBlockOptin, cudaDevAttrMaxSharedMemoryPerBlockOptin, device));
+    ctx.maxSharedMemoryPerBlock = sharedMemoryPerBlockOptin;
+    int memoryClockKHz{0};
+    int memoryBusWidth{0};
+    TLLM_CUDA_CHECK(cudaDeviceGetAttribute(&memoryClockKHz, cudaDevAttrMemoryClockRate, device));
+    TLLM_CUDA_CHECK(cudaDeviceGetAttribute(&memoryBusWidth, cudaDevAttrGlobalMemoryBusWidth, device));
+    auto const peakBandwidthGiBs
+        = 2.0 * memoryClockKHz * 1e3 * (memoryBusWidth / 8.0) / (1024.0 * 1024.0 * 1024.0);
+    printf("device %d: %d SMs, peak DRAM bandwidth ~%.0f GiB/s (roofline reference for the GiB/s column)\n", device,
+        ctx.smCount, peakBandwidthGiBs);
+
+    try
+    {
+        if (dtype == "half")
+        {
+            runBenchmarks<half>(ctx, config, kernels, nvinfer1::DataType::kHALF);
+        }
+        else if (dtype == "float")
+        {
+            runBenchmarks<float>(ctx, config, kernels, nvinfer1::DataType::kFLOAT);
+        }
+        else
+        {
+            TLLM_THROW("Unsupported --dtype: %s (expected float/half)", dtype.c_str());
+        }
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_ERROR(e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,334 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Trace-driven simulator for speculative decoding acceptance. Replays recorded
+// (context, generated-token) traces through the in-tree suffix automaton draft engine and the
+// greedy longest-prefix acceptance rule the verification kernels implement, reporting accepted
+// tokens per step and the estimated speedup for each draft length — so draft configurations can
+// be picked per workload offline instead of through full model runs.
+//
+// Model-based drafters (EAGLE/MTP) cannot be replayed from a token trace alone, since their
+// proposals depend on the draft model; for those the simulator evaluates chain and tree shapes
+// analytically over a sweep of per-token acceptance rates.
+//
+// Trace format: one JSON object per line, {"context": [...], "generated": [...]} with token ids.
+// Without --trace_file a synthetic repetitive workload is generated.
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/kernels/speculativeDecoding/suffixAutomaton/suffixAutomaton.h"
+
+#include "cxxopts.hpp"
+#include <nlohmann/json.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sa = tensorrt_llm::kernels::speculative_decoding::suffix_automaton;
+
+namespace
+{
+
+struct Trace
+{
+    std::vector<int32_t> context;
+    std::vector<int32_t> generated;
+};
+
+std::vector<Trace> loadTraces(std::string const& path)
+{
+    std::vector<Trace> traces;
+    std::ifstream file(path);
+    TLLM_CHECK_WITH_INFO(file.good(), "Unable to open trace file: %s", path.c_str());
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        auto const json = nlohmann::json::parse(line);
+        Trace trace;
+        trace.context = json.at("context").get<std::vector<int32_t>>();
+        trace.generated = json.at("generated").get<std::vector<int32_t>>();
+        traces.emplace_back(std::move(trace));
+    }
+    return traces;
+}
+
+//! Generates repetitive token streams (small vocab plus occasional copies of earlier spans), so
+//! the simulator can be smoke-tested without recorded traces.
+std::vector<Trace> makeSyntheticTraces(int numRequests, int contextLen, int generatedLen)
+{
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int32_t> tokenDist(0, 999);
+    std::uniform_real_distribution<float> coin(0.0f, 1.0f);
+    std::vector<Trace> traces(numRequests);
+    for (auto& trace : traces)
+    {
+        std::vector<int32_t> stream;
+        auto const totalLen = contextLen + generatedLen;
+        stream.reserve(totalLen);
+        while (static_cast<int>(stream.size()) < totalLen)
+        {
+            if (stream.size() > 64 && coin(rng) < 0.2f)
+            {
+                // Copy an earlier span, the pattern lookup-based drafters thrive on.
+                std::uniform_int_distribution<size_t> posDist(0, stream.size() - 33);
+                auto const pos = posDist(rng);
+                auto const spanLen = std::min<size_t>(32, totalLen - stream.size());
+                stream.insert(stream.end(), stream.begin() + pos, stream.begin() + pos + spanLen);
+            }
+            else
+            {
+                stream.push_back(tokenDist(rng));
+            }
+        }
+        trace.context.assign(stream.begin(), stream.begin() + contextLen);
+        trace.generated.assign(stream.begin() + contextLen, stream.begin() + totalLen);
+    }
+    return traces;
+}
+
+//! Owns the externally sized memory block a SuffixAutomaton slot lives in.
+class SuffixAutomatonSlot
+{
+public:
+    explicit SuffixAutomatonSlot(size_t maxSeqLen)
+        : mMemory{static_cast<uint8_t*>(::operator new(
+            sa::SuffixAutomaton::getRequiredMemorySize(maxSeqLen), std::align_val_t{64}))}
+        , mAutomaton{new (mMemory) sa::SuffixAutomaton()}
+    {
+        mAutomaton->init(mMemory, maxSeqLen);
+    }
+
+    ~SuffixAutomatonSlot()
+    {
+        ::operator delete(mMemory, std::align_val_t{64});
+    }
+
+    SuffixAutomatonSlot(SuffixAutomatonSlot const&) = delete;
+    SuffixAutomatonSlot& operator=(SuffixAutomatonSlot const&) = delete;
+
+    sa::SuffixAutomaton& get()
+    {
+        return *mAutomaton;
+    }
+
+private:
+    uint8_t* mMemory;
+    sa::SuffixAutomaton* mAutomaton;
+};
+
+struct ReplayResult
+{
+    size_t numSteps{0};
+    size_t numTokens{0};
+    size_t numDraftedTokens{0};
+    std::vector<size_t> acceptedHistogram; // index = accepted draft tokens in a step
+};
+
+//! Replays one trace with the suffix automaton drafter: each step drafts up to draftLen
+//! continuation tokens from the longest suffix match, the target accepts the longest prefix
+//! agreeing with the recorded generation (plus the one token the target emits regardless).
+ReplayResult replaySuffixAutomaton(Trace const& trace, int draftLen)
+{
+    ReplayResult result;
+    result.acceptedHistogram.assign(draftLen + 1, 0);
+
+    auto const maxSeqLen = trace.context.size() + trace.generated.size();
+    SuffixAutomatonSlot slot(maxSeqLen);
+    auto& automaton = slot.get();
+    for (auto const token : trace.context)
+    {
+        automaton.extend(sa::Token(token));
+    }
+
+    size_t position = 0;
+    while (position < trace.generated.size())
+    {
+        std::vector<int32_t> draft;
+        if (auto const lookup = automaton.lookup(); lookup.hasValue())
+        {
+            for (int j = 0; j < draftLen; ++j)
+            {
+                auto const index = +lookup.value().pos + j;
+                if (index >= +automaton.mTokens.size())
+                {
+                    break;
+                }
+                draft.push_back(+automaton.mTokens.at(sa::TextIndex(index)));
+            }
+        }
+        result.numDraftedTokens += draft.size();
+
+        // The target emits generated[position] in any case; drafts cover the following positions.
+        size_t accepted = 0;
+        while (accepted < draft.size() && position + 1 + accepted < trace.generated.size()
+            && draft[accepted] == trace.generated[position + 1 + accepted])
+        {
+            ++accepted;
+        }
+        result.acceptedHistogram[accepted] += 1;
+
+        auto const produced = accepted + 1;
+        for (size_t j = 0; j < produced; ++j)
+        {
+            automaton.extend(sa::Token(trace.generated[position + j]));
+        }
+        position += produced;
+        result.numTokens += produced;
+        result.numSteps += 1;
+    }
+    return result;
+}
+
+//! Expected tokens per step for a draft tree with per-level branching factors and independent
+//! per-token acceptance probability alpha; a chain of length d is the shape "1x1x...x1".
+double expectedTokensPerStep(std::vector<int> const& branching, double alpha)
+{
+    double tokensPerStep = 1.0;
+    double reachProbability = 1.0;
+    for (auto const numCandidates : branching)
+    {
+        reachProbability *= 1.0 - std::pow(1.0 - alpha, numCandidates);
+        tokensPerStep += reachProbability;
+    }
+    return tokensPerStep;
+}
+
+std::vector<int> parseTreeShape(std::string const& shape)
+{
+    std::vector<int> branching;
+    std::stringstream stream(shape);
+    std::string level;
+    while (std::getline(stream, level, 'x'))
+    {
+        branching.push_back(std::stoi(level));
+    }
+    TLLM_CHECK_WITH_INFO(!branching.empty(), "Invalid tree shape: %s", shape.c_str());
+    return branching;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options options(
+        "specDecodingSimulator", "Trace-driven acceptance simulator for speculative decoding configurations.");
+    options.add_options()("h,help", "Print usage");
+    options.add_options()("trace_file", "JSONL trace file; one {\"context\": [...], \"generated\": [...]} per line.",
+        cxxopts::value<std::string>()->default_value(""));
+    options.add_options()("num_requests", "Synthetic requests when no trace file is given.",
+        cxxopts::value<int>()->default_value("32"));
+    options.add_options()(
+        "context_len", "Synthetic context length.", cxxopts::value<int>()->default_value("1024"));
+    options.add_options()(
+        "generated_len", "Synthetic generation length.", cxxopts::value<int>()->default_value("1024"));
+    options.add_options()("draft_lens", "Suffix automaton draft lengths to sweep.",
+        cxxopts::value<std::vector<int>>()->default_value("1,2,4,8"));
+    options.add_options()("acceptance_rates", "Per-token acceptance rates for the analytic EAGLE/MTP sweep.",
+        cxxopts::value<std::vector<float>>()->default_value("0.6,0.7,0.8,0.9"));
+    options.add_options()("tree_shapes", "Draft tree shapes (per-level branching) for the analytic sweep.",
+        cxxopts::value<std::string>()->default_value("1x1x1,1x1x1x1x1,2x2x1,4x2x1"));
+    options.add_options()("draft_cost", "Relative per-draft-token step cost used in the speedup estimate.",
+        cxxopts::value<float>()->default_value("0.05"));
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        printf("%s\n", options.help().c_str());
+        return 0;
+    }
+
+    auto const traceFile = result["trace_file"].as<std::string>();
+    auto const draftLens = result["draft_lens"].as<std::vector<int>>();
+    auto const acceptanceRates = result["acceptance_rates"].as<std::vector<float>>();
+    auto const draftCost = result["draft_cost"].as<float>();
+
+    try
+    {
+        auto const traces = traceFile.empty()
+            ? makeSyntheticTraces(result["num_requests"].as<int>(), result["context_len"].as<int>(),
+                result["generated_len"].as<int>())
+            : loadTraces(traceFile);
+        TLLM_CHECK_WITH_INFO(!traces.empty(), "No traces to replay");
+        printf("replaying %zu traces (%s)\n\n", traces.size(), traceFile.empty() ? "synthetic" : traceFile.c_str());
+
+        printf("suffix automaton drafter (trace replay):\n");
+        for (auto const draftLen : draftLens)
+        {
+            ReplayResult total;
+            total.acceptedHistogram.assign(draftLen + 1, 0);
+            for (auto const& trace : traces)
+            {
+                auto const replay = replaySuffixAutomaton(trace, draftLen);
+                total.numSteps += replay.numSteps;
+                total.numTokens += replay.numTokens;
+                total.numDraftedTokens += replay.numDraftedTokens;
+                for (int i = 0; i <= draftLen; ++i)
+                {
+                    total.acceptedHistogram[i] += replay.acceptedHistogram[i];
+                }
+            }
+            auto const tokensPerStep = static_cast<double>(total.numTokens) / total.numSteps;
+            auto const draftedPerStep = static_cast<double>(total.numDraftedTokens) / total.numSteps;
+            auto const speedup = tokensPerStep / (1.0 + draftCost * draftedPerStep);
+            printf("  draft_len %2d: tokens/step %5.3f est speedup %5.3fx accepted-histogram [", draftLen,
+                tokensPerStep, speedup);
+            for (int i = 0; i <= draftLen; ++i)
+            {
+                printf("%s%.3f", i == 0 ? "" : " ",
+                    static_cast<double>(total.acceptedHistogram[i]) / total.numSteps);
+            }
+            printf("]\n");
+        }
+
+        printf("\nanalytic chain/tree drafter (EAGLE/MTP-style, acceptance-rate sweep):\n");
+        std::stringstream shapes(result["tree_shapes"].as<std::string>());
+        std::string shape;
+        while (std::getline(shapes, shape, ','))
+        {
+            auto const branching = parseTreeShape(shape);
+            int numDraftTokens = 0;
+            for (auto const numCandidates : branching)
+            {
+                numDraftTokens += numCandidates;
+            }
+            printf("  tree %-12s:", shape.c_str());
+            for (auto const alpha : acceptanceRates)
+            {
+                auto const tokensPerStep = expectedTokensPerStep(branching, alpha);
+                auto const speedup = tokensPerStep / (1.0 + draftCost * numDraftTokens);
+                printf(" alpha %.2f -> %5.3f tok/step (%5.3fx)", alpha, tokensPerStep, speedup);
+            }
+            printf("\n");
+        }
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_ERROR(e.what());
+        return 1;
+    }
+    return 0;
+}
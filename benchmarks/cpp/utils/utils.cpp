@@ -1,6 +1,6 @@
 
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION &
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION &
  *AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -20,6 +20,7 @@
 #include "utils.h"
 #include "tensorrt_llm/common/config.h"
 #include "tensorrt_llm/common/logger.h"
+#include <algorithm>
 #include <random>
 
 #include <filesystem>
@@ -91,12 +92,13 @@ Samples parseWorkloadJson(
         if (samples.size() >= maxNumSamples)
             break;
         int32_t taskId = sample.count("task_id") ? sample["task_id"].template get<int32_t>() : -1;
+        float timestampMs = sample.count("timestamp") ? sample["timestamp"].template get<float>() : -1.0F;
         auto input_ids(sample["input_ids"].template get<std::vector<int32_t>>());
         if (maxPromptLen && (input_ids.size() > maxPromptLen.value()))
         {
             input_ids.resize(maxPromptLen.value());
         }
-        samples.emplace_back(Sample{std::move(input_ids), sample["output_len"], taskId});
+        samples.emplace_back(Sample{std::move(input_ids), sample["output_len"], taskId, timestampMs});
     }
 
     if (samples.size() < maxNumSamples)
@@ -128,6 +130,55 @@ std::vector<double> generateRandomExponentialValues(int count, float lambda, int
     return randomValues;
 }
 
+std::vector<double> generateMmppDelays(int count, float meanRate, float burstiness, float burstFraction, int seed)
+{
+    TLLM_CHECK_WITH_INFO(burstiness > 1.0F, "burstiness must be greater than 1.0 for the bursty arrival process.");
+    TLLM_CHECK_WITH_INFO(
+        burstFraction > 0.0F && burstFraction < 1.0F, "burst_fraction must be strictly between 0.0 and 1.0.");
+
+    // Two-state Markov-modulated Poisson process: a burst state emitting at burstiness times the
+    // mean rate and a quiet state whose rate is chosen so the long-run average matches meanRate.
+    double const burstRate = static_cast<double>(meanRate) * burstiness;
+    double quietRate = meanRate * (1.0 - static_cast<double>(burstFraction) * burstiness) / (1.0 - burstFraction);
+    // With a high duty cycle the quiet state would need a negative rate to keep the average; clamp
+    // to a trickle instead.
+    quietRate = std::max(quietRate, 0.01 * meanRate);
+
+    // Mean state-cycle long enough to span many arrivals, so bursts are visible at the scheduler.
+    auto constexpr kCycleArrivals = 64.0;
+    double const meanCycle = kCycleArrivals / meanRate;
+    std::mt19937 gen(seed);
+    std::exponential_distribution<double> burstSojourn(1.0 / (meanCycle * burstFraction));
+    std::exponential_distribution<double> quietSojourn(1.0 / (meanCycle * (1.0 - burstFraction)));
+
+    std::vector<double> delays;
+    delays.reserve(count);
+    bool inBurst = true;
+    double stateRemaining = burstSojourn(gen);
+    while (static_cast<int>(delays.size()) < count)
+    {
+        double delay = 0.0;
+        while (true)
+        {
+            std::exponential_distribution<double> interArrival(inBurst ? burstRate : quietRate);
+            auto const wait = interArrival(gen);
+            if (wait <= stateRemaining)
+            {
+                stateRemaining -= wait;
+                delay += wait;
+                break;
+            }
+            // No arrival before the state switch; restart the wait in the new state (exponentials
+            // are memoryless, so this preserves the per-state rates).
+            delay += stateRemaining;
+            inBurst = !inBurst;
+            stateRemaining = inBurst ? burstSojourn(gen) : quietSojourn(gen);
+        }
+        delays.push_back(delay);
+    }
+    return delays;
+}
+
 std::vector<double> computeTimeDelays(BenchmarkParams const& benchmarkParams, int numDelays)
 {
     std::vector<double> timeDelays;
@@ -151,6 +202,45 @@ std::vector<double> computeTimeDelays(BenchmarkParams const& benchmarkParams, in
     return timeDelays;
 }
 
+std::vector<double> computeArrivalDelays(BenchmarkParams const& benchmarkParams, Samples const& samples)
+{
+    auto const numDelays = static_cast<int>(samples.size()) - 1;
+    auto const& process = benchmarkParams.arrivalProcess;
+
+    if (process == "constant")
+    {
+        return computeTimeDelays(benchmarkParams, numDelays);
+    }
+    if (process == "trace")
+    {
+        std::vector<double> delays;
+        delays.reserve(numDelays);
+        for (int i = 0; i < numDelays; ++i)
+        {
+            TLLM_CHECK_WITH_INFO(samples[i].timestampMs >= 0.0F && samples[i + 1].timestampMs >= 0.0F,
+                "The trace arrival process requires a 'timestamp' field (milliseconds) on every dataset sample.");
+            TLLM_CHECK_WITH_INFO(samples[i + 1].timestampMs >= samples[i].timestampMs,
+                "Dataset timestamps must be non-decreasing for trace replay.");
+            delays.push_back((samples[i + 1].timestampMs - samples[i].timestampMs) / 1000.0);
+        }
+        return delays;
+    }
+
+    TLLM_CHECK_WITH_INFO(benchmarkParams.requestRate.has_value() && benchmarkParams.requestRate.value() > 0.0F,
+        "The %s arrival process requires a positive request_rate.", process.c_str());
+    if (process == "poisson")
+    {
+        return generateRandomExponentialValues(
+            numDelays, benchmarkParams.requestRate.value(), benchmarkParams.randomSeed);
+    }
+    if (process == "bursty")
+    {
+        return generateMmppDelays(numDelays, benchmarkParams.requestRate.value(), benchmarkParams.burstiness,
+            benchmarkParams.burstFraction, benchmarkParams.randomSeed);
+    }
+    TLLM_THROW("Unexpected arrival process: %s", process.c_str());
+}
+
 std::ostream& operator<<(std::ostream& os, RecordTimeMetric const& metric)
 {
     os << metric.mAvg << "," << metric.mMax << "," << metric.mMin << "," << metric.mP99 << "," << metric.mP90 << ","
@@ -1,6 +1,6 @@
 
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -95,6 +95,18 @@ struct BenchmarkParams
 
     bool enableCollectkvCacheTransferTime = false;
     bool enableCollectIterStats = false;
+
+    // Sustained-load params. arrivalProcess selects how inter-arrival delays are generated:
+    // "constant" (default, request_rate / enable_exp_delays behavior), "poisson", "bursty"
+    // (two-state MMPP) or "trace" (replay dataset timestamps).
+    std::string arrivalProcess{"constant"};
+    float burstiness{4.0F};
+    float burstFraction{0.2F};
+    // Requests enqueued during the first steadyStateDelay seconds are excluded from metrics.
+    float steadyStateDelay{0.0F};
+    // SLO thresholds for attainment reporting (streaming mode only).
+    std::optional<float> ttftSlo{std::nullopt};
+    std::optional<float> tpotSlo{std::nullopt};
 };
 
 struct RecordTimeMetric
@@ -228,6 +240,9 @@ struct Sample
     std::vector<int32_t> inputIds;
     int32_t outputLen;
     int32_t taskId;
+    // Arrival timestamp in milliseconds from the start of the trace; negative when the dataset
+    // carries no timestamps. Only used by the "trace" arrival process.
+    float timestampMs{-1.0F};
 };
 
 using Samples = std::vector<Sample>;
@@ -237,8 +252,14 @@ Samples parseWorkloadJson(
 
 std::vector<double> generateRandomExponentialValues(int count, float lambda, int seed);
 
+std::vector<double> generateMmppDelays(int count, float meanRate, float burstiness, float burstFraction, int seed);
+
 std::vector<double> computeTimeDelays(BenchmarkParams const& benchmarkParams, int numDelays);
 
+/// @brief Inter-arrival delays in seconds for the configured arrival process. Falls back to
+/// computeTimeDelays for the default "constant" process; "trace" requires timestamps in the dataset.
+std::vector<double> computeArrivalDelays(BenchmarkParams const& benchmarkParams, Samples const& samples);
+
 } // namespace benchmark
 
 TRTLLM_NAMESPACE_END
@@ -117,6 +117,19 @@ struct BlockKey
     //! \return A new BlockKey whose uniqueTokens contains only the first newNumTokens entries. All other fields are
     //! copied unchanged.
     struct BlockKey shorten(int newNumTokens) const;
+
+    //! \brief Invalidate the memoized hash after mutating any key field in place.
+    //! \details BlockKeyHasher memoizes the parentHash == 0 hash inside the key so that the radix-tree walk and
+    //! repeated map probes hash each token chunk only once per admission. Any code that assigns to uniqueTokens,
+    //! extraKeys, etc. on an already-hashed key must call this, otherwise lookups will use a stale hash.
+    void invalidateHashMemo() const noexcept
+    {
+        hashMemoValid = false;
+    }
+
+    // Memoized result of BlockKeyHasher::hash(*this, 0). Excluded from operator==; maintained by BlockKeyHasher.
+    mutable std::size_t hashMemo = 0;
+    mutable bool hashMemoValid = false;
 };
 
 //! \brief Build a BlockKey for every block for the input sequence.
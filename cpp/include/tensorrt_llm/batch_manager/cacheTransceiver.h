@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <pybind11/pybind11.h>
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/custom_class.h>
@@ -272,6 +273,10 @@ public:
 private:
     void initializeCommState();
 
+    /// Pre-establish transfer sessions to the peers listed in TRTLLM_KVCACHE_PREWARM_PEERS on a
+    /// background thread, so the first request to each peer does not pay connection setup in TTFT.
+    void prewarmConnections();
+
     void setContextState(LlmRequest* llmRequest);
 
     std::unique_ptr<CacheSender> mCacheSender;
@@ -294,6 +299,8 @@ private:
     // TODO(shreyasm): update this to use same container as kv by using base trans buffers instead
     std::unique_ptr<rnn_state_manager::RnnCacheTransBufferManager> mRnnCacheTransBufferManager{nullptr};
 
+    std::thread mPrewarmThread;
+
     // library handle to the communicator related features,
     // this is used to defer dependency resolution until needed.
     static std::mutex mDllMutex;
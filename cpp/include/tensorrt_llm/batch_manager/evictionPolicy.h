@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
+#include "tensorrt_llm/batch_manager/shardedFreeBlockList.h"
 
 #include <chrono>
 #include <vector>
@@ -97,6 +98,13 @@ public:
 
     bool verifyQueueIntegrity() override;
 
+    /// @brief Enable or disable scan-resistant ordering (see TRTLLM_KVCACHE_SCAN_RESISTANT_EVICTION).
+    /// @details Initialized from the environment in initialize(); exposed for tests.
+    void setScanResistantEviction(bool enabled)
+    {
+        mScanResistantEviction = enabled;
+    }
+
 private:
     /// @brief A fixed-size container supporting both non-negative and negative indexing.
     ///        Non-negative IDs index directly into positive.
@@ -124,6 +132,14 @@ private:
     executor::RetentionPriority mSecondaryOffloadMinPriority;
     // Heap of block expiration times
     std::set<BlockPtr, ExpiringBlockComparator> mExpiringBlockHeap;
+    // Fast path for stateless primary blocks (no cached tokens, default priority, no expiration). Such blocks
+    // have no meaningful LRU order, so allocate/free can bypass the shared queues and spread over per-thread
+    // shards instead of contending on one structure at high batch counts. Blocks held here are counted in
+    // mNumFreeBlocksPerLevel[0] but have no entry in mFreeBlockIterators.
+    ShardedFreeBlockList<BlockPtr> mStatelessPrimaryShards;
+    // Scan resistance (LRU-K flavored): queue never-reused cached content ahead of proven-hot blocks of the
+    // same priority, so one tenant's single-pass scans evict before another tenant's re-hit prompt blocks.
+    bool mScanResistantEviction{false};
 };
 
 } // namespace tensorrt_llm::batch_manager::eviction_policy
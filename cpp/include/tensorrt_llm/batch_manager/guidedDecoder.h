@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2024-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,11 @@
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
 namespace xgrammar
 {
 class GrammarMatcher;
@@ -44,6 +49,18 @@ public:
     void execute(DecoderInputBuffers const& decoderInputBuffers, runtime::BufferManager const& runtimeBufferManager);
 
 private:
+    //! @brief Advance the grammar matcher of a request and fill its bitmask row on host.
+    //! @details Requests own disjoint matchers and bitmask rows, so this may run on worker threads
+    //!          for different requests concurrently.
+    void buildBitmask(LlmRequest& llmReq);
+
+    //! @brief Compile the guides listed in the pre-warm file (JSONL of guide type and guide),
+    //!        populating the grammar compiler cache before traffic arrives.
+    void prewarmFromFile(std::string const& filePath);
+
+    //! @brief Append a guide not yet present in the pre-warm file, so other replicas can pre-warm from it.
+    void recordPrewarmGuide(executor::GuidedDecodingParams::GuideType guideType, std::optional<std::string> const& guide);
+
     executor::GuidedDecodingConfig::GuidedDecodingBackend mGuidedDecodingBackend;
     std::vector<std::shared_ptr<xgrammar::GrammarMatcher>> mXGrammarMatchers;
     std::shared_ptr<xgrammar::GrammarCompiler> mXGrammarCompiler;
@@ -53,15 +70,20 @@ private:
     SizeType32 mBitmaskSize; // CeilDiv(vocabSizePadded, 32)
     nvinfer1::DataType mLogitsDtype;
 
-    TensorPtr mLogitsBitmask;           // [mMaxNumRequests, mBitmaskSize]
-    TensorPtr mLogitsBitmaskHost;       // [mMaxNumRequests, mBitmaskSize]
-    TensorPtr mLogitsBitmaskPtrVec;     // [mMaxNumRequests], pointers to the logitsBitmask in a batch
-    TensorPtr mLogitsBitmaskPtrVecHost; // [mMaxNumRequests]
-    TensorPtr mLogitsPtrVec;            // [mMaxNumRequests], pointers to the logits in a batch
-    TensorPtr mLogitsPtrVecHost;        // [mMaxNumRequests]
+    TensorPtr mLogitsBitmask;     // [mMaxNumRequests, mBitmaskSize]
+    TensorPtr mLogitsBitmaskHost; // [mMaxNumRequests, mBitmaskSize]
+    // Pointer table for the bitmask kernel; row 0 holds the logits pointers and row 1 the bitmask
+    // pointers of the batch, so a single H2D copy refreshes both.
+    TensorPtr mPtrTable;     // [2, mMaxNumRequests]
+    TensorPtr mPtrTableHost; // [2, mMaxNumRequests]
 
     // BufferManager with a dedicated stream for async copy of buffers for guided decoding.
     runtime::BufferManager mCopyBufferManager;
+
+    // Shared pre-warm artifact for grammar compilation (TRTLLM_GUIDED_DECODING_PREWARM_FILE).
+    std::string mPrewarmFilePath;
+    std::unordered_set<size_t> mSeenGuideHashes;
+    std::mutex mPrewarmMutex;
 };
 
 } // namespace tensorrt_llm::batch_manager
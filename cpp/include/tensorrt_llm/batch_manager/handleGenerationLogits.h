@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -44,10 +44,14 @@ public:
 
     HandleGenerationLogits() = default;
 
+    //! @param copyManager When provided, device-to-host logits copies are issued on this manager's stream
+    //! instead of the compute stream so they can overlap subsequent compute. The caller is responsible for
+    //! fencing the copy stream against logits production and reuse.
     void operator()(DecoderInputBuffers& inputBuffers, RequestVector const& generationRequests,
         runtime::ITensor::SharedPtr const& logits, runtime::SizeType32 logitsIndex,
         runtime::ModelConfig const& modelConfig, runtime::BufferManager const& manager,
-        OptionalRef<RuntimeBuffers> genRuntimeBuffers, OptionalRef<MedusaBuffers> medusaBuffers) const;
+        OptionalRef<RuntimeBuffers> genRuntimeBuffers, OptionalRef<MedusaBuffers> medusaBuffers,
+        OptionalRef<runtime::BufferManager const> copyManager = std::nullopt) const;
 };
 
 } // namespace tensorrt_llm::batch_manager
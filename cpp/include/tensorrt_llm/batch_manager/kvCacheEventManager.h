@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,11 @@
 
 #include "tensorrt_llm/executor/executor.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <mutex>
 #include <thread>
@@ -73,6 +75,9 @@ private:
 
     void flushRemovedEvents(SizeType32 windowSize);
 
+    // Pop the oldest pending batch from the ring into `batch`. Returns false if the ring is empty.
+    bool popPendingBatch(std::deque<executor::KVCacheEvent>& batch);
+
     /// @brief Flag to terminate the worker
     std::atomic<bool> mRun;
     /// @brief Worker thread
@@ -87,10 +92,21 @@ private:
     /// @brief Condition variable for blocking read
     std::condition_variable mEmptyCV;
 
-    /// @brief List of buffers waiting awaiting insertion into mEvents. Consumed by the worker.
-    std::deque<std::deque<executor::KVCacheEvent>> mPendingEvents;
-    /// @brief Lock for mPendingEvents
-    std::mutex mPendingEventsMutex;
+    /// @brief Capacity of the pending-batch ring. Must be a power of two.
+    static constexpr size_t kPendingRingSize = 256;
+
+    /// @brief Lock-free single-producer/single-consumer ring of event batches awaiting insertion into mEvents,
+    /// handed from the forward pass thread to the worker. When the ring is full, the oldest batch is dropped so
+    /// producing events never blocks on the consumer.
+    std::array<std::deque<executor::KVCacheEvent>, kPendingRingSize> mPendingRing;
+    /// @brief Next slot the producer writes. Only advanced by flush().
+    std::atomic<uint64_t> mPendingHead{0};
+    /// @brief Next slot the consumer reads. Advanced by the worker, or by flush() when dropping the oldest batch.
+    std::atomic<uint64_t> mPendingTail{0};
+    /// @brief Total number of events discarded by the drop-oldest overflow policy.
+    std::atomic<uint64_t> mNumDroppedEvents{0};
+    /// @brief Mutex paired with mPendingEmptyCV. Only the worker sleeps on it; flush() never takes it.
+    std::mutex mPendingWakeMutex;
     /// @brief Condition variable to notify worker thread
     std::condition_variable mPendingEmptyCV;
 
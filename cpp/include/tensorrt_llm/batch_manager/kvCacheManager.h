@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <limits>
 #include <list>
@@ -434,6 +435,12 @@ public:
 
     size_t getHash() const;
 
+    //! \brief Record that this block's cached content was matched and reused by a request.
+    void markReused();
+
+    //! \brief Number of times the current content was reused. Reset when the block is repurposed.
+    [[nodiscard]] SizeType32 getReuseCount() const;
+
     std::vector<MmKey> getExtraKeys() const;
 
 private:
@@ -484,6 +491,9 @@ private:
     std::optional<std::chrono::steady_clock::time_point::duration> mExpirationTime;
     // Hash for the event manager
     size_t mHash;
+    // Times the current content was reused since the block was last (re)written.
+    // Consulted by scan-resistant eviction ordering.
+    SizeType32 mReuseCount;
 };
 
 class GenerationRequest
@@ -567,6 +577,16 @@ public:
         return *(mCacheBlockIndices.at(windowSize));
     }
 
+    [[nodiscard]] std::uint64_t getBlockOffsetsVersion() const
+    {
+        return mBlockOffsetsVersion;
+    }
+
+    void bumpBlockOffsetsVersion()
+    {
+        ++mBlockOffsetsVersion;
+    }
+
     void addCacheBlock(SizeType32 windowSize, SizeType32 beamIdx, KVCacheBlock::IdType blockId)
     {
         mCacheBlockIds.at(windowSize).at(beamIdx).push_back(blockId);
@@ -645,6 +665,8 @@ private:
     std::unordered_map<SizeType32, std::vector<std::vector<KVCacheBlock::IdType>>> mCacheBlockIds;
     // Tensor of block indices allocated per each window size, for each beam of the sequence
     std::unordered_map<SizeType32, runtime::ITensor::SharedPtr> mCacheBlockIndices;
+    // Bumped whenever mCacheBlockIndices content changes; lets consumers skip re-uploading unchanged block tables
+    std::uint64_t mBlockOffsetsVersion{0};
     // The retention priority to assign to decode blocks
     executor::KvCacheRetentionConfig mKvCacheRetentionConfig;
     // Number of front blocks removed from the sequence
@@ -864,6 +886,8 @@ public:
     //! the placeholder block). It should be called after every context chunk is processed.
     void copyLinearAttentionBlock(GenerationRequest& sequence, LlmRequest const& llmRequest);
 
+    //! \brief Split a block shared among beams into per-beam copies (copy-on-write divergence).
+    //! \details Each beam gets a fresh block populated with the shared block's content; the shared block is released.
     void replaceSharedBlock(GenerationRequest& sequence, SizeType32 blockIdx);
 
     [[nodiscard]] std::vector<KVCacheBlock::IdType> storeBlocksForReuse(
@@ -891,6 +915,19 @@ public:
     //! \brief Detach front block from the sequence
     void detachFrontBlock(GenerationRequest& sequence);
 
+    //! \brief Reuse the out-of-window front block in place as the sequence's new last block
+    //! \details Ring-buffer mode for SWA: instead of detaching the out-of-window
+    //! block and allocating a fresh one, the physical block is re-appended to the
+    //! sequence so new tokens overwrite the stale ones. Attention-sink blocks stay
+    //! pinned at the front and are never recycled.
+    void recycleFrontBlock(GenerationRequest& sequence);
+
+    //! \brief Set the number of leading blocks holding attention-sink tokens
+    void setNumSinkBlocks(SizeType32 numSinkBlocks)
+    {
+        mNumSinkBlocks = numSinkBlocks;
+    }
+
     //! \brief Add/detach block(s) to/from the sequence if needed
     //! \details When we need a new block, we add it. For sliding window
     //! attention (SWA), when a block goes out-of-window (OOW), we detach it
@@ -936,6 +973,13 @@ public:
         return mMissedBlocks;
     }
 
+    //! \brief Average reuse hit depth: mean number of leading context blocks served from cache per reuse lookup.
+    [[nodiscard]] float getAvgReuseHitDepth() const noexcept
+    {
+        return mReuseLookupCount == 0 ? 0.F
+                                      : static_cast<float>(mReuseHitDepthSum) / static_cast<float>(mReuseLookupCount);
+    }
+
     // Get num free blocks in the secondary (host) memory pool
     [[nodiscard]] SizeType32 getNumFreeSecondaryBlocks() const noexcept;
 
@@ -1067,6 +1111,11 @@ public:
     //! \brief Perform per-request bookkeeping
     void refreshBlocks();
 
+    //! \brief Budgeted background compaction pass: offload up to \p maxBlocks cold free primary blocks to
+    //! secondary memory so admission-time allocation finds stateless primary blocks without inline copies.
+    //! \details Runs from refreshBlocks when TRTLLM_KVCACHE_COMPACTION_BLOCKS_PER_ITER is set.
+    void compactPrimaryFreeBlocks(SizeType32 maxBlocks);
+
     [[nodiscard]] static bool blockInRadixTree(BlockPtr const& block);
 
     //! \brief Store blocks in cached blocks.
@@ -1241,6 +1290,13 @@ private:
     SizeType32 mTokensPerBlock;
     // Whether this window is sliding window attention/full attention
     bool mIsSWA;
+    // Whether out-of-window blocks are recycled in place (ring-buffer mode) instead of detached
+    bool mRingBufferMode;
+    // Per-layer-group offload policy: sliding-window groups free detached out-of-window blocks eagerly
+    // (front of the free queue, no secondary offload) since their layers never attend to those positions
+    bool mEagerFreeOutOfWindow;
+    // Number of leading blocks holding attention-sink tokens; pinned in ring-buffer mode
+    SizeType32 mNumSinkBlocks{0};
     // List of all blocks by idx
     std::vector<BlockPtr> mAllBlocksById;
     // Pre-allocated placeholder blocks for linear attention (recurrent state) managers.
@@ -1279,6 +1335,10 @@ private:
     SizeType32 mReusedUniqueBlocks;
     // Number of blocks that were not reused (context phase)
     SizeType32 mMissedBlocks;
+    // Number of reuse lookups performed (context phase)
+    SizeType32 mReuseLookupCount;
+    // Sum over lookups of the number of leading context blocks served from cache (hit depth)
+    SizeType32 mReuseHitDepthSum;
     // Number of blocks allocated during generation phase
     SizeType32 mGenAllocBlocks;
     // Only be 1 or 2. If 2: general KV stored. If 1: K == V for any token, so only K is stored to optimize the
@@ -1399,6 +1459,7 @@ public:
     //! the placeholder block). It should be called after every context chunk is processed.
     void copyLinearAttentionBlock(GenerationRequest& sequence, LlmRequest const& llmRequest);
 
+    //! \brief Split a block shared among beams into per-beam copies (copy-on-write divergence).
     void replaceSharedBlock(GenerationRequest& sequence, SizeType32 windowSize, SizeType32 blockIdx);
 
     std::optional<KVCacheBlock::IdType> releaseBlocks(
@@ -1717,6 +1778,15 @@ public:
     //! context block that goes OOW.
     void adjustBlocksIfNeeded(GenerationRequest& sequence);
 
+    //! \brief Set the number of leading attention-sink blocks for all window managers
+    void setNumSinkBlocks(SizeType32 numSinkBlocks)
+    {
+        for (auto& [_, manager] : mWindowBlockManagers)
+        {
+            manager.setNumSinkBlocks(numSinkBlocks);
+        }
+    }
+
     //! \brief Return whether the sequence is already managed by the block manager
     [[nodiscard]] bool isSequenceHeld(LlmRequest::RequestIdType requestId) const
     {
@@ -2473,6 +2543,22 @@ public:
         SizeType32 sinkTokenLength, SizeType32 blockCapacity, SizeType32 beamWidth, SizeType32 tokensPerBlock);
 
 private:
+    /// @brief Block budget reserved for a multi-turn session, refreshed by every turn that carries the
+    /// session id in its retention config.
+    struct SessionReservation
+    {
+        // Number of leading prefix blocks to keep pinned for the session.
+        SizeType32 reservedBlocks;
+        // When the reservation lapses if no continuation turn arrives. nullopt keeps it indefinitely.
+        std::optional<std::chrono::steady_clock::time_point> expirationTime;
+    };
+
+    /// @brief Registers or refreshes the session reservation carried by a retention config, and derives the
+    /// effective per-request retention from it: the reserved prefix blocks are pinned at the maximum
+    /// retention priority until the session TTL elapses, so continuation turns find them still cached.
+    /// Configs without a session id (or with explicit token ranges, which take precedence) pass through
+    /// unchanged. Called from the execution loop thread only.
+    [[nodiscard]] executor::KvCacheRetentionConfig applySessionReservation(executor::KvCacheRetentionConfig config);
     // Maximum number of sequences
     SizeType32 mMaxNumSequences;
     // Maximum beam width
@@ -2490,6 +2576,8 @@ private:
     BlockManager mBlockManager;
     // Map of all sequences
     std::unordered_map<LlmRequest::RequestIdType, GenerationRequest> mSequences;
+    // Active session reservations, keyed by session id. Expired entries are pruned lazily.
+    std::unordered_map<executor::IdType, SessionReservation> mSessionReservations;
     // Whether to cache KV pages for reuse
     bool mEnableBlockReuse;
     // Mutex to protect access to mSequences
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,9 +16,19 @@
 
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
 #include "tensorrt_llm/executor/types.h"
+#include "tensorrt_llm/kernels/kvCachePartialCopy.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/cudaEvent.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 namespace tr = tensorrt_llm::runtime;
 namespace kvc = tensorrt_llm::executor::kv_cache;
 
@@ -50,6 +60,8 @@ public:
     explicit KVCacheTransferManager(
         tr::BufferManager const& bufferManager, std::shared_ptr<kvc::BaseLoopbackAgent> loopbackAgent = nullptr);
 
+    ~KVCacheTransferManager();
+
     //! \brief Onboard a block to gpu memory.
     void onboard(BlockPtr const& offloadBlock, BlockPtr const& block, std::vector<KVCacheBlockPool> const& pools,
         int numTokensToCopy = 0, executor::KvCacheTransferMode mode = executor::KvCacheTransferMode::DRAM,
@@ -102,6 +114,41 @@ private:
     [[nodiscard]] std::size_t computeBlockTransferBytes(
         std::vector<KVCacheBlockPool> const& pools, int numTokensToCopy) const;
 
+    //! \brief Issue all staged offload writeback copies as one batched launch and record their events.
+    void flushOffloadWritebacks();
+
+    //! \brief Flush the staged writebacks if either block's raw memory is part of the batch.
+    //! \details Must be called before the event bookkeeping of a new transfer touching the blocks, so
+    //! the pending read/write events it waits on exist.
+    void flushWritebacksTouching(BlockPtr const& blockA, BlockPtr const& blockB);
+
+    //! \brief Spill a block tensor to a file (POSIX fallback).
+    //! \details Stages the data with an async D2H copy on the offload stream and hands the file write to the
+    //! background writer thread, so the calling thread never blocks on disk I/O.
+    void gpuToFilePosix(tr::ITensor::SharedPtr const& srcPtr, std::string const& filename);
+
+    //! \brief Promote a block tensor from a file to GPU memory (POSIX fallback).
+    //! \details Reads into a pinned staging buffer and issues an async H2D copy on the onboard stream, so the
+    //! upload overlaps with compute instead of synchronizing the device.
+    void fileToGpuPosix(tr::ITensor::SharedPtr const& dstPtr, std::string const& filename);
+
+    //! \brief Block until no file write for filename is pending in the background writer.
+    void waitForPendingFileWrite(std::string const& filename);
+
+    //! \brief Enqueue a file write job, starting the writer thread on first use.
+    void enqueueFileWrite(std::string filename, tr::ITensor::SharedPtr staging, tr::CudaEvent event);
+
+    //! \brief Background thread loop that waits for staging copies and writes them to disk.
+    void fileWriterLoop();
+
+    //! \brief A spilled block staged in pinned memory, waiting for its D2H copy before being written to disk.
+    struct PendingFileWrite
+    {
+        std::string filename;
+        tr::ITensor::SharedPtr staging;
+        tr::CudaEvent event;
+    };
+
     runtime::BufferManager mBufferManager;
     runtime::BufferManager mOnboardManager;
     runtime::BufferManager mOffloadManager;
@@ -123,6 +170,30 @@ private:
     std::size_t mOffloadByteCount{0};
     SizeType32 mIntraDeviceCopyBlockCount{0};
     std::size_t mIntraDeviceCopyByteCount{0};
+
+    // Background writer for file-backed offload. Jobs are written in FIFO order; protected by mFileWriterMutex.
+    std::deque<PendingFileWrite> mPendingFileWrites;
+    std::mutex mFileWriterMutex;
+    std::condition_variable mFileWriterCv;
+    std::thread mFileWriterThread;
+    bool mFileWriterShutdown{false};
+
+    // Reusable pinned staging buffer for file onboarding, grown on demand.
+    // mOnboardStagingEvent guards against overwriting the buffer while a previous H2D copy is in flight.
+    tr::ITensor::SharedPtr mOnboardStaging;
+    std::optional<tr::CudaEvent> mOnboardStagingEvent;
+
+    // Deferred offload writeback batching, enabled by TRTLLM_KVCACHE_OFFLOAD_WRITEBACK_BATCH_BYTES
+    // (0 keeps the immediate per-block copies). Full-block DRAM offload copies are staged here and
+    // issued as one descriptor-table launch once mWritebackBatchBytes accumulate — at the latest when
+    // syncTransfers() ends the step, or when a new transfer touches a staged block. Cold-block
+    // eviction then produces few large PCIe transfers instead of one small copy per evicted block.
+    std::size_t mWritebackBatchBytes;
+    std::size_t mPendingWritebackBytes{0};
+    std::vector<kernels::KVCacheCopyDesc> mPendingWritebackDescs;
+    std::vector<std::pair<kernels::KVCacheIndex::UnderlyingType, kernels::KVCacheIndex::UnderlyingType>>
+        mPendingWritebackBlocks;
+    std::unordered_set<kernels::KVCacheIndex::UnderlyingType> mPendingWritebackBlockIdxs;
 };
 
 } // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -162,6 +162,22 @@ public:
         return blockHashesPerWindow;
     }
 
+    //! \brief Whether the cache allocates FP4 block scale pools alongside the data pools.
+    [[nodiscard]] bool hasBlockScalePools() const
+    {
+        return !mBlockScalePoolsPerWindow.empty();
+    }
+
+    //! \brief Range over the block scale tensors of the same blocks as getBlockRangeForWindow.
+    BlockRangeForWindow getBlockScaleRangeForWindow(SizeType32 windowSize) const
+    {
+        TLLM_CHECK_WITH_INFO(mBlockScalePoolsPerWindow.find(windowSize) != mBlockScalePoolsPerWindow.end(),
+            "No block scale pool for window size %d", windowSize);
+        auto pool = mBlockScalePoolsPerWindow.at(windowSize).front();
+        auto blockIds = mBlockIdsPerWindow.at(windowSize);
+        return BlockRangeForWindow(mManager, windowSize, std::move(blockIds), std::move(pool));
+    }
+
     BlockRangeForWindow getBlockRangeForWindow(SizeType32 windowSize, bool useIndexerKCache = false) const
     {
         TLLM_CHECK_WITH_INFO(
@@ -212,6 +228,7 @@ private:
         {
             mIndexerKCachePool = cacheManager.getIndexerKCachePool();
         }
+        collectBlockScalePools(cacheManager);
     }
 
     BlockRange(BaseKVCacheManager const& cacheManager, LlmRequest::RequestIdType requestId)
@@ -231,6 +248,21 @@ private:
         {
             mIndexerKCachePool = cacheManager.getIndexerKCachePool();
         }
+        collectBlockScalePools(cacheManager);
+    }
+
+    void collectBlockScalePools(BaseKVCacheManager const& cacheManager)
+    {
+        auto const& blockManager = cacheManager.getBlockManager();
+        auto const numPools = blockManager.getNumPools();
+        for (SizeType32 poolIdx = 0; poolIdx < numPools; ++poolIdx)
+        {
+            if (blockManager.containsBlockScales(poolIdx))
+            {
+                auto windowSize = blockManager.getPoolWindowSize(poolIdx);
+                mBlockScalePoolsPerWindow[windowSize].push_back(blockManager.getPrimaryPool(poolIdx));
+            }
+        }
     }
 
 private:
@@ -238,6 +270,7 @@ private:
     LlmRequest::RequestIdType const mRequestId;
     std::unordered_map<SizeType32, std::vector<SizeType32>> mBlockIdsPerWindow;
     std::unordered_map<SizeType32, std::vector<runtime::ITensor::SharedPtr>> mPoolsPerWindow;
+    std::unordered_map<SizeType32, std::vector<runtime::ITensor::SharedPtr>> mBlockScalePoolsPerWindow;
     runtime::ITensor::SharedPtr mIndexerKCachePool;
 
     static constexpr SizeType32 kFIRST_AND_ONLY_BEAM = 0;
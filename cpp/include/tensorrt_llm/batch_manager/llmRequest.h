@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -311,6 +311,8 @@ public:
         , mContextPhaseParams(req.getContextPhaseParams())
         , mEagleConfig(req.getEagleConfig())
         , mReturnPerfMetrics(req.getOutputConfig().returnPerfMetrics)
+        , mNumTopLogprobs(req.getOutputConfig().numTopLogprobs)
+        , mReturnPromptLogprobs(req.getOutputConfig().returnPromptLogprobs)
         , mGuidedDecodingParams(req.getGuidedDecodingParams())
         , mLanguageAdapterUid(req.getLanguageAdapterUid())
         , mAllottedTimeMs(req.getAllottedTimeMs())
@@ -749,6 +751,28 @@ public:
         }
     }
 
+    /// @brief Rewind the request to an earlier position by dropping the last numTokens generated tokens, e.g. to
+    /// backtrack after a tool call without cancelling and re-prefilling the request. Only the token bookkeeping of
+    /// the request is rewound; the caller must rewind the KV cache alongside via BaseKVCacheManager::rewindKVCache
+    /// and, when the C++ decoder is used, shrink the sequence lengths via decoder::DecoderState::setSequenceLengths.
+    /// @param numTokens The number of generated tokens to drop; must not reach into the prompt.
+    void rewindTokens(SizeType32 numTokens)
+    {
+        TLLM_CHECK_WITH_INFO(0 <= numTokens && numTokens <= getMaxNumGeneratedTokens(),
+            "Cannot rewind %d tokens, request %lu has only %d generated tokens.", numTokens, mRequestId,
+            getMaxNumGeneratedTokens());
+        TLLM_LOG_DEBUG("Rewinding %d tokens for request %ld", numTokens, mRequestId);
+        for (std::size_t beam = 0; beam < mTokens.size(); ++beam)
+        {
+            auto& beamTokens = mTokens.at(beam);
+            auto const newSize = std::max<std::ptrdiff_t>(
+                mPromptLen, static_cast<std::ptrdiff_t>(beamTokens.size()) - numTokens);
+            beamTokens.resize(newSize);
+            mUniqueTokens.at(beam).resize(newSize);
+            mLastTokens.at(beam) = beamTokens.back();
+        }
+    }
+
     /// @brief Sets the generated tokens for all beams after gatherTree. Erases all previous generated tokens.
     /// @param generatedBeamTokens The generated tokens for all beams (vector of vector of tokens)
     void setGeneratedTokens(BeamTokens const& generatedBeamTokens)
@@ -1414,6 +1438,48 @@ public:
         }
     }
 
+    [[nodiscard]] SizeType32 getNumTopLogprobs() const
+    {
+        return mNumTopLogprobs;
+    }
+
+    [[nodiscard]] TensorPtr const& getTopLogprobsValsHost() const
+    {
+        return mTopLogprobsValsHost;
+    }
+
+    [[nodiscard]] TensorPtr const& getTopLogprobsIdsHost() const
+    {
+        return mTopLogprobsIdsHost;
+    }
+
+    void allocTopLogprobsHost()
+    {
+        mTopLogprobsValsHost = runtime::BufferManager::pinnedPool(
+            runtime::ITensor::makeShape({mMaxNewTokens, mNumTopLogprobs}), nvinfer1::DataType::kFLOAT);
+        mTopLogprobsIdsHost = runtime::BufferManager::pinnedPool(
+            runtime::ITensor::makeShape({mMaxNewTokens, mNumTopLogprobs}), nvinfer1::DataType::kINT32);
+    }
+
+    [[nodiscard]] bool getReturnPromptLogprobs() const
+    {
+        return mReturnPromptLogprobs;
+    }
+
+    [[nodiscard]] TensorPtr const& getPromptLogprobsHost() const
+    {
+        return mPromptLogprobsHost;
+    }
+
+    void allocPromptLogprobsHost()
+    {
+        mPromptLogprobsHost
+            = runtime::BufferManager::pinnedPool(runtime::ITensor::makeShape({mPromptLen}), nvinfer1::DataType::kFLOAT);
+        // Positions that never get a logit (the first token and any prefix reused from the KV cache)
+        // keep probability one, i.e. log probability zero in the assembled result.
+        std::fill_n(runtime::bufferCast<float>(*mPromptLogprobsHost), mPromptLen, 1.F);
+    }
+
     void allocTargetModelAcceptedTokenLogitsHost(SizeType32 vocabSizePadded, nvinfer1::DataType logitsDataType)
     {
         mGenerationLogitsHost = runtime::BufferManager::pinnedPool(
@@ -1586,6 +1652,19 @@ public:
         return mLlmRequestType == LlmRequestType::LLMREQUEST_TYPE_GENERATION_ONLY;
     }
 
+    /// @brief Mark a context-only request as a cache warm-up request. Such a request runs the context
+    /// phase to populate reusable KV cache blocks for a predicted session and finishes locally once the
+    /// context phase is done, without a generation phase and without a disaggregated KV cache transfer.
+    void setCacheWarmup(bool cacheWarmup)
+    {
+        mCacheWarmup = cacheWarmup;
+    }
+
+    [[nodiscard]] bool isCacheWarmupRequest() const noexcept
+    {
+        return mLlmRequestType == LlmRequestType::LLMREQUEST_TYPE_CONTEXT_ONLY && mCacheWarmup;
+    }
+
     void setContextCurrentPosition(SizeType32 contextCurrentPosition)
     {
         if (mUseDraftModel)
@@ -1922,6 +2001,17 @@ public:
         }
     }
 
+    //! \brief Accumulate this request's share of a measured iteration latency.
+    void attributeGpuTimeMs(float gpuTimeMs)
+    {
+        mPerfMetrics.attributedGpuTimeMs += gpuTimeMs;
+    }
+
+    [[nodiscard]] float getAttributedGpuTimeMs() const noexcept
+    {
+        return mPerfMetrics.attributedGpuTimeMs;
+    }
+
     void setIsDummyRequest(bool isDummyRequest)
     {
         mIsDummyRequest = isDummyRequest;
@@ -1958,6 +2048,10 @@ public:
     std::optional<SizeType32> mSeqSlot{std::nullopt};
     std::optional<LogitsPostProcessor> mLogitsPostProcessor{std::nullopt};
     bool mApplyLogitsPostProcessorBatched{false};
+    // Device tensor [vocabSizePadded] added in-place to this request's logits each decode step. Device-side
+    // alternative to mLogitsPostProcessor: applied batched on the decoder stream without host callbacks, so the
+    // iteration stays sync-free. Use -inf entries to mask tokens, finite entries for soft constraints.
+    std::optional<TensorPtr> mLogitsPostProcessorBiasTensor{std::nullopt};
     std::optional<RequestIdType> mClientId{std::nullopt};
 
     // Position of mask token in GLM model inputs
@@ -2087,6 +2181,9 @@ protected:
 
     LlmRequestType mLlmRequestType;
 
+    //! Whether a context-only request is a local cache warm-up request, see setCacheWarmup.
+    bool mCacheWarmup{false};
+
     std::optional<executor::ContextPhaseParams> mContextPhaseParams{std::nullopt};
 
     std::shared_ptr<ContextProgress> mContextProgress{nullptr};
@@ -2118,6 +2215,14 @@ protected:
     bool mReturnPerfMetrics{false};
     mutable executor::RequestPerfMetrics mPerfMetrics;
 
+    // Number of top (token, logprob) pairs to return per generated token, 0 to disable.
+    SizeType32 mNumTopLogprobs{0};
+    TensorPtr mTopLogprobsValsHost; // [mMaxNewTokens, mNumTopLogprobs], float
+    TensorPtr mTopLogprobsIdsHost;  // [mMaxNewTokens, mNumTopLogprobs], int32
+
+    bool mReturnPromptLogprobs{false};
+    TensorPtr mPromptLogprobsHost; // [mPromptLen], float probabilities; the log is taken at result assembly
+
     // Guided decoding params.
     std::optional<executor::GuidedDecodingParams> mGuidedDecodingParams{std::nullopt};
 
@@ -2152,6 +2257,11 @@ private:
 
         // Scatter the input tokens to other beam
         mTokens = BeamTokens(mSamplingConfig.beamWidth, inputTokens);
+        for (auto& beamTokens : mTokens)
+        {
+            // Reserve the full sequence up front so generation does not reallocate per token.
+            beamTokens.reserve(inputTokens.size() + mMaxNewTokens);
+        }
         mLastTokens = VecTokens(mSamplingConfig.beamWidth, inputTokens.back());
 
         // Init mUniqueTokens
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,8 @@
 #include "tensorrt_llm/common/algorithm.h"
 #include "tensorrt_llm/runtime/common.h"
 
+#include <memory>
+
 namespace tensorrt_llm::batch_manager
 {
 
@@ -41,6 +43,42 @@ struct ContextChunkingConfig
 
 } // namespace batch_scheduler
 
+/// @brief Feedback controller that adapts the context-token budget of mixed context/generation
+/// iterations from measured iteration latency, replacing hand-tuned static chunk-size tables.
+///
+/// The controller learns a context throughput estimate (tokens per millisecond) from iterations
+/// that carried context compute, and keeps the budget near targetIterLatencyMs * throughput:
+/// multiplicative decrease when a mixed iteration overshoots the latency target, cautious regrowth
+/// towards the throughput-implied ceiling when it stays under. Context-only iterations are never
+/// capped, since there is no co-scheduled decode to protect.
+class ContextChunkBudgetController
+{
+public:
+    using SizeType32 = tensorrt_llm::runtime::SizeType32;
+
+    explicit ContextChunkBudgetController(double targetIterLatencyMs);
+
+    /// @brief Feed one completed iteration: measured wall latency, the context compute tokens it
+    /// carried and the number of co-scheduled generation requests.
+    void recordIteration(double iterLatencyMs, SizeType32 numCtxTokens, SizeType32 numGenRequests);
+
+    /// @brief Current context-token budget for iterations that also carry generation requests.
+    /// Returns std::nullopt until enough iterations have been measured to estimate throughput.
+    [[nodiscard]] std::optional<SizeType32> getCtxTokenBudget() const;
+
+private:
+    /// Weight of the newest sample in the throughput moving average.
+    static constexpr double kThroughputEmaWeight = 0.125;
+    /// Multiplicative budget growth per under-target mixed iteration.
+    static constexpr double kBudgetGrowthFactor = 1.25;
+
+    double const mTargetIterLatencyMs;
+    /// Moving average of measured context compute throughput, in tokens per millisecond.
+    double mCtxTokensPerMs{0.0};
+    /// Current budget in context compute tokens. 0 until the first throughput estimate exists.
+    double mBudget{0.0};
+};
+
 /// @brief This scheduler takes into account the desired batch size and limits of the TRT engine to schedule requests.
 class MicroBatchScheduler : Algorithm
 {
@@ -58,6 +96,10 @@ public:
     std::tuple<RequestVector, RequestVector> operator()(RequestVector& activeRequests, ReqIdsSet const& inflightReqIds,
         SizeType32 maxBatchSizeRuntime, std::optional<SizeType32> maxNumTokensRuntime) const;
 
+    /// @brief Feed the measured latency of a completed iteration to the adaptive context-chunk
+    /// controller (TRTLLM_ADAPTIVE_CTX_CHUNK_TARGET_MS). No-op when the controller is disabled.
+    void recordIterationLatency(double iterLatencyMs, SizeType32 numCtxTokens, SizeType32 numGenRequests) const;
+
     static void setCtxRequestsChunkSize(RequestVector& contextsToBeChunked, ContextChunkingPolicy ctxChunkPolicy,
         std::optional<SizeType32> ctxTokensCapacity, SizeType32 chunkUnitSize,
         std::optional<SizeType32> const& maxContextLength);
@@ -80,6 +122,9 @@ private:
 
     std::optional<batch_scheduler::ContextChunkingConfig> mCtxChunkConfig;
 
+    /// Optional latency-feedback controller for the per-iteration context-token budget.
+    std::unique_ptr<ContextChunkBudgetController> mChunkBudgetController;
+
     /// The state until/after which the scheduler should not schedule requests
     LlmRequestState mNoScheduleUntilState;
     LlmRequestState mNoScheduleAfterState;
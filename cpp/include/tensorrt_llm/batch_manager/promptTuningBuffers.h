@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -24,6 +24,10 @@
 #include "tensorrt_llm/runtime/promptTuningParams.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
 namespace tensorrt_llm::batch_manager
 {
 
@@ -50,6 +54,32 @@ public:
     void fill(RequestVector const& contextRequests, RequestVector const& genRequests,
         runtime::BufferManager const& manager, bool packed);
 
+    /*
+     * Content-hashed device cache for prompt/multimodal embedding tables.
+     * Multi-turn multimodal conversations re-send identical image embeddings every turn; caching the
+     * uploaded tables by content hash lets repeated vision contexts skip the multi-MB H2D copy.
+     * The cache holds whole tables with LRU eviction, bounded by TRTLLM_PROMPT_TABLE_CACHE_MB
+     * (0, the default, disables the cache and keeps the per-request upload path).
+     */
+
+    //! @brief Returns a device copy of the request's prompt embedding table, reusing a cached copy
+    //! when a table with identical contents was uploaded before.
+    [[nodiscard]] TensorPtr getOrUploadPromptTable(
+        std::shared_ptr<LlmRequest> const& llmReq, runtime::BufferManager const& manager);
+
+    struct CachedPromptTable
+    {
+        TensorPtr deviceTable;
+        std::list<std::size_t>::iterator lruIt;
+    };
+
+    //! Capacity in bytes, 0 disables the cache.
+    std::size_t mPromptTableCacheCapacity{0};
+    std::size_t mPromptTableCacheSize{0};
+    //! Content hashes in most-recently-used-first order.
+    std::list<std::size_t> mPromptTableCacheLru;
+    std::unordered_map<std::size_t, CachedPromptTable> mPromptTableCache;
+
     /*
      * The below functions are specific for Chunked Prefill mode
      * Chunk Ptable with Ping-Pong Buffer Implementation
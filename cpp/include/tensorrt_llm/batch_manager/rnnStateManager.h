@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,8 @@
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <cstdint>
+#include <list>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -60,6 +62,22 @@ public:
     [[nodiscard]] std::vector<SizeType32> getStateIndices(
         std::vector<RequestIdType> const& requestIds, std::vector<bool> const& isPadding);
 
+    /// @brief Set the maximum number of host state checkpoints kept for prefix reuse. Zero (the default) disables
+    /// checkpointing. Shrinking the limit evicts least recently used checkpoints.
+    void setMaxStateCheckpoints(SizeType32 maxStateCheckpoints);
+
+    /// @brief Offload the conv / SSM states of the request's slot to pinned host memory, keyed by a caller-provided
+    /// hash of the token prefix that produced them. Copies run on the manager's stream, so they are ordered against
+    /// model execution on that stream. Least recently used checkpoints are evicted beyond the configured limit.
+    void storeStateCheckpoint(RequestIdType requestId, uint64_t prefixKey, SizeType32 prefixLength);
+
+    /// @brief Restore a previously stored checkpoint into the request's slot, so prefill can skip recomputing the
+    /// checkpointed prefix.
+    /// @return The prefix length covered by the restored checkpoint, or 0 when no checkpoint matches.
+    [[nodiscard]] SizeType32 tryRestoreStateCheckpoint(RequestIdType requestId, uint64_t prefixKey);
+
+    [[nodiscard]] SizeType32 getNumStateCheckpoints() const noexcept;
+
     [[nodiscard]] TensorPtr getConvStates(SizeType32 layerIdx) const;
 
     [[nodiscard]] TensorPtr getSsmStates(SizeType32 layerIdx) const;
@@ -92,6 +110,16 @@ public:
     }
 
 private:
+    struct StateCheckpoint
+    {
+        SizeType32 prefixLength;
+        TensorPtr convStates; // [local_nb_layers, 1, ...conv state dims], pinned host
+        TensorPtr ssmStates;  // [local_nb_layers, 1, ...ssm state dims], pinned host
+        std::list<uint64_t>::iterator lruIt;
+    };
+
+    void copySlotStates(SizeType32 slotIdx, StateCheckpoint& checkpoint, bool toCheckpoint);
+
     // If we need support beam search, we may need mMaxBeamWidth + 1 slots and use separate input / output states.
     TensorPtr pagedRnnStates;  // [local_nb_layers, max_seq_num * max_beam_width, state_size, rnn_hidden_size] or
                                // [local_nb_layers, max_seq_num * max_beam_width, num_heads, state_size, rnn_head_size]
@@ -110,6 +138,9 @@ private:
     std::vector<SizeType32> mGlobalLayerNumsPerPP; // contains the global index of RNN layers on self rank
     std::vector<SizeType32> mFreeBlocks;
     std::unordered_map<RequestIdType, SizeType32> mCacheIndex;
+    SizeType32 mMaxStateCheckpoints{0};
+    std::list<uint64_t> mCheckpointLru; // most recently used first
+    std::unordered_map<uint64_t, StateCheckpoint> mStateCheckpoints;
     std::optional<runtime::BufferManager> mBufferManager;
     nvinfer1::DataType mDtype{nvinfer1::DataType::kFLOAT};
     nvinfer1::DataType mSsmCacheDtype{nvinfer1::DataType::kFLOAT};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -132,6 +132,14 @@ private:
     //! General
     TensorPtr inputsIds;
 
+    //! Persistent staging arena for the per-step request descriptor tensors,
+    //! [2 * maxNumSequences + maxNumLogits + maxBatchSize].
+    //! contextLengths, sequenceLengths, lastTokenIds and seqSlots are adjacent views into these
+    //! buffers, so the whole descriptor table can be uploaded with a single async copy instead of
+    //! one small copy per tensor.
+    TensorPtr descriptorStagingHost;
+    TensorPtr descriptorStagingDevice;
+
     TensorPtr contextLengthsHost;
     TensorPtr contextLengthsDevice;
     TensorPtr sequenceLengthsHost;
@@ -152,6 +160,7 @@ private:
     //! Type of host tensor: 0 for context, 1 for generation
     TensorPtr requestTypes;
 
+    //! Views into the descriptor staging arena, [numLogits]
     TensorPtr lastTokenIdsHost;
     TensorPtr lastTokenIdsDevice;
     TensorPtr logitsIdsHost;
@@ -232,7 +241,7 @@ public:
 
     GenerationLogitsCache generationLogitsCache;
 
-    //! Mapping from batch idx to slot id
+    //! Mapping from batch idx to slot id, views into the descriptor staging arena, [numRequests]
     TensorPtr seqSlots;
     TensorPtr seqSlotsDevice;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,7 +19,7 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
-#include <queue>
+#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -56,7 +56,9 @@ private:
     std::chrono::microseconds mMaxSequenceIdleMicroseconds;
 
     std::unordered_map<SequenceIdType, SlotIdType> mSequenceIdToSlot;
-    std::queue<SlotIdType> mAvailableSlots;
+    /// Ordered so that the lowest free slot is claimed first, which keeps the active slots densely
+    /// packed at the low end of the slot-major decoder buffers.
+    std::set<SlotIdType> mAvailableSlots;
     std::vector<std::chrono::steady_clock::time_point> mLastTimepoint;
 };
 
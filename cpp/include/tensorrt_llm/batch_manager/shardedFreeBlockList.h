@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+//! \brief Sharded free-list for KV cache blocks that carry no reusable state.
+//!
+//! \details Stateless blocks (no cached tokens, default retention priority, no expiration) have no meaningful
+//! LRU order: any of them is as good as any other when a sequence needs a fresh block. Keeping them in the
+//! single priority-ordered queue of the eviction policy makes every allocate/free touch one shared structure,
+//! which serializes schedulers that admit hundreds of sequences per iteration. This container spreads such
+//! blocks over per-thread shards so concurrent allocate/free mostly touch disjoint cache lines; a thread whose
+//! shard runs dry steals from its neighbours before giving up.
+//!
+//! Each shard is a LIFO stack guarded by a spinlock. LIFO keeps recently freed blocks hot in the allocating
+//! thread's cache. The container never owns eviction bookkeeping: callers remain responsible for free-block
+//! accounting, and blocks with reuse state must never be pushed here.
+template <typename BlockPtrT>
+class ShardedFreeBlockList
+{
+public:
+    //! \param numShards Number of shards. Zero selects a default derived from the hardware concurrency,
+    //! capped so that mostly idle shards do not inflate the steal scan.
+    explicit ShardedFreeBlockList(std::size_t numShards = 0)
+        : mShards(numShards != 0 ? numShards : defaultShardCount())
+        , mSize{0}
+    {
+    }
+
+    ShardedFreeBlockList(ShardedFreeBlockList const&) = delete;
+    ShardedFreeBlockList& operator=(ShardedFreeBlockList const&) = delete;
+
+    //! \brief Push a block onto the calling thread's shard.
+    void push(BlockPtrT block)
+    {
+        auto& shard = mShards[homeShardIdx()];
+        {
+            SpinLockGuard guard{shard.lock};
+            shard.blocks.push_back(std::move(block));
+        }
+        mSize.fetch_add(1, std::memory_order_release);
+    }
+
+    //! \brief Pop a block, preferring the calling thread's shard and stealing from others when it is empty.
+    //! \return A block, or an empty pointer when all shards are empty.
+    [[nodiscard]] BlockPtrT tryPop()
+    {
+        if (mSize.load(std::memory_order_acquire) == 0)
+        {
+            return BlockPtrT{};
+        }
+        auto const home = homeShardIdx();
+        auto const numShards = mShards.size();
+        for (std::size_t offset = 0; offset < numShards; ++offset)
+        {
+            auto& shard = mShards[(home + offset) % numShards];
+            SpinLockGuard guard{shard.lock};
+            if (!shard.blocks.empty())
+            {
+                auto block = std::move(shard.blocks.back());
+                shard.blocks.pop_back();
+                mSize.fetch_sub(1, std::memory_order_release);
+                return block;
+            }
+        }
+        return BlockPtrT{};
+    }
+
+    //! \brief Remove and return all blocks from all shards.
+    //! \details Used when the caller needs the blocks back under centralized bookkeeping, e.g. on reconfiguration.
+    [[nodiscard]] std::vector<BlockPtrT> drain()
+    {
+        std::vector<BlockPtrT> result;
+        for (auto& shard : mShards)
+        {
+            SpinLockGuard guard{shard.lock};
+            result.insert(result.end(), std::make_move_iterator(shard.blocks.begin()),
+                std::make_move_iterator(shard.blocks.end()));
+            shard.blocks.clear();
+        }
+        mSize.fetch_sub(result.size(), std::memory_order_release);
+        return result;
+    }
+
+    //! \brief Number of blocks currently held across all shards.
+    //! \details Exact when callers are quiescent; otherwise a consistent snapshot of the running counter.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return mSize.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+private:
+    struct SpinLock
+    {
+        std::atomic_flag flag = ATOMIC_FLAG_INIT;
+    };
+
+    struct SpinLockGuard
+    {
+        explicit SpinLockGuard(SpinLock& lock)
+            : mLock{lock}
+        {
+            while (mLock.flag.test_and_set(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        ~SpinLockGuard()
+        {
+            mLock.flag.clear(std::memory_order_release);
+        }
+
+        SpinLockGuard(SpinLockGuard const&) = delete;
+        SpinLockGuard& operator=(SpinLockGuard const&) = delete;
+
+        SpinLock& mLock;
+    };
+
+    struct alignas(64) Shard
+    {
+        SpinLock lock;
+        std::vector<BlockPtrT> blocks;
+    };
+
+    [[nodiscard]] static std::size_t defaultShardCount()
+    {
+        auto const hw = static_cast<std::size_t>(std::thread::hardware_concurrency());
+        return std::max<std::size_t>(1, std::min<std::size_t>(hw, 16));
+    }
+
+    [[nodiscard]] std::size_t homeShardIdx() const noexcept
+    {
+        return std::hash<std::thread::id>{}(std::this_thread::get_id()) % mShards.size();
+    }
+
+    std::vector<Shard> mShards;
+    std::atomic<std::size_t> mSize;
+};
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,9 @@
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace tensorrt_llm::runtime
 {
 class TllmRuntime;
@@ -137,6 +140,19 @@ public:
     void copySkipCrossAttnBlocks(bool const& _skipCrossAttnBlocks, runtime::TllmRuntime const& runtime);
 
 private:
+    //! Per-request upload state of the block-offset batch tables. copyKvBlockOffsets skips the host
+    //! rebuild and H2D upload of rows whose per-sequence offsets and position in the batch table are
+    //! unchanged since the previous call.
+    struct BlockOffsetsRowState
+    {
+        SizeType32 slotOffset;
+        SizeType32 beamWidth;
+        std::uint64_t version;
+    };
+
+    std::unordered_map<RequestIdType, BlockOffsetsRowState> mBlockOffsetsRowStates;
+    SizeType32 mBlockOffsetsNumSequences{-1};
+
     SizeType32 maxInputLen;
     SizeType32 maxEncoderOutputLen;
     SizeType32 maxNumTokens;
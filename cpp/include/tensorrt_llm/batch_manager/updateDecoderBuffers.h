@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -43,9 +43,12 @@ public:
 
     UpdateDecoderBuffers() = default;
 
+    /// @param numActiveSeqSlots One past the highest sequence slot scheduled in this iteration. The
+    /// device-to-host copies of the slot-major decoder state only cover this occupied prefix.
     runtime::CudaEvent operator()(runtime::ModelConfig const& modelConfig, DecoderOutputBuffers& decoderOutputBuffers,
         runtime::BufferManager const& copyBufferManager, runtime::decoder::DecoderState const& decoderState,
-        bool returnLogProbs, runtime::CudaEvent const& decoderFinishEvent) const;
+        bool returnLogProbs, runtime::SizeType32 numActiveSeqSlots,
+        runtime::CudaEvent const& decoderFinishEvent) const;
 };
 
 } // namespace tensorrt_llm::batch_manager
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm::common
+{
+
+//! Process-wide pool of raw memory blocks, bucketed by block size.
+//!
+//! Freed blocks are kept on a per-size free list and handed back to later allocations of the same
+//! size instead of going through the system allocator. Intended for host objects that are created
+//! and destroyed at a high rate with only a few distinct sizes, e.g. per-request metadata.
+//! Thread-safe.
+class BlockPool
+{
+public:
+    static BlockPool& instance()
+    {
+        static BlockPool pool;
+        return pool;
+    }
+
+    [[nodiscard]] void* allocate(std::size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto it = mFreeLists.find(size);
+            if (it != mFreeLists.end() && !it->second.empty())
+            {
+                auto* block = it->second.back();
+                it->second.pop_back();
+                return block;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    void deallocate(void* block, std::size_t size) noexcept
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto& freeList = mFreeLists[size];
+            if (freeList.size() < kMaxBlocksPerSize)
+            {
+                freeList.push_back(block);
+                return;
+            }
+        }
+        catch (...)
+        {
+            // Fall through and return the block to the system allocator.
+        }
+        ::operator delete(block);
+    }
+
+    BlockPool(BlockPool const&) = delete;
+    BlockPool& operator=(BlockPool const&) = delete;
+
+private:
+    // Bounds the memory retained per block size.
+    static constexpr std::size_t kMaxBlocksPerSize{4096};
+
+    BlockPool() = default;
+
+    ~BlockPool()
+    {
+        for (auto& [size, freeList] : mFreeLists)
+        {
+            for (auto* block : freeList)
+            {
+                ::operator delete(block);
+            }
+        }
+    }
+
+    std::mutex mMutex;
+    std::unordered_map<std::size_t, std::vector<void*>> mFreeLists;
+};
+
+//! Minimal allocator backed by BlockPool, e.g. for std::allocate_shared so that the object and its
+//! control block are recycled in a single pooled allocation.
+template <typename T>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(PoolAllocator<U> const& /*other*/) noexcept
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(BlockPool::instance().allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        BlockPool::instance().deallocate(ptr, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(PoolAllocator<U> const& /*other*/) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(PoolAllocator<U> const& /*other*/) const noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace tensorrt_llm::common
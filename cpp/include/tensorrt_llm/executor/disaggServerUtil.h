@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -102,8 +102,11 @@ public:
 
     /// @brief Enqueue context-only requests to context executors.
     /// @param requests A vector of context-only requests.
-    /// @param selectContextId The index of the context executor to use. If `std::nullopt`, the executor that has the
-    /// smallest number of inflight requests will be used.
+    /// @param selectContextId The index of the context executor to use. If `std::nullopt`, the executor with the
+    /// smallest estimated prefill cost is used: the prompt tokens not covered by the executor's cached prefix
+    /// (tracked from its KV cache events, which requires `KvCacheConfig::eventBufferMaxSize > 0` on context
+    /// executors) plus a penalty per inflight request. Executors without KV cache events are scored by load only.
+    /// When `batch` is true, the first request of the batch determines the choice.
     /// @param batch If true,enqueue requests in same context executor.If false, will try to use a different executor
     /// for each request.
     /// @return A vector of global request ids, corresponding to the order of the requests in `requests`, the id
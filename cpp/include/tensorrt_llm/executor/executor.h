@@ -225,7 +225,8 @@ public:
     explicit OutputConfig(bool returnLogProbs = false, bool returnContextLogits = false,
         bool returnGenerationLogits = false, bool excludeInputFromOutput = false, bool returnEncoderOutput = false,
         bool returnPerfMetrics = false,
-        std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs = std::nullopt);
+        std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs = std::nullopt,
+        SizeType32 numTopLogprobs = 0, bool returnPromptLogprobs = false);
 
     /// @brief Controls if Result should contain log probabilities. Default is false.
     bool returnLogProbs;
@@ -243,6 +244,17 @@ public:
 
     /// @brief The additional outputs to gather from the model.
     std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs;
+
+    /// @brief When greater than zero, Result contains the top-k (token, logprob) pairs for each generated
+    /// token, computed on device from the generation logits. Much cheaper than returning the full logits
+    /// when only the leading log probabilities are needed. Requires beamWidth 1. Default is 0 (disabled).
+    SizeType32 numTopLogprobs;
+
+    /// @brief Controls if Result should contain the log probability of each prompt token under the
+    /// preceding prompt tokens (teacher-forced scoring), computed from the context logits without a
+    /// decode loop. Much cheaper than returning the full context logits when only the per-token log
+    /// probabilities are needed. Requires an engine built with gather_context_logits. Default is false.
+    bool returnPromptLogprobs;
 };
 
 /// @brief Configuration for speculative decoding with external draft tokens.
@@ -614,13 +626,18 @@ public:
     explicit KvCacheRetentionConfig(std::vector<TokenRangeRetentionConfig> const& tokenRangeRetentionPriorities,
         RetentionPriority decodeRetentionPriority = kDefaultRetentionPriority,
         std::optional<std::chrono::milliseconds> decodeDurationMs = std::nullopt,
-        KvCacheTransferMode transferMode = KvCacheTransferMode::DRAM, std::string const& directory = "");
+        KvCacheTransferMode transferMode = KvCacheTransferMode::DRAM, std::string const& directory = "",
+        std::optional<IdType> sessionId = std::nullopt, SizeType32 sessionReservedBlocks = 0,
+        std::optional<std::chrono::milliseconds> sessionTtlMs = std::nullopt);
 
     [[nodiscard]] std::vector<TokenRangeRetentionConfig> getTokenRangeRetentionConfigs() const;
     [[nodiscard]] RetentionPriority getDecodeRetentionPriority() const;
     [[nodiscard]] std::optional<std::chrono::milliseconds> getDecodeDurationMs() const;
     [[nodiscard]] KvCacheTransferMode getTransferMode() const;
     [[nodiscard]] std::string const& getDirectory() const;
+    [[nodiscard]] std::optional<IdType> getSessionId() const;
+    [[nodiscard]] SizeType32 getSessionReservedBlocks() const;
+    [[nodiscard]] std::optional<std::chrono::milliseconds> getSessionTtlMs() const;
 
     /// @brief Convert the token range data into an entry per kv block. Returns a tuple of vectors corresponding to the
     /// priorities and durations for each block.
@@ -632,7 +649,8 @@ public:
         return mTokenRangeRetentionConfigs == other.mTokenRangeRetentionConfigs
             && mDecodeRetentionPriority == other.mDecodeRetentionPriority
             && mDecodeDurationMs == other.mDecodeDurationMs && mTransferMode == other.mTransferMode
-            && mDirectory == other.mDirectory;
+            && mDirectory == other.mDirectory && mSessionId == other.mSessionId
+            && mSessionReservedBlocks == other.mSessionReservedBlocks && mSessionTtlMs == other.mSessionTtlMs;
     }
 
 private:
@@ -648,6 +666,16 @@ private:
     KvCacheTransferMode mTransferMode;
     /// @brief Name of the directory if transfer mode is GDS or POSIX_DEBUG_FALLBACK.
     std::string mDirectory;
+    /// @brief Identifier of the multi-turn session this request belongs to. Requests sharing a session id
+    /// refresh a common block reservation in the KV cache manager, so the session prefix stays cached
+    /// between turns and continuation turns avoid re-prefill.
+    std::optional<IdType> mSessionId;
+    /// @brief Number of leading prefix blocks to reserve for the session. 0 disables the reservation.
+    SizeType32 mSessionReservedBlocks;
+    /// @brief How long the reservation survives after the last turn of the session. Each new turn
+    /// refreshes the TTL. Set to std::nullopt to keep the reservation until the session blocks are
+    /// reclaimed by eviction.
+    std::optional<std::chrono::milliseconds> mSessionTtlMs;
 };
 
 /// @brief A class that holds information about the request
@@ -868,9 +896,20 @@ struct Result
     /// @brief The cumulative log probabilities. Size beamSize.
     std::optional<VecLogProbs> cumLogProbs;
 
-    /// @brief The log probabilities for each generated token. Size [beamSize, outputLen]
+    /// @brief The log probabilities for each generated token. Size [beamSize, outputLen]. Like outputTokenIds, in
+    /// streaming mode (unless returnAllGeneratedTokens is set) each response only carries the entries for its new
+    /// tokens, so clients should accumulate them.
     std::optional<std::vector<VecLogProbs>> logProbs;
 
+    /// @brief The top-k (token, logprob) pairs for each generated token if numTopLogprobs is set in
+    /// OutputConfig. Size [outputLen, numTopLogprobs]. Only supported with beamWidth 1.
+    std::optional<std::vector<std::vector<std::pair<TokenIdType, FloatType>>>> topLogprobs;
+
+    /// @brief The log probability of each prompt token under the preceding prompt tokens if
+    /// returnPromptLogprobs is set in OutputConfig. Size [promptLen]. The first token and any tokens
+    /// whose logits were skipped due to KV cache reuse have log probability 0.
+    std::optional<VecLogProbs> promptLogprobs;
+
     /// @brief The context logits. Size [promptLen, vocabSizePadded]
     std::optional<Tensor> contextLogits;
 
@@ -1248,12 +1287,16 @@ public:
     /// model. The first participant is considered to be the leader.
     /// @param orchestratorConfig The orchestrator configuration. See OrchestratorConfig.
     /// @param numNodes The number of nodes to use for execution. Default is 1.
+    /// @param contextParallelism The expected context (sequence) parallelism. The ring layout used for
+    /// context-parallel attention is fixed when the model is built, so this is validated against the model
+    /// configuration at load time rather than applied to it.
     explicit ParallelConfig(CommunicationType commType = CommunicationType::kMPI,
         CommunicationMode commMode = CommunicationMode::kLEADER,
         std::optional<std::vector<SizeType32>> deviceIds = std::nullopt,
         std::optional<std::vector<SizeType32>> participantIds = std::nullopt,
         std::optional<OrchestratorConfig> const& orchestratorConfig = std::nullopt,
-        std::optional<SizeType32> numNodes = std::nullopt);
+        std::optional<SizeType32> numNodes = std::nullopt,
+        std::optional<SizeType32> contextParallelism = std::nullopt);
 
     [[nodiscard]] CommunicationType getCommunicationType() const;
     [[nodiscard]] CommunicationMode getCommunicationMode() const;
@@ -1261,6 +1304,7 @@ public:
     [[nodiscard]] std::optional<std::vector<SizeType32>> getParticipantIds() const;
     [[nodiscard]] std::optional<OrchestratorConfig> getOrchestratorConfig() const;
     [[nodiscard]] std::optional<SizeType32> getNumNodes() const;
+    [[nodiscard]] std::optional<SizeType32> getContextParallelism() const;
 
     void setCommunicationType(CommunicationType type);
     void setCommunicationMode(CommunicationMode mode);
@@ -1268,6 +1312,7 @@ public:
     void setParticipantIds(std::vector<SizeType32> const& participantIds);
     void setOrchestratorConfig(OrchestratorConfig const& orchestratorConfig);
     void setNumNodes(SizeType32 numNodes);
+    void setContextParallelism(SizeType32 contextParallelism);
 
 private:
     friend class Serialization;
@@ -1289,6 +1334,9 @@ private:
 
     /// @brief The number of nodes to use for execution. Default is 1.
     std::optional<SizeType32> mNumNodes;
+
+    /// @brief The expected context (sequence) parallelism, validated against the model configuration.
+    std::optional<SizeType32> mContextParallelism;
 };
 
 /// @brief config for PeftCacheManager
@@ -1827,6 +1875,40 @@ private:
 };
 
 /// @brief The executor is responsible for receiving new requests and sending responses, and running the inference
+/// @brief Configuration for Executor::warmup
+class WarmupConfig
+{
+public:
+    /// @brief A synthetic (input length, output length, batch size) bucket to pre-run during warmup
+    struct Bucket
+    {
+        SizeType32 inputLen;
+        SizeType32 outputLen;
+        SizeType32 batchSize;
+    };
+
+    /// @param buckets The shape buckets to pre-run. Buckets are run one after another, so ordering them by
+    /// increasing size warms the allocator pools monotonically.
+    /// @param warmupTokenId The token id used to fill the synthetic inputs. Defaults to 0.
+    /// @param timeout The maximum time to wait for the responses of a single bucket. No timeout by default.
+    explicit WarmupConfig(std::vector<Bucket> buckets = kDefaultBuckets, TokenIdType warmupTokenId = 0,
+        std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+
+    [[nodiscard]] std::vector<Bucket> const& getBuckets() const;
+
+    [[nodiscard]] TokenIdType getWarmupTokenId() const;
+
+    [[nodiscard]] std::optional<std::chrono::milliseconds> getTimeout() const;
+
+    /// @brief The default shape buckets used when none are given
+    static std::vector<Bucket> const kDefaultBuckets;
+
+private:
+    std::vector<Bucket> mBuckets;
+    TokenIdType mWarmupTokenId;
+    std::optional<std::chrono::milliseconds> mTimeout;
+};
+
 class Executor
 {
 
@@ -1907,6 +1989,13 @@ public:
     /// @param id The request id for which to cancel the response
     void cancelRequest(IdType requestId);
 
+    /// @brief   Runs synthetic batches over the configured shape buckets and waits for their completion.
+    /// @details This call is blocking. It exercises the lazy initialization paths (TRT contexts, attention kernel
+    ///          selection, cuBLAS heuristics, allocator pools) before real traffic arrives, so a load balancer can
+    ///          gate on true readiness. Must be called before real requests are enqueued; only the rank that can
+    ///          enqueue requests runs the warmup, other ranks return immediately.
+    void warmup(WarmupConfig const& warmupConfig = WarmupConfig());
+
     /// @brief   Signals the server to shutdown.
     /// @details This call is blocking. Only returns when all requests have terminated or timeout has been reached
     void shutdown();
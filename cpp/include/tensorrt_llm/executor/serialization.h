@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -155,6 +155,7 @@ public:
 
     // Vector of responses
     static std::vector<Response> deserializeResponses(std::vector<char>& buffer);
+    static std::vector<Response> deserializeResponses(std::istream& is);
     static std::vector<char> serialize(std::vector<Response> const& responses);
 
     // KvCacheConfig
@@ -273,6 +274,11 @@ public:
     static void serialize(SpecDecodingStats const& specDecodingStats, std::ostream& os);
     static size_t serializedSize(SpecDecodingStats const& specDecodingStats);
 
+    // KernelExperimentStats
+    static KernelExperimentStats deserializeKernelExperimentStats(std::istream& is);
+    static void serialize(KernelExperimentStats const& kernelExperimentStats, std::ostream& os);
+    static size_t serializedSize(KernelExperimentStats const& kernelExperimentStats);
+
     // IterationStats
     static IterationStats deserializeIterationStats(std::vector<char>& buffer);
     static IterationStats deserializeIterationStats(std::istream& is);
@@ -281,6 +287,7 @@ public:
     static size_t serializedSize(IterationStats const& iterStats);
     static std::vector<char> serialize(std::vector<IterationStats> const& iterStatsVec);
     static std::vector<IterationStats> deserializeIterationStatsVec(std::vector<char>& buffer);
+    static std::vector<IterationStats> deserializeIterationStatsVec(std::istream& is);
 
     // DisServingStats
     [[nodiscard]] static DisServingRequestStats deserializeDisServingRequestStats(std::istream& is);
@@ -306,6 +313,7 @@ public:
     [[nodiscard]] static std::vector<char> serialize(std::vector<RequestStatsPerIteration> const& requestStatsVec);
     [[nodiscard]] static std::vector<RequestStatsPerIteration> deserializeRequestStatsPerIterationVec(
         std::vector<char>& buffer);
+    [[nodiscard]] static std::vector<RequestStatsPerIteration> deserializeRequestStatsPerIterationVec(std::istream& is);
 
     // KVCacheEvent deque
     [[nodiscard]] static std::vector<char> serialize(std::deque<KVCacheEvent> const& kvCacheEvents);
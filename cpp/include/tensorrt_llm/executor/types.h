@@ -341,6 +341,27 @@ struct SpecDecodingStats
     double draftOverhead;
 };
 
+/// @brief Struct that holds per-variant metrics of a kernel A/B experiment. A configurable fraction
+/// of invocations of an experiment-enabled dispatcher is routed to the candidate variant (B) while
+/// the rest stays on the baseline (A), and measured latencies are accumulated per variant.
+struct KernelExperimentStats
+{
+    /// @brief Name of the dispatcher being canaried
+    std::string name;
+    /// @brief Fraction of invocations routed to variant B
+    double fractionB;
+    /// @brief Number of measured invocations per variant
+    SizeType64 numSamplesA;
+    SizeType64 numSamplesB;
+    /// @brief Average measured latency per variant (ms)
+    double avgLatencyAMS;
+    double avgLatencyBMS;
+    /// @brief Latency histograms per variant; bucket i counts samples with latency in
+    /// [2^(i-4), 2^(i-3)) ms, i.e. bucket 0 starts at 1/16 ms, with under/overflows clamped
+    std::vector<SizeType64> latencyHistogramA;
+    std::vector<SizeType64> latencyHistogramB;
+};
+
 /// @brief Struct that holds the stats of a single iteration
 struct IterationStats
 {
@@ -390,6 +411,8 @@ struct IterationStats
     std::optional<InflightBatchingStats> inflightBatchingStats;
     /// @brief Stats specific to speculative decoding
     std::optional<SpecDecodingStats> specDecodingStats;
+    /// @brief Stats of an active kernel A/B experiment
+    std::optional<KernelExperimentStats> kernelExperimentStats;
 };
 
 /// @brief Enum class that represents the state of a request
@@ -515,6 +538,12 @@ struct RequestPerfMetrics
     std::optional<IterationType> lastIter;
     /// @brief Current iteration
     std::optional<IterationType> iter;
+
+    /// @brief Estimated GPU execution time attributed to this request, in milliseconds
+    /// @details Each scheduled iteration's measured latency is split across the batch in proportion to per-request
+    /// scheduled token counts (context chunk tokens for context requests, decoded tokens for generation requests), so
+    /// the shares of requests sharing a batch sum to the batch's total execution time.
+    FloatType attributedGpuTimeMs{0.f};
 };
 
 /// @brief Struct that holds the debug tensors in an iteration
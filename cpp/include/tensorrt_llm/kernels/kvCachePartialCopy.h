@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
 #include "tensorrt_llm/common/config.h"
 #include "tensorrt_llm/runtime/iBuffer.h"
 
+#include <cstdint>
+
 using namespace tensorrt_llm::runtime;
 
 TRTLLM_NAMESPACE_BEGIN
@@ -26,6 +28,21 @@ namespace kernels
 void kvCacheBlockPartialCopy(IBuffer& dst, IBuffer const& src, unsigned int numLayers, unsigned int numHeads,
     unsigned int tokensPerBlock, unsigned int numHidden, unsigned int numTokensToCopy, int kvFactor,
     cudaStream_t stream);
+
+//! \brief Descriptor for one contiguous region in a batched block copy launch.
+struct KVCacheCopyDesc
+{
+    void const* src;
+    void* dst;
+    std::uint64_t sizeInBytes;
+};
+
+//! \brief Copy a batch of contiguous regions with a single kernel launch.
+//! \details \p descsDevice must point to \p numDescs descriptors in device-visible memory. One thread block
+//! handles each descriptor, using vectorized 16-byte copies when src and dst are 16-byte aligned and falling
+//! back to byte copies otherwise. Replaces one kernel/memcpy launch per region when forking or onboarding
+//! many KV cache blocks in a single step.
+void kvCacheBatchedBlockCopy(KVCacheCopyDesc const* descsDevice, unsigned int numDescs, cudaStream_t stream);
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
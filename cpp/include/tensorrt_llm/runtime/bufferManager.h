@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include "tensorrt_llm/runtime/iTensor.h"
 #include <NvInferRuntime.h>
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <set>
@@ -200,6 +201,35 @@ public:
     //! stream.
     void memoryPoolTrimTo(std::size_t size);
 
+    //! \brief Classes of host<->device traffic competing for the copy engines.
+    enum class TransferClass : std::int32_t
+    {
+        //! Latency-critical readbacks (tokens, log probs, logits returned to the host).
+        kLATENCY = 0,
+        //! KV cache block onboarding from host memory back to the device.
+        kONBOARD = 1,
+        //! Bulk KV cache block offload from the device to host memory.
+        kOFFLOAD = 2,
+        //! Weight and adapter loads (e.g. LoRA pages).
+        kWEIGHTS = 3,
+    };
+
+    static auto constexpr kNumTransferClasses = 4;
+
+    //! \brief Returns the process-wide transfer stream for a traffic class on the current device.
+    //!
+    //! Each class gets its own stream so its copies queue on a separate copy engine instead of
+    //! convoying behind unrelated traffic. The latency class is created at the device's greatest
+    //! stream priority and the offload class at its least, so latency-critical readbacks overtake
+    //! queued bulk offload when the engines are oversubscribed.
+    [[nodiscard]] static CudaStreamPtr getTransferStream(TransferClass transferClass);
+
+    //! \brief Records bytes moved on behalf of a traffic class, for bandwidth accounting.
+    static void accountTransfer(TransferClass transferClass, std::size_t bytes);
+
+    //! \brief Returns the total bytes recorded for a traffic class in this process.
+    [[nodiscard]] static std::size_t getTransferredBytes(TransferClass transferClass);
+
 private:
     friend class ::BufferManagerTest;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -32,6 +32,9 @@ class CudaEvent
 public:
     using pointer = cudaEvent_t;
 
+    //! Callback invoked instead of cudaEventDestroy when the event is recycled, e.g. by a CudaEventPool.
+    using RecycleFn = void (*)(pointer event, void* recycleContext);
+
     //! Creates a new cuda event. The event will be destroyed in the destructor.
     //!
     //! \param flags Flags for event creation. By default, event timing is disabled.
@@ -54,6 +57,19 @@ public:
         mEvent = EventPtr{event, Deleter{ownsEvent}};
     }
 
+    //! Pass an existing cuda event to this object. Instead of being destroyed in the destructor, the event is
+    //! handed back through \p recycleFn, which allows a pool to reuse it.
+    //!
+    //! \param event The event to pass to this object.
+    //! \param recycleFn Callback invoked with the event and \p recycleContext in the destructor.
+    //! \param recycleContext Opaque context forwarded to \p recycleFn.
+    CudaEvent(pointer event, RecycleFn recycleFn, void* recycleContext)
+    {
+        TLLM_CHECK_WITH_INFO(event != nullptr, "event is nullptr");
+        TLLM_CHECK_WITH_INFO(recycleFn != nullptr, "recycleFn is nullptr");
+        mEvent = EventPtr{event, Deleter{recycleFn, recycleContext}};
+    }
+
     //! Returns the event associated with this object.
     [[nodiscard]] pointer get() const
     {
@@ -80,9 +96,24 @@ private:
         {
         }
 
-        constexpr void operator()(pointer event) const
+        Deleter(RecycleFn recycleFn, void* recycleContext)
+            : mOwnsEvent{false}
+            , mRecycleFn{recycleFn}
+            , mRecycleContext{recycleContext}
         {
-            if (mOwnsEvent && event != nullptr)
+        }
+
+        void operator()(pointer event) const
+        {
+            if (event == nullptr)
+            {
+                return;
+            }
+            if (mRecycleFn != nullptr)
+            {
+                mRecycleFn(event, mRecycleContext);
+            }
+            else if (mOwnsEvent)
             {
                 TLLM_CUDA_CHECK(::cudaEventDestroy(event));
                 TLLM_LOG_TRACE("Destroyed event %p", event);
@@ -91,6 +122,8 @@ private:
 
     private:
         bool mOwnsEvent;
+        RecycleFn mRecycleFn{nullptr};
+        void* mRecycleContext{nullptr};
     };
 
     using element_type = std::remove_pointer_t<pointer>;
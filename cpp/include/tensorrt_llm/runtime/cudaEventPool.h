@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/cudaEvent.h"
+
+#include <cuda_runtime_api.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace tensorrt_llm::runtime
+{
+
+//! \brief Lock-free recycling pool for cuda events.
+//!
+//! The iteration loop creates short-lived events at a high rate (decoder synchronization, KV cache transfer
+//! progress, buffer lifetime tracking). cudaEventCreate/cudaEventDestroy take the CUDA driver lock, which is
+//! measurable CPU overhead for small models with short iterations. This pool hands out events wrapped in regular
+//! CudaEvent RAII objects that return their handle to the pool on destruction instead of destroying it.
+//!
+//! Recycling is safe without synchronizing on the event: cudaEventRecord resets the event, and waits that were
+//! enqueued before the event was recycled capture its state at enqueue time.
+//!
+//! The free list is a bounded MPMC ring with a generation tag per cell, so acquire and recycle are lock-free and
+//! O(1) from any thread. When the ring is empty, acquire falls back to cudaEventCreate; when it is full, recycle
+//! falls back to cudaEventDestroy.
+class CudaEventPool
+{
+public:
+    //! \brief Maximum number of events kept alive per pool.
+    static constexpr std::size_t kCapacity = 256;
+
+    //! \brief Returns the pool for the given event creation flags on the current device, created on first use.
+    //!
+    //! \param flags Flags for event creation. By default, event timing is disabled.
+    static CudaEventPool& instance(unsigned int flags = cudaEventDisableTiming);
+
+    //! \brief Acquires an event, reusing a recycled one when available.
+    //!
+    //! The returned object behaves like any other CudaEvent; its destructor hands the event back to this pool.
+    [[nodiscard]] CudaEvent acquire();
+
+    CudaEventPool(CudaEventPool const&) = delete;
+    CudaEventPool& operator=(CudaEventPool const&) = delete;
+
+private:
+    CudaEventPool(int deviceId, unsigned int flags);
+
+    //! \brief Recycle callback installed in the events handed out by acquire.
+    static void recycle(cudaEvent_t event, void* pool);
+
+    struct Cell
+    {
+        //! Generation tag guarding the cell against ABA; doubles as the ring sequence number.
+        std::atomic<std::uint64_t> mGeneration;
+        cudaEvent_t mEvent;
+    };
+
+    int const mDeviceId;
+    unsigned int const mFlags;
+    std::unique_ptr<Cell[]> mCells;
+    alignas(64) std::atomic<std::uint64_t> mPutPos{0};
+    alignas(64) std::atomic<std::uint64_t> mTakePos{0};
+};
+
+} // namespace tensorrt_llm::runtime
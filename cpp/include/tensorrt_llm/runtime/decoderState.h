@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -115,6 +115,14 @@ public:
     //! @returns [maxBeamWidth], sequence lengths for request `batchIdx`, on gpu
     [[nodiscard]] TensorPtr getSequenceLengths(SizeType32 batchIdx) const;
 
+    //! @brief Set the sequence lengths for request `batchIdx`, e.g. after rewinding the request to an earlier
+    //! position. Only the lengths are updated; stale token ids past the new lengths are overwritten as decoding
+    //! continues.
+    //! @param batchIdx The index of the request in the batch.
+    //! @param beamLengths The new sequence length per beam.
+    void setSequenceLengths(
+        SizeType32 batchIdx, std::vector<SizeType32> const& beamLengths, BufferManager const& bufferManager);
+
     //! @brief Get maxTokensPerStep tokens generated in the last forward pass
     //! @returns [maxTokensPerStep, batchSize, maxBeamWidth], tokens generated in last forward pass, on gpu
     [[nodiscard]] TensorPtr getAllNewTokens() const;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -57,7 +57,9 @@ public:
     //! @brief Disable Lookahead decoding.
     virtual void disableLookahead(RequestVector const& genRequests, TensorPtr const& batchSlots) = 0;
 
-    //! @brief Run one step for all requests without blocking the host process and return the token for synchronization.
+    //! @brief Run one step for all requests without blocking the host process.
+    //! @returns An event marking sampling completion on the decoder stream. The runtime stream is not
+    //! serialized behind the decoder; consumers of the decoder outputs must wait on the returned event.
     virtual CudaEvent forwardAsync(
         decoder::DecoderState const& decoderState, batch_manager::DecoderInputBuffers const& input)
         = 0;
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace tensorrt_llm::runtime
+{
+
+///@brief Monitors device memory headroom and classifies it into staged pressure levels, so that callers can
+/// degrade throughput (pause admission, shrink the scheduled batch) instead of running into OOM aborts.
+class MemoryPressureWatchdog
+{
+public:
+    enum class PressureLevel
+    {
+        //! Enough headroom, no action required.
+        kNone = 0,
+        //! Headroom below the elevated threshold, callers should stop growing their footprint.
+        kElevated = 1,
+        //! Headroom below the critical threshold, callers should actively shed load.
+        kCritical = 2,
+    };
+
+    ///@param elevatedFreeFraction Fraction of total device memory below which pressure is considered elevated.
+    ///@param criticalFreeFraction Fraction of total device memory below which pressure is considered critical.
+    explicit MemoryPressureWatchdog(float elevatedFreeFraction = 0.08F, float criticalFreeFraction = 0.03F);
+
+    ///@brief Samples the free device memory and updates the pressure level. Level transitions are logged together
+    /// with the tracked allocation counters. Cheap enough to be called once per decoder iteration.
+    PressureLevel sample();
+
+    ///@brief Gets the pressure level of the last sample.
+    [[nodiscard]] PressureLevel getLevel() const noexcept
+    {
+        return mLevel;
+    }
+
+private:
+    float mElevatedFreeFraction;
+    float mCriticalFreeFraction;
+    PressureLevel mLevel{PressureLevel::kNone};
+};
+
+} // namespace tensorrt_llm::runtime
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -43,6 +43,10 @@ BaseTransBufferManager::BaseTransBufferManager(
         mTransferBufferSize = kv_cache_manager::FabricMemory::getAlignedSize(mTransferBufferSize);
     }
     mPreAllocBufferSize = mTransferBufferSize * (mRecvBufferCount + mSendBufferCount);
+    mDynamicBufferPool = std::make_shared<DynamicBufferPool>();
+    // Concurrency is bounded by the buffer index counts, so retaining more than a couple of
+    // overflow buffers per slot only ties up memory.
+    mDynamicBufferPool->mMaxRetainedBuffers = 2 * (mRecvBufferCount + mSendBufferCount);
 
     TLLM_LOG_INFO(
         "BaseTransBufferManager: mMaxNumTokens:%ld, mRecvBufferCount:%ld, "
@@ -140,8 +144,7 @@ std::tuple<std::vector<runtime::ITensor::SharedPtr>, size_t, bool> BaseTransBuff
             }
             else
             {
-                retSplitCaches.push_back(bufferManagerToUse.gpu(
-                    runtime::ITensor::makeShape({static_cast<int64_t>(requestedNumberOfElements[i])}), mDataType));
+                retSplitCaches.push_back(acquireDynamicBuffer(requestedNumberOfElements[i], bufferManagerToUse));
             }
         }
         TLLM_LOG_DEBUG("getOrAllocateBuffers bufferCoverTargetNum:%d", bufferCoverTargetNum);
@@ -162,8 +165,7 @@ std::tuple<std::vector<runtime::ITensor::SharedPtr>, size_t, bool> BaseTransBuff
     {
         for (int i = 0; i < targetNum; i++)
         {
-            retSplitCaches.push_back(bufferManagerToUse.gpu(
-                runtime::ITensor::makeShape({static_cast<int64_t>(requestedNumberOfElements[i])}), mDataType));
+            retSplitCaches.push_back(acquireDynamicBuffer(requestedNumberOfElements[i], bufferManagerToUse));
         }
         bufferCoverTargetNum = targetNum;
     }
@@ -171,6 +173,54 @@ std::tuple<std::vector<runtime::ITensor::SharedPtr>, size_t, bool> BaseTransBuff
     return std::make_tuple(retSplitCaches, bufferCoverTargetNum, mOnlyUseDynamicBuffer);
 }
 
+runtime::ITensor::SharedPtr BaseTransBufferManager::acquireDynamicBuffer(
+    size_t numberOfElements, runtime::BufferManager const& bufferManagerToUse)
+{
+    // Quantizing to power-of-two classes lets transfers of slightly different lengths share the
+    // same recycled buffers, at the cost of up to 2x transient over-allocation per buffer.
+    size_t classElements = 1;
+    while (classElements < numberOfElements)
+    {
+        classElements <<= 1;
+    }
+
+    runtime::ITensor::SharedPtr base;
+    {
+        std::scoped_lock lk(mDynamicBufferPool->mMutex);
+        auto it = mDynamicBufferPool->mFreeBuffers.lower_bound(classElements);
+        if (it != mDynamicBufferPool->mFreeBuffers.end())
+        {
+            base = std::move(it->second);
+            mDynamicBufferPool->mFreeBuffers.erase(it);
+        }
+    }
+    if (!base)
+    {
+        base = bufferManagerToUse.gpu(
+            runtime::ITensor::makeShape({static_cast<int64_t>(classElements)}), mDataType);
+    }
+
+    auto view = runtime::ITensor::slice(base, 0, numberOfElements);
+    std::weak_ptr<DynamicBufferPool> pool = mDynamicBufferPool;
+    // The handle keeps the view (and through it the backing buffer) alive. Once the transfer
+    // context drops it, the transfer has completed, so the backing buffer can be recycled.
+    return runtime::ITensor::SharedPtr(view.get(),
+        [pool, base, view](runtime::ITensor*) mutable
+        {
+            if (auto lockedPool = pool.lock())
+            {
+                std::scoped_lock lk(lockedPool->mMutex);
+                if (lockedPool->mFreeBuffers.size() < lockedPool->mMaxRetainedBuffers)
+                {
+                    auto const classElements = base->getSize();
+                    lockedPool->mFreeBuffers.emplace(classElements, std::move(base));
+                }
+            }
+            base.reset();
+            view.reset();
+        });
+}
+
 void BaseTransBufferManager::allocateBuffer()
 {
     if (mOnlyUseDynamicBuffer)
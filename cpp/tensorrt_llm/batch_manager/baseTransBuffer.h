@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -24,6 +24,7 @@
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -110,6 +111,13 @@ public:
         return mMaxNumTokens;
     }
 
+    /// @brief Backing cache pools eligible for zero-copy transfers. The transfer agent registers
+    /// them once at startup so transfers can post iovecs over the pool block addresses directly.
+    [[nodiscard]] virtual std::vector<runtime::ITensor::SharedPtr> getPoolBuffers() const
+    {
+        return {};
+    }
+
 protected:
     /// @brief Constructor - derived classes call this after computing buffer sizes.
     /// @param transferBufferSize Size of each transfer buffer in bytes.
@@ -136,6 +144,21 @@ protected:
     void freeBufferIndex(
         ConcurrenceResource& resource, std::optional<int> bufferId, size_t bufferCount, bool onlyUseDynamicBuffer);
 
+    /// @brief Recycling pool for dynamic (overflow) staging buffers, keyed by their power-of-two
+    /// size class in elements. Reusing them avoids per-transfer allocation churn.
+    struct DynamicBufferPool
+    {
+        std::mutex mMutex;
+        std::multimap<size_t, runtime::ITensor::SharedPtr> mFreeBuffers;
+        size_t mMaxRetainedBuffers{0};
+    };
+
+    /// @brief Take a buffer of at least numberOfElements from the pool, or allocate one in the next
+    /// power-of-two size class. When the returned view is dropped, its backing buffer goes back to
+    /// the pool instead of to the allocator.
+    runtime::ITensor::SharedPtr acquireDynamicBuffer(
+        size_t numberOfElements, runtime::BufferManager const& bufferManagerToUse);
+
     size_t mPreAllocBufferSize;
     size_t mRecvBufferCount;
     size_t mSendBufferCount;
@@ -149,6 +172,7 @@ protected:
     runtime::BufferManager mBufferManager;
     std::vector<std::unique_ptr<kv_cache_manager::FabricMemory>> mFabricMemory;
     std::optional<size_t> mMaxNumTokens;
+    std::shared_ptr<DynamicBufferPool> mDynamicBufferPool;
 };
 
 } // namespace tensorrt_llm::batch_manager
@@ -126,11 +126,18 @@ BlockKey BlockKey::shorten(int newNumTokens) const
         newNumTokens >= 0 && newNumTokens <= getNumTokens(), "newNumTokens must be >= 0 and <= getNumTokens()");
     BlockKey result(*this);
     result.uniqueTokens.resize(newNumTokens);
+    result.invalidateHashMemo();
     return result;
 }
 
 size_t BlockKeyHasher::hash(BlockKey const& blockKey, std::size_t parentHash) noexcept
 {
+    // Reuse lookups probe unordered_maps keyed by BlockKey at every tree level, so the same key is hashed several
+    // times per admission. Memoize the unchained (parentHash == 0) hash so each token chunk is hashed only once.
+    if (parentHash == 0 && blockKey.hashMemoValid)
+    {
+        return blockKey.hashMemo;
+    }
     // Hashing algorithm adapted from StackOverflow:
     // https://stackoverflow.com/questions/664014/what-integer-hash-function-are-good-that-accepts-an-integer-hash-key
     // Constants provide very good distribution - each input bit affects each output bit with ~50% probability.
@@ -185,6 +192,12 @@ size_t BlockKeyHasher::hash(BlockKey const& blockKey, std::size_t parentHash) no
         }
     }
 
+    if (parentHash == 0)
+    {
+        blockKey.hashMemo = seed;
+        blockKey.hashMemoValid = true;
+    }
+
     return seed;
 }
 } // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -342,7 +342,7 @@ std::pair<std::vector<size_t>, std::vector<size_t>> CacheFormatter::pickRecvConn
 
 void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& session)
 {
-    NVTX3_SCOPED_RANGE(CacheFormatter_format);
+    NVTX3_SCOPED_RANGE_IN_DOMAIN(kTRANSCEIVER, CacheFormatter_format);
     session.setTime(TransferSession::kTimeFormatter);
     auto const& llmRequest = session.getLlmRequest();
     TLLM_LOG_DEBUG(
@@ -459,7 +459,16 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
         int deviceId = mCacheManager->getBlockManager().getStreamDevice();
         auto targetInfo = executor::kv_cache::targetIRanks(destConfig, selfConfig, selfIdx);
 
-        if (common::getEnvTryZCopyForKVCacheTransfer()
+        // NVFP4 caches store their dequantization scales in separate pools whose layout cannot be
+        // resharded, so they are restricted to matching configurations and always take the direct
+        // block-wise path, with the scale tensors shipped after the data blocks.
+        bool const isFP4Cache = selfConfig.getDataType() == nvinfer1::DataType::kFP4;
+        if (isFP4Cache)
+        {
+            TLLM_CHECK_WITH_INFO(destConfig == selfConfig,
+                "NVFP4 KV cache transfer requires identical cache layout and parallelism on both sides.");
+        }
+        if ((common::getEnvTryZCopyForKVCacheTransfer() || isFP4Cache)
             && (destConfig.getParallelConfig().mPipelineParallelism
                 == selfConfig.getParallelConfig().mPipelineParallelism)
             && (destConfig.getParallelConfig().mTensorParallelism == selfConfig.getParallelConfig().mTensorParallelism))
@@ -479,6 +488,17 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
                         session.send(pickUpConnections[i], block->data(), block->getSizeInBytes());
                     }
                 }
+                if (isFP4Cache)
+                {
+                    for (auto const& [window, blocks] : inputKvCacheBlocksPerWindow)
+                    {
+                        auto scaleRange = blockRange.getBlockScaleRangeForWindow(window);
+                        for (auto it = scaleRange.begin(); it != scaleRange.end(); ++it)
+                        {
+                            session.send(pickUpConnections[i], it->data(), it->getSizeInBytes());
+                        }
+                    }
+                }
             }
             TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(), "End the sending of KV cache for the request ID: %ld.",
                 llmRequest.mRequestId);
@@ -486,6 +506,42 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
             return;
         }
 
+        auto const* agentConnection
+            = dynamic_cast<executor::kv_cache::AgentConnection const*>(connections[pickUpConnections[0]]);
+        if (agentConnection != nullptr && agentConnection->isZeroCopySender())
+        {
+            // The receiver advertised its pool block addresses: post one scatter-gather write over
+            // the registered pool memory and skip the staging copy entirely.
+            NVTX3_SCOPED_RANGE(sendBlocksZeroCopy);
+            TLLM_CHECK_WITH_INFO(common::getEnvKVCacheAgentZeroCopy(),
+                "Peer advertised agent zero-copy but TRTLLM_KVCACHE_AGENT_ZCOPY is not set on this endpoint");
+            TLLM_CHECK(pickUpConnections.size() == 1);
+            TLLM_CHECK_WITH_INFO(
+                destConfig == selfConfig, "Agent zero-copy KV cache transfer requires identical cache layouts");
+            TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
+            std::vector<executor::kv_cache::MemoryDesc> srcDescs;
+            srcDescs.reserve(blockNum);
+            size_t totalSize = 0;
+            for (auto const& [window, blocks] : inputKvCacheBlocksPerWindow)
+            {
+                for (auto const& block : blocks)
+                {
+                    srcDescs.emplace_back(block->data(), block->getSizeInBytes(), static_cast<uint32_t>(deviceId));
+                    totalSize += block->getSizeInBytes();
+                }
+            }
+            session.setTime(TransferSession::kTimePreprocess);
+            auto startTime = LlmRequest::getSteadyClockNow();
+            agentConnection->sendBlocksZeroCopy(session.getDataContext(), std::move(srcDescs));
+            auto endTime = LlmRequest::getSteadyClockNow();
+            session.appendMeasure(startTime, endTime, totalSize);
+            session.setTime(TransferSession::kTimeTransmissions);
+            TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(),
+                "End the sending of KV cache for the request ID: %ld (agent zero-copy).", llmRequest.mRequestId);
+
+            return;
+        }
+
         // formatter flow
         // 1. collect cache blocks of the request.
         // 2. compute the buffer size for each target.
@@ -552,8 +608,6 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
             "bufferCoverTargetNum:%d pickUpConnections.size():%ld",
             bufferTargetNum, targetNum, peerDuplicateHeadFactor, targetInfo.mDupHeadFactor, bufferCoverTargetNum,
             pickUpConnections.size());
-        auto const* agentConnection
-            = dynamic_cast<executor::kv_cache::AgentConnection const*>(connections[pickUpConnections[0]]);
         if (agentConnection != nullptr)
         {
             TLLM_CHECK_WITH_INFO(bufferCoverTargetNum == bufferTargetNum, "Agent need all buffer pre-allocated");
@@ -563,6 +617,23 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
         tensorrt_llm::executor::kv_cache::splitKVCacheDispatch(
             inputKvCacheBlocksPerWindow, outputSplitCaches, destConfig, selfConfig, selfIdx, bufferManager);
 
+        auto const sendDataType = inputKvCacheBlocksPerWindow.begin()->second.front()->getDataType();
+        if (CacheTransBufferManager::useFp8WireCodec(sendDataType))
+        {
+            // Quantize in place inside the registered transfer buffers, then view them as bytes so
+            // only the FP8 payload goes over the wire. The chunked fallback path cannot carry the
+            // codec, so require full buffer coverage.
+            TLLM_CHECK_WITH_INFO(bufferCoverTargetNum == bufferTargetNum,
+                "FP8 wire KV cache transfer requires transfer buffers covering all targets; increase "
+                "max_tokens_in_buffer or unset TRTLLM_KVCACHE_TRANSFER_FP8_WIRE");
+            for (auto& splitCache : outputSplitCaches)
+            {
+                CacheTransBufferManager::quantizeForWire(*splitCache, bufferManager);
+                splitCache = runtime::ITensor::wrap(splitCache->data(), nvinfer1::DataType::kUINT8,
+                    runtime::ITensor::makeShape({static_cast<int64_t>(splitCache->getSize())}));
+            }
+        }
+
         bufferManager.getStream().synchronize();
         session.setTime(TransferSession::kTimePreprocess);
 
@@ -587,7 +658,7 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
 
 void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& session)
 {
-    NVTX3_SCOPED_RANGE(CacheFormatter_unformat);
+    NVTX3_SCOPED_RANGE_IN_DOMAIN(kTRANSCEIVER, CacheFormatter_unformat);
     session.setTime(TransferSession::kTimeFormatter);
     auto const& llmRequest = session.getLlmRequest();
     auto const ctxReqId = llmRequest.getContextPhaseParams().value().getReqId();
@@ -720,7 +791,40 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
             // non-layer-wise
             int deviceId = bufferManager.getStream().getDevice();
 
-            if (common::getEnvTryZCopyForKVCacheTransfer() && destConfig == selfConfig)
+            auto const* agentConnection
+                = dynamic_cast<executor::kv_cache::AgentConnection const*>(connections[pickUpConnections[0]]);
+            if (agentConnection != nullptr && agentConnection->advertisedZeroCopy())
+            {
+                // The pool block addresses were advertised to the sender at request time, so the
+                // data lands directly in the KV pool; just wait for the completion notification.
+                NVTX3_SCOPED_RANGE(recvBlocksZeroCopy);
+                TLLM_CHECK(pickUpConnections.size() == 1);
+                TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
+                session.setTime(TransferSession::kTimePreprocess);
+                size_t totalSize = 0;
+                for (auto const& [window, blocks] : outputBuffersPerWindow)
+                {
+                    for (auto const& block : blocks)
+                    {
+                        llmRequest.updateKvCacheSize(block->getSizeInBytes());
+                        totalSize += block->getSizeInBytes();
+                    }
+                }
+                auto startTime = LlmRequest::getSteadyClockNow();
+                session.recv(pickUpConnections[0], nullptr, 0);
+                auto endTime = LlmRequest::getSteadyClockNow();
+                session.appendMeasure(startTime, endTime, totalSize);
+                session.setTime(TransferSession::kTimeTransmissions);
+                TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(),
+                    "End receiving KV cache for request ID: %ld, context request ID: %ld (agent zero-copy).",
+                    llmRequest.mRequestId, ctxReqId);
+                return;
+            }
+
+            // Mirror of the send side: NVFP4 caches always take the direct block-wise path and
+            // receive the block scale tensors after the data blocks.
+            bool const isFP4Cache = selfConfig.getDataType() == nvinfer1::DataType::kFP4;
+            if ((common::getEnvTryZCopyForKVCacheTransfer() || isFP4Cache) && destConfig == selfConfig)
             {
                 TLLM_LOG_DEBUG("try zcopy for KV cache");
                 NVTX3_SCOPED_RANGE(recvBufferFun);
@@ -738,6 +842,18 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
                             session.recv(pickUpConnections[i], block->data(), block->getSizeInBytes());
                         }
                     }
+                    if (isFP4Cache)
+                    {
+                        for (auto const& [window, blocks] : outputBuffersPerWindow)
+                        {
+                            auto scaleRange = blockRange.getBlockScaleRangeForWindow(window);
+                            for (auto it = scaleRange.begin(); it != scaleRange.end(); ++it)
+                            {
+                                llmRequest.updateKvCacheSize(it->getSizeInBytes());
+                                session.recv(pickUpConnections[i], it->data(), it->getSizeInBytes());
+                            }
+                        }
+                    }
                 }
                 TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(),
                     "End receiving KV cache for request ID: %ld, context request ID: %ld.", llmRequest.mRequestId,
@@ -843,6 +959,24 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
                 TLLM_CHECK(preAllocRecvBuffer->getDataType() == dataType);
             }
 
+            bool const useFp8Wire = CacheTransBufferManager::useFp8WireCodec(dataType);
+            std::vector<runtime::ITensor::SharedPtr> typedRecvCaches;
+            if (useFp8Wire)
+            {
+                // The sender ships FP8 bytes; receive them through byte views of the same buffers
+                // and expand in place before concatenation. The chunked fallback path cannot carry
+                // the codec, so require full buffer coverage.
+                TLLM_CHECK_WITH_INFO(remainNoCoverTargetNum == 0,
+                    "FP8 wire KV cache transfer requires transfer buffers covering all targets; increase "
+                    "max_tokens_in_buffer or unset TRTLLM_KVCACHE_TRANSFER_FP8_WIRE");
+                typedRecvCaches = recvSplitCaches;
+                for (auto& recvCache : recvSplitCaches)
+                {
+                    recvCache = runtime::ITensor::wrap(recvCache->data(), nvinfer1::DataType::kUINT8,
+                        runtime::ITensor::makeShape({static_cast<int64_t>(recvCache->getSize())}));
+                }
+            }
+
             auto recvBufferFun = [&](int deviceId, size_t processIdx)
             {
                 NVTX3_SCOPED_RANGE(recvBufferFun);
@@ -941,6 +1075,15 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
             }
             session.setTime(TransferSession::kTimeTransmissions);
 
+            if (useFp8Wire)
+            {
+                for (auto& typedCache : typedRecvCaches)
+                {
+                    CacheTransBufferManager::dequantizeFromWire(*typedCache, bufferManager);
+                }
+                recvSplitCaches = std::move(typedRecvCaches);
+            }
+
             {
                 NVTX3_SCOPED_RANGE(formatInputConcatenate);
 
@@ -969,6 +1112,13 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
         TLLM_LOG_WARNING("CacheFormatter::inquireSupport: selfConfig.getDataType() != destConfig.getDataType()");
         return false;
     }
+    if (selfConfig.getDataType() == nvinfer1::DataType::kFP4 && !(selfConfig == destConfig))
+    {
+        TLLM_LOG_WARNING(
+            "CacheFormatter::inquireSupport: NVFP4 KV cache transfer requires identical configurations on both "
+            "sides, the block scale tensors cannot be resharded");
+        return false;
+    }
 
     std::unordered_set<SizeType32> setVecSelf{
         selfConfig.getModelConfig().mNbKvHeadsPerLayer.begin(), selfConfig.getModelConfig().mNbKvHeadsPerLayer.end()};
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,6 +19,7 @@
 #include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/opUtils.h"
+#include "tensorrt_llm/executor/cache_transmission/cacheWireCodec.h"
 #include "tensorrt_llm/executor/executor.h"
 
 #include <NvInferRuntimeBase.h>
@@ -256,6 +257,45 @@ CacheTransBufferManager::CacheTransBufferManager(
     TLLM_LOG_INFO("CacheTransBufferManager created for KV cache");
 }
 
+std::vector<runtime::ITensor::SharedPtr> CacheTransBufferManager::getPoolBuffers() const
+{
+    if (mTransferIndexerKCache)
+    {
+        return {mCacheManager->getIndexerKCachePool()};
+    }
+    std::vector<runtime::ITensor::SharedPtr> pools;
+    auto const& blockManager = mCacheManager->getBlockManager();
+    auto const numPools = blockManager.getNumPools();
+    pools.reserve(numPools);
+    for (SizeType32 poolIdx = 0; poolIdx < numPools; poolIdx++)
+    {
+        auto pool = blockManager.getPrimaryPool(poolIdx);
+        if (pool != nullptr)
+        {
+            pools.push_back(std::move(pool));
+        }
+    }
+    return pools;
+}
+
+bool CacheTransBufferManager::useFp8WireCodec(nvinfer1::DataType dataType)
+{
+    return common::getEnvKVCacheTransferFp8Wire()
+        && (dataType == nvinfer1::DataType::kHALF || dataType == nvinfer1::DataType::kBF16);
+}
+
+void CacheTransBufferManager::quantizeForWire(runtime::ITensor& buffer, runtime::BufferManager const& bufferManager)
+{
+    executor::kv_cache::invokeInplaceFp8WireQuantize(buffer.data(), static_cast<int64_t>(buffer.getSize()),
+        buffer.getDataType(), bufferManager.getStream().get());
+}
+
+void CacheTransBufferManager::dequantizeFromWire(runtime::ITensor& buffer, runtime::BufferManager const& bufferManager)
+{
+    executor::kv_cache::invokeInplaceFp8WireDequantize(buffer.data(), static_cast<int64_t>(buffer.getSize()),
+        buffer.getDataType(), bufferManager.getStream().get());
+}
+
 size_t CacheTransBufferManager::preAllocBufferSize(
     std::map<SizeType32, SizeType32> const& cacheSizeBytesPerTokenPerWindow, SizeType32 tokensPerBlock,
     std::optional<executor::CacheTransceiverConfig> const& cacheTransceiverConfig)
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -68,6 +68,17 @@ public:
         SizeType32 tokensPerBlock,
         std::optional<executor::CacheTransceiverConfig> const& cacheTransceiverConfig = std::nullopt);
 
+    /// @brief Whether transfer buffers of the given KV cache dtype are quantized to FP8 on the wire
+    /// (TRTLLM_KVCACHE_TRANSFER_FP8_WIRE). Must be set consistently on both endpoints.
+    static bool useFp8WireCodec(nvinfer1::DataType dataType);
+
+    /// @brief Quantize a transfer buffer to FP8 in place on the manager's stream; afterwards only
+    /// the first getSize() bytes carry the payload.
+    static void quantizeForWire(runtime::ITensor& buffer, runtime::BufferManager const& bufferManager);
+
+    /// @brief Expand the first getSize() FP8 bytes of a received transfer buffer back to its dtype in place.
+    static void dequantizeFromWire(runtime::ITensor& buffer, runtime::BufferManager const& bufferManager);
+
     /// @brief Get the KV cache manager.
     [[nodiscard]] KVCacheManager::BaseKVCacheManager* getCacheManager() const noexcept
     {
@@ -79,6 +90,9 @@ public:
         return mTransferIndexerKCache ? BufferKind::kKV_INDEXER : BufferKind::kKV;
     }
 
+    /// @brief Primary KV cache pools backing the managed cache, for zero-copy registration.
+    [[nodiscard]] std::vector<runtime::ITensor::SharedPtr> getPoolBuffers() const override;
+
 private:
     /// @brief Compute transfer buffer size from KV cache configuration.
     static size_t computeTransferBufferSize(KVCacheManager::BaseKVCacheManager* cacheManager,
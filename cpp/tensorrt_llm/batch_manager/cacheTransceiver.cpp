@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -289,10 +289,15 @@ CacheTransceiver::CacheTransceiver(kv_cache_manager::BaseKVCacheManager* cacheMa
     mCacheReceiver = std::make_unique<CacheReceiver>(mManager.get(), worldConfig.getRank(), makeCacheTransferLayer());
 
     initializeCommState();
+    prewarmConnections();
 }
 
 CacheTransceiver::~CacheTransceiver()
 {
+    if (mPrewarmThread.joinable())
+    {
+        mPrewarmThread.join();
+    }
     if (mWrapperLibHandle)
     {
         std::lock_guard<std::mutex> lock(mDllMutex);
@@ -305,6 +310,70 @@ void CacheTransceiver::initializeCommState()
     mCommState = std::addressof(mCacheSender->getCommState());
 }
 
+void CacheTransceiver::prewarmConnections()
+{
+    auto const& peerList = common::getEnvKVCachePrewarmPeers();
+    if (peerList.empty())
+    {
+        return;
+    }
+    // Only socket-based managers (UCX) address peers by endpoint; agent/MPI managers identify
+    // peers by names that cannot be synthesized from an ip:port list.
+    if (!mCommState->isSocketState())
+    {
+        TLLM_LOG_WARNING(
+            "TRTLLM_KVCACHE_PREWARM_PEERS is only supported with the UCX cache transceiver backend, ignoring it.");
+        return;
+    }
+    std::vector<executor::kv_cache::SocketState> socketStates;
+    std::istringstream peers(peerList);
+    std::string peer;
+    while (std::getline(peers, peer, ','))
+    {
+        auto const colonPos = peer.rfind(':');
+        try
+        {
+            TLLM_CHECK(colonPos != std::string::npos);
+            auto const port = std::stoi(peer.substr(colonPos + 1));
+            TLLM_CHECK(port > 0 && port <= std::numeric_limits<uint16_t>::max());
+            socketStates.push_back(
+                executor::kv_cache::SocketState{static_cast<uint16_t>(port), peer.substr(0, colonPos)});
+        }
+        catch (std::exception const&)
+        {
+            TLLM_LOG_WARNING(
+                "TRTLLM_KVCACHE_PREWARM_PEERS: ignoring malformed peer '%s', expected ip:port", peer.c_str());
+        }
+    }
+    if (socketStates.empty())
+    {
+        return;
+    }
+    // Establish the sessions on a background thread; connection setup handshakes with each peer
+    // and must not delay executor startup. The connection managers cache established connections
+    // for the lifetime of the process, so the first request to each peer skips the setup cost.
+    mPrewarmThread = std::thread(
+        [this, socketStates = std::move(socketStates)]()
+        {
+            for (auto const& socketState : socketStates)
+            {
+                try
+                {
+                    mManager->getConnections(
+                        executor::kv_cache::CommState{std::vector<executor::kv_cache::SocketState>{socketState}});
+                    TLLM_LOG_INFO("Pre-warmed KV cache transfer connection to %s", socketState.toString().c_str());
+                }
+                catch (std::exception const& e)
+                {
+                    // Best effort: the peer may not be up yet; the connection will be established
+                    // lazily on the first transfer instead.
+                    TLLM_LOG_WARNING("Failed to pre-warm KV cache transfer connection to %s: %s",
+                        socketState.toString().c_str(), e.what());
+                }
+            }
+        });
+}
+
 void CacheTransceiver::setContextState(LlmRequest* llmRequest)
 {
     TLLM_CHECK(llmRequest && llmRequest->isContextOnlyRequest());
@@ -19,6 +19,7 @@
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
 #include "tensorrt_llm/batch_manager/peftCacheManager.h"
 #include "tensorrt_llm/batch_manager/scheduledBlocksManager.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 
@@ -109,6 +110,64 @@ bool beneficialToSkip(std::optional<kv_cache_manager::PrefixReuseSummary> const&
     return false;
 }
 
+/// @brief Group pending context requests that miss the prefix cache at the same first block.
+/// @details Requests arriving close together often share prefixes, but FIFO admission interleaves them with
+/// unrelated requests. Within a window of windowSize requests at the head of the pending queue, a request whose
+/// first missing prefix block matches that of an earlier request is moved directly behind it, so the group
+/// leader contributes the shared blocks and the sharers attach to them (via the beneficial-to-skip deferral)
+/// as soon as they are written. Relative order is preserved within groups and beyond the window.
+/// @return The prefix reuse summaries computed for the window, keyed by request ID, so the admission loop
+/// does not repeat the radix tree walk.
+std::unordered_map<LlmRequest::RequestIdType, kv_cache_manager::PrefixReuseSummary> groupPendingRequestsByPrefix(
+    RequestVector& pendingRequests, kv_cache_manager::BaseKVCacheManager const& kvCacheManager, SizeType32 windowSize)
+{
+    std::unordered_map<LlmRequest::RequestIdType, kv_cache_manager::PrefixReuseSummary> summaries;
+    auto const window = std::min(pendingRequests.size(), static_cast<std::size_t>(std::max(windowSize, 0)));
+    if (window < 2)
+    {
+        return summaries;
+    }
+    // Groups keep arrival order; a shared group is keyed by the first block its leader will contribute.
+    std::vector<RequestVector> groups;
+    std::unordered_map<BlockKey, std::size_t, BlockKeyHasher> groupOfBlock;
+    for (std::size_t idx = 0; idx < window; ++idx)
+    {
+        auto& req = pendingRequests[idx];
+        std::optional<std::size_t> groupIdx;
+        if (req->isContextInitState() && req->isFirstContextChunk())
+        {
+            auto uniqueTokens = req->getUniqueTokens(0);
+            auto summary = kvCacheManager.analyzePrefixReuse(uniqueTokens, *req);
+            if (summary.firstNewBlock.has_value())
+            {
+                auto const [it, inserted] = groupOfBlock.try_emplace(summary.firstNewBlock.value(), groups.size());
+                if (inserted)
+                {
+                    groups.emplace_back();
+                }
+                groupIdx = it->second;
+            }
+            summaries.emplace(req->mRequestId, std::move(summary));
+        }
+        if (!groupIdx.has_value())
+        {
+            // Full prefix hits and non-context requests keep their arrival position as singleton groups.
+            groupIdx = groups.size();
+            groups.emplace_back();
+        }
+        groups[groupIdx.value()].emplace_back(std::move(req));
+    }
+    std::size_t idx = 0;
+    for (auto& group : groups)
+    {
+        for (auto& req : group)
+        {
+            pendingRequests[idx++] = std::move(req);
+        }
+    }
+    return summaries;
+}
+
 } // namespace
 
 MaxRequestsScheduler::MaxRequestsScheduler(
@@ -264,6 +323,19 @@ std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::impl(
         }
     }
 
+    // Prefix-aware admission reordering: within a bounded window at the head of the pending queue, group
+    // requests that miss the prefix cache at the same first block so sharers are admitted back to back
+    // instead of being interleaved with unrelated requests that drain the admission budget.
+    std::unordered_map<LlmRequest::RequestIdType, kv_cache_manager::PrefixReuseSummary> windowSummaries;
+    if constexpr (!StaticBatchScheduling)
+    {
+        if (skippingIsRelevant && kvCacheManager.isEnableBlockReuse())
+        {
+            windowSummaries = groupPendingRequestsByPrefix(
+                pendingRequests, kvCacheManager, common::getEnvPrefixAwareAdmissionWindow());
+        }
+    }
+
     // If StaticBatchScheduling == true check if we can add pending requests only when no requests are active.
     // Otherwise, add just check that we can add pending requests.
     if (!StaticBatchScheduling || scheduledRequests.size() == 0)
@@ -291,8 +363,16 @@ std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::impl(
                     // and let downstream callers fall back to their fresh tree-walk path.
                     if (kvCacheManager.isEnableBlockReuse() && !kvCacheManager.getBlockManager().isVariableWindow())
                     {
-                        auto uniqueTokens = req->getUniqueTokens(0);
-                        summary = kvCacheManager.analyzePrefixReuse(uniqueTokens, *req);
+                        if (auto const summaryIt = windowSummaries.find(req->mRequestId);
+                            summaryIt != windowSummaries.end())
+                        {
+                            summary = summaryIt->second;
+                        }
+                        else
+                        {
+                            auto uniqueTokens = req->getUniqueTokens(0);
+                            summary = kvCacheManager.analyzePrefixReuse(uniqueTokens, *req);
+                        }
                     }
                     if (crossKvCacheManager && crossKvCacheManager->isEnableBlockReuse()
                         && !crossKvCacheManager->getBlockManager().isVariableWindow())
@@ -392,12 +472,21 @@ std::tuple<RequestVector, RequestVector> MaxUtilizationScheduler::operator()(
 
     RequestVector scheduledRequests;
     RequestVector pausedRequests;
+    // Requests already chosen as preemption victims this iteration (priority-aware mode only, where victims
+    // may sit anywhere in the active list rather than forming a suffix).
+    std::unordered_set<LlmRequest::RequestIdType> pausedIds;
     auto reqItEnd = std::end(activeRequests);
     for (auto reqIt = std::begin(activeRequests); reqIt != reqItEnd;)
     {
         auto const& req = *reqIt;
         TLLM_LOG_DEBUG("MaxUtilizationScheduler: scheduling request ID %lu", req->mRequestId);
 
+        if (pausedIds.count(req->mRequestId) > 0)
+        {
+            reqIt++;
+            continue;
+        }
+
         // if request cannot be scheduled yet or request should no longer be scheduled, skip
         if (
             // Allow disagg_generation_init requests to be scheduled, so that we'll allocate their KV cache
@@ -440,6 +529,45 @@ std::tuple<RequestVector, RequestVector> MaxUtilizationScheduler::operator()(
             TLLM_LOG_DEBUG("MaxUtilizationScheduler: request ID %lu -> start", req->mRequestId);
             reqIt++;
         }
+        else if (common::getEnvPriorityAwarePreemption())
+        {
+            // Priority- and cost-aware victim selection: among started requests that do not outrank the
+            // request being admitted, pause the lowest-priority one; break ties by the KV-block cost of
+            // re-prefilling the victim on resume (cheapest first), then by latest start order.
+            auto const tokensPerBlock = kvCacheManager.getTokensPerBlock();
+            auto reprefillBlocks = [tokensPerBlock](std::shared_ptr<LlmRequest> const& victim)
+            { return (victim->getNumTokens(0) + tokensPerBlock - 1) / tokensPerBlock; };
+            auto victimIt = reqItEnd;
+            for (auto candidateIt = reqIt; candidateIt != reqItEnd; ++candidateIt)
+            {
+                auto const& candidate = *candidateIt;
+                if (!startedReqLambda(candidate) || pausedIds.count(candidate->mRequestId) > 0
+                    || candidate->priority() > req->priority())
+                {
+                    continue;
+                }
+                if (victimIt == reqItEnd
+                    || std::make_tuple(candidate->priority(), reprefillBlocks(candidate))
+                        <= std::make_tuple((*victimIt)->priority(), reprefillBlocks(*victimIt)))
+                {
+                    victimIt = candidateIt;
+                }
+            }
+            if (victimIt != reqItEnd)
+            {
+                kvCacheManager.schedulingRemoveSequence((*victimIt)->mRequestId);
+                pausedRequests.emplace_back(*victimIt);
+                pausedIds.insert((*victimIt)->mRequestId);
+                TLLM_LOG_DEBUG("MaxUtilizationScheduler: request ID %lu -> pause (priority %.2f, %d blocks to "
+                               "re-prefill)",
+                    (*victimIt)->mRequestId, static_cast<double>((*victimIt)->priority()),
+                    reprefillBlocks(*victimIt));
+            }
+            else
+            {
+                break;
+            }
+        }
         else
         {
             auto const rbegin = std::reverse_iterator(reqItEnd);
@@ -533,7 +661,7 @@ std::tuple<RequestVector, RequestVector, RequestVector> CapacityScheduler::opera
     OptionalRef<BasePeftCacheManager const> peftCacheManager,
     OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager) const
 {
-    NVTX3_SCOPED_RANGE(capacitySchedulerScheduling);
+    NVTX3_SCOPED_RANGE_IN_DOMAIN(kSCHEDULER, capacitySchedulerScheduling);
     return std::visit(
         [&activeRequests, &kvCacheManager, &crossKvCacheManager, &peftCacheManager](
             auto const& scheduler) -> std::tuple<RequestVector, RequestVector, RequestVector>
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,6 +16,7 @@
  */
 
 #include "tensorrt_llm/batch_manager/contextProgress.h"
+#include "tensorrt_llm/runtime/cudaEventPool.h"
 
 namespace tensorrt_llm::batch_manager
 {
@@ -27,7 +28,8 @@ ContextProgress::ContextProgress(int numLayers)
     for (int i = 0; i < numLayers; i++)
     {
         mCudaEventsRecorded[i] = false;
-        mCudaEvents.emplace_back(cudaEventBlockingSync | cudaEventDisableTiming);
+        mCudaEvents.push_back(
+            runtime::CudaEventPool::instance(cudaEventBlockingSync | cudaEventDisableTiming).acquire());
     }
     TLLM_LOG_DEBUG("ContextProgress created - expect %d layers", numLayers);
 }
@@ -38,18 +40,21 @@ void ContextProgress::recordEvent(int layerIdx, cudaStream_t stream)
     TLLM_CHECK_WITH_INFO(layerIdx == 0 || mCudaEventsRecorded[layerIdx - 1], "Layer %d is skipped", layerIdx - 1);
     TLLM_CHECK_WITH_INFO(!mCudaEventsRecorded[layerIdx], "Layer %d is recorded twice", layerIdx);
     TLLM_CUDA_CHECK(cudaEventRecord(mCudaEvents[layerIdx].get(), stream));
-    mCudaEventsRecorded[layerIdx] = true;
+    {
+        // Publish the flag under the mutex so a waiter cannot check it and block between the store
+        // and the notification below.
+        std::lock_guard lock(mMutex);
+        mCudaEventsRecorded[layerIdx] = true;
+    }
     mConditionVariable.notify_all();
 }
 
 void ContextProgress::wait(int layerIdx)
 {
     TLLM_CHECK(layerIdx < getNumLayers());
-    while (!mCudaEventsRecorded[layerIdx])
     {
         std::unique_lock lock(mMutex);
-        auto const timeout = std::chrono::milliseconds(10);
-        mConditionVariable.wait_for(lock, timeout);
+        mConditionVariable.wait(lock, [this, layerIdx] { return mCudaEventsRecorded[layerIdx].load(); });
     }
     mCudaEvents[layerIdx].synchronize();
 }
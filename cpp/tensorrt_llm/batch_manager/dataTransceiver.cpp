@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -479,8 +479,14 @@ private:
     {
         LlmRequest* mRequest;
         std::promise<void> mPromise;
+        // Number of times a younger response was dequeued ahead of this one.
+        int32_t mNumBypassed{0};
     };
 
+    /// An entry that has been bypassed this many times is dequeued unconditionally, so bulk
+    /// transfers keep making progress under a steady stream of small high-priority ones.
+    static constexpr int32_t kMaxSendQueueBypass = 4;
+
     struct AsyncSendResource
     {
         std::deque<Response> mSendQueue;
@@ -508,8 +514,31 @@ private:
                     }
                     break;
                 }
-                resp = std::move(resource.mSendQueue.front());
-                resource.mSendQueue.pop_front();
+                // Pick the pending response with the highest request priority, preferring fewer
+                // context tokens within a priority class, so that small interactive transfers are
+                // not head-of-line blocked behind bulk ones. The oldest entry is taken
+                // unconditionally once it has been bypassed too often.
+                auto best = resource.mSendQueue.begin();
+                if (best->mNumBypassed < kMaxSendQueueBypass)
+                {
+                    for (auto it = std::next(best); it != resource.mSendQueue.end(); ++it)
+                    {
+                        auto const bestPriority = best->mRequest->priority();
+                        auto const itPriority = it->mRequest->priority();
+                        if (itPriority > bestPriority
+                            || (itPriority == bestPriority
+                                && it->mRequest->getPromptLen() < best->mRequest->getPromptLen()))
+                        {
+                            best = it;
+                        }
+                    }
+                }
+                if (best != resource.mSendQueue.begin())
+                {
+                    ++resource.mSendQueue.front().mNumBypassed;
+                }
+                resp = std::move(*best);
+                resource.mSendQueue.erase(best);
             }
             sendAndRemoveResponse(resp.mRequest->mRequestId, std::move(resp));
         }
@@ -846,15 +875,6 @@ public:
         }
 
         auto* agentConnectionManager = dynamic_cast<executor::kv_cache::AgentConnectionManager*>(mManager);
-        std::vector<std::optional<size_t>> cacheBufferIds;
-        if (agentConnectionManager)
-        {
-            for (auto& cacheTransBufferManager : agentConnectionManager->getCacheTransBufferManagers())
-            {
-                cacheBufferIds.push_back(cacheTransBufferManager->assignBufferIndexForRecv());
-            }
-            TLLM_CHECK(!cacheBufferIds.empty());
-        }
 
         auto allCounterparts
             = mCacheTransferLayer.computeCounterparts(mSelfState.getCommState().value().getSelfIdx(), contextState);
@@ -864,6 +884,53 @@ public:
 
         bool hasRnn = mCacheTransferLayer.getCacheState().hasRnnConfig() && destCacheState.hasRnnConfig();
 
+        // Transfer-agent zero-copy: with identical cache layouts and a single counterpart, advertise
+        // the per-block KV pool addresses instead of a staging buffer so the sender can RDMA the
+        // paged blocks in place. The pools were registered with the agent at startup.
+        bool agentZeroCopy = false;
+        std::vector<executor::kv_cache::MemoryDesc> blockDescs;
+        if (agentConnectionManager != nullptr && common::getEnvKVCacheAgentZeroCopy() && !hasRnn
+            && allCounterparts.size() == 1 && kvCounterParts.size() == 1
+            && destCacheState == mSelfState.getCacheState().value()
+            && mSelfState.getCacheState().value().getAttentionConfig().mAttentionType
+                != executor::kv_cache::CacheState::AttentionType::kMLA)
+        {
+            auto* cacheManager = mCacheTransferLayer.getCacheManager();
+            auto const dataType = cacheManager->getPrimaryPool(0)->getDataType();
+            // NVFP4 needs the block scale pools shipped as well, and the FP8 wire codec needs the
+            // staging buffers to expand in; both keep the staging path.
+            if (dataType != nvinfer1::DataType::kFP4
+                && !kv_cache_manager::CacheTransBufferManager::useFp8WireCodec(dataType))
+            {
+                auto const srcPpSize = destCacheState.getParallelConfig().mPipelineParallelism;
+                bool const recvSideHasCP
+                    = mSelfState.getCacheState().value().getParallelConfig().mContextParallelism > 1;
+                auto blockRange = getBlockRangeForReceiving(cacheManager, llmRequest,
+                    destCacheState.getEnableBlockReuse(), destCacheState.getEnablePartialReuse(), recvSideHasCP,
+                    srcPpSize);
+                auto const deviceId = static_cast<uint32_t>(agentConnectionManager->getDeviceId());
+                for (auto const& windowSize : blockRange.getWindowSizes())
+                {
+                    auto blockRangeForWindow = blockRange.getBlockRangeForWindow(windowSize);
+                    for (auto it = blockRangeForWindow.begin(); it != blockRangeForWindow.end(); ++it)
+                    {
+                        blockDescs.emplace_back(it->data(), it->getSizeInBytes(), deviceId);
+                    }
+                }
+                agentZeroCopy = !blockDescs.empty();
+            }
+        }
+
+        std::vector<std::optional<size_t>> cacheBufferIds;
+        if (agentConnectionManager && !agentZeroCopy)
+        {
+            for (auto& cacheTransBufferManager : agentConnectionManager->getCacheTransBufferManagers())
+            {
+                cacheBufferIds.push_back(cacheTransBufferManager->assignBufferIndexForRecv());
+            }
+            TLLM_CHECK(!cacheBufferIds.empty());
+        }
+
         std::vector<SizeType32> rnnCounterParts;
         if (hasRnn)
         {
@@ -932,7 +999,9 @@ public:
                 TLLM_CHECK(agentConnection != nullptr);
 
                 const_cast<executor::kv_cache::AgentConnection*>(agentConnection)
-                    ->sendRequestAndBufferInfo(requestInfo, idsForRank, validConnectionIdx);
+                    ->sendRequestAndBufferInfo(requestInfo, idsForRank, validConnectionIdx,
+                        agentZeroCopy && isKvCounterpart ? std::move(blockDescs)
+                                                        : std::vector<executor::kv_cache::MemoryDesc>{});
             }
             else
             {
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,6 +17,8 @@
 
 #include "tensorrt_llm/batch_manager/evictionPolicy.h"
 
+#include "tensorrt_llm/common/envUtils.h"
+
 using namespace tensorrt_llm::batch_manager::kv_cache_manager;
 
 // This implements priority-based eviction.
@@ -81,6 +83,7 @@ void LRUEvictionPolicy::initialize(std::vector<BlockPtr>& mAllBlocksById, std::v
     }
 
     mSecondaryOffloadMinPriority = secondaryOffloadMinPriority.value_or(kDefaultSecondaryOffloadMinPriority);
+    mScanResistantEviction = common::getEnvKVCacheScanResistantEviction();
 }
 
 void LRUEvictionPolicy::initializePlaceholders(std::vector<BlockPtr>& allPlaceholderBlocksById)
@@ -143,6 +146,17 @@ std::tuple<BlockPtr, bool> LRUEvictionPolicy::getFreeBlock(SizeType32 cacheLevel
 
     for (SizeType32 pri = 0; pri < kNumPriorities; pri++)
     {
+        // Stateless primary blocks live in the sharded free list at default priority. Consult it once the scan
+        // reaches the default priority so that lower-priority (more evictable) queued blocks still go first.
+        if (level == 0 && !wantPlaceholder && pri == defaultPriorityIdx)
+        {
+            if (auto block = mStatelessPrimaryShards.tryPop())
+            {
+                // claimBlock sees no queue iterator for shard blocks and won't decrement, so do it here.
+                mNumFreeBlocksPerLevel[0]--;
+                return std::make_tuple(block, false);
+            }
+        }
         // Find the first non-empty queue, and return the first block.
         if (!mFreeQueues[level][pri].empty())
         {
@@ -175,9 +189,25 @@ void LRUEvictionPolicy::releaseBlock(BlockPtr block, bool toFront)
     SizeType32 const cacheLevel = getCacheLevel(block);
     SizeType32 const id = block->getBlockId();
 
+    // Stateless primary blocks carry nothing worth evicting in order, so release them into the sharded free
+    // list instead of the shared queues. This keeps the high-frequency allocate/free churn of non-reuse
+    // serving off the single queue structure. toFront releases express an explicit eviction preference and
+    // stay on the ordered path.
+    if (!toFront && cacheLevel == 0 && block->getUniqueTokens().empty() && block->getPriority() == kDefaultPriority
+        && !block->getDurationMs().has_value())
+    {
+        mStatelessPrimaryShards.push(block);
+        mNumFreeBlocksPerLevel[0]++;
+        return;
+    }
+
     // If there are no children, this is a leaf block. Insert into a queue.
     auto& q = mFreeQueues[cacheLevel][getPriorityIdx(block->getPriority())];
-    if (toFront)
+    // With scan resistance enabled, cached content that has never been re-hit queues at the front (evicted
+    // first), so single-pass scans cannot push proven-hot blocks of the same priority out of the cache.
+    bool const evictEarly = mScanResistantEviction && !toFront && !block->getUniqueTokens().empty()
+        && block->getReuseCount() == 0;
+    if (toFront || evictEarly)
     {
         mFreeBlockIterators[id] = q.insert(q.begin(), block);
     }
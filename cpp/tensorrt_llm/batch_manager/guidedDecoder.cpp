@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -24,11 +24,39 @@
 #include <nlohmann/json.hpp>
 #include <xgrammar/xgrammar.h>
 
+#include <fstream>
+#include <functional>
+#include <future>
+
 using namespace tensorrt_llm::runtime;
 
 namespace tensorrt_llm::batch_manager
 {
 
+namespace
+{
+
+xgrammar::CompiledGrammar compileGrammar(xgrammar::GrammarCompiler& compiler,
+    executor::GuidedDecodingParams::GuideType guideType, std::optional<std::string> const& guide)
+{
+    switch (guideType)
+    {
+    case executor::GuidedDecodingParams::GuideType::kJSON: return compiler.CompileBuiltinJSONGrammar();
+    case executor::GuidedDecodingParams::GuideType::kJSON_SCHEMA: return compiler.CompileJSONSchema(guide.value());
+    case executor::GuidedDecodingParams::GuideType::kREGEX: return compiler.CompileRegex(guide.value());
+    case executor::GuidedDecodingParams::GuideType::kEBNF_GRAMMAR: return compiler.CompileGrammar(guide.value());
+    case executor::GuidedDecodingParams::GuideType::kSTRUCTURAL_TAG: return compiler.CompileStructuralTag(guide.value());
+    default: TLLM_THROW("Unsupported guide type.");
+    }
+}
+
+size_t guideHash(executor::GuidedDecodingParams::GuideType guideType, std::string const& guide)
+{
+    return std::hash<std::string>{}(guide) ^ (static_cast<size_t>(guideType) << 1);
+}
+
+} // namespace
+
 GuidedDecoder::GuidedDecoder(executor::GuidedDecodingConfig const& guidedDecodingConfig, SizeType32 maxNumSequences,
     SizeType32 vocabSizePadded, nvinfer1::DataType logitsDtype, BufferManager const& runtimeBufferManager)
     : mGuidedDecodingBackend{guidedDecodingConfig.getBackend()}
@@ -61,23 +89,88 @@ GuidedDecoder::GuidedDecoder(executor::GuidedDecodingConfig const& guidedDecodin
             /*cache_enabled=*/true,
             /*cache_limit_bytes=*/static_cast<long long>(cacheLimitGb.value_or(1.0f) * 1024 * 1024 * 1024));
 
-        auto const logitsPtrDtype = BufferDataType{mLogitsDtype, false, true};
         auto constexpr bitmaskDtype = TRTDataType<BitmaskT>::value;
         auto constexpr bitmaskPtrDtype = TRTDataType<BitmaskT*>::value;
 
         mLogitsBitmask = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences, mBitmaskSize}), bitmaskDtype);
         mLogitsBitmaskHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences, mBitmaskSize}), bitmaskDtype);
-        mLogitsBitmaskPtrVec = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences}), bitmaskPtrDtype);
-        mLogitsBitmaskPtrVecHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), bitmaskPtrDtype);
-        mLogitsPtrVec = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences}), logitsPtrDtype);
-        mLogitsPtrVecHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), logitsPtrDtype);
+        mPtrTable = runtimeBufferManager.gpu(ITensor::makeShape({2, mMaxNumSequences}), bitmaskPtrDtype);
+        mPtrTableHost = BufferManager::pinned(ITensor::makeShape({2, mMaxNumSequences}), bitmaskPtrDtype);
+
+        mPrewarmFilePath = common::getEnvGuidedDecodingPrewarmFile();
+        if (!mPrewarmFilePath.empty())
+        {
+            prewarmFromFile(mPrewarmFilePath);
+        }
     }
 }
 
+void GuidedDecoder::prewarmFromFile(std::string const& filePath)
+{
+    std::ifstream file{filePath};
+    if (!file)
+    {
+        TLLM_LOG_INFO("Guided decoding pre-warm file %s does not exist yet; it will be created as guides arrive.",
+            filePath.c_str());
+        return;
+    }
+    SizeType32 numGuides{0};
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        try
+        {
+            auto const entry = nlohmann::json::parse(line);
+            auto const guideType
+                = static_cast<executor::GuidedDecodingParams::GuideType>(entry.at("guide_type").template get<int>());
+            auto const guide = entry.at("guide").template get<std::string>();
+            if (mSeenGuideHashes.insert(guideHash(guideType, guide)).second)
+            {
+                compileGrammar(
+                    *mXGrammarCompiler, guideType, guide.empty() ? std::nullopt : std::make_optional(guide));
+                ++numGuides;
+            }
+        }
+        catch (std::exception const& e)
+        {
+            TLLM_LOG_WARNING("Skipping malformed guided decoding pre-warm entry: %s", e.what());
+        }
+    }
+    TLLM_LOG_INFO("Pre-warmed guided decoding grammar cache with %d guides from %s.", numGuides, filePath.c_str());
+}
+
+void GuidedDecoder::recordPrewarmGuide(
+    executor::GuidedDecodingParams::GuideType guideType, std::optional<std::string> const& guide)
+{
+    auto const& guideStr = guide.value_or(std::string{});
+    std::lock_guard<std::mutex> lock{mPrewarmMutex};
+    if (!mSeenGuideHashes.insert(guideHash(guideType, guideStr)).second)
+    {
+        return;
+    }
+    std::ofstream file{mPrewarmFilePath, std::ios::app};
+    if (!file)
+    {
+        TLLM_LOG_WARNING(
+            "Failed to open guided decoding pre-warm file %s for appending.", mPrewarmFilePath.c_str());
+        return;
+    }
+    nlohmann::json entry;
+    entry["guide_type"] = static_cast<int>(guideType);
+    entry["guide"] = guideStr;
+    file << entry.dump() << '\n';
+}
+
 void GuidedDecoder::build(ScheduledRequests const& scheduledRequests)
 {
     if (mGuidedDecodingBackend == executor::GuidedDecodingConfig::GuidedDecodingBackend::kXGRAMMAR)
     {
+        // Requests whose bitmask needs to be rebuilt in this forward step.
+        RequestVector pendingRequests;
         for (auto const& requests : {scheduledRequests.contextRequests, scheduledRequests.generationRequests})
         {
             for (auto const& llmReq : requests)
@@ -87,91 +180,94 @@ void GuidedDecoder::build(ScheduledRequests const& scheduledRequests)
                 {
                     continue;
                 }
-                auto const seqSlot = llmReq->mSeqSlot.value();
                 if (llmReq->isContextInitState() && llmReq->isFirstContextChunk())
                 {
-                    // The request is in the first context forward step (considering kv cache reuse).
-                    auto const& guideType = guidedDecodingParams->getGuideType();
-                    auto const& guide = guidedDecodingParams->getGuide();
-                    switch (guideType)
-                    {
-                    case executor::GuidedDecodingParams::GuideType::kJSON:
+                    if (!mPrewarmFilePath.empty())
                     {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileBuiltinJSONGrammar());
-                        break;
-                    }
-                    case executor::GuidedDecodingParams::GuideType::kJSON_SCHEMA:
-                    {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileJSONSchema(guide.value()));
-                        break;
-                    }
-                    case executor::GuidedDecodingParams::GuideType::kREGEX:
-                    {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileRegex(guide.value()));
-                        break;
-                    }
-                    case executor::GuidedDecodingParams::GuideType::kEBNF_GRAMMAR:
-                    {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileGrammar(guide.value()));
-                        break;
-                    }
-                    case executor::GuidedDecodingParams::GuideType::kSTRUCTURAL_TAG:
-                    {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileStructuralTag(guide.value()));
-                        break;
-                    }
-                    default:
-                    {
-                        TLLM_THROW("Unsupported guide type.");
-                    }
+                        recordPrewarmGuide(guidedDecodingParams->getGuideType(), guidedDecodingParams->getGuide());
                     }
+                    pendingRequests.push_back(llmReq);
                 }
                 else if (llmReq->isGenerationInProgressState())
                 {
-                    // The request is in a generation forward step.
-                    // Currently, guided decoding does not support with beam search.
-                    mXGrammarMatchers.at(seqSlot)->AcceptToken(llmReq->getLastTokens(0));
+                    pendingRequests.push_back(llmReq);
                 }
-                else
-                {
-                    continue;
-                }
-
-                // Fill the bitmask on host and asynchorously copy to device using mCopyBufferManager.
-                auto const logitsBitmask = ITensor::at(mLogitsBitmask, {seqSlot});
-                auto const logitsBitmaskHost = ITensor::at(mLogitsBitmaskHost, {seqSlot});
+            }
+        }
 
-                std::array<int64_t, 1> bitmaskShape{mBitmaskSize};
-                DLTensor logitsBitmaskDlt{logitsBitmaskHost->data(), DLDevice{kDLCPU, 0}, 1, DLDataType{kDLInt, 32, 1},
-                    bitmaskShape.data(), nullptr, 0};
-                mXGrammarMatchers.at(seqSlot)->FillNextTokenBitmask(&logitsBitmaskDlt);
-                mCopyBufferManager.copy(*logitsBitmaskHost, *logitsBitmask);
+        // Each request owns its grammar matcher and its row of the pinned bitmask buffer, so mask construction
+        // for different requests is independent. Build the masks on worker threads so that for complex grammars
+        // the host-side construction fits within the kernel execution of the forward step instead of delaying
+        // the decoder step.
+        if (pendingRequests.size() > 1)
+        {
+            std::vector<std::future<void>> futures;
+            futures.reserve(pendingRequests.size());
+            for (auto const& llmReq : pendingRequests)
+            {
+                futures.emplace_back(
+                    std::async(std::launch::async, [this, &llmReq]() { this->buildBitmask(*llmReq); }));
+            }
+            for (auto& future : futures)
+            {
+                future.get();
             }
         }
+        else if (!pendingRequests.empty())
+        {
+            buildBitmask(*pendingRequests.front());
+        }
+
+        for (auto const& llmReq : pendingRequests)
+        {
+            // Asynchronously copy the bitmask to device using mCopyBufferManager.
+            auto const seqSlot = llmReq->mSeqSlot.value();
+            auto const logitsBitmask = ITensor::at(mLogitsBitmask, {seqSlot});
+            auto const logitsBitmaskHost = ITensor::at(mLogitsBitmaskHost, {seqSlot});
+            mCopyBufferManager.copy(*logitsBitmaskHost, *logitsBitmask);
+        }
     }
 }
 
+void GuidedDecoder::buildBitmask(LlmRequest& llmReq)
+{
+    auto const& guidedDecodingParams = llmReq.getGuidedDecodingParams();
+    auto const seqSlot = llmReq.mSeqSlot.value();
+    if (llmReq.isContextInitState())
+    {
+        // The request is in the first context forward step (considering kv cache reuse).
+        // Repeated guides hit the compiler's internal cache, so only novel schemas pay compilation cost here.
+        auto const& guideType = guidedDecodingParams->getGuideType();
+        auto const& guide = guidedDecodingParams->getGuide();
+        mXGrammarMatchers.at(seqSlot)
+            = std::make_shared<xgrammar::GrammarMatcher>(compileGrammar(*mXGrammarCompiler, guideType, guide));
+    }
+    else
+    {
+        // The request is in a generation forward step.
+        // Currently, guided decoding does not support with beam search.
+        mXGrammarMatchers.at(seqSlot)->AcceptToken(llmReq.getLastTokens(0));
+    }
+
+    // Fill the bitmask on host.
+    auto const logitsBitmaskHost = ITensor::at(mLogitsBitmaskHost, {seqSlot});
+    std::array<int64_t, 1> bitmaskShape{mBitmaskSize};
+    DLTensor logitsBitmaskDlt{logitsBitmaskHost->data(), DLDevice{kDLCPU, 0}, 1, DLDataType{kDLInt, 32, 1},
+        bitmaskShape.data(), nullptr, 0};
+    mXGrammarMatchers.at(seqSlot)->FillNextTokenBitmask(&logitsBitmaskDlt);
+}
+
 void GuidedDecoder::execute(DecoderInputBuffers const& decoderInputBuffers, BufferManager const& runtimeBufferManager)
 {
     auto const& stream = runtimeBufferManager.getStream();
 
-    // Wait for mCopyBufferManager finishing the H2D copy of logitsBitmask
-    // TODO(enweiz): Move the H2D copy of logitsBitmaskPtrVec to buildGuidedDecoding.
-    // This may not bring too much perf gain because of the small size of logitsBitmaskPtrVec.
-    // TODO(enweiz): For chunked context, we currently build mask cache at the first context chunk, and apply
-    // the mask at the last context chunk. So, ideally we should sync the stream at the last context chunk.
-    CudaEvent event{};
-    mCopyBufferManager.getStream().record(event);
-    stream.wait(event);
-
     if (mGuidedDecodingBackend == executor::GuidedDecodingConfig::GuidedDecodingBackend::kXGRAMMAR
         && !decoderInputBuffers.decoderRequests.empty())
     {
+        // Use void* to unify the code for different mLogitsDtype
+        auto* const logitsPtrsHost = reinterpret_cast<void**>(ITensor::at(mPtrTableHost, {0})->data());
+        auto* const bitmaskPtrsHost = reinterpret_cast<void**>(ITensor::at(mPtrTableHost, {1})->data());
+
         SizeType32 batchIdx{0};
         for (size_t requestIdx = 0; requestIdx < decoderInputBuffers.decoderRequests.size(); ++requestIdx)
         {
@@ -185,31 +281,37 @@ void GuidedDecoder::execute(DecoderInputBuffers const& decoderInputBuffers, Buff
                 auto const& logits = decoderInputBuffers.decoderLogits.at(requestIdx);
                 auto const logitsBitmask = ITensor::at(mLogitsBitmask, {seqSlot});
 
-                // Use void* to unify the code for different mLogitsDtype
-                *reinterpret_cast<void**>(ITensor::at(mLogitsPtrVecHost, {batchIdx})->data()) = logits->data();
-                *reinterpret_cast<void**>(ITensor::at(mLogitsBitmaskPtrVecHost, {batchIdx})->data())
-                    = logitsBitmask->data();
+                logitsPtrsHost[batchIdx] = logits->data();
+                bitmaskPtrsHost[batchIdx] = logitsBitmask->data();
 
                 ++batchIdx;
             }
         }
         if (batchIdx > 0)
         {
-            runtimeBufferManager.copy(
-                *ITensor::slice(mLogitsPtrVecHost, 0, batchIdx), *ITensor::slice(mLogitsPtrVec, 0, batchIdx));
-            runtimeBufferManager.copy(*ITensor::slice(mLogitsBitmaskPtrVecHost, 0, batchIdx),
-                *ITensor::slice(mLogitsBitmaskPtrVec, 0, batchIdx));
+            // Wait for mCopyBufferManager finishing the H2D copy of logitsBitmask. Steps without
+            // guided requests launch no kernel, so they skip this cross-stream sync entirely.
+            // TODO(enweiz): For chunked context, we currently build mask cache at the first context chunk, and apply
+            // the mask at the last context chunk. So, ideally we should sync the stream at the last context chunk.
+            CudaEvent event{};
+            mCopyBufferManager.getStream().record(event);
+            stream.wait(event);
+
+            // A single copy refreshes both pointer rows; the kernel only reads the first batchIdx
+            // entries of each row.
+            runtimeBufferManager.copy(*mPtrTableHost, *mPtrTable);
 
-            auto logitsBitmaskPtrVec = bufferCast<BitmaskT const*>(*mLogitsBitmaskPtrVec);
+            auto const logitsBitmaskPtrVec
+                = reinterpret_cast<BitmaskT const**>(ITensor::at(mPtrTable, {1})->data());
             if (mLogitsDtype == nvinfer1::DataType::kFLOAT)
             {
-                auto logitsPtrVec = bufferCast<float*>(*mLogitsPtrVec);
+                auto const logitsPtrVec = reinterpret_cast<float**>(ITensor::at(mPtrTable, {0})->data());
                 tensorrt_llm::kernels::invokeLogitsBitmask<float>(
                     logitsPtrVec, logitsBitmaskPtrVec, batchIdx, mVocabSizePadded, stream.get());
             }
             else if (mLogitsDtype == nvinfer1::DataType::kHALF)
             {
-                auto logitsPtrVec = bufferCast<half*>(*mLogitsPtrVec);
+                auto const logitsPtrVec = reinterpret_cast<half**>(ITensor::at(mPtrTable, {0})->data());
                 tensorrt_llm::kernels::invokeLogitsBitmask<half>(
                     logitsPtrVec, logitsBitmaskPtrVec, batchIdx, mVocabSizePadded, stream.get());
             }
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -21,6 +21,7 @@
 #include "tensorrt_llm/batch_manager/llmRequest.h"
 #include "tensorrt_llm/batch_manager/medusaBuffers.h"
 #include "tensorrt_llm/batch_manager/runtimeBuffers.h"
+#include "tensorrt_llm/batch_manager/utils/inflightBatchingUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/runtimeKernels.h"
@@ -70,12 +71,14 @@ void setupMedusaLogits(std::vector<TensorPtr>& medusaLogitsHeads, TensorPtr cons
 
 SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, RequestVector const& contextRequests,
     tr::ITensor::SharedPtr const& logits, std::vector<tr::SizeType32> const& numContextLogitsVec,
-    tr::ModelConfig const& modelConfig, tr::BufferManager const& manager,
-    OptionalRef<MedusaBuffers> medusaBuffers) const
+    tr::ModelConfig const& modelConfig, tr::BufferManager const& manager, OptionalRef<MedusaBuffers> medusaBuffers,
+    OptionalRef<tr::BufferManager const> copyManager) const
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(HandleContextLogits);
 
+    auto const& hostCopyManager = copyManager ? *copyManager : manager;
+
     auto& decoderRequests = inputBuffers.decoderRequests;
     decoderRequests.clear();
     decoderRequests.reserve(contextRequests.size());
@@ -114,7 +117,19 @@ SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, Re
                 TensorPtr contextLogitsHostView = ITensor::slice(
                     llmReq->getContextLogitsHost(), llmReq->getContextCurrentPosition(), numContextLogits);
                 // Copy to host directly
-                manager.copy(*contextLogitsDeviceView, *contextLogitsHostView);
+                hostCopyManager.copy(*contextLogitsDeviceView, *contextLogitsHostView);
+            }
+
+            if (llmReq->getReturnPromptLogprobs())
+            {
+                if (llmReq->getPrepopulatedPromptLen() > 0 && llmReq->isFirstContextChunk())
+                {
+                    TLLM_LOG_WARNING(
+                        "Because of KV cache reuse, not all prompt logprobs could be produced for request %lu.",
+                        llmReq->mRequestId);
+                }
+                TensorPtr chunkLogitsDeviceView = ITensor::slice(logits, logitsIndex, numContextLogits);
+                utils::computePromptLogprobs(chunkLogitsDeviceView, *llmReq, manager);
             }
         }
         logitsIndex += numContextLogits + draftLength;
@@ -137,12 +152,18 @@ SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, Re
         // save the accepted token logits from target model
         if (llmReq->getReturnGenerationLogits())
         {
-            copyLastContextLogits(logitsView, *llmReq, manager);
+            copyLastContextLogits(logitsView, *llmReq, hostCopyManager);
         }
 
         TLLM_CHECK_DEBUG_WITH_INFO(tru::tensorHasInvalid<float>(*logitsView, manager, "logits") == false,
             "Found invalid number (NaN or Inf) in logits");
 
+        // The first generated token is sampled from the last context token's logits.
+        if (llmReq->isLastContextChunk() && llmReq->getNumTopLogprobs() > 0)
+        {
+            utils::computeTopLogprobs(logitsView, *llmReq, 0, manager);
+        }
+
         if (llmReq->isLastContextChunk())
         {
             TensorPtr decoderLogits;
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -78,11 +78,13 @@ void setupMedusaLogits(std::vector<TensorPtr>& medusaLogitsHeads, TensorPtr cons
 void HandleGenerationLogits::operator()(DecoderInputBuffers& inputBuffers, RequestVector const& generationRequests,
     tr::ITensor::SharedPtr const& logits, tr::SizeType32 logitsIndex, tr::ModelConfig const& modelConfig,
     tr::BufferManager const& manager, OptionalRef<RuntimeBuffers> genRuntimeBuffers,
-    OptionalRef<MedusaBuffers> medusaBuffers) const
+    OptionalRef<MedusaBuffers> medusaBuffers, OptionalRef<tr::BufferManager const> copyManager) const
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(HandleGenerationLogits);
 
+    auto const& hostCopyManager = copyManager ? *copyManager : manager;
+
     auto& decoderRequests = inputBuffers.decoderRequests;
     decoderRequests.reserve(decoderRequests.size() + generationRequests.size());
     auto& allDecoderLogits = inputBuffers.decoderLogits;
@@ -108,6 +110,12 @@ void HandleGenerationLogits::operator()(DecoderInputBuffers& inputBuffers, Reque
         TLLM_CHECK_DEBUG_WITH_INFO(tru::tensorHasInvalid<float>(*logitsView, manager, "logits") == false,
             "Found invalid number (NaN or Inf) in logits");
 
+        if (llmReq->getNumTopLogprobs() > 0)
+        {
+            auto const numGenerationToken = llmReq->getMaxBeamNumTokens() - llmReq->mPromptLen;
+            utils::computeTopLogprobs(logitsView, *llmReq, numGenerationToken, manager);
+        }
+
         TLLM_CHECK(llmReq->isGenerationInProgressState());
         TensorPtr decoderLogits;
         if (reqBeamWidth > 1)
@@ -135,14 +143,15 @@ void HandleGenerationLogits::operator()(DecoderInputBuffers& inputBuffers, Reque
                 llmReq->getGenerationLogitsFragmentsSize() <= RuntimeBuffers::GenerationLogitsCache::kCACHE_LENGTH);
             if (llmReq->isStreaming())
             {
-                copyStreamingGenerationLogits(manager, *llmReq);
+                copyStreamingGenerationLogits(hostCopyManager, *llmReq);
             }
             // Copy back to host for every kCACHE_LENGTH steps to mitigate GPU memory pressure
             else if (llmReq->getGenerationLogitsFragmentsSize() == RuntimeBuffers::GenerationLogitsCache::kCACHE_LENGTH)
             {
                 TLLM_CHECK(genRuntimeBuffers);
                 auto constexpr beforeDecoder = true;
-                utils::copyGenerationLogits(genRuntimeBuffers->generationLogitsCache, manager, *llmReq, beforeDecoder);
+                utils::copyGenerationLogits(
+                    genRuntimeBuffers->generationLogitsCache, hostCopyManager, *llmReq, beforeDecoder);
             }
         }
         if (modelConfig.getSpeculativeDecodingMode().hasDraftLogits())
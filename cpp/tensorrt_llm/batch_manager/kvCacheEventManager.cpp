@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -177,11 +177,44 @@ void KVCacheEventManager::flush()
         return;
     }
 
-    std::unique_lock<std::mutex> lck(mPendingEventsMutex);
-    mPendingEvents.push_back(std::move(eventQueue));
+    auto const head = mPendingHead.load(std::memory_order_relaxed);
+    // Keep one slot of headroom so the producer never writes a slot the worker may still be reading.
+    auto tail = mPendingTail.load(std::memory_order_acquire);
+    while (head - tail >= kPendingRingSize - 1)
+    {
+        // Drop-oldest overflow policy: claim the tail slot away from the worker and discard it, so the
+        // forward pass thread never blocks on the event consumer.
+        if (mPendingTail.compare_exchange_weak(tail, tail + 1, std::memory_order_acq_rel))
+        {
+            auto& dropped = mPendingRing[tail % kPendingRingSize];
+            auto const numDropped
+                = mNumDroppedEvents.fetch_add(dropped.size(), std::memory_order_relaxed) + dropped.size();
+            dropped.clear();
+            TLLM_LOG_WARNING("The KV cache event ring is full. %lu events have been discarded in total.",
+                static_cast<unsigned long>(numDropped));
+            tail = mPendingTail.load(std::memory_order_acquire);
+        }
+    }
+    mPendingRing[head % kPendingRingSize] = std::move(eventQueue);
+    mPendingHead.store(head + 1, std::memory_order_release);
     mPendingEmptyCV.notify_one();
 }
 
+bool KVCacheEventManager::popPendingBatch(std::deque<tle::KVCacheEvent>& batch)
+{
+    auto tail = mPendingTail.load(std::memory_order_acquire);
+    while (tail != mPendingHead.load(std::memory_order_acquire))
+    {
+        // Claim the slot before reading it; flush() may concurrently claim it to drop the oldest batch.
+        if (mPendingTail.compare_exchange_weak(tail, tail + 1, std::memory_order_acq_rel))
+        {
+            batch = std::move(mPendingRing[tail % kPendingRingSize]);
+            return true;
+        }
+    }
+    return false;
+}
+
 void KVCacheEventManager::exchangeAttentionDpThread()
 {
 #if ENABLE_MULTI_DEVICE
@@ -255,15 +288,21 @@ void KVCacheEventManager::worker()
     while (true)
     {
         std::deque<tle::KVCacheEvent> events;
+        while (!popPendingBatch(events))
         {
-            std::unique_lock<std::mutex> pendingLock(mPendingEventsMutex);
-            mPendingEmptyCV.wait(pendingLock, [this] { return !mPendingEvents.empty() || !mRun; });
             if (!mRun)
             {
                 return;
             }
-            events = mPendingEvents.front();
-            mPendingEvents.pop_front();
+            // The producer notifies without holding the mutex, so a wakeup between the ring check and the
+            // sleep can be missed; bound the resulting latency with a periodic re-check.
+            std::unique_lock<std::mutex> wakeLock(mPendingWakeMutex);
+            mPendingEmptyCV.wait_for(wakeLock, std::chrono::milliseconds(10),
+                [this]
+                {
+                    return mPendingHead.load(std::memory_order_acquire) != mPendingTail.load(std::memory_order_acquire)
+                        || !mRun;
+                });
         }
 
         std::unique_lock<std::mutex> lck(mEventsMutex);
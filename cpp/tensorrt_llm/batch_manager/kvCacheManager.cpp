@@ -23,6 +23,7 @@
 #include "tensorrt_llm/batch_manager/radixBlockTree.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
 #include "tensorrt_llm/executor/executor.h"
@@ -39,6 +40,7 @@
 #include <map>
 #include <optional>
 #include <sstream>
+#include <thread>
 #include <utility>
 
 namespace tc = tensorrt_llm::common;
@@ -133,6 +135,7 @@ KVCacheBlock::KVCacheBlock(IdType blockId, tk::KVCacheIndex blockIdx, SizeType32
     , mDurationMs{std::nullopt}
     , mExpirationTime{std::nullopt}
     , mHash{0}
+    , mReuseCount{0}
 {
 }
 
@@ -283,6 +286,18 @@ void KVCacheBlock::setBlockKey(BlockKey const& blockKey, bool isFull)
 {
     mBlockKey = blockKey;
     mIsFull = isFull;
+    // New content: any reuse history belonged to the previous content.
+    mReuseCount = 0;
+}
+
+void KVCacheBlock::markReused()
+{
+    ++mReuseCount;
+}
+
+SizeType32 KVCacheBlock::getReuseCount() const
+{
+    return mReuseCount;
 }
 
 BlockKey KVCacheBlock::getBlockKey()
@@ -748,6 +763,8 @@ WindowBlockManager::WindowBlockManager(nvinfer1::DataType dtype, SizeType32 wind
     , mSchedulingNumFreeBlocks{0}
     , mTokensPerBlock{tokensPerBlock}
     , mIsSWA{isSWA}
+    , mRingBufferMode{isSWA && tc::getEnvKVCacheSWARingBuffer()}
+    , mEagerFreeOutOfWindow{isSWA && tc::getEnvKVCacheSWAEagerFree()}
     , mLookupTree{&lookupTree}
     // Use an out-of-range pool index for the dummy root block; it is never submitted to the GPU.
     // The illegal value (INT32_MAX) ensures accidental use triggers an obvious OOB failure.
@@ -764,6 +781,8 @@ WindowBlockManager::WindowBlockManager(nvinfer1::DataType dtype, SizeType32 wind
     , mReusedBlocks{0}
     , mReusedUniqueBlocks{0}
     , mMissedBlocks{0}
+    , mReuseLookupCount{0}
+    , mReuseHitDepthSum{0}
     , mGenAllocBlocks{0}
     , mKVFactor{(mCacheType == CacheType::kSELFKONLY
                     || (linearAttentionMetadata.has_value() && linearAttentionMetadata->hasRecurrentStatesCache()))
@@ -910,6 +929,7 @@ WindowBlockManager::~WindowBlockManager()
     TLLM_LOG_DEBUG(
         "%s - reused unique blocks percentage (%%): %.2f ", mLogPrefix.c_str(), reusedUniqueBlocksPercentage);
     TLLM_LOG_DEBUG("%s - cache hit rate:                      %.2f ", mLogPrefix.c_str(), cacheHitRate);
+    TLLM_LOG_DEBUG("%s - avg reuse hit depth (blocks):        %.2f ", mLogPrefix.c_str(), getAvgReuseHitDepth());
     TLLM_LOG_DEBUG("%s - reused tokens:                       %.0f ", mLogPrefix.c_str(), mReusedTokens);
     TLLM_LOG_DEBUG("%s - reused tokens percentage (%%):        %.2f ", mLogPrefix.c_str(),
         100.0 * mReusedTokens / mTotalInputTokens);
@@ -1019,11 +1039,8 @@ void WindowBlockManager::allocatePools(bool useUvm)
 {
     constexpr nvinfer1::DataType kScaleDtypeNVFP4 = nvinfer1::DataType::kFP8;
 
-    // Allocate a memory pool backing the blocks for each numKvHeads
-    // TODO(oargov): allocate pools in a single buffer and split it, to avoid fragmentation
-    for (auto& pool : mPools)
+    auto const poolCacheDtype = [this](KVCacheBlockPool const& pool)
     {
-        auto blockSize = pool.blockSize;
         auto poolDtype = pool.containsBlockScales ? kScaleDtypeNVFP4 : mDataType;
 #ifdef ENABLE_FP4
         auto const poolIsFP4 = poolDtype == nvinfer1::DataType::kFP4;
@@ -1039,10 +1056,47 @@ void WindowBlockManager::allocatePools(bool useUvm)
         {
             poolDtype = nvinfer1::DataType::kUINT8;
         }
+        return poolDtype;
+    };
+
+    // Page-locking the secondary (host) pools is CPU-bound and can take seconds for large offload capacities, so
+    // run it on a separate thread concurrently with the primary device allocations.
+    std::thread secondaryAllocThread;
+    std::exception_ptr secondaryAllocException;
+    if (mNumSecondaryBlocks > 0)
+    {
+        secondaryAllocThread = std::thread(
+            [this, &poolCacheDtype, &secondaryAllocException, device = mBufferManager.getStream().getDevice()]
+            {
+                try
+                {
+                    TLLM_CUDA_CHECK(cudaSetDevice(device));
+                    for (auto& pool : mPools)
+                    {
+                        nvinfer1::Dims cacheShapeOffload = isRecurrentState()
+                            ? ITensor::makeShape({pool.numLayers, mNumSecondaryBlocks, mKVFactor, pool.blockSize})
+                            : ITensor::makeShape({mNumSecondaryBlocks, pool.numLayers, mKVFactor, pool.blockSize});
+                        TLLM_LOG_DEBUG("[%s] Allocating secondary pool with %d blocks for %d layers with %d kv heads",
+                            mLogPrefix.c_str(), mNumSecondaryBlocks, pool.numLayers, pool.numKvHeads);
+                        pool.secondaryPtr = BufferManager::pinned(cacheShapeOffload, poolCacheDtype(pool));
+                    }
+                }
+                catch (...)
+                {
+                    secondaryAllocException = std::current_exception();
+                }
+            });
+    }
+
+    // Allocate a memory pool backing the blocks for each numKvHeads
+    // TODO(oargov): allocate pools in a single buffer and split it, to avoid fragmentation
+    for (auto& pool : mPools)
+    {
+        auto const poolDtype = poolCacheDtype(pool);
 
         nvinfer1::Dims cacheShape = isRecurrentState()
-            ? ITensor::makeShape({pool.numLayers, mNumPrimaryBlocks, mKVFactor, blockSize})
-            : ITensor::makeShape({mNumPrimaryBlocks, pool.numLayers, mKVFactor, blockSize});
+            ? ITensor::makeShape({pool.numLayers, mNumPrimaryBlocks, mKVFactor, pool.blockSize})
+            : ITensor::makeShape({mNumPrimaryBlocks, pool.numLayers, mKVFactor, pool.blockSize});
         pool.layerFirstLayout = isRecurrentState();
 
         TLLM_LOG_DEBUG(
@@ -1054,14 +1108,14 @@ void WindowBlockManager::allocatePools(bool useUvm)
             pool.primaryPtr = BufferManager::managed(cacheShape, poolDtype);
         else
             pool.primaryPtr = mBufferManager.gpuSync(cacheShape, poolDtype);
-        if (mNumSecondaryBlocks > 0)
+    }
+
+    if (secondaryAllocThread.joinable())
+    {
+        secondaryAllocThread.join();
+        if (secondaryAllocException)
         {
-            nvinfer1::Dims cacheShapeOffload = isRecurrentState()
-                ? ITensor::makeShape({pool.numLayers, mNumSecondaryBlocks, mKVFactor, blockSize})
-                : ITensor::makeShape({mNumSecondaryBlocks, pool.numLayers, mKVFactor, blockSize});
-            TLLM_LOG_DEBUG("[%s] Allocating secondary pool with %d blocks for %d layers with %d kv heads",
-                mLogPrefix.c_str(), mNumSecondaryBlocks, pool.numLayers, pool.numKvHeads);
-            pool.secondaryPtr = BufferManager::pinned(cacheShapeOffload, poolDtype);
+            std::rethrow_exception(secondaryAllocException);
         }
     }
 }
@@ -1145,7 +1199,9 @@ BlockPtr WindowBlockManager::getFreeBlock(GenerationRequest& sequence, executor:
     // 1. Block contains state (evidenced by presence of tokens)
     // 2. Eviction policy indicated block can be offloaded
     // 3. At least one free block in secondary memory
-    if (!wantPlaceholder && !block->getUniqueTokens().empty() && canOffload
+    // 4. The layer group retains evicted content (sliding-window groups under the eager-free policy
+    //    mostly evict out-of-window blocks whose content their layers never read again)
+    if (!wantPlaceholder && !mEagerFreeOutOfWindow && !block->getUniqueTokens().empty() && canOffload
         && mEvictionPolicy->getNumFreeBlocks(kSecondaryLevel) > 0)
     {
         // Offload block in primary memory before repurposing
@@ -1411,10 +1467,13 @@ WindowBlockManager::ClaimResult WindowBlockManager::claimMatchingBlocks(Generati
     // NOTE: Caller must hold mCachedBlocksRootMutex.
 
     // Compute shareLastContextBlockAmongBeams — aligned with loadOrAllocateBlocks (PR #10437).
+    // All context blocks are shared among beams copy-on-write: a partially filled last block stays shared until
+    // the beams diverge at the first generation token, when adjustBlocksIfNeeded splits it into per-beam copies.
+    // Recurrent-state (linear attention) caches keep per-beam last blocks since they hold per-beam states.
     auto const beamWidth = sequence.getBeamWidth();
     bool const isShareLastContextBlock = mCacheType == CacheType::kCROSS || inputLength % mTokensPerBlock == 0;
     result.numSharedContextBlocks
-        = (beamWidth > 1 && !isShareLastContextBlock) ? numContextBlocks - 1 : numContextBlocks;
+        = (isRecurrentState() && beamWidth > 1 && !isShareLastContextBlock) ? numContextBlocks - 1 : numContextBlocks;
     result.shareLastContextBlockAmongBeams = result.numSharedContextBlocks == numContextBlocks;
     auto searchRoot = mCachedBlocksRoot;
     auto blockItr = result.blockKeys.begin();
@@ -1635,6 +1694,7 @@ SizeType32 WindowBlockManager::onboardAndAllocateBlocks(
         addBlockToAllBeams(claimed.block, sequence);
         if (!claimed.isPlaceholder)
         {
+            claimed.block->markReused();
             ++mReusedBlocks;
             if (claimed.isPartialMatch)
             {
@@ -1654,6 +1714,10 @@ SizeType32 WindowBlockManager::onboardAndAllocateBlocks(
         ++bi;
     }
 
+    // Track reuse hit depth: number of leading context blocks served from cache for this lookup.
+    ++mReuseLookupCount;
+    mReuseHitDepthSum += bi;
+
     // Allocate non-matching shared context blocks
     for (; bi < claimResult.numSharedContextBlocks; ++bi)
     {
@@ -1807,11 +1871,12 @@ WindowBlockManager::ClaimResult WindowBlockManager::buildClaimResultMetadata(
 
     TLLM_CHECK(result.perBlockRetentions.size() == static_cast<size_t>(numContextBlocks));
 
-    // Use unified isShareLastContextBlock formula (aligned with PR #10437)
+    // Use unified isShareLastContextBlock formula (aligned with PR #10437). As in prepareClaim, only
+    // recurrent-state caches allocate a per-beam last block up front; otherwise it is shared copy-on-write.
     bool const isShareLastContextBlock = mCacheType == CacheType::kCROSS || inputLength % mTokensPerBlock == 0;
     auto const beamWidth = sequence.getBeamWidth();
     result.numSharedContextBlocks
-        = (beamWidth > 1 && !isShareLastContextBlock) ? numContextBlocks - 1 : numContextBlocks;
+        = (isRecurrentState() && beamWidth > 1 && !isShareLastContextBlock) ? numContextBlocks - 1 : numContextBlocks;
     result.shareLastContextBlockAmongBeams = result.numSharedContextBlocks == numContextBlocks;
 
     return result;
@@ -1892,6 +1957,7 @@ std::shared_ptr<KVCacheBlock> WindowBlockManager::findBlocksInReuseTreeByBlockKe
     {
         blockKeys.push_back(blockKey);
         blockKeys.back().uniqueTokens = blockedUniqueTokensList;
+        blockKeys.back().invalidateHashMemo();
     }
     return searchReuseTree(blockKeys);
 }
@@ -1933,12 +1999,13 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
     auto searchRoot = mCachedBlocksRoot;
     std::set<KVCacheBlock::IdType> reusedBlockIds;
 
-    // The last block can be shared between beams if it is fully filled (won't be written to during generation)
-    // or if this is cross-attention KV cache (read-only). Otherwise, allocate a unique block per beam.
+    // All context blocks are shared among beams copy-on-write: a partially filled last block stays shared until
+    // the beams diverge at the first generation token, when adjustBlocksIfNeeded splits it into per-beam copies.
+    // Recurrent-state (linear attention) caches keep per-beam last blocks since they hold per-beam states.
     auto const beamWidth = sequence.getBeamWidth();
     bool const isShareLastContextBlock = mCacheType == CacheType::kCROSS || inputLength % mTokensPerBlock == 0;
     SizeType32 numSharedContextBlocks
-        = (beamWidth > 1 && !isShareLastContextBlock) ? numContextBlocks - 1 : numContextBlocks;
+        = (isRecurrentState() && beamWidth > 1 && !isShareLastContextBlock) ? numContextBlocks - 1 : numContextBlocks;
 
     auto blockItr = blockKeys.begin();
     for (int bi = 0; bi < numSharedContextBlocks; ++bi)
@@ -2011,6 +2078,7 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
             addBlockToAllBeams(matchingBlock, sequence);
             if (!matchingBlock->isPlaceholder())
             {
+                matchingBlock->markReused();
                 // TODO: only add once for reused blocks
                 ++mReusedBlocks;
                 if (!reusedBlockIds.count(matchingBlockId))
@@ -2137,9 +2205,62 @@ void BlockManager::refreshBlocks()
 void WindowBlockManager::refreshBlocks()
 {
     mEvictionPolicy->refresh();
+    auto const compactionBudget = tc::getEnvKVCacheCompactionBlocksPerIteration();
+    if (compactionBudget > 0)
+    {
+        compactPrimaryFreeBlocks(compactionBudget);
+    }
     mTransferManager->syncTransfers();
 }
 
+void WindowBlockManager::compactPrimaryFreeBlocks(SizeType32 maxBlocks)
+{
+    // Proactively offload cold reusable blocks out of primary memory so that admission-time getFreeBlock calls
+    // find stateless primary blocks without performing synchronous copies on the critical path. The transfer
+    // manager schedules the copies on its own offload stream; the per-iteration block budget bounds how much
+    // copy-engine bandwidth the pass may take away from the forward pass.
+    if (mEagerFreeOutOfWindow)
+    {
+        // This layer group does not retain evicted content in secondary memory; see getFreeBlock.
+        return;
+    }
+    for (SizeType32 i = 0; i < maxBlocks; ++i)
+    {
+        if (mEvictionPolicy->getNumFreeBlocks(kPrimaryLevel) == 0
+            || mEvictionPolicy->getNumFreeBlocks(kSecondaryLevel) == 0)
+        {
+            break;
+        }
+        auto [block, canOffload] = mEvictionPolicy->getFreeBlock(kPrimaryLevel);
+        if (block->getUniqueTokens().empty() || !canOffload)
+        {
+            // Coldest candidate carries no reusable state (or must not be offloaded): nothing left worth
+            // compacting. Re-release at the front so its eviction order is unchanged.
+            mEvictionPolicy->claimBlock(block);
+            mEvictionPolicy->releaseBlock(block, /*toFront=*/true);
+            break;
+        }
+        auto offloadBlock = std::get<0>(mEvictionPolicy->getFreeBlock(kSecondaryLevel));
+        mTransferManager->offload(block, offloadBlock, mPools, 0, executor::KvCacheTransferMode::DRAM, "");
+        // Swap linear block offsets (i.e. make block the offload block)
+        block->swapMemoryPoolBlockOffset(offloadBlock);
+        if (mEventManager && blockInRadixTree(block))
+        {
+            mEventManager->enqueueUpdatedEvent(
+                tle::KVCacheUpdatedData(block->getHash()).cacheLevelUpdated(kPrimaryLevel, kSecondaryLevel),
+                mWindowSize);
+        }
+        // Re-file both blocks at their new levels: the cold block is now secondary-backed, and the previously
+        // free secondary block is now a stateless primary block.
+        mEvictionPolicy->claimBlock(block);
+        mEvictionPolicy->releaseBlock(block);
+        mEvictionPolicy->claimBlock(offloadBlock);
+        mEvictionPolicy->releaseBlock(offloadBlock);
+        TLLM_LOG_DEBUG("%s::compactPrimaryFreeBlocks - Offloaded cold block %d to secondary memory",
+            mLogPrefix.c_str(), block->getBlockId());
+    }
+}
+
 SizeType32 BlockManager::addSequence(GenerationRequest& sequence, SizeType32 inputLength, SizeType32 numContextBlocks,
     LlmRequest& llmRequest, SizeType32 windowSize, bool isEnableBlockReuse)
 {
@@ -2244,7 +2365,25 @@ void BlockManager::adjustBlocksIfNeeded(GenerationRequest& sequence)
 void WindowBlockManager::adjustBlocksIfNeeded(GenerationRequest& sequence)
 {
     auto const minTokensForBlockDetach = mWindowSize + mTokensPerBlock;
-    while (mIsSWA && // A block only go out-of-window in SWA
+    auto const hasBlockOutOfWindow = [this, &sequence]
+    {
+        return sequence.getNumTokens()
+            - (sequence.getNumFrontBlocksRemoved() + mNumSinkBlocks) * getTokensPerBlock()
+            >= mWindowSize + mTokensPerBlock;
+    };
+    bool const needsNewBlock = (sequence.getNumTokens() - 1) % getTokensPerBlock() == 0;
+
+    if (mRingBufferMode && needsNewBlock && hasBlockOutOfWindow() && sequence.getBeamWidth() == 1)
+    {
+        // Ring-buffer mode: reuse the out-of-window block in place as the new
+        // last block instead of detaching it and allocating a fresh one. No
+        // block churn once the window is full; sink blocks stay pinned.
+        recycleFrontBlock(sequence);
+        updateLastCacheBlockOffsets(sequence);
+        return;
+    }
+
+    while (mIsSWA && !mRingBufferMode && // A block only go out-of-window in SWA
         (sequence.getNumTokens() - sequence.getNumFrontBlocksRemoved() * getTokensPerBlock()
             >= minTokensForBlockDetach))
     {
@@ -2253,13 +2392,34 @@ void WindowBlockManager::adjustBlocksIfNeeded(GenerationRequest& sequence)
         detachFrontBlock(sequence);
     }
 
-    if ((sequence.getNumTokens() - 1) % getTokensPerBlock() == 0)
+    if (needsNewBlock)
     {
         // Allocating a new block when the last token is a block boundary
         allocateBlock(sequence, /*shareAmongBeams=*/sequence.getBeamWidth() == 1);
         ++mGenAllocBlocks;
         updateLastCacheBlockOffsets(sequence);
     }
+    else if (sequence.getBeamWidth() > 1 && !isRecurrentState())
+    {
+        // Copy-on-write divergence: the new token is written into the last block, which is still shared among
+        // beams if it was a partially filled context block. Split it into per-beam copies now.
+        auto const& beamBlockIds = sequence.getCacheBlockIds(mWindowSize);
+        auto const lastBlockId = beamBlockIds.at(0).back();
+        bool isLastBlockSharedAmongBeams = true;
+        for (SizeType32 beamIdx = 1; beamIdx < sequence.getBeamWidth(); ++beamIdx)
+        {
+            if (beamBlockIds.at(beamIdx).back() != lastBlockId)
+            {
+                isLastBlockSharedAmongBeams = false;
+                break;
+            }
+        }
+        if (isLastBlockSharedAmongBeams)
+        {
+            replaceSharedBlock(sequence, static_cast<SizeType32>(beamBlockIds.at(0).size()) - 1);
+            updateLastCacheBlockOffsets(sequence);
+        }
+    }
 }
 
 void WindowBlockManager::addBlockToBeam(BlockPtr const& block, GenerationRequest& sequence, SizeType32 beamIdx)
@@ -2655,40 +2815,43 @@ void WindowBlockManager::replaceSharedBlock(GenerationRequest& sequence, SizeTyp
     {
         return;
     }
-    BlockKey blockKey = allocatedBlocks.at(blockIdx * beamWidth)->getBlockKey();
-    bool isFull = allocatedBlocks.at(blockIdx * beamWidth)->isFull();
+    auto const sharedBlock = allocatedBlocks.at(blockIdx * beamWidth);
+    BlockKey blockKey = sharedBlock->getBlockKey();
+    bool isFull = sharedBlock->isFull();
 
-    // Free shared block
-    for (auto beamIdx = 0; beamIdx < beamWidth; ++beamIdx)
-    {
-        auto block = allocatedBlocks.at(blockIdx * beamWidth + beamIdx);
-        block->decRefCount();
-        if (!block->hasRefs())
-        {
-            mEvictionPolicy->releaseBlock(block);
-        }
-    }
-
-    // Allocate new blocks
+    // Allocate per-beam copies and populate them from the shared block before releasing it, so every beam keeps
+    // the common history written so far.
     TLLM_CHECK_WITH_INFO(hasFreeBlocks(beamWidth), "Can't allocate new blocks. No free blocks left.");
     for (auto beamIdx = 0; beamIdx < beamWidth; ++beamIdx)
     {
         auto block = getFreeBlock(sequence, executor::KvCacheRetentionConfig::kDefaultRetentionPriority, std::nullopt,
             sequence.getTransferMode(), sequence.getDirectory());
+        mTransferManager->onboard(
+            sharedBlock, block, mPools, mTokensPerBlock, sequence.getTransferMode(), sequence.getDirectory());
         block->incRefCount();
-        if (sequence.getCacheBlockIds(mWindowSize).at(beamIdx).size() == 0)
+        if (blockIdx == 0)
         {
             block->setPrevBlockInSeq(nullptr);
         }
         else
         {
-            block->setPrevBlockInSeq(getBlockById(sequence.getCacheBlockIds(mWindowSize)[beamIdx].back()));
+            block->setPrevBlockInSeq(getBlockById(sequence.getCacheBlockIds(mWindowSize)[beamIdx].at(blockIdx - 1)));
         }
         block->setBlockKey(blockKey, isFull);
         block->setHash();
         sequence.changeCacheBlock(mWindowSize, beamIdx, blockIdx, block->getBlockId());
         allocatedBlocks.at(blockIdx * beamWidth + beamIdx) = block;
     }
+
+    // Release the shared block; its content lives on in the per-beam copies.
+    for (auto beamIdx = 0; beamIdx < beamWidth; ++beamIdx)
+    {
+        sharedBlock->decRefCount();
+    }
+    if (!sharedBlock->hasRefs())
+    {
+        mEvictionPolicy->releaseBlock(sharedBlock);
+    }
 }
 
 void BlockManager::releaseLastBlock(GenerationRequest& sequence, SizeType32 windowSize)
@@ -3138,6 +3301,8 @@ KVCacheManager::KVCacheManager(std::vector<SizeType32> const& numKvHeadsPerLayer
     // we fill that block with a "bubble" to reach the number of tokens per block.
 
     TLLM_CHECK(mSinkBlockTokenLength % tokensPerBlock == 0);
+    // Pin the attention-sink blocks in ring-buffer mode (always 0 until streamLLM is supported).
+    mBlockManager.setNumSinkBlocks(mSinkBlockTokenLength / tokensPerBlock);
     TLLM_LOG_DEBUG("KV cache block reuse is %s", mEnableBlockReuse ? "enabled" : "disabled");
     mSequences.reserve(maxNumSequences);
 }
@@ -3265,8 +3430,13 @@ SizeType32 KVCacheManager::getNeededBlocksOneStep(LlmRequest const& req, bool tw
             + mSinkBubbleLength;
         auto const numSharedBlocks = promptCacheLen / getTokensPerBlock();
         auto const numUnSharedTokens = promptCacheLen % getTokensPerBlock();
-        auto const numUnSharedBlocks
-            = tc::ceilDiv(numUnSharedTokens, getTokensPerBlock()) * req.mSamplingConfig.beamWidth;
+        // The partially filled last context block is also shared among beams; it is only split into per-beam
+        // copies when beams diverge at the first generation token. Recurrent-state windows keep per-beam last
+        // blocks since they hold per-beam states.
+        auto const lastContextBlockBeams = windowSize == LinearAttentionMetadata::kRecurrentStates
+            ? req.mSamplingConfig.beamWidth
+            : SizeType32{1};
+        auto const numUnSharedBlocks = tc::ceilDiv(numUnSharedTokens, getTokensPerBlock()) * lastContextBlockBeams;
         auto numRequiredBlocks = numSharedBlocks + numUnSharedBlocks;
 
         // Subtract reusable blocks if block reuse is enabled and we're not using variable window attention
@@ -3314,7 +3484,13 @@ SizeType32 KVCacheManager::getNeededBlocksOneStep(LlmRequest const& req, bool tw
 
         auto const numCurrBlocks = tc::ceilDiv(numCurrTokens, getTokensPerBlock());
         auto const numNextBlocks = tc::ceilDiv(numNextTokens, getTokensPerBlock());
-        auto const numRequiredBlocks = (numNextBlocks - numCurrBlocks) * req.mSamplingConfig.beamWidth;
+        auto numRequiredBlocks = (numNextBlocks - numCurrBlocks) * req.mSamplingConfig.beamWidth;
+        if (req.mSamplingConfig.beamWidth > 1 && generatedTokens == 0 && numCurrTokens % getTokensPerBlock() != 0
+            && windowSize != LinearAttentionMetadata::kRecurrentStates)
+        {
+            // The first generation step splits the shared partial context block into per-beam copies.
+            numRequiredBlocks += req.mSamplingConfig.beamWidth;
+        }
         return numRequiredBlocks;
     }
 
@@ -3362,14 +3538,30 @@ SizeType32 KVCacheManager::getRemainingBlocksToCompletion(
 
     auto const temporaryAttentionWindow = mBlockManager.getWindowSizeMetadata(windowSize).temporaryAttentionWindow;
 
-    SizeType32 const numContextBlocks
-        = (std::min(req.mPromptLen, windowSize + temporaryAttentionWindow) + mSinkBubbleLength) / getTokensPerBlock();
+    // With speculative decoding, up to getNumDraftTokens() draft tokens occupy KV cache alongside
+    // the accepted ones on every step until verification rewinds them, so the peak footprint
+    // exceeds promptLen + maxNewTokens by that amount. Ignoring it overcommits the block budget
+    // and turns into preemptions once the draft lanes materialize.
+    SizeType32 const maxSequenceLength = req.mPromptLen + req.mMaxNewTokens + req.getNumDraftTokens();
+
+    SizeType32 const numContextTokens
+        = std::min(req.mPromptLen, windowSize + temporaryAttentionWindow) + mSinkBubbleLength;
+    SizeType32 const numContextBlocks = numContextTokens / getTokensPerBlock();
 
     SizeType32 const numTotalBlocksPerBeam = tc::ceilDiv(
-        std::min(req.mPromptLen + req.mMaxNewTokens, windowSize + temporaryAttentionWindow) + mSinkBubbleLength,
-        getTokensPerBlock());
+        std::min(maxSequenceLength, windowSize + temporaryAttentionWindow) + mSinkBubbleLength, getTokensPerBlock());
+
+    // The partially filled last context block is shared among beams and only split into per-beam copies when
+    // beams diverge at the first generation token. Recurrent-state windows keep per-beam last blocks since
+    // they hold per-beam states.
+    auto const beamWidth = req.mSamplingConfig.beamWidth;
+    bool const sharePartialContextBlock = numContextTokens % getTokensPerBlock() != 0
+        && windowSize != LinearAttentionMetadata::kRecurrentStates;
+    SizeType32 const numSharedContextBlocks = numContextBlocks + (sharePartialContextBlock ? 1 : 0);
+    SizeType32 const numSplitBlocks
+        = sharePartialContextBlock && beamWidth > 1 && req.getMaxBeamNumTokens() == req.mPromptLen ? beamWidth : 0;
 
-    SizeType32 const numGenBlocksPerBeam = numTotalBlocksPerBeam - numContextBlocks;
+    SizeType32 const numGenBlocksPerBeam = numTotalBlocksPerBeam - numSharedContextBlocks;
 
     SizeType32 numAllocBlocksPerBeam = 0;
     {
@@ -3416,25 +3608,25 @@ SizeType32 KVCacheManager::getRemainingBlocksToCompletion(
     // need an extra block for generation if the diff between the max sequence
     // length and the current sequence length crosses both a block boundary
     // and a window boundary.
-    auto const isSlidingWindow = (req.mPromptLen + req.mMaxNewTokens) > windowSize;
+    auto const isSlidingWindow = maxSequenceLength > windowSize;
     SizeType32 const currentSeqlenInBlocks = tc::ceilDiv(req.getNumTokens(0), getTokensPerBlock());
-    SizeType32 const maxSeqlenInBlocks = tc::ceilDiv(req.mPromptLen + req.mMaxNewTokens, getTokensPerBlock());
+    SizeType32 const maxSeqlenInBlocks = tc::ceilDiv(maxSequenceLength, getTokensPerBlock());
     auto const willCrossBlockBoundary = maxSeqlenInBlocks > currentSeqlenInBlocks;
     auto const willCrossWindowBlockBoundary = maxSeqlenInBlocks > numTotalBlocksPerBeam;
     SizeType32 numExtraBlocksPerBeam
         = isSlidingWindow && willCrossBlockBoundary && willCrossWindowBlockBoundary ? 1 : 0;
 
     // Adjust for reusable context blocks (only allocated ones)
-    SizeType32 const effectiveContextBlocks = numContextBlocks - numReusableContextBlocks;
+    SizeType32 const effectiveContextBlocks = numSharedContextBlocks - numReusableContextBlocks;
 
     if (numAllocBlocksPerBeam < effectiveContextBlocks) // Still haven't allocated all context blocks
     {
-        return effectiveContextBlocks - numAllocBlocksPerBeam
-            + (numGenBlocksPerBeam + numExtraBlocksPerBeam) * req.mSamplingConfig.beamWidth;
+        return effectiveContextBlocks - numAllocBlocksPerBeam + numSplitBlocks
+            + (numGenBlocksPerBeam + numExtraBlocksPerBeam) * beamWidth;
     }
 
     SizeType32 const effectiveTotalBlocks = numTotalBlocksPerBeam - numReusableContextBlocks;
-    return (effectiveTotalBlocks - numAllocBlocksPerBeam + numExtraBlocksPerBeam) * req.mSamplingConfig.beamWidth;
+    return (effectiveTotalBlocks - numAllocBlocksPerBeam + numExtraBlocksPerBeam) * beamWidth + numSplitBlocks;
 }
 
 void BlockManager::updateSequenceCacheBlockOffsets(GenerationRequest& sequence, SizeType32 windowSize)
@@ -3455,6 +3647,7 @@ void BlockManager::updateSequenceCacheBlockOffsets(GenerationRequest& sequence,
             mWindowBlockManagers.at(windowSize).setOffsets(offsetsPtr, offsetsShape, beamIdx, blockIdx, blockId);
         }
     }
+    sequence.bumpBlockOffsetsVersion();
 }
 
 void WindowBlockManager::updateLastCacheBlockOffsets(GenerationRequest& sequence)
@@ -3473,6 +3666,7 @@ void WindowBlockManager::updateLastCacheBlockOffsets(GenerationRequest& sequence
         auto const blockIdx = static_cast<SizeType32>(beamCacheBlock.size() - 1);
         setOffsets(offsetsPtr, offsetsShape, beamIdx, blockIdx, blockId);
     }
+    sequence.bumpBlockOffsetsVersion();
 }
 
 void BlockManager::updateCacheBlockOffsetsAtIdx(GenerationRequest& sequence, SizeType32 windowSize, SizeType32 blockIdx)
@@ -3490,6 +3684,7 @@ void BlockManager::updateCacheBlockOffsetsAtIdx(GenerationRequest& sequence, Siz
         auto const blockId = beamCacheBlock.at(blockIdx);
         mWindowBlockManagers.at(windowSize).setOffsets(offsetsPtr, offsetsShape, beamIdx, blockIdx, blockId);
     }
+    sequence.bumpBlockOffsetsVersion();
 }
 
 void KVCacheManager::addToken(RequestIdType requestId)
@@ -3534,7 +3729,10 @@ void WindowBlockManager::detachFrontBlock(GenerationRequest& sequence)
         }
         if (!outOfWindowBlock->hasRefs())
         {
-            mEvictionPolicy->releaseBlock(outOfWindowBlock);
+            // Under the eager-free policy the content is dead for this layer group, so the block goes to the
+            // front of the free queue and is reclaimed before content-bearing blocks. Otherwise it is appended
+            // as usual and remains available for reuse by shorter shared-prefix requests.
+            mEvictionPolicy->releaseBlock(outOfWindowBlock, /*toFront=*/mEagerFreeOutOfWindow);
         }
     }
 
@@ -3542,19 +3740,87 @@ void WindowBlockManager::detachFrontBlock(GenerationRequest& sequence)
     sequence.removeFrontBlock(mWindowSize);
 }
 
+void WindowBlockManager::recycleFrontBlock(GenerationRequest& sequence)
+{
+    TLLM_CHECK_WITH_INFO(
+        sequence.getBeamWidth() == 1, "[kv cache manager] recycleFrontBlock does not support beamWidth > 1 now.");
+
+    auto const requestId = sequence.getRequestId();
+    auto& allocatedBlocks = mAllocatedBlocksPerSeq.at(requestId);
+    SizeType32 const outOfWindowBlockIdx = mNumSinkBlocks + sequence.getNumFrontBlocksRemoved();
+    auto outOfWindowBlock = allocatedBlocks.at(outOfWindowBlockIdx);
+
+    TLLM_LOG_DEBUG("%s::recycleFrontBlock - Reusing out-of-window block %d in place for sequence %lu",
+        mLogPrefix.c_str(), outOfWindowBlock->getBlockId(), requestId);
+
+    // The physical block keeps its single reference; only its logical position in
+    // the sequence changes. The front entry stays in mAllocatedBlocksPerSeq and is
+    // skipped on release via getNumFrontBlocksRemoved(), so the re-appended entry
+    // releases the block exactly once.
+    outOfWindowBlock->setPrevBlockInSeq(allocatedBlocks.back());
+    sequence.addCacheBlock(mWindowSize, /*beamIdx=*/0, outOfWindowBlock->getBlockId());
+    allocatedBlocks.push_back(outOfWindowBlock);
+    sequence.removeFrontBlock(mWindowSize);
+
+    // The recycled block's contents are overwritten in place, so this sequence
+    // must not store its blocks into the reuse tree on release.
+    mIsValidStoreForReuseSequence[requestId] = false;
+}
+
 PrefixReuseSummary KVCacheManager::analyzePrefixReuse(
     VecUniqueTokens const& uniqueTokens, LlmRequest const& llmRequest) const
 {
     return mBlockManager.analyzePrefixReuse(uniqueTokens, llmRequest);
 }
 
+executor::KvCacheRetentionConfig KVCacheManager::applySessionReservation(executor::KvCacheRetentionConfig config)
+{
+    auto const sessionId = config.getSessionId();
+    if (!sessionId.has_value())
+    {
+        return config;
+    }
+
+    auto const now = std::chrono::steady_clock::now();
+    // Drop reservations whose TTL elapsed without a continuation turn.
+    for (auto it = mSessionReservations.begin(); it != mSessionReservations.end();)
+    {
+        it = (it->second.expirationTime.has_value() && *it->second.expirationTime <= now)
+            ? mSessionReservations.erase(it)
+            : std::next(it);
+    }
+
+    auto const sessionTtlMs = config.getSessionTtlMs();
+    auto& reservation = mSessionReservations[*sessionId];
+    // A continuation turn refreshes the TTL and may grow the budget.
+    reservation.reservedBlocks = std::max(reservation.reservedBlocks, config.getSessionReservedBlocks());
+    reservation.expirationTime
+        = sessionTtlMs.has_value() ? std::optional(now + *sessionTtlMs) : std::nullopt;
+
+    if (reservation.reservedBlocks <= 0 || !config.getTokenRangeRetentionConfigs().empty())
+    {
+        // Nothing to pin, or explicit token ranges take precedence over the derived session range.
+        return config;
+    }
+
+    // Pin the reserved prefix blocks (and this turn's decode blocks, which become part of the next
+    // turn's prefix) at the maximum retention priority until the TTL elapses.
+    TLLM_LOG_DEBUG("Session %lu reserves %d kv cache blocks", *sessionId, reservation.reservedBlocks);
+    return executor::KvCacheRetentionConfig(
+        {executor::KvCacheRetentionConfig::TokenRangeRetentionConfig(0,
+            reservation.reservedBlocks * getTokensPerBlock(), executor::KvCacheRetentionConfig::kMaxRetentionPriority,
+            sessionTtlMs)},
+        executor::KvCacheRetentionConfig::kMaxRetentionPriority, sessionTtlMs, config.getTransferMode(),
+        config.getDirectory(), sessionId, config.getSessionReservedBlocks(), sessionTtlMs);
+}
+
 void KVCacheManager::addSequence(
     RequestIdType requestId, SizeType32 inputLength, SizeType32 beamWidth, OptionalRef<LlmRequest> llmRequest)
 {
     // TODO: add streamLLM support
-    auto kvCacheRetentionConfig = llmRequest
-        ? llmRequest->getKvCacheRetentionConfig().value_or(executor::KvCacheRetentionConfig())
-        : executor::KvCacheRetentionConfig();
+    auto kvCacheRetentionConfig = applySessionReservation(llmRequest
+            ? llmRequest->getKvCacheRetentionConfig().value_or(executor::KvCacheRetentionConfig())
+            : executor::KvCacheRetentionConfig());
 
     auto const [seqIt, emplaceDone] = [&]
     {
@@ -3653,8 +3919,8 @@ void KVCacheManager::addSequenceBatch(
         auto const beamWidth = std::get<2>(requestInfos[i]);
         auto& llmRequest = llmRequests[i].get();
 
-        auto kvCacheRetentionConfig
-            = llmRequest.getKvCacheRetentionConfig().value_or(executor::KvCacheRetentionConfig());
+        auto kvCacheRetentionConfig = applySessionReservation(
+            llmRequest.getKvCacheRetentionConfig().value_or(executor::KvCacheRetentionConfig()));
 
         auto const [seqIt, emplaceDone] = [&]
         {
@@ -3947,7 +4213,16 @@ std::tuple<uint64_t, uint64_t> BaseKVCacheManager::calculateFreeMemBytes(
         totalMem / static_cast<double>(1 << 30), finalFreeMem / static_cast<double>(1 << 30));
     TLLM_CHECK_WITH_INFO(finalFreeMem <= totalMem, "Free memory cannot exceed total memory");
 
-    auto const freePrimaryMemBytes = static_cast<uint64_t>(finalFreeMem * freeMemFraction);
+    auto freePrimaryMemBytes = static_cast<uint64_t>(finalFreeMem * freeMemFraction);
+    if (config.getMaxGpuTotalBytes() > 0 && config.getMaxGpuTotalBytes() < freePrimaryMemBytes)
+    {
+        // A byte quota partitions GPU memory deterministically between model instances co-hosted
+        // in one process, where fractions of the momentary free memory depend on creation order.
+        TLLM_LOG_INFO("Capping kv cache memory from %0.2f GiB to maxGpuTotalBytes %0.2f GiB",
+            freePrimaryMemBytes / static_cast<double>(1 << 30),
+            config.getMaxGpuTotalBytes() / static_cast<double>(1 << 30));
+        freePrimaryMemBytes = config.getMaxGpuTotalBytes();
+    }
     auto const freeSecondaryMemBytes = config.getHostCacheSize().value_or(0);
 
     TLLM_LOG_DEBUG("Calculated free memory: {.freePrimaryMemBytes=%" PRIu64 ", .freeSecondaryMemBytes=%" PRIu64 "}",
@@ -18,11 +18,19 @@
 #include "tensorrt_llm/batch_manager/kvCacheManagerV2Utils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <cuda.h>
+#include <deque>
 #include <fcntl.h>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unistd.h>
 #include <vector>
 
@@ -68,100 +76,278 @@ bool readAll(int fd, ssize_t pos, void* data, ssize_t size) noexcept
         size);
 }
 
-template <typename DstAddr, typename SrcAddr>
-struct UserData
+void diskToDiskCopy(std::vector<Task<DiskAddress, DiskAddress>> const& tasks, ssize_t numBytes) noexcept
 {
-    std::vector<Task<DstAddr, SrcAddr>> tasks;
-    ssize_t numBytes;
-};
-
-CUDA_CB void hostFnDiskToDiskCopy(void* userData) noexcept
-{
-    // @TODO: enable multi-threading with a thread pool
-    using Data = UserData<DiskAddress, DiskAddress>;
-    auto const data = std::unique_ptr<Data>(static_cast<Data*>(userData));
-    std::vector<std::byte> buffer(data->numBytes);
+    std::vector<std::byte> buffer(numBytes);
     bool success = true;
-    for (auto const& t : data->tasks)
+    for (auto const& t : tasks)
     {
-        success = success && readAll(t.src.fd, t.src.pos, buffer.data(), data->numBytes);
-        success = success && writeAll(t.dst.fd, t.dst.pos, buffer.data(), data->numBytes);
+        success = success && readAll(t.src.fd, t.src.pos, buffer.data(), numBytes);
+        success = success && writeAll(t.dst.fd, t.dst.pos, buffer.data(), numBytes);
     }
     if (!success)
     {
-        TLLM_LOG_ERROR("[kvCacheManagerV2Utils] hostFnDiskToDiskCopy failed.\n");
+        TLLM_LOG_ERROR("[kvCacheManagerV2Utils] diskToDiskCopy failed.\n");
     }
 }
 
-CUDA_CB void hostFnDiskToHostCopy(void* userData) noexcept
+void diskToHostCopy(std::vector<Task<MemAddress, DiskAddress>> const& tasks, ssize_t numBytes) noexcept
 {
-    // @TODO: enable multi-threading with a thread pool
-    using Data = UserData<MemAddress, DiskAddress>;
-    auto const data = std::unique_ptr<Data>(static_cast<Data*>(userData));
     bool success = true;
-    for (auto const& t : data->tasks)
+    for (auto const& t : tasks)
     {
-        success = success && readAll(t.src.fd, t.src.pos, reinterpret_cast<void*>(t.dst), data->numBytes);
+        success = success && readAll(t.src.fd, t.src.pos, reinterpret_cast<void*>(t.dst), numBytes);
     }
     if (!success)
     {
-        TLLM_LOG_ERROR("[kvCacheManagerV2Utils] hostFnDiskToHostCopy failed.\n");
+        TLLM_LOG_ERROR("[kvCacheManagerV2Utils] diskToHostCopy failed.\n");
     }
 }
 
-CUDA_CB void hostFnHostToDiskCopy(void* userData) noexcept
+void hostToDiskCopy(std::vector<Task<DiskAddress, MemAddress>> const& tasks, ssize_t numBytes) noexcept
 {
-    // @TODO: enable multi-threading with a thread pool
-    using Data = UserData<DiskAddress, MemAddress>;
-    auto const data = std::unique_ptr<Data>(static_cast<Data*>(userData));
     bool success = true;
-    for (auto const& t : data->tasks)
+    for (auto const& t : tasks)
     {
-        success = success && writeAll(t.dst.fd, t.dst.pos, reinterpret_cast<void const*>(t.src), data->numBytes);
+        success = success && writeAll(t.dst.fd, t.dst.pos, reinterpret_cast<void const*>(t.src), numBytes);
     }
     if (!success)
     {
-        TLLM_LOG_ERROR("[kvCacheManagerV2Utils] hostFnHostToDiskCopy failed.\n");
+        TLLM_LOG_ERROR("[kvCacheManagerV2Utils] hostToDiskCopy failed.\n");
     }
 }
 
-CUDA_CB void hostFnHostToHostCopy(void* userData) noexcept
+void hostToHostCopy(std::vector<Task<MemAddress, MemAddress>> const& tasks, ssize_t numBytes) noexcept
 {
-    // @TODO: enable multi-threading with a thread pool
-    using Data = UserData<MemAddress, MemAddress>;
-    auto const data = std::unique_ptr<Data>(static_cast<Data*>(userData));
-    for (auto const& t : data->tasks)
+    for (auto const& t : tasks)
     {
-        memcpy(reinterpret_cast<void*>(t.dst), reinterpret_cast<void const*>(t.src), data->numBytes);
+        memcpy(reinterpret_cast<void*>(t.dst), reinterpret_cast<void const*>(t.src), numBytes);
     }
 }
 
+namespace
+{
+
+//! Executor for host-side copy work enqueued on CUDA streams.
+//!
+//! CUDA runs host functions on a small internal callback thread pool shared by all streams, so executing disk I/O or
+//! large memcpys inline there stalls the enqueuing stream for the full copy duration and delays callbacks of unrelated
+//! streams. Instead, the host function launched on the stream only hands the work item to this executor (O(1)) and the
+//! stream waits on a pinned mailbox slot that the worker thread releases once the copy has finished. Stream ordering
+//! is preserved: the copy cannot start before prior stream work has completed (the host function fires only then), and
+//! later stream work waits on the mailbox.
+class HostCopyExecutor
+{
+public:
+    static HostCopyExecutor& instance()
+    {
+        static HostCopyExecutor executor;
+        return executor;
+    }
+
+    //! Enqueue work on the stream: it runs after prior stream work has completed and subsequent stream work is
+    //! ordered after its completion, as if it had been launched with cuLaunchHostFunc directly.
+    CUresult enqueue(std::function<void()> work, CUstream stream) noexcept
+    {
+        auto const slotIdx = acquireSlot();
+        if (slotIdx == kNumSlots)
+        {
+            // No mailbox available (stream mem ops unsupported or all slots in flight): fall back to running the
+            // work inline in the host function.
+            auto item = std::make_unique<WorkItem>(WorkItem{this, std::move(work), kNumSlots, 0});
+            auto const result = cuLaunchHostFunc(stream, submitOrRunWorkItem, item.get());
+            if (result == CUDA_SUCCESS)
+            {
+                item.release();
+            }
+            return result;
+        }
+
+        // The slot is owned by this work item until the worker bumps it, so the plain read cannot race.
+        auto const target = mSlots[slotIdx] + 1;
+        auto item = std::make_unique<WorkItem>(WorkItem{this, std::move(work), slotIdx, target});
+        auto result = cuLaunchHostFunc(stream, submitOrRunWorkItem, item.get());
+        if (result != CUDA_SUCCESS)
+        {
+            releaseSlot(slotIdx);
+            return result;
+        }
+        item.release();
+        // Hold subsequent stream work until the worker thread has completed the copy. GEQ uses cyclic comparison,
+        // so the monotonically growing slot value may wrap around.
+        return cuStreamWaitValue32(
+            stream, mSlotsDevice + slotIdx * sizeof(std::uint32_t), target, CU_STREAM_WAIT_VALUE_GEQ);
+    }
+
+private:
+    static constexpr std::uint32_t kNumSlots = 256;
+
+    struct WorkItem
+    {
+        HostCopyExecutor* executor;
+        std::function<void()> work;
+        std::uint32_t slotIdx; // kNumSlots when running inline without a mailbox
+        std::uint32_t target;
+    };
+
+    HostCopyExecutor() = default;
+
+    ~HostCopyExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopped = true;
+        }
+        mCondVar.notify_all();
+        if (mWorker.joinable())
+        {
+            mWorker.join();
+        }
+        // The pinned mailbox memory is leaked on purpose: the CUDA context may already be destroyed during static
+        // teardown and late host functions may still dereference the slots.
+    }
+
+    //! Lazily set up the mailbox memory and the worker thread. Returns kNumSlots if no slot is available.
+    std::uint32_t acquireSlot() noexcept
+    {
+        std::call_once(mInitFlag,
+            [this]
+            {
+                void* hostPtr = nullptr;
+                if (cuMemHostAlloc(&hostPtr, kNumSlots * sizeof(std::uint32_t), CU_MEMHOSTALLOC_DEVICEMAP)
+                    != CUDA_SUCCESS)
+                {
+                    return;
+                }
+                CUdeviceptr devicePtr{};
+                if (cuMemHostGetDevicePointer(&devicePtr, hostPtr, 0) != CUDA_SUCCESS)
+                {
+                    cuMemFreeHost(hostPtr);
+                    return;
+                }
+                std::memset(hostPtr, 0, kNumSlots * sizeof(std::uint32_t));
+                // Probe stream mem ops support: waiting for the initial value completes immediately.
+                if (cuStreamWaitValue32(nullptr, devicePtr, 0, CU_STREAM_WAIT_VALUE_GEQ) != CUDA_SUCCESS)
+                {
+                    TLLM_LOG_WARNING(
+                        "[kvCacheManagerV2Utils] Stream mem ops unavailable, host copies run inline in CUDA host "
+                        "functions.");
+                    cuMemFreeHost(hostPtr);
+                    return;
+                }
+                mSlots = static_cast<std::uint32_t*>(hostPtr);
+                mSlotsDevice = devicePtr;
+                mFreeSlots.reserve(kNumSlots);
+                for (std::uint32_t i = 0; i < kNumSlots; ++i)
+                {
+                    mFreeSlots.push_back(i);
+                }
+                mWorker = std::thread(&HostCopyExecutor::workerLoop, this);
+            });
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mSlots == nullptr || mFreeSlots.empty())
+        {
+            return kNumSlots;
+        }
+        auto const slotIdx = mFreeSlots.back();
+        mFreeSlots.pop_back();
+        return slotIdx;
+    }
+
+    void releaseSlot(std::uint32_t slotIdx) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFreeSlots.push_back(slotIdx);
+    }
+
+    //! CUDA host function: hand the work item over to the worker thread. This keeps the CUDA callback thread free so
+    //! host functions of other streams are not delayed behind slow copies.
+    static CUDA_CB void submitOrRunWorkItem(void* userData) noexcept
+    {
+        auto item = std::unique_ptr<WorkItem>(static_cast<WorkItem*>(userData));
+        auto* executor = item->executor;
+        if (item->slotIdx == kNumSlots)
+        {
+            item->work();
+            return;
+        }
+        {
+            std::unique_lock<std::mutex> lock(executor->mMutex);
+            if (!executor->mStopped)
+            {
+                executor->mReadyItems.push_back(std::move(item));
+                lock.unlock();
+                executor->mCondVar.notify_one();
+                return;
+            }
+        }
+        // The worker is already gone (process teardown): run inline so the stream still makes progress.
+        executor->runWorkItem(*item);
+    }
+
+    void runWorkItem(WorkItem& item) noexcept
+    {
+        item.work();
+        // Publish completion to the stream polling the mailbox.
+        std::atomic_thread_fence(std::memory_order_release);
+        *(static_cast<std::uint32_t volatile*>(mSlots) + item.slotIdx) = item.target;
+        releaseSlot(item.slotIdx);
+    }
+
+    void workerLoop() noexcept
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            mCondVar.wait(lock, [this] { return mStopped || !mReadyItems.empty(); });
+            if (mReadyItems.empty())
+            {
+                return;
+            }
+            auto item = std::move(mReadyItems.front());
+            mReadyItems.pop_front();
+            lock.unlock();
+            runWorkItem(*item);
+            item.reset();
+            lock.lock();
+        }
+    }
+
+    std::once_flag mInitFlag;
+    std::uint32_t* mSlots{nullptr};
+    CUdeviceptr mSlotsDevice{};
+    std::vector<std::uint32_t> mFreeSlots;
+    std::deque<std::unique_ptr<WorkItem>> mReadyItems;
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    std::thread mWorker;
+    bool mStopped{false};
+};
+
+} // namespace
+
 CUresult copyDiskToDisk(std::vector<Task<DiskAddress, DiskAddress>> tasks, ssize_t numBytes, CUstream stream) noexcept
 {
-    using Data = UserData<DiskAddress, DiskAddress>;
-    auto data = std::make_unique<Data>(Data{std::move(tasks), numBytes});
-    return cuLaunchHostFunc(stream, hostFnDiskToDiskCopy, data.release());
+    return HostCopyExecutor::instance().enqueue(
+        [tasks = std::move(tasks), numBytes] { diskToDiskCopy(tasks, numBytes); }, stream);
 }
 
 CUresult copyDiskToHost(std::vector<Task<MemAddress, DiskAddress>> tasks, ssize_t numBytes, CUstream stream) noexcept
 {
-    using Data = UserData<MemAddress, DiskAddress>;
-    auto data = std::make_unique<Data>(Data{std::move(tasks), numBytes});
-    return cuLaunchHostFunc(stream, hostFnDiskToHostCopy, data.release());
+    return HostCopyExecutor::instance().enqueue(
+        [tasks = std::move(tasks), numBytes] { diskToHostCopy(tasks, numBytes); }, stream);
 }
 
 CUresult copyHostToDisk(std::vector<Task<DiskAddress, MemAddress>> tasks, ssize_t numBytes, CUstream stream) noexcept
 {
-    using Data = UserData<DiskAddress, MemAddress>;
-    auto data = std::make_unique<Data>(Data{std::move(tasks), numBytes});
-    return cuLaunchHostFunc(stream, hostFnHostToDiskCopy, data.release());
+    return HostCopyExecutor::instance().enqueue(
+        [tasks = std::move(tasks), numBytes] { hostToDiskCopy(tasks, numBytes); }, stream);
 }
 
 CUresult copyHostToHost(std::vector<Task<MemAddress, MemAddress>> tasks, ssize_t numBytes, CUstream stream) noexcept
 {
-    using Data = UserData<MemAddress, MemAddress>;
-    auto data = std::make_unique<Data>(Data{std::move(tasks), numBytes});
-    return cuLaunchHostFunc(stream, hostFnHostToHostCopy, data.release());
+    return HostCopyExecutor::instance().enqueue(
+        [tasks = std::move(tasks), numBytes] { hostToHostCopy(tasks, numBytes); }, stream);
 }
 
 SizeType32 IndexMapper::addNewSequence(LlmRequest::RequestIdType requestId)
@@ -24,6 +24,7 @@
 #include <array>
 #include <cassert>
 #include <cuda_runtime.h>
+#include <numeric>
 #include <vector>
 
 namespace tensorrt_llm::batch_manager::kv_cache_manager_v2
@@ -184,6 +185,66 @@ CUresult copyDeviceToDevice(std::vector<MMTask> const& tasks, ssize_t numBytes,
     return launchBatchedCopy(false, tasks, numBytes, stream);
 }
 
+CUresult migrateDevicePages(std::vector<MemAddress> const& dstPages, ssize_t dstTokensPerPage, ssize_t dstTokenBeg,
+    std::vector<MemAddress> const& srcPages, ssize_t srcTokensPerPage, ssize_t srcTokenBeg, ssize_t numTokens,
+    ssize_t bytesPerToken, CUstream stream) noexcept
+{
+    if (numTokens == 0)
+    {
+        return CUDA_SUCCESS;
+    }
+    TLLM_CHECK(srcTokensPerPage > 0 && dstTokensPerPage > 0);
+    TLLM_CHECK_WITH_INFO(bytesPerToken % grainBytes == 0,
+        "Not implemented case: bytesPerToken = %zd must be a multiple of %u.", bytesPerToken, grainBytes);
+    TLLM_CHECK_WITH_INFO(srcTokenBeg + numTokens <= static_cast<ssize_t>(srcPages.size()) * srcTokensPerPage,
+        "Source page list too short for the requested token range.");
+    TLLM_CHECK_WITH_INFO(dstTokenBeg + numTokens <= static_cast<ssize_t>(dstPages.size()) * dstTokensPerPage,
+        "Destination page list too short for the requested token range.");
+
+    // A chunk of chunkTokens tokens starting at a multiple of chunkTokens is contiguous in both geometries, so the
+    // migration reduces to uniform-size device copies handled by the batched copy kernel. Including the begin offsets
+    // in the gcd keeps every chunk aligned to page boundaries on both sides.
+    auto chunkTokens = std::gcd(srcTokensPerPage, dstTokensPerPage);
+    chunkTokens = std::gcd(chunkTokens, std::gcd(srcTokenBeg, dstTokenBeg));
+
+    auto const srcAddrOf = [&](ssize_t token)
+    {
+        token += srcTokenBeg;
+        return srcPages[token / srcTokensPerPage] + static_cast<MemAddress>(token % srcTokensPerPage) * bytesPerToken;
+    };
+    auto const dstAddrOf = [&](ssize_t token)
+    {
+        token += dstTokenBeg;
+        return dstPages[token / dstTokensPerPage] + static_cast<MemAddress>(token % dstTokensPerPage) * bytesPerToken;
+    };
+
+    auto const numWholeChunks = numTokens / chunkTokens;
+    if (numWholeChunks != 0)
+    {
+        std::vector<MMTask> tasks;
+        tasks.reserve(numWholeChunks);
+        for (ssize_t i = 0; i < numWholeChunks; i++)
+        {
+            tasks.push_back(MMTask{dstAddrOf(chunkTokens * i), srcAddrOf(chunkTokens * i)});
+        }
+        CUresult const err = launchBatchedCopy(false, tasks, chunkTokens * bytesPerToken, stream);
+        if (err != CUDA_SUCCESS)
+        {
+            return err;
+        }
+    }
+    // The tail starts at a multiple of chunkTokens and is shorter than a chunk, so it cannot cross a page boundary on
+    // either side.
+    auto const tailTokens = numTokens % chunkTokens;
+    if (tailTokens != 0)
+    {
+        auto const tailBeg = chunkTokens * numWholeChunks;
+        std::vector<MMTask> const tailTask{MMTask{dstAddrOf(tailBeg), srcAddrOf(tailBeg)}};
+        return launchBatchedCopy(false, tailTask, tailTokens * bytesPerToken, stream);
+    }
+    return CUDA_SUCCESS;
+}
+
 // dst_tensor[:, :num_seqs, 0] = src_tensor[:, copy_idx]
 // dst_tensor[:, :num_seqs, 1] = dst_tensor[:, :num_seqs, 0] + 1
 __global__ void copyBatchBlockOffsetsToDeviceKernel(SizeType32 const* __restrict__ srcPtr,
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -98,4 +98,16 @@ CUresult copyDeviceToDevice(
 void copyBatchBlockOffsetsToDevice(ITensor const& input, ITensor& output, ITensor const& copyIndex,
     ITensor const& indexScales, ITensor const& kvOffset, CUstream stream) noexcept;
 
+//! Re-block cache content between pools with different page geometries on device, e.g. when a model is switched to a
+//! different attention-window configuration and the cached tokens should survive the change instead of being dropped.
+//!
+//! srcPages / dstPages list the device base addresses of the pages holding the sequence, in token order. numTokens
+//! tokens are copied starting at token position srcTokenBeg of the source page list and written starting at token
+//! position dstTokenBeg of the destination page list, so a sliding-window shrink can keep just the tail of the
+//! sequence. The token stream is decomposed into chunks that are contiguous in both geometries and copied with the
+//! batched copy kernel; bytesPerToken must be a multiple of 16.
+CUresult migrateDevicePages(std::vector<MemAddress> const& dstPages, ssize_t dstTokensPerPage, ssize_t dstTokenBeg,
+    std::vector<MemAddress> const& srcPages, ssize_t srcTokensPerPage, ssize_t srcTokenBeg, ssize_t numTokens,
+    ssize_t bytesPerToken, CUstream stream) noexcept;
+
 } // namespace tensorrt_llm::batch_manager::kv_cache_manager_v2
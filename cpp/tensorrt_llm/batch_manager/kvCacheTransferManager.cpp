@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -15,17 +15,20 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstdint>
 
 #include "tensorrt_llm/batch_manager/kvCacheTransferManager.h"
 
 #include "tensorrt_llm/batch_manager/kvCacheEventManager.h"
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/kernels/kvCachePartialCopy.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/cudaEvent.h"
+#include "tensorrt_llm/runtime/cudaEventPool.h"
 #include "tensorrt_llm/runtime/cudaStream.h"
 
 namespace tr = tensorrt_llm::runtime;
@@ -35,57 +38,138 @@ namespace kvc = tensorrt_llm::executor::kv_cache;
 namespace tensorrt_llm::batch_manager::kv_cache_manager
 {
 
-static bool gpuToFilePosix(tr::ITensor::SharedPtr const& srcPtr, std::string const& filename)
+void KVCacheTransferManager::gpuToFilePosix(tr::ITensor::SharedPtr const& srcPtr, std::string const& filename)
 {
-    int fd = ::open(filename.c_str(), O_CREAT | O_WRONLY, 0664);
-    TLLM_CHECK_WITH_INFO(fd >= 0, "Failed to open '%s' for writing (POSIX fallback)", filename.c_str());
+    auto const numBytes = srcPtr->getSizeInBytes();
+
+    // Stage the block with an async D2H copy on the offload stream and let the background writer thread
+    // perform the file I/O, so the calling thread never blocks on the disk.
+    auto staging = tr::BufferManager::pinnedPool(
+        tr::ITensor::makeShape({static_cast<tr::ITensor::DimType64>(numBytes)}), nvinfer1::DataType::kUINT8);
+    TLLM_CUDA_CHECK(cudaMemcpyAsync(
+        staging->data(), srcPtr->data(), numBytes, cudaMemcpyDeviceToHost, mOffloadManager.getStream().get()));
+
+    tr::CudaEvent stagingReady;
+    mOffloadManager.getStream().record(stagingReady);
+    enqueueFileWrite(filename, std::move(staging), std::move(stagingReady));
+}
 
-    ssize_t numBytes = static_cast<ssize_t>(srcPtr->getSizeInBytes());
-    std::vector<uint8_t> hostBuffer(numBytes);
+void KVCacheTransferManager::fileToGpuPosix(tr::ITensor::SharedPtr const& dstPtr, std::string const& filename)
+{
+    // The block may still be queued for writing if it was spilled recently.
+    waitForPendingFileWrite(filename);
 
-    cudaError_t cpyErr = cudaMemcpy(hostBuffer.data(), srcPtr->data(), numBytes, cudaMemcpyDeviceToHost);
-    TLLM_CHECK_WITH_INFO(cpyErr == cudaSuccess, "cudaMemcpy to host failed, error=%d", cpyErr);
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    TLLM_CHECK_WITH_INFO(fd >= 0, "Failed to open '%s' for reading (POSIX fallback)", filename.c_str());
 
-    ssize_t written = ::write(fd, hostBuffer.data(), numBytes);
-    TLLM_CHECK_WITH_INFO(written >= 0, "POSIX write error=%zd", written);
+    auto const numBytes = static_cast<ssize_t>(dstPtr->getSizeInBytes());
 
-    TLLM_LOG_DEBUG("Wrote %zd bytes to %s (POSIX fallback)", written, filename.c_str());
+    // Reuse the pinned staging buffer; wait for the previous H2D copy out of it to complete before overwriting.
+    if (mOnboardStagingEvent)
+    {
+        mOnboardStagingEvent->synchronize();
+        mOnboardStagingEvent.reset();
+    }
+    if (!mOnboardStaging || static_cast<ssize_t>(mOnboardStaging->getSizeInBytes()) < numBytes)
+    {
+        mOnboardStaging = tr::BufferManager::pinnedPool(
+            tr::ITensor::makeShape({static_cast<tr::ITensor::DimType64>(numBytes)}), nvinfer1::DataType::kUINT8);
+    }
 
+    ssize_t bytesRead = ::read(fd, mOnboardStaging->data(), numBytes);
+    TLLM_CHECK_WITH_INFO(bytesRead >= 0, "POSIX read error=%zd", bytesRead);
     ::close(fd);
-    return true;
+
+    TLLM_LOG_DEBUG("Read %zd bytes from %s (POSIX fallback)", bytesRead, filename.c_str());
+
+    // Async upload on the onboard stream; overlaps with compute instead of synchronizing the device.
+    TLLM_CUDA_CHECK(cudaMemcpyAsync(
+        dstPtr->data(), mOnboardStaging->data(), numBytes, cudaMemcpyHostToDevice, mOnboardManager.getStream().get()));
+    mOnboardStagingEvent.emplace();
+    mOnboardManager.getStream().record(*mOnboardStagingEvent);
 }
 
-static bool fileToGpuPosix(tr::ITensor::SharedPtr const& dstPtr, std::string const& filename)
+void KVCacheTransferManager::enqueueFileWrite(std::string filename, tr::ITensor::SharedPtr staging, tr::CudaEvent event)
 {
-    int fd = ::open(filename.c_str(), O_RDONLY);
-    TLLM_CHECK_WITH_INFO(fd >= 0, "Failed to open '%s' for reading (POSIX fallback)", filename.c_str());
+    std::lock_guard<std::mutex> lock(mFileWriterMutex);
+    if (!mFileWriterThread.joinable())
+    {
+        mFileWriterThread = std::thread(&KVCacheTransferManager::fileWriterLoop, this);
+    }
+    mPendingFileWrites.push_back(PendingFileWrite{std::move(filename), std::move(staging), std::move(event)});
+    mFileWriterCv.notify_all();
+}
+
+void KVCacheTransferManager::waitForPendingFileWrite(std::string const& filename)
+{
+    std::unique_lock<std::mutex> lock(mFileWriterMutex);
+    mFileWriterCv.wait(lock,
+        [this, &filename]
+        {
+            return std::none_of(mPendingFileWrites.begin(), mPendingFileWrites.end(),
+                [&filename](PendingFileWrite const& job) { return job.filename == filename; });
+        });
+}
 
-    ssize_t numBytes = static_cast<ssize_t>(dstPtr->getSizeInBytes());
-    std::vector<uint8_t> hostBuffer(numBytes);
+void KVCacheTransferManager::fileWriterLoop()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(mFileWriterMutex);
+        mFileWriterCv.wait(lock, [this] { return mFileWriterShutdown || !mPendingFileWrites.empty(); });
+        if (mPendingFileWrites.empty())
+        {
+            break;
+        }
+        auto& job = mPendingFileWrites.front();
+        lock.unlock();
 
-    ssize_t bytesRead = ::read(fd, hostBuffer.data(), numBytes);
-    TLLM_CHECK_WITH_INFO(bytesRead >= 0, "POSIX read error=%zd", bytesRead);
+        // Wait for the staging D2H copy, then write the block to disk.
+        job.event.synchronize();
 
-    TLLM_LOG_DEBUG("Read %zd bytes from %s (POSIX fallback)", bytesRead, filename.c_str());
+        int fd = ::open(job.filename.c_str(), O_CREAT | O_WRONLY, 0664);
+        TLLM_CHECK_WITH_INFO(fd >= 0, "Failed to open '%s' for writing (POSIX fallback)", job.filename.c_str());
+        ssize_t written = ::write(fd, job.staging->data(), job.staging->getSizeInBytes());
+        TLLM_CHECK_WITH_INFO(written >= 0, "POSIX write error=%zd", written);
+        ::close(fd);
 
-    cudaError_t cpyErr = cudaMemcpy(dstPtr->data(), hostBuffer.data(), numBytes, cudaMemcpyHostToDevice);
-    TLLM_CHECK_WITH_INFO(cpyErr == cudaSuccess, "cudaMemcpy to device failed, error=%d", cpyErr);
+        TLLM_LOG_DEBUG("Wrote %zd bytes to %s (POSIX fallback)", written, job.filename.c_str());
 
-    ::close(fd);
-    return true;
+        lock.lock();
+        // Pop only after the write completed, so waitForPendingFileWrite cannot observe a stale file.
+        mPendingFileWrites.pop_front();
+        mFileWriterCv.notify_all();
+    }
 }
 
 KVCacheTransferManager::KVCacheTransferManager(
     tr::BufferManager const& bufferManager, std::shared_ptr<kvc::BaseLoopbackAgent> loopbackAgent)
     : mBufferManager{bufferManager}
-    , mOnboardManager(std::make_shared<tr::CudaStream>())
-    , mOffloadManager(std::make_shared<tr::CudaStream>())
+    // Onboard and offload traffic run on the process-wide per-class transfer streams: offload is
+    // deprioritized so bulk bursts cannot convoy latency-critical readbacks on the copy engines.
+    , mOnboardManager(tr::BufferManager::getTransferStream(tr::BufferManager::TransferClass::kONBOARD))
+    , mOffloadManager(tr::BufferManager::getTransferStream(tr::BufferManager::TransferClass::kOFFLOAD))
     , mLoopbackAgent{loopbackAgent}
+    , mWritebackBatchBytes{common::getEnvKVCacheOffloadWritebackBatchBytes()}
 {
     TLLM_CUDA_CHECK(cudaGetDevice(&mDeviceId));
     TLLM_CHECK(mDeviceId != -1);
 }
 
+KVCacheTransferManager::~KVCacheTransferManager()
+{
+    {
+        std::lock_guard<std::mutex> lock(mFileWriterMutex);
+        mFileWriterShutdown = true;
+        mFileWriterCv.notify_all();
+    }
+    if (mFileWriterThread.joinable())
+    {
+        // The writer drains any pending spills before exiting.
+        mFileWriterThread.join();
+    }
+}
+
 tr::ITensor::SharedPtr KVCacheTransferManager::computeBlockPointer(
     BlockPtr const& block, std::vector<KVCacheBlockPool> const& pools, size_t poolIdx)
 {
@@ -108,6 +192,36 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
     {
         TLLM_LOG_DEBUG("Using DRAM-based copy (GPU <-> CPU) for this block.");
 
+        // Device-to-device full-block regions are collected here and issued as one batched kernel launch
+        // instead of one memcpy per pool (or per layer for layer-first layouts). This keeps block reuse
+        // forks from launching hundreds of tiny copies per step under wide beam search.
+        std::vector<tk::KVCacheCopyDesc> batchedCopyDescs;
+        bool const intraDevice = src->isPrimary() && dst->isPrimary();
+
+        // Host<->device copies go through the per-class transfer streams; record the bytes they move
+        // so the copy-engine bandwidth split between offload and onboard traffic stays observable.
+        auto& hostCopyManager = isOffload ? mOffloadManager : mOnboardManager;
+        auto const hostCopyClass
+            = isOffload ? tr::BufferManager::TransferClass::kOFFLOAD : tr::BufferManager::TransferClass::kONBOARD;
+
+        // Full-block writebacks to the pinned secondary pool are staged and issued later as one
+        // batched transfer; small per-block copies waste PCIe efficiency and interfere with input
+        // staging. Bytes for staged regions are accounted when the batch is flushed.
+        bool const deferWriteback = isOffload && !intraDevice && numTokensToCopy <= 0 && mWritebackBatchBytes > 0;
+
+        auto hostCopy = [&](tr::IBuffer const& srcBuf, tr::IBuffer& dstBuf)
+        {
+            if (deferWriteback)
+            {
+                mPendingWritebackDescs.push_back(
+                    tk::KVCacheCopyDesc{srcBuf.data(), dstBuf.data(), srcBuf.getSizeInBytes()});
+                mPendingWritebackBytes += srcBuf.getSizeInBytes();
+                return;
+            }
+            hostCopyManager.copy(srcBuf, dstBuf);
+            tr::BufferManager::accountTransfer(hostCopyClass, srcBuf.getSizeInBytes());
+        };
+
         // Iterate over all pools, partial-copy logic
         for (size_t poolIdx = 0; poolIdx < pools.size(); ++poolIdx)
         {
@@ -128,7 +242,15 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
                     // slice at {layerIdx, blockIdx} gives {1, kvFactor, blockSize}
                     auto srcBlock = tr::ITensor::slice(srcPool, {layerIdx, srcBlockIdx}, 1);
                     auto dstBlock = tr::ITensor::slice(dstPool, {layerIdx, dstBlockIdx}, 1);
-                    (isOffload ? mOffloadManager : mOnboardManager).copy(*srcBlock, *dstBlock);
+                    if (intraDevice)
+                    {
+                        batchedCopyDescs.push_back(
+                            tk::KVCacheCopyDesc{srcBlock->data(), dstBlock->data(), srcBlock->getSizeInBytes()});
+                    }
+                    else
+                    {
+                        hostCopy(*srcBlock, *dstBlock);
+                    }
                 }
                 continue;
             }
@@ -146,7 +268,15 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
             {
                 // For partial copy not implemented with these data types,
                 // just do a full copy.
-                (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                if (intraDevice)
+                {
+                    batchedCopyDescs.push_back(
+                        tk::KVCacheCopyDesc{srcPtr->data(), dstPtr->data(), srcPtr->getSizeInBytes()});
+                }
+                else
+                {
+                    hostCopy(*srcPtr, *dstPtr);
+                }
             }
             else
             {
@@ -154,11 +284,19 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
                 if (numTokensToCopy >= tokensPerBlock)
                 {
                     // If requested tokens >= entire block, just do a full copy.
-                    (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                    if (intraDevice)
+                    {
+                        batchedCopyDescs.push_back(
+                            tk::KVCacheCopyDesc{srcPtr->data(), dstPtr->data(), srcPtr->getSizeInBytes()});
+                    }
+                    else
+                    {
+                        (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                    }
                 }
                 else
                 {
-                    auto stream = (isOffload ? mOffloadManager : mOnboardManager).getStream().get();
+                    auto stream = hostCopyManager.getStream().get();
                     int const numLayers = pool.numLayers;
                     int const kvFactor = pool.kvFactor;
                     int const numHeads = pool.numKvHeads;
@@ -170,10 +308,22 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
 
                     tk::kvCacheBlockPartialCopy(*dstPtr, *srcPtr, numLayers, numHeads, tokensPerBlock, sizePerHead,
                         numTokensToCopy, kvFactor, stream);
+                    tr::BufferManager::accountTransfer(
+                        hostCopyClass, srcPtr->getSizeInBytes() / tokensPerBlock * numTokensToCopy);
                 }
             }
         }
 
+        if (!batchedCopyDescs.empty())
+        {
+            // Upload the descriptor table and issue all device-to-device regions in one launch.
+            auto& copyManager = hostCopyManager;
+            auto descTable = copyManager.gpu(batchedCopyDescs.size() * sizeof(tk::KVCacheCopyDesc));
+            copyManager.copy(batchedCopyDescs.data(), *descTable);
+            tk::kvCacheBatchedBlockCopy(reinterpret_cast<tk::KVCacheCopyDesc const*>(descTable->data()),
+                static_cast<unsigned int>(batchedCopyDescs.size()), copyManager.getStream().get());
+        }
+
         TLLM_LOG_DEBUG("copyBlock: DRAM mode complete. Returning...");
         return;
     }
@@ -273,6 +423,10 @@ void KVCacheTransferManager::onboard(BlockPtr const& offloadedBlock, BlockPtr co
     std::vector<KVCacheBlockPool> const& pools, int numTokensToCopy, executor::KvCacheTransferMode mode,
     std::string const& directory)
 {
+    // A staged writeback may involve these raw blocks; flush first so the event bookkeeping below
+    // sees the copies that are already in flight.
+    flushWritebacksTouching(offloadedBlock, block);
+
     // Wait for any pending writes before reading from offloadedBlock
     auto offloadedBlockPendingWriteItr = mPendingWrites.find(offloadedBlock->getMemoryPoolBlockIndex());
     if (offloadedBlockPendingWriteItr != mPendingWrites.end())
@@ -314,10 +468,10 @@ void KVCacheTransferManager::onboard(BlockPtr const& offloadedBlock, BlockPtr co
     }
 
     // Record new pending read from offloadedBlock
-    mPendingReads[offloadedBlock->getMemoryPoolBlockIndex()] = tr::CudaEvent();
+    mPendingReads[offloadedBlock->getMemoryPoolBlockIndex()] = tr::CudaEventPool::instance().acquire();
     mOnboardManager.getStream().record(mPendingReads[offloadedBlock->getMemoryPoolBlockIndex()]);
     // Record new pending write to block
-    mPendingWrites[block->getMemoryPoolBlockIndex()] = tr::CudaEvent();
+    mPendingWrites[block->getMemoryPoolBlockIndex()] = tr::CudaEventPool::instance().acquire();
     mOnboardManager.getStream().record(mPendingWrites[block->getMemoryPoolBlockIndex()]);
 }
 
@@ -325,6 +479,10 @@ void KVCacheTransferManager::offload(BlockPtr const& block, BlockPtr const& offl
     std::vector<KVCacheBlockPool> const& pools, int numTokensToCopy, executor::KvCacheTransferMode mode,
     std::string const& directory)
 {
+    // A staged writeback may involve these raw blocks (e.g. two primaries offloaded to the same
+    // secondary block in one step); flush first so the batch cannot race with this copy.
+    flushWritebacksTouching(block, offloadBlock);
+
     // Wait for any pending writes before reading from block
     auto blockPendingWriteItr = mPendingWrites.find(block->getMemoryPoolBlockIndex());
     if (blockPendingWriteItr != mPendingWrites.end())
@@ -356,21 +514,82 @@ void KVCacheTransferManager::offload(BlockPtr const& block, BlockPtr const& offl
         mOffloadByteCount += computeBlockTransferBytes(pools, numTokensToCopy);
     }
 
+    bool const deferredWriteback = mode == executor::KvCacheTransferMode::DRAM && numTokensToCopy <= 0
+        && mWritebackBatchBytes > 0 && !(block->isPrimary() && offloadBlock->isPrimary());
+    if (deferredWriteback)
+    {
+        // The copy was staged by copyBlock; its read/write events are recorded when the batch is
+        // flushed. Flush once enough bytes accumulated to amortize the transfer setup.
+        mPendingWritebackBlocks.emplace_back(block->getMemoryPoolBlockIndex(), offloadBlock->getMemoryPoolBlockIndex());
+        mPendingWritebackBlockIdxs.insert(block->getMemoryPoolBlockIndex());
+        mPendingWritebackBlockIdxs.insert(offloadBlock->getMemoryPoolBlockIndex());
+        if (mPendingWritebackBytes >= mWritebackBatchBytes)
+        {
+            flushOffloadWritebacks();
+        }
+        return;
+    }
+
     // Record new pending read from block
-    mPendingReads[block->getMemoryPoolBlockIndex()] = tr::CudaEvent();
+    mPendingReads[block->getMemoryPoolBlockIndex()] = tr::CudaEventPool::instance().acquire();
     mOffloadManager.getStream().record(mPendingReads[block->getMemoryPoolBlockIndex()]);
     // Record new pending write to offloadBlock
-    mPendingWrites[offloadBlock->getMemoryPoolBlockIndex()] = tr::CudaEvent();
+    mPendingWrites[offloadBlock->getMemoryPoolBlockIndex()] = tr::CudaEventPool::instance().acquire();
     mOffloadManager.getStream().record(mPendingWrites[offloadBlock->getMemoryPoolBlockIndex()]);
 }
 
+void KVCacheTransferManager::flushOffloadWritebacks()
+{
+    if (mPendingWritebackDescs.empty())
+    {
+        return;
+    }
+
+    // One descriptor upload and one launch move the whole batch; the kernel writes the pinned
+    // secondary blocks directly, so the staged regions go out as one large transfer on the
+    // low-priority offload stream.
+    auto descTable = mOffloadManager.gpu(mPendingWritebackDescs.size() * sizeof(tk::KVCacheCopyDesc));
+    mOffloadManager.copy(mPendingWritebackDescs.data(), *descTable);
+    tk::kvCacheBatchedBlockCopy(reinterpret_cast<tk::KVCacheCopyDesc const*>(descTable->data()),
+        static_cast<unsigned int>(mPendingWritebackDescs.size()), mOffloadManager.getStream().get());
+    tr::BufferManager::accountTransfer(tr::BufferManager::TransferClass::kOFFLOAD, mPendingWritebackBytes);
+
+    for (auto const& [srcIdx, dstIdx] : mPendingWritebackBlocks)
+    {
+        mPendingReads[srcIdx] = tr::CudaEventPool::instance().acquire();
+        mOffloadManager.getStream().record(mPendingReads[srcIdx]);
+        mPendingWrites[dstIdx] = tr::CudaEventPool::instance().acquire();
+        mOffloadManager.getStream().record(mPendingWrites[dstIdx]);
+    }
+
+    mPendingWritebackDescs.clear();
+    mPendingWritebackBlocks.clear();
+    mPendingWritebackBlockIdxs.clear();
+    mPendingWritebackBytes = 0;
+}
+
+void KVCacheTransferManager::flushWritebacksTouching(BlockPtr const& blockA, BlockPtr const& blockB)
+{
+    if (mPendingWritebackBlockIdxs.empty())
+    {
+        return;
+    }
+    if (mPendingWritebackBlockIdxs.count(blockA->getMemoryPoolBlockIndex()) > 0
+        || mPendingWritebackBlockIdxs.count(blockB->getMemoryPoolBlockIndex()) > 0)
+    {
+        flushOffloadWritebacks();
+    }
+}
+
 void KVCacheTransferManager::syncWithBufferManager()
 {
-    tr::CudaEvent readyForOffloadEvent;
+    flushOffloadWritebacks();
+
+    auto readyForOffloadEvent = tr::CudaEventPool::instance().acquire();
     mBufferManager.getStream().record(readyForOffloadEvent);
     mOffloadManager.getStream().wait(readyForOffloadEvent);
 
-    tr::CudaEvent readyForOnboardEvent;
+    auto readyForOnboardEvent = tr::CudaEventPool::instance().acquire();
     mBufferManager.getStream().record(readyForOnboardEvent);
     mOnboardManager.getStream().wait(readyForOnboardEvent);
 
@@ -381,11 +600,15 @@ void KVCacheTransferManager::syncWithBufferManager()
 
 void KVCacheTransferManager::syncTransfers()
 {
-    tr::CudaEvent offloadEvent;
+    // Issue the staged cold-block writebacks now: they run during the next forward pass on the
+    // low-priority offload stream, instead of competing with this step's input staging.
+    flushOffloadWritebacks();
+
+    auto offloadEvent = tr::CudaEventPool::instance().acquire();
     mOffloadManager.getStream().record(offloadEvent);
     mBufferManager.getStream().wait(offloadEvent);
 
-    tr::CudaEvent onboardEvent;
+    auto onboardEvent = tr::CudaEventPool::instance().acquire();
     mOnboardManager.getStream().record(onboardEvent);
     mBufferManager.getStream().wait(onboardEvent);
 
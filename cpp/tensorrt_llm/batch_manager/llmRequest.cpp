@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,9 +16,12 @@
  */
 
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/common/poolAllocator.h"
 #include "tensorrt_llm/executor/serializeUtils.h"
 #include "tensorrt_llm/kernels/beamSearchKernels.h"
 
+#include <cmath>
+
 namespace tensorrt_llm::batch_manager
 {
 
@@ -57,11 +60,12 @@ void LlmRequest::createSerializedResult(
     auto result = createResult(useFastLogits, mpiWorldRank);
     if (result.has_value())
     {
-        std::ostringstream oStream;
+        // Presize the output and serialize straight into it instead of growing a stringstream
+        // and copying the payload a second time.
+        serializedResult.resize(executor::serialize_utils::serializedSize(result.value()));
+        executor::serialize_utils::VectorOutputBuf<char> streamBuf(serializedResult.data(), serializedResult.size());
+        std::ostream oStream(&streamBuf);
         executor::serialize_utils::serialize(result.value(), oStream);
-        auto str = oStream.str();
-        serializedResult.resize(str.size());
-        std::copy(str.begin(), str.end(), serializedResult.begin());
         isFinal = result.value().isFinal;
     }
 }
@@ -153,7 +157,62 @@ std::optional<executor::Result> LlmRequest::createResult(bool useFastLogits, int
     if (returnLogProbs())
     {
         result.cumLogProbs = sliceBeams(getCumLogProbs());
-        result.logProbs = sliceBeams(getLogProbs());
+        if (mIsStreaming && !mReturnAllGeneratedTokens)
+        {
+            // Mirror the token selection above and ship only the logprobs of this response's new
+            // tokens. Re-sending the cumulative vector each step makes a streamed generation cost
+            // O(n^2) total response bandwidth.
+            auto const& allLogProbs = getLogProbs();
+            auto const firstIdx = startTokenPos - getOrigPromptLen();
+            std::vector<VecLogProbs> logProbs(nbBeams);
+            for (SizeType32 beam = 0; beam < nbBeams; ++beam)
+            {
+                auto const& beamLogProbs = allLogProbs.at(beam);
+                auto const nbLogProbs = static_cast<SizeType32>(beamLogProbs.size());
+                auto const first = std::min(std::max(firstIdx, 0), nbLogProbs);
+                auto const last
+                    = std::min(first + static_cast<SizeType32>(result.outputTokenIds.at(beam).size()), nbLogProbs);
+                logProbs.at(beam).assign(beamLogProbs.begin() + first, beamLogProbs.begin() + last);
+            }
+            result.logProbs = std::move(logProbs);
+        }
+        else
+        {
+            result.logProbs = sliceBeams(getLogProbs());
+        }
+    }
+
+    if (mNumTopLogprobs > 0)
+    {
+        // Rows are indexed by the number of generated tokens; mirror the token selection above.
+        auto const firstRow = mIsStreaming ? startTokenPos - getOrigPromptLen() : SizeType32{0};
+        auto const numRows = mIsStreaming ? maxNbTokensOut : maxNbTokens - mPromptLen;
+        auto const* topVals = runtime::bufferCast<float>(*getTopLogprobsValsHost());
+        auto const* topIds = runtime::bufferCast<TokenIdType>(*getTopLogprobsIdsHost());
+        std::vector<std::vector<std::pair<TokenIdType, executor::FloatType>>> topLogprobs(numRows);
+        for (SizeType32 row = 0; row < numRows; ++row)
+        {
+            auto const* rowVals = topVals + static_cast<size_t>(firstRow + row) * mNumTopLogprobs;
+            auto const* rowIds = topIds + static_cast<size_t>(firstRow + row) * mNumTopLogprobs;
+            auto& rowPairs = topLogprobs.at(row);
+            rowPairs.reserve(mNumTopLogprobs);
+            for (SizeType32 i = 0; i < mNumTopLogprobs; ++i)
+            {
+                rowPairs.emplace_back(rowIds[i], std::log(rowVals[i]));
+            }
+        }
+        result.topLogprobs = std::move(topLogprobs);
+    }
+
+    if (getReturnPromptLogprobs())
+    {
+        auto const* promptProbs = runtime::bufferCast<float>(*getPromptLogprobsHost());
+        executor::VecLogProbs promptLogprobs(mPromptLen);
+        for (SizeType32 pos = 0; pos < mPromptLen; ++pos)
+        {
+            promptLogprobs[pos] = std::log(promptProbs[pos]);
+        }
+        result.promptLogprobs = std::move(promptLogprobs);
     }
 
     if (getReturnContextLogits())
@@ -320,7 +379,7 @@ std::shared_ptr<LlmRequest> LlmRequest::createChildRequest(RequestIdType request
     TLLM_CHECK_WITH_INFO(!isChild(), "A child request cannot create its own child.");
     TLLM_CHECK_WITH_INFO(mChildRequests.size() + 1 < static_cast<size_t>(getNumSubRequests()),
         "Cannot create child requests more than the number of return sequences (%d)", getNumSubRequests());
-    auto childReq = std::make_shared<LlmRequest>(*this);
+    auto childReq = std::allocate_shared<LlmRequest>(common::PoolAllocator<LlmRequest>(), *this);
     childReq->mRequestId = requestId;
     childReq->mSequenceIndex = mChildRequests.size() + 1;
     childReq->mParentRequestId = this->mRequestId;
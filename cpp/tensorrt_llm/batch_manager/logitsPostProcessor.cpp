@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -21,6 +21,8 @@
 #include "tensorrt_llm/batch_manager/llmRequest.h"
 #include "tensorrt_llm/batch_manager/runtimeBuffers.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
+#include "tensorrt_llm/kernels/logitsBias.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 
 namespace tr = tensorrt_llm::runtime;
@@ -45,6 +47,12 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
     std::vector<std::reference_wrapper<LlmRequest::BeamTokens const>> beamTokensVec;
     std::vector<std::optional<LlmRequest::RequestIdType>> clientIdsVec;
 
+    // Arguments for device-side bias application
+    std::vector<void*> biasLogitsPtrVec;
+    std::vector<void*> biasPtrVec;
+    nvinfer1::DataType biasLogitsDtype{};
+    SizeType32 biasVocabSizePadded{0};
+
     bool logitsPostProcessorIsApplied = false;
     for (size_t batchIdx = 0; batchIdx < inputBuffers.decoderRequests.size(); ++batchIdx)
     {
@@ -68,6 +76,30 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
             beamTokensVec.emplace_back(llmReq->getTokens());
             clientIdsVec.push_back(llmReq->mClientId);
         }
+        else if (llmReq->mLogitsPostProcessorBiasTensor)
+        {
+            auto const& bias = llmReq->mLogitsPostProcessorBiasTensor.value();
+            auto const& logitsShape = logits->getShape();
+            auto const vocabSizePadded = static_cast<SizeType32>(logitsShape.d[logitsShape.nbDims - 1]);
+            TLLM_CHECK_WITH_INFO(bias->getDataType() == logits->getDataType(),
+                "Logits post-processor bias tensor dtype must match the logits dtype.");
+            TLLM_CHECK_WITH_INFO(static_cast<SizeType32>(bias->getSize()) == vocabSizePadded,
+                "Logits post-processor bias tensor must have vocabSizePadded (%d) elements, got %zu.", vocabSizePadded,
+                bias->getSize());
+            TLLM_CHECK_WITH_INFO(biasVocabSizePadded == 0 || biasVocabSizePadded == vocabSizePadded,
+                "All logits post-processor bias tensors in a batch must share the padded vocab size.");
+            biasLogitsDtype = logits->getDataType();
+            biasVocabSizePadded = vocabSizePadded;
+
+            // One row per beam, so beam search shares the request's bias vector.
+            auto const numRows = static_cast<SizeType32>(logits->getSize()) / vocabSizePadded;
+            for (SizeType32 row = 0; row < numRows; ++row)
+            {
+                biasLogitsPtrVec.push_back(reinterpret_cast<std::byte*>(logits->data())
+                    + static_cast<size_t>(row) * vocabSizePadded * tr::BufferDataType(biasLogitsDtype).getSize());
+                biasPtrVec.push_back(bias->data());
+            }
+        }
     }
 
     // Invoke batched processor
@@ -80,6 +112,35 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
         }
     }
 
+    // Apply device-side bias tensors batched in-place, without host callbacks or stream synchronization
+    if (!biasLogitsPtrVec.empty())
+    {
+        logitsPostProcessorIsApplied = true;
+        if (replicateLogitsPostProcessor || worldConfig.isFirstTensorParallelRank())
+        {
+            auto const batchSize = static_cast<SizeType32>(biasLogitsPtrVec.size());
+            tr::BufferManager manager{stream};
+            auto const ptrsShape = ITensor::makeShape({batchSize});
+            auto const logitsPtrsDevice = manager.copyFrom(biasLogitsPtrVec, ptrsShape, tr::MemoryType::kGPU);
+            auto const biasPtrsDevice = manager.copyFrom(biasPtrVec, ptrsShape, tr::MemoryType::kGPU);
+
+            if (biasLogitsDtype == nvinfer1::DataType::kFLOAT)
+            {
+                tensorrt_llm::kernels::invokeLogitsBias<float>(tr::bufferCast<float*>(*logitsPtrsDevice),
+                    tr::bufferCast<float const*>(*biasPtrsDevice), batchSize, biasVocabSizePadded, stream->get());
+            }
+            else if (biasLogitsDtype == nvinfer1::DataType::kHALF)
+            {
+                tensorrt_llm::kernels::invokeLogitsBias<half>(tr::bufferCast<half*>(*logitsPtrsDevice),
+                    tr::bufferCast<half const*>(*biasPtrsDevice), batchSize, biasVocabSizePadded, stream->get());
+            }
+            else
+            {
+                TLLM_THROW("Unsupported logits data type for device-side logits post-processor bias.");
+            }
+        }
+    }
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 
     return logitsPostProcessorIsApplied;
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -21,9 +21,13 @@
 #include "tensorrt_llm/batch_manager/runtimeBuffers.h"
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/layers/defaultDecodingParams.h"
 #include "tensorrt_llm/runtime/decoderState.h"
 #include "tensorrt_llm/runtime/iGptDecoderBatched.h"
 
+#include <algorithm>
+#include <numeric>
+
 namespace tr = tensorrt_llm::runtime;
 
 namespace tensorrt_llm::batch_manager
@@ -86,6 +90,67 @@ void MakeDecodingBatchInputOutput::createDecoderBatchInputs(DecoderInputBuffers&
 namespace
 {
 
+//! @brief Bitmask of sampling features a request actually uses.
+//!
+//! Requests sharing a signature take the same branches in the penalty and sampling kernels, so grouping
+//! slots by signature keeps warps uniform and one penalty-using request no longer taxes the rest of the batch.
+uint32_t getSamplingFeatureSignature(runtime::SamplingConfig const& config)
+{
+    auto const usesNonDefault = [](auto const& optVec, auto defaultValue)
+    {
+        return optVec.has_value()
+            && std::any_of(optVec->begin(), optVec->end(), [&](auto const& value) { return value != defaultValue; });
+    };
+
+    uint32_t signature = 0;
+    signature |= usesNonDefault(config.temperature, layers::DefaultDecodingParams::getTemperature()) << 0;
+    signature |= usesNonDefault(config.repetitionPenalty, layers::DefaultDecodingParams::getRepetitionPenalty()) << 1;
+    signature |= usesNonDefault(config.presencePenalty, layers::DefaultDecodingParams::getPresencePenalty()) << 2;
+    signature |= usesNonDefault(config.frequencyPenalty, layers::DefaultDecodingParams::getFrequencyPenalty()) << 3;
+    signature |= usesNonDefault(config.minLength, layers::DefaultDecodingParams::getMinLength()) << 4;
+    signature |= usesNonDefault(config.noRepeatNgramSize, layers::DefaultDecodingParams::getNoRepeatNgramSize()) << 5;
+    signature |= usesNonDefault(config.topK, layers::DefaultDecodingParams::getTopK()) << 6;
+    signature |= usesNonDefault(config.topP, layers::DefaultDecodingParams::getTopP()) << 7;
+    signature |= static_cast<uint32_t>(config.beamWidth > 1) << 8;
+    return signature;
+}
+
+//! @brief Reorders decoder requests (and their logits) into segments of equal sampling-feature signature.
+//!
+//! The sort is stable, so requests within a segment keep their scheduling order. Must run before the
+//! decoder inputs are created and after all consumers that rely on the original request order.
+void sortRequestsBySamplingSignature(DecoderInputBuffers& inputBuffers)
+{
+    auto& decoderRequests = inputBuffers.decoderRequests;
+    auto& decoderLogits = inputBuffers.decoderLogits;
+    TLLM_CHECK(decoderRequests.size() == decoderLogits.size());
+
+    std::vector<uint32_t> signatures(decoderRequests.size());
+    std::transform(decoderRequests.begin(), decoderRequests.end(), signatures.begin(),
+        [](auto const& llmReq) { return getSamplingFeatureSignature(llmReq->mSamplingConfig); });
+    if (std::adjacent_find(signatures.begin(), signatures.end(), std::not_equal_to{}) == signatures.end())
+    {
+        return;
+    }
+
+    std::vector<size_t> permutation(decoderRequests.size());
+    std::iota(permutation.begin(), permutation.end(), size_t{0});
+    std::stable_sort(permutation.begin(), permutation.end(),
+        [&signatures](size_t lhs, size_t rhs) { return signatures[lhs] < signatures[rhs]; });
+
+    RequestVector sortedRequests;
+    sortedRequests.reserve(decoderRequests.size());
+    std::vector<TensorPtr> sortedLogits;
+    sortedLogits.reserve(decoderLogits.size());
+    for (auto const idx : permutation)
+    {
+        sortedRequests.push_back(std::move(decoderRequests[idx]));
+        sortedLogits.push_back(std::move(decoderLogits[idx]));
+    }
+    decoderRequests = std::move(sortedRequests);
+    decoderLogits = std::move(sortedLogits);
+}
+
 std::pair<std::vector<SizeType32>, std::vector<SizeType32>> getActiveSlots(RequestVector const& decoderRequests)
 {
     std::vector<SizeType32> activeSlots;
@@ -163,6 +228,9 @@ void MakeDecodingBatchInputOutput::operator()(DecoderInputBuffers& inputBuffers,
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
 
+    // Group slots by sampling-feature signature so the decoding layers see uniform segments.
+    sortRequestsBySamplingSignature(inputBuffers);
+
     auto [activeSlots, generationSteps] = getActiveSlots(inputBuffers.decoderRequests);
 
     createDecoderBatchInputs(inputBuffers, activeSlots, decoderState);
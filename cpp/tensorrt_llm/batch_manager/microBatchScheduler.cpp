@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,6 +17,7 @@
 
 #include "tensorrt_llm/batch_manager/microBatchScheduler.h"
 #include "tensorrt_llm/batch_manager/utils/inflightBatchingUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 
 namespace tensorrt_llm::batch_manager
@@ -43,6 +44,63 @@ static SizeType32 reuse_adjusted_compute(SizeType32 chunkSize, SizeType32 reusab
     return std::max<SizeType32>(0, contextRemaining - reusable);
 }
 
+ContextChunkBudgetController::ContextChunkBudgetController(double targetIterLatencyMs)
+    : mTargetIterLatencyMs(targetIterLatencyMs)
+{
+    TLLM_CHECK(mTargetIterLatencyMs > 0.0);
+}
+
+void ContextChunkBudgetController::recordIteration(
+    double iterLatencyMs, SizeType32 numCtxTokens, SizeType32 numGenRequests)
+{
+    if (iterLatencyMs <= 0.0)
+    {
+        return;
+    }
+    if (numCtxTokens > 0)
+    {
+        // Attribute the whole iteration to context compute. The decode share of mixed iterations
+        // biases the estimate low, which is the conservative direction for a latency clamp.
+        double const tokensPerMs = numCtxTokens / iterLatencyMs;
+        mCtxTokensPerMs = mCtxTokensPerMs == 0.0
+            ? tokensPerMs
+            : (1.0 - kThroughputEmaWeight) * mCtxTokensPerMs + kThroughputEmaWeight * tokensPerMs;
+    }
+    if (mCtxTokensPerMs == 0.0)
+    {
+        return;
+    }
+    if (mBudget == 0.0)
+    {
+        mBudget = mTargetIterLatencyMs * mCtxTokensPerMs;
+        return;
+    }
+    // Only mixed iterations measure the prefill/decode conflict the budget exists to resolve.
+    if (numCtxTokens == 0 || numGenRequests == 0)
+    {
+        return;
+    }
+    if (iterLatencyMs > mTargetIterLatencyMs)
+    {
+        mBudget = std::max(1.0, mBudget * mTargetIterLatencyMs / iterLatencyMs);
+        TLLM_LOG_DEBUG("Adaptive context chunking: iteration took %.2f ms (target %.2f), budget lowered to %.0f",
+            iterLatencyMs, mTargetIterLatencyMs, mBudget);
+    }
+    else
+    {
+        mBudget = std::min(mBudget * kBudgetGrowthFactor, mTargetIterLatencyMs * mCtxTokensPerMs);
+    }
+}
+
+std::optional<ContextChunkBudgetController::SizeType32> ContextChunkBudgetController::getCtxTokenBudget() const
+{
+    if (mBudget <= 0.0)
+    {
+        return std::nullopt;
+    }
+    return static_cast<SizeType32>(mBudget);
+}
+
 MicroBatchScheduler::MicroBatchScheduler(std::optional<batch_scheduler::ContextChunkingConfig> ctxChunkConfig,
     std::optional<SizeType32> maxContextLength, LlmRequestState noScheduleUntilState,
     LlmRequestState noScheduleAfterState)
@@ -51,6 +109,20 @@ MicroBatchScheduler::MicroBatchScheduler(std::optional<batch_scheduler::ContextC
     , mNoScheduleUntilState(noScheduleUntilState)
     , mNoScheduleAfterState(noScheduleAfterState)
 {
+    if (auto const targetMs = common::getEnvAdaptiveCtxChunkTargetMs(); mCtxChunkConfig && targetMs > 0.F)
+    {
+        TLLM_LOG_INFO("Adaptive context chunking enabled with a target iteration latency of %.2f ms", targetMs);
+        mChunkBudgetController = std::make_unique<ContextChunkBudgetController>(targetMs);
+    }
+}
+
+void MicroBatchScheduler::recordIterationLatency(
+    double iterLatencyMs, SizeType32 numCtxTokens, SizeType32 numGenRequests) const
+{
+    if (mChunkBudgetController)
+    {
+        mChunkBudgetController->recordIteration(iterLatencyMs, numCtxTokens, numGenRequests);
+    }
 }
 
 void MicroBatchScheduler::fitDraftTokens(RequestVector& contextsToBeChunked,
@@ -122,12 +194,89 @@ void MicroBatchScheduler::fitDraftTokens(RequestVector& contextsToBeChunked,
 // Loop-termination uses the raw token increment (actualIncrement), not the
 // compute-adjusted one, so a request whose entire new chunk is reusable still
 // counts as progress and does not cause a premature exit.
+//
+// Simulating the rounds one chunkUnitSize at a time costs
+// O(longestContext / chunkUnitSize) passes over the request vector per
+// scheduling call. After r complete rounds every request's chunk is simply
+// min(r * chunkUnitSize, cap), where cap folds in the remaining context
+// length and maxContextLength, so the aggregate compute after r rounds is a
+// monotone closed form. We binary-search the largest complete round count
+// that fits the budget and jump straight to that state; while complete
+// rounds fit in aggregate, the per-request capacity check can never fire
+// mid-round, so this is exactly equivalent. Only the final partial round is
+// simulated with the original loop, which then terminates in a few passes.
 template <>
 void MicroBatchScheduler::setCtxRequestsChunkSize<MicroBatchScheduler::ContextChunkingPolicy::kEQUAL_PROGRESS>(
     RequestVector& contextsToBeChunked, std::optional<SizeType32> ctxTokensCapacity, SizeType32 const chunkUnitSize,
     std::optional<SizeType32> const& maxContextLength)
 {
-    SizeType32 numCtxTokens{0};
+    if (contextsToBeChunked.empty())
+    {
+        return;
+    }
+
+    auto const numReqs = contextsToBeChunked.size();
+    std::vector<SizeType32> caps(numReqs);
+    std::vector<SizeType32> reusables(numReqs);
+    std::vector<SizeType32> remainings(numReqs);
+    SizeType32 maxRounds{0};
+    for (size_t i = 0; i < numReqs; ++i)
+    {
+        auto const& llmReq = contextsToBeChunked[i];
+        SizeType32 const remaining = llmReq->getContextRemainingLength();
+        SizeType32 cap = remaining;
+        if (maxContextLength && remaining > maxContextLength.value())
+        {
+            // Chunks are offered in chunkUnitSize steps and any step whose clamped size
+            // exceeds maxContextLength is rejected, so the reachable cap is the largest
+            // unit-aligned size within the limit.
+            cap = maxContextLength.value() / chunkUnitSize * chunkUnitSize;
+        }
+        caps[i] = cap;
+        reusables[i] = llmReq->isFirstContextChunk() ? std::min(llmReq->getEstimatedReusableTokens(), remaining) : 0;
+        remainings[i] = remaining;
+        maxRounds = std::max(maxRounds, (cap + chunkUnitSize - 1) / chunkUnitSize);
+    }
+
+    auto const consumedAfter = [&](SizeType32 rounds)
+    {
+        SizeType32 consumed{0};
+        for (size_t i = 0; i < numReqs; ++i)
+        {
+            auto const chunk = static_cast<SizeType32>(
+                std::min<int64_t>(static_cast<int64_t>(rounds) * chunkUnitSize, caps[i]));
+            consumed += reuse_adjusted_compute(chunk, reusables[i], remainings[i]);
+        }
+        return consumed;
+    };
+
+    SizeType32 completeRounds = maxRounds;
+    if (ctxTokensCapacity)
+    {
+        SizeType32 lo{0};
+        SizeType32 hi{maxRounds};
+        while (lo < hi)
+        {
+            SizeType32 const mid = lo + (hi - lo + 1) / 2;
+            if (consumedAfter(mid) <= ctxTokensCapacity.value())
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
+        }
+        completeRounds = lo;
+    }
+
+    for (size_t i = 0; i < numReqs; ++i)
+    {
+        contextsToBeChunked[i]->setContextChunkSize(static_cast<SizeType32>(
+            std::min<int64_t>(static_cast<int64_t>(completeRounds) * chunkUnitSize, caps[i])));
+    }
+
+    SizeType32 numCtxTokens{consumedAfter(completeRounds)};
     SizeType32 numTokensSingleLoop{1};
 
     while ((!ctxTokensCapacity || numCtxTokens < ctxTokensCapacity.value()) && numTokensSingleLoop)
@@ -308,7 +457,7 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
     std::optional<SizeType32> maxNumTokensRuntime) const
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE(microBatcherScheduleRequests);
+    NVTX3_SCOPED_RANGE_IN_DOMAIN(kSCHEDULER, microBatcherScheduleRequests);
 
     RequestVector contextRequests, generationRequests;
     // batchNumTokens tracks COMPUTE tokens only (excluding reusable cached tokens)
@@ -436,6 +585,35 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
         allContextRequestsFit = false;
     }
 
+    // Decode-latency isolation: when generation requests are in flight, optionally cap the context compute
+    // tokens packed into the same iteration so that a large prefill chunk cannot elongate decode steps.
+    // Prefill still progresses every iteration, just in smaller slices.
+    auto const ctxTokensCapWithGen = common::getEnvCtxComputeTokensCapWithGen();
+    std::optional<SizeType32> ctxCapacityOverride;
+    if (mCtxChunkConfig && ctxTokensCapWithGen > 0 && !generationRequests.empty())
+    {
+        ctxCapacityOverride = ctxTokensCapWithGen;
+        if (numChunkedComputeTokens > ctxTokensCapWithGen)
+        {
+            allContextRequestsFit = false;
+        }
+    }
+
+    // Adaptive counterpart of the static cap: a budget learned from measured iteration latency
+    // (see ContextChunkBudgetController). The tighter of the two wins.
+    if (mCtxChunkConfig && mChunkBudgetController && !generationRequests.empty())
+    {
+        if (auto const budget = mChunkBudgetController->getCtxTokenBudget())
+        {
+            ctxCapacityOverride
+                = ctxCapacityOverride ? std::min(ctxCapacityOverride.value(), budget.value()) : budget;
+            if (numChunkedComputeTokens > budget.value())
+            {
+                allContextRequestsFit = false;
+            }
+        }
+    }
+
     // For FORCE_CHUNK policy, always re-chunk regardless of whether all contexts fit.
     if (mCtxChunkConfig && mCtxChunkConfig.value().chunkingPolicy == ContextChunkingPolicy::kFORCE_CHUNK)
     {
@@ -446,8 +624,13 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
     if (!allContextRequestsFit)
     {
         TLLM_CHECK_WITH_INFO(mCtxChunkConfig, "If chunking is not enabled, context scheduling should be completed.");
-        auto const ctxTokensCapacity
+        auto ctxTokensCapacity
             = maxNumTokensRuntime ? std::make_optional(maxNumTokensRuntime.value() - batchNumTokens) : std::nullopt;
+        if (ctxCapacityOverride)
+        {
+            ctxTokensCapacity = ctxTokensCapacity ? std::min(ctxTokensCapacity.value(), ctxCapacityOverride.value())
+                                                  : ctxCapacityOverride;
+        }
         setCtxRequestsChunkSize(contextsToBeChunked, mCtxChunkConfig.value().chunkingPolicy, ctxTokensCapacity,
             mCtxChunkConfig.value().chunkUnitSize, mMaxContextLength);
     }
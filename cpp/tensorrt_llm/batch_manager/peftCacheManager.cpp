@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -158,7 +158,9 @@ PeftCacheManager::getPageManagerConfig(PeftCacheManagerConfig const& config, run
     TLLM_CHECK(std::numeric_limits<SizeType32>::max() >= numSlotsPerPage);
     TLLM_CHECK(std::numeric_limits<SizeType32>::max() >= pageWidth);
 
-    runtime::LoraCachePageManagerConfig hostPageConfig(runtime::MemoryType::kCPU, modelConfig.getDataType(),
+    // Host pages are pinned so that promotions to the device cache run as true async copies
+    // instead of staging pageable memory through the driver.
+    runtime::LoraCachePageManagerConfig hostPageConfig(runtime::MemoryType::kPINNED, modelConfig.getDataType(),
         totalHostPages, config.maxPagesPerBlockHost, numSlotsPerPage, pageWidth, 0);
     runtime::LoraCachePageManagerConfig devicePageConfig(runtime::MemoryType::kGPU, modelConfig.getDataType(),
         totalDevicePages, config.maxPagesPerBlockDevice, numSlotsPerPage, pageWidth, config.numCopyStreams);
@@ -327,7 +329,7 @@ void PeftCacheManager::addRequestPeft(std::shared_ptr<LlmRequest> llmRequest, bo
         TLLM_THROW("Error storing task=%lu in PEFT cache -- %s", taskId, e.what());
     }
 
-    auto fn = [taskId, req = llmRequest, loadNeeded, this]()
+    auto fn = [taskId, req = llmRequest, loadNeeded, tryGpuCache, this]()
     {
         auto optWeights = req->getLoraWeights();
         auto optConfig = req->getLoraConfig();
@@ -341,8 +343,12 @@ void PeftCacheManager::addRequestPeft(std::shared_ptr<LlmRequest> llmRequest, bo
             req->clearLoraConfig();
         }
 
-        // TODO (grclark) pre-loading nvbug 4547061
-        if (false)
+        // Prefetch the task to the device cache at admission time, so a cold adapter's H2D copy overlaps
+        // with the request's queueing delay instead of stalling ensureBatch. ensureBatch waits on this
+        // future before its own copyTask, so the two copies of a task never run concurrently, and only
+        // done tasks are evictable, so the prefetch cannot displace adapters of the running batch. Any
+        // failure (e.g. a full device cache) is non-fatal: ensureBatch will copy on the critical path.
+        if (tryGpuCache)
         {
             try
             {
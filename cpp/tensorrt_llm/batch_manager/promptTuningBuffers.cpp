@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -18,13 +18,33 @@
 #include "tensorrt_llm/batch_manager/promptTuningBuffers.h"
 
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 
+#include <cstdint>
+
 namespace tensorrt_llm::batch_manager
 {
 using SizeType32 = tensorrt_llm::runtime::SizeType32;
 using TensorPtr = runtime::ITensor::SharedPtr;
 
+namespace
+{
+//! FNV-1a over the host table bytes; cheap relative to the multi-MB H2D upload a hit saves.
+std::size_t hashPromptTableContents(runtime::ITensor const& table)
+{
+    auto const* data = reinterpret_cast<std::uint8_t const*>(table.data());
+    auto const sizeInBytes = table.getSizeInBytes();
+    std::size_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < sizeInBytes; ++i)
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+} // namespace
+
 PromptTuningBuffers::PromptTuningBuffers(SizeType32 maxBatchSize, runtime::BufferManager const& manager,
     runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig)
 {
@@ -47,6 +67,8 @@ PromptTuningBuffers::PromptTuningBuffers(SizeType32 maxBatchSize, runtime::Buffe
 
     // tasks
     mPromptTuningParams.tasks = manager.emptyTensor(runtime::MemoryType::kGPU, nvinfer1::DataType::kINT32);
+
+    mPromptTableCacheCapacity = common::getEnvPromptTableCacheSizeMb() << 20;
 }
 
 PromptTuningBuffers::PromptTuningBuffers(SizeType32 maxBatchSize, runtime::BufferManager const& manager,
@@ -72,6 +94,48 @@ PromptTuningBuffers::PromptTuningBuffers(SizeType32 maxBatchSize, runtime::Buffe
 
     // tasks
     mPromptTuningParams.tasks = manager.emptyTensor(runtime::MemoryType::kGPU, nvinfer1::DataType::kINT32);
+
+    mPromptTableCacheCapacity = common::getEnvPromptTableCacheSizeMb() << 20;
+}
+
+TensorPtr PromptTuningBuffers::getOrUploadPromptTable(
+    std::shared_ptr<LlmRequest> const& llmReq, runtime::BufferManager const& manager)
+{
+    auto const hostTable = llmReq->getPromptEmbeddingTable().value();
+    if (hostTable->getMemoryType() == runtime::MemoryType::kGPU)
+    {
+        return hostTable;
+    }
+
+    auto const hash = hashPromptTableContents(*hostTable);
+    if (auto it = mPromptTableCache.find(hash); it != mPromptTableCache.end())
+    {
+        mPromptTableCacheLru.splice(mPromptTableCacheLru.begin(), mPromptTableCacheLru, it->second.lruIt);
+        TLLM_LOG_DEBUG("Prompt table cache hit for request %lu (%zu bytes)", llmReq->mRequestId,
+            it->second.deviceTable->getSizeInBytes());
+        return it->second.deviceTable;
+    }
+
+    TensorPtr deviceTable = manager.copyFrom(*hostTable, runtime::MemoryType::kGPU);
+    auto const sizeInBytes = deviceTable->getSizeInBytes();
+    if (sizeInBytes > mPromptTableCacheCapacity)
+    {
+        // Larger than the whole cache, don't thrash it
+        return deviceTable;
+    }
+
+    while (mPromptTableCacheSize + sizeInBytes > mPromptTableCacheCapacity)
+    {
+        auto const evictHash = mPromptTableCacheLru.back();
+        mPromptTableCacheSize -= mPromptTableCache.at(evictHash).deviceTable->getSizeInBytes();
+        mPromptTableCache.erase(evictHash);
+        mPromptTableCacheLru.pop_back();
+    }
+
+    mPromptTableCacheLru.push_front(hash);
+    mPromptTableCache.emplace(hash, CachedPromptTable{deviceTable, mPromptTableCacheLru.begin()});
+    mPromptTableCacheSize += sizeInBytes;
+    return deviceTable;
 }
 
 void PromptTuningBuffers::validate(
@@ -170,6 +234,11 @@ void PromptTuningBuffers::fill(RequestVector const& contextRequests, RequestVect
                         slicedPtable->unsqueeze(0);
                         optReqPromptEmbeddingTable = std::move(slicedPtable);
                     }
+                    else if (mPromptTableCacheCapacity > 0)
+                    {
+                        // Reuse the cached upload when an identical table was seen before
+                        optReqPromptEmbeddingTable = getOrUploadPromptTable(llmReq, manager);
+                    }
                     else
                     {
                         // Move to GPU
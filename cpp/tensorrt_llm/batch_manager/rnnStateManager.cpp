@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -295,6 +295,102 @@ std::vector<RnnStateManager::SizeType32> RnnStateManager::getStateIndices(
     return result;
 }
 
+void RnnStateManager::setMaxStateCheckpoints(SizeType32 maxStateCheckpoints)
+{
+    TLLM_CHECK_WITH_INFO(maxStateCheckpoints >= 0, "maxStateCheckpoints must be non-negative");
+    mMaxStateCheckpoints = maxStateCheckpoints;
+    while (static_cast<SizeType32>(mStateCheckpoints.size()) > mMaxStateCheckpoints)
+    {
+        auto const evictKey = mCheckpointLru.back();
+        mCheckpointLru.pop_back();
+        mStateCheckpoints.erase(evictKey);
+    }
+}
+
+void RnnStateManager::copySlotStates(SizeType32 slotIdx, StateCheckpoint& checkpoint, bool toCheckpoint)
+{
+    auto const numLocalLayers = static_cast<SizeType32>(pagedConvStates->getShape().d[0]);
+    for (SizeType32 layer = 0; layer < numLocalLayers; ++layer)
+    {
+        auto layerConvStates = ITensor::slice(pagedConvStates, layer, 1);
+        auto layerSsmStates = ITensor::slice(pagedRnnStates, layer, 1);
+        layerConvStates->squeeze(0);
+        layerSsmStates->squeeze(0);
+        auto slotConvStates = ITensor::slice(layerConvStates, slotIdx, 1);
+        auto slotSsmStates = ITensor::slice(layerSsmStates, slotIdx, 1);
+        auto checkpointConvStates = ITensor::slice(checkpoint.convStates, layer, 1);
+        auto checkpointSsmStates = ITensor::slice(checkpoint.ssmStates, layer, 1);
+        if (toCheckpoint)
+        {
+            mBufferManager->copy(*slotConvStates, *checkpointConvStates);
+            mBufferManager->copy(*slotSsmStates, *checkpointSsmStates);
+        }
+        else
+        {
+            mBufferManager->copy(*checkpointConvStates, *slotConvStates);
+            mBufferManager->copy(*checkpointSsmStates, *slotSsmStates);
+        }
+    }
+}
+
+void RnnStateManager::storeStateCheckpoint(RequestIdType requestId, uint64_t prefixKey, SizeType32 prefixLength)
+{
+    if (mMaxStateCheckpoints == 0)
+    {
+        return;
+    }
+    TLLM_CHECK_WITH_INFO(
+        mBufferManager.has_value(), "State checkpoints require a stream-based RnnStateManager constructor");
+    auto const slotIdx = getCacheIndex(requestId);
+
+    auto it = mStateCheckpoints.find(prefixKey);
+    if (it == mStateCheckpoints.end())
+    {
+        if (static_cast<SizeType32>(mStateCheckpoints.size()) >= mMaxStateCheckpoints)
+        {
+            auto const evictKey = mCheckpointLru.back();
+            mCheckpointLru.pop_back();
+            mStateCheckpoints.erase(evictKey);
+        }
+        auto convShape = pagedConvStates->getShape();
+        auto ssmShape = pagedRnnStates->getShape();
+        convShape.d[1] = 1;
+        ssmShape.d[1] = 1;
+        StateCheckpoint checkpoint{prefixLength, BufferManager::pinned(convShape, pagedConvStates->getDataType()),
+            BufferManager::pinned(ssmShape, pagedRnnStates->getDataType()),
+            mCheckpointLru.insert(mCheckpointLru.begin(), prefixKey)};
+        it = mStateCheckpoints.emplace(prefixKey, std::move(checkpoint)).first;
+    }
+    else
+    {
+        it->second.prefixLength = prefixLength;
+        mCheckpointLru.splice(mCheckpointLru.begin(), mCheckpointLru, it->second.lruIt);
+    }
+
+    copySlotStates(slotIdx, it->second, /*toCheckpoint=*/true);
+}
+
+RnnStateManager::SizeType32 RnnStateManager::tryRestoreStateCheckpoint(RequestIdType requestId, uint64_t prefixKey)
+{
+    auto it = mStateCheckpoints.find(prefixKey);
+    if (it == mStateCheckpoints.end())
+    {
+        return 0;
+    }
+    TLLM_CHECK_WITH_INFO(
+        mBufferManager.has_value(), "State checkpoints require a stream-based RnnStateManager constructor");
+    auto const slotIdx = getCacheIndex(requestId);
+
+    copySlotStates(slotIdx, it->second, /*toCheckpoint=*/false);
+    mCheckpointLru.splice(mCheckpointLru.begin(), mCheckpointLru, it->second.lruIt);
+    return it->second.prefixLength;
+}
+
+RnnStateManager::SizeType32 RnnStateManager::getNumStateCheckpoints() const noexcept
+{
+    return static_cast<SizeType32>(mStateCheckpoints.size());
+}
+
 RnnStateManager::TensorPtr RnnStateManager::getConvStates(SizeType32 layerIdx) const
 {
     auto it = mLayerOffsets.find(layerIdx);
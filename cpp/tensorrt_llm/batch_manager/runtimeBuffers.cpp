@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -104,17 +104,29 @@ void RuntimeBuffers::create(SizeType32 maxBatchSize, SizeType32 maxBeamWidth,
         logits = manager.emptyTensor(MemoryType::kGPU, logitsType);
     }
 
-    // TODO: check which tensors can be allocated as pinned for max size
-    requestTypes = manager.emptyTensor(MemoryType::kCPU, TRTDataType<runtime::RequestType>::value);
-
-    contextLengthsHost = manager.emptyTensor(MemoryType::kCPU, nvinfer1::DataType::kINT32);
-    contextLengthsDevice = manager.emptyTensor(MemoryType::kGPU, nvinfer1::DataType::kINT32);
-    sequenceLengthsHost = manager.emptyTensor(MemoryType::kCPU, nvinfer1::DataType::kINT32);
-    sequenceLengthsDevice = manager.emptyTensor(MemoryType::kGPU, nvinfer1::DataType::kINT32);
-
-    lastTokenIdsHost = manager.emptyTensor(MemoryType::kCPU, nvinfer1::DataType::kINT32);
-    lastTokenIdsDevice = manager.emptyTensor(MemoryType::kGPU, nvinfer1::DataType::kINT32);
-    logitsIdsHost = manager.emptyTensor(MemoryType::kCPU, nvinfer1::DataType::kINT32);
+    // Host staging tensors are pinned so that the H2D uploads in setFromInputs are truly asynchronous.
+    requestTypes = manager.emptyTensor(MemoryType::kPINNEDPOOL, TRTDataType<runtime::RequestType>::value);
+
+    // Allocate the staging arena for the request descriptor tensors once at max size. The per-step context
+    // lengths, sequence lengths, last token ids and sequence slots are sliced out of it in reshape such that
+    // they stay adjacent and the whole descriptor table can be uploaded in one copy.
+    auto const maxNumLogits
+        = maxBatchSize * std::max(1 + modelConfig.getMaxDecodingDraftTokens(), maxBeamWidth);
+    auto const descriptorStagingShape
+        = ITensor::makeShape({2 * maxBatchSize * maxBeamWidth + maxNumLogits + maxBatchSize});
+    descriptorStagingHost
+        = tensorrt_llm::runtime::BufferManager::pinnedPool(descriptorStagingShape, nvinfer1::DataType::kINT32);
+    descriptorStagingDevice = manager.gpu(descriptorStagingShape, nvinfer1::DataType::kINT32);
+    contextLengthsHost = ITensor::slice(descriptorStagingHost, 0, 0);
+    contextLengthsDevice = ITensor::slice(descriptorStagingDevice, 0, 0);
+    sequenceLengthsHost = ITensor::slice(descriptorStagingHost, 0, 0);
+    sequenceLengthsDevice = ITensor::slice(descriptorStagingDevice, 0, 0);
+    lastTokenIdsHost = ITensor::slice(descriptorStagingHost, 0, 0);
+    lastTokenIdsDevice = ITensor::slice(descriptorStagingDevice, 0, 0);
+    seqSlots = ITensor::slice(descriptorStagingHost, 0, 0);
+    seqSlotsDevice = ITensor::slice(descriptorStagingDevice, 0, 0);
+
+    logitsIdsHost = manager.emptyTensor(MemoryType::kPINNEDPOOL, nvinfer1::DataType::kINT32);
 
     inputsIds = manager.emptyTensor(MemoryType::kGPU, nvinfer1::DataType::kINT32);
 
@@ -124,9 +136,6 @@ void RuntimeBuffers::create(SizeType32 maxBatchSize, SizeType32 maxBeamWidth,
     }
 
     auto const maxBatchSizeShape = ITensor::makeShape({maxBatchSize});
-    seqSlots = tensorrt_llm::runtime::BufferManager::pinnedPool(maxBatchSizeShape, nvinfer1::DataType::kINT32);
-    seqSlotsDevice = manager.gpu(maxBatchSizeShape, nvinfer1::DataType::kINT32);
-
     cacheIndirDecoderIOBatchedCopySrcOffsets
         = tensorrt_llm::runtime::BufferManager::pinnedPool(maxBatchSizeShape, nvinfer1::DataType::kINT64);
     cacheIndirDecoderIOBatchedCopyDstOffsets
@@ -323,15 +332,16 @@ void RuntimeBuffers::reshape(TllmRuntime const& runtime, ModelConfig const& mode
     auto const numSequences = getNumSequences();
     auto const numSequencesShape = ITensor::makeShape({numSequences});
     requestTypes->reshape(numSequencesShape);
-    contextLengthsHost->reshape(numSequencesShape);
-    contextLengthsDevice->reshape(numSequencesShape);
-    sequenceLengthsHost->reshape(numSequencesShape);
-    sequenceLengthsDevice->reshape(numSequencesShape);
+    // Keep the request descriptor tensors adjacent in the staging arena so setFromInputs can upload all of
+    // them at once.
+    contextLengthsHost = ITensor::slice(descriptorStagingHost, 0, numSequences);
+    contextLengthsDevice = ITensor::slice(descriptorStagingDevice, 0, numSequences);
+    sequenceLengthsHost = ITensor::slice(descriptorStagingHost, numSequences, numSequences);
+    sequenceLengthsDevice = ITensor::slice(descriptorStagingDevice, numSequences, numSequences);
+    lastTokenIdsHost = ITensor::slice(descriptorStagingHost, 2 * numSequences, numLogits);
+    lastTokenIdsDevice = ITensor::slice(descriptorStagingDevice, 2 * numSequences, numLogits);
 
-    auto const numLogitsShape = ITensor::makeShape({numLogits});
-    lastTokenIdsHost->reshape(numLogitsShape);
-    lastTokenIdsDevice->reshape(numLogitsShape);
-    logitsIdsHost->reshape(numLogitsShape);
+    logitsIdsHost->reshape(ITensor::makeShape({numLogits}));
 
     if (transformerBuffers)
     {
@@ -376,9 +386,8 @@ void RuntimeBuffers::reshape(TllmRuntime const& runtime, ModelConfig const& mode
     }
 
     auto const numRequests = getNumRequests();
-    auto const numRequestsShape = ITensor::makeShape({numRequests});
-    seqSlots->reshape(numRequestsShape);
-    seqSlotsDevice->reshape(numRequestsShape);
+    seqSlots = ITensor::slice(descriptorStagingHost, 2 * numSequences + numLogits, numRequests);
+    seqSlotsDevice = ITensor::slice(descriptorStagingDevice, 2 * numSequences + numLogits, numRequests);
 
     auto const numTokens = getNumTokens();
     inputsIds->reshape(ITensor::makeShape({numTokens}));
@@ -498,7 +507,7 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
         }
 
         TLLM_CHECK(seqSlots->getSize() == static_cast<std::size_t>(batchIdx));
-        manager.copy(*seqSlots, *seqSlotsDevice);
+        // The upload happens together with the other descriptor tensors in the bufferCopies section below.
     }
 
     // context preparation loop
@@ -789,6 +798,16 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
 
     {
         NVTX3_SCOPED_RANGE(bufferCopies);
+        // Context lengths, sequence lengths, last token ids and sequence slots are adjacent views of the
+        // staging arena; upload the whole descriptor table with one copy. This must happen before the
+        // gather below, which reads seqSlotsDevice.
+        auto const logitsIdsHostRange = BufferRange<SizeType32>(*logitsIdsHost);
+        auto lastTokenIdsHostRange = BufferRange<SizeType32>(*lastTokenIdsHost);
+        common::stl_utils::inclusiveScan(
+            logitsIdsHostRange.begin(), logitsIdsHostRange.end(), lastTokenIdsHostRange.begin());
+        auto const numDescriptors = 2 * getNumSequences() + numLogits + getNumRequests();
+        manager.copy(*ITensor::slice(descriptorStagingHost, 0, numDescriptors),
+            *ITensor::slice(descriptorStagingDevice, 0, numDescriptors));
         if (trtOverlap)
         {
             auto contextInputsIds = ITensor::slice(inputsIds, 0, numContextTokens);
@@ -806,14 +825,6 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
         {
             manager.copy(inputHost.data(), *inputsIds);
         }
-        // In generation phase, device ptr of context lengths need to be tiled.
-        manager.copy(*contextLengthsHost, *contextLengthsDevice);
-        manager.copy(*sequenceLengthsHost, *sequenceLengthsDevice);
-        auto const logitsIdsHostRange = BufferRange<SizeType32>(*logitsIdsHost);
-        auto lastTokenIdsHostRange = BufferRange<SizeType32>(*lastTokenIdsHost);
-        common::stl_utils::inclusiveScan(
-            logitsIdsHostRange.begin(), logitsIdsHostRange.end(), lastTokenIdsHostRange.begin());
-        manager.copy(*lastTokenIdsHost, *lastTokenIdsDevice);
         if (transformerBuffers)
         {
             TensorPtr decoderPositionIds = modelConfig.getSpeculativeDecodingMode().isLookaheadDecoding()
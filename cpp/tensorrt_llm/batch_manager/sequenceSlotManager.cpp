@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -40,20 +40,24 @@ std::optional<SequenceSlotManager::SlotIdType> SequenceSlotManager::getSequenceS
     if (startFlag)
     {
         // Check if correlation_id already exists
-        if (mSequenceIdToSlot.find(sequenceId) != mSequenceIdToSlot.end())
+        auto const existingIt = mSequenceIdToSlot.find(sequenceId);
+        if (existingIt != mSequenceIdToSlot.end())
         {
+            // Reuse the existing slot: claiming a fresh one here would never be recorded in the
+            // map (the emplace below fails on a duplicate key), leaking the slot until the table
+            // is exhausted and admission stalls.
             TLLM_LOG_ERROR("Already specified start flag for sequence id: %lu", sequenceId);
+            slot = existingIt->second;
         }
-
-        if (!mAvailableSlots.empty())
+        else if (!mAvailableSlots.empty())
         {
-            slot = mAvailableSlots.front();
-            mAvailableSlots.pop();
+            slot = *mAvailableSlots.begin();
+            mAvailableSlots.erase(mAvailableSlots.begin());
             mSequenceIdToSlot.emplace(sequenceId, slot.value());
         }
         else
         {
-            TLLM_LOG_ERROR("All available sequence slots are used");
+            TLLM_LOG_ERROR("All available sequence slots are used (%zu active)", mSequenceIdToSlot.size());
         }
     }
     else
@@ -82,7 +86,7 @@ void SequenceSlotManager::freeSequenceSlot(SequenceIdType sequenceId)
     {
         auto const slot = it->second;
         mSequenceIdToSlot.erase(it);
-        mAvailableSlots.push(slot);
+        mAvailableSlots.insert(slot);
     }
 }
 
@@ -98,7 +102,7 @@ void SequenceSlotManager::freeIdleSequenceSlots()
             TLLM_LOG_INFO("Releasing idle sequence with correlation id %lu idle time %li us", sequenceId,
                 idleMicroseconds.count());
             it = mSequenceIdToSlot.erase(it);
-            mAvailableSlots.push(slot);
+            mAvailableSlots.insert(slot);
         }
         else
         {
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -31,6 +31,7 @@
 #include "tensorrt_llm/runtime/tllmBuffers.h"
 #include "tensorrt_llm/runtime/tllmRuntime.h"
 #include <cstdint>
+#include <tuple>
 
 using namespace tensorrt_llm::runtime;
 namespace tk = tensorrt_llm::kernels;
@@ -350,6 +351,27 @@ void TransformerBuffers::copyKvBlockOffsets(RequestVector const& contextRequests
     SizeType32 numSequences{0};
     SizeType32 maxBlockCount{0};
     SizeType32 maxCrossBlockCount{0};
+
+    SizeType32 totalNumSequences{0};
+    for (auto const& requests : {contextRequests, genRequests})
+    {
+        for (auto const& llmReq : requests)
+        {
+            totalNumSequences += llmReq->isContextInitState() ? contextBeamWidth : llmReq->getBeamWidthByIter();
+        }
+    }
+    // When the batch composition is unchanged, rows whose per-sequence offsets carry the same version as at the
+    // previous call are already correct on host and device and can be skipped entirely. A change of the sequence
+    // count alters the table strides and invalidates all rows. Cross KV tables are rare and small, so the
+    // incremental path is not attempted for models with cross attention.
+    bool const incremental = crossKvCacheBlockOffsetsHost == nullptr && totalNumSequences == mBlockOffsetsNumSequences;
+    mBlockOffsetsNumSequences = totalNumSequences;
+
+    std::unordered_map<RequestIdType, BlockOffsetsRowState> rowStates;
+    rowStates.reserve(totalNumSequences);
+    // (slotOffset, beamWidth, blockCount) of the rows that need an upload on the incremental path
+    std::vector<std::tuple<SizeType32, SizeType32, SizeType32>> dirtyRows;
+
     for (auto const& requests : {contextRequests, genRequests})
     {
         for (auto const& llmReq : requests)
@@ -357,18 +379,34 @@ void TransformerBuffers::copyKvBlockOffsets(RequestVector const& contextRequests
             auto const requestId = llmReq->mRequestId;
             auto const isContextRequest = llmReq->isContextInitState();
             auto const beamWidth = isContextRequest ? contextBeamWidth : llmReq->getBeamWidthByIter();
-            auto const maxBeamBlockCount
-                = kvCacheManager->copyBlockOffsets(*kvCacheBlockOffsetsHost, numSequences, requestId);
-            maxBlockCount = std::max(maxBlockCount, maxBeamBlockCount);
+            auto const version = kvCacheManager->getSequence(requestId).getBlockOffsetsVersion();
+            auto const stateIt = mBlockOffsetsRowStates.find(requestId);
+            bool const rowUnchanged = incremental && stateIt != mBlockOffsetsRowStates.end()
+                && stateIt->second.slotOffset == numSequences && stateIt->second.beamWidth == beamWidth
+                && stateIt->second.version == version;
+            if (!rowUnchanged)
+            {
+                auto const maxBeamBlockCount
+                    = kvCacheManager->copyBlockOffsets(*kvCacheBlockOffsetsHost, numSequences, requestId);
+                maxBlockCount = std::max(maxBlockCount, maxBeamBlockCount);
+                if (incremental)
+                {
+                    dirtyRows.emplace_back(numSequences, beamWidth, maxBeamBlockCount);
+                }
+            }
             if (crossKvCacheBlockOffsetsHost)
             {
                 auto const maxCrossBeamBlockCount
                     = crossKvCacheManager->copyBlockOffsets(*crossKvCacheBlockOffsetsHost, numSequences, requestId);
                 maxCrossBlockCount = std::max(maxCrossBlockCount, maxCrossBeamBlockCount);
             }
+            rowStates.emplace(requestId, BlockOffsetsRowState{numSequences, beamWidth, version});
             numSequences += beamWidth;
         }
     }
+    // Entries of requests absent from this batch are dropped: their rows may be overwritten by other
+    // sequences before they are scheduled again.
+    mBlockOffsetsRowStates = std::move(rowStates);
 
     // requests' block offsets collected as [totalNumSequences, 2, maxBlocksPerSeq], copy to device
     auto copyOffsetsToDevice = [&cudaStream](TensorPtr& offsetsHost, TensorPtr& offsetsDevice, SizeType32 maxBlockCount)
@@ -387,10 +425,41 @@ void TransformerBuffers::copyKvBlockOffsets(RequestVector const& contextRequests
             dstPtr, copyPitch, srcPtr, copyPitch, copyWidth, copyHeight, cudaMemcpyHostToDevice, cudaStream.get()));
     };
 
-    copyOffsetsToDevice(kvCacheBlockOffsetsHost, kvCacheBlockOffsetsDevice, maxBlockCount);
-    if (crossKvCacheBlockOffsetsHost)
+    if (!incremental)
     {
-        copyOffsetsToDevice(crossKvCacheBlockOffsetsHost, crossKvCacheBlockOffsetsDevice, maxCrossBlockCount);
+        copyOffsetsToDevice(kvCacheBlockOffsetsHost, kvCacheBlockOffsetsDevice, maxBlockCount);
+        if (crossKvCacheBlockOffsetsHost)
+        {
+            copyOffsetsToDevice(crossKvCacheBlockOffsetsHost, crossKvCacheBlockOffsetsDevice, maxCrossBlockCount);
+        }
+    }
+    else
+    {
+        // Upload only the rows that changed since the previous call.
+        auto const& offsetsShape = kvCacheBlockOffsetsHost->getShape();
+        auto const numPools = offsetsShape.d[0];
+        auto const maxBlocksPerSeq = offsetsShape.d[3];
+        auto const offsetsTypeSize = tensorrt_llm::common::getDTypeSize(kvCacheBlockOffsetsHost->getDataType());
+        auto const copyPitch = maxBlocksPerSeq * offsetsTypeSize;
+        auto const seqStride = 2 * maxBlocksPerSeq;
+        auto const poolStride = offsetsShape.d[1] * seqStride;
+        auto const* srcBase = bufferCast<tk::KVCacheIndex>(*kvCacheBlockOffsetsHost);
+        auto* dstBase = bufferCast<tk::KVCacheIndex>(*kvCacheBlockOffsetsDevice);
+        for (auto const& [slotOffset, beamWidth, blockCount] : dirtyRows)
+        {
+            if (blockCount == 0)
+            {
+                continue;
+            }
+            auto const copyWidth = blockCount * offsetsTypeSize;
+            auto const copyHeight = 2 * beamWidth;
+            for (ITensor::DimType64 poolIdx = 0; poolIdx < numPools; ++poolIdx)
+            {
+                auto const offset = poolIdx * poolStride + slotOffset * seqStride;
+                TLLM_CUDA_CHECK(cudaMemcpy2DAsync(dstBase + offset, copyPitch, srcBase + offset, copyPitch, copyWidth,
+                    copyHeight, cudaMemcpyHostToDevice, cudaStream.get()));
+            }
+        }
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -580,7 +580,28 @@ void TrtEncoderModel::forward(RequestVector& activeRequests)
             return;
         }
 
-        executeBatch(activeRequests);
+        // Chunk the requests with the same micro batch scheduler as forwardAsync, so each engine call
+        // respects the engine's batch size and packed token budget instead of batching all active
+        // requests at once. Within each chunk, inputs stay packed (variable length, no padding).
+        RequestVector pendingRequests = activeRequests;
+        ReqIdsSet noInflightReqIds;
+        while (!pendingRequests.empty())
+        {
+            RequestVector scheduledRequests;
+            std::tie(scheduledRequests, std::ignore) = (*mMicroBatchScheduler)(
+                pendingRequests, noInflightReqIds, getMaxBatchSize(), mModelConfig.getMaxNumTokens());
+            TLLM_CHECK_WITH_INFO(!scheduledRequests.empty(),
+                "Encoder micro batch scheduler could not fit any of the remaining %zu requests within the engine's "
+                "batch size and token limits.",
+                pendingRequests.size());
+
+            executeBatch(scheduledRequests);
+
+            // executeBatch moves completed requests out of kENCODER_INIT, drop them from the pending set
+            pendingRequests.erase(std::remove_if(pendingRequests.begin(), pendingRequests.end(),
+                                      [](auto const& llmReq) { return !llmReq->isEncoderInitState(); }),
+                pendingRequests.end());
+        }
     }
     catch (std::exception const& e)
     {
@@ -51,6 +51,7 @@
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
+#include "tensorrt_llm/common/stageTracer.h"
 #include "tensorrt_llm/common/timestampUtils.h"
 #include "tensorrt_llm/kernels/decodingCommon.h"
 #include "tensorrt_llm/layers/defaultDecodingParams.h"
@@ -185,7 +186,9 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
     , mLogger{logger ? std::move(logger) : std::make_shared<TllmLogger>()}
     , mRuntime{std::make_unique<TllmRuntime>(rawEngine, mLogger.get(), executorConfig.getUseGpuDirectStorage(),
           executorConfig.getGpuWeightsPercent(), modelConfig.useShapeInference())}
-    , mCopyBufferManager{std::make_shared<CudaStream>()}
+    // Readbacks of tokens, log probs and logits are latency-critical; run them on the high-priority
+    // transfer stream so they are not queued behind bulk KV cache offload on the copy engines.
+    , mCopyBufferManager{BufferManager::getTransferStream(BufferManager::TransferClass::kLATENCY)}
     , mCtxGenFusion(ctxGenFusion)
     , mOperatingBeamWidth{getMaxBeamWidth()}
     , mGatherGenerationLogits{executorConfig.getGatherGenerationLogits()}
@@ -250,6 +253,19 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
             mModelConfig.getLogitsDtype(), mRuntime->getBufferManager());
     }
 
+    if (tc::getEnvEnableMemoryPressureWatchdog())
+    {
+        mMemoryPressureWatchdog.emplace();
+        TLLM_LOG_INFO("Memory pressure watchdog enabled");
+    }
+
+    mCtxGenConcurrentExecution = !mCtxGenFusion && tc::getEnvConcurrentCtxGenExecution();
+    if (mCtxGenConcurrentExecution)
+    {
+        mCtxGenConcurrentStream = std::make_shared<CudaStream>();
+        TLLM_LOG_INFO("Concurrent context/generation execution enabled");
+    }
+
     createRuntimeContexts();
 
     if (mWorldConfig.isTensorParallel())
@@ -385,6 +401,7 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
         = std::make_shared<SequenceSlotManager>(getMaxNumSequences(), executorConfig.getMaxSeqIdleMicroseconds());
 
     mMicroBatchScheduledRequests.resize(mNumMicroBatches);
+    mMicroBatchDispatchInfos.resize(mNumMicroBatches);
     mDecoderFinishedEvents.resize(mNumMicroBatches);
     mPeftTables.resize(mNumMicroBatches);
 
@@ -446,6 +463,17 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
 
     mMicroBatchScheduler = std::make_unique<MicroBatchScheduler>(ctxChunkConfig, maxContextLength);
 
+    mSpeculativeSchedulingEnabled = tc::getEnvSpeculativeScheduling()
+        && executorConfig.getSchedulerConfig().getCapacitySchedulerPolicy()
+            == executor::CapacitySchedulerPolicy::kGUARANTEED_NO_EVICT
+        && mNumMicroBatches == 1 && modelConfig.getSpeculativeDecodingMode().isNone();
+    if (tc::getEnvSpeculativeScheduling() && !mSpeculativeSchedulingEnabled)
+    {
+        TLLM_LOG_WARNING(
+            "TRTLLM_SCHED_SPECULATIVE_OVERLAP is ignored: it requires the guaranteed-no-evict capacity scheduler "
+            "policy, a single micro batch and no speculative decoding.");
+    }
+
     if (ctxChunkConfig)
     {
         if (maxContextLength)
@@ -784,9 +812,32 @@ void TrtGptModelInflightBatching::terminateRequest(LlmRequestPtr const& llmReq,
 void TrtGptModelInflightBatching::terminateRequestSync(
     LlmRequestPtr const& llmRequest, executor::FinishReason finishReason)
 {
-    TLLM_LOG_DEBUG("Registering termination for request %lu with finish reason %d", llmRequest->mRequestId,
-        static_cast<int>(finishReason));
-    mReqIdsToTerminate.try_emplace(llmRequest->mRequestId, finishReason);
+    auto const reqId = llmRequest->mRequestId;
+    // The eager path must not run in overlap mode: forwardAsync deliberately does not record
+    // inflight requests there (so the scheduler does not skip them), so an empty mInflightReqIds
+    // entry does not imply the request is off the device - the most recently issued micro batch
+    // is typically still executing and holds every active request. Freeing the sequence slot and
+    // KV cache blocks then would let the next forwardAsync reassign them while the device is
+    // still writing.
+    if (!isTrtOverlap() && mInflightReqIds.find(reqId) == mInflightReqIds.end())
+    {
+        // Not in flight: no device work references this request, so reclaim its sequence slot,
+        // KV cache blocks and PEFT page refs right away. The freed capacity is visible to the
+        // capacity scheduler at the next admission decision instead of being carried until the
+        // request gets scheduled again just to be terminated.
+        TLLM_LOG_DEBUG(
+            "Eagerly terminating request %lu with finish reason %d", reqId, static_cast<int>(finishReason));
+        if (!llmRequest->isGenerationCompleteState())
+        {
+            terminateRequest(llmRequest);
+            llmRequest->finishByReason(finishReason);
+            llmRequest->clearGeneratedTokens();
+        }
+        return;
+    }
+    TLLM_LOG_DEBUG(
+        "Registering termination for request %lu with finish reason %d", reqId, static_cast<int>(finishReason));
+    mReqIdsToTerminate.try_emplace(reqId, finishReason);
 }
 
 TrtGptModelInflightBatching::IterationStatsIFB TrtGptModelInflightBatching::fillIterationStats(
@@ -832,6 +883,7 @@ void TrtGptModelInflightBatching::forwardSync()
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE_WITH_NAME(range, "TrtGptModelInflightBatching::forwardSync");
+    TLLM_STAGE_TRACE(forwardSync);
 
     TLLM_CUDA_CHECK(cudaSetDevice(mWorldConfig.getDevice()));
 
@@ -910,7 +962,21 @@ void TrtGptModelInflightBatching::forwardSync()
             // If a context-only request is finished, send its KV cache and mark it.
             if (llmReq->isContextOnlyRequest() && llmReq->isContextFinished())
             {
-                // TODO: skip if sending layer-wise
+                if (llmReq->isCacheWarmupRequest())
+                {
+                    // Cache warm-up: the context phase only ran to populate reusable KV cache blocks.
+                    // Terminating stores the blocks for reuse; finish locally without a KV cache transfer.
+                    terminateRequest(llmReq);
+                    llmReq->finishByReason(executor::FinishReason::kLENGTH);
+                    continue;
+                }
+                if (llmReq->getContextProgress() != nullptr)
+                {
+                    // The KV cache of this request is already streaming layer-wise; the send was issued
+                    // in executeStep, so only record that the context phase is done.
+                    llmReq->setState(LlmRequestState::kDISAGG_CONTEXT_TRANS_IN_PROGRESS);
+                }
+                else
                 {
                     TLLM_CHECK_WITH_INFO(mCacheTransceiver,
                         "Disaggregated serving is not enabled, please check the configuration of "
@@ -920,6 +986,36 @@ void TrtGptModelInflightBatching::forwardSync()
                 mSeqSlotManager->freeSequenceSlot(llmReq->mRequestId);
             }
         }
+
+        // Consume the measured dispatch-to-sync latency of this micro batch: feed the adaptive
+        // context-chunk controller (no-op unless TRTLLM_ADAPTIVE_CTX_CHUNK_TARGET_MS is set) and
+        // attribute the iteration time to requests that asked for perf metrics, proportionally to
+        // their scheduled token counts.
+        if (auto& dispatchInfo = mMicroBatchDispatchInfos.at(mMicroBatchId);
+            dispatchInfo.time != std::chrono::steady_clock::time_point{})
+        {
+            auto const latencyMs
+                = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - dispatchInfo.time)
+                      .count();
+            mMicroBatchScheduler->recordIterationLatency(latencyMs, dispatchInfo.numCtxTokens,
+                static_cast<SizeType32>(currRequests.generationRequests.size()));
+            if (!dispatchInfo.tokensPerRequest.empty() && dispatchInfo.numTotalTokens > 0)
+            {
+                for (auto const& requests : {currRequests.contextRequests, currRequests.generationRequests})
+                {
+                    for (auto const& llmReq : requests)
+                    {
+                        auto const it = dispatchInfo.tokensPerRequest.find(llmReq->mRequestId);
+                        if (it != dispatchInfo.tokensPerRequest.end())
+                        {
+                            llmReq->attributeGpuTimeMs(
+                                static_cast<float>(latencyMs * it->second / dispatchInfo.numTotalTokens));
+                        }
+                    }
+                }
+            }
+            dispatchInfo = {};
+        }
     }
     // report profile data
     auto const bufferId = getFusedBufferId();
@@ -987,10 +1083,57 @@ void TrtGptModelInflightBatching::resetIterationStats()
     mLastIterationStatsIFB = IterationStatsIFB{mMicroBatchId};
 }
 
+bool TrtGptModelInflightBatching::canScheduleSpeculatively() const
+{
+    // Disaggregated serving, the memory pressure watchdog and seamless lookahead all adjust the
+    // schedule based on state that is not covered by the fingerprint, so those configurations
+    // always schedule from scratch.
+    return mSpeculativeSchedulingEnabled && !mWorldConfig.isPipelineParallel() && !mCacheTransceiver
+        && !mMemoryPressureWatchdog && !mUseSeamlessLookahead;
+}
+
+TrtGptModelInflightBatching::SpeculativeSchedule::Fingerprint TrtGptModelInflightBatching::schedulingFingerprint(
+    RequestList const& activeRequests)
+{
+    SpeculativeSchedule::Fingerprint fingerprint;
+    fingerprint.reserve(activeRequests.size());
+    for (auto const& llmReq : activeRequests)
+    {
+        fingerprint.emplace_back(llmReq->mRequestId, llmReq->getState(), llmReq->getContextCurrentPosition());
+    }
+    return fingerprint;
+}
+
+void TrtGptModelInflightBatching::scheduleNextIterationSpeculatively(RequestList const& activeRequests)
+{
+    NVTX3_SCOPED_RANGE(scheduleNextIterationSpeculatively);
+
+    SpeculativeSchedule schedule;
+    schedule.fingerprint = schedulingFingerprint(activeRequests);
+    schedule.maxBatchSize = mMaxBatchSizeRuntime;
+    schedule.maxNumTokens = mMaxNumTokensRuntime;
+    schedule.operatingBeamWidth = mOperatingBeamWidth;
+
+    RequestVector fittingDisaggGenInitRequests;
+    std::tie(schedule.fittingRequests, fittingDisaggGenInitRequests, schedule.requestsToPause)
+        = (*mCapacityScheduler)(activeRequests, mKvCacheManager, mPeftCacheManager, mCrossKvCacheManager);
+    // The requests dispatched this iteration complete their decoder step before the schedule is
+    // consumed, so the next micro batch is scheduled against an empty in-flight set.
+    std::tie(schedule.contextRequests, schedule.generationRequests)
+        = (*mMicroBatchScheduler)(schedule.fittingRequests, ReqIdsSet{}, schedule.maxBatchSize, schedule.maxNumTokens);
+    if (schedule.contextRequests.empty() && schedule.generationRequests.empty())
+    {
+        // Never cache an empty schedule: the synchronous path emits the starvation warning for it.
+        return;
+    }
+    mSpeculativeSchedule.emplace(std::move(schedule));
+}
+
 void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE_WITH_NAME(range, "TrtGptModelInflightBatching::forwardAsync");
+    TLLM_STAGE_TRACE(forwardAsync);
 
     TLLM_CUDA_CHECK(cudaSetDevice(mWorldConfig.getDevice()));
 
@@ -1007,14 +1150,38 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
         // The scheduler will not include any requests that are (i) still in encoder state if encoder-decoder models OR
         // (ii) already in flight for decoder models
         TLLM_LOG_DEBUG("Running DECODER request scheduler");
-        auto [fittingRequests, fittingDisaggGenInitRequests, requestsToPause]
-            = (*mCapacityScheduler)(activeRequests, mKvCacheManager, mPeftCacheManager, mCrossKvCacheManager);
+        RequestVector fittingRequests;
+        RequestVector fittingDisaggGenInitRequests;
+        RequestVector requestsToPause;
+        bool reusedSpeculativeSchedule = false;
+        if (mSpeculativeSchedule.has_value())
+        {
+            auto& schedule = *mSpeculativeSchedule;
+            if (canScheduleSpeculatively() && schedule.maxBatchSize == mMaxBatchSizeRuntime
+                && schedule.maxNumTokens == mMaxNumTokensRuntime && schedule.operatingBeamWidth == mOperatingBeamWidth
+                && schedule.fingerprint == schedulingFingerprint(activeRequests))
+            {
+                // The active request set did not change while the previous iteration ran on the GPU,
+                // so the schedule computed alongside it is still valid.
+                fittingRequests = std::move(schedule.fittingRequests);
+                requestsToPause = std::move(schedule.requestsToPause);
+                currRequests.contextRequests = std::move(schedule.contextRequests);
+                currRequests.generationRequests = std::move(schedule.generationRequests);
+                reusedSpeculativeSchedule = true;
+            }
+            mSpeculativeSchedule.reset();
+        }
+        if (!reusedSpeculativeSchedule)
+        {
+            std::tie(fittingRequests, fittingDisaggGenInitRequests, requestsToPause)
+                = (*mCapacityScheduler)(activeRequests, mKvCacheManager, mPeftCacheManager, mCrossKvCacheManager);
+        }
         // Remove from fitting requests the requests that cannot be scheduled due to disagg KV cache transfer
         if (mModelConfig.isTransformerBased() && getKVCacheManager() && mCacheTransceiver)
         {
             prepareDisaggGenInitRequests(activeRequests, fittingDisaggGenInitRequests);
         }
-        if (fittingRequests.empty() && fittingDisaggGenInitRequests.empty())
+        if (!reusedSpeculativeSchedule && fittingRequests.empty() && fittingDisaggGenInitRequests.empty())
         {
             TLLM_LOG_WARNING(
                 "CapacityScheduler didn't schedule any requests in iteration %lu, "
@@ -1027,8 +1194,39 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
                 // will free kvCache in next iteration.
             }
         }
-        std::tie(currRequests.contextRequests, currRequests.generationRequests)
-            = (*mMicroBatchScheduler)(fittingRequests, mInflightReqIds, mMaxBatchSizeRuntime, mMaxNumTokensRuntime);
+        auto effectiveMaxBatchSize = mMaxBatchSizeRuntime;
+        auto effectiveMaxNumTokens = mMaxNumTokensRuntime;
+        // The watchdog is disabled for speculative scheduling, see canScheduleSpeculatively.
+        if (!reusedSpeculativeSchedule && mMemoryPressureWatchdog)
+        {
+            using PressureLevel = runtime::MemoryPressureWatchdog::PressureLevel;
+            auto const pressure = mMemoryPressureWatchdog->sample();
+            if (pressure >= PressureLevel::kElevated)
+            {
+                // Stop growing the footprint: halve the scheduled batch and token budget for this iteration.
+                effectiveMaxBatchSize = std::max(1, effectiveMaxBatchSize / 2);
+                if (effectiveMaxNumTokens)
+                {
+                    effectiveMaxNumTokens = std::max(1, effectiveMaxNumTokens.value() / 2);
+                }
+            }
+            if (pressure == PressureLevel::kCritical)
+            {
+                // Pause admission: drop context requests that have not started prefill yet, so the running
+                // requests can drain and release memory before new KV cache is committed.
+                fittingRequests.erase(std::remove_if(fittingRequests.begin(), fittingRequests.end(),
+                                          [](auto const& llmReq) {
+                                              return llmReq->isContextInitState()
+                                                  && llmReq->getContextCurrentPosition() == 0;
+                                          }),
+                    fittingRequests.end());
+            }
+        }
+        if (!reusedSpeculativeSchedule)
+        {
+            std::tie(currRequests.contextRequests, currRequests.generationRequests) = (*mMicroBatchScheduler)(
+                fittingRequests, mInflightReqIds, effectiveMaxBatchSize, effectiveMaxNumTokens);
+        }
         TLLM_CHECK(currRequests.size() <= static_cast<size_t>(getMaxBatchSize()));
 
         (*mPauseRequests)(requestsToPause, mInflightReqIds, mReqIdsToPause, false, *mSeqSlotManager, mKvCacheManager,
@@ -1094,6 +1292,19 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
             }
             sync_check_cuda_error(mRuntime->getStream().get());
 
+            if (isTrtOverlap() && mWorldConfig.isLastPipelineParallelRank())
+            {
+                // The decoder no longer serializes the runtime stream behind sampling. The engine consumes the
+                // previous iteration's new tokens and sequence lengths on the runtime stream during buffer
+                // preparation, so order the next forward after the previous micro batch's decoder event here.
+                auto const prevMicroBatchId = getPrevMicroBatchId(mMicroBatchId);
+                auto& prevDecoderFinishedEvent = mDecoderFinishedEvents.at(prevMicroBatchId);
+                if (prevDecoderFinishedEvent)
+                {
+                    mRuntime->getStream().wait(*prevDecoderFinishedEvent);
+                }
+            }
+
             executeBatch(currRequests);
             if (mWorldConfig.isLastPipelineParallelRank() && mGuidedDecoder)
             {
@@ -1116,13 +1327,16 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
 
             if (isTrtOverlap())
             {
-                // WAR: Because the decoder is not stateless (yet) a sync is needed between
-                // decoder execution and next decoder step preparation.
+                // Because the decoder is not stateless (yet), the next decoder step must not start before the
+                // previous micro batch's decoder kernels and output copies have finished. Host-visible decoder
+                // outputs are double-buffered per micro batch and only consumed after decoderSync, so instead
+                // of blocking the host here, order the decoder stream behind the previous decoder event and
+                // keep the decode loop free of per-step host synchronization.
                 auto const prevMicroBatchId = getPrevMicroBatchId(mMicroBatchId);
                 auto& prevDecoderFinishedEvent = mDecoderFinishedEvents.at(prevMicroBatchId);
                 if (prevDecoderFinishedEvent)
                 {
-                    prevDecoderFinishedEvent->synchronize();
+                    mDecoder->getDecoderStream()->wait(*prevDecoderFinishedEvent);
                 }
             }
 
@@ -1135,6 +1349,23 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
             sync_check_cuda_error(mRuntime->getStream().get());
 
             mLastIterationStatsIFB = fillIterationStats(currRequests, requestsToPause);
+            auto& dispatchInfo = mMicroBatchDispatchInfos.at(mMicroBatchId);
+            dispatchInfo = {std::chrono::steady_clock::now(), mLastIterationStatsIFB.numCtxTokens};
+            for (auto const& requests : {currRequests.contextRequests, currRequests.generationRequests})
+            {
+                for (auto const& llmReq : requests)
+                {
+                    // Context chunk still reflects this iteration here; it is advanced below.
+                    auto const numTokens = llmReq->isContextInitState()
+                        ? llmReq->getContextChunkSize()
+                        : llmReq->mSamplingConfig.beamWidth * (1 + llmReq->getNumDraftTokens());
+                    dispatchInfo.numTotalTokens += numTokens;
+                    if (llmReq->getReturnPerfMetrics())
+                    {
+                        dispatchInfo.tokensPerRequest.emplace(llmReq->mRequestId, numTokens);
+                    }
+                }
+            }
             for (auto const& requests : {currRequests.contextRequests, currRequests.generationRequests})
             {
                 for (auto const& llmReq : requests)
@@ -1198,6 +1429,14 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
             }
         }
 
+        if (canScheduleSpeculatively() && !currRequests.empty())
+        {
+            // The engine iteration dispatched above still occupies the GPU; compute the next
+            // iteration's schedule now so its serial host cost is hidden. The next forwardAsync
+            // reconciles the result against the actual request state before using it.
+            scheduleNextIterationSpeculatively(activeRequests);
+        }
+
         // Update the micro batch ID
         mMicroBatchId = getNextMicroBatchId(mMicroBatchId);
     }
@@ -1260,6 +1499,7 @@ void TrtGptModelInflightBatching::executeContext(SizeType32 runtimeContextId, Si
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(executeContext);
+    TLLM_STAGE_TRACE(executeContext);
 
     auto const& currBatchState = mBuffers[bufferId]->getBatchState();
 
@@ -1349,18 +1589,26 @@ void TrtGptModelInflightBatching::executeBatch(ScheduledRequests const& schedule
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(executeBatch);
+    TLLM_STAGE_TRACE(executeBatch);
 
     if (!mCtxGenFusion)
     {
-        if (!scheduledRequests.contextRequests.empty())
+        if (canExecuteCtxGenConcurrently(scheduledRequests))
         {
-            auto const bufferId = getContextBufferId();
-            executeStep(scheduledRequests.contextRequests, {}, bufferId);
+            executeCtxGenConcurrently(scheduledRequests);
         }
-        if (!scheduledRequests.generationRequests.empty())
+        else
         {
-            auto const bufferId = getGenerationBufferId();
-            executeStep({}, scheduledRequests.generationRequests, bufferId);
+            if (!scheduledRequests.contextRequests.empty())
+            {
+                auto const bufferId = getContextBufferId();
+                executeStep(scheduledRequests.contextRequests, {}, bufferId);
+            }
+            if (!scheduledRequests.generationRequests.empty())
+            {
+                auto const bufferId = getGenerationBufferId();
+                executeStep({}, scheduledRequests.generationRequests, bufferId);
+            }
         }
     }
     else
@@ -1371,6 +1619,65 @@ void TrtGptModelInflightBatching::executeBatch(ScheduledRequests const& schedule
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+bool TrtGptModelInflightBatching::canExecuteCtxGenConcurrently(ScheduledRequests const& scheduledRequests) const
+{
+    // Concurrency only pays off when both phases are scheduled. Features that assume all engine work is serialized
+    // on the runtime stream (cuda graph capture, prompt table prefetch, layer-wise KV transfer, debug dumps,
+    // additional model outputs) keep the serial path.
+    return mCtxGenConcurrentExecution && !scheduledRequests.contextRequests.empty()
+        && !scheduledRequests.generationRequests.empty() && !isCudaGraphMode() && !mPromptTableOffloading
+        && !mDebugConfig && !(mAdditionalModelOutputs.has_value() && !mAdditionalModelOutputs.value().empty())
+        && !common::getEnvDisaggLayerwise();
+}
+
+void TrtGptModelInflightBatching::executeCtxGenConcurrently(ScheduledRequests const& scheduledRequests)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    NVTX3_SCOPED_RANGE_WITH_NAME(range,
+        "executeCtxGenConcurrently: " + std::to_string(scheduledRequests.contextRequests.size()) + " ctx reqs, "
+            + std::to_string(scheduledRequests.generationRequests.size()) + " gen reqs");
+
+    auto const numProfiles = mRuntime->getNbProfiles();
+
+    // Bind both phases before enqueueing anything. The generation phase binds to its own execution contexts
+    // (offset by numProfiles), so the context phase bindings stay untouched.
+    auto const ctxOptProfileId = std::get<0>(prepareBuffers(scheduledRequests.contextRequests, {}, getContextBufferId()));
+    auto const genOptProfileId
+        = std::get<0>(prepareBuffers({}, scheduledRequests.generationRequests, getGenerationBufferId(), numProfiles));
+
+    for (auto const bufferId : {getContextBufferId(), getGenerationBufferId()})
+    {
+        if (mBuffers[bufferId]->transformerBuffers)
+        {
+            // Layer-wise KV transfer never runs on this path; keep the progress pointer cleared.
+            bufferCast<void*>(*mBuffers[bufferId]->transformerBuffers->contextProgressHost)[0] = nullptr;
+        }
+    }
+
+    // All input copies above were issued on the runtime stream; the generation stream must not start before they
+    // are done. The two batches operate on disjoint requests and thus on disjoint KV cache blocks, so no further
+    // fencing between the phases is needed.
+    CudaEvent inputsReady{};
+    mRuntime->getStream().record(inputsReady);
+    mCtxGenConcurrentStream->wait(inputsReady);
+
+    if (!mRuntime->executeContext(ctxOptProfileId))
+    {
+        throw std::runtime_error("Executing TRT engine failed!");
+    }
+    if (!mRuntime->executeContext(genOptProfileId + numProfiles, *mCtxGenConcurrentStream))
+    {
+        throw std::runtime_error("Executing TRT engine failed!");
+    }
+
+    // Rejoin the runtime stream: everything downstream (decoder, logits copies) must observe the generation output.
+    CudaEvent genDone{};
+    mCtxGenConcurrentStream->record(genDone);
+    mRuntime->getStream().wait(genDone);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 void TrtGptModelInflightBatching::createRuntimeContexts()
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
@@ -1380,6 +1687,16 @@ void TrtGptModelInflightBatching::createRuntimeContexts()
     {
         mRuntime->addContext(i);
     }
+    if (mCtxGenConcurrentExecution)
+    {
+        // Second context set for the generation phase at indices [numProfiles, 2 * numProfiles). An execution
+        // context cannot be enqueued while it is already running, and contexts sharing activation memory must not
+        // execute concurrently, so the generation phase gets its own contexts with dedicated device memory.
+        for (auto i = 0; i < numProfiles; ++i)
+        {
+            mRuntime->addContext(i, /*dedicatedDeviceMemory=*/true);
+        }
+    }
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -1569,6 +1886,7 @@ void TrtGptModelInflightBatching::prepareDisaggGenInitRequests(
     RequestList const& activeRequests, RequestVector& newGenReqs)
 {
     NVTX3_SCOPED_RANGE(prepareDisaggGenInitRequests);
+    TLLM_STAGE_TRACE(prepareDisaggGenInitRequests);
 
     // Allocate KV cache by treating them as context requests
     (*mAllocateKvCache)(*mKvCacheManager, newGenReqs, {}, mModelConfig, mCrossKvCacheManager);
@@ -1729,11 +2047,12 @@ void TrtGptModelInflightBatching::debugIOTensors(RequestVector const& contextReq
 }
 
 std::tuple<SizeType32, runtime::StringPtrMap<runtime::ITensor> const&, runtime::StringPtrMap<runtime::ITensor>&>
-TrtGptModelInflightBatching::prepareBuffers(
-    RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId)
+TrtGptModelInflightBatching::prepareBuffers(RequestVector const& contextRequests,
+    RequestVector const& generationRequests, SizeType32 bufferId, SizeType32 contextIdOffset)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(prepareBuffers);
+    TLLM_STAGE_TRACE(prepareBuffers);
 
     auto& runtimeBuffers = *mBuffers.at(bufferId);
 
@@ -1750,8 +2069,8 @@ TrtGptModelInflightBatching::prepareBuffers(
     mRuntime->setCurrentBeamWidths(
         tensorrt_llm::batch_manager::utils::getRequestBeamWidths(contextRequests, generationRequests));
 
-    mRuntime->setInputTensors(optProfileId, inputMap);
-    mRuntime->setOutputTensors(optProfileId, outputMap);
+    mRuntime->setInputTensors(optProfileId + contextIdOffset, inputMap);
+    mRuntime->setOutputTensors(optProfileId + contextIdOffset, outputMap);
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
     return {optProfileId, inputMap, outputMap};
@@ -1773,7 +2092,14 @@ void TrtGptModelInflightBatching::prepareGraph(SizeType32 bufferId, SizeType32 o
         // in order to capture the kernels with the large enough grid.
         mBuffers[bufferId]->prepareBuffersForCudaGraph(getMaxSequenceLen());
 
-        auto cudaGraph = std::make_shared<utils::CudaGraphExecutor>();
+        // Reuse the executor that the insertion below would evict. If the captured topology matches its
+        // instantiated graph, prepareNextGraph refreshes it with cudaGraphExecUpdate, which is much
+        // cheaper than instantiating from scratch when batch states cycle through the cache.
+        auto cudaGraph = mCudaGraphExecutorCaches[bufferId].extractLeastRecentlyUsed();
+        if (cudaGraph == nullptr)
+        {
+            cudaGraph = std::make_shared<utils::CudaGraphExecutor>();
+        }
         cudaGraph->prepareNextGraph(mRuntime, optProfileId);
         mCudaGraphExecutorCaches[bufferId].put(nextBatchState, cudaGraph);
     }
@@ -1804,7 +2130,8 @@ void TrtGptModelInflightBatching::executeStep(
         {
             for (auto const& request : contextRequests)
             {
-                bool const enableLayerWise = request->isContextOnlyRequest() && request->isLastContextChunk();
+                bool const enableLayerWise
+                    = request->isContextOnlyRequest() && !request->isCacheWarmupRequest() && request->isLastContextChunk();
                 if (enableLayerWise)
                 {
                     layerWiseRequests.push_back(request);
@@ -1863,6 +2190,7 @@ void TrtGptModelInflightBatching::setupDecoderStep(
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(setupDecoderStep);
+    TLLM_STAGE_TRACE(setupDecoderStep);
 
     if (mWorldConfig.isLastPipelineParallelRank() && !contextRequests.empty())
     {
@@ -2217,21 +2545,42 @@ runtime::CudaEvent TrtGptModelInflightBatching::decoderStepAsync(ScheduledReques
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(decoderStepAsync);
+    TLLM_STAGE_TRACE(decoderStepAsync);
 
     auto& decoderInputBuffers = mDecoderInputBuffers.at(getFusedBufferId());
 
+    // Optionally issue the device-to-host logits copies on the copy stream so they overlap the remaining
+    // work of this iteration. The compute stream waits for the copies below, so downstream consumers keep
+    // seeing completed host logits and the engine cannot overwrite the logits buffer early.
+    static bool const overlapLogitsCopy = common::getEnvLogitsCopyOverlap();
+    using OptionalCopyManager = tensorrt_llm::common::OptionalRef<runtime::BufferManager const>;
+    auto const copyManager = overlapLogitsCopy ? OptionalCopyManager(mCopyBufferManager) : OptionalCopyManager();
+    if (overlapLogitsCopy)
+    {
+        runtime::CudaEvent logitsReady{};
+        mRuntime->getBufferManager().getStream().record(logitsReady);
+        mCopyBufferManager.getStream().wait(logitsReady);
+    }
+
     auto const contextBufferId = mCtxGenFusion ? getFusedBufferId() : getContextBufferId();
     auto& contextRuntimeBuffers = mBuffers.at(contextBufferId);
     auto const logitsIndex = (*mHandleContextLogits)(decoderInputBuffers, scheduledRequests.contextRequests,
         contextRuntimeBuffers->logits, contextRuntimeBuffers->numContextLogits, mModelConfig,
-        mRuntime->getBufferManager(), contextRuntimeBuffers->mMedusaBuffers);
+        mRuntime->getBufferManager(), contextRuntimeBuffers->mMedusaBuffers, copyManager);
 
     auto const genLogitsIndex = mCtxGenFusion ? logitsIndex : 0;
     auto const genBufferId = mCtxGenFusion ? getFusedBufferId() : getGenerationBufferId();
     auto& genRuntimeBuffers = mBuffers.at(genBufferId);
     (*mHandleGenerationLogits)(decoderInputBuffers, scheduledRequests.generationRequests, genRuntimeBuffers->logits,
         genLogitsIndex, mModelConfig, mRuntime->getBufferManager(), *genRuntimeBuffers,
-        genRuntimeBuffers->mMedusaBuffers);
+        genRuntimeBuffers->mMedusaBuffers, copyManager);
+
+    if (overlapLogitsCopy)
+    {
+        runtime::CudaEvent copiesDone{};
+        mCopyBufferManager.getStream().record(copiesDone);
+        mRuntime->getBufferManager().getStream().wait(copiesDone);
+    }
 
     if (mOperatingBeamWidth > 1)
     {
@@ -2254,8 +2603,20 @@ runtime::CudaEvent TrtGptModelInflightBatching::decoderStepAsync(ScheduledReques
     auto decoderFinishEvent = mDecoder->forwardAsync(*mDecoderState, decoderInputBuffers);
 
     auto const returnLogProbs = batchReturnLogProbs(scheduledRequests);
+    // One past the highest sequence slot scheduled in this iteration, bounding the slot-major
+    // decoder output copies to the occupied prefix.
+    SizeType32 numActiveSeqSlots{0};
+    for (auto const& requests : {scheduledRequests.contextRequests, scheduledRequests.generationRequests})
+    {
+        for (auto const& llmReq : requests)
+        {
+            numActiveSeqSlots = std::max(numActiveSeqSlots, llmReq->mSeqSlot.value() + 1);
+        }
+    }
+    // Chain the decoder output copies on the copy stream, so they overlap with runtime stream work instead of
+    // blocking it behind sampling.
     auto updateDecoderBuffersEvent = (*mUpdateDecoderBuffers)(mModelConfig, mDecoderOutputBuffers.at(fusedBufferId),
-        mRuntime->getBufferManager(), *mDecoderState, returnLogProbs, decoderFinishEvent);
+        mCopyBufferManager, *mDecoderState, returnLogProbs, numActiveSeqSlots, decoderFinishEvent);
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
     return updateDecoderBuffersEvent;
@@ -2369,6 +2730,7 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(updateRequests);
+    TLLM_STAGE_TRACE(updateRequests);
 
     auto const& decoderOutputBuffers = mDecoderOutputBuffers.at(getFusedBufferId());
 
@@ -2382,6 +2744,10 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
     auto const* const finishReasonsHostData
         = bufferCast<kernels::FinishedState>(*decoderOutputBuffers.finishReasonsHost);
 
+    SizeType32 numDraftTokensInIter{0};
+    SizeType32 numAcceptedDraftTokensInIter{0};
+    SizeType32 numRequestsWithDraftTokensInIter{0};
+
     // Update only requests that ran through the decoder
     for (auto const& llmReq : scheduledRequests.generationRequests)
     {
@@ -2462,6 +2828,15 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
         // Set number of tokens predicted per runtime iteration. Will be > 1 for speculative decoding.
         llmReq->updateNumTokensPerIteration(llmReq->getMaxBeamNumTokens() - currentNumOfTokens, mModelConfig);
 
+        // Accumulate draft token acceptance for the iteration stats. numGeneratedTokens still reflects
+        // the draft tokens that entered this step; the new drafts are only filled in below.
+        if (auto const numDraftTokensInStep = numGeneratedTokens - 1; numDraftTokensInStep > 0)
+        {
+            numDraftTokensInIter += numDraftTokensInStep;
+            numAcceptedDraftTokensInIter += std::min(llmReq->getNumTokensPerIteration() - 1, numDraftTokensInStep);
+            numRequestsWithDraftTokensInIter += 1;
+        }
+
         // Fill new draft tokens for the next step
         if (decoderFinishedSumPtr[seqSlot] != reqBeamWidth
             && (mModelConfig.getSpeculativeDecodingMode().predictsDraftTokens()
@@ -2589,6 +2964,13 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
         rewindKVCacheBlocks(numSequences);
     }
 
+    if (!mModelConfig.getSpeculativeDecodingMode().isNone())
+    {
+        mLastIterNumDraftTokens = numDraftTokensInIter;
+        mLastIterNumAcceptedDraftTokens = numAcceptedDraftTokensInIter;
+        mLastIterNumRequestsWithDraftTokens = numRequestsWithDraftTokensInIter;
+    }
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -2597,6 +2979,7 @@ std::vector<std::unique_ptr<DecoderStepAsyncSend>> TrtGptModelInflightBatching::
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(decoderSync);
+    TLLM_STAGE_TRACE(decoderSync);
 
     if (mWorldConfig.isLastPipelineParallelRank())
     {
@@ -2860,6 +3243,23 @@ void TrtGptModelInflightBatching::getCurrentIterationStats(executor::IterationSt
     modelStats.numCtxTokens = mLastIterationStatsIFB.numCtxTokens;
     modelStats.microBatchId = mLastIterationStatsIFB.microBatchId;
     stats.inflightBatchingStats = modelStats;
+
+    if (!mModelConfig.getSpeculativeDecodingMode().isNone())
+    {
+        executor::SpecDecodingStats specDecStats{};
+        specDecStats.numDraftTokens = mLastIterNumDraftTokens;
+        specDecStats.numAcceptedTokens = mLastIterNumAcceptedDraftTokens;
+        specDecStats.numRequestsWithDraftTokens = mLastIterNumRequestsWithDraftTokens;
+        specDecStats.acceptanceLength = mLastIterNumRequestsWithDraftTokens > 0
+            ? 1.0
+                + static_cast<double>(mLastIterNumAcceptedDraftTokens)
+                    / static_cast<double>(mLastIterNumRequestsWithDraftTokens)
+            : 1.0;
+        // Draft generation is not timed separately in this path.
+        specDecStats.iterLatencyMS = 0.0;
+        specDecStats.draftOverhead = 0.0;
+        stats.specDecodingStats = specDecStats;
+    }
 }
 
 void TrtGptModelInflightBatching::getCurrentRequestStats(executor::RequestStatsPerIteration& stats) const
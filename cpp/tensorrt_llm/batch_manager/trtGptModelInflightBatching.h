@@ -21,6 +21,7 @@
 #include "tensorrt_llm/batch_manager/kvCacheType.h"
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/executor/types.h"
+#include "tensorrt_llm/runtime/memoryPressureWatchdog.h"
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/rawEngine.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
@@ -29,6 +30,8 @@
 
 #include <NvInferRuntime.h>
 
+#include <chrono>
+
 namespace tensorrt_llm::runtime
 {
 class TllmRuntime;
@@ -280,8 +283,11 @@ private:
     //! @brief Print profile information per layer.
     std::string getLayerProfileInfo() const override;
 
-    std::tuple<SizeType32, TensorMap const&, TensorMap&> prepareBuffers(
-        RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId);
+    //! @param contextIdOffset Offset added to the selected optimization profile id to pick the runtime context the
+    //! tensors are bound to. Non-zero only for the generation phase of concurrent ctx/gen execution, which uses its
+    //! own set of execution contexts.
+    std::tuple<SizeType32, TensorMap const&, TensorMap&> prepareBuffers(RequestVector const& contextRequests,
+        RequestVector const& generationRequests, SizeType32 bufferId, SizeType32 contextIdOffset = 0);
 
     //! @brief Capture graph of current batch state during engine execution.
     //! This is based on the assumptions that
@@ -294,6 +300,13 @@ private:
     void executeStep(
         RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId);
 
+    //! @brief Whether the scheduled batch qualifies for concurrent ctx/gen execution.
+    [[nodiscard]] bool canExecuteCtxGenConcurrently(ScheduledRequests const& scheduledRequests) const;
+
+    //! @brief Execute the context batch on the runtime stream and the generation batch on a separate stream
+    //! concurrently, so a small decode batch is not serialized behind prefill. Only valid in the unfused path.
+    void executeCtxGenConcurrently(ScheduledRequests const& scheduledRequests);
+
     void debugIOTensors(RequestVector const& contextRequests, RequestVector const& generationRequests,
         TensorMap const& inputMap, TensorMap const& outputMap);
 
@@ -312,6 +325,39 @@ private:
     ///        May change operating beam width if all requests agree on same beam width.
     void verifyRequests(RequestList const& activeRequests);
 
+    //! Schedule for the next iteration, computed at the end of forwardAsync while the iteration just
+    //! dispatched still occupies the GPU (TRTLLM_SCHED_SPECULATIVE_OVERLAP). The next forwardAsync
+    //! only consumes it if the fingerprint of the active request set still matches, i.e. no request
+    //! completed, arrived or changed state in between; otherwise it schedules from scratch.
+    struct SpeculativeSchedule
+    {
+        //! One entry per active request: (request id, state, context position). Token counts are
+        //! deliberately not part of the fingerprint: with the guaranteed-no-evict policy the block
+        //! demand to completion is independent of the current token count, so the single decoder
+        //! step between speculation and reuse does not change the schedule.
+        using Fingerprint = std::vector<std::tuple<RequestIdType, LlmRequestState, SizeType32>>;
+
+        Fingerprint fingerprint;
+        SizeType32 maxBatchSize{0};
+        std::optional<SizeType32> maxNumTokens;
+        SizeType32 operatingBeamWidth{0};
+        RequestVector fittingRequests;
+        RequestVector requestsToPause;
+        RequestVector contextRequests;
+        RequestVector generationRequests;
+    };
+
+    /// @brief Whether the current configuration allows overlapping next-iteration scheduling with
+    ///        engine execution.
+    [[nodiscard]] bool canScheduleSpeculatively() const;
+
+    /// @brief Fingerprint of the scheduler-visible request state backing a speculative schedule.
+    [[nodiscard]] static SpeculativeSchedule::Fingerprint schedulingFingerprint(RequestList const& activeRequests);
+
+    /// @brief Compute the schedule for the next iteration while the engine still executes the
+    ///        current one, so the serial host-side scheduling cost is hidden behind the GPU.
+    void scheduleNextIterationSpeculatively(RequestList const& activeRequests);
+
     /// @brief Change the operating beam width.
     ///        Only possible if no requests are currently in-flight.
     /// @param beamWidth New operating beam width. Must be smaller than initial maxBeamWidth.
@@ -542,6 +588,11 @@ private:
     /******************** Runtime parameters ********************/
     // Flag to select fused or unfused context+generation execution
     bool mCtxGenFusion;
+    // Execute unfused context and generation batches concurrently on separate streams.
+    // Opt-in via TRTLLM_CONCURRENT_CTX_GEN_EXECUTION; only effective when mCtxGenFusion is false.
+    bool mCtxGenConcurrentExecution{false};
+    // Stream the generation batch is enqueued on when concurrent execution is enabled.
+    runtime::BufferManager::CudaStreamPtr mCtxGenConcurrentStream;
     // ID of current micro batch, changes after each iteration
     SizeType32 mMicroBatchId{0};
     // Number of micro batches. Multiple batches are used for overlapping setup and execution,
@@ -563,6 +614,9 @@ private:
     SizeType32 mMaxNumTokensTunerRecommended;
     /// The min of mMaxNumTokens and mMaxNumTokensTunerRecommended
     std::optional<SizeType32> mMaxNumTokensRuntime;
+    // Monitors device memory headroom and sheds load under pressure. Only set when
+    // TRTLLM_ENABLE_MEMORY_PRESSURE_WATCHDOG is enabled.
+    std::optional<runtime::MemoryPressureWatchdog> mMemoryPressureWatchdog;
     // Controls if generation logits should be gathered, so that returnGenerationLogits can be requested.
     bool mGatherGenerationLogits{false};
     // offloading and prefetching the prompt tuning table (only effective in chunked prefill mode)
@@ -583,12 +637,33 @@ private:
     /******************** Book keeping ********************/
     // List of requests in each micro batch
     std::vector<ScheduledRequests> mMicroBatchScheduledRequests;
+    // Dispatch timestamp and scheduled token counts of each micro batch, recorded in forwardAsync
+    // and consumed in forwardSync by the adaptive context-chunk controller and by per-request
+    // GPU-time attribution.
+    struct MicroBatchDispatchInfo
+    {
+        std::chrono::steady_clock::time_point time;
+        SizeType32 numCtxTokens{0};
+        // Total scheduled tokens across the batch (context chunk tokens plus decoded tokens),
+        // used as the denominator when splitting the measured iteration latency.
+        SizeType32 numTotalTokens{0};
+        // Scheduled token count per request, populated only for requests that asked for perf metrics.
+        std::unordered_map<RequestIdType, SizeType32> tokensPerRequest;
+    };
+
+    std::vector<MicroBatchDispatchInfo> mMicroBatchDispatchInfos;
     // Set of in-flight requests of *all* micro batches
     ReqIdsSet mInflightReqIds;
     // Requests that should be terminated (requested from outside the model)
     std::unordered_map<RequestIdType, executor::FinishReason> mReqIdsToTerminate;
     // Requests that the scheduler selected to be paused
     ReqIdsSet mReqIdsToPause;
+    // Speculative schedule for the next iteration, see scheduleNextIterationSpeculatively.
+    std::optional<SpeculativeSchedule> mSpeculativeSchedule;
+    // Static eligibility for speculative scheduling (env flag, capacity scheduler policy, micro
+    // batch count, speculative decoding mode); dynamic conditions are checked per iteration in
+    // canScheduleSpeculatively.
+    bool mSpeculativeSchedulingEnabled{false};
     // Stats collected in last iteration
     IterationStatsIFB mLastIterationStatsIFB{-1};
     // Iteration counter used to distinguish debug output
@@ -611,6 +686,11 @@ private:
     SizeType32 mSeamlessLADMaxDraftLen{0};
     bool mUseSeamlessLookahead{false};
     RewindInputs mRewindInputs;
+    // Draft token acceptance counters from the most recent decoder sync,
+    // surfaced through executor::SpecDecodingStats in the iteration stats.
+    SizeType32 mLastIterNumDraftTokens{0};
+    SizeType32 mLastIterNumAcceptedDraftTokens{0};
+    SizeType32 mLastIterNumRequestsWithDraftTokens{0};
 
     /******************** Algorithms ********************/
     // Algorithms are reentrant, they are assigned a state at
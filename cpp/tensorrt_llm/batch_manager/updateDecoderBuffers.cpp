@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,9 +17,13 @@
 
 #include "tensorrt_llm/batch_manager/updateDecoderBuffers.h"
 #include "tensorrt_llm/batch_manager/decoderBuffers.h"
+#include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/runtime/decoderState.h"
 #include "tensorrt_llm/runtime/iTensor.h"
+#include "tensorrt_llm/runtime/runtimeKernels.h"
+
+#include <vector>
 
 namespace tensorrt_llm::batch_manager
 {
@@ -31,43 +35,69 @@ using SizeType32 = tensorrt_llm::runtime::SizeType32;
 
 runtime::CudaEvent UpdateDecoderBuffers::operator()(runtime::ModelConfig const& modelConfig,
     DecoderOutputBuffers& decoderOutputBuffers, runtime::BufferManager const& copyBufferManager,
-    runtime::decoder::DecoderState const& decoderState, bool returnLogProbs,
+    runtime::decoder::DecoderState const& decoderState, bool returnLogProbs, SizeType32 numActiveSeqSlots,
     runtime::CudaEvent const& decoderFinishEvent) const
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE(updateDecoderBuffers);
+    NVTX3_SCOPED_RANGE_IN_DOMAIN(kDECODER, updateDecoderBuffers);
 
     // Chain copy after decoder event, using a different stream
     copyBufferManager.getStream().wait(decoderFinishEvent);
 
-    copyBufferManager.copy(*decoderState.getAllNewTokens(), *decoderOutputBuffers.newOutputTokensHost);
-    copyBufferManager.copy(*decoderState.getSequenceLengths(), *decoderOutputBuffers.sequenceLengthsHost);
+    // The buffers below are slot-major and the slot manager hands out the lowest free slot first,
+    // so the active requests occupy a dense prefix. Copying only [0, numActiveSeqSlots) keeps the
+    // device-to-host traffic proportional to the live batch instead of the max batch size. The host
+    // consumers index by sequence slot, so stale rows beyond the prefix are never read. The new
+    // tokens keep the full copy, since their slot dimension is not outermost.
+    //
+    // All readbacks target pinned host memory, so instead of one memcpy launch per tensor they are
+    // collected into a descriptor table and issued as a single kernel launch on the copy stream.
+    std::vector<runtime::kernels::CopyRegionDesc> copyDescs;
+    auto const addCopy = [&copyDescs](ITensor const& src, ITensor& dst)
+    {
+        TLLM_CHECK(src.getSizeInBytes() == dst.getSizeInBytes());
+        copyDescs.push_back({src.data(), dst.data(), src.getSizeInBytes()});
+    };
+    addCopy(*decoderState.getAllNewTokens(), *decoderOutputBuffers.newOutputTokensHost);
+    addCopy(*ITensor::slice(decoderState.getSequenceLengths(), 0, numActiveSeqSlots),
+        *ITensor::slice(decoderOutputBuffers.sequenceLengthsHost, 0, numActiveSeqSlots));
 
     auto const finishedSumDevice = decoderState.getFinishedSum();
-    copyBufferManager.copy(*finishedSumDevice, *decoderOutputBuffers.finishedSumHost);
+    addCopy(*ITensor::slice(finishedSumDevice, 0, numActiveSeqSlots),
+        *ITensor::slice(decoderOutputBuffers.finishedSumHost, 0, numActiveSeqSlots));
     auto const finishReasonsDevice = decoderState.getFinishReasons();
-    copyBufferManager.copy(*finishReasonsDevice, *decoderOutputBuffers.finishReasonsHost);
+    addCopy(*ITensor::slice(finishReasonsDevice, 0, numActiveSeqSlots),
+        *ITensor::slice(decoderOutputBuffers.finishReasonsHost, 0, numActiveSeqSlots));
 
     if (returnLogProbs)
     {
-        copyBufferManager.copy(*decoderState.getCumLogProbs(), *decoderOutputBuffers.cumLogProbsHost);
-        copyBufferManager.copy(*decoderState.getLogProbs(), *decoderOutputBuffers.logProbsHost);
+        addCopy(*ITensor::slice(decoderState.getCumLogProbs(), 0, numActiveSeqSlots),
+            *ITensor::slice(decoderOutputBuffers.cumLogProbsHost, 0, numActiveSeqSlots));
+        addCopy(*ITensor::slice(decoderState.getLogProbs(), 0, numActiveSeqSlots),
+            *ITensor::slice(decoderOutputBuffers.logProbsHost, 0, numActiveSeqSlots));
     }
 
     if (modelConfig.getSpeculativeDecodingMode().predictsDraftTokens())
     {
         // TODO: keep data on device for next iteration
-        copyBufferManager.copy(*decoderState.getNextDraftTokens(), *decoderOutputBuffers.nextDraftTokensHost);
+        addCopy(*ITensor::slice(decoderState.getNextDraftTokens(), 0, numActiveSeqSlots),
+            *ITensor::slice(decoderOutputBuffers.nextDraftTokensHost, 0, numActiveSeqSlots));
 
         if (modelConfig.getSpeculativeDecodingMode().variableDraftLength())
         {
-            copyBufferManager.copy(
-                *decoderState.getNextDraftTokensLengths(), *decoderOutputBuffers.nextDraftTokensLengthsHost);
-            copyBufferManager.copy(
-                *decoderState.getPrevDraftTokensLengths(), *decoderOutputBuffers.prevDraftTokensLengthsHost);
+            addCopy(*ITensor::slice(decoderState.getNextDraftTokensLengths(), 0, numActiveSeqSlots),
+                *ITensor::slice(decoderOutputBuffers.nextDraftTokensLengthsHost, 0, numActiveSeqSlots));
+            addCopy(*ITensor::slice(decoderState.getPrevDraftTokensLengths(), 0, numActiveSeqSlots),
+                *ITensor::slice(decoderOutputBuffers.prevDraftTokensLengthsHost, 0, numActiveSeqSlots));
         }
     }
 
+    auto descTable = copyBufferManager.gpu(copyDescs.size() * sizeof(runtime::kernels::CopyRegionDesc));
+    copyBufferManager.copy(copyDescs.data(), *descTable);
+    runtime::kernels::invokeCopyRegionsBatch(
+        reinterpret_cast<runtime::kernels::CopyRegionDesc const*>(descTable->data()),
+        static_cast<SizeType32>(copyDescs.size()), copyBufferManager.getStream());
+
     runtime::CudaEvent copyEvent{};
     copyBufferManager.getStream().record(copyEvent);
     // Store the event for later sync. Sync stream before calling next decoder. Sync host before updating requests.
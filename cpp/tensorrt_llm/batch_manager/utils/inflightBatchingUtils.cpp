@@ -16,6 +16,8 @@
  */
 
 #include "inflightBatchingUtils.h"
+#include "tensorrt_llm/kernels/decodingCommon.h"
+#include "tensorrt_llm/kernels/topkLastDim.h"
 #include "tensorrt_llm/runtime/runtimeKernels.h"
 
 namespace tensorrt_llm::batch_manager::utils
@@ -45,6 +47,12 @@ void sortRequests(RequestVector& contextRequests, RequestVector& generationReque
 
     auto sortByLoraId = [](RequestVector::iterator begin, RequestVector::iterator end)
     {
+        // In the common no-LoRA case every key is nullopt, so the sort is a semantic no-op;
+        // skip the O(n log n) pass (and any reshuffling of equal keys by the unstable sort).
+        if (std::none_of(begin, end, [](auto const& llmReq) { return llmReq->getLoraTaskId().has_value(); }))
+        {
+            return;
+        }
         std::sort(
             begin, end, [](auto const& lhs, auto const& rhs) { return lhs->getLoraTaskId() < rhs->getLoraTaskId(); });
     };
@@ -134,6 +142,112 @@ void copyGenerationLogits(RuntimeBuffers::GenerationLogitsCache& generationLogit
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+void computeTopLogprobs(
+    TensorPtr const& logitsView, LlmRequest& llmReq, SizeType32 hostOffset, runtime::BufferManager const& manager)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    auto const k = llmReq.getNumTopLogprobs();
+    auto const& logitsShape = logitsView->getShape();
+    auto const numRows = static_cast<SizeType32>(logitsShape.d[0]);
+    auto const vocabSizePadded = static_cast<SizeType32>(logitsShape.d[logitsShape.nbDims - 1]);
+    TLLM_CHECK_WITH_INFO(
+        logitsView->getDataType() == nvinfer1::DataType::kFLOAT, "numTopLogprobs requires float logits");
+
+    // Run the softmax on a scratch copy so the decoder still sees the raw logits.
+    auto probs = manager.gpu(ITensor::makeShape({numRows, vocabSizePadded}), nvinfer1::DataType::kFLOAT);
+    manager.copy(*logitsView, *probs);
+
+    auto const stream = manager.getStream().get();
+    kernels::BiasSoftmaxParams<float> biasSoftmaxParams;
+    biasSoftmaxParams.logits = runtime::bufferCast<float>(*probs);
+    biasSoftmaxParams.probs = runtime::bufferCast<float>(*probs);
+    biasSoftmaxParams.batchSize = numRows;
+    biasSoftmaxParams.maxBatchSize = numRows;
+    biasSoftmaxParams.maxBeamWidth = 1;
+    biasSoftmaxParams.vocabSize = vocabSizePadded;
+    biasSoftmaxParams.vocabSizePadded = vocabSizePadded;
+    kernels::invokeAddBiasSoftMax(biasSoftmaxParams, stream);
+
+    auto const workspaceSize = kernels::invokeComputeTopkLastDimWorkspaceSize<float>(numRows, vocabSizePadded, k, true);
+    auto workspace = manager.gpu(workspaceSize);
+    auto topVals = manager.gpu(ITensor::makeShape({numRows, k}), nvinfer1::DataType::kFLOAT);
+    auto topIds = manager.gpu(ITensor::makeShape({numRows, k}), nvinfer1::DataType::kINT32);
+    kernels::invokeTopkLastDim<float>(
+        numRows, vocabSizePadded, k, true, probs->data(), topVals->data(), topIds->data(), workspace->data(), stream);
+
+    // The copies are small (k values per row); the log is taken on host when the result is assembled.
+    auto valsHostView = ITensor::slice(llmReq.getTopLogprobsValsHost(), hostOffset, numRows);
+    auto idsHostView = ITensor::slice(llmReq.getTopLogprobsIdsHost(), hostOffset, numRows);
+    manager.copy(*topVals, *valsHostView);
+    manager.copy(*topIds, *idsHostView);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
+void computePromptLogprobs(TensorPtr const& logitsView, LlmRequest& llmReq, runtime::BufferManager const& manager)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    auto const& logitsShape = logitsView->getShape();
+    auto const numRows = static_cast<SizeType32>(logitsShape.d[0]);
+    auto const vocabSizePadded = static_cast<SizeType32>(logitsShape.d[logitsShape.nbDims - 1]);
+    TLLM_CHECK_WITH_INFO(
+        logitsView->getDataType() == nvinfer1::DataType::kFLOAT, "promptLogprobs requires float logits");
+
+    // Row p predicts prompt token p + 1; the last row of the final chunk predicts the first generated
+    // token and has no teacher-forced target.
+    auto const beginCompute = llmReq.getContextCurrentPosition();
+    auto const numTargets = std::min(numRows, llmReq.mPromptLen - 1 - beginCompute);
+    if (numTargets <= 0)
+    {
+        return;
+    }
+
+    // Run the softmax on a scratch copy so the decoder still sees the raw logits.
+    auto probs = manager.gpu(ITensor::makeShape({numRows, vocabSizePadded}), nvinfer1::DataType::kFLOAT);
+    manager.copy(*logitsView, *probs);
+
+    auto const stream = manager.getStream().get();
+    kernels::BiasSoftmaxParams<float> biasSoftmaxParams;
+    biasSoftmaxParams.logits = runtime::bufferCast<float>(*probs);
+    biasSoftmaxParams.probs = runtime::bufferCast<float>(*probs);
+    biasSoftmaxParams.batchSize = numRows;
+    biasSoftmaxParams.maxBatchSize = numRows;
+    biasSoftmaxParams.maxBeamWidth = 1;
+    biasSoftmaxParams.vocabSize = vocabSizePadded;
+    biasSoftmaxParams.vocabSizePadded = vocabSizePadded;
+    kernels::invokeAddBiasSoftMax(biasSoftmaxParams, stream);
+
+    // Gather the probability of each target token with the batched copy kernel; the tokens are known
+    // on host, so the source offsets can be computed here.
+    auto const& tokens = llmReq.getTokens(0);
+    std::vector<int64_t> srcOffsetsHost(numTargets);
+    std::vector<int64_t> dstOffsetsHost(numTargets);
+    std::vector<int64_t> sizesHost(numTargets, 1);
+    for (SizeType32 i = 0; i < numTargets; ++i)
+    {
+        srcOffsetsHost[i] = static_cast<int64_t>(i) * vocabSizePadded + tokens.at(beginCompute + 1 + i);
+        dstOffsetsHost[i] = i;
+    }
+    auto const offsetsShape = ITensor::makeShape({numTargets});
+    auto srcOffsets = manager.gpu(offsetsShape, nvinfer1::DataType::kINT64);
+    auto dstOffsets = manager.gpu(offsetsShape, nvinfer1::DataType::kINT64);
+    auto sizes = manager.gpu(offsetsShape, nvinfer1::DataType::kINT64);
+    manager.copy(srcOffsetsHost.data(), *srcOffsets);
+    manager.copy(dstOffsetsHost.data(), *dstOffsets);
+    manager.copy(sizesHost.data(), *sizes);
+
+    auto targetProbs = manager.gpu(offsetsShape, nvinfer1::DataType::kFLOAT);
+    runtime::kernels::invokeCopyBatch(*probs, *targetProbs, *srcOffsets, *dstOffsets, *sizes, 1, manager.getStream());
+
+    // The copy is small (one value per prompt token); the log is taken on host when the result is assembled.
+    auto hostView = ITensor::slice(llmReq.getPromptLogprobsHost(), beginCompute + 1, numTargets);
+    manager.copy(*targetProbs, *hostView);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 namespace
 {
 
@@ -396,6 +510,18 @@ void CudaGraphExecutorCache::put(BatchState const& state, std::shared_ptr<CudaGr
     }
 }
 
+std::shared_ptr<CudaGraphExecutor> CudaGraphExecutorCache::extractLeastRecentlyUsed()
+{
+    if (static_cast<runtime::SizeType32>(mMap.size()) < mCapacity || mCache.empty())
+    {
+        return nullptr;
+    }
+    auto executor = mCache.back().second;
+    mMap.erase(mCache.back().first);
+    mCache.pop_back();
+    return executor;
+}
+
 void CudaGraphExecutorCache::clear()
 {
     // Releasing the shared_ptrs runs ~CudaGraphExecutor, which calls
@@ -57,6 +57,20 @@ void copyGenerationLogits(RuntimeBuffers::GenerationLogitsCache& generationLogit
     runtime::BufferManager const& bufferManager, LlmRequest& llmReq, bool beforeDecoder,
     std::vector<SizeType32> const& numDroppedTokens = {});
 
+//! @brief Compute the top numTopLogprobs probabilities for each row of logitsView on device and copy the
+//!        (probability, token id) pairs to the request's pinned top-logprobs host buffers.
+//! @param logitsView Device logits [numRows, vocabSizePadded], float.
+//! @param hostOffset First generated-token row in the host buffers to write to.
+void computeTopLogprobs(
+    TensorPtr const& logitsView, LlmRequest& llmReq, SizeType32 hostOffset, runtime::BufferManager const& manager);
+
+//! @brief Compute the teacher-forced probability of each prompt token in the current context chunk on
+//!        device and copy it to the request's pinned prompt-logprobs host buffer: row p of logitsView
+//!        holds the logits after prompt token p, from which the probability of prompt token p + 1 is
+//!        gathered.
+//! @param logitsView Device context logits of the current chunk [contextChunkSize, vocabSizePadded], float.
+void computePromptLogprobs(TensorPtr const& logitsView, LlmRequest& llmReq, runtime::BufferManager const& manager);
+
 void copyAdditionalOutputs(std::vector<executor::AdditionalModelOutput> const& additionalModelOutputs,
     RequestVector const& contextRequests, RequestVector const& generationRequests,
     RuntimeBuffers::TensorMap const& outputMap, runtime::BufferManager const& manager);
@@ -116,6 +130,11 @@ public:
 
     void put(BatchState const& state, std::shared_ptr<CudaGraphExecutor> const& value);
 
+    //! @brief Remove the least recently used entry and return its executor for reuse, if the cache is at
+    //! capacity. The returned executor keeps its instantiated graph, so the next capture can refresh it
+    //! with cudaGraphExecUpdate instead of instantiating from scratch. Returns nullptr below capacity.
+    [[nodiscard]] std::shared_ptr<CudaGraphExecutor> extractLeastRecentlyUsed();
+
     void clear();
 
     [[nodiscard]] runtime::SizeType32 size() const noexcept
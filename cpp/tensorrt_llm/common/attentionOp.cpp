@@ -1377,8 +1377,7 @@ int AttentionOp::enqueueContext(EnqueueContextParams<T> const& params, cudaStrea
         kv_scale_cache_buffer = buffers.kvScaleCacheBuffer;
     }
 
-    auto cublasHandle = mCublasWrapper->getCublasHandle();
-    TLLM_CUDA_CHECK(cublasSetStream(cublasHandle, stream));
+    // setStream binds the per-stream cuBLAS handle, so no explicit cublasSetStream is needed.
     mCublasWrapper->setStream(stream);
     mCublasWrapper->setWorkspace(params.workspace);
     if constexpr (std::is_same_v<T, half>)
@@ -1777,9 +1776,11 @@ int AttentionOp::enqueueContext(EnqueueContextParams<T> const& params, cudaStrea
             params.mla_param->absorption_mode = useSparseMLA();
             if (params.mla_param->latent_cache != nullptr)
             {
-                invokeMLARopeContext<T, KVCacheBuffer>(*params.mla_param, kv_cache_buffer, stream);
+                // Applies RoPE, appends the KV cache and (for FP8 context FMHA) quantizes q/k/v.
+                invokeMLARopeContext<T, KVCacheBuffer>(
+                    *params.mla_param, kv_cache_buffer, params.total_kv_len, stream);
             }
-            if (mFP8ContextMLA)
+            else if (mFP8ContextMLA)
             {
                 invokeMLAContextFp8Quantize(*params.mla_param, params.total_kv_len, stream);
             }
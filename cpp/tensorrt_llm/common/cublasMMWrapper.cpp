@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include "tensorrt_llm/common/config.h"
 #include "tensorrt_llm/common/cublasVersionCheck.h"
 #include <algorithm>
+#include <memory>
 #include <unordered_map>
 
 #ifndef CUDART_VERSION
@@ -39,7 +40,67 @@ CublasMMWrapper::CublasMMWrapper(std::shared_ptr<cublasHandle_t> cublasHandle,
 {
 }
 
-CublasMMWrapper::~CublasMMWrapper() {}
+CublasMMWrapper::~CublasMMWrapper()
+{
+    for (auto& slot : mStreamPool)
+    {
+        auto* resources = slot.load(std::memory_order_acquire);
+        if (resources == nullptr)
+        {
+            break;
+        }
+        cublasDestroy(resources->handle);
+        delete resources;
+    }
+}
+
+CublasMMWrapper::PerStreamResources* CublasMMWrapper::acquireStreamResources(cudaStream_t stream)
+{
+    // Lock-free fast path: entries are append-only and fully initialized before being published.
+    for (int idx = 0; idx < kStreamPoolCapacity; ++idx)
+    {
+        auto* resources = mStreamPool[idx].load(std::memory_order_acquire);
+        if (resources == nullptr)
+        {
+            break;
+        }
+        if (resources->stream == stream)
+        {
+            return resources;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mStreamPoolMutex);
+    int idx = 0;
+    for (; idx < kStreamPoolCapacity; ++idx)
+    {
+        auto* resources = mStreamPool[idx].load(std::memory_order_relaxed);
+        if (resources == nullptr)
+        {
+            break;
+        }
+        if (resources->stream == stream)
+        {
+            return resources;
+        }
+    }
+    if (idx == kStreamPoolCapacity)
+    {
+        TLLM_LOG_WARNING(
+            "CublasMMWrapper per-stream handle pool is full (%d streams); stream %p falls back to the shared "
+            "cuBLAS handle with per-call stream binding.",
+            kStreamPoolCapacity, stream);
+        return nullptr;
+    }
+
+    auto resources = std::make_unique<PerStreamResources>();
+    resources->stream = stream;
+    check_cuda_error(cublasCreate(&resources->handle));
+    // Bind the handle to its stream once; the GEMM hot path never calls cublasSetStream again.
+    check_cuda_error(cublasSetStream(resources->handle, stream));
+    mStreamPool[idx].store(resources.get(), std::memory_order_release);
+    return resources.release();
+}
 
 CublasMMWrapper::CublasMMWrapper(CublasMMWrapper const& wrapper)
     : mCublasHandle(wrapper.mCublasHandle)
@@ -219,8 +280,12 @@ void CublasMMWrapper::Gemm(cublasOperation_t transa, cublasOperation_t transb, i
     }
     else
     {
-        check_cuda_error(cublasSetStream(getCublasHandle(), mStream));
-        check_cuda_error(cublasSetWorkspace(getCublasHandle(), mCublasWorkspace, workspaceSize));
+        if (mCurrentResources == nullptr)
+        {
+            // Shared-handle fallback: rebind stream and workspace around the call, as before.
+            check_cuda_error(cublasSetStream(getCublasHandle(), mStream));
+            check_cuda_error(cublasSetWorkspace(getCublasHandle(), mCublasWorkspace, workspaceSize));
+        }
         // Go with default heuristic to choose tactic as cuBLAS does not allow to choose tactics in Ampere+
         cublasGemmAlgo_t cublasAlgo = CUBLAS_GEMM_DEFAULT;
         check_cuda_error(cublasGemmEx(getCublasHandle(), transa, transb, m, n, k, alpha, A, mAType, lda, B, mBType, ldb,
@@ -241,6 +306,10 @@ void CublasMMWrapper::stridedBatchedGemm(cublasOperation_t transa, cublasOperati
     void const* alpha = isFp16ComputeType ? reinterpret_cast<void*>(&h_alpha) : reinterpret_cast<void const*>(&f_alpha);
     void const* beta = isFp16ComputeType ? reinterpret_cast<void*>(&h_beta) : reinterpret_cast<void const*>(&f_beta);
 
+    if (mCurrentResources == nullptr)
+    {
+        check_cuda_error(cublasSetStream(getCublasHandle(), mStream));
+    }
     check_cuda_error(cublasGemmStridedBatchedEx(getCublasHandle(), transa, transb, m, n, k, alpha, A, mAType, lda,
         strideA, B, mBType, ldb, strideB, beta, C, mCType, ldc, strideC, batchCount, mComputeType,
         mAType == CUDA_R_32F ? CUBLAS_GEMM_DEFAULT : CUBLAS_GEMM_DEFAULT_TENSOR_OP));
@@ -258,6 +327,10 @@ void CublasMMWrapper::stridedBatchedGemm(cublasOperation_t transa, cublasOperati
     void const* alpha = isFp16ComputeType ? reinterpret_cast<void*>(&h_alpha) : reinterpret_cast<void const*>(&f_alpha);
     void const* beta = isFp16ComputeType ? reinterpret_cast<void*>(&h_beta) : reinterpret_cast<void const*>(&f_beta);
 
+    if (mCurrentResources == nullptr)
+    {
+        check_cuda_error(cublasSetStream(getCublasHandle(), mStream));
+    }
     check_cuda_error(cublasGemmStridedBatchedEx(getCublasHandle(), transa, transb, m, n, k, alpha, A, AType, lda,
         strideA, B, BType, ldb, strideB, beta, C, CType, ldc, strideC, batchCount, computeType,
         mAType == CUDA_R_32F ? CUBLAS_GEMM_DEFAULT : CUBLAS_GEMM_DEFAULT_TENSOR_OP));
@@ -266,6 +339,14 @@ void CublasMMWrapper::stridedBatchedGemm(cublasOperation_t transa, cublasOperati
 void CublasMMWrapper::setWorkspace(void* workspace)
 {
     mCublasWorkspace = workspace;
+    if (mCurrentResources != nullptr && mCurrentResources->workspace != workspace)
+    {
+        // The per-stream handle is private to its stream, so this never touches handle state
+        // shared with another stream.
+        check_cuda_error(cublasSetWorkspace(
+            mCurrentResources->handle, workspace, workspace == nullptr ? 0 : CUBLAS_WORKSPACE_SIZE));
+        mCurrentResources->workspace = workspace;
+    }
 }
 
 void CublasMMWrapper::setFP32GemmConfig()
@@ -349,6 +430,10 @@ CublasDataType CublasMMWrapper::getCublasDataType(cudaDataType_t data_type)
 
 void CublasMMWrapper::setStream(cudaStream_t stream)
 {
+    if (mCurrentResources == nullptr || mCurrentResources->stream != stream)
+    {
+        mCurrentResources = acquireStreamResources(stream);
+    }
     mStream = stream;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,10 +18,13 @@
 
 #include "tensorrt_llm/common/config.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include <array>
+#include <atomic>
 #include <cublasLt.h>
 #include <cublas_v2.h>
 #include <cuda_runtime.h>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -51,7 +54,27 @@ protected:
 
     void* mCublasWorkspace = nullptr;
 
+    //! A lazily created cuBLAS handle dedicated to one stream. The handle is bound to its stream
+    //! once at creation, so the GEMM hot path never rebinds shared handle state with
+    //! cublasSetStream and concurrent streams (context/generation overlap) do not contend.
+    struct PerStreamResources
+    {
+        cudaStream_t stream{};
+        cublasHandle_t handle{};
+        void* workspace{};
+    };
+
+    //! Per-stream handle pool. Entries are append-only and published with release semantics, so
+    //! lookups are lock-free; the mutex only serializes lazy creation. When more distinct streams
+    //! than slots are seen, the extra streams fall back to the shared handle with per-call rebinds.
+    static constexpr int kStreamPoolCapacity = 8;
+    std::array<std::atomic<PerStreamResources*>, kStreamPoolCapacity> mStreamPool{};
+    std::mutex mStreamPoolMutex;
+    PerStreamResources* mCurrentResources{nullptr};
+
 private:
+    PerStreamResources* acquireStreamResources(cudaStream_t stream);
+
     bool descriptorsCreated() const
     {
         return mOperationDesc != NULL && mADesc != NULL && mBDesc != NULL && mCDesc != NULL;
@@ -153,9 +176,11 @@ public:
     void setBiasDescriptor(void* bias);
     void destroyDescriptors();
 
+    //! Returns the handle for the stream selected by the last setStream() call (already bound to
+    //! that stream), or the shared construction-time handle when no per-stream entry is active.
     cublasHandle_t getCublasHandle()
     {
-        return *(this->mCublasHandle);
+        return mCurrentResources != nullptr ? mCurrentResources->handle : *(this->mCublasHandle);
     }
 
     cublasLtHandle_t getCublasLtHandle() const
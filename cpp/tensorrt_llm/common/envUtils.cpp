@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -20,6 +20,7 @@
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/stringUtils.h"
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <mutex>
@@ -176,6 +177,12 @@ std::optional<int> getEnvXqaBlocksPerSequence()
     return xqaBlocksPerSeq;
 }
 
+std::string const& getEnvXqaCubinCacheDir()
+{
+    static std::string cacheDir = getStrEnv("TRTLLM_XQA_CUBIN_CACHE_DIR").value_or("");
+    return cacheDir;
+}
+
 // Tune the number of blocks per sequence for accuracy/performance purpose.
 bool getEnvMmhaMultiblockDebug()
 {
@@ -283,6 +290,94 @@ bool getEnvEnableTrtllmgenMoeRoutingRenormPDL()
     return enabled;
 }
 
+float getEnvDynamicBatchTunerTargetIterMs()
+{
+    static float const targetIterMs = []
+    {
+        auto const value = getFloatEnv("TRTLLM_DYNAMIC_BATCH_TARGET_ITER_MS");
+        return value.has_value() && *value > 0.F ? *value : 0.F;
+    }();
+    return targetIterMs;
+}
+
+float getEnvAdaptiveCtxChunkTargetMs()
+{
+    static float const targetMs = []
+    {
+        auto const value = getFloatEnv("TRTLLM_ADAPTIVE_CTX_CHUNK_TARGET_MS");
+        return value.has_value() && *value > 0.F ? *value : 0.F;
+    }();
+    return targetMs;
+}
+
+bool getEnvEngineMmapLoad()
+{
+    static bool const engineMmapLoad = getBoolEnv("TRTLLM_ENGINE_MMAP_LOAD");
+    return engineMmapLoad;
+}
+
+int32_t getEnvEngineLoadPrefetchThreads()
+{
+    static int32_t const prefetchThreads = []
+    {
+        auto const value = getIntEnv("TRTLLM_ENGINE_LOAD_PREFETCH_THREADS");
+        return value.has_value() && *value >= 0 ? *value : 8;
+    }();
+    return prefetchThreads;
+}
+
+int32_t getEnvSafetensorsLoadThreads()
+{
+    static int32_t const loadThreads = []
+    {
+        auto const value = getIntEnv("TRTLLM_SAFETENSORS_LOAD_THREADS");
+        return value.has_value() && *value >= 1 ? *value : 8;
+    }();
+    return loadThreads;
+}
+
+std::string const& getEnvStageTracePath()
+{
+    static std::string const tracePath = getStrEnv("TRTLLM_STAGE_TRACE_PATH").value_or("");
+    return tracePath;
+}
+
+bool getEnvNumaAwareExecutor()
+{
+    static bool const numaAwareExecutor = getBoolEnv("TRTLLM_NUMA_AWARE_EXECUTOR");
+    return numaAwareExecutor;
+}
+
+bool getEnvSharedPagedWorkspace()
+{
+    static bool const sharedPagedWorkspace = getBoolEnv("TRTLLM_SHARED_PAGED_WORKSPACE");
+    return sharedPagedWorkspace;
+}
+
+bool getEnvKVCacheSWARingBuffer()
+{
+    static bool const swaRingBuffer = getBoolEnv("TRTLLM_KV_CACHE_SWA_RING_BUFFER");
+    return swaRingBuffer;
+}
+
+bool getEnvKVCacheSWAEagerFree()
+{
+    static bool const swaEagerFree = getBoolEnv("TRTLLM_KV_CACHE_SWA_EAGER_FREE");
+    return swaEagerFree;
+}
+
+bool getEnvEnableMemoryPressureWatchdog()
+{
+    static bool const memoryPressureWatchdog = getBoolEnv("TRTLLM_ENABLE_MEMORY_PRESSURE_WATCHDOG");
+    return memoryPressureWatchdog;
+}
+
+bool getEnvConcurrentCtxGenExecution()
+{
+    static bool const concurrentCtxGenExecution = getBoolEnv("TRTLLM_CONCURRENT_CTX_GEN_EXECUTION");
+    return concurrentCtxGenExecution;
+}
+
 bool getEnvUseUCXKvCache()
 {
     static bool const useUCXKVCache = getBoolEnv("TRTLLM_USE_UCX_KVCACHE");
@@ -386,6 +481,14 @@ bool getEnvDisaggLayerwise()
     return disaggLayerwise;
 }
 
+bool getEnvKVCacheTransferFp8Wire()
+{
+    // Opt-in; must be set on both the context and the generation endpoints, since each side
+    // derives the on-wire transfer size from it.
+    static bool const kvCacheTransferFp8Wire = getBoolEnv("TRTLLM_KVCACHE_TRANSFER_FP8_WIRE");
+    return kvCacheTransferFp8Wire;
+}
+
 bool getEnvRequestKVCacheConcurrent()
 {
     static bool const requestKVCacheConcurrent = getBoolEnv("TRTLLM_REQUEST_KV_CACHE_CONCURRENT");
@@ -410,6 +513,18 @@ bool getEnvTryZCopyForKVCacheTransfer()
     return zcopyForSysmmetricKVCache;
 }
 
+bool getEnvKVCacheAgentZeroCopy()
+{
+    static bool const agentZeroCopy = getBoolEnv("TRTLLM_KVCACHE_AGENT_ZCOPY");
+    return agentZeroCopy;
+}
+
+bool getEnvNcclCommPoolEnabled()
+{
+    static bool const ncclCommPool = getBoolEnv("TRTLLM_NCCL_COMM_POOL");
+    return ncclCommPool;
+}
+
 bool getEnvForceDeterministic()
 {
     static bool const forceDeterministic = getBoolEnv("FORCE_DETERMINISTIC");
@@ -448,12 +563,58 @@ size_t getEnvAllReduceWorkspaceSize()
     return workspaceSize;
 }
 
+bool getEnvAllReduceCalibration()
+{
+    static bool const allReduceCalibration = getBoolEnv("TRTLLM_ALLREDUCE_CALIBRATION");
+    return allReduceCalibration;
+}
+
+std::string const& getEnvAllReduceCalibrationCacheDir()
+{
+    static std::string const cacheDir = getStrEnv("TRTLLM_ALLREDUCE_CALIBRATION_CACHE_DIR").value_or("");
+    return cacheDir;
+}
+
 std::string const& getEnvKVCacheTimeOutputPath()
 {
     static std::string outputPath = getStrEnv("TRTLLM_KVCACHE_TIME_OUTPUT_PATH").value_or("");
     return outputPath;
 }
 
+std::string const& getEnvKVCachePrewarmPeers()
+{
+    static std::string prewarmPeers = getStrEnv("TRTLLM_KVCACHE_PREWARM_PEERS").value_or("");
+    return prewarmPeers;
+}
+
+std::string const& getEnvCublasAlgoLutFile()
+{
+    static std::string const lutFile = getStrEnv("TRTLLM_CUBLAS_ALGO_LUT_FILE").value_or("");
+    return lutFile;
+}
+
+int32_t getEnvResponsePoolThreads()
+{
+    static int32_t const responsePoolThreads = []
+    {
+        auto const value = getIntEnv("TRTLLM_RESPONSE_POOL_THREADS");
+        return value.has_value() && *value > 0 ? *value : 0;
+    }();
+    return responsePoolThreads;
+}
+
+size_t getEnvPromptTableCacheSizeMb()
+{
+    static size_t const cacheSizeMb = getUInt64Env("TRTLLM_PROMPT_TABLE_CACHE_MB").value_or(0);
+    return cacheSizeMb;
+}
+
+std::string const& getEnvGuidedDecodingPrewarmFile()
+{
+    static std::string prewarmFile = getStrEnv("TRTLLM_GUIDED_DECODING_PREWARM_FILE").value_or("");
+    return prewarmFile;
+}
+
 bool getEnvKVCacheTransferUseAsyncBuffer()
 {
 
@@ -461,6 +622,50 @@ bool getEnvKVCacheTransferUseAsyncBuffer()
     return useAsyncBuffer;
 }
 
+int32_t getEnvCtxComputeTokensCapWithGen()
+{
+    static int32_t const ctxTokensCap = std::max(getIntEnv("TRTLLM_CTX_TOKENS_CAP_WITH_GEN").value_or(0), 0);
+    return ctxTokensCap;
+}
+
+bool getEnvPriorityAwarePreemption()
+{
+    static bool const priorityAwarePreemption = getBoolEnv("TRTLLM_SCHED_PRIORITY_AWARE_PREEMPTION");
+    return priorityAwarePreemption;
+}
+
+int32_t getEnvPrefixAwareAdmissionWindow()
+{
+    static int32_t const admissionWindow
+        = std::max(getIntEnv("TRTLLM_SCHED_PREFIX_AWARE_ADMISSION_WINDOW").value_or(0), 0);
+    return admissionWindow;
+}
+
+bool getEnvDeadlineAwareAdmission()
+{
+    static bool const deadlineAwareAdmission = getBoolEnv("TRTLLM_SCHED_DEADLINE_AWARE_ADMISSION");
+    return deadlineAwareAdmission;
+}
+
+bool getEnvSpeculativeScheduling()
+{
+    static bool const speculativeScheduling = getBoolEnv("TRTLLM_SCHED_SPECULATIVE_OVERLAP");
+    return speculativeScheduling;
+}
+
+int32_t getEnvKVCacheCompactionBlocksPerIteration()
+{
+    static int32_t const blocksPerIteration
+        = std::max(getIntEnv("TRTLLM_KVCACHE_COMPACTION_BLOCKS_PER_ITER").value_or(0), 0);
+    return blocksPerIteration;
+}
+
+bool getEnvKVCacheScanResistantEviction()
+{
+    static bool const scanResistantEviction = getBoolEnv("TRTLLM_KVCACHE_SCAN_RESISTANT_EVICTION");
+    return scanResistantEviction;
+}
+
 bool getEnvKVCacheTransferUseSyncBuffer()
 {
     static bool const useSyncBuffer = getBoolEnv("TRTLLM_KVCACHE_TRANSFER_USE_SYNC_BUFFER");
@@ -480,6 +685,12 @@ size_t getEnvKVCacheRecvBufferCount()
     return recvBufferCount;
 }
 
+size_t getEnvKVCacheOffloadWritebackBatchBytes()
+{
+    static size_t const batchBytes = getUInt64Env("TRTLLM_KVCACHE_OFFLOAD_WRITEBACK_BATCH_BYTES").value_or(0);
+    return batchBytes;
+}
+
 size_t getEnvMemSizeForKVCacheTransferBuffer()
 {
     static std::once_flag flag;
@@ -569,6 +780,63 @@ int getEnvMoeA2ACombineBlockSize()
     return kBlock;
 }
 
+bool getEnvMoeA2ANodeAggregation()
+{
+    return getBoolEnv("TRTLLM_MOE_A2A_NODE_AGGREGATION");
+}
+
+int getEnvMoeLoadBalanceStatisticWindowSize()
+{
+    static int const windowSize = []
+    {
+        auto const val = getIntEnv("TRTLLM_MOE_LB_STATISTIC_WINDOW_SIZE");
+        if (val.has_value() && val.value() < 1)
+        {
+            TLLM_LOG_WARNING(
+                "TRTLLM_MOE_LB_STATISTIC_WINDOW_SIZE should be >= 1, got %d, using 1 instead.", val.value());
+            return 1;
+        }
+        return val.value_or(1);
+    }();
+    return windowSize;
+}
+
+float getEnvMoeLoadBalanceStatisticDecayFactor()
+{
+    static float const decayFactor = []
+    {
+        auto const val = getFloatEnv("TRTLLM_MOE_LB_STATISTIC_DECAY_FACTOR");
+        if (val.has_value() && (val.value() <= 0.0f || val.value() > 1.0f))
+        {
+            TLLM_LOG_WARNING(
+                "TRTLLM_MOE_LB_STATISTIC_DECAY_FACTOR should be in (0, 1], got %f, using 0.95 instead.", val.value());
+            return 0.95f;
+        }
+        return val.value_or(0.95f);
+    }();
+    return decayFactor;
+}
+
+bool getEnvMnnvlDisableNvlsOneshot()
+{
+    return getBoolEnv("TRTLLM_MNNVL_AR_DISABLE_NVLS_ONESHOT");
+}
+
+bool getEnvPPCommOverlap()
+{
+    return getBoolEnv("TRTLLM_PP_COMM_OVERLAP");
+}
+
+bool getEnvDisableOrchShmChannel()
+{
+    return getBoolEnv("TRTLLM_DISABLE_ORCH_SHM_CHANNEL");
+}
+
+bool getEnvLogitsCopyOverlap()
+{
+    return getBoolEnv("TRTLLM_LOGITS_COPY_OVERLAP");
+}
+
 bool getEnvEplbForceGdrcopy()
 {
     return getBoolEnv("TRTLLM_EPLB_FORCE_GDRCOPY");
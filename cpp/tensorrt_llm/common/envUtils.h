@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -47,6 +47,9 @@ std::optional<bool> getEnvEnableXQAJIT();
 // 0 means to use heuristics.
 std::optional<int32_t> getEnvXqaBlocksPerSequence();
 
+// Directory for the on-disk XQA JIT cubin cache. Empty (default) disables persistence.
+std::string const& getEnvXqaCubinCacheDir();
+
 // Whether use tileSizeKv64 for multiCtasKvMode of trtllm-gen kernels.
 bool getEnvUseTileSizeKv64ForTrtllmGen();
 
@@ -85,6 +88,61 @@ inline void launchWithPdlWhenEnabled(char const* name, KernelFn kernelFn, dim3 g
     TLLM_CUDA_CHECK(cudaLaunchKernelEx(&kernelConfig, kernelFn, std::forward<Args>(args)...));
 }
 
+// Target per-iteration latency in milliseconds for the dynamic batch tuner's feedback controller.
+// When exceeded, the tuner shrinks the batch/token budgets regardless of throughput.
+// 0 (default) disables the latency clamp.
+float getEnvDynamicBatchTunerTargetIterMs();
+
+// Target iteration latency in milliseconds for the adaptive context-chunk controller in the micro
+// batch scheduler. The per-iteration context-token budget of mixed context/generation iterations is
+// adjusted from measured latency to track this target. Requires context chunking. 0 (default)
+// disables the controller.
+float getEnvAdaptiveCtxChunkTargetMs();
+
+// Zero-copy engine load: mmap the serialized engine file and deserialize directly from the
+// mapping instead of buffer-copying through a stream reader. Off by default.
+bool getEnvEngineMmapLoad();
+
+// Number of threads used to page the mmapped engine in ahead of deserialization.
+// 0 disables the prefetch pipeline and pages fault in lazily. Default 8.
+int32_t getEnvEngineLoadPrefetchThreads();
+
+// Number of threads used to read large safetensors payloads; reads are split into disjoint
+// pread regions on one descriptor. 1 disables the parallel path. Default 8.
+int32_t getEnvSafetensorsLoadThreads();
+
+// Output path for the batch manager stage tracer. When set, the orchestration stages in the
+// inflight-batching forward path are traced into a ring buffer and dumped as Trace Event JSON
+// on shutdown. Empty (default) disables tracing.
+std::string const& getEnvStageTracePath();
+
+// NUMA-aware executor mode: place pinned host allocations on the CPU NUMA node of the current GPU
+// and pin the executor worker threads to that node's cores. Off by default.
+bool getEnvNumaAwareExecutor();
+
+// Share one virtual-memory-backed activation workspace between the execution contexts of all
+// TllmRuntime instances on a device. Backing pages are committed on demand up to the largest peak
+// requirement instead of reserving each runtime's peak separately. Off by default.
+bool getEnvSharedPagedWorkspace();
+
+// Whether SWA recycles out-of-window KV cache blocks in place (ring-buffer mode) instead of
+// detaching them and allocating fresh ones, for constant-memory streaming generation.
+bool getEnvKVCacheSWARingBuffer();
+
+// Per-layer-group offload policy for hybrid local/global attention models: sliding-window layer groups
+// free detached out-of-window blocks eagerly (front of the free queue, no secondary offload) while
+// full-attention groups retain and offload as usual. Off by default.
+bool getEnvKVCacheSWAEagerFree();
+
+// Monitor device memory headroom each iteration and shed load (halve the scheduled batch, pause
+// admission of new context requests) under pressure instead of aborting with OOM. Off by default.
+bool getEnvEnableMemoryPressureWatchdog();
+
+// Execute unfused context and generation batches concurrently on separate streams instead of
+// serializing them behind each other. Requires duplicate execution contexts with their own
+// activation memory. Off by default.
+bool getEnvConcurrentCtxGenExecution();
+
 bool getEnvUseUCXKvCache();
 
 bool getEnvUseMPIKvCache();
@@ -105,6 +163,9 @@ bool getEnvDisaggLayerwise();
 
 bool getEnvParallelCacheSend();
 
+// Quantize half/bf16 KV cache to FP8 E4M3 inside the transfer buffers before sending.
+bool getEnvKVCacheTransferFp8Wire();
+
 bool getEnvRequestKVCacheConcurrent();
 
 bool getEnvDisableKVCacheTransferOverlap();
@@ -113,8 +174,41 @@ bool getEnvEnableReceiveKVCacheParallel();
 
 std::string const& getEnvKVCacheTimeOutputPath();
 
+// Comma-separated ip:port list of peer cache transceivers to connect to at startup.
+std::string const& getEnvKVCachePrewarmPeers();
+
+// Path of the guided decoding pre-warm file. When set, the guided decoder compiles the guides listed in the
+// file at startup and appends newly seen guides, so replicas can share grammar compilation warmup.
+std::string const& getEnvGuidedDecodingPrewarmFile();
+
+// Path of a runtime-learned cublasLt algorithm LUT. Entries override the built-in tables for scaled
+// matmuls; shapes missing from both tables are appended to <file>.misses for offline tuning.
+std::string const& getEnvCublasAlgoLutFile();
+
+// Number of threads materializing final responses off the executor worker loop, so bursts of
+// simultaneous finishes do not delay the next forward step. 0 (default) keeps the serial path.
+int32_t getEnvResponsePoolThreads();
+
+// Capacity in MiB of the content-hashed device cache for prompt/multimodal embedding tables.
+// Repeated tables (e.g. identical vision contexts across turns) reuse the cached upload.
+// 0 (default) disables the cache.
+size_t getEnvPromptTableCacheSizeMb();
+
 bool getEnvTryZCopyForKVCacheTransfer();
 
+// Transfer-agent zero-copy: register the KV pool memory with the transfer agent once at startup
+// and post scatter-gather iovecs over the pool block addresses, skipping the staging copy through
+// the transfer buffers. Only takes effect for identical cache layouts on the agent (NIXL) path and
+// must be set consistently on both disagg endpoints.
+bool getEnvKVCacheAgentZeroCopy();
+
+// NCCL communicator pool: give bulk collectives (alltoall, allgather, reducescatter) dedicated
+// communicators per rank group instead of sharing the allreduce communicator, so concurrent
+// collectives issued on different streams (e.g. under overlap scheduling) do not serialize inside
+// NCCL. Costs additional NCCL channels and device memory per extra communicator and must be set
+// consistently on all ranks of a group.
+bool getEnvNcclCommPoolEnabled();
+
 // Force deterministic behavior for all kernels.
 bool getEnvForceDeterministic();
 
@@ -134,12 +228,61 @@ bool getEnvForceDeterministicAllReduce();
 // This only works when force deterministic is enabled.
 size_t getEnvAllReduceWorkspaceSize();
 
+// Calibrate the AUTO allreduce strategy at runtime: the first allreduce of each message-size bucket
+// benchmarks the eligible strategies on the actual topology and caches the fastest one, overriding
+// the built-in lookup table. Must be set on all ranks of the group. Off by default.
+bool getEnvAllReduceCalibration();
+
+// Directory for persisting calibrated allreduce dispatch tables, keyed by a topology fingerprint.
+// Empty (default) keeps the calibration in memory only.
+std::string const& getEnvAllReduceCalibrationCacheDir();
+
 size_t getEnvKVCacheRecvBufferCount();
 
+// Target batch size in bytes for deferred KV cache offload writebacks. When set (8MB is a reasonable
+// value for PCIe efficiency), full-block offload copies are staged and issued as one batched transfer
+// once this many bytes accumulate, flushed at the latest at the end of the step. 0 (default) disables
+// staging and offloads every block immediately.
+size_t getEnvKVCacheOffloadWritebackBatchBytes();
+
 bool getEnvKVCacheTransferUseAsyncBuffer();
 
 bool getEnvKVCacheTransferUseSyncBuffer();
 
+// Number of cold primary blocks the background compaction pass may offload to secondary memory per iteration.
+// 0 (default) disables the pass.
+int32_t getEnvKVCacheCompactionBlocksPerIteration();
+
+// Scan-resistant (LRU-K flavored) eviction ordering: cached blocks whose content was never re-hit are
+// evicted before blocks of the same priority that have proven reuse. Off by default.
+bool getEnvKVCacheScanResistantEviction();
+
+// Enable priority- and cost-aware victim selection when the MAX_UTILIZATION capacity scheduler must preempt.
+// Off (default): pause the most recently started request, the historical behavior.
+bool getEnvPriorityAwarePreemption();
+
+// Size of the reordering window at the head of the pending queue in which the capacity scheduler groups
+// context requests that miss the prefix cache at the same first block, admitting sharers consecutively.
+// 0 (default) keeps plain FIFO admission.
+int32_t getEnvPrefixAwareAdmissionWindow();
+
+// Enable deadline-aware admission on the executor leader. Queued requests whose remaining allotted time
+// cannot cover a projected first iteration are finished as timed out instead of being admitted, and
+// near-deadline requests within the admission window are moved ahead of their priority position.
+// Off (default): allotted time is only enforced once a request is already expired.
+bool getEnvDeadlineAwareAdmission();
+
+// Overlap host-side scheduling with engine execution: after dispatching an iteration, the executor
+// speculatively computes the next iteration's schedule while the engine still runs on the GPU and
+// reuses it if the active request set is unchanged when the next iteration starts. Requires the
+// guaranteed-no-evict capacity scheduler policy and a single micro batch. Off by default.
+bool getEnvSpeculativeScheduling();
+
+// Cap on context compute tokens the micro batch scheduler may pack into an iteration that also carries
+// in-flight generation requests. Bounds the decode-latency impact of large prefill chunks.
+// Requires context chunking. 0 (default) disables the cap.
+int32_t getEnvCtxComputeTokensCapWithGen();
+
 size_t getEnvKVCacheSendMaxConcurrenceNum();
 
 size_t getEnvMemSizeForKVCacheTransferBuffer();
@@ -162,6 +305,34 @@ int getEnvMoeA2ADispatchBlockSize();
 // Block size (threads per block) for MoE A2A Combine kernels (default 256 if unset or invalid)
 int getEnvMoeA2ACombineBlockSize();
 
+// Hierarchical MoE A2A dispatch: send each token once per remote node and replicate to sibling
+// ranks over node-local NVLink. Off by default; requires contiguous rank-to-node placement.
+bool getEnvMoeA2ANodeAggregation();
+
+// Number of per-iteration expert-hit histograms the MoE load balancer keeps in its device-side
+// ring buffer (default 1 if unset or invalid).
+int getEnvMoeLoadBalanceStatisticWindowSize();
+
+// Per-iteration decay applied to the MoE load balancer's accumulated expert load factor; lower
+// values react faster to bursty expert skew (default 0.95, valid range (0, 1]).
+float getEnvMoeLoadBalanceStatisticDecayFactor();
+
+// Disable the NVLS switch-reduction oneshot kernel in the MNNVL fused allreduce and fall back to
+// the multicast-store oneshot.
+bool getEnvMnnvlDisableNvlsOneshot();
+
+// Run the pipeline-parallel Send/Recv plugins on dedicated communication streams, with
+// double-buffered staging on the send side so compute is not serialized behind NCCL.
+bool getEnvPPCommOverlap();
+
+// Disable the same-host shared-memory channel between orchestrator and leader and send all
+// response/stats payloads over MPI.
+bool getEnvDisableOrchShmChannel();
+
+// Issue device-to-host logits copies on the copy stream so they overlap the remaining work of the
+// iteration instead of stalling the compute stream.
+bool getEnvLogitsCopyOverlap();
+
 bool getEnvKVCacheTransferAllBlocksForWindow();
 
 bool getEnvEplbForceGdrcopy();
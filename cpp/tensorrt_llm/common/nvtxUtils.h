@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -28,11 +28,83 @@
 #include "tensorrt_llm/common/config.h"
 
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <utility>
 
 TRTLLM_NAMESPACE_BEGIN
 
 namespace common::nvtx
 {
+
+/// Instrumentation domains for subsystem-scoped NVTX ranges. Each value is one bit of the runtime
+/// enablement mask, so a single subsystem can be switched on while the rest stay silent.
+enum class Domain : std::uint32_t
+{
+    kSCHEDULER = 1U << 0U,
+    kKVCACHE = 1U << 1U,
+    kDECODER = 1U << 2U,
+    kTRANSCEIVER = 1U << 3U,
+    kKERNELS = 1U << 4U,
+    kALL = 0xffffffffU,
+};
+
+namespace detail
+{
+inline std::uint32_t domainMaskFromEnv()
+{
+    char const* env = std::getenv("TRTLLM_NVTX_DOMAINS");
+    if (env == nullptr)
+    {
+        return static_cast<std::uint32_t>(Domain::kALL);
+    }
+    constexpr std::array<std::pair<char const*, Domain>, 7> kNames{{{"scheduler", Domain::kSCHEDULER},
+        {"kvcache", Domain::kKVCACHE}, {"decoder", Domain::kDECODER}, {"transceiver", Domain::kTRANSCEIVER},
+        {"kernels", Domain::kKERNELS}, {"all", Domain::kALL}, {"none", static_cast<Domain>(0U)}}};
+    std::uint32_t mask = 0;
+    for (char const* begin = env; *begin != '\0';)
+    {
+        char const* end = std::strchr(begin, ',');
+        std::size_t const len = end != nullptr ? static_cast<std::size_t>(end - begin) : std::strlen(begin);
+        for (auto const& [name, domain] : kNames)
+        {
+            if (len == std::strlen(name) && std::strncmp(begin, name, len) == 0)
+            {
+                mask |= static_cast<std::uint32_t>(domain);
+                break;
+            }
+        }
+        begin = end != nullptr ? end + 1 : begin + len;
+    }
+    return mask;
+}
+
+inline std::atomic<std::uint32_t>& domainMask()
+{
+    static std::atomic<std::uint32_t> mask{domainMaskFromEnv()};
+    return mask;
+}
+} // namespace detail
+
+/// Whether ranges tagged with the given domain are currently emitted. All domains are enabled by
+/// default; TRTLLM_NVTX_DOMAINS (comma-separated names, "all" or "none") narrows the selection.
+inline bool isDomainEnabled(Domain domain)
+{
+#ifndef NVTX_DISABLE
+    return (detail::domainMask().load(std::memory_order_relaxed) & static_cast<std::uint32_t>(domain)) != 0;
+#else
+    return false;
+#endif
+}
+
+/// Override the enabled-domain bitmask at runtime, e.g. around a window of interest.
+inline void setEnabledDomains(std::uint32_t mask)
+{
+    detail::domainMask().store(mask, std::memory_order_relaxed);
+}
 inline nvtx3::color nextColor()
 {
 #ifndef NVTX_DISABLE
@@ -55,3 +127,19 @@ TRTLLM_NAMESPACE_END
 #define NVTX3_SCOPED_RANGE_WITH_NAME(range, name)                                                                      \
     ::nvtx3::scoped_range range(::tensorrt_llm::common::nvtx::nextColor(), name)
 #define NVTX3_SCOPED_RANGE(range) NVTX3_SCOPED_RANGE_WITH_NAME(range##_range, #range)
+
+// Domain-scoped variants: the range is only emitted when its domain bit is set in the runtime
+// enablement mask, so deep instrumentation can stay in production builds and a single subsystem
+// can be switched on via TRTLLM_NVTX_DOMAINS. With NVTX_DISABLE the macros compile to nothing.
+#ifndef NVTX_DISABLE
+#define NVTX3_SCOPED_RANGE_IN_DOMAIN_WITH_NAME(range, domain, name)                                                    \
+    ::std::optional<::nvtx3::scoped_range> range;                                                                      \
+    if (::tensorrt_llm::common::nvtx::isDomainEnabled(::tensorrt_llm::common::nvtx::Domain::domain))                   \
+    {                                                                                                                  \
+        range.emplace(::tensorrt_llm::common::nvtx::nextColor(), name);                                                \
+    }                                                                                                                  \
+    static_assert(true, "")
+#else
+#define NVTX3_SCOPED_RANGE_IN_DOMAIN_WITH_NAME(range, domain, name) static_assert(true, "")
+#endif
+#define NVTX3_SCOPED_RANGE_IN_DOMAIN(domain, range) NVTX3_SCOPED_RANGE_IN_DOMAIN_WITH_NAME(range##_range, domain, #range)
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,6 +16,7 @@
  */
 
 #include "tensorrt_llm/common/opUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/ncclUtils.h"
 #include "tensorrt_llm/runtime/utils/mpiTags.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
@@ -74,11 +75,16 @@ ncclUniqueId getUniqueId(std::set<int> const& group)
 }
 } // namespace
 
-std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group)
+std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group, NcclCommClass commClass)
 {
     auto const rank = COMM_SESSION.getRank();
     TLLM_LOG_TRACE("%s start for rank %d", __PRETTY_FUNCTION__, rank);
-    static std::map<std::set<int>, std::shared_ptr<ncclComm_t>> commMap;
+    // Without the communicator pool, all traffic classes share the default communicator.
+    if (commClass != NcclCommClass::kDefault && !common::getEnvNcclCommPoolEnabled())
+    {
+        commClass = NcclCommClass::kDefault;
+    }
+    static std::map<std::pair<std::set<int>, NcclCommClass>, std::shared_ptr<ncclComm_t>> commMap;
     static std::mutex mutex;
     std::lock_guard<std::mutex> lock(mutex);
     std::ostringstream oss;
@@ -92,8 +98,10 @@ std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group)
         oss << rank;
         index++;
     }
+    oss << "/class" << static_cast<int>(commClass);
     auto groupStr = oss.str();
-    auto it = commMap.find(group);
+    auto const key = std::make_pair(group, commClass);
+    auto it = commMap.find(key);
     if (it != commMap.end())
     {
         auto ncclComm = it->second;
@@ -162,7 +170,7 @@ std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group)
     setenv("NCCL_GRAPH_REGISTER", "0", 0);
 #endif // _WIN32
     NCCLCHECK_THROW(ncclCommInitRank(ncclComm.get(), group.size(), id, groupRank));
-    commMap[group] = ncclComm;
+    commMap[key] = ncclComm;
     TLLM_LOG_TRACE("%s stop for rank %d", __PRETTY_FUNCTION__, rank);
     return ncclComm;
 }
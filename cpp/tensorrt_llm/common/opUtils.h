@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -216,7 +216,18 @@ inline bool isBuilding()
 
 std::unordered_map<nvinfer1::DataType, ncclDataType_t>* getDtypeMap();
 
-std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group);
+//! Traffic class of a collective. With TRTLLM_NCCL_COMM_POOL set, each class gets a dedicated
+//! communicator per rank group, so collectives of different classes issued on different streams
+//! (e.g. bulk alltoall overlapping the per-layer allreduce under overlap scheduling) do not
+//! serialize inside NCCL. Without it, all classes share the default communicator.
+enum class NcclCommClass : int
+{
+    kDefault = 0, //!< Latency-critical collectives on the main stream (allreduce).
+    kBulk,        //!< Large-payload collectives that may overlap other traffic.
+    kControl,     //!< Small, infrequent coordination traffic.
+};
+
+std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group, NcclCommClass commClass = NcclCommClass::kDefault);
 
 #endif // ENABLE_MULTI_DEVICE
 
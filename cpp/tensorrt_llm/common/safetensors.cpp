@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2021-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,11 +18,15 @@
 #include "nlohmann/json.hpp"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include <NvInferRuntime.h>
+#include <algorithm>
 #include <cstdint>
-#include <fstream>
+#include <fcntl.h>
 #include <map>
 #include <memory>
+#include <thread>
+#include <unistd.h>
 #include <utility>
 #include <vector>
 
@@ -55,6 +59,75 @@ static DataType convertDataTypeStrToEnum(std::string const& str)
     TLLM_THROW("Unsupported data type: " + str);
 }
 
+//! Thin RAII wrapper around a read-only file descriptor. pread has no shared cursor, so tensor
+//! reads can run concurrently on one descriptor from multiple threads.
+class SafeTensorFile
+{
+    int mFd{-1};
+
+public:
+    explicit SafeTensorFile(char const* filename)
+    {
+        mFd = ::open(filename, O_RDONLY);
+        if (mFd < 0)
+        {
+            TLLM_THROW("Failed to open file: " + std::string(filename));
+        }
+    }
+
+    ~SafeTensorFile()
+    {
+        if (mFd >= 0)
+        {
+            ::close(mFd);
+        }
+    }
+
+    SafeTensorFile(SafeTensorFile const&) = delete;
+    SafeTensorFile& operator=(SafeTensorFile const&) = delete;
+
+    //! Reads [offset, offset + size) into dst, looping over short reads.
+    void readRegion(void* dst, int64_t offset, int64_t size) const
+    {
+        auto* out = static_cast<std::byte*>(dst);
+        int64_t done = 0;
+        while (done < size)
+        {
+            auto const bytes = ::pread(mFd, out + done, size - done, offset + done);
+            TLLM_CHECK_WITH_INFO(bytes > 0, "Failed to read safetensors region at offset %ld", offset + done);
+            done += bytes;
+        }
+    }
+
+    //! Reads [offset, offset + size) into dst with up to maxThreads workers issuing pread on
+    //! disjoint file regions, so large weights scale with NVMe bandwidth instead of one core.
+    void readRegionParallel(void* dst, int64_t offset, int64_t size, int maxThreads) const
+    {
+        auto constexpr kMinBytesPerThread = int64_t{8} << 20; // 8 MiB
+        auto const numThreads
+            = static_cast<int>(std::min<int64_t>(std::max(maxThreads, 1), std::max(size / kMinBytesPerThread, int64_t{1})));
+        if (numThreads <= 1)
+        {
+            readRegion(dst, offset, size);
+            return;
+        }
+        auto const bytesPerThread = (size + numThreads - 1) / numThreads;
+        std::vector<std::thread> workers;
+        workers.reserve(numThreads);
+        for (int t = 0; t < numThreads; ++t)
+        {
+            auto const begin = static_cast<int64_t>(t) * bytesPerThread;
+            auto const end = std::min(begin + bytesPerThread, size);
+            workers.emplace_back([this, dst, offset, begin, end]
+                { readRegion(static_cast<std::byte*>(dst) + begin, offset + begin, end - begin); });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+};
+
 class SafeTensorArray : public INdArray
 {
     std::vector<int64_t> mShape;
@@ -62,16 +135,16 @@ class SafeTensorArray : public INdArray
     DataType mDataType;
     int64_t mOffsetBegin; // adjusted to represent offset relative to the beginning of the file
     int64_t mOffsetEnd;   // adjusted to represent offset relative to the beginning of the file
-    std::shared_ptr<std::ifstream> mFs;
+    std::shared_ptr<SafeTensorFile> mFile;
 
 public:
-    SafeTensorArray(std::shared_ptr<std::ifstream> const& fs, std::string const& dtypeStr,
+    SafeTensorArray(std::shared_ptr<SafeTensorFile> const& file, std::string const& dtypeStr,
         std::vector<int64_t> const& shape, int64_t offsetBegin, int64_t offsetEnd)
         : mShape(shape)
         , mDataType(convertDataTypeStrToEnum(dtypeStr))
         , mOffsetBegin(offsetBegin)
         , mOffsetEnd(offsetEnd)
-        , mFs(fs)
+        , mFile(file)
     {
     }
 
@@ -79,10 +152,9 @@ public:
     {
         if (!mData)
         {
-            mFs->seekg(mOffsetBegin);
             int64_t size = mOffsetEnd - mOffsetBegin;
             mData.reset(new std::byte[size]);
-            mFs->read(reinterpret_cast<char*>(mData.get()), size);
+            mFile->readRegionParallel(mData.get(), mOffsetBegin, size, getEnvSafetensorsLoadThreads());
         }
 
         return mData.get();
@@ -102,6 +174,16 @@ public:
     {
         return mDataType;
     }
+
+    [[nodiscard]] int64_t fileOffset() const override
+    {
+        return mOffsetBegin;
+    }
+
+    [[nodiscard]] int64_t sizeInBytes() const override
+    {
+        return mOffsetEnd - mOffsetBegin;
+    }
 };
 
 // Implemented based on safetensors 0.4.3.
@@ -110,19 +192,15 @@ class SafeTensor : public ISafeTensor
     int64_t mJsonSize;
     std::map<std::string, std::string> mMetadata;
     std::map<std::string, nlohmann::basic_json<>> mTensorInfo;
-    std::shared_ptr<std::ifstream> mFs;
+    std::shared_ptr<SafeTensorFile> mFile;
 
 public:
     SafeTensor(char const* filename)
-        : mFs(new std::ifstream(filename, std::ios::binary))
+        : mFile(new SafeTensorFile(filename))
     {
-        if (!mFs->is_open())
-        {
-            TLLM_THROW("Failed to open file: " + std::string(filename));
-        }
-        mFs->read(reinterpret_cast<char*>(&mJsonSize), sizeof(mJsonSize));
+        mFile->readRegion(&mJsonSize, 0, sizeof(mJsonSize));
         std::vector<char> jsonBuffer(mJsonSize);
-        mFs->read(jsonBuffer.data(), mJsonSize);
+        mFile->readRegion(jsonBuffer.data(), sizeof(mJsonSize), mJsonSize);
         nlohmann::json attributes = nlohmann::json::parse(jsonBuffer);
         for (auto const& [key, value] : attributes.items())
         {
@@ -155,7 +233,7 @@ public:
         {
             auto const& value = it->second;
             int64_t offset = mJsonSize + sizeof(mJsonSize);
-            return std::make_shared<SafeTensorArray>(mFs, value["dtype"], value["shape"],
+            return std::make_shared<SafeTensorArray>(mFile, value["dtype"], value["shape"],
                 static_cast<int64_t>(value["data_offsets"][0]) + offset,
                 static_cast<int64_t>(value["data_offsets"][1]) + offset);
         }
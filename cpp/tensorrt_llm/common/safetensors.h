@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2021-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -35,6 +35,11 @@ public:
     [[nodiscard]] virtual int ndim() const = 0;
     [[nodiscard]] virtual std::vector<int64_t> const& dims() const = 0;
     [[nodiscard]] virtual nvinfer1::DataType dtype() const = 0;
+    //! Offset of the tensor payload from the beginning of the file, in bytes. Lets callers
+    //! schedule their own I/O (e.g. GPUDirect Storage reads into device buffers).
+    [[nodiscard]] virtual int64_t fileOffset() const = 0;
+    //! Size of the tensor payload in bytes.
+    [[nodiscard]] virtual int64_t sizeInBytes() const = 0;
 
     [[nodiscard]] nvinfer1::Dims trtDims() const
     {
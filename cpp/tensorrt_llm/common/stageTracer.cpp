@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/stageTracer.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace common
+{
+
+StageTracer& StageTracer::getInstance()
+{
+    static StageTracer instance;
+    return instance;
+}
+
+StageTracer::StageTracer()
+{
+    mEnabled = !getEnvStageTracePath().empty();
+    mCalibTicks = now();
+    mCalibNs = steadyNowNs();
+}
+
+StageTracer::~StageTracer()
+{
+    if (mEnabled)
+    {
+        try
+        {
+            dump(getEnvStageTracePath());
+        }
+        catch (std::exception const& e)
+        {
+            TLLM_LOG_EXCEPTION(e);
+        }
+    }
+}
+
+uint64_t StageTracer::steadyNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint32_t StageTracer::currentThreadId()
+{
+#ifdef __linux__
+    thread_local uint32_t const tid = static_cast<uint32_t>(::syscall(SYS_gettid));
+    return tid;
+#else
+    thread_local uint32_t const tid = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    return tid;
+#endif
+}
+
+void StageTracer::dump(std::string const& path)
+{
+    // Take a second calibration sample so raw ticks can be converted to nanoseconds.
+    auto const endTicks = now();
+    auto const endNs = steadyNowNs();
+    auto const ticksPerNs = endTicks > mCalibTicks && endNs > mCalibNs
+        ? static_cast<double>(endTicks - mCalibTicks) / static_cast<double>(endNs - mCalibNs)
+        : 1.0;
+    auto const toMicros = [&](uint64_t ticks)
+    { return static_cast<double>(static_cast<int64_t>(ticks - mCalibTicks)) / ticksPerNs / 1000.0; };
+
+    auto const head = mHead.load(std::memory_order_acquire);
+    auto const numSpans = std::min<uint64_t>(head, kRingSize);
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.good())
+    {
+        TLLM_LOG_WARNING("Failed to open stage trace output path: %s", path.c_str());
+        return;
+    }
+
+    // Trace Event JSON: loadable by the Perfetto UI and chrome://tracing.
+    file << "{\"traceEvents\":[";
+    bool first = true;
+    for (uint64_t i = 0; i < numSpans; ++i)
+    {
+        auto const& span = mRing[i];
+        if (span.name == nullptr || span.endTicks < span.startTicks)
+        {
+            continue;
+        }
+        if (!first)
+        {
+            file << ",";
+        }
+        first = false;
+        file << "{\"name\":\"" << span.name << "\",\"cat\":\"batch_manager\",\"ph\":\"X\",\"ts\":"
+             << toMicros(span.startTicks) << ",\"dur\":" << toMicros(span.endTicks) - toMicros(span.startTicks)
+             << ",\"pid\":0,\"tid\":" << span.threadId << "}";
+    }
+    file << "]}";
+    TLLM_LOG_INFO("Dumped %lu stage trace spans to %s", static_cast<unsigned long>(numSpans), path.c_str());
+}
+
+} // namespace common
+
+TRTLLM_NAMESPACE_END
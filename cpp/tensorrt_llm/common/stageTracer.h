@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/config.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace common
+{
+
+//! \brief Lock-free ring-buffer tracer for the batch manager orchestration path.
+//!
+//! Each span records a raw timestamp-counter pair and a static stage name; recording is a single
+//! atomic increment plus a slot write, so it is cheap enough to stay on in production (unlike
+//! NVTX under nsys). The buffer holds the most recent kRingSize spans. When
+//! TRTLLM_STAGE_TRACE_PATH is set, the trace is dumped on shutdown (or via dump()) in the Trace
+//! Event JSON format, which the Perfetto UI and chrome://tracing load directly.
+class StageTracer
+{
+public:
+    static StageTracer& getInstance();
+
+    ~StageTracer();
+
+    [[nodiscard]] bool isEnabled() const
+    {
+        return mEnabled;
+    }
+
+    //! Raw timestamp in ticks; converted to nanoseconds at dump time using a calibration against
+    //! the steady clock, so the hot path never pays for the conversion.
+    static uint64_t now()
+    {
+#if defined(__x86_64__)
+        return __rdtsc();
+#else
+        return steadyNowNs();
+#endif
+    }
+
+    //! Record one span. name must be a string literal (stored by pointer, not copied).
+    void record(char const* name, uint64_t startTicks, uint64_t endTicks)
+    {
+        auto const slot = mHead.fetch_add(1, std::memory_order_relaxed) % kRingSize;
+        mRing[slot].name = name;
+        mRing[slot].startTicks = startTicks;
+        mRing[slot].endTicks = endTicks;
+        mRing[slot].threadId = currentThreadId();
+    }
+
+    //! Write the buffered spans to path as Trace Event JSON. Thread-safe with concurrent record()
+    //! calls; in-flight spans may be dropped.
+    void dump(std::string const& path);
+
+private:
+    StageTracer();
+
+    static uint64_t steadyNowNs();
+    static uint32_t currentThreadId();
+
+    struct Span
+    {
+        char const* name{nullptr};
+        uint64_t startTicks{0};
+        uint64_t endTicks{0};
+        uint32_t threadId{0};
+    };
+
+    static constexpr size_t kRingSize = size_t{1} << 16;
+
+    std::array<Span, kRingSize> mRing{};
+    std::atomic<uint64_t> mHead{0};
+    bool mEnabled{false};
+    // Calibration sample taken at construction: (ticks, steady ns) at the same instant.
+    uint64_t mCalibTicks{0};
+    uint64_t mCalibNs{0};
+};
+
+//! RAII span; records on destruction when tracing is enabled.
+class ScopedStageTrace
+{
+public:
+    explicit ScopedStageTrace(char const* name)
+        : mName(name)
+        , mStartTicks(StageTracer::getInstance().isEnabled() ? StageTracer::now() : 0)
+    {
+    }
+
+    ~ScopedStageTrace()
+    {
+        if (mStartTicks != 0)
+        {
+            StageTracer::getInstance().record(mName, mStartTicks, StageTracer::now());
+        }
+    }
+
+    ScopedStageTrace(ScopedStageTrace const&) = delete;
+    ScopedStageTrace& operator=(ScopedStageTrace const&) = delete;
+
+private:
+    char const* mName;
+    uint64_t mStartTicks;
+};
+
+} // namespace common
+
+TRTLLM_NAMESPACE_END
+
+#define TLLM_STAGE_TRACE(name) ::tensorrt_llm::common::ScopedStageTrace stageTrace_##name(#name)
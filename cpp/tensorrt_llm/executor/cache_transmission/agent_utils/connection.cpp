@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -157,43 +157,60 @@ void AgentConnection::recv(DataContext const& ctx, void* data, size_t size) cons
 }
 
 void AgentConnection::sendRequestAndBufferInfo(batch_manager::RequestInfo& requestInfo,
-    std::vector<std::optional<size_t>> const& cacheBufferIds, int connectionIdx)
+    std::vector<std::optional<size_t>> const& cacheBufferIds, int connectionIdx, std::vector<MemoryDesc> blockDescs)
 {
     TLLM_CHECK(!common::getEnvTryZCopyForKVCacheTransfer());
 
-    TLLM_CHECK(!cacheBufferIds.empty());
-    TLLM_CHECK(cacheBufferIds.size() <= mCacheTransBufferManagers.size());
-
-    auto const& allKinds = mAgentConnectionManager->getBufferKinds();
-    std::vector<runtime::ITensor::SharedPtr> preAllocateBuffers;
+    bool const zeroCopy = !blockDescs.empty();
     std::vector<MemoryDesc> bufferDescs;
-    std::vector<std::optional<size_t>> activeCacheBufferIds;
     std::vector<uint8_t> activeKinds;
 
-    for (size_t i = 0; i < cacheBufferIds.size(); i++)
-    {
-        if (!cacheBufferIds[i].has_value())
-        {
-            continue;
-        }
-        auto preAllocateBuffer = mCacheTransBufferManagers[i]->getRecvBuffer(cacheBufferIds[i].value());
-        TLLM_CHECK(preAllocateBuffer != nullptr);
-        preAllocateBuffers.push_back(preAllocateBuffer);
-        activeCacheBufferIds.push_back(cacheBufferIds[i]);
-        activeKinds.push_back(allKinds[i]);
-    }
-    TLLM_CHECK(!activeCacheBufferIds.empty());
-
-    mCacheBufferIds = std::move(activeCacheBufferIds);
-    mBufferKinds = activeKinds;
-
     int deviceId = -1;
     TLLM_CUDA_CHECK(cudaGetDevice(&deviceId));
     TLLM_CHECK(deviceId != -1);
     TLLM_CHECK(deviceId == mAgentConnectionManager->getDeviceId());
-    for (auto const& buf : preAllocateBuffers)
+
+    if (zeroCopy)
     {
-        bufferDescs.emplace_back(reinterpret_cast<uintptr_t>(buf->data()), buf->getSizeInBytes(), deviceId);
+        // Advertise the per-block pool addresses instead of a staging buffer; the sender posts
+        // one scatter-gather write straight into the pool.
+        bufferDescs = std::move(blockDescs);
+        activeKinds.assign(bufferDescs.size(), static_cast<uint8_t>(batch_manager::BufferKind::kKV));
+        mCacheBufferIds.clear();
+        mBufferKinds = activeKinds;
+        mZeroCopyAdvertised = true;
+    }
+    else
+    {
+        TLLM_CHECK(!cacheBufferIds.empty());
+        TLLM_CHECK(cacheBufferIds.size() <= mCacheTransBufferManagers.size());
+
+        auto const& allKinds = mAgentConnectionManager->getBufferKinds();
+        std::vector<runtime::ITensor::SharedPtr> preAllocateBuffers;
+        std::vector<std::optional<size_t>> activeCacheBufferIds;
+
+        for (size_t i = 0; i < cacheBufferIds.size(); i++)
+        {
+            if (!cacheBufferIds[i].has_value())
+            {
+                continue;
+            }
+            auto preAllocateBuffer = mCacheTransBufferManagers[i]->getRecvBuffer(cacheBufferIds[i].value());
+            TLLM_CHECK(preAllocateBuffer != nullptr);
+            preAllocateBuffers.push_back(preAllocateBuffer);
+            activeCacheBufferIds.push_back(cacheBufferIds[i]);
+            activeKinds.push_back(allKinds[i]);
+        }
+        TLLM_CHECK(!activeCacheBufferIds.empty());
+
+        mCacheBufferIds = std::move(activeCacheBufferIds);
+        mBufferKinds = activeKinds;
+        mZeroCopyAdvertised = false;
+
+        for (auto const& buf : preAllocateBuffers)
+        {
+            bufferDescs.emplace_back(reinterpret_cast<uintptr_t>(buf->data()), buf->getSizeInBytes(), deviceId);
+        }
     }
     std::string address = mAgentConnectionManager->getAgent()->getLocalConnectionInfo();
     std::optional<std::string> metadataOpt = std::nullopt;
@@ -205,7 +222,7 @@ void AgentConnection::sendRequestAndBufferInfo(batch_manager::RequestInfo& reque
     }
 
     RequestAndBufferInfo requestAndBufferInfo{
-        mAgentName, address, requestInfo, bufferDescs, metadataOpt, connectionIdx, activeKinds};
+        mAgentName, address, requestInfo, bufferDescs, metadataOpt, connectionIdx, activeKinds, zeroCopy};
     std::stringstream ss;
     NotificationInfo notificationInfo{requestAndBufferInfo};
     NotificationInfo::serialize(notificationInfo, ss);
@@ -221,10 +238,56 @@ void AgentConnection::setSenderState(std::vector<MemoryDesc> cacheReceiverBuffer
     mSenderState.mCacheReceiverBufferDescs = std::move(cacheReceiverBufferDescs);
     mSenderState.validSegmentIdx = validSegmentIdx;
     mSenderState.mOffsetRatios = std::move(offsetRatios);
+    mSenderState.mBlockDescs.clear();
+    mSenderState.mZeroCopy = false;
     mSenderState.setActiveBufferIdx(0);
     mBufferKinds = std::move(bufferKinds);
 }
 
+void AgentConnection::setSenderBlockDescs(std::vector<MemoryDesc> blockDescs, std::vector<uint8_t> bufferKinds)
+{
+    TLLM_CHECK(!blockDescs.empty());
+    mSenderState.mBlockDescs = std::move(blockDescs);
+    mSenderState.mZeroCopy = true;
+    mBufferKinds = std::move(bufferKinds);
+}
+
+void AgentConnection::sendBlocksZeroCopy(DataContext const& ctx, std::vector<MemoryDesc> srcDescs) const
+{
+    TLLM_CHECK_WITH_INFO(mSenderState.mZeroCopy, "sendBlocksZeroCopy requires an advertised zero-copy receiver");
+    auto const& dstDescs = mSenderState.mBlockDescs;
+    TLLM_CHECK_WITH_INFO(srcDescs.size() == dstDescs.size(),
+        "Zero-copy KV cache transfer block count mismatch: %zu local blocks vs %zu advertised by the peer",
+        srcDescs.size(), dstDescs.size());
+    for (size_t i = 0; i < srcDescs.size(); i++)
+    {
+        TLLM_CHECK_WITH_INFO(srcDescs[i].getLen() == dstDescs[i].getLen(),
+            "Zero-copy KV cache transfer block size mismatch at block %zu: %zu vs %zu", i, srcDescs[i].getLen(),
+            dstDescs[i].getLen());
+    }
+    MemoryDescs srcMemoryDescs{MemoryType::kVRAM, std::move(srcDescs)};
+    MemoryDescs dstMemoryDescs{MemoryType::kVRAM, dstDescs};
+    TransferRequest request{TransferOp::kWRITE, srcMemoryDescs, dstMemoryDescs, mRemoteAgentName};
+    auto status = mAgentConnectionManager->getAgent()->submitTransferRequests(request);
+    NotificationSyncInfo syncInfo{mRemoteAgentName, ctx};
+    NotificationInfo notificationInfo{syncInfo};
+    std::stringstream ss;
+    NotificationInfo::serialize(notificationInfo, ss);
+    TransferState transferState = status->wait();
+    TLLM_CHECK_WITH_INFO(transferState == TransferState::kSUCCESS, "AgentConnection::sendBlocksZeroCopy failed");
+    mAgentConnectionManager->getAgent()->notifySyncMessage(mRemoteAgentName, ss.str());
+}
+
+bool AgentConnection::isZeroCopySender() const
+{
+    return mSenderState.mZeroCopy;
+}
+
+bool AgentConnection::advertisedZeroCopy() const
+{
+    return mZeroCopyAdvertised;
+}
+
 void AgentConnection::setHasLoadRemoteAgent(bool hasLoadRemoteAgent)
 {
     mHasLoadRemoteAgent = hasLoadRemoteAgent;
@@ -309,6 +372,15 @@ AgentConnectionManager::AgentConnectionManager(
             auto sendBuffer = cacheTransBufferManager->getSendBuffer(i);
             memDescs.emplace_back(sendBuffer->data(), sendBuffer->getSizeInBytes(), mDeviceId);
         }
+        if (common::getEnvKVCacheAgentZeroCopy())
+        {
+            // Register the cache pools once at startup so zero-copy transfers can post iovecs
+            // over the pool block addresses directly.
+            for (auto const& pool : cacheTransBufferManager->getPoolBuffers())
+            {
+                memDescs.emplace_back(pool->data(), pool->getSizeInBytes(), mDeviceId);
+            }
+        }
     }
     mRegMemDescs = MemoryDescs{MemoryType::kVRAM, memDescs};
     m_Agent->registerMemory(mRegMemDescs);
@@ -395,6 +467,19 @@ AgentConnection const* AgentConnectionManager::recvConnectionAndRequestInfo(
                     auto connection = connect(remoteAgentName, address, metadataOpt, true);
                     auto bufferKinds = std::move(requestAndBufferInfo.mBufferKinds);
 
+                    if (requestAndBufferInfo.mZeroCopy)
+                    {
+                        // The receiver advertised per-block pool addresses; no staging buffer
+                        // offsets apply.
+                        connection->setSenderBlockDescs(std::move(bufferDescs), std::move(bufferKinds));
+                        notifIt = notifs.erase(notifIt);
+                        if (notifs.empty())
+                        {
+                            it = mUnhandledNotifications.erase(it);
+                        }
+                        return connection;
+                    }
+
                     std::optional<std::pair<size_t, size_t>> kvOffsetRatio;
                     std::optional<std::pair<size_t, size_t>> rnnOffsetRatio;
                     std::vector<std::pair<size_t, size_t>> offsetRatios;
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -44,6 +44,9 @@ struct RequestAndBufferInfo
     std::optional<std::string> mMetadata;
     int mValidConnectionIdx;
     std::vector<uint8_t> mBufferKinds;
+    /// When true, mBufferDescs are per-block KV pool addresses and the sender posts one
+    /// scatter-gather write over them instead of staging through the transfer buffers.
+    bool mZeroCopy{false};
 
     static void serialize(RequestAndBufferInfo const& requestAndBufferInfo, std::ostream& os)
     {
@@ -63,6 +66,7 @@ struct RequestAndBufferInfo
         {
             su::serialize(kind, os);
         }
+        su::serialize(requestAndBufferInfo.mZeroCopy, os);
     }
 
     static RequestAndBufferInfo deserialize(std::istream& is)
@@ -87,8 +91,9 @@ struct RequestAndBufferInfo
         {
             bufferKinds.push_back(su::deserialize<uint8_t>(is));
         }
+        auto zeroCopy = su::deserialize<decltype(mZeroCopy)>(is);
         return RequestAndBufferInfo{
-            agentName, address, requestInfo, bufferDescs, metadata, validConnectionIdx, bufferKinds};
+            agentName, address, requestInfo, bufferDescs, metadata, validConnectionIdx, bufferKinds, zeroCopy};
     }
 
     static size_t serializedSize(RequestAndBufferInfo const& requestAndBufferInfo)
@@ -107,6 +112,7 @@ struct RequestAndBufferInfo
         totalSize += su::serializedSize(requestAndBufferInfo.mValidConnectionIdx);
         totalSize += su::serializedSize(requestAndBufferInfo.mBufferKinds.size());
         totalSize += requestAndBufferInfo.mBufferKinds.size() * su::serializedSize(uint8_t{});
+        totalSize += su::serializedSize(requestAndBufferInfo.mZeroCopy);
         return totalSize;
     }
 };
@@ -260,9 +266,23 @@ public:
     void send(DataContext const& ctx, void const* data, size_t size) const override;
     void recv(DataContext const& ctx, void* data, size_t size) const override;
     void sendRequestAndBufferInfo(batch_manager::RequestInfo& requestInfo,
-        std::vector<std::optional<size_t>> const& cacheBufferIds, int validConnectionIdx);
+        std::vector<std::optional<size_t>> const& cacheBufferIds, int validConnectionIdx,
+        std::vector<MemoryDesc> blockDescs = {});
     void setSenderState(std::vector<MemoryDesc> cacheReceiverBufferDescs, int valideSegmentIdx,
         std::vector<std::pair<size_t, size_t>> offsetRatios, std::vector<uint8_t> bufferKinds);
+
+    /// @brief Record the per-block pool addresses advertised by a zero-copy receiver.
+    void setSenderBlockDescs(std::vector<MemoryDesc> blockDescs, std::vector<uint8_t> bufferKinds);
+
+    /// @brief Post one scatter-gather write pairing srcDescs with the receiver's advertised
+    /// block descs, then notify completion under the given context tag.
+    void sendBlocksZeroCopy(DataContext const& ctx, std::vector<MemoryDesc> srcDescs) const;
+
+    /// @brief Whether the peer advertised per-block pool addresses for zero-copy sending.
+    [[nodiscard]] bool isZeroCopySender() const;
+
+    /// @brief Whether this connection advertised its pool blocks for zero-copy receiving.
+    [[nodiscard]] bool advertisedZeroCopy() const;
     void setHasLoadRemoteAgent(bool hasLoadRemoteAgent);
     [[nodiscard]] bool hasLoadRemoteAgent() const;
     void sendReadySignal(DataContext const& ctx, bool isReady) const;
@@ -281,6 +301,9 @@ private:
         int validSegmentIdx{0};
         /// Per-buffer offset ratios. Index corresponds to mCacheReceiverBufferDescs / mActiveBufferIdx.
         std::vector<std::pair<size_t, size_t>> mOffsetRatios;
+        /// Per-block destination pool addresses when the receiver advertised zero-copy.
+        std::vector<MemoryDesc> mBlockDescs;
+        bool mZeroCopy{false};
         mutable size_t mActiveBufferIdx{0};
         [[nodiscard]] MemoryDesc const& activeBufferDesc() const;
         [[nodiscard]] std::pair<size_t, size_t> const& activeOffsetRatio() const;
@@ -296,6 +319,7 @@ private:
     mutable SenderState mSenderState;
     bool mNeedSendMetadata{true};
     bool mHasLoadRemoteAgent{false};
+    bool mZeroCopyAdvertised{false};
 };
 
 class AgentConnectionManager : public ConnectionManager
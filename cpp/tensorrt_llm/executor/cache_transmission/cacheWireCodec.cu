@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cacheWireCodec.h"
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+
+#include <cuda_bf16.h>
+#include <cuda_fp16.h>
+#ifdef ENABLE_FP8
+#include <cuda_fp8.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace tensorrt_llm::executor::kv_cache
+{
+
+#ifdef ENABLE_FP8
+
+namespace
+{
+
+int constexpr kThreadsPerBlock = 256;
+
+// Both kernels alias the 2-byte typed view and the 1-byte FP8 view of the same allocation, so a
+// full conversion cannot run as a single launch: quantizing element i writes byte i, which lives
+// inside input element i/2. Instead the launchers walk power-of-two element chunks
+// [0,1), [1,2), [2,4), [4,8), ... Chunk [a,2a) reads bytes [2a,4a) and writes bytes [a,2a), so in
+// ascending order each chunk only clobbers input that earlier chunks already consumed, and in
+// descending order each chunk only clobbers FP8 bytes that later (already processed) chunks
+// consumed. This costs ~log2(numel) launches, which is noise next to the transfer itself.
+
+template <typename T>
+__global__ void fp8WireQuantizeKernel(uint8_t* data, int64_t begin, int64_t end)
+{
+    auto const idx = begin + static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx < end)
+    {
+        T const value = reinterpret_cast<T const*>(data)[idx];
+        reinterpret_cast<__nv_fp8_e4m3*>(data)[idx] = __nv_fp8_e4m3(value);
+    }
+}
+
+template <typename T>
+__global__ void fp8WireDequantizeKernel(uint8_t* data, int64_t begin, int64_t end)
+{
+    auto const idx = begin + static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx < end)
+    {
+        auto const value = static_cast<float>(reinterpret_cast<__nv_fp8_e4m3 const*>(data)[idx]);
+        reinterpret_cast<T*>(data)[idx] = static_cast<T>(value);
+    }
+}
+
+std::vector<std::pair<int64_t, int64_t>> makeChunks(int64_t numel)
+{
+    std::vector<std::pair<int64_t, int64_t>> chunks;
+    for (int64_t begin = 0, end = 1; begin < numel; begin = end, end = std::min(end * 2, numel))
+    {
+        chunks.emplace_back(begin, end);
+    }
+    return chunks;
+}
+
+template <typename T>
+void runFp8WireCodec(bool quantize, void* data, int64_t numel, cudaStream_t stream)
+{
+    auto chunks = makeChunks(numel);
+    if (!quantize)
+    {
+        std::reverse(chunks.begin(), chunks.end());
+    }
+    auto* bytes = reinterpret_cast<uint8_t*>(data);
+    for (auto const& [begin, end] : chunks)
+    {
+        auto const numBlocks = static_cast<int>(common::ceilDiv(end - begin, static_cast<int64_t>(kThreadsPerBlock)));
+        if (quantize)
+        {
+            fp8WireQuantizeKernel<T><<<numBlocks, kThreadsPerBlock, 0, stream>>>(bytes, begin, end);
+        }
+        else
+        {
+            fp8WireDequantizeKernel<T><<<numBlocks, kThreadsPerBlock, 0, stream>>>(bytes, begin, end);
+        }
+    }
+    sync_check_cuda_error(stream);
+}
+
+void dispatchFp8WireCodec(bool quantize, void* data, int64_t numel, nvinfer1::DataType dataType, cudaStream_t stream)
+{
+    if (numel == 0)
+    {
+        return;
+    }
+    switch (dataType)
+    {
+    case nvinfer1::DataType::kHALF: runFp8WireCodec<half>(quantize, data, numel, stream); break;
+#ifdef ENABLE_BF16
+    case nvinfer1::DataType::kBF16: runFp8WireCodec<__nv_bfloat16>(quantize, data, numel, stream); break;
+#endif
+    default: TLLM_THROW("FP8 KV cache wire codec only supports half/bf16 caches, got dtype %d", static_cast<int>(dataType));
+    }
+}
+
+} // namespace
+
+void invokeInplaceFp8WireQuantize(void* data, int64_t numel, nvinfer1::DataType dataType, cudaStream_t stream)
+{
+    dispatchFp8WireCodec(true, data, numel, dataType, stream);
+}
+
+void invokeInplaceFp8WireDequantize(void* data, int64_t numel, nvinfer1::DataType dataType, cudaStream_t stream)
+{
+    dispatchFp8WireCodec(false, data, numel, dataType, stream);
+}
+
+#else
+
+void invokeInplaceFp8WireQuantize(void* /*data*/, int64_t /*numel*/, nvinfer1::DataType /*dataType*/, cudaStream_t /*stream*/)
+{
+    TLLM_THROW("FP8 KV cache wire codec requires an FP8-enabled build");
+}
+
+void invokeInplaceFp8WireDequantize(void* /*data*/, int64_t /*numel*/, nvinfer1::DataType /*dataType*/, cudaStream_t /*stream*/)
+{
+    TLLM_THROW("FP8 KV cache wire codec requires an FP8-enabled build");
+}
+
+#endif
+
+} // namespace tensorrt_llm::executor::kv_cache
@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// In-place FP8 (E4M3) codec for KV cache wire transfers. Quantization happens inside the
+// pre-allocated (RDMA-registered) transfer buffer, so half/bf16 caches move over the wire at
+// half the byte count without staging through an extra allocation. The receiver dequantizes in
+// place into the same buffer before concatenation.
+
+#pragma once
+
+#include <NvInferRuntimeBase.h>
+
+#include <cstdint>
+#include <cuda_runtime.h>
+
+namespace tensorrt_llm::executor::kv_cache
+{
+
+//! \brief Quantize a half/bf16 buffer to FP8 E4M3 in place.
+//!
+//! The first numel bytes of data hold the FP8 payload afterwards; the remaining bytes are
+//! garbage. Processes power-of-two element chunks in increasing order so no output byte
+//! overwrites input that has not been consumed yet.
+void invokeInplaceFp8WireQuantize(void* data, int64_t numel, nvinfer1::DataType dataType, cudaStream_t stream);
+
+//! \brief Inverse of invokeInplaceFp8WireQuantize: expand the first numel FP8 bytes of data back
+//! to numel half/bf16 elements in place, processing chunks in decreasing order.
+void invokeInplaceFp8WireDequantize(void* data, int64_t numel, nvinfer1::DataType dataType, cudaStream_t stream);
+
+} // namespace tensorrt_llm::executor::kv_cache
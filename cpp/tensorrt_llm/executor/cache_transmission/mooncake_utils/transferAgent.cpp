@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -97,7 +97,6 @@ TransferState MooncakeTransferStatus::wait(int64_t timeout_ms) const
             freeBatchID(mEngine, mBatchId);
             mBatchFreed = true;
             TLLM_LOG_DEBUG("Batch ID %lu freed in wait()", mBatchId);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
             return TransferState::kSUCCESS;
         }
 
@@ -465,11 +464,6 @@ ConnectionInfoType MooncakeTransferAgent::getLocalConnectionInfo()
         syncMessage = request.getSyncMessage().value();
     }
 
-    static size_t const kMaxRequestCount = 1024;
-    uint64_t batchId = allocateBatchID(mEngine, kMaxRequestCount);
-
-    TLLM_CHECK_WITH_INFO(batchId != INVALID_BATCH, "allocateBatchID failed");
-
     int segmentId;
     {
         std::lock_guard<std::mutex> lock(mMutex);
@@ -478,7 +472,7 @@ ConnectionInfoType MooncakeTransferAgent::getLocalConnectionInfo()
         auto it = mConnectedAgents.find(remoteName);
         if (it == mConnectedAgents.end())
         {
-            std::string error = "Remote agent " + remoteName + "not found";
+            std::string error = "Remote agent " + remoteName + " not found";
             TLLM_THROW(error);
         }
 
@@ -492,36 +486,62 @@ ConnectionInfoType MooncakeTransferAgent::getLocalConnectionInfo()
     TLLM_CHECK_WITH_INFO(localDescs.size() == remoteDescs.size(), "Number of local and remote memory must match");
 
     size_t requestCount = localDescs.size();
-    std::vector<transfer_request_t> transferRequests(requestCount);
+
+    // Merge descriptors that are contiguous on both sides into one entry, like
+    // NixlHelper::coalesceTransferDescs does for the NIXL backend. KV cache blocks frequently sit
+    // back to back in the pool, and each batch entry carries its own submission and polling cost.
+    std::vector<transfer_request_t> transferRequests;
+    transferRequests.reserve(requestCount);
 
     for (size_t index = 0; index < requestCount; ++index)
     {
         TLLM_CHECK_WITH_INFO(
             localDescs[index].getLen() == remoteDescs[index].getLen(), "Length of local and remote memory must match");
 
-        transferRequests[index].opcode = (request.getOp() == TransferOp::kREAD) ? OPCODE_READ : OPCODE_WRITE;
-        transferRequests[index].source = reinterpret_cast<void*>(localDescs[index].getAddr());
-        transferRequests[index].target_offset = remoteDescs[index].getAddr();
-        transferRequests[index].length = localDescs[index].getLen();
-        transferRequests[index].target_id = segmentId;
+        if (!transferRequests.empty())
+        {
+            auto& prev = transferRequests.back();
+            if (reinterpret_cast<uintptr_t>(prev.source) + prev.length == localDescs[index].getAddr()
+                && prev.target_offset + prev.length == remoteDescs[index].getAddr())
+            {
+                prev.length += localDescs[index].getLen();
+                continue;
+            }
+        }
+
+        transfer_request_t transferRequest;
+        transferRequest.opcode = (request.getOp() == TransferOp::kREAD) ? OPCODE_READ : OPCODE_WRITE;
+        transferRequest.source = reinterpret_cast<void*>(localDescs[index].getAddr());
+        transferRequest.target_offset = remoteDescs[index].getAddr();
+        transferRequest.length = localDescs[index].getLen();
+        transferRequest.target_id = segmentId;
+        transferRequests.push_back(transferRequest);
     }
 
+    size_t batchSize = transferRequests.size();
+    uint64_t batchId = allocateBatchID(mEngine, batchSize);
+
+    TLLM_CHECK_WITH_INFO(batchId != INVALID_BATCH, "allocateBatchID failed");
+
     int rc = 0;
     if (hasNotif)
     {
+        // The receiver base64-decodes every notification in getNotifiedSyncMessages(), so the
+        // transfer-bound message has to be encoded the same way as notifySyncMessage() does.
+        std::string encoded = MooncakeBase64Helper::encode(syncMessage);
         notify_msg_t notifyMsg;
         notifyMsg.name = const_cast<char*>(mLocalAgentName.c_str());
-        notifyMsg.msg = const_cast<char*>(syncMessage.c_str());
-        rc = submitTransferWithNotify(mEngine, batchId, transferRequests.data(), requestCount, notifyMsg);
+        notifyMsg.msg = const_cast<char*>(encoded.c_str());
+        rc = submitTransferWithNotify(mEngine, batchId, transferRequests.data(), batchSize, notifyMsg);
     }
     else
     {
-        rc = submitTransfer(mEngine, batchId, transferRequests.data(), requestCount);
+        rc = submitTransfer(mEngine, batchId, transferRequests.data(), batchSize);
     }
 
     TLLM_CHECK_WITH_INFO(rc == 0, "submitTransfer failed with status: %d", rc);
 
-    return std::make_unique<MooncakeTransferStatus>(mEngine, batchId, requestCount);
+    return std::make_unique<MooncakeTransferStatus>(mEngine, batchId, batchSize);
 }
 
 void MooncakeTransferAgent::notifySyncMessage(std::string const& name, SyncMessage const& syncMessage)
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -20,7 +20,12 @@
 #include "tensorrt_llm/executor/types.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
+#include <chrono>
+#include <limits>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
 
 namespace tensorrt_llm::executor::disagg_executor
 {
@@ -44,6 +49,10 @@ public:
         auto contextNum = ctxEnginePaths.size();
         mContextReqIdToGlobalId = std::vector<std::unordered_map<IdType, IdType>>(contextNum);
         mContextMapMutexs = std::vector<std::mutex>(contextNum);
+        for (size_t cN = 0; cN < contextNum; cN++)
+        {
+            mContextStates.push_back(std::make_unique<ContextExecutorState>());
+        }
         auto genNum = genEnginePaths.size();
         mGenerationReqIdToGlobalId = std::vector<std::unordered_map<IdType, IdType>>(genNum);
         mGenerationMapMutexs = std::vector<std::mutex>(genNum);
@@ -88,6 +97,10 @@ public:
     {
 
         std::vector<IdType> globalReqIds;
+        if (requests.empty())
+        {
+            return globalReqIds;
+        }
         for (auto const& request : requests)
         {
             globalReqIds.push_back(generatedGlobalId());
@@ -96,8 +109,10 @@ public:
 
         if (batch)
         {
-            size_t contextId = selectContextId.has_value() ? selectContextId.value() : selectContextExecutor();
+            size_t contextId
+                = selectContextId.has_value() ? selectContextId.value() : selectContextExecutor(requests.front());
             auto contextReqIds = mContextExecutors[contextId]->enqueueRequests(requests);
+            mContextStates[contextId]->numInflightRequests += static_cast<SizeType32>(requests.size());
             {
                 std::scoped_lock<std::mutex> lock{mContextMapMutexs[contextId]};
                 for (size_t i = 0; i < requests.size(); ++i)
@@ -110,9 +125,11 @@ public:
         {
             for (size_t i = 0; i < requests.size(); ++i)
             {
-                size_t contextId = selectContextId.has_value() ? selectContextId.value() : selectContextExecutor();
+                size_t contextId
+                    = selectContextId.has_value() ? selectContextId.value() : selectContextExecutor(requests[i]);
 
                 auto contextReqId = mContextExecutors[contextId]->enqueueRequest(requests[i]);
+                mContextStates[contextId]->numInflightRequests += 1;
                 {
                     std::scoped_lock<std::mutex> lock{mContextMapMutexs[contextId]};
                     mContextReqIdToGlobalId[contextId][contextReqId] = globalReqIds[i];
@@ -210,6 +227,7 @@ public:
                     globalId = mContextReqIdToGlobalId.at(contextIdx.value()).at(reqId);
                 }
                 TLLM_CHECK(globalId != 0);
+                mContextStates.at(contextIdx.value())->numInflightRequests -= 1;
                 responses.emplace_back(std::move(resp), globalId);
             }
             return responses;
@@ -229,6 +247,7 @@ public:
                     globalId = mContextReqIdToGlobalId.at(ci).at(reqId);
                 }
                 TLLM_CHECK(globalId != 0);
+                mContextStates.at(ci)->numInflightRequests -= 1;
                 responses.emplace_back(std::move(resp), globalId);
             }
         }
@@ -374,15 +393,143 @@ private:
         return (++mLastId % UINT64_MAX);
     };
 
-    size_t selectContextExecutor()
+    //! State tracked per context executor for load- and cache-affinity-aware routing.
+    struct ContextExecutorState
+    {
+        //! Number of context requests enqueued but not yet answered.
+        std::atomic<SizeType32> numInflightRequests{0};
+        //! Rolling hashes of every cached token prefix at block granularity, maintained from KV cache events.
+        std::unordered_set<size_t> cachedPrefixKeys;
+        //! Maps executor block hashes to prefix keys so that removal events can erase index entries.
+        std::unordered_map<IdType, size_t> blockHashToPrefixKey;
+        //! Tokens per KV cache block, learned from the first stored event.
+        SizeType32 tokensPerBlock{0};
+        std::mutex mutex;
+    };
+
+    //! Seed of the rolling prefix hash, also used for block chains without a parent.
+    static constexpr size_t kEmptyPrefixKey = 0x27d4eb2f165667c5ULL;
+
+    static size_t combineTokenHash(size_t seed, TokenIdType token)
+    {
+        return seed ^ (std::hash<TokenIdType>{}(token) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+    //! \brief Folds new KV cache events of a context executor into its cached-prefix index.
+    void refreshContextCacheIndex(size_t contextIdx)
+    {
+        auto eventManager = mContextExecutors[contextIdx]->getKVCacheEventManager();
+        if (!eventManager.has_value())
+        {
+            return;
+        }
+        auto events = eventManager.value()->getLatestEvents(std::chrono::milliseconds(0));
+        if (events.empty())
+        {
+            return;
+        }
+        auto& state = *mContextStates[contextIdx];
+        std::scoped_lock<std::mutex> lock{state.mutex};
+        for (auto const& event : events)
+        {
+            if (auto const* stored = std::get_if<KVCacheStoredData>(&event.data))
+            {
+                auto prefixKey = kEmptyPrefixKey;
+                if (stored->parentHash.has_value())
+                {
+                    auto it = state.blockHashToPrefixKey.find(stored->parentHash.value());
+                    if (it == state.blockHashToPrefixKey.end())
+                    {
+                        // The parent block was evicted before it was indexed, the chain cannot be extended.
+                        continue;
+                    }
+                    prefixKey = it->second;
+                }
+                for (auto const& block : stored->blocks)
+                {
+                    if (state.tokensPerBlock == 0)
+                    {
+                        state.tokensPerBlock = static_cast<SizeType32>(block.tokens.size());
+                    }
+                    for (auto const& token : block.tokens)
+                    {
+                        prefixKey = combineTokenHash(prefixKey, token.tokenId);
+                    }
+                    state.cachedPrefixKeys.insert(prefixKey);
+                    state.blockHashToPrefixKey[block.blockHash] = prefixKey;
+                }
+            }
+            else if (auto const* removed = std::get_if<KVCacheRemovedData>(&event.data))
+            {
+                for (auto const blockHash : removed->blockHashes)
+                {
+                    auto it = state.blockHashToPrefixKey.find(blockHash);
+                    if (it != state.blockHashToPrefixKey.end())
+                    {
+                        state.cachedPrefixKeys.erase(it->second);
+                        state.blockHashToPrefixKey.erase(it);
+                    }
+                }
+            }
+        }
+    }
+
+    //! \brief Counts how many leading tokens of \p inputTokens (in full blocks) are cached on a context executor.
+    static SizeType32 countMatchedPrefixTokens(ContextExecutorState& state, VecTokens const& inputTokens)
     {
-        static size_t selectContextId = 0;
-        auto contextId = (selectContextId++) % mContextExecutors.size();
-        if (selectContextId >= mContextExecutors.size())
+        std::scoped_lock<std::mutex> lock{state.mutex};
+        if (state.tokensPerBlock <= 0 || state.cachedPrefixKeys.empty())
+        {
+            return 0;
+        }
+        auto const numFullBlocks = static_cast<SizeType32>(inputTokens.size()) / state.tokensPerBlock;
+        auto prefixKey = kEmptyPrefixKey;
+        SizeType32 matchedBlocks{0};
+        for (SizeType32 block = 0; block < numFullBlocks; block++)
         {
-            selectContextId = 0;
+            for (SizeType32 ti = 0; ti < state.tokensPerBlock; ti++)
+            {
+                prefixKey = combineTokenHash(prefixKey, inputTokens[block * state.tokensPerBlock + ti]);
+            }
+            if (state.cachedPrefixKeys.count(prefixKey) == 0)
+            {
+                break;
+            }
+            matchedBlocks++;
+        }
+        return matchedBlocks * state.tokensPerBlock;
+    }
+
+    //! \brief Picks the context executor with the smallest estimated prefill cost for \p request:
+    //! the prompt tokens not covered by the executor's cached prefix, plus a full prompt worth of
+    //! work per inflight request. Ties fall back to round-robin order.
+    size_t selectContextExecutor(texec::Request const& request)
+    {
+        auto const numExecutors = mContextExecutors.size();
+        if (numExecutors == 1)
+        {
+            return 0;
+        }
+        auto const& inputTokens = request.getInputTokenIds();
+        auto const promptTokens = static_cast<int64_t>(inputTokens.size());
+        auto bestCost = std::numeric_limits<int64_t>::max();
+        size_t bestIdx = 0;
+        auto const firstIdx = mNextContextExecutor++ % numExecutors;
+        for (size_t i = 0; i < numExecutors; ++i)
+        {
+            auto const contextIdx = (firstIdx + i) % numExecutors;
+            refreshContextCacheIndex(contextIdx);
+            auto& state = *mContextStates[contextIdx];
+            auto const matchedTokens = static_cast<int64_t>(countMatchedPrefixTokens(state, inputTokens));
+            auto const cost
+                = (promptTokens - matchedTokens) + static_cast<int64_t>(state.numInflightRequests) * promptTokens;
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestIdx = contextIdx;
+            }
         }
-        return contextId;
+        return bestIdx;
     }
 
     size_t selectGenerationExecutor()
@@ -448,6 +595,7 @@ private:
                         globalId = mContextReqIdToGlobalId.at(executorIdx).at(reqId);
                     }
                     TLLM_CHECK(globalId != 0);
+                    mContextStates.at(executorIdx)->numInflightRequests -= 1;
                     responseWithIds.emplace_back(std::move(response), globalId);
                 }
                 if (responseWithIds.size() > 0)
@@ -484,6 +632,8 @@ private:
     std::vector<std::thread> mGenerationThreads;
 
     std::atomic<IdType> mLastId{0};
+    std::atomic<size_t> mNextContextExecutor{0};
+    std::vector<std::unique_ptr<ContextExecutorState>> mContextStates;
     std::vector<std::unordered_map<IdType, IdType>> mContextReqIdToGlobalId;
     std::vector<std::unordered_map<IdType, IdType>> mGenerationReqIdToGlobalId;
     std::vector<std::mutex> mContextMapMutexs;
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,7 +16,9 @@
  */
 
 #include "tensorrt_llm/executor/dynamicBatchTuner.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
+#include <algorithm>
 #include <cmath>
 
 namespace
@@ -43,6 +45,7 @@ DynamicBatchTuner::DynamicBatchTuner(DynamicBatchConfig const& config)
     , mEnableMaxNumTokensTuning(config.getEnableMaxNumTokensTuning())
     , mDynamicBatchMovingAverageWindow(config.getDynamicBatchMovingAverageWindow())
     , mBatchSizeTable(config.getBatchSizeTable())
+    , mTargetIterLatencyMs(tensorrt_llm::common::getEnvDynamicBatchTunerTargetIterMs())
 {
     TLLM_CHECK_WITH_INFO(!mBatchSizeTable.empty(), "Batch size table is empty.");
     for (size_t i = 1; i < mBatchSizeTable.size(); ++i)
@@ -68,21 +71,86 @@ double DynamicBatchTuner::getAverageOutputLength() const
     return mOutputLengthStats.empty() ? 0 : static_cast<double>(mOutputLengthSum) / mOutputLengthStats.size();
 }
 
+void DynamicBatchTuner::recordIterationLatency(double iterLatencyMS, SizeType32 numServedRequests)
+{
+    if (iterLatencyMS <= 0.0 || numServedRequests <= 0)
+    {
+        return;
+    }
+    mWindowLatencySumMs += iterLatencyMS;
+    mWindowServedSum += numServedRequests;
+    if (++mWindowIterCount < kFeedbackEvalWindow)
+    {
+        return;
+    }
+
+    double const avgIterLatencyMs = mWindowLatencySumMs / mWindowIterCount;
+    double const throughput = static_cast<double>(mWindowServedSum) / mWindowLatencySumMs;
+    mWindowIterCount = 0;
+    mWindowLatencySumMs = 0.0;
+    mWindowServedSum = 0;
+
+    if (mTargetIterLatencyMs > 0.0 && avgIterLatencyMs > mTargetIterLatencyMs)
+    {
+        // Latency target violated: shrink the budgets regardless of throughput and re-baseline.
+        mPrevScaleExp = mScaleExp;
+        mScaleExp = std::max(mScaleExp - 1, kScaleExpMin);
+        mScaleDirection = -1;
+        mBestWindowThroughput = 0.0;
+        TLLM_LOG_DEBUG("DynamicBatchTuner: avg iteration latency %.2f ms exceeds target %.2f ms, scale exp -> %d",
+            avgIterLatencyMs, mTargetIterLatencyMs, mScaleExp);
+        return;
+    }
+
+    // Decay the reference so the controller keeps exploring when the workload shifts.
+    mBestWindowThroughput *= kBestThroughputDecay;
+    if (throughput >= mBestWindowThroughput * kThroughputImprovementThreshold)
+    {
+        // The current operating point is (still) the best seen: keep climbing in this direction.
+        mBestWindowThroughput = std::max(throughput, mBestWindowThroughput);
+        mPrevScaleExp = mScaleExp;
+        mScaleExp = std::clamp(mScaleExp + mScaleDirection, kScaleExpMin, kScaleExpMax);
+    }
+    else
+    {
+        // The last move did not help: back off and probe the other direction.
+        mScaleExp = mPrevScaleExp;
+        mScaleDirection = -mScaleDirection;
+        mPrevScaleExp = mScaleExp;
+        mScaleExp = std::clamp(mScaleExp + mScaleDirection, kScaleExpMin, kScaleExpMax);
+    }
+    TLLM_LOG_DEBUG("DynamicBatchTuner: window throughput %.4f req/ms, scale exp -> %d", throughput, mScaleExp);
+}
+
+double DynamicBatchTuner::getFeedbackScale() const
+{
+    return std::pow(2.0, mScaleExp / 4.0);
+}
+
 SizeType32 DynamicBatchTuner::getRuntimeBatchSize(SizeType32 maxCapacityBatchSize) const
 {
+    SizeType32 heuristicBatchSize = maxCapacityBatchSize;
+    bool fromTable = false;
     for (auto const& [batchSizeLimit, batchSize] : mBatchSizeTable)
     {
         if (maxCapacityBatchSize < batchSizeLimit)
         {
-            return batchSize;
+            heuristicBatchSize = batchSize;
+            fromTable = true;
+            break;
         }
     }
-    SizeType32 threshold = maxCapacityBatchSize / kBatchSizeFallbackGranularity * kBatchSizeFallbackGranularity;
-    if (maxCapacityBatchSize < (threshold + kBatchSizeFallbackThreshold))
+    if (!fromTable)
     {
-        return threshold;
+        SizeType32 threshold = maxCapacityBatchSize / kBatchSizeFallbackGranularity * kBatchSizeFallbackGranularity;
+        if (maxCapacityBatchSize < (threshold + kBatchSizeFallbackThreshold))
+        {
+            heuristicBatchSize = threshold;
+        }
     }
-    return maxCapacityBatchSize;
+    // Apply the feedback scale on top of the request-size heuristic.
+    auto scaledBatchSize = static_cast<SizeType32>(heuristicBatchSize * getFeedbackScale());
+    return std::clamp(scaledBatchSize, SizeType32{1}, maxCapacityBatchSize);
 }
 
 SizeType32 DynamicBatchTuner::getRuntimeMaxNumTokens(SizeType32 maxRuntimeBatchSize) const
@@ -107,7 +175,10 @@ SizeType32 DynamicBatchTuner::getRuntimeMaxNumTokens(SizeType32 maxRuntimeBatchS
         tokenThreshold = kMaxNumTokensThresholdGenHeavy;
     }
     // pad it to pow of 2 and max of this value and threshold.
-    return (std::max(1 << int(ceil(log2(adjustedNumTokens))), tokenThreshold));
+    SizeType32 heuristicMaxNumTokens = std::max(1 << int(ceil(log2(adjustedNumTokens))), tokenThreshold);
+    // Apply the feedback scale, rounded to a multiple of 64 so chunk sizes stay well-formed.
+    auto scaledMaxNumTokens = static_cast<SizeType32>(heuristicMaxNumTokens * getFeedbackScale()) / 64 * 64;
+    return std::max(scaledMaxNumTokens, SizeType32{64});
 }
 
 } // namespace tensorrt_llm::executor
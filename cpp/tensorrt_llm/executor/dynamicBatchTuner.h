@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -58,6 +58,16 @@ public:
     /// @brief Get the dynamic max num tokens based on the current statistics.
     [[nodiscard]] SizeType32 getRuntimeMaxNumTokens(SizeType32 runtimeBatchSize) const;
 
+    /// @brief Record the measured latency of one engine iteration together with the number of
+    /// requests it served. Drives the feedback controller that hill-climbs a multiplicative scale
+    /// on top of the request-size heuristics, so the budgets track measured throughput instead of
+    /// token statistics alone.
+    void recordIterationLatency(double iterLatencyMS, SizeType32 numServedRequests);
+
+    /// @brief Current multiplicative scale applied by the feedback controller to the heuristic
+    /// batch/token budgets. 1.0 until enough iterations have been recorded.
+    [[nodiscard]] double getFeedbackScale() const;
+
 private:
     bool mEnableBatchSizeTuning = false;
 
@@ -73,6 +83,20 @@ private:
     int64_t mOutputLengthSum = 0;
     std::deque<SizeType32> mOutputLengthStats;
 
+    // Feedback controller state. The controller evaluates measured throughput (served requests per
+    // millisecond) over windows of kFeedbackEvalWindow iterations and hill-climbs the exponent of
+    // a multiplicative scale (2^(mScaleExp / 4), i.e. 0.5x .. 2x) applied to the heuristic budgets.
+    // When TRTLLM_DYNAMIC_BATCH_TARGET_ITER_MS is set and the average iteration latency exceeds
+    // it, the budgets are shrunk regardless of throughput.
+    double mTargetIterLatencyMs = 0.0;
+    int mScaleExp = 0;
+    int mPrevScaleExp = 0;
+    int mScaleDirection = 1;
+    double mBestWindowThroughput = 0.0;
+    double mWindowLatencySumMs = 0.0;
+    int64_t mWindowServedSum = 0;
+    SizeType32 mWindowIterCount = 0;
+
     static SizeType32 const kBatchSizeFallbackGranularity = 512;
     static SizeType32 const kBatchSizeFallbackThreshold = 128;
 
@@ -82,6 +106,14 @@ private:
     static SizeType32 const kMaxNumTokensThresholdContextHeavy = 8192;
     static SizeType32 const kMaxNumTokensThresholdBalanced = 4096;
     static SizeType32 const kMaxNumTokensThresholdGenHeavy = 2048;
+
+    static SizeType32 const kFeedbackEvalWindow = 64;
+    static int const kScaleExpMin = -4;
+    static int const kScaleExpMax = 4;
+    // Decay of the best observed throughput per evaluation window, so the controller keeps
+    // exploring when the workload mix shifts over time.
+    static double constexpr kBestThroughputDecay = 0.99;
+    static double constexpr kThroughputImprovementThreshold = 1.02;
 };
 
 } // namespace tensorrt_llm::executor
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -97,6 +97,11 @@ void Executor::cancelRequest(IdType requestId)
     return mImpl->cancelRequest(requestId);
 }
 
+void Executor::warmup(WarmupConfig const& warmupConfig)
+{
+    return mImpl->warmup(warmupConfig);
+}
+
 void Executor::shutdown()
 {
     return mImpl->shutdown();
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -20,8 +20,10 @@
 #include "tensorrt_llm/batch_manager/trtGptModelFactory.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaProfilerUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
+#include "tensorrt_llm/common/poolAllocator.h"
 #include "tensorrt_llm/common/timestampUtils.h"
 #include "tensorrt_llm/common/utils.h"
 #include "tensorrt_llm/executor/dataTransceiverState.h"
@@ -30,10 +32,12 @@
 #include "tensorrt_llm/executor/requestUtils.h"
 #include "tensorrt_llm/executor/serialization.h"
 #include "tensorrt_llm/executor/serializeUtils.h"
+#include "tensorrt_llm/executor/shmRingChannel.h"
 #include "tensorrt_llm/executor/types.h"
 #include "tensorrt_llm/executor/version.h"
 #include "tensorrt_llm/runtime/loraCache.h"
 #include "tensorrt_llm/runtime/memoryCounters.h"
+#include "tensorrt_llm/runtime/moeLoadBalancer/topologyDetector.h"
 #include "tensorrt_llm/runtime/utils/mpiTags.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
@@ -44,6 +48,8 @@
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <set>
+#include <tuple>
 #include <utility>
 
 namespace tensorrt_llm::executor
@@ -86,6 +92,51 @@ namespace
     return fixedExecutorConfig;
 }
 
+// Warns when the requested device ordering places a tensor parallel group across NUMA domains even
+// though the detected topology could host it inside one. TP collectives run on every layer, so a
+// group that straddles the inter-socket link pays for it on each forward pass, while pipeline
+// stages only exchange activations once per micro batch.
+void checkDeviceIdsAgainstTopology(std::vector<SizeType32> const& deviceIds, SizeType32 tp)
+{
+    auto& detector = runtime::TopologyDetector::getInstance();
+    auto const& gpuToNuma = detector.getGpuToNumaMap();
+    auto const& numaToGpu = detector.getNumaToGpuMap();
+
+    size_t maxGpusPerNuma = 0;
+    for (auto const& [numaId, gpus] : numaToGpu)
+    {
+        maxGpusPerNuma = std::max(maxGpusPerNuma, gpus.size());
+    }
+    if (numaToGpu.size() < 2 || maxGpusPerNuma < static_cast<size_t>(tp))
+    {
+        // Either there is no slow boundary to cross, or every TP group of this size has to cross it.
+        return;
+    }
+
+    for (size_t group = 0; group + tp <= deviceIds.size(); group += tp)
+    {
+        std::set<int> numaNodes;
+        for (SizeType32 rank = 0; rank < tp; ++rank)
+        {
+            auto it = gpuToNuma.find(deviceIds[group + rank]);
+            if (it == gpuToNuma.end())
+            {
+                // Topology detection does not cover the requested device; nothing reliable to say.
+                return;
+            }
+            numaNodes.insert(it->second);
+        }
+        if (numaNodes.size() > 1)
+        {
+            TLLM_LOG_WARNING(
+                "The tensor parallel group starting at deviceIds[%zu] spans %zu NUMA domains although a single "
+                "domain holds %zu GPUs. Its collectives will cross a slow link on every layer; reorder deviceIds "
+                "so that each group of %d consecutive devices shares one NUMA domain.",
+                group, numaNodes.size(), maxGpusPerNuma, tp);
+        }
+    }
+}
+
 SizeType32 getNumChildRequests(Request const& request)
 {
     auto samplingConfig = request.getSamplingConfig();
@@ -598,6 +649,14 @@ void Executor::Impl::initializeCommAndWorkers(SizeType32 tp, SizeType32 pp, Size
     auto parallelConfig = executorConfig.getParallelConfig().value_or(ParallelConfig());
     validateParallelConfig(parallelConfig, modelType, modelPath);
 
+    if (auto const requestedCp = parallelConfig.getContextParallelism(); requestedCp.has_value())
+    {
+        TLLM_CHECK_WITH_INFO(requestedCp.value() == cp,
+            "ParallelConfig requests context parallelism %d, but the model was built with context parallelism %d. "
+            "The sequence sharding and ring exchange layout are fixed at build time, so the two must match.",
+            requestedCp.value(), cp);
+    }
+
     mCommMode = parallelConfig.getCommunicationMode();
     auto optOrchestratorConfig = parallelConfig.getOrchestratorConfig();
 
@@ -777,6 +836,12 @@ void Executor::Impl::initializeWorkers(SizeType32 tp, SizeType32 pp, SizeType32
                                              "to tp*pp*cp (tp is %u, pp is %u, cp is %u)",
                     deviceIds.size(), numNodes, tp, pp, cp));
         }
+        else if (mWorldRank == participantIds.front())
+        {
+            // Single-node specification: each TP group is a contiguous run of tp entries, so the
+            // requested ordering can be checked against the detected GPU/NUMA affinity.
+            checkDeviceIdsAgainstTopology(deviceIds, tp);
+        }
     }
 
     // Bool that indicates if current process is worker for this model or not
@@ -927,30 +992,46 @@ std::vector<IdType> Executor::Impl::enqueueRequests(common::ArrayView<Request co
 
     if (mCommMode == CommunicationMode::kLEADER)
     {
+        auto const numEntries = static_cast<SizeType32>(requestWithIds.size());
+        if (mMaxQueueSize && mMaxQueueSize.value() > 0)
         {
-            std::scoped_lock<std::mutex> const lck(mQueuedReqMtx);
-            if (mMaxQueueSize)
-            {
-                auto const maxQueueSize = mMaxQueueSize.value();
+            auto const maxQueueSize = mMaxQueueSize.value();
 
-                auto totalRequestSize = 0;
-                for (auto&& reqWithId : requestWithIds)
-                {
-                    totalRequestSize += (getNumChildRequests(reqWithId.req) + 1);
-                }
+            auto totalRequestSize = 0;
+            for (auto&& reqWithId : requestWithIds)
+            {
+                totalRequestSize += (getNumChildRequests(reqWithId.req) + 1);
+            }
 
-                if (maxQueueSize > 0 && mQueuedRequests.size() + totalRequestSize > static_cast<size_t>(maxQueueSize))
+            auto numQueued = mNumQueuedRequests.load();
+            do
+            {
+                if (numQueued + totalRequestSize > maxQueueSize)
                 {
                     TLLM_THROW("Maximum queue size of %d has been reached, please try again later", maxQueueSize);
                 }
-            }
+            } while (!mNumQueuedRequests.compare_exchange_weak(numQueued, numQueued + numEntries));
+        }
+        else
+        {
+            mNumQueuedRequests += numEntries;
+        }
 
-            for (auto&& req : requestWithIds)
+        // Lock-free admission: the worker loop drains mAdmittedRequests into the priority-ordered
+        // queue. Only the push that makes the queue non-empty wakes the worker, so a burst of
+        // enqueues results in a single notification.
+        if (mAdmittedRequests.pushBatch(std::move(requestWithIds)))
+        {
+            // Briefly take the lock before notifying so the push is ordered against the worker's
+            // predicate check in getLeaderNewReqWithIds. Without it, this single empty->non-empty
+            // notification could land between the predicate evaluation and the wait and be lost,
+            // stalling an idle worker forever since later pushes see a non-empty queue and do not
+            // notify again.
             {
-                insertRequestInOrder(mQueuedRequests, std::move(req));
+                std::scoped_lock<std::mutex> const lck(mQueuedReqMtx);
             }
+            mQueuedReqCv.notify_one();
         }
-        mQueuedReqCv.notify_one();
     }
     else if (mCommMode == CommunicationMode::kORCHESTRATOR)
     {
@@ -1095,6 +1176,53 @@ SizeType32 Executor::Impl::getNumResponsesReady(std::optional<IdType> const& opt
     return numResponsesReady;
 }
 
+void Executor::Impl::warmup(WarmupConfig const& warmupConfig)
+{
+    TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
+    if (!canEnqueueRequests())
+    {
+        return;
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    OutputConfig outputConfig;
+    outputConfig.excludeInputFromOutput = true;
+    for (auto const& bucket : warmupConfig.getBuckets())
+    {
+        TLLM_LOG_INFO(
+            "Warming up bucket (inputLen %d, outputLen %d, batchSize %d)", bucket.inputLen, bucket.outputLen,
+            bucket.batchSize);
+        VecTokens const inputTokenIds(bucket.inputLen, warmupConfig.getWarmupTokenId());
+        std::vector<Request> requests;
+        requests.reserve(bucket.batchSize);
+        for (SizeType32 i = 0; i < bucket.batchSize; ++i)
+        {
+            requests.emplace_back(inputTokenIds, bucket.outputLen, false, SamplingConfig(), outputConfig);
+        }
+        auto const requestIds = enqueueRequests(requests);
+        for (auto const requestId : requestIds)
+        {
+            bool finished = false;
+            while (!finished)
+            {
+                auto const responses = awaitResponses(requestId, warmupConfig.getTimeout());
+                TLLM_CHECK_WITH_INFO(!responses.empty(),
+                    "Timed out waiting for warmup responses of bucket (inputLen %d, outputLen %d, batchSize %d)",
+                    bucket.inputLen, bucket.outputLen, bucket.batchSize);
+                for (auto const& response : responses)
+                {
+                    TLLM_CHECK_WITH_INFO(
+                        !response.hasError(), "Warmup request failed: %s", response.getErrorMsg().c_str());
+                    finished |= response.getResult().isFinal;
+                }
+            }
+        }
+    }
+    auto const elapsedMs
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    TLLM_LOG_INFO("Executor warmup finished in %ld ms", static_cast<long>(elapsedMs.count()));
+}
+
 void Executor::Impl::shutdown()
 {
     // Cannot call shutdown multiple times
@@ -1198,7 +1326,7 @@ std::deque<IterationStats> Executor::Impl::getLatestIterationStats()
     TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
     checkParallelApiUsage(__func__);
     std::scoped_lock<std::mutex> lck(mIterStatsMtx);
-    return std::exchange(mIterationStats, {});
+    return drainIterStats();
 }
 
 std::deque<RequestStatsPerIteration> Executor::Impl::getLatestRequestStats()
@@ -1251,6 +1379,10 @@ std::optional<std::shared_ptr<KVCacheEventManager>> Executor::Impl::getKVCacheEv
 void Executor::Impl::requestWithIdLeaderThread()
 {
     TLLM_CUDA_CHECK(cudaSetDevice(mModel->getWorldConfig().getDevice()));
+    if (tensorrt_llm::common::getEnvNumaAwareExecutor())
+    {
+        runtime::TopologyDetector::getInstance().bindThreadByCurrentGpu();
+    }
     auto constexpr peer = 0;
     while (true)
     {
@@ -1285,6 +1417,10 @@ void Executor::Impl::requestWithIdLeaderThread()
 void Executor::Impl::cancelledRequestsLeaderThread()
 {
     TLLM_CUDA_CHECK(cudaSetDevice(mModel->getWorldConfig().getDevice()));
+    if (tensorrt_llm::common::getEnvNumaAwareExecutor())
+    {
+        runtime::TopologyDetector::getInstance().bindThreadByCurrentGpu();
+    }
     auto constexpr peer = 0;
     while (true)
     {
@@ -1310,7 +1446,15 @@ std::vector<RequestWithId> Executor::Impl::getLeaderNewReqWithIds(
     SizeType32 numActiveRequests, std::optional<PriorityType> lowestPriorityActive)
 {
     std::unique_lock<std::mutex> lck(mQueuedReqMtx);
-    mQueuedReqCv.wait(lck, [&]() { return (!mQueuedRequests.empty() || numActiveRequests > 0 || mShutdown); });
+    mQueuedReqCv.wait(lck,
+        [&]()
+        { return (!mQueuedRequests.empty() || !mAdmittedRequests.empty() || numActiveRequests > 0 || mShutdown); });
+
+    // Drain the lock-free admission queue into the priority-ordered queue.
+    for (auto&& req : mAdmittedRequests.drain())
+    {
+        insertRequestInOrder(mQueuedRequests, std::move(req));
+    }
 
     std::vector<RequestWithId> reqWithIds;
 
@@ -1326,51 +1470,119 @@ std::vector<RequestWithId> Executor::Impl::getLeaderNewReqWithIds(
         return reqWithIds;
     }
 
-    auto const& firstRequest = mQueuedRequests.front();
-    auto const firstBeamWidth = firstRequest.req.getSamplingConfig().getBeamWidth();
-    auto const operatingBeamWidth = numActiveRequests > 0 ? mModel->getOperatingBeamWidth() : firstBeamWidth;
-
-    auto const tryInsertQueuedRequestIntoReqWithIds = [this, &reqWithIds, operatingBeamWidth]() -> bool
+    // Deadline decisions have to be made here on the leader, before the requests are broadcast: the
+    // schedulers run on every rank, and per-rank wall-clock reads could make ranks disagree on which
+    // requests to schedule. Queued requests whose allotted time is already spent (or, with
+    // deadline-aware admission enabled, cannot cover a projected first iteration) are finished with
+    // a timed-out response instead of being admitted.
+    auto const minTtftMs = tensorrt_llm::common::getEnvDeadlineAwareAdmission()
+        ? mIterLatencyEwmaMs.load(std::memory_order_relaxed)
+        : 0.0;
+    auto const now = std::chrono::steady_clock::now();
+    auto const remainingTimeMs = [&now](RequestWithId const& reqWithId) -> std::optional<double>
     {
-        auto& nextRequest = mQueuedRequests.front();
-        auto const beamWidth = nextRequest.req.getSamplingConfig().getBeamWidth();
-        if (beamWidth != operatingBeamWidth)
+        auto const allottedTimeMs = reqWithId.req.getAllottedTimeMs();
+        if (!allottedTimeMs)
         {
-            TLLM_LOG_INFO(
-                "Can't dequeue request with ID %ld because beam width %d differs from operating beam width %d.",
-                nextRequest.id, beamWidth, operatingBeamWidth);
-            return false;
+            return std::nullopt;
         }
-
-        TLLM_LOG_DEBUG("Dequeue request with ID %ld", nextRequest.id);
-        reqWithIds.emplace_back(std::move(nextRequest));
-        mQueuedRequests.pop_front();
-        return true;
+        auto const elapsedMs = std::chrono::duration<double, std::milli>(now - reqWithId.queuedStart).count();
+        return static_cast<double>(allottedTimeMs->count()) - elapsedMs;
     };
-
-    auto const maxNewRequests = static_cast<size_t>(std::max(mMaxNumActiveRequests - numActiveRequests, 0));
-    for (size_t req = 0; !mQueuedRequests.empty() && req < maxNewRequests;)
-    {
-        req += (getNumChildRequests(mQueuedRequests.front().req) + 1);
-        if (req > maxNewRequests)
-        {
-            break;
+    std::vector<Response> timedOutResponses;
+    for (auto it = mQueuedRequests.begin(); it != mQueuedRequests.end();)
+    {
+        auto const remainingMs = remainingTimeMs(*it);
+        if (remainingMs && *remainingMs <= minTtftMs)
+        {
+            TLLM_LOG_DEBUG("Finishing queued request with ID %ld as timed out before admission", it->id);
+            auto const beamWidth = it->req.getSamplingConfig().getBeamWidth();
+            Result result;
+            result.isFinal = true;
+            result.outputTokenIds.resize(beamWidth);
+            result.finishReasons.assign(beamWidth, FinishReason::kTIMED_OUT);
+            result.isSequenceFinal = true;
+            timedOutResponses.emplace_back(it->id, std::move(result), it->req.getClientId());
+            --mNumQueuedRequests;
+            it = mQueuedRequests.erase(it);
         }
-        if (!tryInsertQueuedRequestIntoReqWithIds())
+        else
         {
-            break;
+            ++it;
         }
     }
 
-    if (lowestPriorityActive)
-    {
-        while (!mQueuedRequests.empty() && mQueuedRequests.front().req.getPriority() > (*lowestPriorityActive))
+    auto const maxNewRequests = static_cast<size_t>(std::max(mMaxNumActiveRequests - numActiveRequests, 0));
+    if (!mQueuedRequests.empty())
+    {
+        if (minTtftMs > 0.0 && maxNewRequests > 0)
+        {
+            // Within a bounded window at the head of the queue, pull requests whose deadline slack is
+            // down to a few iterations ahead of their priority position. The reordering is stable, so
+            // requests without a deadline keep their relative order and the queue stays deterministic.
+            auto constexpr nearDeadlineFactor = 4.0;
+            auto const window = std::min(mQueuedRequests.size(), 2 * maxNewRequests);
+            std::stable_partition(mQueuedRequests.begin(),
+                mQueuedRequests.begin() + static_cast<std::ptrdiff_t>(window),
+                [&](RequestWithId const& reqWithId)
+                {
+                    auto const remainingMs = remainingTimeMs(reqWithId);
+                    return remainingMs && *remainingMs < nearDeadlineFactor * minTtftMs;
+                });
+        }
+
+        auto const& firstRequest = mQueuedRequests.front();
+        auto const firstBeamWidth = firstRequest.req.getSamplingConfig().getBeamWidth();
+        auto const operatingBeamWidth = numActiveRequests > 0 ? mModel->getOperatingBeamWidth() : firstBeamWidth;
+
+        auto const tryInsertQueuedRequestIntoReqWithIds = [this, &reqWithIds, operatingBeamWidth]() -> bool
+        {
+            auto& nextRequest = mQueuedRequests.front();
+            auto const beamWidth = nextRequest.req.getSamplingConfig().getBeamWidth();
+            if (beamWidth != operatingBeamWidth)
+            {
+                TLLM_LOG_INFO(
+                    "Can't dequeue request with ID %ld because beam width %d differs from operating beam width %d.",
+                    nextRequest.id, beamWidth, operatingBeamWidth);
+                return false;
+            }
+
+            TLLM_LOG_DEBUG("Dequeue request with ID %ld", nextRequest.id);
+            --mNumQueuedRequests;
+            reqWithIds.emplace_back(std::move(nextRequest));
+            mQueuedRequests.pop_front();
+            return true;
+        };
+
+        for (size_t req = 0; !mQueuedRequests.empty() && req < maxNewRequests;)
         {
+            req += (getNumChildRequests(mQueuedRequests.front().req) + 1);
+            if (req > maxNewRequests)
+            {
+                break;
+            }
             if (!tryInsertQueuedRequestIntoReqWithIds())
             {
                 break;
             }
         }
+
+        if (lowestPriorityActive)
+        {
+            while (!mQueuedRequests.empty() && mQueuedRequests.front().req.getPriority() > (*lowestPriorityActive))
+            {
+                if (!tryInsertQueuedRequestIntoReqWithIds())
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (!timedOutResponses.empty())
+    {
+        lck.unlock();
+        enqueueNewResponses(std::move(timedOutResponses));
     }
     return reqWithIds;
 }
@@ -1418,14 +1630,30 @@ std::vector<RequestWithId> Executor::Impl::getNewReqWithIds(
         }
         if (worldConfig.isTensorParallel() || worldConfig.isContextParallel())
         {
-            auto packed = RequestWithId::serializeReqWithIds(reqWithIds);
+            // Steady-state iterations usually admit nothing, so broadcast the count first and only
+            // serialize and ship the payload when there are new requests. This keeps the common
+            // empty iteration down to one small broadcast per communicator instead of serializing
+            // and transferring an empty payload every step.
+            auto numNewRequests = static_cast<int64_t>(reqWithIds.size());
             if (worldConfig.isTensorParallel())
             {
-                mCommTensorParallel->bcast(packed, 0);
+                mCommTensorParallel->bcastValue(numNewRequests, 0);
             }
             if (worldConfig.isContextParallel())
             {
-                mCommContextParallel->bcast(packed, 0);
+                mCommContextParallel->bcastValue(numNewRequests, 0);
+            }
+            if (numNewRequests > 0)
+            {
+                auto packed = RequestWithId::serializeReqWithIds(reqWithIds);
+                if (worldConfig.isTensorParallel())
+                {
+                    mCommTensorParallel->bcast(packed, 0);
+                }
+                if (worldConfig.isContextParallel())
+                {
+                    mCommContextParallel->bcast(packed, 0);
+                }
             }
         }
     }
@@ -1433,10 +1661,16 @@ std::vector<RequestWithId> Executor::Impl::getNewReqWithIds(
     {
         if (worldConfig.isFirstPipelineParallelRank())
         {
-            std::vector<char> buffer;
-            mCommTensorParallel->bcast(buffer, 0);
-            mCommContextParallel->bcast(buffer, 0);
-            reqWithIds = RequestWithId::deserializeReqWithIds(buffer);
+            int64_t numNewRequests{0};
+            mCommTensorParallel->bcastValue(numNewRequests, 0);
+            mCommContextParallel->bcastValue(numNewRequests, 0);
+            if (numNewRequests > 0)
+            {
+                std::vector<char> buffer;
+                mCommTensorParallel->bcast(buffer, 0);
+                mCommContextParallel->bcast(buffer, 0);
+                reqWithIds = RequestWithId::deserializeReqWithIds(buffer);
+            }
         }
         else
         {
@@ -1516,8 +1750,11 @@ std::tuple<Executor::Impl::RequestList, double> Executor::Impl::fetchNewRequests
                     }
                 }
             }
-            auto newLlmReq = std::make_shared<batch_manager::LlmRequest>(
-                reqWithId.id, reqWithId.req, llmRequestLogitsPostProcessor, applyLogitsPostProcessorBatched);
+            // Recycle the request and control block allocation through the pool; requests are
+            // created and destroyed at a high rate on the admission path.
+            auto newLlmReq = std::allocate_shared<batch_manager::LlmRequest>(
+                common::PoolAllocator<batch_manager::LlmRequest>(), reqWithId.id, reqWithId.req,
+                llmRequestLogitsPostProcessor, applyLogitsPostProcessorBatched);
 
             auto numReturnSequences = newLlmReq->getNumSubRequests();
             if (numReturnSequences > 1)
@@ -1617,6 +1854,28 @@ std::tuple<Executor::Impl::RequestList, double> Executor::Impl::fetchNewRequests
                     }
                 }
 
+                // Create the top logprobs tensors
+                if (newReq->getNumTopLogprobs() > 0)
+                {
+                    TLLM_CHECK_WITH_INFO(newReq->getSamplingConfig().beamWidth == 1,
+                        "numTopLogprobs is only supported with beamWidth 1");
+                    TLLM_CHECK_WITH_INFO(
+                        mModel->getModelConfig().getSpeculativeDecodingMode().isNone()
+                            && !newReq->hasDraftTokens(),
+                        "numTopLogprobs is not supported with speculative decoding");
+                    TLLM_CHECK_WITH_INFO(newReq->getNumTopLogprobs() <= mModel->getVocabSizePadded(),
+                        "numTopLogprobs must not exceed the padded vocabulary size");
+                    newReq->allocTopLogprobsHost();
+                }
+
+                // Create the prompt logprobs tensor for teacher-forced scoring
+                if (newReq->getReturnPromptLogprobs())
+                {
+                    TLLM_CHECK_WITH_INFO(mModel->getModelConfig().computeContextLogits(),
+                        "To return prompt logprobs, gather_context_logits must be enabled when building the model");
+                    newReq->allocPromptLogprobsHost();
+                }
+
                 if (mModel->getWorldConfig().isLastPipelineParallelRank() && newReq->getGuidedDecodingParams())
                 {
                     TLLM_CHECK_WITH_INFO(mModel->hasGuidedDecoder(),
@@ -1797,10 +2056,17 @@ void Executor::Impl::forwardAsync(RequestList& activeRequests)
     }
 }
 
-IterationStats Executor::Impl::getCurrentIterationStats(RequestList const& activeRequests, double iterLatencyMS,
-    SizeType32 numNewActiveRequests, double newActiveRequestsQueueLatencyMS, SizeType32 numCompletedRequests)
+void Executor::Impl::getCurrentIterationStats(IterationStats& stats, RequestList const& activeRequests,
+    double iterLatencyMS, SizeType32 numNewActiveRequests, double newActiveRequestsQueueLatencyMS,
+    SizeType32 numCompletedRequests)
 {
-    IterationStats stats;
+    // The snapshot slot is reused across iterations, so clear the fields the model fills only
+    // conditionally before filling it in place.
+    stats.kvCacheStats.reset();
+    stats.crossKvCacheStats.reset();
+    stats.staticBatchingStats.reset();
+    stats.inflightBatchingStats.reset();
+    stats.specDecodingStats.reset();
     // Timestamp
     stats.timestamp = tensorrt_llm::common::getCurrentTimestamp();
     stats.numNewActiveRequests = numNewActiveRequests;
@@ -1809,10 +2075,7 @@ IterationStats Executor::Impl::getCurrentIterationStats(RequestList const& activ
     // Active request count
     stats.numActiveRequests = static_cast<SizeType32>(activeRequests.size());
     // Queued request count
-    {
-        std::scoped_lock<std::mutex> lck(mQueuedReqMtx);
-        stats.numQueuedRequests = static_cast<SizeType32>(mQueuedRequests.size());
-    }
+    stats.numQueuedRequests = mNumQueuedRequests.load();
     stats.numCompletedRequests = numCompletedRequests;
     // Max number of requests
     stats.maxNumActiveRequests = mMaxNumActiveRequests;
@@ -1824,7 +2087,6 @@ IterationStats Executor::Impl::getCurrentIterationStats(RequestList const& activ
 
     // Model specific stats
     mModel->getCurrentIterationStats(stats);
-    return stats;
 }
 
 RequestStatsPerIteration Executor::Impl::getCurrentRequestStats(
@@ -1905,29 +2167,42 @@ RequestStatsPerIteration Executor::Impl::getCurrentRequestStats(
     return stats;
 }
 
-void Executor::Impl::appendCurrentIterStats(IterationStats&& currentIterStats)
+IterationStats& Executor::Impl::claimIterStatsSlot()
 {
-    std::scoped_lock<std::mutex> lck(mIterStatsMtx);
-    if (mIterationStats.size() >= mIterStatsMaxIterations)
+    if (mIterStatsRing.empty())
     {
-        mIterationStats.pop_front();
+        mIterStatsRing.resize(mIterStatsMaxIterations);
     }
-    mIterationStats.emplace_back(std::move(currentIterStats));
+    if (mIterStatsRingCount == mIterStatsRing.size())
+    {
+        // Ring is full, overwrite the oldest pending snapshot.
+        mIterStatsRingHead = (mIterStatsRingHead + 1) % mIterStatsRing.size();
+        --mIterStatsRingCount;
+    }
+    auto& slot = mIterStatsRing[(mIterStatsRingHead + mIterStatsRingCount) % mIterStatsRing.size()];
+    ++mIterStatsRingCount;
+    return slot;
+}
+
+std::deque<IterationStats> Executor::Impl::drainIterStats()
+{
+    std::deque<IterationStats> iterStats;
+    for (size_t i = 0; i < mIterStatsRingCount; ++i)
+    {
+        iterStats.push_back(mIterStatsRing[(mIterStatsRingHead + i) % mIterStatsRing.size()]);
+    }
+    mIterStatsRingHead = (mIterStatsRingHead + mIterStatsRingCount) % std::max<size_t>(mIterStatsRing.size(), 1);
+    mIterStatsRingCount = 0;
+    return iterStats;
 }
 
 void Executor::Impl::appendMultipleIterStats(std::vector<IterationStats>&& currentIterStatsVec)
 {
     std::scoped_lock<std::mutex> lck(mIterStatsMtx);
-    if (mIterationStats.size() + currentIterStatsVec.size() > mIterStatsMaxIterations)
+    for (auto& currentIterStats : currentIterStatsVec)
     {
-        size_t removeCount = mIterationStats.size() + currentIterStatsVec.size() - mIterStatsMaxIterations;
-        for (size_t i = 0; i < removeCount; i++)
-        {
-            mIterationStats.pop_front();
-        }
+        claimIterStatsSlot() = std::move(currentIterStats);
     }
-    mIterationStats.insert(mIterationStats.end(), std::make_move_iterator(currentIterStatsVec.begin()),
-        std::make_move_iterator(currentIterStatsVec.end()));
 }
 
 void Executor::Impl::updateIterationStats(RequestList const& activeRequests, double iterLatencyMS,
@@ -1937,8 +2212,12 @@ void Executor::Impl::updateIterationStats(RequestList const& activeRequests, dou
     NVTX3_SCOPED_RANGE(updateIterationStats);
     if (mIterStatsMaxIterations > 0 && mIsLeader)
     {
-        auto currentIterStats = getCurrentIterationStats(
-            activeRequests, iterLatencyMS, numNewActiveRequests, newActiveRequestsQueueLatencyMS, numCompletedRequests);
+        std::unique_lock<std::mutex> lck(mIterStatsMtx);
+        // Fill a preallocated snapshot slot in place rather than building a fresh stats object, so
+        // that stats collection does not allocate on the iteration loop after warmup.
+        auto& currentIterStats = claimIterStatsSlot();
+        getCurrentIterationStats(currentIterStats, activeRequests, iterLatencyMS, numNewActiveRequests,
+            newActiveRequestsQueueLatencyMS, numCompletedRequests);
         // Send the stats to the orchestrator
         if (mCommMode == CommunicationMode::kORCHESTRATOR)
         {
@@ -1946,14 +2225,10 @@ void Executor::Impl::updateIterationStats(RequestList const& activeRequests, dou
                                         && currentIterStats.inflightBatchingStats->numScheduledRequests > 0)
                 || (currentIterStats.staticBatchingStats
                     && currentIterStats.staticBatchingStats->numScheduledRequests > 0);
-            appendCurrentIterStats(std::move(currentIterStats));
             if (hasSchedThisIter || flushToOrchestrator)
             {
-                std::deque<IterationStats> iterStatsQueue;
-                {
-                    std::scoped_lock<std::mutex> lck(mIterStatsMtx);
-                    iterStatsQueue = std::exchange(mIterationStats, {});
-                }
+                auto iterStatsQueue = drainIterStats();
+                lck.unlock();
                 MpiMessage message(MpiId::ITER_STATS);
                 std::vector<IterationStats> iterStates(
                     std::make_move_iterator(iterStatsQueue.begin()), std::make_move_iterator(iterStatsQueue.end()));
@@ -1961,11 +2236,6 @@ void Executor::Impl::updateIterationStats(RequestList const& activeRequests, dou
                 mSendQueue.push(std::move(message));
             }
         }
-        else
-        {
-            // Add current iteration stats
-            appendCurrentIterStats(std::move(currentIterStats));
-        }
     }
 }
 
@@ -2200,6 +2470,12 @@ void Executor::Impl::terminateContextFinishedRequests(InTransList& inTransmissio
 
 void Executor::Impl::appendNewResponses(std::vector<Response>&& newResponses)
 {
+    // Batched symmetrically with admission: take the lock and notify once per batch, and skip
+    // the notification entirely on iterations that produced no responses.
+    if (newResponses.empty())
+    {
+        return;
+    }
     {
         std::scoped_lock<std::mutex> lck(mResponsesMtx);
         for (auto& response : newResponses)
@@ -2215,6 +2491,7 @@ Executor::Impl::RequestList Executor::Impl::populateNewResponses(
 {
     NVTX3_SCOPED_RANGE(populateNewResponses);
     RequestList finishedRequests;
+    RequestList deferredRequests;
     for (auto it = activeRequests.begin(); it != activeRequests.end();)
     {
         auto const& llmReq = (*it);
@@ -2222,10 +2499,21 @@ Executor::Impl::RequestList Executor::Impl::populateNewResponses(
         // Only leader should store responses
         if (mIsLeader)
         {
-            auto response = llmReq->createResponse(mModel->hasSpeculativeDecodingFastLogits(), mWorldRank);
-            if (response)
+            if (mResponsePool && requestDone && !llmReq->isDisaggContextTransmissionState() && !llmReq->isChild()
+                && llmReq->getChildRequests().empty())
+            {
+                // Finished requests are no longer touched by the forward path, so their final
+                // response can be materialized off the worker loop. Streaming responses of this
+                // request were appended in earlier iterations, keeping per-request ordering intact.
+                deferredRequests.push_back(llmReq);
+            }
+            else
             {
-                newResponses.emplace_back(std::move(response.value()));
+                auto response = llmReq->createResponse(mModel->hasSpeculativeDecodingFastLogits(), mWorldRank);
+                if (response)
+                {
+                    newResponses.emplace_back(std::move(response.value()));
+                }
             }
         }
         // Remove from active requests if last response has been generated
@@ -2251,6 +2539,32 @@ Executor::Impl::RequestList Executor::Impl::populateNewResponses(
             ++it;
         }
     }
+    if (!deferredRequests.empty())
+    {
+        mPendingResponseTasks.emplace_back(mResponsePool->execute(
+            [this, requests = std::move(deferredRequests)]()
+            {
+                std::vector<Response> responses;
+                for (auto const& llmReq : requests)
+                {
+                    auto response = llmReq->createResponse(mModel->hasSpeculativeDecodingFastLogits(), mWorldRank);
+                    if (response)
+                    {
+                        responses.emplace_back(std::move(response.value()));
+                    }
+                }
+                if (!responses.empty())
+                {
+                    enqueueNewResponses(std::move(responses));
+                }
+            }));
+        // Prune tasks that already completed to keep the deque bounded.
+        while (!mPendingResponseTasks.empty()
+            && mPendingResponseTasks.front().wait_for(std::chrono::seconds::zero()) == std::future_status::ready)
+        {
+            mPendingResponseTasks.pop_front();
+        }
+    }
     return finishedRequests;
 }
 
@@ -2261,6 +2575,22 @@ void Executor::Impl::executionLoop()
 
     auto const& worldConfig = mModel->getWorldConfig();
     TLLM_CUDA_CHECK(cudaSetDevice(worldConfig.getDevice()));
+    if (tensorrt_llm::common::getEnvNumaAwareExecutor())
+    {
+        // Keep the worker loop (and the stream callbacks issued from it) on the CPU cores of this
+        // GPU's NUMA node so host staging buffers stay socket-local.
+        runtime::TopologyDetector::getInstance().bindThreadByCurrentGpu();
+    }
+
+    if (auto const numResponseThreads = tensorrt_llm::common::getEnvResponsePoolThreads();
+        numResponseThreads > 0 && mIsLeader && mRequestStatsMaxIterations == 0)
+    {
+        // Materialize final responses on a small pool so bursts of simultaneous finishes do not
+        // delay the next forward step. Disabled with per-request stats, which read finished
+        // requests from this thread after the responses are handed over.
+        TLLM_LOG_INFO("Materializing final responses on %d worker threads", numResponseThreads);
+        mResponsePool = std::make_unique<batch_manager::utils::StaticThreadPool>(numResponseThreads);
+    }
 
     auto const [profileIterIdxs, stopIterIdxs] = tensorrt_llm::common::populateIterationIndexes(
         kPROFILE_START_STOP_ENV_VAR_NAME, kLEGACY_PROFILE_START_STOP_ENV_VAR_NAME);
@@ -2309,6 +2639,22 @@ void Executor::Impl::executionLoop()
             }
             iterEnd = std::chrono::steady_clock::now();
             iterLatencyMS = std::chrono::duration<double, std::milli>(iterEnd - iterStart).count();
+
+            // Keep a smoothed iteration latency for deadline-aware admission: a request admitted
+            // now cannot produce its first token sooner than roughly one iteration from here.
+            auto const prevLatencyEwmaMs = mIterLatencyEwmaMs.load(std::memory_order_relaxed);
+            mIterLatencyEwmaMs.store(prevLatencyEwmaMs == 0.0 ? iterLatencyMS
+                                                              : 0.9 * prevLatencyEwmaMs + 0.1 * iterLatencyMS,
+                std::memory_order_relaxed);
+
+            // Feed the measured iteration latency back to the dynamic batch tuner so the
+            // batch/token budgets follow actual throughput rather than token statistics alone.
+            if (mDynamicBatchTuner)
+            {
+                auto const numServedRequests
+                    = static_cast<SizeType32>(activeRequests.size() + finishedRequests.size());
+                mDynamicBatchTuner->recordIterationLatency(iterLatencyMS, numServedRequests);
+            }
         }
 
         if (!inTransmissionRequests.empty())
@@ -2375,6 +2721,14 @@ void Executor::Impl::executionLoop()
         }
     }
 
+    // Drain outstanding response materialization tasks before tearing down communication.
+    for (auto& task : mPendingResponseTasks)
+    {
+        task.wait();
+    }
+    mPendingResponseTasks.clear();
+    mResponsePool.reset(nullptr);
+
     if (mCancelledRequestsWaitThread)
     {
         mCancelledRequestsWaitThread.reset(nullptr);
@@ -2558,6 +2912,7 @@ void Executor::Impl::leaderRecvReqThread()
                         continue;
                     }
                 }
+                mNumQueuedRequests += static_cast<SizeType32>(requestWithIds.size());
                 for (auto&& req : requestWithIds)
                 {
                     req.queuedStart = std::chrono::steady_clock::now();
@@ -2592,6 +2947,37 @@ void Executor::Impl::leaderSendThread(MpiMessageQueue& sendQueue, mpi::MpiTag id
     TLLM_CUDA_CHECK(cudaSetDevice(mDeviceId));
 
 #if ENABLE_MULTI_DEVICE
+    // Shared-memory channel handshake: the orchestrator reports its hostname (empty when disabled). When it
+    // matches ours and the ring can be created, bulk payloads bypass the MPI data messages; the reply carries
+    // the ring name, or stays empty to keep everything on MPI.
+    std::unique_ptr<ShmRingChannel> shmChannel;
+    {
+        MPI_Message msg = nullptr;
+        MPI_Status status;
+        mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorShmChannel, &msg, &status);
+        int32_t count = 0;
+        MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count));                        // NOLINT
+        std::string orchHostname(count, '\0');
+        MPICHECK(MPI_Mrecv(orchHostname.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+
+        std::string shmName;
+        if (!orchHostname.empty() && orchHostname == ShmRingChannel::localHostname())
+        {
+            shmName = ShmRingChannel::uniqueName(this);
+            shmChannel = ShmRingChannel::create(shmName);
+            if (!shmChannel)
+            {
+                shmName.clear();
+            }
+        }
+        mOrchLeaderComm->send(
+            shmName.data(), shmName.size(), mpi::MpiType::kCHAR, mOrchRank, mpi::MpiTag::kOrchestratorShmChannel);
+        if (shmChannel)
+        {
+            TLLM_LOG_INFO("Leader sendThread using shared-memory channel %s", shmName.c_str());
+        }
+    }
+
     while (true)
     {
         auto message = sendQueue.pop();
@@ -2625,7 +3011,19 @@ void Executor::Impl::leaderSendThread(MpiMessageQueue& sendQueue, mpi::MpiTag id
                 buffer = Serialization::serialize(requestIterStatsData.requestStatsPerIterationVec);
             }
             mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mOrchRank, idTag);
-            mOrchLeaderComm->send(buffer.data(), buffer.size(), mpi::MpiType::kCHAR, mOrchRank, dataTag);
+            if (shmChannel && buffer.size() <= shmChannel->maxRecordSize())
+            {
+                shmChannel->write(buffer.data(), buffer.size());
+            }
+            else
+            {
+                // Oversized payloads keep their slot in the ring so record order matches message order.
+                if (shmChannel)
+                {
+                    shmChannel->writeMpiFallbackMarker();
+                }
+                mOrchLeaderComm->send(buffer.data(), buffer.size(), mpi::MpiType::kCHAR, mOrchRank, dataTag);
+            }
         }
         else
         {
@@ -2640,6 +3038,30 @@ void Executor::Impl::orchRecvThread(mpi::MpiTag idTag, mpi::MpiTag dataTag)
     tensorrt_llm::common::setThreadName("orchRecv");
 
 #if ENABLE_MULTI_DEVICE
+    namespace su = tensorrt_llm::executor::serialize_utils;
+
+    // Offer a same-host shared-memory channel for the bulk payloads; the leader replies with the ring name
+    // when it can service it, and with an empty name to stay on plain MPI.
+    std::unique_ptr<ShmRingChannel> shmChannel;
+    {
+        auto const hostname
+            = tensorrt_llm::common::getEnvDisableOrchShmChannel() ? std::string{} : ShmRingChannel::localHostname();
+        mOrchLeaderComm->send(
+            hostname.data(), hostname.size(), mpi::MpiType::kCHAR, mLeaderRank, mpi::MpiTag::kOrchestratorShmChannel);
+
+        MPI_Message msg = nullptr;
+        MPI_Status status;
+        mOrchLeaderComm->mprobe(mLeaderRank, mpi::MpiTag::kOrchestratorShmChannel, &msg, &status);
+        int32_t count = 0;
+        MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count));                   // NOLINT
+        std::string shmName(count, '\0');
+        MPICHECK(MPI_Mrecv(shmName.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+        if (!shmName.empty())
+        {
+            shmChannel = ShmRingChannel::open(shmName);
+        }
+    }
+
     while (true)
     {
         if (mRecvPollPeriodMs > 0)
@@ -2665,25 +3087,45 @@ void Executor::Impl::orchRecvThread(mpi::MpiTag idTag, mpi::MpiTag dataTag)
         }
         if (mpiId == MpiId::RESPONSE || mpiId == MpiId::ITER_STATS || mpiId == MpiId::REQUEST_ITER_STATS)
         {
-            mOrchLeaderComm->mprobe(mLeaderRank, dataTag, &msg, &status);
-            MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count)); // NOLINT
+            // Prefer the zero-copy view into the shared-memory ring; fall back to the MPI data message
+            // when no channel was negotiated or the payload was too large for the ring.
+            char const* data = nullptr;
+            uint64_t dataSize = 0;
+            std::vector<char> buffer;
+            if (shmChannel)
+            {
+                std::tie(data, dataSize) = shmChannel->read();
+            }
+            if (data == nullptr)
+            {
+                mOrchLeaderComm->mprobe(mLeaderRank, dataTag, &msg, &status);
+                MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count)); // NOLINT
 
-            std::vector<char> buffer(count);
-            MPICHECK(MPI_Mrecv(buffer.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+                buffer.resize(count);
+                MPICHECK(MPI_Mrecv(buffer.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+                data = buffer.data();
+                dataSize = buffer.size();
+            }
 
+            su::VectorWrapBuf<char> strbuf(const_cast<char*>(data), dataSize);
+            std::istream is(&strbuf);
             if (mpiId == MpiId::RESPONSE)
             {
-                auto newResponses = Serialization::deserializeResponses(buffer);
+                auto newResponses = Serialization::deserializeResponses(is);
                 TLLM_LOG_DEBUG("Orchestrator recv thread receiving %d responses", newResponses.size());
                 appendNewResponses(std::move(newResponses));
             }
             else if (mpiId == MpiId::ITER_STATS)
             {
-                appendMultipleIterStats(Serialization::deserializeIterationStatsVec(buffer));
+                appendMultipleIterStats(Serialization::deserializeIterationStatsVec(is));
             }
             else if (mpiId == MpiId::REQUEST_ITER_STATS)
             {
-                appendMultipleRequestStats(Serialization::deserializeRequestStatsPerIterationVec(buffer));
+                appendMultipleRequestStats(Serialization::deserializeRequestStatsPerIterationVec(is));
+            }
+            if (shmChannel)
+            {
+                shmChannel->release();
             }
         }
         else
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/batch_manager/utils/staticThreadPool.h"
 #include "tensorrt_llm/common/arrayView.h"
 #include "tensorrt_llm/executor/dynamicBatchTuner.h"
 #include "tensorrt_llm/executor/executor.h"
@@ -127,6 +128,8 @@ public:
 
     void cancelRequest(IdType requestId);
 
+    void warmup(WarmupConfig const& warmupConfig);
+
     void shutdown();
 
     std::deque<IterationStats> getLatestIterationStats();
@@ -210,10 +213,15 @@ private:
 
     void terminateActiveRequests(RequestList& activeRequests, std::string const& err);
 
-    IterationStats getCurrentIterationStats(RequestList const& activeRequests, double iterLatencyMS,
+    void getCurrentIterationStats(IterationStats& stats, RequestList const& activeRequests, double iterLatencyMS,
         SizeType32 numNewActiveRequests, double newActiveRequestsQueueLatencyMS, SizeType32 numCompletedRequests);
 
-    void appendCurrentIterStats(IterationStats&& currentIterStats);
+    /// @brief Claim the next preallocated snapshot slot of the iteration stats ring, evicting the
+    /// oldest pending snapshot when the ring is full. The caller must hold mIterStatsMtx.
+    IterationStats& claimIterStatsSlot();
+    /// @brief Copy all pending snapshots out of the ring and mark them as consumed, leaving the
+    /// slots in place for reuse. The caller must hold mIterStatsMtx.
+    std::deque<IterationStats> drainIterStats();
     void appendMultipleIterStats(std::vector<IterationStats>&& currentIterStatsVec);
     void updateIterationStats(RequestList const& activeRequests, double iterLatencyMS, SizeType32 numNewActiveRequests,
         double newActiveRequestsQueueLatencyMS, SizeType32 numCompletedRequests, bool flushToOrchestrator);
@@ -281,6 +289,12 @@ private:
     // Thread the executes the main loop
     std::thread mExecutionThread;
 
+    // Optional pool materializing final responses off the worker loop (TRTLLM_RESPONSE_POOL_THREADS)
+    std::unique_ptr<batch_manager::utils::StaticThreadPool> mResponsePool;
+
+    // Outstanding response materialization tasks; only touched from the execution loop thread
+    std::deque<std::future<void>> mPendingResponseTasks;
+
     // Atomic that indicates threads should shutdown
     std::atomic<bool> mShutdown;
 
@@ -292,6 +306,15 @@ private:
     std::condition_variable mQueuedReqCv;
     std::deque<RequestWithId> mQueuedRequests;
     std::optional<SizeType32> mMaxQueueSize;
+    // Lock-free admission queue: enqueueRequests pushes here without taking mQueuedReqMtx and the
+    // worker loop drains it into mQueuedRequests.
+    RequestWithIdQueue mAdmittedRequests;
+    // Entries in mAdmittedRequests plus mQueuedRequests, for the queue-size limit and stats.
+    std::atomic<SizeType32> mNumQueuedRequests{0};
+    // Exponential moving average of the execution loop iteration latency, written by the execution
+    // loop and read by deadline-aware admission as a lower bound on the time to first token of a
+    // newly admitted request.
+    std::atomic<double> mIterLatencyEwmaMs{0.0};
 
     // Cancelled requests
     std::mutex mCancelReqMtx;
@@ -303,16 +326,22 @@ private:
     mutable std::mutex mResponsesMtx;
     std::condition_variable mResponsesCv;
 
-    // Since the request IDs are generated sequentially, IntervalSet is preferred over unordered_set for its efficient
-    // memory usage to stores request ID intervals rather than individual request ID numbers.
-    IntervalSet<IdType> mTerminatedReqIds;
+    // Request IDs are usually generated sequentially, but long-running deployments may reuse or interleave them
+    // non-monotonically. CompactIdSet keeps lookups amortized O(1) in either case and folds dense ID ranges into
+    // intervals off the hot path for efficient memory usage.
+    CompactIdSet<IdType> mTerminatedReqIds;
 
     std::unordered_map<IdType, std::vector<IdType>> mChildReqIdsMap;
 
     // Iteration stats
     IterationType mIterStatsMaxIterations;
     std::mutex mIterStatsMtx;
-    std::deque<IterationStats> mIterationStats;
+    // Preallocated ring of iteration stats snapshots. The iteration loop fills slots in place so
+    // that their heap capacity is reused and stats collection stays allocation-free after warmup;
+    // getLatestIterationStats copies the pending slots out under the lock.
+    std::vector<IterationStats> mIterStatsRing;
+    size_t mIterStatsRingHead{0};
+    size_t mIterStatsRingCount{0};
 
     // Request stats
     IterationType mRequestStatsMaxIterations;
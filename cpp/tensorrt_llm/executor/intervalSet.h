@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,6 +19,8 @@
 
 #include "tensorrt_llm/executor/types.h"
 
+#include <unordered_map>
+
 namespace tensorrt_llm::executor
 {
 
@@ -138,4 +140,99 @@ private:
     SizeType32 mNumElements{0};
 };
 
+/// @brief A container to store unique numbers as 64-bit bitmap words keyed by number / 64, in the spirit of a roaring
+/// bitmap. Lookups and insertions are amortized O(1) regardless of insertion order, so the container does not degrade
+/// when numbers arrive non-monotonically and fragment into many intervals. Fully populated words are periodically
+/// folded into an IntervalSet off the hot path, keeping memory proportional to the fragmented remainder.
+template <typename NumType>
+class CompactIdSet
+{
+public:
+    /// @brief Check if the given number is in set.
+    bool contains(NumType num) const
+    {
+        if (mCompacted.contains(num))
+        {
+            return true;
+        }
+        auto iter = mWords.find(num / kWordBits);
+        return iter != mWords.end() && (iter->second >> (num % kWordBits)) & 1ULL;
+    }
+
+    /// @brief Insert a number into set. Do nothing if the number is already in the set.
+    void insert(NumType num)
+    {
+        if (mCompacted.contains(num))
+        {
+            return;
+        }
+        auto& word = mWords[num / kWordBits];
+        auto const mask = 1ULL << (num % kWordBits);
+        if (word & mask)
+        {
+            return;
+        }
+        word |= mask;
+        mNumElements++;
+        if (word == kFullWord && ++mNumFullWords >= kCompactionThreshold)
+        {
+            compact();
+        }
+    }
+
+    /// @brief Clear the set and reset numElements to 0.
+    void clear()
+    {
+        mWords.clear();
+        mCompacted.clear();
+        mNumFullWords = 0;
+        mNumElements = 0;
+    }
+
+    /// @brief Return the size of the set.
+    SizeType32 getNumElements() const
+    {
+        return mNumElements;
+    }
+
+    /// @brief Return the number of bitmap words not yet folded into intervals.
+    size_t getNumBitmapWords() const
+    {
+        return mWords.size();
+    }
+
+private:
+    /// @brief Fold fully populated bitmap words into the compacted interval set.
+    void compact()
+    {
+        for (auto iter = mWords.begin(); iter != mWords.end();)
+        {
+            if (iter->second == kFullWord)
+            {
+                auto const base = iter->first * kWordBits;
+                for (NumType num = base; num < base + kWordBits; num++)
+                {
+                    mCompacted.insert(num);
+                }
+                iter = mWords.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        mNumFullWords = 0;
+    }
+
+    static constexpr NumType kWordBits = 64;
+    static constexpr uint64_t kFullWord = ~0ULL;
+    /// Compact once 64 words (4096 numbers) are ready to be folded, amortizing the cost over insertions.
+    static constexpr SizeType32 kCompactionThreshold = 64;
+
+    std::unordered_map<NumType, uint64_t> mWords;
+    IntervalSet<NumType> mCompacted;
+    SizeType32 mNumFullWords{0};
+    SizeType32 mNumElements{0};
+};
+
 } // namespace tensorrt_llm::executor
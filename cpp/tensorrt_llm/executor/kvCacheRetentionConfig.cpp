@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -45,13 +45,20 @@ bool KvCacheRetentionConfig::TokenRangeRetentionConfig::operator==(TokenRangeRet
 KvCacheRetentionConfig::KvCacheRetentionConfig(
     std::vector<KvCacheRetentionConfig::TokenRangeRetentionConfig> const& tokenRangeRetentionPriorities,
     RetentionPriority decodeRetentionPriority, std::optional<std::chrono::milliseconds> decodeDurationMs,
-    KvCacheTransferMode transferMode, std::string const& directory)
+    KvCacheTransferMode transferMode, std::string const& directory, std::optional<IdType> sessionId,
+    SizeType32 sessionReservedBlocks, std::optional<std::chrono::milliseconds> sessionTtlMs)
     : mTokenRangeRetentionConfigs(std::vector<TokenRangeRetentionConfig>(tokenRangeRetentionPriorities))
     , mDecodeRetentionPriority{decodeRetentionPriority}
     , mDecodeDurationMs{decodeDurationMs}
     , mTransferMode{transferMode}
     , mDirectory{directory}
+    , mSessionId{sessionId}
+    , mSessionReservedBlocks{sessionReservedBlocks}
+    , mSessionTtlMs{sessionTtlMs}
 {
+    TLLM_CHECK_WITH_INFO(mSessionReservedBlocks >= 0, "The session block budget must be non-negative.");
+    TLLM_CHECK_WITH_INFO(mSessionId.has_value() || (mSessionReservedBlocks == 0 && !mSessionTtlMs.has_value()),
+        "A session block budget or TTL requires a session id.");
 
     // The token ranges must be non-overlapping
     // No end token indicates that the range extends to the end of the sequence
@@ -122,6 +129,21 @@ std::string const& KvCacheRetentionConfig::getDirectory() const
     return mDirectory;
 }
 
+std::optional<IdType> KvCacheRetentionConfig::getSessionId() const
+{
+    return mSessionId;
+}
+
+SizeType32 KvCacheRetentionConfig::getSessionReservedBlocks() const
+{
+    return mSessionReservedBlocks;
+}
+
+std::optional<std::chrono::milliseconds> KvCacheRetentionConfig::getSessionTtlMs() const
+{
+    return mSessionTtlMs;
+}
+
 std::vector<RetentionPriorityAndDuration> KvCacheRetentionConfig::getPerBlockRetentionPriorityDuration(
     SizeType32 blockSize, SizeType32 seqLen) const
 {
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/executor/executor.h"
 
 namespace tensorrt_llm::executor
@@ -22,7 +23,8 @@ namespace tensorrt_llm::executor
 
 OutputConfig::OutputConfig(bool inReturnLogProbs, bool inReturnContextLogits, bool inReturnGenerationLogits,
     bool inExcludeInputFromOutput, bool inReturnEncoderOutput, bool inReturnPerfMetrics,
-    std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs)
+    std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs, SizeType32 inNumTopLogprobs,
+    bool inReturnPromptLogprobs)
     : returnLogProbs(inReturnLogProbs)
     , returnContextLogits(inReturnContextLogits)
     , returnGenerationLogits(inReturnGenerationLogits)
@@ -30,7 +32,10 @@ OutputConfig::OutputConfig(bool inReturnLogProbs, bool inReturnContextLogits, bo
     , returnEncoderOutput(inReturnEncoderOutput)
     , returnPerfMetrics(inReturnPerfMetrics)
     , additionalModelOutputs(std::move(additionalModelOutputs))
+    , numTopLogprobs(inNumTopLogprobs)
+    , returnPromptLogprobs(inReturnPromptLogprobs)
 {
+    TLLM_CHECK_WITH_INFO(numTopLogprobs >= 0, "numTopLogprobs must be non-negative");
 }
 
 AdditionalModelOutput::AdditionalModelOutput(std::string name, bool gatherContext)
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -26,18 +26,24 @@ namespace tensorrt_llm::executor
 {
 ParallelConfig::ParallelConfig(CommunicationType commType, CommunicationMode commMode,
     std::optional<std::vector<SizeType32>> deviceIds, std::optional<std::vector<SizeType32>> participantIds,
-    std::optional<OrchestratorConfig> const& orchestratorConfig, std::optional<SizeType32> numNodes)
+    std::optional<OrchestratorConfig> const& orchestratorConfig, std::optional<SizeType32> numNodes,
+    std::optional<SizeType32> contextParallelism)
     : mCommType(commType)
     , mCommMode(commMode)
     , mDeviceIds(std::move(deviceIds))
     , mParticipantIds(std::move(participantIds))
     , mOrchestratorConfig(orchestratorConfig)
     , mNumNodes(numNodes)
+    , mContextParallelism(contextParallelism)
 {
     if (mDeviceIds)
     {
         TLLM_CHECK(!mDeviceIds.value().empty());
     }
+    if (mContextParallelism)
+    {
+        TLLM_CHECK(mContextParallelism.value() > 0);
+    }
 }
 
 CommunicationType ParallelConfig::getCommunicationType() const
@@ -70,6 +76,11 @@ std::optional<SizeType32> ParallelConfig::getNumNodes() const
     return mNumNodes;
 }
 
+std::optional<SizeType32> ParallelConfig::getContextParallelism() const
+{
+    return mContextParallelism;
+}
+
 void ParallelConfig::setCommunicationType(CommunicationType type)
 {
     mCommType = type;
@@ -101,4 +112,10 @@ void ParallelConfig::setNumNodes(SizeType32 numNodes)
     mNumNodes = numNodes;
 }
 
+void ParallelConfig::setContextParallelism(SizeType32 contextParallelism)
+{
+    TLLM_CHECK(contextParallelism > 0);
+    mContextParallelism = contextParallelism;
+}
+
 } // namespace tensorrt_llm::executor
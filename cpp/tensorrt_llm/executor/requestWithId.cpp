@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,27 +16,110 @@
  */
 
 #include "requestWithId.h"
+#include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/executor/serializeUtils.h"
+#include "tensorrt_llm/executor/tokenSpanPool.h"
 
+#include <algorithm>
+#include <cstring>
 #include <istream>
+#include <optional>
 #include <ostream>
 #include <sstream>
+#include <unordered_map>
 
 using namespace tensorrt_llm::executor;
 namespace su = tensorrt_llm::executor::serialize_utils;
 
+namespace
+{
+// Input token spans are deduplicated at this granularity within one serialized batch: a chunk whose
+// content already appeared earlier in the batch is shipped as a back-reference, so a multi-KB prompt
+// prefix shared by many admitted requests crosses the wire once.
+constexpr size_t kSpanChunkTokens = 256;
+
+struct ChunkRef
+{
+    bool isRef;
+    uint32_t refIndex;
+    TokenIdType const* tokens;
+    uint32_t numTokens;
+};
+} // namespace
+
 std::vector<char> tensorrt_llm::executor::RequestWithId::serializeReqWithIds(
     std::vector<RequestWithId> const& reqWithIds)
 {
-    // Compute the size of serialized buffer
-    size_t totalSize = 0;
-    totalSize += sizeof(size_t);
-    for (auto const& reqWithId : reqWithIds)
+    auto const numReq = reqWithIds.size();
+
+    // Serialize each request into a scratch buffer. The request stream starts with the input token
+    // ids ([count][ids]), which are split off below and deduplicated chunk-wise across the batch.
+    std::vector<std::vector<char>> reqBuffers(numReq);
+    std::vector<std::vector<ChunkRef>> reqChunks(numReq);
+    std::vector<uint64_t> reqNumTokens(numReq);
+    std::vector<size_t> reqRestOffsets(numReq);
+
+    std::vector<std::pair<TokenIdType const*, uint32_t>> chunkTable;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> chunkIndexByHash;
+
+    size_t totalSize = sizeof(size_t);
+    for (size_t i = 0; i < numReq; ++i)
     {
+        auto const& reqWithId = reqWithIds[i];
+        auto& reqBuffer = reqBuffers[i];
+        reqBuffer.resize(su::serializedSize(reqWithId.req));
+        std::stringbuf reqStrbuf{std::ios_base::out | std::ios_base::in};
+        reqStrbuf.pubsetbuf(reqBuffer.data(), static_cast<std::streamsize>(reqBuffer.size()));
+        std::ostream reqOstream{&reqStrbuf};
+        su::serialize(reqWithId.req, reqOstream);
+
+        static_assert(sizeof(size_t) == sizeof(uint64_t));
+        uint64_t numTokens = 0;
+        std::memcpy(&numTokens, reqBuffer.data(), sizeof(numTokens));
+        auto const* tokens = reinterpret_cast<TokenIdType const*>(reqBuffer.data() + sizeof(numTokens));
+        reqNumTokens[i] = numTokens;
+        reqRestOffsets[i] = sizeof(numTokens) + numTokens * sizeof(TokenIdType);
+
         totalSize += su::serializedSize(reqWithId.id);
-        totalSize += su::serializedSize(reqWithId.req);
         totalSize += su::serializedSize(reqWithId.childReqIds);
         totalSize += su::serializedSize(static_cast<uint64_t>(reqWithId.queuedStart.time_since_epoch().count()));
+        totalSize += sizeof(uint64_t); // token count
+        totalSize += sizeof(uint32_t); // chunk count
+
+        for (uint64_t tokenBegin = 0; tokenBegin < numTokens; tokenBegin += kSpanChunkTokens)
+        {
+            auto const chunkTokens
+                = static_cast<uint32_t>(std::min<uint64_t>(kSpanChunkTokens, numTokens - tokenBegin));
+            auto const* chunk = tokens + tokenBegin;
+            auto const hash = TokenSpanPool::hashSpan(chunk, chunkTokens);
+
+            std::optional<uint32_t> match;
+            for (auto const candidate : chunkIndexByHash[hash])
+            {
+                auto const& [candTokens, candNumTokens] = chunkTable[candidate];
+                if (candNumTokens == chunkTokens
+                    && std::memcmp(candTokens, chunk, chunkTokens * sizeof(TokenIdType)) == 0)
+                {
+                    match = candidate;
+                    break;
+                }
+            }
+            if (match)
+            {
+                reqChunks[i].push_back({true, *match, nullptr, chunkTokens});
+                totalSize += sizeof(bool) + sizeof(uint32_t);
+            }
+            else
+            {
+                auto const newIndex = static_cast<uint32_t>(chunkTable.size());
+                chunkTable.emplace_back(chunk, chunkTokens);
+                chunkIndexByHash[hash].push_back(newIndex);
+                reqChunks[i].push_back({false, newIndex, chunk, chunkTokens});
+                totalSize += sizeof(bool) + sizeof(uint32_t) + chunkTokens * sizeof(TokenIdType);
+            }
+        }
+        totalSize += sizeof(uint64_t); // size of the remainder of the request stream
+        totalSize += reqBuffer.size() - reqRestOffsets[i];
     }
 
     std::vector<char> buffer(totalSize);
@@ -44,13 +127,32 @@ std::vector<char> tensorrt_llm::executor::RequestWithId::serializeReqWithIds(
     strbuf.pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     std::ostream ostream{&strbuf};
 
-    su::serialize(reqWithIds.size(), ostream);
-    for (auto const& reqWithId : reqWithIds)
+    su::serialize(numReq, ostream);
+    for (size_t i = 0; i < numReq; ++i)
     {
+        auto const& reqWithId = reqWithIds[i];
         su::serialize(reqWithId.id, ostream);
-        su::serialize(reqWithId.req, ostream);
         su::serialize(reqWithId.childReqIds, ostream);
         su::serialize(static_cast<uint64_t>(reqWithId.queuedStart.time_since_epoch().count()), ostream);
+        su::serialize(reqNumTokens[i], ostream);
+        su::serialize(static_cast<uint32_t>(reqChunks[i].size()), ostream);
+        for (auto const& chunk : reqChunks[i])
+        {
+            su::serialize(chunk.isRef, ostream);
+            if (chunk.isRef)
+            {
+                su::serialize(chunk.refIndex, ostream);
+            }
+            else
+            {
+                su::serialize(chunk.numTokens, ostream);
+                ostream.write(reinterpret_cast<char const*>(chunk.tokens),
+                    static_cast<std::streamsize>(chunk.numTokens * sizeof(TokenIdType)));
+            }
+        }
+        auto const restSize = static_cast<uint64_t>(reqBuffers[i].size() - reqRestOffsets[i]);
+        su::serialize(restSize, ostream);
+        ostream.write(reqBuffers[i].data() + reqRestOffsets[i], static_cast<std::streamsize>(restSize));
     }
     return buffer;
 }
@@ -61,14 +163,125 @@ std::vector<RequestWithId> tensorrt_llm::executor::RequestWithId::deserializeReq
     su::VectorWrapBuf<char> strbuf{buffer};
     std::istream istream{&strbuf};
     auto numReq = su::deserialize<size_t>(istream);
+
+    // Received chunks are interned into the process-wide span pool, so identical chunks arriving in
+    // later batches resolve to the same host allocation for as long as they are referenced.
+    auto& spanPool = TokenSpanPool::getInstance();
+    std::vector<std::shared_ptr<VecTokens const>> chunkTable;
+    std::vector<TokenIdType> chunkScratch;
+
     for (size_t req = 0; req < numReq; ++req)
     {
         auto const id = su::deserialize<IdType>(istream);
-        auto const request = Serialization::deserializeRequest(istream);
         auto const childReqIds = su::deserialize<std::vector<IdType>>(istream);
         auto const queuedStart = std::chrono::steady_clock::time_point{
             std::chrono::steady_clock::duration{su::deserialize<uint64_t>(istream)}};
-        reqWithIds.emplace_back(RequestWithId{request, id, childReqIds, queuedStart});
+        auto const numTokens = su::deserialize<uint64_t>(istream);
+        auto const numChunks = su::deserialize<uint32_t>(istream);
+
+        // Rebuild the byte stream the Request deserializer expects: [count][ids][rest].
+        std::vector<char> reqBuffer(sizeof(numTokens) + numTokens * sizeof(TokenIdType));
+        std::memcpy(reqBuffer.data(), &numTokens, sizeof(numTokens));
+        size_t tokenOffset = sizeof(numTokens);
+        for (uint32_t chunk = 0; chunk < numChunks; ++chunk)
+        {
+            auto const isRef = su::deserialize<bool>(istream);
+            if (isRef)
+            {
+                auto const refIndex = su::deserialize<uint32_t>(istream);
+                TLLM_CHECK_WITH_INFO(refIndex < chunkTable.size(), "Invalid token chunk back-reference");
+                auto const& span = chunkTable[refIndex];
+                std::memcpy(reqBuffer.data() + tokenOffset, span->data(), span->size() * sizeof(TokenIdType));
+                tokenOffset += span->size() * sizeof(TokenIdType);
+            }
+            else
+            {
+                auto const chunkTokens = su::deserialize<uint32_t>(istream);
+                chunkScratch.resize(chunkTokens);
+                istream.read(reinterpret_cast<char*>(chunkScratch.data()),
+                    static_cast<std::streamsize>(chunkTokens * sizeof(TokenIdType)));
+                chunkTable.push_back(spanPool.intern(chunkScratch.data(), chunkTokens));
+                std::memcpy(reqBuffer.data() + tokenOffset, chunkScratch.data(), chunkTokens * sizeof(TokenIdType));
+                tokenOffset += chunkTokens * sizeof(TokenIdType);
+            }
+        }
+        TLLM_CHECK_WITH_INFO(
+            tokenOffset == reqBuffer.size(), "Token chunks do not add up to the request's token count");
+
+        auto const restSize = su::deserialize<uint64_t>(istream);
+        auto const restOffset = reqBuffer.size();
+        reqBuffer.resize(restOffset + restSize);
+        istream.read(reqBuffer.data() + restOffset, static_cast<std::streamsize>(restSize));
+
+        su::VectorWrapBuf<char> reqStrbuf{reqBuffer};
+        std::istream reqIstream{&reqStrbuf};
+        auto request = Serialization::deserializeRequest(reqIstream);
+        reqWithIds.emplace_back(RequestWithId{std::move(request), id, childReqIds, queuedStart});
+    }
+    return reqWithIds;
+}
+
+tensorrt_llm::executor::RequestWithIdQueue::~RequestWithIdQueue()
+{
+    auto* node = mHead.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr)
+    {
+        auto* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+bool tensorrt_llm::executor::RequestWithIdQueue::pushBatch(std::vector<RequestWithId>&& reqWithIds)
+{
+    if (reqWithIds.empty())
+    {
+        return false;
+    }
+
+    // Chain the batch so that a later reversal of the whole stack restores arrival order:
+    // the first request of the batch ends up deepest in the chain.
+    Node* bottom = nullptr;
+    Node* top = nullptr;
+    for (auto&& reqWithId : reqWithIds)
+    {
+        auto* node = new Node{std::move(reqWithId), top};
+        top = node;
+        if (bottom == nullptr)
+        {
+            bottom = node;
+        }
+    }
+
+    auto* oldHead = mHead.load(std::memory_order_relaxed);
+    do
+    {
+        bottom->next = oldHead;
+    } while (!mHead.compare_exchange_weak(oldHead, top, std::memory_order_release, std::memory_order_relaxed));
+    return oldHead == nullptr;
+}
+
+std::vector<RequestWithId> tensorrt_llm::executor::RequestWithIdQueue::drain()
+{
+    std::vector<RequestWithId> reqWithIds;
+    auto* node = mHead.exchange(nullptr, std::memory_order_acquire);
+
+    // Reverse the chain to restore arrival order.
+    Node* reversed = nullptr;
+    while (node != nullptr)
+    {
+        auto* next = node->next;
+        node->next = reversed;
+        reversed = node;
+        node = next;
+    }
+
+    while (reversed != nullptr)
+    {
+        reqWithIds.emplace_back(std::move(reversed->reqWithId));
+        auto* next = reversed->next;
+        delete reversed;
+        reversed = next;
     }
     return reqWithIds;
 }
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -20,6 +20,7 @@
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/executor/types.h"
 
+#include <atomic>
 #include <vector>
 
 namespace tensorrt_llm::executor
@@ -37,4 +38,43 @@ public:
     static std::vector<RequestWithId> deserializeReqWithIds(std::vector<char>& buffer);
 };
 
+/// @brief Lock-free multi-producer single-consumer admission queue for RequestWithId.
+///
+/// Producers link a whole batch into the queue with a single compare-and-swap, so concurrent
+/// enqueue threads never serialize on a mutex. The single consumer drains everything admitted
+/// so far in arrival order.
+class RequestWithIdQueue
+{
+public:
+    RequestWithIdQueue() = default;
+    ~RequestWithIdQueue();
+
+    RequestWithIdQueue(RequestWithIdQueue const&) = delete;
+    RequestWithIdQueue& operator=(RequestWithIdQueue const&) = delete;
+
+    /// @brief Push a batch of requests with a single compare-and-swap.
+    /// @return True when the queue was empty beforehand, i.e. the consumer may need a wakeup.
+    bool pushBatch(std::vector<RequestWithId>&& reqWithIds);
+
+    [[nodiscard]] bool empty() const
+    {
+        return mHead.load(std::memory_order_acquire) == nullptr;
+    }
+
+    /// @brief Drain all admitted requests in arrival order. Must only be called from the
+    /// consumer thread.
+    std::vector<RequestWithId> drain();
+
+private:
+    struct Node
+    {
+        RequestWithId reqWithId;
+        Node* next;
+    };
+
+    // Treiber stack head: holds the most recently admitted request; drain() reverses the chain
+    // to restore arrival order.
+    std::atomic<Node*> mHead{nullptr};
+};
+
 } // namespace tensorrt_llm::executor
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -78,13 +78,16 @@ RequestPerfMetrics Serialization::deserializeRequestPerfMetrics(std::istream& is
     auto lastIter = su::deserialize<std::optional<IterationType>>(is);
     auto iter = su::deserialize<std::optional<IterationType>>(is);
 
+    auto attributedGpuTimeMs = su::deserialize<FloatType>(is);
+
     RequestPerfMetrics::TimingMetrics timingMetrics{arrivalTime, firstScheduledTime, firstTokenTime, lastTokenTime,
         kvCacheTransferStart, kvCacheTransferEnd, kvCacheSize};
     RequestPerfMetrics::KvCacheMetrics kvCacheMetrics{
         numTotalAllocatedBlocks, numNewAllocatedBlocks, numReusedBlocks, numMissedBlocks, kvCacheHitRate};
     RequestPerfMetrics::SpeculativeDecodingMetrics specDecMetrics{
         acceptanceRate, totalAcceptedDraftTokens, totalDraftTokens};
-    return RequestPerfMetrics{timingMetrics, kvCacheMetrics, specDecMetrics, firstIter, lastIter, iter};
+    return RequestPerfMetrics{
+        timingMetrics, kvCacheMetrics, specDecMetrics, firstIter, lastIter, iter, attributedGpuTimeMs};
 }
 
 void Serialization::serialize(RequestPerfMetrics const& metrics, std::ostream& os)
@@ -111,6 +114,8 @@ void Serialization::serialize(RequestPerfMetrics const& metrics, std::ostream& o
     su::serialize(metrics.firstIter, os);
     su::serialize(metrics.lastIter, os);
     su::serialize(metrics.iter, os);
+
+    su::serialize(metrics.attributedGpuTimeMs, os);
 }
 
 size_t Serialization::serializedSize(RequestPerfMetrics const& metrics)
@@ -140,6 +145,8 @@ size_t Serialization::serializedSize(RequestPerfMetrics const& metrics)
     totalSize += su::serializedSize(metrics.lastIter);
     totalSize += su::serializedSize(metrics.iter);
 
+    totalSize += su::serializedSize(metrics.attributedGpuTimeMs);
+
     return totalSize;
 }
 
@@ -232,8 +239,10 @@ OutputConfig Serialization::deserializeOutputConfig(std::istream& is)
     auto returnEncoderOutput = su::deserialize<bool>(is);
     auto returnPerfMetrics = su::deserialize<bool>(is);
     auto additionalOutputs = su::deserialize<std::optional<std::vector<AdditionalModelOutput>>>(is);
+    auto numTopLogprobs = su::deserialize<SizeType32>(is);
+    auto returnPromptLogprobs = su::deserialize<bool>(is);
     return OutputConfig{returnLogProbs, returnContextLogits, returnGenerationLogits, excludeInputFromOutput,
-        returnEncoderOutput, returnPerfMetrics, additionalOutputs};
+        returnEncoderOutput, returnPerfMetrics, additionalOutputs, numTopLogprobs, returnPromptLogprobs};
 }
 
 void Serialization::serialize(OutputConfig const& config, std::ostream& os)
@@ -245,6 +254,8 @@ void Serialization::serialize(OutputConfig const& config, std::ostream& os)
     su::serialize(config.returnEncoderOutput, os);
     su::serialize(config.returnPerfMetrics, os);
     su::serialize(config.additionalModelOutputs, os);
+    su::serialize(config.numTopLogprobs, os);
+    su::serialize(config.returnPromptLogprobs, os);
 }
 
 size_t Serialization::serializedSize(OutputConfig const& config)
@@ -257,6 +268,8 @@ size_t Serialization::serializedSize(OutputConfig const& config)
     totalSize += su::serializedSize(config.returnEncoderOutput);
     totalSize += su::serializedSize(config.returnPerfMetrics);
     totalSize += su::serializedSize(config.additionalModelOutputs);
+    totalSize += su::serializedSize(config.numTopLogprobs);
+    totalSize += su::serializedSize(config.returnPromptLogprobs);
     return totalSize;
 }
 
@@ -989,6 +1002,8 @@ Result Serialization::deserializeResult(std::istream& is)
     result.outputTokenIds = su::deserialize<BeamTokens>(is);
     result.cumLogProbs = su::deserialize<std::optional<VecLogProbs>>(is);
     result.logProbs = su::deserialize<std::optional<std::vector<VecLogProbs>>>(is);
+    result.topLogprobs = su::deserialize<std::optional<std::vector<std::vector<std::pair<TokenIdType, FloatType>>>>>(is);
+    result.promptLogprobs = su::deserialize<std::optional<VecLogProbs>>(is);
     result.contextLogits = su::deserialize<std::optional<Tensor>>(is);
     result.generationLogits = su::deserialize<std::optional<Tensor>>(is);
     result.specDecFastLogitsInfo = su::deserialize<std::optional<SpeculativeDecodingFastLogitsInfo>>(is);
@@ -1010,6 +1025,8 @@ void Serialization::serialize(Result const& result, std::ostream& os)
     su::serialize(result.outputTokenIds, os);
     su::serialize(result.cumLogProbs, os);
     su::serialize(result.logProbs, os);
+    su::serialize(result.topLogprobs, os);
+    su::serialize(result.promptLogprobs, os);
     su::serialize(result.contextLogits, os);
     su::serialize(result.generationLogits, os);
     su::serialize(result.specDecFastLogitsInfo, os);
@@ -1031,6 +1048,8 @@ size_t Serialization::serializedSize(Result const& result)
     totalSize += su::serializedSize(result.outputTokenIds);
     totalSize += su::serializedSize(result.cumLogProbs);
     totalSize += su::serializedSize(result.logProbs);
+    totalSize += su::serializedSize(result.topLogprobs);
+    totalSize += su::serializedSize(result.promptLogprobs);
     totalSize += su::serializedSize(result.contextLogits);
     totalSize += su::serializedSize(result.specDecFastLogitsInfo);
     totalSize += su::serializedSize(result.generationLogits);
@@ -1077,9 +1096,14 @@ size_t Serialization::serializedSize(Response const& response)
 // Vector of responses
 std::vector<Response> Serialization::deserializeResponses(std::vector<char>& buffer)
 {
-    std::vector<Response> responses;
     su::VectorWrapBuf<char> strbuf(buffer);
     std::istream is(&strbuf);
+    return Serialization::deserializeResponses(is);
+}
+
+std::vector<Response> Serialization::deserializeResponses(std::istream& is)
+{
+    std::vector<Response> responses;
     auto numResponses = su::deserialize<std::size_t>(is);
     for (std::size_t resp = 0; resp < numResponses; ++resp)
     {
@@ -1425,8 +1449,10 @@ ParallelConfig Serialization::deserializeParallelConfig(std::istream& is)
     auto participantids = su::deserialize<std::optional<std::vector<SizeType32>>>(is);
     auto orchestratorConfig = su::deserialize<std::optional<OrchestratorConfig>>(is);
     auto numNodes = su::deserialize<std::optional<SizeType32>>(is);
+    auto contextParallelism = su::deserialize<std::optional<SizeType32>>(is);
 
-    return ParallelConfig{commType, commMode, deviceIds, participantids, orchestratorConfig, numNodes};
+    return ParallelConfig{
+        commType, commMode, deviceIds, participantids, orchestratorConfig, numNodes, contextParallelism};
 }
 
 void Serialization::serialize(ParallelConfig const& parallelConfig, std::ostream& os)
@@ -1437,6 +1463,7 @@ void Serialization::serialize(ParallelConfig const& parallelConfig, std::ostream
     su::serialize(parallelConfig.getParticipantIds(), os);
     su::serialize(parallelConfig.getOrchestratorConfig(), os);
     su::serialize(parallelConfig.getNumNodes(), os);
+    su::serialize(parallelConfig.getContextParallelism(), os);
 }
 
 size_t Serialization::serializedSize(ParallelConfig const& parallelConfig)
@@ -1448,6 +1475,7 @@ size_t Serialization::serializedSize(ParallelConfig const& parallelConfig)
     totalSize += su::serializedSize(parallelConfig.getParticipantIds());
     totalSize += su::serializedSize(parallelConfig.getOrchestratorConfig());
     totalSize += su::serializedSize(parallelConfig.getNumNodes());
+    totalSize += su::serializedSize(parallelConfig.getContextParallelism());
     return totalSize;
 }
 
@@ -1696,9 +1724,12 @@ KvCacheRetentionConfig Serialization::deserializeKvCacheRetentionConfig(std::ist
     auto decodeDurationMs = intToDuration(su::deserialize<std::optional<size_t>>(is));
     auto transferMode = su::deserialize<executor::KvCacheTransferMode>(is);
     auto directory = su::deserialize<std::string>(is);
+    auto sessionId = su::deserialize<std::optional<IdType>>(is);
+    auto sessionReservedBlocks = su::deserialize<SizeType32>(is);
+    auto sessionTtlMs = intToDuration(su::deserialize<std::optional<size_t>>(is));
 
-    return KvCacheRetentionConfig{
-        tokenRangeRetentionPriorities, decodePriority, decodeDurationMs, transferMode, directory};
+    return KvCacheRetentionConfig{tokenRangeRetentionPriorities, decodePriority, decodeDurationMs, transferMode,
+        directory, sessionId, sessionReservedBlocks, sessionTtlMs};
 }
 
 void Serialization::serialize(KvCacheRetentionConfig const& kvCacheRetentionConfig, std::ostream& os)
@@ -1708,6 +1739,9 @@ void Serialization::serialize(KvCacheRetentionConfig const& kvCacheRetentionConf
     su::serialize(durationToInt(kvCacheRetentionConfig.getDecodeDurationMs()), os);
     su::serialize(kvCacheRetentionConfig.getTransferMode(), os);
     su::serialize(kvCacheRetentionConfig.getDirectory(), os);
+    su::serialize(kvCacheRetentionConfig.getSessionId(), os);
+    su::serialize(kvCacheRetentionConfig.getSessionReservedBlocks(), os);
+    su::serialize(durationToInt(kvCacheRetentionConfig.getSessionTtlMs()), os);
 }
 
 size_t Serialization::serializedSize(KvCacheRetentionConfig const& config)
@@ -1718,6 +1752,9 @@ size_t Serialization::serializedSize(KvCacheRetentionConfig const& config)
     totalSize += su::serializedSize(durationToInt(config.getDecodeDurationMs()));
     totalSize += su::serializedSize(config.getTransferMode());
     totalSize += su::serializedSize(config.getDirectory());
+    totalSize += su::serializedSize(config.getSessionId());
+    totalSize += su::serializedSize(config.getSessionReservedBlocks());
+    totalSize += su::serializedSize(durationToInt(config.getSessionTtlMs()));
     return totalSize;
 }
 
@@ -1961,6 +1998,48 @@ size_t Serialization::serializedSize(SpecDecodingStats const& state)
     return totalSize;
 }
 
+// KernelExperimentStats
+KernelExperimentStats Serialization::deserializeKernelExperimentStats(std::istream& is)
+{
+    auto name = su::deserialize<std::string>(is);
+    auto fractionB = su::deserialize<double>(is);
+    auto numSamplesA = su::deserialize<SizeType64>(is);
+    auto numSamplesB = su::deserialize<SizeType64>(is);
+    auto avgLatencyAMS = su::deserialize<double>(is);
+    auto avgLatencyBMS = su::deserialize<double>(is);
+    auto latencyHistogramA = su::deserialize<std::vector<SizeType64>>(is);
+    auto latencyHistogramB = su::deserialize<std::vector<SizeType64>>(is);
+
+    return KernelExperimentStats{std::move(name), fractionB, numSamplesA, numSamplesB, avgLatencyAMS, avgLatencyBMS,
+        std::move(latencyHistogramA), std::move(latencyHistogramB)};
+}
+
+void Serialization::serialize(KernelExperimentStats const& state, std::ostream& os)
+{
+    su::serialize(state.name, os);
+    su::serialize(state.fractionB, os);
+    su::serialize(state.numSamplesA, os);
+    su::serialize(state.numSamplesB, os);
+    su::serialize(state.avgLatencyAMS, os);
+    su::serialize(state.avgLatencyBMS, os);
+    su::serialize(state.latencyHistogramA, os);
+    su::serialize(state.latencyHistogramB, os);
+}
+
+size_t Serialization::serializedSize(KernelExperimentStats const& state)
+{
+    size_t totalSize = 0;
+    totalSize += su::serializedSize(state.name);
+    totalSize += su::serializedSize(state.fractionB);
+    totalSize += su::serializedSize(state.numSamplesA);
+    totalSize += su::serializedSize(state.numSamplesB);
+    totalSize += su::serializedSize(state.avgLatencyAMS);
+    totalSize += su::serializedSize(state.avgLatencyBMS);
+    totalSize += su::serializedSize(state.latencyHistogramA);
+    totalSize += su::serializedSize(state.latencyHistogramB);
+    return totalSize;
+}
+
 // IterationStats
 
 IterationStats Serialization::deserializeIterationStats(std::istream& is)
@@ -1989,12 +2068,13 @@ IterationStats Serialization::deserializeIterationStats(std::istream& is)
     auto staticBatchingStats = su::deserialize<std::optional<StaticBatchingStats>>(is);
     auto inflightBatchingStats = su::deserialize<std::optional<InflightBatchingStats>>(is);
     auto specDecodingStats = su::deserialize<std::optional<SpecDecodingStats>>(is);
+    auto kernelExperimentStats = su::deserialize<std::optional<KernelExperimentStats>>(is);
 
     return IterationStats{timestamp, iter, iterLatencyMS, newActiveRequestsQueueLatencyMS, numNewActiveRequests,
         numActiveRequests, numQueuedRequests, numCompletedRequests, maxNumActiveRequests, maxBatchSizeStatic,
         maxBatchSizeTunerRecommended, maxBatchSizeRuntime, maxNumTokensStatic, maxNumTokensTunerRecommended,
         maxNumTokensRuntime, gpuMemUsage, cpuMemUsage, pinnedMemUsage, kvCacheStats, crossKvCacheStats,
-        staticBatchingStats, inflightBatchingStats, specDecodingStats};
+        staticBatchingStats, inflightBatchingStats, specDecodingStats, kernelExperimentStats};
 }
 
 IterationStats Serialization::deserializeIterationStats(std::vector<char>& buffer)
@@ -2033,6 +2113,7 @@ size_t Serialization::serializedSize(IterationStats const& iterStats)
     totalSize += su::serializedSize(iterStats.staticBatchingStats);
     totalSize += su::serializedSize(iterStats.inflightBatchingStats);
     totalSize += su::serializedSize(iterStats.specDecodingStats);
+    totalSize += su::serializedSize(iterStats.kernelExperimentStats);
 
     return totalSize;
 }
@@ -2062,6 +2143,7 @@ void Serialization::serialize(IterationStats const& iterStats, std::ostream& os)
     su::serialize(iterStats.staticBatchingStats, os);
     su::serialize(iterStats.inflightBatchingStats, os);
     su::serialize(iterStats.specDecodingStats, os);
+    su::serialize(iterStats.kernelExperimentStats, os);
 }
 
 std::vector<char> Serialization::serialize(IterationStats const& iterStats)
@@ -2080,9 +2162,14 @@ std::vector<char> Serialization::serialize(IterationStats const& iterStats)
 
 std::vector<IterationStats> Serialization::deserializeIterationStatsVec(std::vector<char>& buffer)
 {
-    std::vector<IterationStats> iterStatsVec;
     su::VectorWrapBuf<char> strbuf(buffer);
     std::istream is(&strbuf);
+    return Serialization::deserializeIterationStatsVec(is);
+}
+
+std::vector<IterationStats> Serialization::deserializeIterationStatsVec(std::istream& is)
+{
+    std::vector<IterationStats> iterStatsVec;
     auto numIterStats = su::deserialize<std::size_t>(is);
     for (std::size_t iterStats = 0; iterStats < numIterStats; ++iterStats)
     {
@@ -2280,10 +2367,14 @@ std::vector<char> Serialization::serialize(std::vector<RequestStatsPerIteration>
 
 std::vector<RequestStatsPerIteration> Serialization::deserializeRequestStatsPerIterationVec(std::vector<char>& buffer)
 {
-
-    std::vector<RequestStatsPerIteration> iterRequestStatsVec;
     su::VectorWrapBuf<char> strbuf(buffer);
     std::istream is(&strbuf);
+    return Serialization::deserializeRequestStatsPerIterationVec(is);
+}
+
+std::vector<RequestStatsPerIteration> Serialization::deserializeRequestStatsPerIterationVec(std::istream& is)
+{
+    std::vector<RequestStatsPerIteration> iterRequestStatsVec;
     auto numIterStats = su::deserialize<std::size_t>(is);
     for (std::size_t iterStats = 0; iterStats < numIterStats; ++iterStats)
     {
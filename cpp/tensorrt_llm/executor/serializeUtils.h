@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -43,6 +43,24 @@ public:
     {
         std::streambuf::setg(vec.data(), vec.data(), vec.data() + vec.size());
     }
+
+    //! Wrap a raw buffer, e.g. a view into a shared-memory channel, without copying it into a vector.
+    VectorWrapBuf(CharT* data, std::size_t size)
+    {
+        std::streambuf::setg(data, data, data + size);
+    }
+};
+
+//! Streambuf that writes into a caller-owned buffer presized via serializedSize(), so serializing
+//! does not reallocate or copy the payload a second time.
+template <typename CharT, typename TraitsT = std::char_traits<CharT>>
+class VectorOutputBuf : public std::basic_streambuf<CharT, TraitsT>
+{
+public:
+    VectorOutputBuf(CharT* data, std::size_t size)
+    {
+        std::streambuf::setp(data, data + size);
+    }
 };
 
 template <typename T, typename = void>
@@ -0,0 +1,282 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shmRingChannel.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/stringUtils.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace tensorrt_llm::executor
+{
+
+namespace
+{
+constexpr uint64_t kLenSize = sizeof(uint64_t);
+// Skip to the start of the ring; written when a record would straddle the end.
+constexpr uint64_t kWrapMarker = std::numeric_limits<uint64_t>::max();
+// The payload of this record travels over MPI instead of the ring.
+constexpr uint64_t kMpiFallbackMarker = std::numeric_limits<uint64_t>::max() - 1;
+constexpr uint64_t kDataOffset = 128;
+constexpr auto kPollInterval = std::chrono::microseconds(50);
+
+uint64_t roundUpRecord(uint64_t size)
+{
+    return (size + kLenSize - 1) / kLenSize * kLenSize;
+}
+} // namespace
+
+// Producer and consumer each map the segment in their own process, so the cursors must be address-free.
+struct ShmRingChannel::Header
+{
+    alignas(64) std::atomic<uint64_t> head; // bytes produced, monotonically increasing
+    alignas(64) std::atomic<uint64_t> tail; // bytes consumed, monotonically increasing
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Ring cursors must be lock-free to be shared across processes");
+
+ShmRingChannel::ShmRingChannel(std::string name, int fd, void* mapped, uint64_t capacity)
+    : mName(std::move(name))
+    , mFd(fd)
+    , mMapped(mapped)
+    , mCapacity(capacity)
+    , mHeader(static_cast<Header*>(mapped))
+    , mData(static_cast<char*>(mapped) + kDataOffset)
+{
+}
+
+#if !defined(_WIN32)
+
+ShmRingChannel::~ShmRingChannel()
+{
+    if (mMapped != nullptr)
+    {
+        munmap(mMapped, kDataOffset + mCapacity);
+    }
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+}
+
+std::unique_ptr<ShmRingChannel> ShmRingChannel::create(std::string const& name, uint64_t capacity)
+{
+    capacity = roundUpRecord(capacity);
+    int const fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        TLLM_LOG_WARNING("Failed to create shared-memory ring %s: %s", name.c_str(), strerror(errno));
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(kDataOffset + capacity)) != 0)
+    {
+        TLLM_LOG_WARNING("Failed to size shared-memory ring %s: %s", name.c_str(), strerror(errno));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    void* mapped = mmap(nullptr, kDataOffset + capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED)
+    {
+        TLLM_LOG_WARNING("Failed to map shared-memory ring %s: %s", name.c_str(), strerror(errno));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto* header = new (mapped) Header;
+    header->head.store(0);
+    header->tail.store(0);
+    return std::unique_ptr<ShmRingChannel>(new ShmRingChannel(name, fd, mapped, capacity));
+}
+
+std::unique_ptr<ShmRingChannel> ShmRingChannel::open(std::string const& name)
+{
+    int const fd = shm_open(name.c_str(), O_RDWR, 0600);
+    TLLM_CHECK_WITH_INFO(fd >= 0, "Failed to open shared-memory ring %s: %s", name.c_str(), strerror(errno));
+    struct stat st = {};
+    TLLM_CHECK_WITH_INFO(fstat(fd, &st) == 0, "Failed to stat shared-memory ring %s: %s", name.c_str(), strerror(errno));
+    auto const capacity = static_cast<uint64_t>(st.st_size) - kDataOffset;
+    void* mapped = mmap(nullptr, kDataOffset + capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    TLLM_CHECK_WITH_INFO(mapped != MAP_FAILED, "Failed to map shared-memory ring %s: %s", name.c_str(), strerror(errno));
+    // Both sides hold a mapping now; unlink so the segment cannot outlive them.
+    shm_unlink(name.c_str());
+    return std::unique_ptr<ShmRingChannel>(new ShmRingChannel(name, fd, mapped, capacity));
+}
+
+uint64_t ShmRingChannel::maxRecordSize() const
+{
+    return mCapacity / 2;
+}
+
+uint64_t ShmRingChannel::reserve(uint64_t advance)
+{
+    auto head = mHeader->head.load(std::memory_order_relaxed);
+    auto const waitForSpace = [this](uint64_t upTo)
+    {
+        while (upTo - mHeader->tail.load(std::memory_order_acquire) > mCapacity)
+        {
+            std::this_thread::sleep_for(kPollInterval);
+        }
+    };
+    auto const contiguous = mCapacity - head % mCapacity;
+    if (contiguous < advance)
+    {
+        // The record would straddle the end of the ring: publish a wrap marker so the consumer skips ahead,
+        // then restart at offset zero. Cursors stay multiples of the length-word size, so the marker always fits.
+        waitForSpace(head + contiguous);
+        std::memcpy(mData + head % mCapacity, &kWrapMarker, kLenSize);
+        head += contiguous;
+        mHeader->head.store(head, std::memory_order_release);
+    }
+    waitForSpace(head + advance);
+    return head % mCapacity;
+}
+
+void ShmRingChannel::write(char const* data, uint64_t size)
+{
+    TLLM_CHECK_WITH_INFO(
+        size <= maxRecordSize(), "Record of %lu bytes exceeds the shared-memory ring limit", static_cast<unsigned long>(size));
+    auto const advance = kLenSize + roundUpRecord(size);
+    auto const pos = reserve(advance);
+    std::memcpy(mData + pos + kLenSize, data, size);
+    std::memcpy(mData + pos, &size, kLenSize);
+    mHeader->head.store(mHeader->head.load(std::memory_order_relaxed) + advance, std::memory_order_release);
+}
+
+void ShmRingChannel::writeMpiFallbackMarker()
+{
+    auto const pos = reserve(kLenSize);
+    std::memcpy(mData + pos, &kMpiFallbackMarker, kLenSize);
+    mHeader->head.store(mHeader->head.load(std::memory_order_relaxed) + kLenSize, std::memory_order_release);
+}
+
+std::pair<char const*, uint64_t> ShmRingChannel::read()
+{
+    while (true)
+    {
+        auto const tail = mHeader->tail.load(std::memory_order_relaxed);
+        while (mHeader->head.load(std::memory_order_acquire) == tail)
+        {
+            std::this_thread::sleep_for(kPollInterval);
+        }
+        // The producer only publishes whole records, so the record at tail is fully visible here.
+        uint64_t len = 0;
+        std::memcpy(&len, mData + tail % mCapacity, kLenSize);
+        if (len == kWrapMarker)
+        {
+            mHeader->tail.store(tail + (mCapacity - tail % mCapacity), std::memory_order_release);
+            continue;
+        }
+        if (len == kMpiFallbackMarker)
+        {
+            mPendingAdvance = kLenSize;
+            return {nullptr, 0};
+        }
+        mPendingAdvance = kLenSize + roundUpRecord(len);
+        return {mData + tail % mCapacity + kLenSize, len};
+    }
+}
+
+void ShmRingChannel::release()
+{
+    mHeader->tail.store(mHeader->tail.load(std::memory_order_relaxed) + mPendingAdvance, std::memory_order_release);
+    mPendingAdvance = 0;
+}
+
+std::string ShmRingChannel::localHostname()
+{
+    char buf[256] = {};
+    TLLM_CHECK_WITH_INFO(gethostname(buf, sizeof(buf) - 1) == 0, "Failed to query hostname");
+    return std::string{buf};
+}
+
+std::string ShmRingChannel::uniqueName(void const* tag)
+{
+    return tensorrt_llm::common::fmtstr("/trtllm_orch_ring_%d_%p", static_cast<int>(getpid()), tag);
+}
+
+#else // _WIN32
+
+ShmRingChannel::~ShmRingChannel() = default;
+
+std::unique_ptr<ShmRingChannel> ShmRingChannel::create(std::string const& name, uint64_t capacity)
+{
+    return nullptr;
+}
+
+std::unique_ptr<ShmRingChannel> ShmRingChannel::open(std::string const& name)
+{
+    TLLM_THROW("ShmRingChannel is not supported on Windows");
+}
+
+uint64_t ShmRingChannel::maxRecordSize() const
+{
+    return 0;
+}
+
+uint64_t ShmRingChannel::reserve(uint64_t advance)
+{
+    TLLM_THROW("ShmRingChannel is not supported on Windows");
+}
+
+void ShmRingChannel::write(char const* data, uint64_t size)
+{
+    TLLM_THROW("ShmRingChannel is not supported on Windows");
+}
+
+void ShmRingChannel::writeMpiFallbackMarker()
+{
+    TLLM_THROW("ShmRingChannel is not supported on Windows");
+}
+
+std::pair<char const*, uint64_t> ShmRingChannel::read()
+{
+    TLLM_THROW("ShmRingChannel is not supported on Windows");
+}
+
+void ShmRingChannel::release()
+{
+    TLLM_THROW("ShmRingChannel is not supported on Windows");
+}
+
+std::string ShmRingChannel::localHostname()
+{
+    return {};
+}
+
+std::string ShmRingChannel::uniqueName(void const* tag)
+{
+    return {};
+}
+
+#endif // _WIN32
+
+} // namespace tensorrt_llm::executor
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace tensorrt_llm::executor
+{
+
+/// @brief Single-producer single-consumer byte ring over POSIX shared memory.
+///
+/// Used by the orchestrator communication threads to move serialized response/stats payloads between a leader
+/// and an orchestrator running on the same host without the copies of the MPI data messages. Records are
+/// length-prefixed; the consumer gets a zero-copy view into the mapped ring and releases it once deserialized.
+/// The small MPI id message keeps acting as the doorbell, so record order matches message order.
+class ShmRingChannel
+{
+public:
+    static constexpr uint64_t kDefaultCapacity = 64ULL << 20;
+
+    ~ShmRingChannel();
+    ShmRingChannel(ShmRingChannel const&) = delete;
+    ShmRingChannel& operator=(ShmRingChannel const&) = delete;
+
+    /// @brief Create the ring as the producer. Returns nullptr when the segment cannot be set up.
+    static std::unique_ptr<ShmRingChannel> create(std::string const& name, uint64_t capacity = kDefaultCapacity);
+
+    /// @brief Map an existing ring as the consumer and unlink it so the segment cannot leak.
+    static std::unique_ptr<ShmRingChannel> open(std::string const& name);
+
+    /// @brief Producer: append one record, blocking while the ring is full.
+    void write(char const* data, uint64_t size);
+
+    /// @brief Producer: append a marker telling the consumer that this payload travels over MPI instead.
+    void writeMpiFallbackMarker();
+
+    /// @brief Largest payload accepted by write().
+    [[nodiscard]] uint64_t maxRecordSize() const;
+
+    /// @brief Consumer: block until the next record and return a view into the ring, or {nullptr, 0} for an
+    /// MPI-fallback marker. The view stays valid until release().
+    [[nodiscard]] std::pair<char const*, uint64_t> read();
+
+    /// @brief Consumer: release the record returned by the last read().
+    void release();
+
+    /// @brief Hostname used to decide whether producer and consumer share a machine.
+    static std::string localHostname();
+
+    /// @brief Segment name unique to the calling process and the given object.
+    static std::string uniqueName(void const* tag);
+
+private:
+    struct Header;
+
+    ShmRingChannel(std::string name, int fd, void* mapped, uint64_t capacity);
+
+    /// @brief Producer: wait for space for advance bytes, wrapping at the end of the ring; returns the write offset.
+    uint64_t reserve(uint64_t advance);
+
+    std::string mName;
+    int mFd{-1};
+    void* mMapped{nullptr};
+    uint64_t mCapacity{0};
+    Header* mHeader{nullptr};
+    char* mData{nullptr};
+    uint64_t mPendingAdvance{0};
+};
+
+} // namespace tensorrt_llm::executor
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/executor/tokenSpanPool.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace tensorrt_llm::executor
+{
+
+TokenSpanPool& TokenSpanPool::getInstance()
+{
+    static TokenSpanPool instance;
+    return instance;
+}
+
+uint64_t TokenSpanPool::hashSpan(TokenIdType const* tokens, size_t numTokens)
+{
+    constexpr uint64_t kOffsetBasis = 0xcbf29ce484222325ULL;
+    constexpr uint64_t kPrime = 0x100000001b3ULL;
+
+    auto const* bytes = reinterpret_cast<uint8_t const*>(tokens);
+    auto const numBytes = numTokens * sizeof(TokenIdType);
+    uint64_t hash = kOffsetBasis;
+    for (size_t i = 0; i < numBytes; ++i)
+    {
+        hash = (hash ^ bytes[i]) * kPrime;
+    }
+    return hash;
+}
+
+std::shared_ptr<VecTokens const> TokenSpanPool::intern(TokenIdType const* tokens, size_t numTokens)
+{
+    auto const hash = hashSpan(tokens, numTokens);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (++mNumInternsSincePrune >= kPruneInterval)
+    {
+        pruneExpired();
+        mNumInternsSincePrune = 0;
+    }
+
+    auto& bucket = mSpans[hash];
+    for (auto const& weakSpan : bucket)
+    {
+        if (auto span = weakSpan.lock(); span && span->size() == numTokens
+            && std::memcmp(span->data(), tokens, numTokens * sizeof(TokenIdType)) == 0)
+        {
+            return span;
+        }
+    }
+
+    auto span = std::make_shared<VecTokens const>(tokens, tokens + numTokens);
+    bucket.emplace_back(span);
+    return span;
+}
+
+size_t TokenSpanPool::numLiveSpans() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    size_t numLive = 0;
+    for (auto const& [hash, bucket] : mSpans)
+    {
+        numLive += std::count_if(
+            bucket.begin(), bucket.end(), [](std::weak_ptr<VecTokens const> const& span) { return !span.expired(); });
+    }
+    return numLive;
+}
+
+void TokenSpanPool::pruneExpired()
+{
+    for (auto it = mSpans.begin(); it != mSpans.end();)
+    {
+        auto& bucket = it->second;
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(),
+                         [](std::weak_ptr<VecTokens const> const& span) { return span.expired(); }),
+            bucket.end());
+        it = bucket.empty() ? mSpans.erase(it) : std::next(it);
+    }
+}
+
+} // namespace tensorrt_llm::executor
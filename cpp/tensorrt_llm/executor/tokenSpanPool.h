@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/executor/types.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm::executor
+{
+
+/// @brief Content-addressed pool of immutable token spans.
+///
+/// Spans are hash-consed: interning a token sequence whose content matches a live pooled span
+/// returns a reference to the existing span instead of a fresh allocation, so workloads where
+/// thousands of requests carry the same multi-KB prompt prefix hold it in host memory once.
+/// The pool keeps only weak references; a span is freed when its last user releases it.
+class TokenSpanPool
+{
+public:
+    static TokenSpanPool& getInstance();
+
+    TokenSpanPool(TokenSpanPool const&) = delete;
+    TokenSpanPool& operator=(TokenSpanPool const&) = delete;
+
+    /// @brief FNV-1a 64-bit hash over the raw token ids.
+    static uint64_t hashSpan(TokenIdType const* tokens, size_t numTokens);
+
+    /// @brief Return an immutable shared span with the given content, reusing a live pooled span
+    /// with identical content when one exists.
+    std::shared_ptr<VecTokens const> intern(TokenIdType const* tokens, size_t numTokens);
+
+    /// @brief Number of pooled spans that are still referenced. Intended for tests and stats.
+    [[nodiscard]] size_t numLiveSpans() const;
+
+private:
+    TokenSpanPool() = default;
+
+    /// @brief Drop registry entries whose spans have been released. Caller must hold mMutex.
+    void pruneExpired();
+
+    /// @brief Expired entries are pruned once per this many interns, amortizing the sweep.
+    static constexpr size_t kPruneInterval = 1024;
+
+    mutable std::mutex mMutex;
+    /// @brief Hash -> live spans with that hash; more than one entry only on hash collision.
+    std::unordered_map<uint64_t, std::vector<std::weak_ptr<VecTokens const>>> mSpans;
+    size_t mNumInternsSincePrune{0};
+};
+
+} // namespace tensorrt_llm::executor
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/executor/executor.h"
+
+namespace tensorrt_llm::executor
+{
+
+WarmupConfig::WarmupConfig(
+    std::vector<Bucket> buckets, TokenIdType warmupTokenId, std::optional<std::chrono::milliseconds> timeout)
+    : mBuckets(std::move(buckets))
+    , mWarmupTokenId(warmupTokenId)
+    , mTimeout(timeout)
+{
+    TLLM_CHECK_WITH_INFO(!mBuckets.empty(), "Warmup requires at least one shape bucket");
+    for (auto const& bucket : mBuckets)
+    {
+        TLLM_CHECK_WITH_INFO(bucket.inputLen > 0 && bucket.outputLen > 0 && bucket.batchSize > 0,
+            "Warmup bucket dimensions must be positive, got (%d, %d, %d)", bucket.inputLen, bucket.outputLen,
+            bucket.batchSize);
+    }
+}
+
+std::vector<WarmupConfig::Bucket> const& WarmupConfig::getBuckets() const
+{
+    return mBuckets;
+}
+
+TokenIdType WarmupConfig::getWarmupTokenId() const
+{
+    return mWarmupTokenId;
+}
+
+std::optional<std::chrono::milliseconds> WarmupConfig::getTimeout() const
+{
+    return mTimeout;
+}
+
+std::vector<WarmupConfig::Bucket> const WarmupConfig::kDefaultBuckets{
+    {128, 8, 1},
+    {512, 8, 8},
+    {1024, 8, 32},
+};
+
+} // namespace tensorrt_llm::executor
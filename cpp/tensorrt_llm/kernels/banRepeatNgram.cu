@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,9 +40,9 @@ __global__ void ban_repeat_ngram(T* logits, TokenIdType const** output_ids_buf,
      * Note 1: no-repeat restriction is per-beam instead of across-beam.
      * Note 2: since beam search results are stored and retrieved by backtracking (parent_ids), the entire sequence for
      * the current can only be obtained by backtracking all the way back.
-     * Note 3: for greedy search, actually a more efficient implementation can be adopted (since we're not constrained
-     * by the beam backtrack retrieval, we can have all threads loading into shared mem in parallel AND use normal order
-     * traversal). But for simplicity and consistency, greedy search and beam search implementation are kept the same.
+     * Note 3: for greedy search we are not constrained by the beam backtrack retrieval, so all threads load their
+     * slice of the history into shared mem in parallel in normal order. Only beam search pays for the serial
+     * single-thread backtrack, which otherwise dominates the kernel for long generations.
      *
      * The overlap between adjacent threads indicates wasted global memory access. Used shared memory instead.
      * Shared memory benefit is more significant as ngram_size increases. Shared memory reuse is for
@@ -77,9 +77,30 @@ __global__ void ban_repeat_ngram(T* logits, TokenIdType const** output_ids_buf,
     auto* last_tokens = &shared_tokens[shared_tokens_length];
     auto const last_tokens_length = no_repeat_ngram_size - 1;
 
+    if (!beam_search)
+    {
+        // Greedy search: the history is laid out contiguously, so every thread stages its part of the
+        // window in parallel instead of having thread 0 replay the whole sequence serially.
+        auto const block_start = static_cast<SizeType32>(blockIdx.x * blockDim.x);
+        for (auto token_idx = static_cast<SizeType32>(threadIdx.x);
+             token_idx < static_cast<SizeType32>(shared_tokens_length);
+             token_idx += static_cast<SizeType32>(blockDim.x))
+        {
+            auto const token_pos = block_start + token_idx;
+            if (token_pos < step)
+            {
+                shared_tokens[token_idx] = output_ids_buf[batch_slot][token_pos];
+            }
+        }
+        for (auto token_idx = static_cast<SizeType32>(threadIdx.x); token_idx < last_tokens_length;
+             token_idx += static_cast<SizeType32>(blockDim.x))
+        {
+            last_tokens[token_idx] = output_ids_buf[batch_slot][step - last_tokens_length + token_idx];
+        }
+    }
     // retrieve the entire beam by backtracking from last token to current token  (in reverse order)
     // single thread vs parallel thread is equivalent as it's bound by the longest iteration
-    if (threadIdx.x == 0)
+    else if (threadIdx.x == 0)
     {
         auto parent_id = beam_idx;
         auto const start_record_idx = min(output_idx + shared_tokens_length, static_cast<SizeType32>(step));
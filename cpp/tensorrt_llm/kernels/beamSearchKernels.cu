@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -99,6 +99,13 @@ __global__ void updateCacheIndirectionKernel(
     int const batchSlot = bh.batchSlots[indexBatch];
     int const tgtIndexBeam = blockIdx.z;
     int const tgtIndexBatchBeam = batchSlot * nBM + tgtIndexBeam;
+
+    // Return early when the target beam is finished, its indirection is frozen
+    if (bh.finished[tgtIndexBatchBeam].isFinished())
+    {
+        return;
+    }
+
     int const lastStep{bh.sequenceLengths[tgtIndexBatchBeam] - 1}; // minus 1 since it is updated in stage 3 kernel
 
     // Return early when at least one of the conditions is true:
@@ -112,11 +119,6 @@ __global__ void updateCacheIndirectionKernel(
 
     // Keep all past tokens by parentIdsPtr
     int const srcIndexBeam = bh.parentIdsPtr[batchSlot][tgtIndexBeam * nMSL + lastStep];
-    // Return early when the source beam isfinished
-    if (bh.finished[tgtIndexBatchBeam].isFinished())
-    {
-        return;
-    }
 
     int const stepCirc = (step >= nSinkTokenLength)
         ? nSinkTokenLength + (step - nSinkTokenLength) % (nMaxAttentionWindow - nSinkTokenLength)
@@ -130,8 +132,11 @@ __global__ void updateCacheIndirectionKernel(
 void invokeUpdateCacheIndirection(int* tgtCI, int const* srcCI, BeamHypotheses& bh,
     runtime::SizeType32 const maxAttentionWindow, runtime::SizeType32 sinkTokenLength, cudaStream_t stream)
 {
-    dim3 const grid(common::roundUp(bh.nMaxSeqLen, 32), bh.nBatchSize, bh.nBeamWidthOut);
-    updateCacheIndirectionKernel<<<grid, 32, 0, stream>>>(tgtCI, srcCI, bh, maxAttentionWindow, sinkTokenLength);
+    // Steps beyond the attention window or before the input part return early, so one thread per step of the
+    // longest possible sequence is enough; batch all beams of all requests into a single launch over grid.y/z.
+    int constexpr nThread{256};
+    dim3 const grid(common::ceilDiv(bh.nMaxSeqLen, nThread), bh.nBatchSize, bh.nBeamWidthOut);
+    updateCacheIndirectionKernel<<<grid, nThread, 0, stream>>>(tgtCI, srcCI, bh, maxAttentionWindow, sinkTokenLength);
     sync_check_cuda_error(stream);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -119,6 +119,49 @@ inline __device__ void copyF4(T_IN* dst, T_IN const* src)
     __pipeline_memcpy_async(dst4, src4, sizeof(float4));
 }
 
+#if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
+// Broadcast a single readiness flag to every rank's copy of the multicast buffer.
+inline __device__ void multimemStFlag(float* mcastPtr, float val)
+{
+    asm volatile("multimem.st.global.f32 [%0], %1;" ::"l"(mcastPtr), "f"(val) : "memory");
+}
+
+// Load one packed vector through the multicast pointer, letting the NVLink switch reduce the
+// copies of all ranks. Accumulation happens in fp32 for the 16-bit types.
+template <typename T>
+inline __device__ float4 multimemLdReduce(void const* mcastPtr)
+{
+    float4 val;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        asm("multimem.ld_reduce.global.add.v4.f32 {%0,%1,%2,%3}, [%4];"
+            : "=f"(val.x), "=f"(val.y), "=f"(val.z), "=f"(val.w)
+            : "l"(mcastPtr)
+            : "memory");
+    }
+    else if constexpr (std::is_same_v<T, __nv_half>)
+    {
+        uint4 raw;
+        asm("multimem.ld_reduce.global.add.v4.f16x2.acc::f32 {%0,%1,%2,%3}, [%4];"
+            : "=r"(raw.x), "=r"(raw.y), "=r"(raw.z), "=r"(raw.w)
+            : "l"(mcastPtr)
+            : "memory");
+        val = *reinterpret_cast<float4*>(&raw);
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, __nv_bfloat16>, "multimemLdReduce not specialized for this type");
+        uint4 raw;
+        asm("multimem.ld_reduce.global.add.v4.bf16x2.acc::f32 {%0,%1,%2,%3}, [%4];"
+            : "=r"(raw.x), "=r"(raw.y), "=r"(raw.z), "=r"(raw.w)
+            : "l"(mcastPtr)
+            : "memory");
+        val = *reinterpret_cast<float4*>(&raw);
+    }
+    return val;
+}
+#endif // __CUDA_ARCH__ >= 900
+
 uint32_t constexpr kWARP_SIZE = 32U;
 uint32_t constexpr kLOG2_WARP_SIZE = 5U;
 uint32_t constexpr kLANE_ID_MASK = 0x1f;
@@ -546,6 +589,243 @@ void oneshotAllreduceFusionOp(AllReduceFusionParams const& params)
     }
 }
 
+// NVLS switch-reduction oneshot: ranks stage their shard in the LOCAL copy of the lamport buffer
+// only and pull the reduced result through multimem.ld_reduce, so the per-rank NVLink traffic is
+// one multicast flag store plus one reduced read instead of a full multicast data store per rank.
+// Because the reduced read cannot carry lamport sentinels, readiness is tracked by per-(token, rank)
+// flags at the head of the stage buffer:
+//   [ ready flags | done flags | shard data ]
+// A rank multicast-stores its ready flag once its shard is visible, and multicast-stores its done
+// flag once it has consumed the token, so a rank only exits (and later clears this buffer) after
+// every peer has finished reading its shard.
+template <uint8_t WorldSize, typename T, bool RMSNormFusion = false, typename PackedType = float4>
+__global__ void __launch_bounds__(1024) oneshotNvlsAllreduceFusionKernel(T* outputPtr, T* prenormedPtr,
+    T const* shardPtr, T const* residualInPtr, T const* gammaPtr, T** inputPtrs, T* mcastPtr, int const numTokens,
+    int const tokenDim, float epsilon, int const rank, uint32_t* bufferFlags)
+{
+    constexpr int kELTS_PER_THREAD = sizeof(PackedType) / sizeof(T);
+    constexpr uint32_t kELT_SIZE = sizeof(T);
+#if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
+    namespace cg = cooperative_groups;
+    cg::cluster_group cluster = cg::this_cluster();
+    int packedIdx = cluster.thread_rank();
+    int token = blockIdx.x;
+    int threadOffset = token * tokenDim + packedIdx * kELTS_PER_THREAD;
+
+    cudaGridDependencySynchronize();
+
+    // We only use 1 stage for the oneshot allreduce
+    LamportFlags<PackedType> flag(bufferFlags, 1);
+    T* stagePtrMcast = reinterpret_cast<T*>(flag.getCurLamportBuf(mcastPtr, 0));
+    T* stagePtrLocal = reinterpret_cast<T*>(flag.getCurLamportBuf(inputPtrs[rank], 0));
+
+    // Flags first so the dirty region is contiguous from the buffer base; data is aligned up to
+    // the packed access size.
+    uint32_t const flagBytes
+        = divUp<uint32_t>(2U * numTokens * WorldSize * sizeof(float), sizeof(PackedType)) * sizeof(PackedType);
+    float* readyFlagsLocal = reinterpret_cast<float*>(stagePtrLocal);
+    float* readyFlagsMcast = reinterpret_cast<float*>(stagePtrMcast);
+    float* doneFlagsLocal = readyFlagsLocal + numTokens * WorldSize;
+    float* doneFlagsMcast = readyFlagsMcast + numTokens * WorldSize;
+    T* dataLocal = reinterpret_cast<T*>(reinterpret_cast<char*>(stagePtrLocal) + flagBytes);
+    T* dataMcast = reinterpret_cast<T*>(reinterpret_cast<char*>(stagePtrMcast) + flagBytes);
+
+    if (packedIdx * kELTS_PER_THREAD >= tokenDim)
+    {
+        flag.clearDirtyLamportBuf(inputPtrs[rank], -1);
+        return;
+    }
+
+    // ==================== Stage the local shard =============================
+    // Plain local stores: negative zeros in genuine data are harmless here since readiness is
+    // tracked by the separate flags, and -0.0 is the identity of the switch reduction.
+    reinterpret_cast<PackedType*>(&dataLocal[threadOffset])[0] = loadPacked<PackedType>(&shardPtr[threadOffset]);
+    __threadfence_system();
+
+    // ctaArrive() syncs the cluster, so the ready flag is ordered after every staging store of
+    // this token.
+    flag.ctaArrive();
+    if (cluster.thread_rank() == 0)
+    {
+        detail::multimemStFlag(&readyFlagsMcast[token * WorldSize + rank], 1.0F);
+    }
+    // ======================= Clear the output buffer from previous iteration =======================
+    flag.clearDirtyLamportBuf(inputPtrs[rank], -1);
+
+    // ======================= Wait for all shards of this token =============================
+    bool ready = false;
+    while (!ready)
+    {
+        ready = true;
+#pragma unroll
+        for (int r = 0; r < WorldSize; r++)
+        {
+            float const readyFlag
+                = *reinterpret_cast<float volatile*>(&readyFlagsLocal[token * WorldSize + r]);
+            ready &= !isNegZero(readyFlag);
+        }
+    }
+
+    // ======================= Switch reduction =============================
+    PackedVec<PackedType, T> packedAccum;
+    packedAccum.packed = detail::multimemLdReduce<T>(&dataMcast[threadOffset]);
+
+    // Signal that this rank is done reading the token so peers may exit and later clear their
+    // staged shard without racing our reduced read.
+    cluster.sync();
+    if (cluster.thread_rank() == 0)
+    {
+        detail::multimemStFlag(&doneFlagsMcast[token * WorldSize + rank], 1.0F);
+    }
+    if constexpr (RMSNormFusion)
+    {
+        // =============================== Residual ===============================
+        PackedVec<PackedType, T> residualIn;
+        residualIn.packed = *reinterpret_cast<PackedType const*>(&residualInPtr[threadOffset]);
+        packedAccum += residualIn;
+        *reinterpret_cast<PackedType*>(&prenormedPtr[threadOffset]) = packedAccum.packed;
+        // =============================== Rmsnorm ================================
+        PackedVec<PackedType, T> gamma;
+        gamma.packed = *reinterpret_cast<PackedType const*>(&gammaPtr[packedIdx * kELTS_PER_THREAD]);
+
+        float threadSum = 0.F;
+#pragma unroll
+        for (int i = 0; i < kELTS_PER_THREAD; i++)
+        {
+            // FIXME: Use float square if accuracy issue
+            threadSum += cuda_cast<float, T>(packedAccum.elements[i] * packedAccum.elements[i]);
+        }
+        float blockSum = blockReduceSum<float, true>(threadSum);
+
+        float fullSum = blockSum;
+        __shared__ float sharedVal[8]; // Temporary variable to share the sum within block
+        int const numBlocks = cluster.num_blocks();
+        if (numBlocks > 1)
+        {
+            fullSum = 0.F;
+            // Need to reduce over the entire cluster
+            int const blockRank = cluster.block_rank();
+            if (threadIdx.x < numBlocks)
+            {
+                cluster.map_shared_rank(&sharedVal[0], threadIdx.x)[blockRank] = blockSum;
+            }
+            cluster.barrier_wait(cluster.barrier_arrive());
+            for (int i = 0; i < numBlocks; ++i)
+            {
+                fullSum += sharedVal[i];
+            }
+        }
+        float rcpRms = rsqrtf(fullSum / tokenDim + epsilon);
+#pragma unroll
+        for (int i = 0; i < kELTS_PER_THREAD; i++)
+        {
+            packedAccum.elements[i] = cuda_cast<T, float>(
+                cuda_cast<float, T>(packedAccum.elements[i]) * rcpRms * cuda_cast<float, T>(gamma.elements[i]));
+        }
+    }
+    reinterpret_cast<PackedType*>(&outputPtr[threadOffset])[0] = packedAccum.packed;
+
+    // ======================= Wait until all peers consumed this token =============================
+    bool done = false;
+    while (!done)
+    {
+        done = true;
+#pragma unroll
+        for (int r = 0; r < WorldSize; r++)
+        {
+            float const doneFlag = *reinterpret_cast<float volatile*>(&doneFlagsLocal[token * WorldSize + r]);
+            done &= !isNegZero(doneFlag);
+        }
+    }
+    cudaTriggerProgrammaticLaunchCompletion();
+    flag.waitAndUpdate({flagBytes + static_cast<uint32_t>(numTokens * tokenDim) * kELT_SIZE, 0, 0, 0});
+#endif
+}
+
+void oneshotNvlsAllreduceFusionOp(AllReduceFusionParams const& params)
+{
+    static int const kSMVersion = tensorrt_llm::common::getSMVersion();
+    int const numTokens = params.numTokens;
+    int const tokenDim = params.tokenDim;
+    int const eltsPerThread = sizeof(float4) / getDTypeSize(params.dType);
+
+    TLLM_CHECK_WITH_INFO(kSMVersion >= 90, "The NVLS oneshot allreduce kernel requires SM90 or newer.");
+
+    auto [blockSize, clusterSize, loadsPerThread] = adjustGridConfig(numTokens, tokenDim, eltsPerThread);
+    dim3 grid(numTokens, clusterSize, 1);
+
+    TLLM_LOG_DEBUG(
+        "[MNNVL AllReduceOneShot NVLS] Dispatch: grid size: (%d, %d, 1), block_size: %d, cluster_size: %d, "
+        "loads_per_thread: %d, "
+        "threads_needed: %d",
+        numTokens, clusterSize, blockSize, clusterSize, loadsPerThread, divUp(tokenDim, eltsPerThread));
+
+    TLLM_CHECK_WITH_INFO(blockSize <= 1024 && loadsPerThread == 1,
+        "Hidden Dimension %d exceeds the maximum supported hidden dimension (%d)", tokenDim, 1024 * 8 * eltsPerThread);
+
+    cudaLaunchAttribute attrs[2];
+    attrs[0].id = cudaLaunchAttributeProgrammaticStreamSerialization;
+    attrs[0].val.programmaticStreamSerializationAllowed = tensorrt_llm::common::getEnvEnablePDL() ? 1 : 0;
+    attrs[1].id = cudaLaunchAttributeClusterDimension;
+    attrs[1].val.clusterDim.x = 1;
+    attrs[1].val.clusterDim.y = clusterSize;
+    attrs[1].val.clusterDim.z = 1;
+
+    cudaLaunchConfig_t config{
+        .gridDim = grid,
+        .blockDim = blockSize,
+        .dynamicSmemBytes = 0,
+        .stream = params.stream,
+        .attrs = attrs,
+        .numAttrs = 2U,
+    };
+
+#define LAUNCH_ALLREDUCE_KERNEL(WORLD_SIZE, T, RMSNORM)                                                                \
+    TLLM_CUDA_CHECK(cudaLaunchKernelEx(&config, &oneshotNvlsAllreduceFusionKernel<WORLD_SIZE, T, RMSNORM>, output,     \
+        residualOut, input, residualIn, gamma, ucPtrs, mcPtr, numTokens, tokenDim, static_cast<float>(params.epsilon), \
+        params.rank, params.bufferFlags));
+#define DISPATCH_ALLREDUCE_KERNEL(WORLD_SIZE, T)                                                                       \
+    if (params.rmsNormFusion)                                                                                          \
+    {                                                                                                                  \
+        LAUNCH_ALLREDUCE_KERNEL(WORLD_SIZE, T, true);                                                                  \
+    }                                                                                                                  \
+    else                                                                                                               \
+    {                                                                                                                  \
+        LAUNCH_ALLREDUCE_KERNEL(WORLD_SIZE, T, false);                                                                 \
+    }
+    auto dispatchImpl = [&](auto* type_ptr) -> bool
+    {
+        using T = std::remove_pointer_t<decltype(type_ptr)>;
+        T** ucPtrs = reinterpret_cast<T**>(params.bufferPtrsDev);
+        T* mcPtr = reinterpret_cast<T*>(params.multicastPtr);
+        T* output = reinterpret_cast<T*>(params.output);
+        T* residualOut = reinterpret_cast<T*>(params.residualOut);
+        T const* input = reinterpret_cast<T const*>(params.input);
+        T const* residualIn = reinterpret_cast<T const*>(params.residualIn);
+        T const* gamma = reinterpret_cast<T const*>(params.gamma);
+
+        switch (params.nRanks)
+        {
+        case 2: DISPATCH_ALLREDUCE_KERNEL(2, T); return true;
+        case 4: DISPATCH_ALLREDUCE_KERNEL(4, T); return true;
+        case 8: DISPATCH_ALLREDUCE_KERNEL(8, T); return true;
+        case 16: DISPATCH_ALLREDUCE_KERNEL(16, T); return true;
+        case 32: DISPATCH_ALLREDUCE_KERNEL(32, T); return true;
+        case 64: DISPATCH_ALLREDUCE_KERNEL(64, T); return true;
+        }
+        return false;
+    };
+#undef LAUNCH_ALLREDUCE_KERNEL
+#undef DISPATCH_ALLREDUCE_KERNEL
+    bool launched = (params.dType == nvinfer1::DataType::kBF16 && dispatchImpl((__nv_bfloat16*) nullptr))
+        || (params.dType == nvinfer1::DataType::kFLOAT && dispatchImpl((float*) nullptr))
+        || (params.dType == nvinfer1::DataType::kHALF && dispatchImpl((__nv_half*) nullptr));
+    if (!launched)
+    {
+        TLLM_CHECK_WITH_INFO(false, "Failed to dispatch MNNVL AllReduceOneShot NVLS kernel.");
+    }
+}
+
 enum MNNVLTwoShotStage : uint8_t
 {
     SCATTER = 0,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -67,6 +67,13 @@ struct AllReduceFusionParams
 };
 
 void oneshotAllreduceFusionOp(AllReduceFusionParams const& params);
+
+//! NVLS switch-reduction variant of the oneshot allreduce: each rank stages its shard in its local
+//! unicast buffer and reads the reduced result through multimem.ld_reduce on the multicast pointer,
+//! so the NVLink switch performs the reduction. Requires SM90+ and a multicast-mapped buffer;
+//! intended for the small-message decode regime where oneshot is selected.
+void oneshotNvlsAllreduceFusionOp(AllReduceFusionParams const& params);
+
 void twoshotAllreduceFusionOp(AllReduceFusionParams const& params);
 } // namespace kernels::mnnvl
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "tensorrt_llm/common/vec_dtypes.cuh"
 #include "tensorrt_llm/kernels/communicationKernels/moeAlltoAllKernels.h"
 #include "tensorrt_llm/kernels/quantization.cuh"
+#include <algorithm>
 #include <cooperative_groups.h>
 #include <cstdint>
 #include <type_traits>
@@ -351,7 +352,7 @@ __device__ void vectorized_dispatch(uint8_t const* src_ptr, int bytes_per_token,
 }
 
 __global__ void moeA2APrepareDispatchKernel(
-    int* send_counters, int* local_token_counter, int ep_size, uint32_t* flag_val_ptr)
+    int* send_counters, int* local_token_counter, int ep_size, uint32_t* flag_val_ptr, int* replica_counter)
 {
 #if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
     cudaGridDependencySynchronize();
@@ -369,6 +370,11 @@ __global__ void moeA2APrepareDispatchKernel(
         *local_token_counter = 0;
         // Increment flag_val for this dispatch round
         *flag_val_ptr = *flag_val_ptr + 1;
+        // Zero the node-local replication queue for hierarchical dispatch
+        if (replica_counter != nullptr)
+        {
+            *replica_counter = 0;
+        }
     }
 }
 
@@ -381,7 +387,7 @@ __global__ void moeA2ADispatchKernel(int32_t const* token_selected_experts, // [
     const DispatchKernelPointers ptrs,                                      // Struct containing all kernel pointers
     int num_payloads,                                                       // Number of payloads
     int max_tokens_per_rank,                                                // Maximum tokens per rank
-    int local_num_tokens, int rank_id, int ep_size, int num_experts, int eplb_stats_num_experts)
+    int local_num_tokens, int rank_id, int ep_size, int num_experts, int eplb_stats_num_experts, int ranks_per_node)
 {
     int thread_idx = ThreadingPolicy::offset();
     int local_token_idx = ThreadingPolicy::token_idx();
@@ -458,6 +464,43 @@ __global__ void moeA2ADispatchKernel(int32_t const* token_selected_experts, // [
             }
             already_copied |= 1ULL << target_rank;
         }
+
+        // Hierarchical dispatch: a token routed to several ranks of the same remote node crosses
+        // the inter-node fabric once. The first target on each remote node stays the "leader" and
+        // receives the payload directly; later targets on that node get a replica descriptor and
+        // their stores are suppressed (shared-memory copy only - the global routing info used by
+        // combine keeps the true target/index). The owning ranks replicate the payload from their
+        // node-local leader over NVLink in moeA2ANodeReplicateKernel.
+        if (ranks_per_node > 1 && thread_idx == 0)
+        {
+            int const my_node = rank_id / ranks_per_node;
+            for (int k = 0; k < TOP_K; k++)
+            {
+                int const leader_rank = smem_topk_target_ranks[k];
+                if (leader_rank < 0 || leader_rank / ranks_per_node == my_node)
+                {
+                    continue;
+                }
+                int const target_node = leader_rank / ranks_per_node;
+                for (int k2 = k + 1; k2 < TOP_K; k2++)
+                {
+                    int const dup_rank = smem_topk_target_ranks[k2];
+                    if (dup_rank < 0 || dup_rank / ranks_per_node != target_node)
+                    {
+                        continue;
+                    }
+                    ReplicaDescriptor desc;
+                    desc.leader_rank = leader_rank;
+                    desc.leader_token_idx = smem_topk_send_indices[k];
+                    desc.dup_token_idx = smem_topk_send_indices[k2];
+                    desc.source_rank = rank_id;
+                    int const slot = atomicAdd(ptrs.replica_counters[dup_rank], 1);
+                    ptrs.replica_descs[dup_rank][slot] = desc;
+                    smem_topk_target_ranks[k2] = -1;
+                    smem_topk_send_indices[k2] = -1;
+                }
+            }
+        }
         // Sync before dispatching data
         ThreadingPolicy::sync();
 
@@ -589,8 +632,10 @@ __global__ void moeA2ADispatchKernel(int32_t const* token_selected_experts, // [
 
 void moe_a2a_prepare_dispatch_launch(MoeA2ADispatchParams const& params)
 {
+    int* replica_counter = params.ranks_per_node > 1 ? params.replica_counters[params.ep_rank] : nullptr;
     launchWithPdlWhenEnabled("moeA2APrepareDispatchKernel", moeA2APrepareDispatchKernel, 1, params.ep_size, 0,
-        params.stream, params.send_counters, params.local_token_counter, params.ep_size, params.flag_val);
+        params.stream, params.send_counters, params.local_token_counter, params.ep_size, params.flag_val,
+        replica_counter);
 }
 
 // ============================================================================
@@ -634,6 +679,13 @@ void moe_a2a_dispatch_launch(MoeA2ADispatchParams const& params)
     }
     kernel_ptrs.flag_val = params.flag_val;
 
+    // Copy node-local replication queue pointers (nullptr when node aggregation is disabled)
+    for (int i = 0; i < params.ep_size; i++)
+    {
+        kernel_ptrs.replica_counters[i] = params.replica_counters[i];
+        kernel_ptrs.replica_descs[i] = params.replica_descs[i];
+    }
+
     // Copy communication tracking pointers
     kernel_ptrs.send_counters = params.send_counters;
     kernel_ptrs.local_token_counter = params.local_token_counter;
@@ -660,7 +712,7 @@ void moe_a2a_dispatch_launch(MoeA2ADispatchParams const& params)
             launchWithPdlWhenEnabled("moeA2ADispatchKernel", kernel_fn, grid_size, kBlockSize, shared_bytes,
                 params.stream, params.token_selected_experts, kernel_ptrs, params.num_payloads,
                 params.max_tokens_per_rank, params.local_num_tokens, params.ep_rank, params.ep_size, params.num_experts,
-                params.eplb_stats_num_experts);
+                params.eplb_stats_num_experts, params.ranks_per_node);
         }))
     }
     else
@@ -677,11 +729,83 @@ void moe_a2a_dispatch_launch(MoeA2ADispatchParams const& params)
             launchWithPdlWhenEnabled("moeA2ADispatchKernel", kernel_fn, grid_size, kBlockSize, shared_bytes,
                 params.stream, params.token_selected_experts, kernel_ptrs, params.num_payloads,
                 params.max_tokens_per_rank, params.local_num_tokens, params.ep_rank, params.ep_size, params.num_experts,
-                params.eplb_stats_num_experts);
+                params.eplb_stats_num_experts, params.ranks_per_node);
         }))
     }
 }
 
+// ============================================================================
+// Node-local replication kernel (hierarchical dispatch epilogue)
+// ============================================================================
+
+// Drain this rank's replication queue: each descriptor names a token payload that the sender
+// stored only into a node-sibling leader's recv buffer. Copy it from the leader into this rank's
+// own recv buffer over node-local NVLink. The dispatch kernel has already waited on all source
+// completion flags, so stream ordering guarantees the leader copies have arrived.
+__global__ void moeA2ANodeReplicateKernel(
+    const DispatchKernelPointers ptrs, int num_payloads, int max_tokens_per_rank, int rank_id)
+{
+#if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
+    cudaGridDependencySynchronize();
+    cudaTriggerProgrammaticLaunchCompletion();
+#endif
+    int const num_descs = *ptrs.replica_counters[rank_id];
+    ReplicaDescriptor const* descs = ptrs.replica_descs[rank_id];
+
+    for (int d = blockIdx.x; d < num_descs; d += gridDim.x)
+    {
+        ReplicaDescriptor const desc = descs[d];
+        for (int payload_idx = 0; payload_idx < num_payloads; payload_idx++)
+        {
+            int const bytes_per_token = ptrs.payload_bytes_per_token[payload_idx];
+            size_t const src_token = static_cast<size_t>(desc.source_rank) * static_cast<size_t>(max_tokens_per_rank)
+                + static_cast<size_t>(desc.leader_token_idx);
+            size_t const dst_token = static_cast<size_t>(desc.source_rank) * static_cast<size_t>(max_tokens_per_rank)
+                + static_cast<size_t>(desc.dup_token_idx);
+            uint8_t const* src = static_cast<uint8_t const*>(ptrs.recv_buffers[desc.leader_rank][payload_idx])
+                + src_token * static_cast<size_t>(bytes_per_token);
+            uint8_t* dst = static_cast<uint8_t*>(ptrs.recv_buffers[rank_id][payload_idx])
+                + dst_token * static_cast<size_t>(bytes_per_token);
+            vectorized_copy<BlockPolicy>(dst, src, bytes_per_token);
+        }
+    }
+}
+
+void moe_a2a_node_replicate_launch(MoeA2ADispatchParams const& params)
+{
+    if (params.ranks_per_node <= 1)
+    {
+        return;
+    }
+    TLLM_CHECK(params.replica_counters[params.ep_rank] != nullptr);
+    TLLM_CHECK(params.replica_descs[params.ep_rank] != nullptr);
+
+    DispatchKernelPointers kernel_ptrs = {};
+    for (int i = 0; i < params.num_payloads; i++)
+    {
+        kernel_ptrs.payload_bytes_per_token[i] = params.payloads[i].element_size * params.payloads[i].elements_per_token;
+    }
+    for (int target_rank = 0; target_rank < params.ep_size; target_rank++)
+    {
+        for (int payload = 0; payload < params.num_payloads; payload++)
+        {
+            kernel_ptrs.recv_buffers[target_rank][payload] = params.recv_buffers[target_rank][payload];
+        }
+    }
+    kernel_ptrs.replica_counters[params.ep_rank] = params.replica_counters[params.ep_rank];
+    kernel_ptrs.replica_descs[params.ep_rank] = params.replica_descs[params.ep_rank];
+
+    // Upper bound on queued descriptors is ep_size * max_tokens_per_rank; surplus blocks exit early.
+    int grid_size = std::min(params.ep_size * params.max_tokens_per_rank, 1024);
+    if (grid_size == 0)
+    {
+        grid_size = 1;
+    }
+    int const kBlockSize = tensorrt_llm::common::getEnvMoeA2ADispatchBlockSize();
+    launchWithPdlWhenEnabled("moeA2ANodeReplicateKernel", moeA2ANodeReplicateKernel, grid_size, kBlockSize, 0,
+        params.stream, kernel_ptrs, params.num_payloads, params.max_tokens_per_rank, params.ep_rank);
+}
+
 // ============================================================================
 // Combine kernels
 // ============================================================================
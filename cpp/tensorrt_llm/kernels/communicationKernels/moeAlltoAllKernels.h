@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,17 @@ static constexpr int kMaxTopK = 22;    // Maximum top-k experts per token
 static constexpr int kMaxPayloads = 4; // Maximum number of different payload types
 static constexpr int kMaxRanks = 64;   // Maximum supported EP size
 
+// One deferred node-local copy produced by hierarchical dispatch: the sender stored the token
+// payload only into leader_rank's recv buffer (once per remote node); the owning rank replicates
+// it into its own recv buffer over node-local NVLink after dispatch completes.
+struct ReplicaDescriptor
+{
+    int leader_rank;      // Node-sibling rank holding the payload bytes
+    int leader_token_idx; // dst token index within [source_rank] slot of leader's recv buffer
+    int dup_token_idx;    // dst token index within [source_rank] slot of this rank's recv buffer
+    int source_rank;      // EP rank that dispatched the token
+};
+
 // Describes a single payload type to be communicated
 struct PayloadDescriptor
 {
@@ -65,6 +76,10 @@ struct DispatchKernelPointers
     // Optional: Statistics for EPLB
     int const* eplb_local_stats;         // [eplb_stats_num_experts]
     int* eplb_gathered_stats[kMaxRanks]; // [ep_size, eplb_stats_num_experts] per rank
+
+    // Optional: node-local replication queues for hierarchical dispatch (nullptr when disabled)
+    int* replica_counters[kMaxRanks];               // Per-rank atomic descriptor count
+    ReplicaDescriptor* replica_descs[kMaxRanks];    // Per-rank descriptor queue [ep_size * max_num_tokens]
 };
 
 // Combine kernel pointers - non-const output in src_data_ptrs[0], const recv buffers
@@ -128,6 +143,11 @@ struct MoeA2ADispatchParams
     int const* eplb_local_stats;         // [eplb_stats_num_experts]
     int* eplb_gathered_stats[kMaxRanks]; // [ep_size, eplb_stats_num_experts] per rank
 
+    // Hierarchical dispatch: ranks per NVLink-local node; <= 1 disables node aggregation
+    int ranks_per_node;
+    int* replica_counters[kMaxRanks];            // Per-rank atomic descriptor count
+    ReplicaDescriptor* replica_descs[kMaxRanks]; // Per-rank descriptor queue [ep_size * max_num_tokens]
+
     // CUDA stream
     cudaStream_t stream;
 };
@@ -136,6 +156,10 @@ struct MoeA2ADispatchParams
 void moe_a2a_dispatch_launch(MoeA2ADispatchParams const& params);
 // Prepare for dispatch: zero send_counters, local_token_counter and increment flag_val
 void moe_a2a_prepare_dispatch_launch(MoeA2ADispatchParams const& params);
+// Hierarchical dispatch epilogue: drain this rank's replication queue, copying payloads from
+// node-sibling leader recv buffers into this rank's recv buffers. Must run after
+// moe_a2a_dispatch_launch on the same stream; no-op when ranks_per_node <= 1.
+void moe_a2a_node_replicate_launch(MoeA2ADispatchParams const& params);
 
 // Combine phase parameters
 struct MoeA2ACombineParams
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,6 +40,15 @@ namespace cutlass_kernels
   Weights are assumed to be column-major.
 */
 
+// Gated activation applied between the two halves of the GEMM output. The gate projection result is
+// activated and multiplied with the up projection result inside the kernel, so the 2x-wide
+// intermediate tensor is never written to global memory.
+enum class GatedActivation
+{
+    kSwiglu, // SiLU(gate) * up
+    kGeglu   // GELU(gate) * up
+};
+
 class CutlassFusedGatedGemmRunnerInterface
 {
 public:
@@ -62,7 +71,7 @@ template <typename T>
 class CutlassFusedGatedGemmRunner : public virtual CutlassFusedGatedGemmRunnerInterface
 {
 public:
-    CutlassFusedGatedGemmRunner();
+    explicit CutlassFusedGatedGemmRunner(GatedActivation activation = GatedActivation::kSwiglu);
     ~CutlassFusedGatedGemmRunner();
 
     void gemm(void* D, void const* A, void const* B, void const* C_bias, tk::QuantMode quantOption, int m, int n, int k,
@@ -82,6 +91,7 @@ private:
     size_t getWorkspaceSizeImpl(int const m, int const n, int const k);
 
     int mSm;
+    GatedActivation mActivation;
 };
 
 } // namespace cutlass_kernels
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -171,7 +171,7 @@ size_t genericGemmGatedKernelLauncherSm90(void* D, void const* A, void const* B,
 #endif // COMPILE_HOPPER_TMA_GEMMS
 }
 
-template <typename T, typename CTAShape>
+template <typename T, typename CTAShape, template <class> typename Activation = cutlass::epilogue::thread::SiLu>
 size_t dispatchGemmConfigSm90(void* D, void const* A, void const* B, void const* C_bias, tk::QuantMode quantOption,
     int m, int n, int k, float scale_d0, float scale_d1, float scale_output, tkc::CutlassGemmConfig gemmConfig,
     char* workspace, size_t workspaceBytes, cudaStream_t stream, int* occupancy = nullptr)
@@ -180,28 +180,34 @@ size_t dispatchGemmConfigSm90(void* D, void const* A, void const* B, void const*
     switch (gemmConfig.cluster_shape)
     {
     case tkc::ClusterShape::ClusterShape_1x1x1:
-        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_1, _1, _1>>(D, A, B, C_bias, quantOption, m, n, k,
-            scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_1, _1, _1>, Activation>(D, A, B, C_bias,
+            quantOption, m, n, k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream,
+            occupancy);
         break;
     case tkc::ClusterShape::ClusterShape_2x1x1:
-        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_2, _1, _1>>(D, A, B, C_bias, quantOption, m, n, k,
-            scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_2, _1, _1>, Activation>(D, A, B, C_bias,
+            quantOption, m, n, k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream,
+            occupancy);
         break;
     case tkc::ClusterShape::ClusterShape_1x2x1:
-        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_1, _2, _1>>(D, A, B, C_bias, quantOption, m, n, k,
-            scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_1, _2, _1>, Activation>(D, A, B, C_bias,
+            quantOption, m, n, k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream,
+            occupancy);
         break;
     case tkc::ClusterShape::ClusterShape_2x2x1:
-        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_2, _2, _1>>(D, A, B, C_bias, quantOption, m, n, k,
-            scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_2, _2, _1>, Activation>(D, A, B, C_bias,
+            quantOption, m, n, k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream,
+            occupancy);
         break;
     case tkc::ClusterShape::ClusterShape_1x8x1:
-        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_1, _8, _1>>(D, A, B, C_bias, quantOption, m, n, k,
-            scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_1, _8, _1>, Activation>(D, A, B, C_bias,
+            quantOption, m, n, k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream,
+            occupancy);
         break;
     case tkc::ClusterShape::ClusterShape_8x1x1:
-        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_8, _1, _1>>(D, A, B, C_bias, quantOption, m, n, k,
-            scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+        return genericGemmGatedKernelLauncherSm90<T, CTAShape, Shape<_8, _1, _1>, Activation>(D, A, B, C_bias,
+            quantOption, m, n, k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream,
+            occupancy);
         break;
     default:
         throw std::runtime_error(
@@ -211,7 +217,7 @@ size_t dispatchGemmConfigSm90(void* D, void const* A, void const* B, void const*
     }
 }
 
-template <typename T>
+template <typename T, template <class> typename Activation = cutlass::epilogue::thread::SiLu>
 size_t dispatchGemmToCutlassSm90(void* D, void const* A, void const* B, void const* C_bias, tk::QuantMode quantOption,
     int m, int n, int k, float scale_d0, float scale_d1, float scale_output, tkc::CutlassGemmConfig gemmConfig,
     char* workspace, size_t workspaceBytes, cudaStream_t stream, int* occupancy = nullptr)
@@ -223,35 +229,35 @@ size_t dispatchGemmToCutlassSm90(void* D, void const* A, void const* B, void con
     switch (gemmConfig.tile_config_sm90)
     {
     case tkc::CutlassTileConfigSM90::CtaShape64x16x128B:
-        return dispatchGemmConfigSm90<T, Shape<_64, _16, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_64, _16, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape64x32x128B:
-        return dispatchGemmConfigSm90<T, Shape<_64, _32, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_64, _32, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape64x64x128B:
-        return dispatchGemmConfigSm90<T, Shape<_64, _64, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_64, _64, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape64x128x128B:
-        return dispatchGemmConfigSm90<T, Shape<_64, _128, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_64, _128, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape128x16x128B:
-        return dispatchGemmConfigSm90<T, Shape<_128, _16, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_128, _16, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape128x32x128B:
-        return dispatchGemmConfigSm90<T, Shape<_128, _32, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_128, _32, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape128x64x128B:
-        return dispatchGemmConfigSm90<T, Shape<_128, _64, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_128, _64, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::CtaShape128x128x128B:
-        return dispatchGemmConfigSm90<T, Shape<_128, _128, _Ktile>>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
+        return dispatchGemmConfigSm90<T, Shape<_128, _128, _Ktile>, Activation>(D, A, B, C_bias, quantOption, m, n, k, scale_d0,
             scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
         break;
     case tkc::CutlassTileConfigSM90::Undefined:
@@ -273,7 +279,8 @@ size_t dispatchGemmToCutlassSm90(void* D, void const* A, void const* B, void con
 }
 
 template <typename T>
-CutlassFusedGatedGemmRunner<T>::CutlassFusedGatedGemmRunner()
+CutlassFusedGatedGemmRunner<T>::CutlassFusedGatedGemmRunner(GatedActivation activation)
+    : mActivation(activation)
 {
     TLLM_LOG_DEBUG(__PRETTY_FUNCTION__);
     mSm = tk::getSMVersion();
@@ -296,6 +303,11 @@ size_t CutlassFusedGatedGemmRunner<T>::dispatchToArch(void* D, void const* A, vo
 #ifndef PLACEHOLDER_KERNELS
         if (mSm == 90)
         {
+            if (mActivation == GatedActivation::kGeglu)
+            {
+                return dispatchGemmToCutlassSm90<T, cutlass::epilogue::thread::GELU>(D, A, B, C_bias, quantOption, m, n,
+                    k, scale_d0, scale_d1, scale_output, gemmConfig, workspace, workspaceBytes, stream, occupancy);
+            }
             return dispatchGemmToCutlassSm90<T>(D, A, B, C_bias, quantOption, m, n, k, scale_d0, scale_d1, scale_output,
                 gemmConfig, workspace, workspaceBytes, stream, occupancy);
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -114,7 +114,8 @@ public:
 
     // Compiles and inserts the cubin if not found in mMap. Does nothing otherwise.
     // When initialize is true, also initialize cubins.
-    void insertCubinIfNotExists(Key const& key, CompileEngine* compileEngine, bool initialize)
+    // Returns true iff a cubin was compiled and inserted.
+    bool insertCubinIfNotExists(Key const& key, CompileEngine* compileEngine, bool initialize)
     {
         TLLM_CHECK(compileEngine != nullptr);
 
@@ -123,7 +124,7 @@ public:
         auto iter = mMap.find(key);
         if (iter != mMap.end())
         {
-            return;
+            return false;
         }
 
         CubinObj obj = compileEngine->compile();
@@ -132,6 +133,7 @@ public:
             obj.initialize();
         }
         mMap.insert({key, std::move(obj)});
+        return true;
     }
 
     CubinObj* getCubin(Key const& key)
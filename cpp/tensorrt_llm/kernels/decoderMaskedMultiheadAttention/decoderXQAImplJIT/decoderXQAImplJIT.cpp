@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,8 @@
 #include "tensorrt_llm/kernels/unfusedAttentionKernels.h"
 #include "tensorrt_llm/kernels/xqaDispatcher.h"
 
+#include <mutex>
+
 namespace
 {
 
@@ -162,8 +164,19 @@ void DecoderXQAImplJIT::prepareForActualXQAParams(XQAParams const& xqaParams)
 
     if (supportConfig(xqaParams, true))
     {
+        auto const& cubinCacheDir = tensorrt_llm::common::getEnvXqaCubinCacheDir();
+        if (!cubinCacheDir.empty())
+        {
+            // Seed the registry from the on-disk cache once so restarted processes skip JIT compilation.
+            static std::once_flag cubinCacheLoadOnce;
+            std::call_once(cubinCacheLoadOnce, [&] { mResource->mergeFromDiskCache(cubinCacheDir, mSM); });
+        }
         jit::CubinObjKey key = getCubinObjKeyFromXQAParams(xqaParams);
-        registryGlobal->insertCubinIfNotExists(key, &compileEngine, /*initialize=*/true);
+        bool const compiled = registryGlobal->insertCubinIfNotExists(key, &compileEngine, /*initialize=*/true);
+        if (compiled && !cubinCacheDir.empty())
+        {
+            mResource->saveToDiskCache(cubinCacheDir, mSM);
+        }
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -45,10 +45,29 @@ bool supportConfigCommon(XQAParams const& xqaParams, bool forConfigurePlugin)
     {
         return false;
     }
-    if (xqaParams.position_shift_enabled || xqaParams.sink_token_length > 0)
+    if (xqaParams.position_shift_enabled)
     {
+        // With position shift the KV cache stores un-rotated keys and RoPE is applied at read time,
+        // which the XQA kernels do not do.
         return false;
     }
+    if (xqaParams.sink_token_length > 0)
+    {
+        // Pinned sink blocks keep the head of the sequence while the rest of the window is
+        // overwritten cyclically. The XQA kernels index the cache linearly, so they can only be
+        // used while the layout is still linear: sink tokens must fill whole blocks (no bubble
+        // between the sink and cyclic sections) and no sequence may have wrapped yet. The wrap
+        // condition is an inference-time check; at configure time, be optimistic so the plugin
+        // prepares XQA resources for the pre-wrap phase.
+        if (xqaParams.paged_kv_cache && xqaParams.sink_token_length % xqaParams.tokens_per_block != 0)
+        {
+            return false;
+        }
+        if (!forConfigurePlugin && xqaParams.max_past_kv_length + 1 > xqaParams.cyclic_attention_window_size)
+        {
+            return false;
+        }
+    }
     if (xqaParams.num_kv_heads != 0 && xqaParams.num_q_heads % xqaParams.num_kv_heads != 0)
     {
         return false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -485,13 +485,30 @@ bool DecoderXQAImplPrecompiled::shouldUse(XQAParams const& xqaParams, bool forCo
     {
         SUPPORT_RETURN_FALSE("beam_width");
     }
-    if (xqaParams.cyclic_attention_window_size != xqaParams.max_attention_window_size)
+    if (xqaParams.cyclic_attention_window_size != xqaParams.max_attention_window_size && !forConfigurePlugin
+        && xqaParams.max_past_kv_length + 1 > xqaParams.cyclic_attention_window_size)
     {
+        // The precompiled kernels index the cache linearly, which stays valid until the cyclic
+        // section wraps; fall back only once the longest sequence has outgrown the window.
         SUPPORT_RETURN_FALSE("cyclic_attention_window_size != max_attention_window_size");
     }
-    if (xqaParams.position_shift_enabled || xqaParams.sink_token_length > 0)
+    if (xqaParams.position_shift_enabled)
     {
-        SUPPORT_RETURN_FALSE("streaming-llm");
+        // With position shift the cache stores un-rotated keys and RoPE is applied at read time.
+        SUPPORT_RETURN_FALSE("position_shift");
+    }
+    if (xqaParams.sink_token_length > 0)
+    {
+        // Pinned sink blocks are usable while the layout is still linear: sink tokens must fill
+        // whole blocks (no bubble before the cyclic section) and no sequence may have wrapped.
+        if (xqaParams.paged_kv_cache && xqaParams.sink_token_length % xqaParams.tokens_per_block != 0)
+        {
+            SUPPORT_RETURN_FALSE("sink tokens not block-aligned");
+        }
+        if (!forConfigurePlugin && xqaParams.max_past_kv_length + 1 > xqaParams.cyclic_attention_window_size)
+        {
+            SUPPORT_RETURN_FALSE("streaming-llm wrapped");
+        }
     }
     if (xqaParams.skip_softmax_threshold_scale_factor != 0)
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,13 @@
 
 #include <assert.h>
 #include <string.h>
+#include <unistd.h>
 
+#include <filesystem>
+#include <fstream>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "tensorrt_llm/common/config.h"
 #include "tensorrt_llm/common/cudaUtils.h"
@@ -162,6 +166,72 @@ void DecoderXQARunnerResource::serialize(void* buffer, size_t buffer_size) const
     mCubinObjRegistry->serialize(buffer, buffer_size);
 }
 
+namespace
+{
+
+std::filesystem::path getDiskCachePath(std::string const& cacheDir, int SM)
+{
+    return std::filesystem::path(cacheDir) / ("xqa_cubins_sm" + std::to_string(SM) + ".bin");
+}
+
+} // namespace
+
+void DecoderXQARunnerResource::mergeFromDiskCache(std::string const& cacheDir, int SM)
+{
+    auto const path = getDiskCachePath(cacheDir, SM);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return;
+    }
+    auto const size = static_cast<size_t>(file.tellg());
+    std::vector<char> buffer(size);
+    file.seekg(0);
+    if (!file.read(buffer.data(), size))
+    {
+        TLLM_LOG_WARNING("Failed to read XQA cubin cache file %s, ignoring it.", path.c_str());
+        return;
+    }
+    try
+    {
+        jit::CubinObjRegistry diskRegistry(buffer.data(), buffer.size());
+        mCubinObjRegistry->merge(diskRegistry, /*initialize=*/true);
+        TLLM_LOG_INFO("Loaded XQA cubin cache from %s.", path.c_str());
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_WARNING("Ignoring corrupt XQA cubin cache file %s: %s", path.c_str(), e.what());
+    }
+}
+
+void DecoderXQARunnerResource::saveToDiskCache(std::string const& cacheDir, int SM) const
+{
+    auto const path = getDiskCachePath(cacheDir, SM);
+    try
+    {
+        std::filesystem::create_directories(path.parent_path());
+        auto const size = mCubinObjRegistry->getSerializationSize();
+        std::vector<char> buffer(size);
+        mCubinObjRegistry->serialize(buffer.data(), buffer.size());
+        // Write to a process-unique temporary file and rename it into place, so that concurrently
+        // starting replicas sharing the cache directory never observe a partial file.
+        auto const tmpPath = path.string() + ".tmp." + std::to_string(::getpid());
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!file.write(buffer.data(), buffer.size()))
+            {
+                TLLM_LOG_WARNING("Failed to write XQA cubin cache file %s.", tmpPath.c_str());
+                return;
+            }
+        }
+        std::filesystem::rename(tmpPath, path);
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_WARNING("Failed to persist XQA cubin cache to %s: %s", path.c_str(), e.what());
+    }
+}
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -140,6 +140,13 @@ public:
         getCubinObjRegistry()->merge(*other.getCubinObjRegistry(), initialize);
     }
 
+    // Merges cubins persisted under cacheDir for the given SM arch by an earlier process.
+    // No-op when the cache file does not exist; a corrupt file is ignored with a warning.
+    void mergeFromDiskCache(std::string const& cacheDir, int SM);
+
+    // Persists the current registry under cacheDir for reuse by later processes. Best-effort.
+    void saveToDiskCache(std::string const& cacheDir, int SM) const;
+
     jit::CubinObjRegistry* getCubinObjRegistry()
     {
         return mCubinObjRegistry.get();
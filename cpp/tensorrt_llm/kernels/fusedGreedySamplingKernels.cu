@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CUDART_VERSION
+#error CUDART_VERSION Undefined!
+#elif (CUDART_VERSION >= 11050)
+#include <cub/cub.cuh>
+
+#else
+#include "3rdparty/cub/cub.cuh"
+#endif
+
+#include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/common/reduceKernelUtils.cuh"
+#include "tensorrt_llm/kernels/fusedGreedySamplingKernels.h"
+
+using namespace tensorrt_llm::common;
+using namespace tensorrt_llm::runtime;
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+
+template <typename T, SizeType32 BLOCK_SIZE>
+__global__ void fusedGreedySampling(T const* const* logitsPtrs, TokenIdType** outputIdsPtrs, TokenIdType* newTokens,
+    SizeType32* sequenceLengths, FinishedState const* finishedInput, FinishedState* finishedOutput,
+    SizeType32* finishedSum, SizeType32 const* sequenceLimitLengths, TokenIdType const* endIds,
+    SizeType32 const* batchSlots, SizeType32 vocabSize)
+{
+    auto const tid = static_cast<SizeType32>(threadIdx.x);
+    auto const batchIdx = static_cast<SizeType32>(blockIdx.x);
+    auto const batchSlot = batchSlots[batchIdx];
+
+    auto finishState = finishedInput[batchSlot];
+    // Block-uniform: the whole block takes the same branch for its sequence.
+    bool const doSample = !finishState.isSkipDecoding() && !finishState.isFinished();
+
+    TokenIdType outputId = -1;
+    if (doSample)
+    {
+        typedef cub::BlockReduce<TopK_2<float>, BLOCK_SIZE> BlockReduce;
+        __shared__ typename BlockReduce::TempStorage tempStorage;
+
+        TopK_2<float> partial;
+        partial.init();
+        auto const* logits = logitsPtrs[batchIdx];
+        for (auto vIdx = tid; vIdx < vocabSize; vIdx += BLOCK_SIZE)
+        {
+            partial.insert(static_cast<float>(logits[vIdx]), vIdx);
+        }
+        auto const total = BlockReduce(tempStorage).Reduce(partial, reduce_topk_op_2<float>);
+        if (tid == 0)
+        {
+            outputId = total.p;
+        }
+    }
+
+    if (tid == 0)
+    {
+        auto sequenceLength = sequenceLengths[batchSlot];
+        if (doSample)
+        {
+            outputIdsPtrs[batchSlot][sequenceLength] = outputId;
+            if (outputId == endIds[batchSlot])
+            {
+                finishState.setFinishedEOS();
+                // Do not increase seq len when EOS is generated. Seq len should always contain only tokens to be
+                // outputted. Matches topKStage2Sampling.
+            }
+            else
+            {
+                sequenceLength += 1;
+                sequenceLengths[batchSlot] = sequenceLength;
+            }
+        }
+        // Check if the sequence has reached its length limit. Matches lengthCriterion.
+        if (sequenceLimitLengths[batchSlot] - sequenceLength <= 0)
+        {
+            finishState.setFinishedMaxLength();
+            sequenceLength = sequenceLimitLengths[batchSlot];
+            sequenceLengths[batchSlot] = sequenceLength;
+        }
+        finishedOutput[batchSlot] = finishState;
+        if (finishedSum != nullptr)
+        {
+            finishedSum[batchSlot] = finishState.isFinished() ? 1 : 0;
+        }
+        // Publish the token generated at this step. Matches copyNextStepIds for beamWidth 1.
+        if (sequenceLength - 1 >= 0)
+        {
+            newTokens[batchSlot] = outputIdsPtrs[batchSlot][sequenceLength - 1];
+        }
+    }
+}
+
+template <typename T>
+void invokeFusedGreedySampling(T const* const* logitsPtrs, TokenIdType** outputIdsPtrs, TokenIdType* newTokens,
+    SizeType32* sequenceLengths, FinishedState const* finishedInput, FinishedState* finishedOutput,
+    SizeType32* finishedSum, SizeType32 const* sequenceLimitLengths, TokenIdType const* endIds,
+    SizeType32 const* batchSlots, SizeType32 batchSize, SizeType32 vocabSize, cudaStream_t stream)
+{
+    constexpr SizeType32 blockSize = 1024;
+    dim3 grid(batchSize);
+    dim3 block(blockSize);
+    fusedGreedySampling<T, blockSize><<<grid, block, 0, stream>>>(logitsPtrs, outputIdsPtrs, newTokens,
+        sequenceLengths, finishedInput, finishedOutput, finishedSum, sequenceLimitLengths, endIds, batchSlots,
+        vocabSize);
+}
+
+template void invokeFusedGreedySampling(float const* const* logitsPtrs, TokenIdType** outputIdsPtrs,
+    TokenIdType* newTokens, SizeType32* sequenceLengths, FinishedState const* finishedInput,
+    FinishedState* finishedOutput, SizeType32* finishedSum, SizeType32 const* sequenceLimitLengths,
+    TokenIdType const* endIds, SizeType32 const* batchSlots, SizeType32 batchSize, SizeType32 vocabSize,
+    cudaStream_t stream);
+
+template void invokeFusedGreedySampling(half const* const* logitsPtrs, TokenIdType** outputIdsPtrs,
+    TokenIdType* newTokens, SizeType32* sequenceLengths, FinishedState const* finishedInput,
+    FinishedState* finishedOutput, SizeType32* finishedSum, SizeType32 const* sequenceLimitLengths,
+    TokenIdType const* endIds, SizeType32 const* batchSlots, SizeType32 batchSize, SizeType32 vocabSize,
+    cudaStream_t stream);
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/kernels/decodingCommon.h"
+#include "tensorrt_llm/runtime/common.h"
+#include <cuda_runtime.h>
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+//! \brief Single-launch decode step for the common greedy configuration.
+//!
+//! Fuses the per-step kernel chain of argmax sampling (topKStage1/topKStage2Sampling with k=1),
+//! the max-length stop criterion (lengthCriterion) and the next step token copy (copyNextStepIds)
+//! into one kernel with one block per sequence. Valid only when the whole batch decodes greedily
+//! with no active penalties, word bans or stop words, beamWidth 1 and one token per step; the
+//! caller is responsible for checking this. Matches the semantics of the unfused chain: the
+//! sequence length is not increased when EOS is generated, already finished sequences keep their
+//! state and skip sampling, and the max-length criterion clamps the sequence length to the limit.
+//!
+//! \param logitsPtrs input buffer [batchSize][vocabSizePadded]. Pointers to raw logits per request
+//! \param outputIdsPtrs input/output buffer [maxBatchSize][maxSeqLen].
+//! Pointers to rows with output tokens per request
+//! \param newTokens output buffer [maxBatchSize]. Token predicted at the current step
+//! \param sequenceLengths input/output buffer [maxBatchSize]. Current sequence lengths
+//! \param finishedInput input buffer [maxBatchSize]. Finished states at the start of the step
+//! \param finishedOutput output buffer [maxBatchSize]. Finished states after the step
+//! \param finishedSum output buffer [maxBatchSize], optional. 1 if the request finished, else 0
+//! \param sequenceLimitLengths input buffer [maxBatchSize]. Maximum sequence length per request
+//! \param endIds input buffer [maxBatchSize]. EOS token ids per request
+//! \param batchSlots input buffer [batchSize]. Indices of rows of data in memory pool
+//! \param batchSize batch size
+//! \param vocabSize unpadded vocab size. Padded logits entries are never selected
+//! \param stream stream
+template <typename T>
+void invokeFusedGreedySampling(T const* const* logitsPtrs, runtime::TokenIdType** outputIdsPtrs,
+    runtime::TokenIdType* newTokens, runtime::SizeType32* sequenceLengths, FinishedState const* finishedInput,
+    FinishedState* finishedOutput, runtime::SizeType32* finishedSum, runtime::SizeType32 const* sequenceLimitLengths,
+    runtime::TokenIdType const* endIds, runtime::SizeType32 const* batchSlots, runtime::SizeType32 batchSize,
+    runtime::SizeType32 vocabSize, cudaStream_t stream);
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tensorrt_llm/common/config.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/quantTypeUtils.cuh"
+#include "tensorrt_llm/common/reduceKernelUtils.cuh"
+#include "tensorrt_llm/kernels/groupRmsNormKernels/groupRmsNormQuantKernels.h"
+
+#ifdef ENABLE_FP8
+#include <cuda_fp8.h>
+#endif
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels::group_rms_norm
+{
+
+#ifdef ENABLE_FP8
+
+// Same warp allocation as the non-quantized base kernel: warps are distributed over the inputs
+// proportionally to their (rounded) last dimensions.
+template <typename DType, int n>
+uint32_t calculateNumWarpsQuant(GroupRMSNormQuantParams<n> const& params)
+{
+    constexpr uint32_t kPackedSize = sizeof(float4) / sizeof(DType);
+    uint32_t input_chunk_per_warp = 32 * kPackedSize;
+
+    int rounded_input_dims[n];
+    for (uint32_t i = 0; i < params.num_inputs; i++)
+    {
+        rounded_input_dims[i]
+            = (params.input_last_dims[i] + input_chunk_per_warp - 1) / input_chunk_per_warp * input_chunk_per_warp;
+    }
+
+    uint32_t total_input_length = std::accumulate(rounded_input_dims, rounded_input_dims + params.num_inputs, 0);
+    uint32_t total_warps_needed = total_input_length / input_chunk_per_warp;
+    return std::min<uint32_t>(32, total_warps_needed);
+}
+
+// Structured like GroupRMSNormBaseKernel, with two extra fused stages:
+//  - an optional residual add before the sum-of-squares pass (pre-norm sum written out), and
+//  - a per-token absolute maximum of the weighted values reduced alongside the sum of squares,
+//    so the normalized output can be quantized to FP8 E4M3 with a per-token scale in the same
+//    kernel. All global loads and the FP8 stores stay 128-bit / 64-bit vectorized.
+template <typename DType, typename PackedType, int n, bool EnableWeights, bool EnableResidual, bool MultiRounds>
+__global__ void GroupRMSNormQuantKernel(GroupRMSNormQuantParams<n> params, int rounds)
+{
+    const uint32_t batch_idx = blockIdx.x; // Maps to batch size
+    constexpr uint32_t warp_size = 32;
+    const uint32_t warp_idx = threadIdx.y;
+    const uint32_t lane_idx = threadIdx.x;
+
+    static constexpr int kPackedSize = sizeof(PackedType) / sizeof(DType);
+    // Packed store type for kPackedSize FP8 bytes (8 bytes for fp16/bf16 inputs, 4 for fp32).
+    using PackedQuantType = std::conditional_t<kPackedSize == 8, uint2, uint32_t>;
+    static constexpr float kMaxQuantVal = tensorrt_llm::common::QuantTypeStaticVals<__nv_fp8_e4m3>::MAX_VAL;
+    static constexpr float kMinScalingFactor
+        = tensorrt_llm::common::QuantTypeStaticVals<__nv_fp8_e4m3>::MIN_SCALING_FACTOR;
+
+    alignas(128) __shared__ float smem_rsqrts[32];
+    alignas(128) __shared__ float smem_quant_scales[32];
+    alignas(128) __shared__ uint32_t smem_input_mask[32];
+    alignas(128) __shared__ float smem_warp_sum_sqs[32];
+    alignas(128) __shared__ float smem_warp_amaxs[32];
+    if (warp_idx == 0)
+    {
+        smem_rsqrts[lane_idx] = 0.0f;
+        smem_quant_scales[lane_idx] = 0.0f;
+        // Initialize input mask to 33 to indicate no input
+        smem_input_mask[lane_idx] = 33;
+        smem_warp_sum_sqs[lane_idx] = 0.0f;
+        smem_warp_amaxs[lane_idx] = 0.0f;
+    }
+    float warp_acc = 0.0f;
+    float warp_amax = 0.0f;
+    PackedType const* __restrict__ weight_ptr = nullptr;
+    PackedType const* __restrict__ residual_ptr = nullptr;
+
+#if (__CUDACC_VER_MAJOR__ >= 12 && defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
+    cudaGridDependencySynchronize();
+#endif
+
+    // Find which input current warp operates on
+    const uint32_t input_idx = params.warp_input_idx[warp_idx];
+    const uint32_t warp_start = params.warp_prefix_sum[input_idx];
+    const uint32_t local_warp_idx = warp_idx - warp_start;
+
+    PackedType const* __restrict__ input_ptr = params.inputs[input_idx];
+    PackedType* __restrict__ prenorm_ptr = params.prenorm_outputs[input_idx];
+    __nv_fp8_e4m3* __restrict__ quant_ptr = reinterpret_cast<__nv_fp8_e4m3*>(params.quant_outputs[input_idx]);
+
+    if constexpr (EnableWeights)
+    {
+        weight_ptr = params.weights[input_idx];
+    }
+    if constexpr (EnableResidual)
+    {
+        residual_ptr = params.residuals[input_idx];
+    }
+
+    uint32_t block_offset = batch_idx * params.input_strides[input_idx];
+    uint32_t quant_offset = batch_idx * params.output_strides[input_idx];
+    uint32_t round_offset = warp_size * kPackedSize;
+    const uint32_t input_dim = params.input_last_dims[input_idx];
+
+    uint32_t idx_round0 = block_offset + local_warp_idx * round_offset * rounds + lane_idx * kPackedSize;
+
+    // Store the first round of data as local variable to reduce memory access
+    PackedType input_cache;
+    PackedType weight_cache;
+    if (idx_round0 < input_dim + block_offset)
+    {
+        input_cache = input_ptr[idx_round0 / kPackedSize];
+        if constexpr (EnableResidual)
+        {
+            PackedType residual_cache = residual_ptr[idx_round0 / kPackedSize];
+#pragma unroll
+            for (uint32_t j = 0; j < kPackedSize; j++)
+            {
+                reinterpret_cast<DType*>(&input_cache)[j]
+                    = static_cast<DType>(static_cast<float>(reinterpret_cast<DType*>(&input_cache)[j])
+                        + static_cast<float>(reinterpret_cast<DType*>(&residual_cache)[j]));
+            }
+            prenorm_ptr[idx_round0 / kPackedSize] = input_cache;
+        }
+        if constexpr (EnableWeights)
+        {
+            weight_cache = weight_ptr[(idx_round0 - block_offset) / kPackedSize];
+        }
+
+#pragma unroll
+        for (uint32_t j = 0; j < kPackedSize; j++)
+        {
+            float v = static_cast<float>(reinterpret_cast<DType*>(&input_cache)[j]);
+            warp_acc += v * v;
+            float w = 1.0f;
+            if constexpr (EnableWeights)
+            {
+                w = static_cast<float>(reinterpret_cast<DType*>(&weight_cache)[j]) + params.weight_bias;
+            }
+            warp_amax = fmaxf(warp_amax, fabsf(v * w));
+        }
+    }
+
+    // Process round1+
+    if constexpr (MultiRounds)
+    {
+        for (uint32_t i = 1; i < rounds; i++)
+        {
+            uint32_t idx
+                = block_offset + local_warp_idx * round_offset * rounds + i * round_offset + lane_idx * kPackedSize;
+            if (idx < input_dim + block_offset)
+            {
+                PackedType packed_data = input_ptr[idx / kPackedSize];
+                if constexpr (EnableResidual)
+                {
+                    PackedType packed_residual = residual_ptr[idx / kPackedSize];
+#pragma unroll
+                    for (uint32_t j = 0; j < kPackedSize; j++)
+                    {
+                        reinterpret_cast<DType*>(&packed_data)[j]
+                            = static_cast<DType>(static_cast<float>(reinterpret_cast<DType*>(&packed_data)[j])
+                                + static_cast<float>(reinterpret_cast<DType*>(&packed_residual)[j]));
+                    }
+                    prenorm_ptr[idx / kPackedSize] = packed_data;
+                }
+#pragma unroll
+                for (uint32_t j = 0; j < kPackedSize; j++)
+                {
+                    float v = static_cast<float>(reinterpret_cast<DType*>(&packed_data)[j]);
+                    warp_acc += v * v;
+                    float w = 1.0f;
+                    if constexpr (EnableWeights)
+                    {
+                        w = static_cast<float>(
+                                reinterpret_cast<DType const*>(&weight_ptr[(idx - block_offset) / kPackedSize])[j])
+                            + params.weight_bias;
+                    }
+                    warp_amax = fmaxf(warp_amax, fabsf(v * w));
+                }
+            }
+        }
+    }
+    float warp_sum = tensorrt_llm::common::warpReduceSum(warp_acc);
+    warp_amax = tensorrt_llm::common::warpReduceMax(warp_amax);
+    if (lane_idx == 0)
+    {
+        smem_warp_sum_sqs[warp_idx] = warp_sum;
+        smem_warp_amaxs[warp_idx] = warp_amax;
+    }
+
+// Extra _syncwarp for sm < 900, needed to avoid race condition on smem_input_mask write.
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ < 900)
+    __syncwarp();
+#endif
+    if (lane_idx == 0)
+    {
+        smem_input_mask[warp_idx] = input_idx;
+    }
+
+    __syncthreads();
+
+    // Cross warp reduction on all inputs
+    if (warp_idx < n)
+    {
+        float warp_sum_acc = 0.0f;
+        float warp_amax_acc = 0.0f;
+        // Each warp reduces one input
+        if (warp_idx == smem_input_mask[lane_idx])
+        {
+            warp_sum_acc = smem_warp_sum_sqs[lane_idx];
+            warp_amax_acc = smem_warp_amaxs[lane_idx];
+        }
+        float sum_sq = tensorrt_llm::common::warpReduceSum(warp_sum_acc);
+        float amax = tensorrt_llm::common::warpReduceMax(warp_amax_acc);
+        if (lane_idx == 0)
+        {
+            float rsqrt_val = rsqrtf(sum_sq / params.input_last_dims[warp_idx] + params.eps);
+            // Per-token scale of the normalized row; clamped like perTokenQuantization.
+            float row_max = fmaxf(amax * rsqrt_val, 1e-8f);
+            float dequant_scale = fmaxf(row_max / kMaxQuantVal, kMinScalingFactor);
+            smem_rsqrts[warp_idx] = rsqrt_val;
+            smem_quant_scales[warp_idx] = 1.0f / dequant_scale;
+            params.scale_outputs[warp_idx][batch_idx] = dequant_scale;
+        }
+    }
+
+    __syncthreads();
+
+    const float rsqrt_scale = smem_rsqrts[input_idx] * smem_quant_scales[input_idx];
+
+    // Apply normalization and quantize
+    if (idx_round0 < input_dim + block_offset)
+    {
+        PackedQuantType packed_output;
+#pragma unroll
+        for (uint32_t j = 0; j < kPackedSize; j++)
+        {
+            float v = static_cast<float>(reinterpret_cast<DType*>(&input_cache)[j]);
+            if constexpr (EnableWeights)
+            {
+                v *= static_cast<float>(reinterpret_cast<DType*>(&weight_cache)[j]) + params.weight_bias;
+            }
+            reinterpret_cast<__nv_fp8_e4m3*>(&packed_output)[j] = __nv_fp8_e4m3(v * rsqrt_scale);
+        }
+        reinterpret_cast<PackedQuantType*>(quant_ptr)[(quant_offset + idx_round0 - block_offset) / kPackedSize]
+            = packed_output;
+    }
+
+    if constexpr (MultiRounds)
+    {
+        for (uint32_t i = 1; i < rounds; i++)
+        {
+            uint32_t idx
+                = block_offset + local_warp_idx * round_offset * rounds + i * round_offset + lane_idx * kPackedSize;
+            if (idx < input_dim + block_offset)
+            {
+                // The pre-norm sum was already materialized in the first pass, so reload it rather
+                // than re-adding the residual.
+                PackedType packed_input
+                    = EnableResidual ? prenorm_ptr[idx / kPackedSize] : input_ptr[idx / kPackedSize];
+                PackedQuantType packed_output;
+
+#pragma unroll
+                for (uint32_t j = 0; j < kPackedSize; j++)
+                {
+                    float v = static_cast<float>(reinterpret_cast<DType*>(&packed_input)[j]);
+                    if constexpr (EnableWeights)
+                    {
+                        v *= static_cast<float>(
+                                 reinterpret_cast<DType const*>(&weight_ptr[(idx - block_offset) / kPackedSize])[j])
+                            + params.weight_bias;
+                    }
+                    reinterpret_cast<__nv_fp8_e4m3*>(&packed_output)[j] = __nv_fp8_e4m3(v * rsqrt_scale);
+                }
+                reinterpret_cast<PackedQuantType*>(quant_ptr)[(quant_offset + idx - block_offset) / kPackedSize]
+                    = packed_output;
+            }
+        }
+    }
+
+#if (__CUDACC_VER_MAJOR__ >= 12 && defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
+    cudaTriggerProgrammaticLaunchCompletion();
+#endif
+}
+
+template <typename DType, int n, bool EnableWeights, bool EnableResidual>
+void GroupRMSNormQuantKernel(GroupRMSNormQuantParams<n>& params)
+{
+    // Kernel assertions
+    constexpr uint32_t kPackedSize = sizeof(float4) / sizeof(DType);
+    TLLM_CHECK_WITH_INFO(params.num_inputs <= 2,
+        "Only up to 2 inputs are supported with performance guarantees. Kernels with more than 2 inputs can be "
+        "instantiated.");
+    int rounded_input_dims[n];
+    uint32_t input_chunk_per_warp = 32 * kPackedSize;
+    for (uint32_t i = 0; i < params.num_inputs; i++)
+    {
+        TLLM_CHECK_WITH_INFO(
+            params.input_last_dims[i] % 32 == 0, "The last dimension of input must be divisible by 32.");
+        TLLM_CHECK_WITH_INFO(params.input_last_dims[i] % kPackedSize == 0,
+            "Input[%u] dimension %u is not divisible by %u (128b / sizeof(dype)). Finer granularity is not "
+            "supported yet.",
+            i, params.input_last_dims[i], kPackedSize);
+        // Make rounded_input_dims[i] a multiple of 32 * kPackedSize
+        rounded_input_dims[i]
+            = (params.input_last_dims[i] + input_chunk_per_warp - 1) / input_chunk_per_warp * input_chunk_per_warp;
+    }
+
+    // Calculate total warps to launch and rounds needed
+    uint32_t total_input_length = std::accumulate(rounded_input_dims, rounded_input_dims + params.num_inputs, 0);
+    uint32_t total_warps_needed = total_input_length / input_chunk_per_warp;
+    uint32_t num_warps_to_launch = calculateNumWarpsQuant<DType, n>(params);
+    uint32_t rounds = (total_warps_needed + num_warps_to_launch - 1) / num_warps_to_launch; // ceil_div
+
+    // Calculate warp_prefix_sum
+    float warps_per_token = float(num_warps_to_launch) / total_input_length;
+    std::vector<int> warps_per_array(params.num_inputs);
+    int warp_prefix = 0;
+
+    for (int i = 0; i < params.num_inputs; ++i)
+    {
+        params.warp_prefix_sum[i] = warp_prefix;
+        warps_per_array[i] = std::max(1, int(round(rounded_input_dims[i] * warps_per_token)));
+        for (int j = warp_prefix; j < warp_prefix + warps_per_array[i]; ++j)
+        {
+            params.warp_input_idx[j] = i;
+        }
+        warp_prefix += warps_per_array[i];
+    }
+    params.warp_prefix_sum[params.num_inputs] = warp_prefix;
+
+    dim3 grid_dim(params.batch_size);
+    dim3 block_dim(32, num_warps_to_launch);
+
+    cudaLaunchConfig_t cfg;
+    cudaLaunchAttribute attribute[1];
+    cfg.gridDim = grid_dim;
+    cfg.blockDim = block_dim;
+    cfg.dynamicSmemBytes = 0;
+    cfg.stream = params.stream;
+    attribute[0].id = cudaLaunchAttributeProgrammaticStreamSerialization;
+    attribute[0].val.programmaticStreamSerializationAllowed = tensorrt_llm::common::getEnvEnablePDL() ? 1 : 0;
+    cfg.attrs = attribute;
+    cfg.numAttrs = 1;
+    if (rounds > 1)
+    {
+        TLLM_CUDA_CHECK(cudaLaunchKernelEx(
+            &cfg, GroupRMSNormQuantKernel<DType, float4, n, EnableWeights, EnableResidual, true>, params, rounds));
+    }
+    else
+    {
+        TLLM_CUDA_CHECK(cudaLaunchKernelEx(
+            &cfg, GroupRMSNormQuantKernel<DType, float4, n, EnableWeights, EnableResidual, false>, params, rounds));
+    }
+}
+
+#endif // ENABLE_FP8
+
+template <int n>
+void GroupRMSNormQuantKernelLauncher(GroupRMSNormQuantParams<n>& params)
+{
+#ifdef ENABLE_FP8
+#define GROUP_RMS_NORM_QUANT_DISPATCH(DTYPE)                                                                           \
+    if (params.enable_weights && params.enable_residual)                                                               \
+    {                                                                                                                  \
+        return GroupRMSNormQuantKernel<DTYPE, n, true, true>(params);                                                  \
+    }                                                                                                                  \
+    else if (params.enable_weights)                                                                                    \
+    {                                                                                                                  \
+        return GroupRMSNormQuantKernel<DTYPE, n, true, false>(params);                                                 \
+    }                                                                                                                  \
+    else if (params.enable_residual)                                                                                   \
+    {                                                                                                                  \
+        return GroupRMSNormQuantKernel<DTYPE, n, false, true>(params);                                                 \
+    }                                                                                                                  \
+    else                                                                                                               \
+    {                                                                                                                  \
+        return GroupRMSNormQuantKernel<DTYPE, n, false, false>(params);                                                \
+    }
+
+    switch (params.dtype)
+    {
+    case nvinfer1::DataType::kHALF: GROUP_RMS_NORM_QUANT_DISPATCH(half); break;
+    case nvinfer1::DataType::kBF16: GROUP_RMS_NORM_QUANT_DISPATCH(__nv_bfloat16); break;
+    case nvinfer1::DataType::kFLOAT: GROUP_RMS_NORM_QUANT_DISPATCH(float); break;
+    default: TLLM_CHECK_WITH_INFO(false, "Unsupported data type for GroupRMSNormQuant");
+    }
+
+#undef GROUP_RMS_NORM_QUANT_DISPATCH
+#else
+    TLLM_CHECK_WITH_INFO(false, "GroupRMSNormQuant requires a build with ENABLE_FP8.");
+#endif
+}
+
+#define INSTANTIATE_GROUP_RMS_NORM_QUANT(n)                                                                            \
+    template void GroupRMSNormQuantKernelLauncher<n>(GroupRMSNormQuantParams<n> & params);
+
+INSTANTIATE_GROUP_RMS_NORM_QUANT(1)
+INSTANTIATE_GROUP_RMS_NORM_QUANT(2)
+
+} // namespace kernels::group_rms_norm
+
+TRTLLM_NAMESPACE_END
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "tensorrt_llm/common/assert.h"
+#include <NvInferRuntime.h>
+#include <cuda_bf16.h>
+#include <cuda_fp16.h>
+
+#include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels::group_rms_norm
+{
+
+// Fused variant of the GroupRMSNorm family: optional residual add + RMSNorm + per-token scale
+// compute + FP8 E4M3 quantization in a single pass over the activations, so the quantized layer
+// input no longer costs an extra read/write round-trip through global memory.
+template </*number of inputs*/ int n>
+struct GroupRMSNormQuantParams
+{
+    float4 const* inputs[n];
+    // Optional residual added before normalization. When set (enable_residual), the pre-norm sum
+    // (input + residual) is written to prenorm_outputs for the next layer's residual stream.
+    float4 const* residuals[n];
+    float4* prenorm_outputs[n];
+    // FP8 E4M3 quantized normalized outputs, stored packed (8 bytes per 128-bit input load).
+    void* quant_outputs[n];
+    // Per-token dequantization scales, one [batch_size] array per input
+    // (same convention as perTokenQuantization: max(rowMax / 448, minScalingFactor)).
+    float* scale_outputs[n];
+    float4 const* weights[n];
+    int input_last_dims[n];
+    int input_strides[n];
+    int output_strides[n];
+    int warp_input_idx[32];
+    int warp_prefix_sum[n + 1];
+    int batch_size;
+    int num_inputs;
+    float eps;
+    float weight_bias;
+    bool enable_weights;
+    bool enable_residual;
+    nvinfer1::DataType dtype;
+    cudaStream_t stream;
+};
+
+template <int n>
+void GroupRMSNormQuantKernelLauncher(GroupRMSNormQuantParams<n>& params);
+
+} // namespace kernels::group_rms_norm
+
+TRTLLM_NAMESPACE_END
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -49,6 +49,41 @@ __global__ void cuKVCacheBlockPartialCopy(T* dst, T const* src, unsigned int num
     }
 }
 
+__global__ void cuKVCacheBatchedBlockCopy(KVCacheCopyDesc const* descs, unsigned int numDescs)
+{
+    for (unsigned int descIdx = blockIdx.x; descIdx < numDescs; descIdx += gridDim.x)
+    {
+        auto const& desc = descs[descIdx];
+        auto const* src = static_cast<std::uint8_t const*>(desc.src);
+        auto* dst = static_cast<std::uint8_t*>(desc.dst);
+        auto const numBytes = desc.sizeInBytes;
+
+        bool const aligned16 = (reinterpret_cast<std::uintptr_t>(src) % 16 == 0)
+            && (reinterpret_cast<std::uintptr_t>(dst) % 16 == 0);
+        if (aligned16)
+        {
+            auto const numVecs = numBytes / 16;
+            auto const* srcVec = reinterpret_cast<uint4 const*>(src);
+            auto* dstVec = reinterpret_cast<uint4*>(dst);
+            for (std::uint64_t i = threadIdx.x; i < numVecs; i += blockDim.x)
+            {
+                dstVec[i] = srcVec[i];
+            }
+            for (std::uint64_t i = numVecs * 16 + threadIdx.x; i < numBytes; i += blockDim.x)
+            {
+                dst[i] = src[i];
+            }
+        }
+        else
+        {
+            for (std::uint64_t i = threadIdx.x; i < numBytes; i += blockDim.x)
+            {
+                dst[i] = src[i];
+            }
+        }
+    }
+}
+
 unsigned int ipow2(unsigned int v)
 {
     unsigned int cnt = 0;
@@ -133,6 +168,17 @@ void kvCacheBlockPartialCopy(IBuffer& dst, IBuffer const& src, unsigned int numL
     }
 }
 
+void kvCacheBatchedBlockCopy(KVCacheCopyDesc const* descsDevice, unsigned int numDescs, cudaStream_t stream)
+{
+    if (numDescs == 0)
+    {
+        return;
+    }
+    dim3 const block{256};
+    dim3 const grid{numDescs};
+    cuKVCacheBatchedBlockCopy<<<grid, block, 0, stream>>>(descsDevice, numDescs);
+}
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
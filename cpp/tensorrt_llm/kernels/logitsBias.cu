@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/kernels/logitsBias.h"
+
+using namespace tensorrt_llm::common;
+using namespace tensorrt_llm::runtime;
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+namespace
+{
+
+int32_t constexpr kThreadsPerBlock = 256;
+
+} // namespace
+
+template <typename T, typename PackedT, int32_t kElemsPerThread>
+__global__ void __launch_bounds__(kThreadsPerBlock)
+    logitsBiasKernel(T** __restrict__ logits, T const** __restrict__ bias, int32_t vocabSizePadded)
+{
+    int constexpr kAlignment = sizeof(PackedT) / sizeof(T);
+
+    int const batchIdx = blockIdx.y;
+
+    int const blockOffset = blockIdx.x * kThreadsPerBlock * kElemsPerThread;
+    T* logitsGmemPtr = logits[batchIdx] + blockOffset;
+    T const* biasGmemPtr = bias[batchIdx] + blockOffset;
+
+    T logitsReg[kAlignment];
+    T biasReg[kAlignment];
+
+#pragma unroll
+    for (int offset = threadIdx.x * kAlignment; offset < kThreadsPerBlock * kElemsPerThread;
+         offset += kThreadsPerBlock * kAlignment)
+    {
+        if (blockOffset + offset >= vocabSizePadded)
+        {
+            break;
+        }
+
+        *reinterpret_cast<PackedT*>(logitsReg) = *reinterpret_cast<PackedT const*>(logitsGmemPtr + offset);
+        *reinterpret_cast<PackedT*>(biasReg) = *reinterpret_cast<PackedT const*>(biasGmemPtr + offset);
+#pragma unroll
+        for (int i = 0; i < kAlignment; i++)
+        {
+            logitsReg[i] = static_cast<T>(static_cast<float>(logitsReg[i]) + static_cast<float>(biasReg[i]));
+        }
+        *reinterpret_cast<PackedT*>(logitsGmemPtr + offset) = *reinterpret_cast<PackedT*>(logitsReg);
+    }
+}
+
+template <typename T, typename PackedT>
+void logitsBiasDispatchToElemsPerThread(
+    T** logits, T const** bias, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream)
+{
+    int constexpr kAlignment = sizeof(PackedT) / sizeof(T);
+    static int const smCount = tensorrt_llm::common::getMultiProcessorCount();
+    int32_t const numBlocksPerRow = ceilDiv(2048 / kThreadsPerBlock * smCount, batchSize);
+    int32_t const numElemsPerThread = ceilDiv(vocabSizePadded, kThreadsPerBlock * numBlocksPerRow);
+
+    dim3 const block(kThreadsPerBlock);
+
+    if (numElemsPerThread <= 4 && kAlignment <= 4)
+    {
+        dim3 const grid(ceilDiv(vocabSizePadded, kThreadsPerBlock * 4), batchSize);
+        logitsBiasKernel<T, PackedT, 4><<<grid, block, 0, stream>>>(logits, bias, vocabSizePadded);
+    }
+    else if (numElemsPerThread <= 8 && kAlignment <= 8)
+    {
+        dim3 const grid(ceilDiv(vocabSizePadded, kThreadsPerBlock * 8), batchSize);
+        logitsBiasKernel<T, PackedT, 8><<<grid, block, 0, stream>>>(logits, bias, vocabSizePadded);
+    }
+    else if (numElemsPerThread <= 16 && kAlignment <= 16)
+    {
+        dim3 const grid(ceilDiv(vocabSizePadded, kThreadsPerBlock * 16), batchSize);
+        logitsBiasKernel<T, PackedT, 16><<<grid, block, 0, stream>>>(logits, bias, vocabSizePadded);
+    }
+    else
+    {
+        dim3 const grid(ceilDiv(vocabSizePadded, kThreadsPerBlock * 32), batchSize);
+        logitsBiasKernel<T, PackedT, 32><<<grid, block, 0, stream>>>(logits, bias, vocabSizePadded);
+    }
+}
+
+template <typename T>
+void invokeLogitsBias(T** logits, T const** bias, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream)
+{
+    // Dispatch to PackedT
+    if (vocabSizePadded % (sizeof(float4) / sizeof(T)) == 0)
+    {
+        logitsBiasDispatchToElemsPerThread<T, float4>(logits, bias, batchSize, vocabSizePadded, stream);
+    }
+    else if (vocabSizePadded % (sizeof(float2) / sizeof(T)) == 0)
+    {
+        logitsBiasDispatchToElemsPerThread<T, float2>(logits, bias, batchSize, vocabSizePadded, stream);
+    }
+    else if (vocabSizePadded % (sizeof(float) / sizeof(T)) == 0)
+    {
+        logitsBiasDispatchToElemsPerThread<T, float>(logits, bias, batchSize, vocabSizePadded, stream);
+    }
+    else
+    {
+        logitsBiasDispatchToElemsPerThread<T, T>(logits, bias, batchSize, vocabSizePadded, stream);
+    }
+}
+
+template void invokeLogitsBias<float>(
+    float** logits, float const** bias, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+template void invokeLogitsBias<half>(
+    half** logits, half const** bias, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+
+#ifdef ENABLE_BF16
+template void invokeLogitsBias<__nv_bfloat16>(__nv_bfloat16** logits, __nv_bfloat16 const** bias, int32_t batchSize,
+    int32_t vocabSizePadded, cudaStream_t stream);
+#endif
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
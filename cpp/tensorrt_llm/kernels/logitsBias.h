@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/runtime/common.h"
+#include <cuda_fp16.h>
+#include <cuda_runtime.h>
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+
+//! \brief Add per-request bias vectors to logits in-place, batched via pointer vectors.
+//! A bias of -inf masks a token; finite values implement soft constraints. Device-side
+//! counterpart of the host logits post-processor callbacks.
+template <typename T>
+void invokeLogitsBias(T** logits, T const** bias, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
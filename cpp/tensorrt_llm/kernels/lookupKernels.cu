@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -92,6 +92,86 @@ INSTANTIATE_LOOK_UP(__nv_bfloat16, __nv_bfloat16, int);
 INSTANTIATE_LOOK_UP(__nv_bfloat16, int8_t, int);
 #endif
 
+/* With prompt tuning or multimodal inputs, a batch mixes tokens whose embeddings come from different
+tables: regular ids from the (possibly partitioned) vocab table, virtual-token ids from a prompt-tuning
+table, and placeholder ids whose rows were produced by a vision encoder. Resolving that per source
+requires one gather per table plus select/scatter passes to merge the results into the packed input
+embedding. Here every token instead carries a (source, row) descriptor and the merged result is written
+in a single pass.
+
+ * Input: per-token source ids (sources[token_num]) and row indices (rows[token_num])
+   Input: vocab table (vocabWeight[ceil(vocab_size/world_size), hidden]), prompt table and packed
+          multimodal features, both [*, hidden] in the output type
+   Output: out[idx] = table(sources[idx])[rows[idx], hidden]
+ *
+ * Vocab rows keep the partitioned-table semantics of lookup_kernel: the shard offset is subtracted,
+ * out-of-range rows write zero and perTokenScales (if given) rescales quantized weights.
+ */
+template <typename Tout, typename Tin, typename Idx>
+__global__ void fused_gather_lookup_kernel(Tout* output, int32_t const* sources, Idx const* rows,
+    Tin const* vocabWeight, Tout const* promptTable, Tout const* mmFeatures, int64_t const token_num, Idx const offset,
+    Idx const size, Idx const n_embed, Tout const* perTokenScales)
+{
+    for (int64_t index = blockIdx.x * blockDim.x + threadIdx.x; index < token_num * n_embed;
+         index += blockDim.x * gridDim.x)
+    {
+        int64_t const token_index = index / n_embed;
+        Idx const col_index = index % n_embed;
+        auto const source = static_cast<EmbeddingGatherSource>(sources[token_index]);
+        Tout embedding;
+        if (source == EmbeddingGatherSource::kVOCAB)
+        {
+            int64_t const word_index = rows[token_index] - offset;
+            if (word_index < 0 || word_index >= size)
+            {
+                embedding = Tout(0.f);
+            }
+            else
+            {
+                embedding = (Tout) vocabWeight[word_index * n_embed + col_index];
+                if (perTokenScales != nullptr)
+                {
+                    embedding *= perTokenScales[word_index];
+                }
+            }
+        }
+        else
+        {
+            Tout const* table = source == EmbeddingGatherSource::kPROMPT ? promptTable : mmFeatures;
+            embedding = table[static_cast<int64_t>(rows[token_index]) * n_embed + col_index];
+        }
+        output[index] = embedding;
+    } // end for index
+}
+
+template <typename Tout, typename Tin, typename Idx>
+void invokeFusedGatherLookUp(Tout* out, int32_t const* sources, Idx const* rows, Tin const* vocabWeight,
+    Tout const* promptTable, Tout const* mmFeatures, int64_t const token_num, Idx const offset, Idx const size,
+    Idx const n_embed, Tout const* perTokenScales, cudaStream_t stream)
+{
+    int64_t constexpr max_block_num = 65536;
+    Idx constexpr max_block_size = 512;
+    dim3 grid(min(token_num, max_block_num));
+    dim3 block(min(n_embed, max_block_size));
+    fused_gather_lookup_kernel<Tout, Tin, Idx><<<grid, block, 0, stream>>>(
+        out, sources, rows, vocabWeight, promptTable, mmFeatures, token_num, offset, size, n_embed, perTokenScales);
+}
+
+#define INSTANTIATE_FUSED_GATHER_LOOK_UP(Tout, Tin, Idx)                                                               \
+    template void invokeFusedGatherLookUp<Tout, Tin, Idx>(Tout * out, int32_t const* sources, Idx const* rows,         \
+        Tin const* vocabWeight, Tout const* promptTable, Tout const* mmFeatures, int64_t const token_num,              \
+        Idx const offset, Idx const size, Idx const n_embed, Tout const* perTokenScales, cudaStream_t stream)
+
+INSTANTIATE_FUSED_GATHER_LOOK_UP(float, float, int);
+INSTANTIATE_FUSED_GATHER_LOOK_UP(float, int8_t, int);
+INSTANTIATE_FUSED_GATHER_LOOK_UP(half, half, int);
+INSTANTIATE_FUSED_GATHER_LOOK_UP(half, int8_t, int);
+
+#ifdef ENABLE_BF16
+INSTANTIATE_FUSED_GATHER_LOOK_UP(__nv_bfloat16, __nv_bfloat16, int);
+INSTANTIATE_FUSED_GATHER_LOOK_UP(__nv_bfloat16, int8_t, int);
+#endif
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
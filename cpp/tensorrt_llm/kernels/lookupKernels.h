@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,24 @@ template <typename Tout, typename Tin, typename Idx>
 void invokeLookUp(Tout* out, Idx const* input, Tin const* weight, int64_t const token_num, Idx const offset,
     Idx const size, Idx const n_embed, Tout const* perTokenScales, cudaStream_t stream = 0);
 
+// Identifies which table a token's packed input embedding row is gathered from.
+enum class EmbeddingGatherSource : int32_t
+{
+    kVOCAB = 0,      // (possibly partitioned) vocab embedding table, row index shifted by the shard offset
+    kPROMPT = 1,     // prompt-tuning table entries packed for the batch
+    kMULTIMODAL = 2, // multimodal feature rows packed for the batch
+};
+
+// Fused gather over the vocab embedding table, prompt-tuning table and packed multimodal features.
+// Every token carries a (source, row) descriptor so the packed input embedding is written in a
+// single pass instead of gathering each source separately and merging with select/scatter passes.
+// Vocab rows follow the same partitioned-table semantics as invokeLookUp (offset/size/perTokenScales,
+// out-of-range rows write zero); prompt and multimodal rows are read in the output type.
+template <typename Tout, typename Tin, typename Idx>
+void invokeFusedGatherLookUp(Tout* out, int32_t const* sources, Idx const* rows, Tin const* vocabWeight,
+    Tout const* promptTable, Tout const* mmFeatures, int64_t const token_num, Idx const offset, Idx const size,
+    Idx const n_embed, Tout const* perTokenScales, cudaStream_t stream = 0);
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
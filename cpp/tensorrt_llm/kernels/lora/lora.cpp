@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2024 NVIDIA CORPORATION &
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION &
  * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,12 +19,15 @@
 #include "tensorrt_llm/common/config.h"
 
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/memoryUtils.h"
 #include "tensorrt_llm/kernels/groupGemm.h"
 #include "tensorrt_llm/kernels/lora/lora.h"
+#include "tensorrt_llm/kernels/lora/loraRowReorder.h"
 #include "tensorrt_llm/kernels/splitkGroupGemm.h"
 #include "tensorrt_llm/runtime/iBuffer.h"
 
 #include <algorithm>
+#include <numeric>
 #include <utility>
 
 TRTLLM_NAMESPACE_BEGIN
@@ -120,15 +123,25 @@ int64_t getGemmWorkSpaceSize(int64_t numTokens, int64_t maxLoraModuleNum, int64_
         getSplitkGroupedGemmWorkSpaceSize(numTokens, maxLoraModuleNum, maxLowRank, splitKSlices));
 }
 
+int64_t getRowReorderWorkSpaceSize(int64_t numTokens, int64_t inHiddenSize, int64_t sumOutHiddenSize, int64_t typeSize)
+{
+    // Sorted row ids, the adapter-sorted copy of the input, and the adapter-sorted outputs of all modules.
+    return common::divUp(numTokens * (int64_t) sizeof(int32_t), 16) * 16
+        + common::divUp(numTokens * inHiddenSize * typeSize, 16) * 16
+        + common::divUp(numTokens * sumOutHiddenSize * typeSize, 16) * 16;
+}
+
 size_t LoraImpl::getWorkspaceSize(
     int64_t const numTokens, int64_t const numReqs, nvinfer1::DataType const type) const noexcept
 {
     TLLM_LOG_DEBUG("%s", __PRETTY_FUNCTION__);
     auto const typeSize = tensorrt_llm::common::getDTypeSize(type);
+    auto const sumOutHiddenSize = std::accumulate(mOutHiddenSizes.cbegin(), mOutHiddenSizes.cend(), int64_t{0});
 
     return (size_t) getGemmWorkSpaceSize(numTokens, mNumLoraModules, mMaxLowRank, mSplitKSlices)
         + getLowRankWorkSpaceSize(numTokens, mNumLoraModules, mMaxLowRank, typeSize)
-        + getGemmParamsWorkSpaceSize(std::min(numReqs, numTokens) * mNumLoraModules);
+        + getGemmParamsWorkSpaceSize(std::min(numReqs, numTokens) * mNumLoraModules)
+        + getRowReorderWorkSpaceSize(numTokens, mInHiddenSize, sumOutHiddenSize, typeSize);
 }
 
 void LoraImpl::setBestTactic(std::optional<Config> config)
@@ -251,69 +264,211 @@ int LoraImpl::run(int64_t numTokens, int64_t numReqs, void const* input, int32_t
         std::vector<void*> ptrD_2;
         ptrD_2.reserve(numTokens * mNumLoraModules);
 
-        int minKN = mInHiddenSize; // Used to determine the alignment size
-        for (int loraModuleIdx = 0; loraModuleIdx < mNumLoraModules; loraModuleIdx++)
+        // Rows share an adapter group iff their weights pointers and rank match for every module, so the
+        // grouping is identical across modules and is computed once. When rows of the same adapter are
+        // scattered through the batch (common for mixed-adapter decode batches), gather them into adapter
+        // order first so that each distinct adapter forms a single GEMM group instead of one small group
+        // per contiguous run.
+        auto const rowsShareAdapter = [&](int lhsRow, int rhsRow)
         {
-            auto const* loraWeightsPtrModule
-                = reinterpret_cast<int64_t const*>(&loraWeightsPtr[loraModuleIdx * numTokens * 2]);
-            int32_t const* loraRanksModule = &loraRanks[loraModuleIdx * numTokens];
+            for (int loraModuleIdx = 0; loraModuleIdx < mNumLoraModules; loraModuleIdx++)
+            {
+                auto const* loraWeightsPtrModule
+                    = reinterpret_cast<int64_t const*>(&loraWeightsPtr[loraModuleIdx * numTokens * 2]);
+                int32_t const* loraRanksModule = &loraRanks[loraModuleIdx * numTokens];
+                if (loraWeightsPtrModule[lhsRow * 2] != loraWeightsPtrModule[rhsRow * 2]
+                    || loraWeightsPtrModule[lhsRow * 2 + 1] != loraWeightsPtrModule[rhsRow * 2 + 1]
+                    || loraRanksModule[lhsRow] != loraRanksModule[rhsRow])
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
 
-            // The following loop aggregates the contiguous requests that use the same LoRA weights to reduce
-            // the problem_size of grouped GEMMs and increase the M dimension of those GEMMs.
-            int rowId = 0;
-            int handled_token_num = 0;
-            while (rowId < numTokens)
+        std::vector<int> rowGroupIds(numTokens);
+        std::vector<int> groupFirstRow;
+        groupFirstRow.reserve(std::min(numReqs, numTokens));
+        int numRuns = 0;
+        for (int rowId = 0; rowId < numTokens; rowId++)
+        {
+            int groupId = -1;
+            if (rowId > 0 && rowsShareAdapter(rowId, rowId - 1))
+            {
+                groupId = rowGroupIds[rowId - 1];
+            }
+            else
             {
-                auto const lora_rank = loraRanksModule[rowId];
-                auto const N = lora_rank;
-                int count = 0;
-                size_t M = 0;
-                while (rowId + count < numTokens && lora_rank == loraRanksModule[rowId + count]
-                    && loraWeightsPtrModule[rowId * 2] == loraWeightsPtrModule[(rowId + count) * 2]
-                    && loraWeightsPtrModule[rowId * 2 + 1] == loraWeightsPtrModule[(rowId + count) * 2 + 1])
+                numRuns++;
+                for (int g = 0; g < static_cast<int>(groupFirstRow.size()); g++)
+                {
+                    if (rowsShareAdapter(rowId, groupFirstRow[g]))
+                    {
+                        groupId = g;
+                        break;
+                    }
+                }
+                if (groupId < 0)
                 {
-                    M += 1;
-                    count++;
+                    groupId = static_cast<int>(groupFirstRow.size());
+                    groupFirstRow.push_back(rowId);
                 }
+            }
+            rowGroupIds[rowId] = groupId;
+        }
+        int const numGroups = static_cast<int>(groupFirstRow.size());
+        // Reordering costs one gather of the input and one scatter per module output, so only take it when
+        // it actually merges groups; rows already clustered by adapter keep the zero-copy in-place path.
+        bool const useRowReorder = numRuns > numGroups;
+
+        int32_t* sortedRowIdsDevice = nullptr;
+        char* reorderedOutput = nullptr;
 
-                if (N > 0)
+        int minKN = mInHiddenSize; // Used to determine the alignment size
+        if (useRowReorder)
+        {
+            char* rowReorderWorkSpace = static_cast<char*>(groupGemmParamsWorkSpace) + groupGemmParamsWorkSpaceSize;
+            sortedRowIdsDevice = reinterpret_cast<int32_t*>(rowReorderWorkSpace);
+            char* reorderedInput = rowReorderWorkSpace + common::divUp(numTokens * (int64_t) sizeof(int32_t), 16) * 16;
+            reorderedOutput = reorderedInput + common::divUp(numTokens * mInHiddenSize * typeSize, 16) * 16;
+
+            // Stable counting sort of the rows by group: rows of one adapter become contiguous while the
+            // original order within each adapter is preserved.
+            std::vector<int64_t> groupOffsets(numGroups + 1, 0);
+            for (int rowId = 0; rowId < numTokens; rowId++)
+            {
+                groupOffsets[rowGroupIds[rowId] + 1]++;
+            }
+            std::partial_sum(groupOffsets.cbegin(), groupOffsets.cend(), groupOffsets.begin());
+            std::vector<int32_t> sortedRowIds(numTokens);
+            auto groupCursors = groupOffsets;
+            for (int rowId = 0; rowId < numTokens; rowId++)
+            {
+                sortedRowIds[groupCursors[rowGroupIds[rowId]]++] = rowId;
+            }
+            common::cudaAutoCpy(reinterpret_cast<int8_t*>(sortedRowIdsDevice),
+                reinterpret_cast<int8_t const*>(sortedRowIds.data()), numTokens * sizeof(int32_t), stream);
+            invokeLoraRowGather(reorderedInput, input, sortedRowIdsDevice, numTokens, mInHiddenSize * typeSize, stream);
+            sync_check_cuda_error(stream);
+
+            // Rows of rank-0 groups are never touched by the GEMMs; zero the sorted outputs so that the
+            // scatter below writes zeros back for them.
+            auto const sumOutHiddenSize = std::accumulate(mOutHiddenSizes.cbegin(), mOutHiddenSizes.cend(), int64_t{0});
+            cudaMemsetAsync(reorderedOutput, 0, numTokens * sumOutHiddenSize * typeSize, stream);
+
+            int64_t moduleOutOffset = 0;
+            for (int loraModuleIdx = 0; loraModuleIdx < mNumLoraModules; loraModuleIdx++)
+            {
+                auto const* loraWeightsPtrModule
+                    = reinterpret_cast<int64_t const*>(&loraWeightsPtr[loraModuleIdx * numTokens * 2]);
+                int32_t const* loraRanksModule = &loraRanks[loraModuleIdx * numTokens];
+                auto const N2 = mOutHiddenSizes[loraModuleIdx];
+                for (int groupId = 0; groupId < numGroups; groupId++)
                 {
-                    TLLM_CHECK_WITH_INFO(N <= mMaxLowRank,
-
-                        "Invalid low_rank (%d). low_rank must be smaller than mMaxLowRank (%d)", N, mMaxLowRank);
-
-                    auto const K = mInHiddenSize;
-                    minKN = std::min(minKN, N);
-                    minKN = std::min(minKN, K);
-
-                    cutlass::gemm::GemmCoord problem(M, N, K);
-                    problem_sizes.push_back(problem);
-
-                    ptrA.push_back(static_cast<void*>(
-                        static_cast<char*>(const_cast<void*>(input)) + handled_token_num * K * typeSize));
-                    ptrB.push_back(
-                        reinterpret_cast<void*>(loraWeightsPtrModule[rowId * 2] + K * N * typeSize * weightIndex));
-                    ptrC.push_back(static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
-                        + (loraModuleIdx * numTokens * mMaxLowRank + handled_token_num * mMaxLowRank) * typeSize));
-                    ptrD.push_back(static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
-                        + (loraModuleIdx * numTokens * mMaxLowRank + handled_token_num * mMaxLowRank) * typeSize));
-
-                    auto const N2 = mOutHiddenSizes[loraModuleIdx];
-                    cutlass::gemm::GemmCoord problem_2(M, N2, N); // token_num, module_output_size, lora_rank
-                    problem_sizes_2.push_back(problem_2);
-                    ptrA_2.push_back(static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
-                        + (loraModuleIdx * numTokens * mMaxLowRank + handled_token_num * mMaxLowRank) * typeSize));
-                    ptrB_2.push_back(
-                        reinterpret_cast<void*>(loraWeightsPtrModule[rowId * 2 + 1] + N2 * N * typeSize * weightIndex));
-                    ptrC_2.push_back(static_cast<void*>(
-                        static_cast<char*>(outputs[loraModuleIdx]) + handled_token_num * N2 * typeSize));
-                    ptrD_2.push_back(static_cast<void*>(
-                        static_cast<char*>(outputs[loraModuleIdx]) + handled_token_num * N2 * typeSize));
+                    auto const firstRow = groupFirstRow[groupId];
+                    auto const N = loraRanksModule[firstRow];
+                    if (N > 0)
+                    {
+                        TLLM_CHECK_WITH_INFO(N <= mMaxLowRank,
+                            "Invalid low_rank (%d). low_rank must be smaller than mMaxLowRank (%d)", N, mMaxLowRank);
+
+                        auto const K = mInHiddenSize;
+                        minKN = std::min(minKN, N);
+                        minKN = std::min(minKN, K);
+
+                        auto const rowOffset = groupOffsets[groupId];
+                        auto const M = static_cast<int>(groupOffsets[groupId + 1] - rowOffset);
+
+                        cutlass::gemm::GemmCoord problem(M, N, K);
+                        problem_sizes.push_back(problem);
+
+                        ptrA.push_back(static_cast<void*>(reorderedInput + rowOffset * K * typeSize));
+                        ptrB.push_back(reinterpret_cast<void*>(
+                            loraWeightsPtrModule[firstRow * 2] + K * N * typeSize * weightIndex));
+                        auto* lowRank = static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
+                            + (loraModuleIdx * numTokens * mMaxLowRank + rowOffset * mMaxLowRank) * typeSize);
+                        ptrC.push_back(lowRank);
+                        ptrD.push_back(lowRank);
+
+                        cutlass::gemm::GemmCoord problem_2(M, N2, N); // token_num, module_output_size, lora_rank
+                        problem_sizes_2.push_back(problem_2);
+                        ptrA_2.push_back(lowRank);
+                        ptrB_2.push_back(reinterpret_cast<void*>(
+                            loraWeightsPtrModule[firstRow * 2 + 1] + N2 * N * typeSize * weightIndex));
+                        auto* sortedOut
+                            = static_cast<void*>(reorderedOutput + (moduleOutOffset + rowOffset * N2) * typeSize);
+                        ptrC_2.push_back(sortedOut);
+                        ptrD_2.push_back(sortedOut);
+                    }
                 }
-                handled_token_num += M;
-                rowId += count;
+                moduleOutOffset += numTokens * N2;
+            }
+        }
+        else
+        {
+            for (int loraModuleIdx = 0; loraModuleIdx < mNumLoraModules; loraModuleIdx++)
+            {
+                auto const* loraWeightsPtrModule
+                    = reinterpret_cast<int64_t const*>(&loraWeightsPtr[loraModuleIdx * numTokens * 2]);
+                int32_t const* loraRanksModule = &loraRanks[loraModuleIdx * numTokens];
+
+                // The following loop aggregates the contiguous requests that use the same LoRA weights to reduce
+                // the problem_size of grouped GEMMs and increase the M dimension of those GEMMs.
+                int rowId = 0;
+                int handled_token_num = 0;
+                while (rowId < numTokens)
+                {
+                    auto const lora_rank = loraRanksModule[rowId];
+                    auto const N = lora_rank;
+                    int count = 0;
+                    size_t M = 0;
+                    while (rowId + count < numTokens && lora_rank == loraRanksModule[rowId + count]
+                        && loraWeightsPtrModule[rowId * 2] == loraWeightsPtrModule[(rowId + count) * 2]
+                        && loraWeightsPtrModule[rowId * 2 + 1] == loraWeightsPtrModule[(rowId + count) * 2 + 1])
+                    {
+                        M += 1;
+                        count++;
+                    }
+
+                    if (N > 0)
+                    {
+                        TLLM_CHECK_WITH_INFO(N <= mMaxLowRank,
+
+                            "Invalid low_rank (%d). low_rank must be smaller than mMaxLowRank (%d)", N, mMaxLowRank);
+
+                        auto const K = mInHiddenSize;
+                        minKN = std::min(minKN, N);
+                        minKN = std::min(minKN, K);
+
+                        cutlass::gemm::GemmCoord problem(M, N, K);
+                        problem_sizes.push_back(problem);
+
+                        ptrA.push_back(static_cast<void*>(
+                            static_cast<char*>(const_cast<void*>(input)) + handled_token_num * K * typeSize));
+                        ptrB.push_back(
+                            reinterpret_cast<void*>(loraWeightsPtrModule[rowId * 2] + K * N * typeSize * weightIndex));
+                        ptrC.push_back(static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
+                            + (loraModuleIdx * numTokens * mMaxLowRank + handled_token_num * mMaxLowRank) * typeSize));
+                        ptrD.push_back(static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
+                            + (loraModuleIdx * numTokens * mMaxLowRank + handled_token_num * mMaxLowRank) * typeSize));
+
+                        auto const N2 = mOutHiddenSizes[loraModuleIdx];
+                        cutlass::gemm::GemmCoord problem_2(M, N2, N); // token_num, module_output_size, lora_rank
+                        problem_sizes_2.push_back(problem_2);
+                        ptrA_2.push_back(static_cast<void*>(static_cast<char*>(lowRankWorkSpace)
+                            + (loraModuleIdx * numTokens * mMaxLowRank + handled_token_num * mMaxLowRank) * typeSize));
+                        ptrB_2.push_back(reinterpret_cast<void*>(
+                            loraWeightsPtrModule[rowId * 2 + 1] + N2 * N * typeSize * weightIndex));
+                        ptrC_2.push_back(static_cast<void*>(
+                            static_cast<char*>(outputs[loraModuleIdx]) + handled_token_num * N2 * typeSize));
+                        ptrD_2.push_back(static_cast<void*>(
+                            static_cast<char*>(outputs[loraModuleIdx]) + handled_token_num * N2 * typeSize));
+                    }
+                    handled_token_num += M;
+                    rowId += count;
+                }
+                TLLM_CHECK(handled_token_num == numTokens);
             }
-            TLLM_CHECK(handled_token_num == numTokens);
         }
         if (problem_sizes.size() > 0)
         {
@@ -330,6 +485,19 @@ int LoraImpl::run(int64_t numTokens, int64_t numReqs, void const* input, int32_t
                 groupGemmParamsWorkSpaceSize, gemmWorkSpace, GemmWorkSpaceSize, false, mType, minKN, stream);
             sync_check_cuda_error(stream);
         }
+        if (useRowReorder)
+        {
+            // Scatter each module's adapter-sorted output back to the original row order.
+            int64_t moduleOutOffset = 0;
+            for (int loraModuleIdx = 0; loraModuleIdx < mNumLoraModules; loraModuleIdx++)
+            {
+                auto const N2 = mOutHiddenSizes[loraModuleIdx];
+                invokeLoraRowScatter(outputs[loraModuleIdx], reorderedOutput + moduleOutOffset * typeSize,
+                    sortedRowIdsDevice, numTokens, N2 * typeSize, stream);
+                moduleOutOffset += numTokens * N2;
+            }
+            sync_check_cuda_error(stream);
+        }
     }
 
     return 0;
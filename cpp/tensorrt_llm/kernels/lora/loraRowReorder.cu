@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loraRowReorder.h"
+
+#include "tensorrt_llm/common/cudaUtils.h"
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+namespace
+{
+
+int constexpr kThreadsPerBlock = 256;
+
+// One block per row; each thread copies a strided slice of the row. TVec is uint4 when the row
+// size permits 16B vectorized accesses and uint8_t otherwise.
+template <typename TVec, bool kGather>
+__global__ void loraRowReorderKernel(
+    uint8_t* dst, uint8_t const* src, int32_t const* sortedRowIds, int64_t rowBytes)
+{
+    auto const row = static_cast<int64_t>(blockIdx.x);
+    auto const srcRow = kGather ? static_cast<int64_t>(sortedRowIds[row]) : row;
+    auto const dstRow = kGather ? row : static_cast<int64_t>(sortedRowIds[row]);
+    auto const* srcPtr = reinterpret_cast<TVec const*>(src + srcRow * rowBytes);
+    auto* dstPtr = reinterpret_cast<TVec*>(dst + dstRow * rowBytes);
+    auto const numVecs = rowBytes / static_cast<int64_t>(sizeof(TVec));
+    for (auto i = static_cast<int64_t>(threadIdx.x); i < numVecs; i += blockDim.x)
+    {
+        dstPtr[i] = srcPtr[i];
+    }
+}
+
+template <bool kGather>
+void invokeLoraRowReorder(
+    void* dst, void const* src, int32_t const* sortedRowIds, int64_t numRows, int64_t rowBytes, cudaStream_t stream)
+{
+    if (numRows == 0 || rowBytes == 0)
+    {
+        return;
+    }
+    auto* dstBytes = reinterpret_cast<uint8_t*>(dst);
+    auto const* srcBytes = reinterpret_cast<uint8_t const*>(src);
+    if (rowBytes % 16 == 0)
+    {
+        loraRowReorderKernel<uint4, kGather>
+            <<<numRows, kThreadsPerBlock, 0, stream>>>(dstBytes, srcBytes, sortedRowIds, rowBytes);
+    }
+    else
+    {
+        loraRowReorderKernel<uint8_t, kGather>
+            <<<numRows, kThreadsPerBlock, 0, stream>>>(dstBytes, srcBytes, sortedRowIds, rowBytes);
+    }
+}
+
+} // namespace
+
+void invokeLoraRowGather(
+    void* dst, void const* src, int32_t const* sortedRowIds, int64_t numRows, int64_t rowBytes, cudaStream_t stream)
+{
+    invokeLoraRowReorder<true>(dst, src, sortedRowIds, numRows, rowBytes, stream);
+}
+
+void invokeLoraRowScatter(
+    void* dst, void const* src, int32_t const* sortedRowIds, int64_t numRows, int64_t rowBytes, cudaStream_t stream)
+{
+    invokeLoraRowReorder<false>(dst, src, sortedRowIds, numRows, rowBytes, stream);
+}
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/config.h"
+#include <cstdint>
+#include <cuda_runtime.h>
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+
+/**
+ * @brief Gather matrix rows into adapter-sorted order: dst[i] = src[sortedRowIds[i]].
+ *
+ * Used by the LoRA grouped GEMM path to make rows that share an adapter contiguous, so each
+ * distinct adapter forms a single GEMM group regardless of how requests are interleaved.
+ *
+ * @param dst Output: [numRows, rowBytes] reordered matrix
+ * @param src Input: [numRows, rowBytes] original matrix
+ * @param sortedRowIds Input: [numRows] source row index per destination row, on device
+ * @param numRows Number of rows
+ * @param rowBytes Size of one row in bytes
+ * @param stream CUDA stream
+ */
+void invokeLoraRowGather(
+    void* dst, void const* src, int32_t const* sortedRowIds, int64_t numRows, int64_t rowBytes, cudaStream_t stream);
+
+/**
+ * @brief Scatter matrix rows back to their original order: dst[sortedRowIds[i]] = src[i].
+ *
+ * Inverse of invokeLoraRowGather, applied to the grouped GEMM outputs.
+ *
+ * @param dst Output: [numRows, rowBytes] matrix in original row order
+ * @param src Input: [numRows, rowBytes] matrix in adapter-sorted order
+ * @param sortedRowIds Input: [numRows] destination row index per source row, on device
+ * @param numRows Number of rows
+ * @param rowBytes Size of one row in bytes
+ * @param stream CUDA stream
+ */
+void invokeLoraRowScatter(
+    void* dst, void const* src, int32_t const* sortedRowIds, int64_t numRows, int64_t rowBytes, cudaStream_t stream);
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mamba2MTPStateRestore.h"
+#include "tensorrt_llm/common/assert.h"
+
+#include <algorithm>
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+
+namespace
+{
+
+int constexpr kRestoreBlockThreads = 256;
+
+template <typename VecT>
+__global__ void mamba2MTPStateRestoreKernel(Mamba2MTPStateRestoreParams params)
+{
+    int const seq = blockIdx.y;
+    int const layer = blockIdx.z;
+
+    int const dstSlot = params.dst_indices[seq];
+    int const srcSlot = params.src_indices[seq];
+    int const step = params.accepted_steps[seq];
+    if (dstSlot < 0 || srcSlot < 0 || step < 0)
+    {
+        // Padded sequence, nothing to restore.
+        return;
+    }
+
+    auto const srcOffset
+        = ((static_cast<int64_t>(layer) * params.src_slots + srcSlot) * params.cache_steps + step) * params.state_bytes;
+    auto const dstOffset = (static_cast<int64_t>(layer) * params.dst_slots + dstSlot) * params.state_bytes;
+    auto const* src = reinterpret_cast<VecT const*>(static_cast<char const*>(params.src_states) + srcOffset);
+    auto* dst = reinterpret_cast<VecT*>(static_cast<char*>(params.dst_states) + dstOffset);
+
+    auto const numVecs = params.state_bytes / static_cast<int64_t>(sizeof(VecT));
+    for (int64_t i = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x; i < numVecs;
+         i += static_cast<int64_t>(gridDim.x) * blockDim.x)
+    {
+        dst[i] = src[i];
+    }
+}
+
+template <typename VecT>
+void launchRestore(Mamba2MTPStateRestoreParams const& params, cudaStream_t stream)
+{
+    auto const numVecs = params.state_bytes / static_cast<int64_t>(sizeof(VecT));
+    auto const blocksPerState
+        = static_cast<int>(std::min<int64_t>((numVecs + kRestoreBlockThreads - 1) / kRestoreBlockThreads, 64));
+    dim3 grid(blocksPerState, params.num_seqs, params.num_layers);
+    dim3 block(kRestoreBlockThreads);
+    mamba2MTPStateRestoreKernel<VecT><<<grid, block, 0, stream>>>(params);
+}
+
+} // namespace
+
+void invokeMamba2MTPStateRestore(Mamba2MTPStateRestoreParams const& params, cudaStream_t stream)
+{
+    if (params.num_seqs == 0 || params.num_layers == 0)
+    {
+        return;
+    }
+    TLLM_CHECK_WITH_INFO(params.state_bytes > 0, "state_bytes must be positive");
+
+    if (params.state_bytes % sizeof(uint4) == 0)
+    {
+        launchRestore<uint4>(params, stream);
+    }
+    else if (params.state_bytes % sizeof(uint32_t) == 0)
+    {
+        launchRestore<uint32_t>(params, stream);
+    }
+    else
+    {
+        launchRestore<uint8_t>(params, stream);
+    }
+}
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
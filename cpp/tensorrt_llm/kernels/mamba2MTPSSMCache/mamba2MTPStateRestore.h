@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include <cstdint>
+#include <cuda_runtime.h>
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace kernels
+{
+
+//! Parameters for restoring per-draft-position state checkpoints after target model verification.
+//!
+//! The MTP SSM cache update kernel checkpoints the state after every draft position into
+//! intermediate_states. When a draft is partially rejected, the state at the last accepted position
+//! is copied back into the main state cache for all layers in one launch, so rollback is O(1)
+//! instead of recomputing the SSM scan.
+struct Mamba2MTPStateRestoreParams
+{
+    void* dst_states;       // [num_layers, dst_slots, state_elems]
+    void const* src_states; // [num_layers, src_slots, cache_steps, state_elems]
+
+    int32_t const* dst_indices;    // [num_seqs] slot in dst_states per sequence
+    int32_t const* src_indices;    // [num_seqs] slot in src_states per sequence
+    int32_t const* accepted_steps; // [num_seqs] checkpoint position of the last accepted token
+
+    int num_layers;
+    int num_seqs;
+    int dst_slots;
+    int src_slots;
+    int cache_steps;
+    int64_t state_bytes; // contiguous bytes per state
+};
+
+void invokeMamba2MTPStateRestore(Mamba2MTPStateRestoreParams const& params, cudaStream_t stream);
+
+} // namespace kernels
+
+TRTLLM_NAMESPACE_END
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -184,11 +184,21 @@ inline __device__ void dequantCopy(
     }
 }
 
+// Block roles along gridDim.z for the fused context kernel: [0, head_num) applies RoPE,
+// the next kKVAppendBlocksPerBatch blocks append the compressed latent to the KV cache, and (when the
+// FP8 quant buffers are set) the remaining kQuantBlocksPerBatch blocks quantize the nope/v dimensions
+// of the separate q/k/v FMHA inputs so no second kernel launch is needed.
+static constexpr int kKVAppendBlocksPerBatch = 8;
+static constexpr int kQuantBlocksPerBatch = 8;
+
 template <typename T, int BLOCK_SIZE, int K_DIM, int ROPE_DIM, typename KVCacheBuffer>
-__global__ void applyMLARopeAndAssignQKVKernelOptContext(T* q_ptr, T* q_pe, T* k_ptr, T const* fuse_buf,
-    KVCacheBuffer kv_cache, int q_pe_ld, int q_pe_stride, float2 const* cos_sin_cache, size_t head_num, int head_size,
-    int c_k, int* cu_q_seqlens, int32_t const* kv_cache_lengths, uint32_t max_input_seq_len, KvCacheDataType cache_type,
-    float const* quant_scale_kv, int32_t const* helix_position_offsets, bool absorption_mode)
+__global__ void applyMLARopeAndAssignQKVKernelOptContext(T* q_ptr, T* q_pe, T* k_ptr, T const* v_buf,
+    T const* fuse_buf, KVCacheBuffer kv_cache, void* quant_q_buf, void* quant_k_buf, void* quant_v_buf, int q_pe_ld,
+    int q_pe_stride, float2 const* cos_sin_cache, size_t head_num, int head_size, int c_k, int* cu_q_seqlens,
+    int32_t const* kv_cache_lengths, uint32_t max_input_seq_len, KvCacheDataType cache_type,
+    float const* quant_scale_kv, float const* quant_scale_qkv, float* bmm1_scale, float* bmm2_scale,
+    float const* quant_scale_o, float const* dequant_scale_q, float const* dequant_scale_kv, float host_bmm1_scale,
+    int total_q_len, int total_kv_len, int32_t const* helix_position_offsets, bool absorption_mode)
 {
 
     // Constants.
@@ -223,6 +233,7 @@ __global__ void applyMLARopeAndAssignQKVKernelOptContext(T* q_ptr, T* q_pe, T* k
         size_t const seq_len_loop_end
             = size_t((max_input_seq_len + TOKENS_PER_BLOCK - 1) / TOKENS_PER_BLOCK) * TOKENS_PER_BLOCK;
         float quant_scale_kv_val = quant_scale_kv ? quant_scale_kv[0] : 1.f;
+        float quant_scale_qkv_val = quant_scale_qkv ? quant_scale_qkv[0] : 1.f;
 
         // Mainloop.
         for (int local_token_idx = (threadIdx.x / VECS_PER_HEAD) + blockIdx.x * TOKENS_PER_BLOCK;
@@ -298,17 +309,29 @@ __global__ void applyMLARopeAndAssignQKVKernelOptContext(T* q_ptr, T* q_pe, T* k
                 auto const dst_k_idx = static_cast<size_t>(global_token_idx) * head_num * (head_size + ROPE_DIM)
                     + head_idx * (head_size + ROPE_DIM) + head_size + head_dim_idx;
                 reinterpret_cast<VecT*>(q_ptr)[dst_q_idx / ELTS_PER_VEC] = q;
+                // Quantize the freshly roped rope dims straight from registers; the quant blocks below
+                // only cover the nope/v dims, which do not depend on this kernel's own writes.
+                if (quant_q_buf != nullptr)
+                {
+                    quantCopy<T, ELTS_PER_VEC>(static_cast<__nv_fp8_e4m3*>(quant_q_buf) + dst_q_idx,
+                        reinterpret_cast<T const*>(&q), quant_scale_qkv_val);
+                }
                 // Only write to k_pe to k_buf in the non-absorption mode.
                 if (!absorption_mode)
                 {
                     reinterpret_cast<VecT*>(k_ptr)[dst_k_idx / ELTS_PER_VEC] = k;
+                    if (quant_k_buf != nullptr)
+                    {
+                        quantCopy<T, ELTS_PER_VEC>(static_cast<__nv_fp8_e4m3*>(quant_k_buf) + dst_k_idx,
+                            reinterpret_cast<T const*>(&k), quant_scale_qkv_val);
+                    }
                 }
             }
         }
     }
-    else
+    else if (head_idx < head_num + kKVAppendBlocksPerBatch)
     {
-        int block_dim = gridDim.z - head_num;
+        int block_dim = kKVAppendBlocksPerBatch;
         int block_id = head_idx - head_num;
         size_t const head_dim_vec_idx = (threadIdx.x % K_VECS_PER_HEAD);
         size_t const head_dim_idx = head_dim_vec_idx * ELTS_PER_VEC;
@@ -358,6 +381,87 @@ __global__ void applyMLARopeAndAssignQKVKernelOptContext(T* q_ptr, T* q_pe, T* k
             }
         }
     }
+    else if (quant_q_buf != nullptr)
+    {
+        // Dedicated quantization blocks: convert the nope (and v) dims of the separate q/k/v FMHA
+        // inputs to FP8. They only read tensors produced before this launch; the rope dims are
+        // quantized in-register by the rope blocks above, so no second kernel launch is needed.
+        int const quant_block_id = head_idx - head_num - kKVAppendBlocksPerBatch;
+        size_t const block_linear
+            = (static_cast<size_t>(quant_block_id) * gridDim.y + blockIdx.y) * gridDim.x + blockIdx.x;
+        size_t const thread_linear = block_linear * BLOCK_SIZE + threadIdx.x;
+        size_t const thread_stride = static_cast<size_t>(kQuantBlocksPerBatch) * gridDim.y * gridDim.x * BLOCK_SIZE;
+        float const quant_scale_qkv_val = quant_scale_qkv ? quant_scale_qkv[0] : 1.f;
+
+        if (thread_linear == 0)
+        {
+            // Calculate bmm scales for FP8 MLA (kept in sync with quantizeCopyInputToFp8Kernel).
+            float dequant_scale_q_val = dequant_scale_q ? dequant_scale_q[0] : 1.f;
+            float dequant_scale_kv_val = dequant_scale_kv ? dequant_scale_kv[0] : 1.f;
+            float quant_scale_o_val = quant_scale_o ? quant_scale_o[0] : 1.f;
+            if (bmm1_scale)
+            {
+                // The scale prepared for log2 optimization.
+                constexpr float kLog2e = 1.4426950408889634074f;
+                // The scale after fmha bmm1.
+                float bmm1_scale_val = dequant_scale_q_val * dequant_scale_kv_val * host_bmm1_scale;
+                bmm1_scale[0] = bmm1_scale_val;
+                bmm1_scale[1] = bmm1_scale_val * kLog2e;
+            }
+            if (bmm2_scale)
+            {
+                // The scale after fmha bmm2.
+                bmm2_scale[0] = quant_scale_o_val * dequant_scale_kv_val;
+            }
+        }
+
+        // Q: [total_q_len, head_num * (nope + rope)], src and dst share the layout.
+        size_t const q_row_dim = static_cast<size_t>(nope_head_size_q) + ROPE_DIM;
+        size_t const total_q_vecs = static_cast<size_t>(total_q_len) * head_num * q_row_dim / ELTS_PER_VEC;
+        for (size_t vec_idx = thread_linear; vec_idx < total_q_vecs; vec_idx += thread_stride)
+        {
+            size_t const elt_idx = vec_idx * ELTS_PER_VEC;
+            if (static_cast<int>(elt_idx % q_row_dim) < nope_head_size_q)
+            {
+                quantCopy<T, ELTS_PER_VEC>(
+                    static_cast<__nv_fp8_e4m3*>(quant_q_buf) + elt_idx, q_ptr + elt_idx, quant_scale_qkv_val);
+            }
+        }
+
+        if (!absorption_mode && quant_k_buf != nullptr)
+        {
+            // K: [total_kv_len, head_num * (nope + rope)], src and dst share the layout.
+            size_t const k_row_dim = static_cast<size_t>(head_size) + ROPE_DIM;
+            size_t const total_k_vecs = static_cast<size_t>(total_kv_len) * head_num * k_row_dim / ELTS_PER_VEC;
+            for (size_t vec_idx = thread_linear; vec_idx < total_k_vecs; vec_idx += thread_stride)
+            {
+                size_t const elt_idx = vec_idx * ELTS_PER_VEC;
+                if (static_cast<int>(elt_idx % k_row_dim) < head_size)
+                {
+                    quantCopy<T, ELTS_PER_VEC>(
+                        static_cast<__nv_fp8_e4m3*>(quant_k_buf) + elt_idx, k_ptr + elt_idx, quant_scale_qkv_val);
+                }
+            }
+        }
+
+        if (!absorption_mode && quant_v_buf != nullptr)
+        {
+            // V: dst [total_kv_len, head_num * d_v] is contiguous, src rows are strided by
+            // head_num * (d_nope + d_v) with d_v == d_nope for the supported MLA configs.
+            size_t const v_head_dim = static_cast<size_t>(head_size);
+            size_t const dst_row_dim = head_num * v_head_dim;
+            size_t const src_row_dim = head_num * (static_cast<size_t>(head_size) + v_head_dim);
+            size_t const total_v_vecs = static_cast<size_t>(total_kv_len) * dst_row_dim / ELTS_PER_VEC;
+            for (size_t vec_idx = thread_linear; vec_idx < total_v_vecs; vec_idx += thread_stride)
+            {
+                size_t const elt_idx = vec_idx * ELTS_PER_VEC;
+                size_t const token_idx = elt_idx / dst_row_dim;
+                size_t const row_offset = elt_idx % dst_row_dim;
+                quantCopy<T, ELTS_PER_VEC>(static_cast<__nv_fp8_e4m3*>(quant_v_buf) + elt_idx,
+                    v_buf + token_idx * src_row_dim + row_offset, quant_scale_qkv_val);
+            }
+        }
+    }
 }
 
 template <typename T, int BLOCK_SIZE, int K_DIM, int ROPE_DIM, typename KVCacheBuffer>
@@ -966,15 +1070,28 @@ __global__ void quantizeCopyInputToFp8Kernel(T const* q_buf, __nv_fp8_e4m3* quan
 }
 
 template <typename T, typename KVCacheBuffer>
-void invokeMLARopeContext(MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, cudaStream_t stream)
+void invokeMLARopeContext(MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, int total_kv_len, cudaStream_t stream)
 {
-    dim3 grid(int(tensorrt_llm::common::divUp(params.max_input_seq_len, 32)), params.batch_size, params.head_num + 8);
+    // Fuse the FP8 quantization of the separate q/k/v FMHA inputs into this launch when this kernel
+    // produces all the rope dims the quantization depends on. With reused (chunked) kv, k_buf holds
+    // rows this kernel does not touch, so the standalone quantization pass below still covers them.
+    bool const fuse_quant = params.cache_type == KvCacheDataType::FP8 && params.quant_q_buf != nullptr
+        && (params.absorption_mode || total_kv_len == params.acc_q_len);
+    dim3 grid(int(tensorrt_llm::common::divUp(params.max_input_seq_len, 32)), params.batch_size,
+        params.head_num + kKVAppendBlocksPerBatch + (fuse_quant ? kQuantBlocksPerBatch : 0));
     auto head_size = params.meta.qk_nope_head_dim;
     applyMLARopeAndAssignQKVKernelOptContext<T, 256, 512, 64, KVCacheBuffer><<<grid, 256, 0, stream>>>(params.q_buf,
-        params.q_pe, params.k_buf, params.latent_cache, kv_cache_buffer, params.q_pe_ld, params.q_pe_stride,
-        params.cos_sin_cache, params.head_num, head_size, params.meta.kv_lora_rank, params.cu_q_seqlens,
-        params.cache_seq_lens, params.max_input_seq_len, params.cache_type, params.quant_scale_kv,
-        params.helix_position_offsets, params.absorption_mode);
+        params.q_pe, params.k_buf, params.v_buf, params.latent_cache, kv_cache_buffer,
+        fuse_quant ? params.quant_q_buf : nullptr, fuse_quant ? params.quant_k_buf : nullptr,
+        fuse_quant ? params.quant_v_buf : nullptr, params.q_pe_ld, params.q_pe_stride, params.cos_sin_cache,
+        params.head_num, head_size, params.meta.kv_lora_rank, params.cu_q_seqlens, params.cache_seq_lens,
+        params.max_input_seq_len, params.cache_type, params.quant_scale_kv, params.quant_scale_qkv, params.bmm1_scale,
+        params.bmm2_scale, params.quant_scale_o, params.dequant_scale_q, params.dequant_scale_kv,
+        params.host_bmm1_scale, params.acc_q_len, total_kv_len, params.helix_position_offsets, params.absorption_mode);
+    if (!fuse_quant && params.cache_type == KvCacheDataType::FP8 && params.quant_q_buf != nullptr)
+    {
+        invokeMLAContextFp8Quantize(params, total_kv_len, stream);
+    }
 }
 
 template <typename T>
@@ -1104,7 +1221,8 @@ void invokeMLARopeAppendPagedKVAssignQ(KVBlockArray& kv_cache, T* q_ptr, T* late
 }
 
 #define INSTANTIATE_MLA_ROPE(T, KVCacheBuffer)                                                                         \
-    template void invokeMLARopeContext(MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, cudaStream_t stream);      \
+    template void invokeMLARopeContext(                                                                                \
+        MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, int total_kv_len, cudaStream_t stream);                   \
     template void invokeMLARopeGeneration(MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, cudaStream_t stream);
 
 INSTANTIATE_MLA_ROPE(float, KVBlockArray);
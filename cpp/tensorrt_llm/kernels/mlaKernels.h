@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -118,8 +118,11 @@ struct MlaParams
     bool const* helix_is_inactive_rank{nullptr};
 };
 
+// Applies RoPE, appends the compressed latent to the KV cache and, when the FP8 quant buffers are
+// set and all rope dims are produced in this chunk, also quantizes the separate q/k/v FMHA inputs in
+// the same launch (falling back to invokeMLAContextFp8Quantize otherwise).
 template <typename T, typename KVCacheBuffer>
-void invokeMLARopeContext(MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, cudaStream_t stream);
+void invokeMLARopeContext(MlaParams<T>& params, KVCacheBuffer kv_cache_buffer, int total_kv_len, cudaStream_t stream);
 
 template <typename T>
 void invokeMLAContextFp8Quantize(MlaParams<T>& params, int total_kv_len, cudaStream_t stream);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -224,11 +224,6 @@ void invokeMoeAlignBlockSizeTyped(scalar_t const* topk_ids, int32_t* sorted_toke
     // BlockScan uses 1024 threads and assigns one thread per expert.
     TLLM_CHECK_WITH_INFO(padded_num_experts < 1024, "padded_num_experts must be less than 1024");
 
-    // Allocate temporary cumsum buffer
-    int32_t* cumsum_buffer;
-    cudaMallocAsync(&cumsum_buffer, (num_experts + 1) * sizeof(int32_t), stream);
-    cudaMemsetAsync(cumsum_buffer, 0, (num_experts + 1) * sizeof(int32_t), stream);
-
     bool small_batch_expert_mode = (numel < 1024) && (num_experts <= 64);
 
     if (small_batch_expert_mode)
@@ -241,6 +236,12 @@ void invokeMoeAlignBlockSizeTyped(scalar_t const* topk_ids, int32_t* sorted_toke
     }
     else
     {
+        // The temporary cumsum buffer is only needed on this path; the small-batch kernel keeps its
+        // counts entirely in shared memory.
+        int32_t* cumsum_buffer;
+        TLLM_CUDA_CHECK(cudaMallocAsync(&cumsum_buffer, (num_experts + 1) * sizeof(int32_t), stream));
+        TLLM_CUDA_CHECK(cudaMemsetAsync(cumsum_buffer, 0, (num_experts + 1) * sizeof(int32_t), stream));
+
         size_t num_warps = CEILDIV(padded_num_experts, experts_per_warp);
         size_t shared_mem_size = num_warps * experts_per_warp * sizeof(int32_t);
 
@@ -255,9 +256,9 @@ void invokeMoeAlignBlockSizeTyped(scalar_t const* topk_ids, int32_t* sorted_toke
 
         count_and_sort_expert_tokens_kernel<scalar_t>
             <<<actual_blocks, block_threads, 0, stream>>>(topk_ids, sorted_token_ids, cumsum_buffer, numel);
-    }
 
-    cudaFreeAsync(cumsum_buffer, stream);
+        TLLM_CUDA_CHECK(cudaFreeAsync(cumsum_buffer, stream));
+    }
 }
 
 void invokeMoeAlignBlockSize(void const* topk_ids, int32_t topk_ids_dtype_size, int32_t* sorted_token_ids,
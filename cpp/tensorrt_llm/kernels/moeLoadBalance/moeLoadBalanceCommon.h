@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -64,8 +64,10 @@ struct MoeLoadBalanceStatisticInfo
 
     // rawDataWindowSize means the size of the raw data window.
     // e.g. how many steps of raw data are kept in the memory.
-    // current we keep only the data in current iteration, previous should sum to expertLoadFactor.
-    static constexpr int rawDataWindowSize = 1;
+    // expertTokenCount is a ring of per-iteration histograms: slot 0 holds the current iteration,
+    // older iterations slide towards higher slots; data older than the window sums (with decay)
+    // into expertLoadFactor.
+    int rawDataWindowSize = 1;
 
     // decayFactor means the decay factor of the raw data per step.
     // e.g. if decayFactor is 0.95, then the raw data of expert i will be decayed by 0.95 for each step.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -252,7 +252,9 @@ void moeStatisticDevice(MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatistic
             threadCount /= 2;
             kernelFunc = shiftWindowKernel<int2>;
         }
-        dim3 gridDim(statisticInfo.rawDataWindowSize + 1);
+        // One block per window slot: block 0 zeroes the newest slot, block i copies slot i-1 into
+        // slot i. Data in the oldest slot is dropped; it was already folded into expertLoadFactor.
+        dim3 gridDim(statisticInfo.rawDataWindowSize);
         dim3 blockDim(threadCount);
         int* expertTokenCount = statisticInfo.expertTokenCount;
         void* args[]
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #include "tensorrt_llm/common/config.h"
 #include "tensorrt_llm/common/logger.h"
 
+#include "tensorrt_llm/common/cudaTypeUtils.cuh"
 #include "tensorrt_llm/common/reduceKernelUtils.cuh"
 #include "tensorrt_llm/kernels/decodingCommon.h"
 #include "tensorrt_llm/kernels/penaltyKernels.h"
@@ -265,6 +266,89 @@ template void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<float> const
 
 template void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<half> const& params);
 
+template <typename T>
+__global__ void batchApplyTemperatureBias(T const* const* inputLogits, T* outputLogits, T const* biases,
+    float const* temperatures, SizeType32 vocabSize, SizeType32 vocabSizePadded, SizeType32 const* batchSlots,
+    SizeType32 const* tokensPerStep, FinishedState const* finished)
+{
+    using PackedT = typename packed_as<T, 2>::type;
+
+    auto const beamWidth = static_cast<SizeType32>(gridDim.y);
+    auto const maxTokensPerStep = static_cast<SizeType32>(gridDim.z);
+    auto const batchIdx = static_cast<SizeType32>(blockIdx.x);
+    auto const beamIdx = static_cast<SizeType32>(blockIdx.y);
+    auto const stepIdx = static_cast<SizeType32>(blockIdx.z);
+    auto const batchSlot = batchSlots[batchIdx];
+
+    FinishedState const finishState = finished != nullptr ? finished[batchSlot] : FinishedState::empty();
+    if (finishState.isSkipDecoding())
+    {
+        return;
+    }
+    if (tokensPerStep != nullptr && stepIdx >= tokensPerStep[batchSlot])
+    {
+        return;
+    }
+
+    float invTemperature{1.0f};
+    if (temperatures != nullptr)
+    {
+        float const temperature = temperatures[batchSlot];
+        if (!almostEqual(temperature, layers::DefaultDecodingParams::getTemperature(), 1e-9))
+        {
+            invTemperature = 1.0f / (temperature + 1e-6f);
+        }
+    }
+
+    auto const batchBeamStepIdx = (batchIdx * beamWidth + beamIdx) * maxTokensPerStep + stepIdx;
+    auto const* inLogitsPtr = inputLogits[batchIdx] + (beamIdx * maxTokensPerStep + stepIdx) * vocabSizePadded;
+    auto* outLogitsPtr = outputLogits + batchBeamStepIdx * vocabSizePadded;
+    float const maskVal = (std::is_same<T, half>::value) ? -HALF_FLT_MAX : -FLT_MAX;
+
+    auto const* inPacked = reinterpret_cast<PackedT const*>(inLogitsPtr);
+    auto* outPacked = reinterpret_cast<PackedT*>(outLogitsPtr);
+    auto const* biasPacked
+        = biases != nullptr ? reinterpret_cast<PackedT const*>(biases + batchSlot * vocabSizePadded) : nullptr;
+    for (auto packedIdx = static_cast<SizeType32>(threadIdx.x); packedIdx < vocabSizePadded / 2;
+         packedIdx += static_cast<SizeType32>(blockDim.x))
+    {
+        auto logit2 = cuda_cast<float2>(inPacked[packedIdx]);
+        if (biasPacked != nullptr)
+        {
+            logit2 = logit2 + cuda_cast<float2>(biasPacked[packedIdx]);
+        }
+        logit2 = logit2 * invTemperature;
+        // Clamp to prevent overflow and mask the padded part of the vocabulary.
+        logit2.x = fminf(fmaxf(logit2.x, maskVal), -maskVal);
+        logit2.y = fminf(fmaxf(logit2.y, maskVal), -maskVal);
+        if (2 * packedIdx >= vocabSize)
+        {
+            logit2.x = maskVal;
+        }
+        if (2 * packedIdx + 1 >= vocabSize)
+        {
+            logit2.y = maskVal;
+        }
+        outPacked[packedIdx] = cuda_cast<PackedT>(logit2);
+    }
+}
+
+template <typename T>
+void invokeBatchApplyTemperatureBias(InvokeBatchApplyPenaltyParams<T> const& params)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    TLLM_CHECK_WITH_INFO(params.vocabSizePadded % 2 == 0, "vocabSizePadded must be even for the vectorized fast path");
+    dim3 block(512);
+    dim3 grid(params.batchSize, params.beamWidth, params.maxTokensPerStep);
+    batchApplyTemperatureBias<T><<<grid, block, 0, params.stream>>>(params.inputLogits, params.outputLogits,
+        params.biases, params.temperatures, params.vocabSize, params.vocabSizePadded, params.batchSlots,
+        params.tokensPerStep, params.finished);
+}
+
+template void invokeBatchApplyTemperatureBias(InvokeBatchApplyPenaltyParams<float> const& params);
+
+template void invokeBatchApplyTemperatureBias(InvokeBatchApplyPenaltyParams<half> const& params);
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
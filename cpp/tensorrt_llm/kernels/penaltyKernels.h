@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -60,6 +60,14 @@ struct InvokeBatchApplyPenaltyParams
 template <typename T>
 void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<T> const& params);
 
+//! \brief Fast path of invokeBatchApplyPenalty for requests without occurrence penalties and min length.
+//! Applies per-slot temperature and static logit bias in a single vectorized pass over the logits, which is
+//! noticeably faster than the generic penalty kernel for large vocabularies. Only params.inputLogits,
+//! params.outputLogits, params.biases, params.temperatures, params.batchSlots, params.tokensPerStep, params.finished
+//! and the size fields are read. Requires params.vocabSizePadded to be even.
+template <typename T>
+void invokeBatchApplyTemperatureBias(InvokeBatchApplyPenaltyParams<T> const& params);
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -25,6 +25,7 @@
 #endif
 
 #include "tensorrt_llm/common/config.h"
+#include "tensorrt_llm/common/cudaFp8Utils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
 #include "tensorrt_llm/common/reduceKernelUtils.cuh"
@@ -38,13 +39,32 @@ TRTLLM_NAMESPACE_BEGIN
 namespace kernels
 {
 
+//! Arithmetic type used for comparing and accumulating logits of storage type T. FP8 logits
+//! are widened to float on load: the conversion is exact, and ties between logits quantized
+//! to the same FP8 value are broken deterministically towards the lowest token id by
+//! TopK_2::insert, so the selected candidate set only depends on the quantized input.
+template <typename T>
+struct TopKComputeT
+{
+    using type = T;
+};
+
+#ifdef ENABLE_FP8
+template <>
+struct TopKComputeT<__nv_fp8_e4m3>
+{
+    using type = float;
+};
+#endif
+
 template <typename T, int32_t BLOCK_SIZE_, int32_t BLOCKS_PER_BEAM_>
 __global__ void topKStage1(T const* __restrict logProbs, T const* const* __restrict logProbsPtrs, T* tmpLogProbs,
     SizeType32* topKTmpIdBuf, T* topKTmpValBuf, FinishedState const* finished, SizeType32 maxTopK,
     SizeType32 const* topKs, SizeType32 vocabSize, TokenIdType const* endIds, bool const* skipDecode,
     SizeType32 const* batchSlots, SizeType32 const* tokensPerStep, SizeType32 maxTokensPerStep)
 {
-    typedef cub::BlockReduce<TopK_2<T>, BLOCK_SIZE_> BlockReduce;
+    using TComp = typename TopKComputeT<T>::type;
+    typedef cub::BlockReduce<TopK_2<TComp>, BLOCK_SIZE_> BlockReduce;
     __shared__ typename BlockReduce::TempStorage tempStorage;
 
     auto const tid = static_cast<SizeType32>(threadIdx.x);
@@ -74,9 +94,9 @@ __global__ void topKStage1(T const* __restrict logProbs, T const* const* __restr
     auto const tmpTopKBufIndex = batchId * maxTokensPerStep * BLOCKS_PER_BEAM_ * maxTopK
         + tokenIdx * BLOCKS_PER_BEAM_ * maxTopK + blockLane * k;
 
-    TopK_2<T> partial;
-    bool const IS_FP16 = std::is_same<T, half>::value;
-    T const MAX_T_VAL = (IS_FP16) ? HALF_FLT_MAX : FLT_MAX;
+    TopK_2<TComp> partial;
+    bool const IS_FP16 = std::is_same<TComp, half>::value;
+    TComp const MAX_T_VAL = (IS_FP16) ? HALF_FLT_MAX : FLT_MAX;
 
     if (finished != nullptr && finishState.isFinished())
     {
@@ -93,7 +113,8 @@ __global__ void topKStage1(T const* __restrict logProbs, T const* const* __restr
             else
             {
                 topKTmpIdBuf[index] = -1;
-                topKTmpValBuf[index] = -MAX_T_VAL;
+                // For FP8, -MAX_T_VAL saturates to the lowest finite FP8 value.
+                topKTmpValBuf[index] = static_cast<T>(-MAX_T_VAL);
             }
         }
         return;
@@ -112,19 +133,19 @@ __global__ void topKStage1(T const* __restrict logProbs, T const* const* __restr
         for (auto elemId = tid + blockLane * BLOCK_SIZE_; elemId < vocabSize; elemId += BLOCK_SIZE_ * BLOCKS_PER_BEAM_)
         {
             auto index = elemId + tmpLogBufIndex;
-            partial.insert(tmpLogProbs[index], index);
+            partial.insert(static_cast<TComp>(tmpLogProbs[index]), index);
         }
 
-        TopK_2<T> total = BlockReduce(tempStorage).Reduce(partial, reduce_topk_op_2<T>);
+        TopK_2<TComp> total = BlockReduce(tempStorage).Reduce(partial, reduce_topk_op_2<TComp>);
 
         if (tid == 0)
         {
             auto const index = tmpTopKBufIndex + ite;
             topKTmpIdBuf[index] = total.p;
-            topKTmpValBuf[index] = total.u;
+            topKTmpValBuf[index] = static_cast<T>(total.u);
             if (total.p >= 0)
             {
-                tmpLogProbs[total.p] = -MAX_T_VAL;
+                tmpLogProbs[total.p] = static_cast<T>(-MAX_T_VAL);
             }
         }
         __syncthreads();
@@ -141,8 +162,9 @@ __global__ void topKStage2Sampling(SizeType32 const* __restrict topKTmpIdBuf, T*
     bool returnAllSelectedTokensFlag, bool strictTopPBoundary, bool const* returnAllSelectedTokensPerSlot,
     TokenIdType* outputIdCurrentStep, bool const* skipOutputIdCurrentStep)
 {
-    bool const IS_FP16 = std::is_same<T, half>::value;
-    T const MAX_T_VAL = (IS_FP16) ? HALF_FLT_MAX : FLT_MAX;
+    using TComp = typename TopKComputeT<T>::type;
+    bool const IS_FP16 = std::is_same<TComp, half>::value;
+    TComp const MAX_T_VAL = (IS_FP16) ? HALF_FLT_MAX : FLT_MAX;
 
     auto const tid = static_cast<SizeType32>(threadIdx.x);
     auto const batchIdx = static_cast<SizeType32>(blockIdx.x);
@@ -209,7 +231,7 @@ __global__ void topKStage2Sampling(SizeType32 const* __restrict topKTmpIdBuf, T*
                 maxLogit = total.u;
             }
             sId[ite] = total.p;
-            sVal[total.p] = -MAX_T_VAL;
+            sVal[total.p] = static_cast<T>(-MAX_T_VAL);
 
             // when cumLogProbs are computed, topKTmpValBuf (logits_buf_) are
             // already pre-processed by softmax_kernel
@@ -414,6 +436,10 @@ template void invokeBatchTopKSampling(TopKSamplingKernelParams<float> const& par
 
 template void invokeBatchTopKSampling(TopKSamplingKernelParams<half> const& params, cudaStream_t stream);
 
+#ifdef ENABLE_FP8
+template void invokeBatchTopKSampling(TopKSamplingKernelParams<__nv_fp8_e4m3> const& params, cudaStream_t stream);
+#endif
+
 __global__ void setupTopKRuntimeArgs(SizeType32 batchSize, ScatterDecodingParamEntry<SizeType32> topK,
     ScatterDecodingParamEntry<float> topP, SizeType32 const* batchSlots, bool* skipDecode)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -178,6 +178,9 @@ struct TopKSamplingKernelParams
 //! Sampling per request can be controlled using skipDecode, topPs and topKs parameters.
 //! Function sets workspaceSize and exits early if workspace is nullptr.
 //! If logits are Nan, we set output token to be the last in the vocabulary.
+//! With ENABLE_FP8, T=__nv_fp8_e4m3 is supported: candidate selection compares the quantized logits exactly
+//! (ties broken towards the lowest token id) and the softmax over the selected candidates is computed in float,
+//! halving the vocab-sized logits traffic relative to FP16.
 // clang-format on
 template <typename T>
 void invokeBatchTopKSampling(TopKSamplingKernelParams<T> const& params, cudaStream_t stream);
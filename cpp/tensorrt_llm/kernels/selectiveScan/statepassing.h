@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -127,13 +127,42 @@ __global__ std::enable_if_t<std::is_same_v<Tp_, half> || std::is_same_v<Tp_, __n
 
     Tp_ r_mxOs[tileH_ / (warpH_ * 32)] = {0};
     float r_mxSt[tileH_ / (warpH_ * 32)] = {0};
+    float r_mxCur[tileH_ / (warpH_ * 32)] = {0};
+    float r_mxNxt[tileH_ / (warpH_ * 32)] = {0};
+    float r_dACur = 0.f;
+    float r_dANxt = 0.f;
 
-    for (int iC = 0; iC < C.var; iC++)
+    auto loadChunk = [&](int iC, float* dst, float& dA)
     {
-        Tp_* g_mxOs = (Tp_*) g_mxOs_ + int64_t(get(cStart + Rn<>{iC})) * get(H * N * P);
         float const* g_mxSt = (float const*) g_mxSt_ + int64_t(get(cStart + Rn<>{iC})) * get(H * N * P);
         float const* g_mxdA = (float const*) g_mxdA_ + int64_t(get(cStart + Rn<>{iC})) * get(H * Q);
 
+        dA = g_mxdA[get(hStart * Q + Q - cn<1>)];
+
+#pragma unroll
+        for (int i = 0; i < tileH_ / (warpH_ * 32); i++)
+            dst[i] = g_mxSt[get(blockIdx_x * cn<tileH_>
+                + (threadIdx_y * cn<32> + threadIdx_x) * cn<tileH_ / (warpH_ * 32)> + Rn<UNROLL>{i})];
+    };
+
+    // Software pipeline the sequential inter-chunk fixup: prefetch chunk iC+1's local state and
+    // dA into registers while chunk iC's running state is scaled and accumulated, so the chain
+    // is not serialized on global memory latency.
+    if (C.var > 0)
+        loadChunk(0, r_mxNxt, r_dANxt);
+
+    for (int iC = 0; iC < C.var; iC++)
+    {
+        Tp_* g_mxOs = (Tp_*) g_mxOs_ + int64_t(get(cStart + Rn<>{iC})) * get(H * N * P);
+
+#pragma unroll
+        for (int i = 0; i < tileH_ / (warpH_ * 32); i++)
+            r_mxCur[i] = r_mxNxt[i];
+        r_dACur = r_dANxt;
+
+        if (iC + 1 < C.var)
+            loadChunk(iC + 1, r_mxNxt, r_dANxt);
+
         if (std::is_same_v<Tp_, half>)
 #pragma unroll
             for (int i = 0; i < tileH_ / (warpH_ * 32); i += 2)
@@ -165,15 +194,12 @@ __global__ std::enable_if_t<std::is_same_v<Tp_, half> || std::is_same_v<Tp_, __n
                         + Rn<UNROLL>{i}))
                     = *(int*) &r_mxOs[i];
 
-        float scale = expf(g_mxdA[get(hStart * Q + Q - cn<1>)]);
+        float scale = expf(r_dACur);
 
 #pragma unroll
         for (int i = 0; i < tileH_ / (warpH_ * 32); i++)
         {
-            float tmp = g_mxSt[get(blockIdx_x * cn<tileH_>
-                + (threadIdx_y * cn<32> + threadIdx_x) * cn<tileH_ / (warpH_ * 32)> + Rn<UNROLL>{i})];
-
-            r_mxSt[i] = scale * r_mxSt[i] + tmp;
+            r_mxSt[i] = scale * r_mxSt[i] + r_mxCur[i];
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -69,10 +69,17 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel(std::array<KVCacheB
     for (SizeType32 startChannelOffset = 0; startChannelOffset < eltCountPerHead; startChannelOffset += eltCountPerMove)
     {
         SizeType32 eltCountCurrentMove = min(eltCountPerMove, eltCountPerHead - startChannelOffset);
+        // Tokens whose accepted position equals their compacted position need no movement. This makes
+        // acceptance free of data movement in the common case where the principal chain of the draft
+        // tree is accepted and the accepted tokens already form the leftmost prefix.
         // load K
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
             auto const tokenPos = packedAcceptedDraftTokensIndices[seqDraftTokenStart + tokenIdx];
+            if (tokenPos == tokenIdx)
+            {
+                continue;
+            }
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenIdx * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
             auto* kPtr = reinterpret_cast<MoveEltType*>(kvCacheBuffer.getKBlockPtr(seqSlot, tokenKVPosition));
@@ -88,6 +95,10 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel(std::array<KVCacheB
         // store K
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
+            if (packedAcceptedDraftTokensIndices[seqDraftTokenStart + tokenIdx] == tokenIdx)
+            {
+                continue;
+            }
             auto const tokenPos = tokenIdx;
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenIdx * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
@@ -105,6 +116,10 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel(std::array<KVCacheB
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
             auto const tokenPos = packedAcceptedDraftTokensIndices[seqDraftTokenStart + tokenIdx];
+            if (tokenPos == tokenIdx)
+            {
+                continue;
+            }
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenIdx * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
             auto* vPtr = reinterpret_cast<MoveEltType*>(kvCacheBuffer.getVBlockPtr(seqSlot, tokenKVPosition));
@@ -120,6 +135,10 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel(std::array<KVCacheB
         // store V
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
+            if (packedAcceptedDraftTokensIndices[seqDraftTokenStart + tokenIdx] == tokenIdx)
+            {
+                continue;
+            }
             auto const tokenPos = tokenIdx;
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenPos * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
@@ -178,11 +197,17 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel2D(std::array<KVCach
     for (SizeType32 startChannelOffset = 0; startChannelOffset < eltCountPerHead; startChannelOffset += eltCountPerMove)
     {
         SizeType32 eltCountCurrentMove = min(eltCountPerMove, eltCountPerHead - startChannelOffset);
+        // As in the packed kernel above, skip tokens that are already at their compacted position so
+        // that accepting the principal chain of the draft tree moves no data.
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
             // Clamp negative indices (e.g. -1 fill during CUDA graph warmup) to 0
             // to prevent OOB access. Correctness is N/A for warmup data.
             auto const tokenPos = max(acceptedDraftTokensIndices2D[seqRow + tokenIdx], 0);
+            if (tokenPos == tokenIdx)
+            {
+                continue;
+            }
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenIdx * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
             auto* kPtr = reinterpret_cast<MoveEltType*>(kvCacheBuffer.getKBlockPtr(seqSlot, tokenKVPosition));
@@ -197,6 +222,10 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel2D(std::array<KVCach
         __syncthreads();
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
+            if (max(acceptedDraftTokensIndices2D[seqRow + tokenIdx], 0) == tokenIdx)
+            {
+                continue;
+            }
             auto const tokenPos = tokenIdx;
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenIdx * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
@@ -213,6 +242,10 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel2D(std::array<KVCach
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
             auto const tokenPos = max(acceptedDraftTokensIndices2D[seqRow + tokenIdx], 0);
+            if (tokenPos == tokenIdx)
+            {
+                continue;
+            }
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenIdx * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
             auto* vPtr = reinterpret_cast<MoveEltType*>(kvCacheBuffer.getVBlockPtr(seqSlot, tokenKVPosition));
@@ -227,6 +260,10 @@ __global__ void updateKVCacheDraftTokenLocationBatchedKernel2D(std::array<KVCach
         __syncthreads();
         for (SizeType32 tokenIdx = warpIdx; tokenIdx < seqDraftCount; tokenIdx += warpCount)
         {
+            if (max(acceptedDraftTokensIndices2D[seqRow + tokenIdx], 0) == tokenIdx)
+            {
+                continue;
+            }
             auto const tokenPos = tokenIdx;
             auto* tokenSmemBuffer = eltLoadSmemBuffer + tokenPos * eltCountCurrentMove;
             auto const tokenKVPosition = tokenStartIdx + tokenPos;
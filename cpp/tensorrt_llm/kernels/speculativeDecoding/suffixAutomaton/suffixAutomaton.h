@@ -462,6 +462,21 @@ struct SuffixAutomaton
             buf[i] = +mTokens.at(TextIndex(+startPos + i));
         }
     }
+
+    /**
+     * Strided variant of getDraftTokens for cooperative emission: lane `laneIdx` of `laneCount`
+     * copies every laneCount-th token. All lanes must pass the same bufLen and startPos.
+     */
+    SA_CUDA_CALLABLE void getDraftTokensStrided(
+        Token::ValueType* buf, int bufLen, TextIndex startPos, int laneIdx, int laneCount) const
+    {
+        int availableLen = +mTokens.size() - +startPos;
+        bufLen = (bufLen < availableLen) ? bufLen : availableLen;
+        for (int i = laneIdx; i < bufLen; i += laneCount)
+        {
+            buf[i] = +mTokens.at(TextIndex(+startPos + i));
+        }
+    }
 };
 
 static_assert(std::is_trivially_copyable<SuffixAutomaton>::value, "SuffixAutomaton must be trivially copyable");
@@ -32,12 +32,6 @@ __global__ void suffixAutomatonExtendKernel(int batchSize, int draftLength, int
     void* slotsMemory, int const* batchIndices, int* matchLenOut, int* draftTokensOut, int const* acceptedTokensIn,
     int const* acceptedLensIn)
 {
-    // Only one thread per block does the work
-    if (threadIdx.x > 0)
-    {
-        return;
-    }
-
     int i = blockIdx.x;
     if (i >= batchSize)
     {
@@ -51,26 +45,38 @@ __global__ void suffixAutomatonExtendKernel(int batchSize, int draftLength, int
     uint8_t* slotMemory = static_cast<uint8_t*>(slotsMemory) + static_cast<size_t>(batchIndex) * stateSize;
     SuffixAutomaton* slot = reinterpret_cast<SuffixAutomaton*>(slotMemory);
 
-    int numNewTokens = acceptedLensIn[i];
-    // Bounds check: numNewTokens must be in valid range to prevent out-of-bounds access
-    assert(numNewTokens >= 0 && numNewTokens <= draftLength + 1);
-
-    // Extend the automaton with accepted tokens
-    for (int j = 0; j < numNewTokens; j++)
+    // Extension and lookup are inherently serial, so lane 0 does them and broadcasts the match;
+    // the whole warp then emits the draft tokens cooperatively.
+    int matchPos = -1;
+    if (threadIdx.x == 0)
     {
-        slot->extend(Token(acceptedTokensIn[i * (draftLength + 1) + j]));
-    }
+        int numNewTokens = acceptedLensIn[i];
+        // Bounds check: numNewTokens must be in valid range to prevent out-of-bounds access
+        assert(numNewTokens >= 0 && numNewTokens <= draftLength + 1);
 
-    // Lookup the longest suffix match
-    auto result = slot->lookup();
-    if (result.hasValue())
-    {
-        matchLenOut[i] = result->len;
-        slot->getDraftTokens(&draftTokensOut[i * draftLength], draftLength, result->pos);
+        // Extend the automaton with accepted tokens
+        for (int j = 0; j < numNewTokens; j++)
+        {
+            slot->extend(Token(acceptedTokensIn[i * (draftLength + 1) + j]));
+        }
+
+        // Lookup the longest suffix match
+        auto result = slot->lookup();
+        if (result.hasValue())
+        {
+            matchLenOut[i] = result->len;
+            matchPos = +result->pos;
+        }
+        else
+        {
+            matchLenOut[i] = 0;
+        }
     }
-    else
+    matchPos = __shfl_sync(0xffffffff, matchPos, 0);
+    if (matchPos >= 0)
     {
-        matchLenOut[i] = 0;
+        slot->getDraftTokensStrided(
+            &draftTokensOut[i * draftLength], draftLength, TextIndex(matchPos), threadIdx.x, blockDim.x);
     }
 }
 
@@ -87,8 +93,8 @@ void invokeSuffixAutomatonExtend(SuffixAutomatonExtendParams const& params, cuda
 
     size_t stateSize = getSuffixAutomatonStateSize(params.maxSeqLen);
 
-    // Launch one block per sequence, one thread per block
-    suffixAutomatonExtendKernel<<<batchSize, 1, 0, stream>>>(batchSize, params.draftLength, maxSlots, stateSize,
+    // Launch one block per sequence, one warp per block for cooperative draft token emission
+    suffixAutomatonExtendKernel<<<batchSize, 32, 0, stream>>>(batchSize, params.draftLength, maxSlots, stateSize,
         params.slots, params.batchIndices, params.matchLenOut, params.draftTokensOut, params.acceptedTokensIn,
         params.acceptedLensIn);
 }
@@ -97,12 +103,6 @@ __global__ void suffixAutomatonExtendNgramKernel(int batchSize, int draftLength,
     size_t stateSize, void* slotsMemory, int const* batchIndices, int* matchLenOut, int* draftTokensOut,
     int const* acceptedTokensIn, int const* acceptedLensIn)
 {
-    // Only one thread per block does the work
-    if (threadIdx.x > 0)
-    {
-        return;
-    }
-
     int i = blockIdx.x;
     if (i >= batchSize)
     {
@@ -116,45 +116,57 @@ __global__ void suffixAutomatonExtendNgramKernel(int batchSize, int draftLength,
     uint8_t* slotMemory = static_cast<uint8_t*>(slotsMemory) + static_cast<size_t>(batchIndex) * stateSize;
     SuffixAutomaton* slot = reinterpret_cast<SuffixAutomaton*>(slotMemory);
 
-    int numNewTokens = acceptedLensIn[i];
-    // Bounds check: numNewTokens must be in valid range to prevent out-of-bounds access
-    assert(numNewTokens >= 0 && numNewTokens <= draftLength + 1);
-
-    // Extend the automaton with accepted tokens
-    for (int j = 0; j < numNewTokens; j++)
+    // Extension and lookup are inherently serial, so lane 0 does them and broadcasts the match;
+    // the whole warp then emits the draft tokens cooperatively.
+    int matchPos = -1;
+    if (threadIdx.x == 0)
     {
-        slot->extend(Token(acceptedTokensIn[i * (draftLength + 1) + j]));
-    }
+        int numNewTokens = acceptedLensIn[i];
+        // Bounds check: numNewTokens must be in valid range to prevent out-of-bounds access
+        assert(numNewTokens >= 0 && numNewTokens <= draftLength + 1);
+
+        // Extend the automaton with accepted tokens
+        for (int j = 0; j < numNewTokens; j++)
+        {
+            slot->extend(Token(acceptedTokensIn[i * (draftLength + 1) + j]));
+        }
 
-    // Perform lookup based on maxNgramSize
-    SAOptional<SuffixAutomaton::LookupResult> result;
+        // Perform lookup based on maxNgramSize
+        SAOptional<SuffixAutomaton::LookupResult> result;
 
-    if (maxNgramSize == -1)
-    {
-        // Longest match mode
-        result = slot->lookup();
-    }
-    else
-    {
-        // Fixed-size ngram mode - try sizes from maxNgramSize down to 1
-        for (int size = maxNgramSize; size >= 1; size--)
+        if (maxNgramSize == -1)
+        {
+            // Longest match mode
+            result = slot->lookup();
+        }
+        else
         {
-            result = slot->lookupFixed(size);
-            if (result.hasValue())
+            // Fixed-size ngram mode - try sizes from maxNgramSize down to 1
+            for (int size = maxNgramSize; size >= 1; size--)
             {
-                break;
+                result = slot->lookupFixed(size);
+                if (result.hasValue())
+                {
+                    break;
+                }
             }
         }
-    }
 
-    if (result.hasValue())
-    {
-        matchLenOut[i] = result->len;
-        slot->getDraftTokens(&draftTokensOut[i * draftLength], draftLength, result->pos);
+        if (result.hasValue())
+        {
+            matchLenOut[i] = result->len;
+            matchPos = +result->pos;
+        }
+        else
+        {
+            matchLenOut[i] = 0;
+        }
     }
-    else
+    matchPos = __shfl_sync(0xffffffff, matchPos, 0);
+    if (matchPos >= 0)
     {
-        matchLenOut[i] = 0;
+        slot->getDraftTokensStrided(
+            &draftTokensOut[i * draftLength], draftLength, TextIndex(matchPos), threadIdx.x, blockDim.x);
     }
 }
 
@@ -171,8 +183,8 @@ void invokeSuffixAutomatonExtendNgram(SuffixAutomatonExtendNgramParams const& pa
 
     size_t stateSize = getSuffixAutomatonStateSize(params.maxSeqLen);
 
-    // Launch one block per sequence, one thread per block
-    suffixAutomatonExtendNgramKernel<<<batchSize, 1, 0, stream>>>(batchSize, params.draftLength, params.maxNgramSize,
+    // Launch one block per sequence, one warp per block for cooperative draft token emission
+    suffixAutomatonExtendNgramKernel<<<batchSize, 32, 0, stream>>>(batchSize, params.draftLength, params.maxNgramSize,
         maxSlots, stateSize, params.slots, params.batchIndices, params.matchLenOut, params.draftTokensOut,
         params.acceptedTokensIn, params.acceptedLensIn);
 }
@@ -316,26 +328,27 @@ __global__ void suffixAutomatonGlobalSearchKernel(int batchSize, int draftLength
         __syncthreads();
     }
 
-    // Step 4: Thread 0 writes output
-    if (slotIdx == 0)
-    {
-        SlotMatch best = sharedMatches[0];
+    // Step 4: Thread 0 writes the match metadata; the whole block emits the draft tokens cooperatively.
+    // sharedMatches[0] holds the reduced best match and is visible to all threads after the final barrier.
+    SlotMatch best = sharedMatches[0];
 
-        if (best.matchLen > 0 && best.slotIdx >= 0)
+    if (best.matchLen > 0 && best.slotIdx >= 0)
+    {
+        if (slotIdx == 0)
         {
             matchLenOut[reqIdx] = best.matchLen;
             matchSlotOut[reqIdx] = best.slotIdx;
-
-            uint8_t const* slotMem
-                = static_cast<uint8_t const*>(slotsMemory) + static_cast<size_t>(best.slotIdx) * stateSize;
-            SuffixAutomaton const* slot = reinterpret_cast<SuffixAutomaton const*>(slotMem);
-            slot->getDraftTokens(&draftTokensOut[reqIdx * draftLength], draftLength, best.pos);
-        }
-        else
-        {
-            matchLenOut[reqIdx] = 0;
-            matchSlotOut[reqIdx] = -1;
         }
+
+        uint8_t const* slotMem
+            = static_cast<uint8_t const*>(slotsMemory) + static_cast<size_t>(best.slotIdx) * stateSize;
+        SuffixAutomaton const* slot = reinterpret_cast<SuffixAutomaton const*>(slotMem);
+        slot->getDraftTokensStrided(&draftTokensOut[reqIdx * draftLength], draftLength, best.pos, slotIdx, blockDim.x);
+    }
+    else if (slotIdx == 0)
+    {
+        matchLenOut[reqIdx] = 0;
+        matchSlotOut[reqIdx] = -1;
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -249,6 +249,161 @@ void invokeExplicitEOSCriterion(TokenIdType const** outputIds, TokenIdType const
     sync_check_cuda_error(stream);
 }
 
+namespace
+{
+__inline__ __device__ SizeType32 warpReduceMin(SizeType32 val)
+{
+    for (SizeType32 offset = 16; offset > 0; offset /= 2)
+    {
+        val = min(val, __shfl_xor_sync(0xffffffffU, val, offset));
+    }
+    return val;
+}
+
+//! One warp per sequence. Applies the enabled criteria in the same order as the individual kernels
+//! (stop words, explicit EOS, maximum length) and writes the finished state and finished sum once at the end.
+__global__ void fusedStopCriteria(FusedStopCriteriaParams params)
+{
+    constexpr SizeType32 kWarpSize{32};
+    auto const laneIdx = static_cast<SizeType32>(threadIdx.x) % kWarpSize;
+    auto const warpIdx = static_cast<SizeType32>(threadIdx.x) / kWarpSize;
+    auto const warpsPerBlock = static_cast<SizeType32>(blockDim.x) / kWarpSize;
+    auto const batchIdx = static_cast<SizeType32>(blockIdx.x) * warpsPerBlock + warpIdx;
+    if (batchIdx >= params.batchSize)
+    {
+        return;
+    }
+    auto const batchSlot = params.batchSlots[batchIdx];
+    auto finishState = params.finished[batchSlot];
+
+    // The criteria below update the sequence length and the number of new tokens. The reduced match positions are
+    // warp-uniform, so every lane tracks the updated values in registers and only lane 0 writes them back.
+    auto sequenceLength = params.sequenceLengths[batchSlot];
+    auto numNewTokens = params.numNewTokens != nullptr ? params.numNewTokens[batchSlot] : 1;
+
+    if (params.stopWords != nullptr)
+    {
+        auto const* baseStopWords = params.stopWords[batchSlot];
+        auto const stopWordsLen = params.stopWordsLens[batchSlot];
+        auto const* baseOffsets = baseStopWords + stopWordsLen;
+        auto const newTokens = numNewTokens;
+
+        // Lanes cooperate over the stop word items; for each item find the first step it matches at.
+        SizeType32 matchStep = INT_MAX;
+        for (auto id = laneIdx; id < stopWordsLen; id += kWarpSize)
+        {
+            if (baseOffsets[id] < 0)
+            {
+                continue;
+            }
+            auto const itemEnd = baseOffsets[id];
+            auto const itemStart = (id > 0) ? baseOffsets[id - 1] : 0;
+            auto const itemSize = itemEnd - itemStart;
+            for (SizeType32 step = 0; step < newTokens; ++step)
+            {
+                // Need to minus newTokens because the sequenceLengths is already updated at this point
+                auto const currentStep = sequenceLength - newTokens + step;
+                // Is sequence larger than stop word to look for a match?
+                if (currentStep + 1 < itemSize)
+                {
+                    continue;
+                }
+                bool match = true;
+                // Start from the last token
+                for (auto tokenIdx = itemSize - 1; tokenIdx >= 0; tokenIdx--)
+                {
+                    auto const previousToken = params.outputIds[batchSlot][currentStep - (itemSize - 1) + tokenIdx];
+                    if (previousToken != baseStopWords[itemStart + tokenIdx])
+                    {
+                        match = false;
+                        break;
+                    }
+                }
+                if (match)
+                {
+                    matchStep = min(matchStep, step);
+                    break;
+                }
+            }
+        }
+        // The earliest matching step determines where the sequence stops.
+        matchStep = warpReduceMin(matchStep);
+        if (matchStep != INT_MAX)
+        {
+            finishState.setFinishedStopWords();
+            if (newTokens > 1)
+            {
+                // Update num of new tokens and seq length up to the stopped word (including).
+                numNewTokens = min(numNewTokens, matchStep + 1);
+                sequenceLength = sequenceLength - newTokens + matchStep + 1;
+            }
+        }
+    }
+
+    if (params.endIds != nullptr && !finishState.isFinished())
+    {
+        auto const numTokens = params.numNewTokens != nullptr ? numNewTokens : params.maxTokensPerStep;
+        auto const endId = params.endIds[batchSlot];
+        auto const posStart = max(0, sequenceLength - numTokens);
+
+        // Lanes cooperate over the tokens added in this step; the first EOS wins.
+        SizeType32 eosPos = INT_MAX;
+        for (auto pos = posStart + laneIdx; pos < sequenceLength; pos += kWarpSize)
+        {
+            if (params.outputIds[batchSlot][pos] == endId)
+            {
+                eosPos = min(eosPos, pos);
+            }
+        }
+        eosPos = warpReduceMin(eosPos);
+        if (eosPos != INT_MAX)
+        {
+            finishState.setFinishedEOS();
+            sequenceLength = max(0, eosPos);
+            numNewTokens = eosPos - posStart;
+        }
+    }
+
+    if (params.sequenceLimitLength != nullptr)
+    {
+        auto const sequenceLimit = params.sequenceLimitLength[batchSlot];
+        auto const numTokensToLimit = sequenceLimit - sequenceLength;
+        if (numTokensToLimit <= 0)
+        {
+            finishState.setFinishedMaxLength();
+            sequenceLength = sequenceLimit;
+            numNewTokens += numTokensToLimit;
+        }
+    }
+
+    if (laneIdx == 0)
+    {
+        params.sequenceLengths[batchSlot] = sequenceLength;
+        if (params.numNewTokens != nullptr)
+        {
+            params.numNewTokens[batchSlot] = numNewTokens;
+        }
+        params.finished[batchSlot] = finishState;
+        if (params.finishedSum != nullptr)
+        {
+            params.finishedSum[batchSlot] = finishState.isFinished() ? 1 : 0;
+        }
+    }
+}
+} // namespace
+
+void invokeFusedStopCriteria(FusedStopCriteriaParams const& params, cudaStream_t stream)
+{
+    constexpr SizeType32 warpSize{32};
+    constexpr SizeType32 warpsPerBlock{8};
+
+    dim3 block{warpSize * warpsPerBlock};
+    dim3 grid{static_cast<uint32_t>(divUp(params.batchSize, warpsPerBlock))};
+
+    fusedStopCriteria<<<grid, block, 0, stream>>>(params);
+    sync_check_cuda_error(stream);
+}
+
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -95,6 +95,42 @@ void invokeExplicitEOSCriterion(runtime::TokenIdType const** outputIds, runtime:
     FinishedState* finished, runtime::SizeType32* sequenceLengths, runtime::SizeType32* numNewTokens,
     runtime::SizeType32 const* batchSlots, runtime::SizeType32 batchSize, runtime::SizeType32 beamWidth,
     runtime::SizeType32 maxTokensPerStep, cudaStream_t stream);
+
+//! \brief Parameters for the fused stop criteria kernel. Criteria are enabled by their respective input pointers:
+//! stop words when \p stopWords is not nullptr, explicit EOS when \p endIds is not nullptr and maximum length when
+//! \p sequenceLimitLength is not nullptr. Buffer shapes match the individual criterion kernels with beamWidth == 1.
+struct FusedStopCriteriaParams
+{
+    //! input buffer [maxBatchSize][maxSeqLen]. Contains pointers to rows with output tokens per request
+    runtime::TokenIdType const** outputIds{nullptr};
+    //! input buffer [maxBatchSize][2, stopWordsLen], optional. Stop words and their exclusive prefix sum of lengths
+    runtime::TokenIdType const* const* stopWords{nullptr};
+    //! input buffer [maxBatchSize], cumulative length of all stop words per request. Required with stopWords
+    runtime::SizeType32 const* stopWordsLens{nullptr};
+    //! input buffer [maxBatchSize], optional. EOS token ids per request
+    runtime::TokenIdType const* endIds{nullptr};
+    //! input buffer [maxBatchSize], optional. Maximum sequence length per request
+    runtime::SizeType32 const* sequenceLimitLength{nullptr};
+    //! input/output buffer [maxBatchSize]. Finished states
+    FinishedState* finished{nullptr};
+    //! output buffer [maxBatchSize], optional. Number of finished sequences per request (0 or 1)
+    runtime::SizeType32* finishedSum{nullptr};
+    //! input/output buffer [maxBatchSize]. Current sequence lengths of the request tokens
+    runtime::SizeType32* sequenceLengths{nullptr};
+    //! input/output buffer [maxBatchSize], optional. Number of tokens predicted per step. If nullptr, 1 is used
+    runtime::SizeType32* numNewTokens{nullptr};
+    //! input buffer [batchSize]. Indices of rows of data in memory pool
+    runtime::SizeType32 const* batchSlots{nullptr};
+    runtime::SizeType32 batchSize{0};
+    runtime::SizeType32 maxTokensPerStep{1};
+    runtime::SizeType32 maxSeqLen{0};
+};
+
+//! \brief Applies all enabled stop criteria (stop words, explicit EOS, maximum length) and updates the finished sum
+//! in a single launch with one warp per sequence, instead of one small thread-per-sequence kernel per criterion.
+//! Lanes cooperate over stop words and over the tokens added in the step, so multi-token (speculative) steps are
+//! checked in parallel. Only beamWidth == 1 is supported; beam search uses the individual criterion kernels.
+void invokeFusedStopCriteria(FusedStopCriteriaParams const& params, cudaStream_t stream);
 } // namespace kernels
 
 TRTLLM_NAMESPACE_END
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -1679,9 +1679,19 @@ __global__ __launch_bounds__(1024) void updateCyclicKvCacheAfterFmha(QKVPreproce
     }
 
     // The kv cache buffer has the shape of [batch_size, 2, max_num_blocks_per_seq, [num_kv_heads, tokens_per_block,
-    // head_size]] All threads in block.y and grid.x will iterate over all the tokens.
-    int thread_token_idx = blockIdx.x * blockDim.y + threadIdx.y;
-    int num_tokens_per_loop = gridDim.x * blockDim.y;
+    // head_size]]. Map the flat thread index to (token, 16B vector) at runtime so that narrow kv
+    // heads (num_vecs_per_head < 32) keep the whole block busy and consecutive threads issue
+    // consecutive 16B vectors of adjacent tokens, which coalesces within a kv cache block.
+    int num_tokens_per_cta = blockDim.x / num_vecs_per_head;
+    int token_sub_idx = threadIdx.x / num_vecs_per_head;
+    int head_vec_idx = threadIdx.x % num_vecs_per_head;
+    // Trailing threads that don't cover a full token (non-power-of-two head sizes) have no work.
+    if (token_sub_idx >= num_tokens_per_cta)
+    {
+        return;
+    }
+    int thread_token_idx = blockIdx.x * num_tokens_per_cta + token_sub_idx;
+    int num_tokens_per_loop = gridDim.x * num_tokens_per_cta;
     // Iterate over new tokens' kv blocks.
     for (int token_idx = tmp_kv_token_start_idx + thread_token_idx; token_idx < num_tmp_kv_tokens;
          token_idx += num_tokens_per_loop)
@@ -1700,19 +1710,14 @@ __global__ __launch_bounds__(1024) void updateCyclicKvCacheAfterFmha(QKVPreproce
         auto store_v_block_ptr
             = reinterpret_cast<uint4*>(params.kv_cache_buffer.getVBlockPtr(batch_idx, store_token_idx_in_kv_cache));
 
-        // Iterate over new tokens' kv hidden states in one cache block.
-        int head_vec_idx = threadIdx.x;
-        if (head_vec_idx < num_vecs_per_head)
-        {
-            // The vector index inside the block.
-            auto load_vec_idx = params.kv_cache_buffer.getKVLocalIdx(
-                load_token_idx_in_kv_cache, kv_head_idx, num_vecs_per_head, head_vec_idx);
-            auto store_vec_idx = params.kv_cache_buffer.getKVLocalIdx(
-                store_token_idx_in_kv_cache, kv_head_idx, num_vecs_per_head, head_vec_idx);
-            // Load from the temporary cache and write it to the cyclic cache.
-            store_k_block_ptr[store_vec_idx] = load_k_block_ptr[load_vec_idx];
-            store_v_block_ptr[store_vec_idx] = load_v_block_ptr[load_vec_idx];
-        }
+        // The vector index inside the block.
+        auto load_vec_idx = params.kv_cache_buffer.getKVLocalIdx(
+            load_token_idx_in_kv_cache, kv_head_idx, num_vecs_per_head, head_vec_idx);
+        auto store_vec_idx = params.kv_cache_buffer.getKVLocalIdx(
+            store_token_idx_in_kv_cache, kv_head_idx, num_vecs_per_head, head_vec_idx);
+        // Load from the temporary cache and write it to the cyclic cache.
+        store_k_block_ptr[store_vec_idx] = load_k_block_ptr[load_vec_idx];
+        store_v_block_ptr[store_vec_idx] = load_v_block_ptr[load_vec_idx];
     }
 }
 
@@ -1727,8 +1732,6 @@ void invokeUpdateCyclicKvCacheAfterFmha(QKVPreprocessingParams<T, KVCacheBuffer>
 
     // Launch kernels for updating cyclic kv cache. It is only needed when sliding window attention and chunked context
     // (i.e. paged kv context fmha) are used together.
-    dim3 block(32, 32);
-    dim3 grid(std::min(64, int(divUp(params.cyclic_kv_cache_len, block.y))), params.kv_head_num, params.batch_size);
     // separate_q_kv_output = true means that paged kv context fmha might be used.
     if (params.max_kv_seq_len > params.cyclic_kv_cache_len && params.separate_q_kv_output)
     {
@@ -1736,6 +1739,12 @@ void invokeUpdateCyclicKvCacheAfterFmha(QKVPreprocessingParams<T, KVCacheBuffer>
         TLLM_CHECK_WITH_INFO(
             (params.size_per_head * sizeof(TCache)) % 16 == 0 && (params.size_per_head * sizeof(TCache)) / 16 <= 32,
             "Head size is not supported.");
+        // Each thread moves one 16B vector; a flat block covers as many whole tokens as fit.
+        int const numVecsPerHead = (params.size_per_head * sizeof(TCache)) / 16;
+        int const numTokensPerCta = 1024 / numVecsPerHead;
+        dim3 block(1024);
+        dim3 grid(
+            std::min(64, int(divUp(params.cyclic_kv_cache_len, numTokensPerCta))), params.kv_head_num, params.batch_size);
         updateCyclicKvCacheAfterFmha<T, TCache, KVCacheBuffer><<<grid, block, 0, stream>>>(params);
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -62,6 +62,10 @@ KERNEL_TYPE_TRAITS_REGISTRY(KernelType::FP16Int4PerChannel, false, true);
 KERNEL_TYPE_TRAITS_REGISTRY(KernelType::BF16Int4PerChannel, false, true);
 #undef KERNEL_TYPE_TRAITS_REGISTRY
 
+// Largest m handled by the batched GEMV path. Batches in [1, 16) are dispatched to an exact-m kernel; larger batches
+// are tiled over grid.x (see kernelDispatcher.h). Beyond this the CUTLASS GEMM is the better choice.
+static constexpr int kMaxSupportedM = 32;
+
 struct Params
 {
     using Pointer = void*;
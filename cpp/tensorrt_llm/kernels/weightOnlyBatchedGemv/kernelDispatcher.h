@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -43,6 +43,19 @@ void dispatcher(Params& params, cudaStream_t s)
             return;                                                                                                    \
         }                                                                                                              \
     } while (0);
+// For batches beyond the exact-m table, tile the m dimension over grid.x with the largest CtaM dividing m. Each CTA
+// keeps the register pipeline of the exact-m kernels while the dequantized weight traffic is amortized over CtaM rows
+// per tile, which is where the GEMV path loses per-token efficiency against the exact-m kernels.
+#define DISPATCHER_FOR_TILED_M(CtaM, CtaN, Threads)                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (params.m <= kMaxSupportedM && params.m % CtaM == 0)                                                        \
+        {                                                                                                              \
+            exec_kernel<Details, CtaM, CtaN, Threads, GroupSize, EnableActScale, EnableZero, EnableBias,               \
+                ApplyAlphaInAdvance>(params, s);                                                                       \
+            return;                                                                                                    \
+        }                                                                                                              \
+    } while (0);
     if constexpr (EnableZero)
     {
         // clang-format off
@@ -51,6 +64,9 @@ void dispatcher(Params& params, cudaStream_t s)
         DISPATCHER_FOR_M(1, 1, 4, 128);
         DISPATCHER_FOR_M(4, 4, 4, 128);
         DISPATCHER_FOR_M(8, 8, 4, 128);
+        DISPATCHER_FOR_TILED_M(8, 4, 128);
+        DISPATCHER_FOR_TILED_M(4, 4, 128);
+        DISPATCHER_FOR_TILED_M(1, 4, 128);
 #else
         DISPATCHER_FOR_M(1, 1, 4, 128);
         DISPATCHER_FOR_M(2, 2, 4, 128);
@@ -67,6 +83,11 @@ void dispatcher(Params& params, cudaStream_t s)
         DISPATCHER_FOR_M(13, 13, 4, 128);
         DISPATCHER_FOR_M(14, 14, 4, 128);
         DISPATCHER_FOR_M(15, 15, 4, 128);
+        DISPATCHER_FOR_TILED_M(16, 4, 128);
+        DISPATCHER_FOR_TILED_M(8, 4, 128);
+        DISPATCHER_FOR_TILED_M(4, 4, 128);
+        DISPATCHER_FOR_TILED_M(2, 4, 128);
+        DISPATCHER_FOR_TILED_M(1, 4, 128);
 #endif
         // clang-format on
     }
@@ -78,6 +99,9 @@ void dispatcher(Params& params, cudaStream_t s)
         DISPATCHER_FOR_M(1, 1, 8, 128);
         DISPATCHER_FOR_M(4, 4, 8, 128);
         DISPATCHER_FOR_M(8, 8, 8, 128);
+        DISPATCHER_FOR_TILED_M(8, 8, 128);
+        DISPATCHER_FOR_TILED_M(4, 8, 128);
+        DISPATCHER_FOR_TILED_M(1, 8, 128);
 #else
         DISPATCHER_FOR_M(1, 1, 8, 128);
         DISPATCHER_FOR_M(2, 2, 8, 128);
@@ -94,10 +118,16 @@ void dispatcher(Params& params, cudaStream_t s)
         DISPATCHER_FOR_M(13, 13, 8, 128);
         DISPATCHER_FOR_M(14, 14, 8, 128);
         DISPATCHER_FOR_M(15, 15, 8, 128);
+        DISPATCHER_FOR_TILED_M(16, 8, 128);
+        DISPATCHER_FOR_TILED_M(8, 8, 128);
+        DISPATCHER_FOR_TILED_M(4, 8, 128);
+        DISPATCHER_FOR_TILED_M(2, 8, 128);
+        DISPATCHER_FOR_TILED_M(1, 8, 128);
 #endif
         // clang-format on
     }
     throw std::runtime_error("unsupported m");
+#undef DISPATCHER_FOR_TILED_M
 #undef DISPATCHER_FOR_M
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2020-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -213,6 +213,13 @@ size_t XqaDispatcher::getWorkspaceSize(int max_num_tokens)
 
 bool XqaDispatcher::shouldUse(XQAParams const& params)
 {
+    // The cyclic section of the KV cache starts to be overwritten in place once the longest sequence
+    // outgrows the attention window. Until then the block table is linear and the cache layout is
+    // identical to the non-cyclic case, so kernels without native ring-buffer support can still run.
+    bool const anySeqHasWrapped = params.max_past_kv_length + 1 > params.cyclic_attention_window_size;
+    // Sink tokens that are not a multiple of tokens_per_block leave a bubble between the pinned sink
+    // blocks and the cyclic section, which breaks the linear page indexing even before wrap-around.
+    bool const sinkBlocksAligned = !params.paged_kv_cache || params.sink_token_length % params.tokens_per_block == 0;
     if (mUseTllmGen)
     {
         // Fall-back to MMHA for some unsupported cases.
@@ -220,9 +227,17 @@ bool XqaDispatcher::shouldUse(XQAParams const& params)
         {
             SHOULD_NOT_USE("Fallback to MMHA as beam searching is not supported by TRTLLM-GEN kernels.")
         }
-        if (params.position_shift_enabled || params.sink_token_length > 0)
+        if (params.position_shift_enabled)
         {
-            SHOULD_NOT_USE("Fallback to MMHA as streamingLLM is not supported by TRTLLM-GEN kernels.")
+            // With position shift the cache holds un-rotated keys and RoPE is applied at read time,
+            // which TRTLLM-GEN kernels cannot do.
+            SHOULD_NOT_USE("Fallback to MMHA as streamingLLM position shift is not supported by TRTLLM-GEN kernels.")
+        }
+        if (params.sink_token_length > 0 && (anySeqHasWrapped || !sinkBlocksAligned))
+        {
+            SHOULD_NOT_USE(
+                "Fallback to MMHA as pinned sink blocks in a wrapped cyclic KV cache are not supported by "
+                "TRTLLM-GEN kernels.")
         }
         if (params.unidirectional != 1)
         {
@@ -237,10 +252,10 @@ bool XqaDispatcher::shouldUse(XQAParams const& params)
         {
             SHOULD_NOT_USE("Fallback to MMHA as tokens_per_block < 8 is not supported by TRTLLM-GEN kernels.");
         }
-        if (params.cyclic_attention_window_size != params.max_attention_window_size)
+        if (params.cyclic_attention_window_size != params.max_attention_window_size && anySeqHasWrapped)
         {
             SHOULD_NOT_USE(
-                "Fallback to MMHA as variable attention_window_size is not supported by TRTLLM-GEN kernels.");
+                "Fallback to MMHA as a wrapped cyclic attention_window_size is not supported by TRTLLM-GEN kernels.");
         }
         if ((float(params.num_q_heads) / float(params.num_kv_heads)) > 32)
         {
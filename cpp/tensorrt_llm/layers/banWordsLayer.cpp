@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -48,10 +48,14 @@ void BanWordsLayer<T>::allocateBuffer()
     {
         mNoRepeatNgramSizeDevice
             = mBufferManager->gpu(ITensor::makeShape({mDecoderDomain.getBatchSize()}), TRTDataType<SizeType32>::value);
+        // Slots admitted before the first request with an ngram limit are never filled by setup.
+        // Zero (no limit) keeps the ban kernel a no-op for them instead of reading garbage.
+        mBufferManager->setZero(*mNoRepeatNgramSizeDevice);
     }
 
     mNoRepeatNgramSize = mBufferManager->pinnedPool(
         ITensor::makeShape({mDecoderDomain.getBatchSize()}), TRTDataType<SizeType32>::value);
+    mBufferManager->setZero(*mNoRepeatNgramSize);
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
@@ -151,8 +155,28 @@ void BanWordsLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> const&
     auto const localDecoderDomain = getLocalDecoderDomain(inputs, mDecoderDomain);
     auto const maxSeqLen = outputs->outputIds->getDimension<-1>();
 
+    // The ban kernel schedules a grid covering the full sequence length, so check on host whether
+    // any slot of this batch actually requests an ngram limit and skip the launch otherwise.
+    // mUseNoRepeatNgramSize is sticky, but slots hold 0 (never set up) or the default sentinel
+    // (no limit requested) unless a request asked for one, and both are no-ops in the kernel.
+    bool launchNoRepeatNgram = false;
+    if (mUseNoRepeatNgramSize)
+    {
+        auto batchSlotsHost = bufferCast<SizeType32>(*inputs->batchSlots);
+        auto noRepeatNgramSizes = bufferCast<SizeType32>(*mNoRepeatNgramSize);
+        for (SizeType32 bi = 0; bi < localDecoderDomain.getBatchSize(); ++bi)
+        {
+            auto const ngramSize = noRepeatNgramSizes[batchSlotsHost[bi]];
+            if (ngramSize != 0 && ngramSize != DefaultDecodingParams::getNoRepeatNgramSize())
+            {
+                launchNoRepeatNgram = true;
+                break;
+            }
+        }
+    }
+
     banRepeatNGrams(workspace->getDeviceRuntimeLogits(), outputs, inputs, workspace->getDeviceBatchSlots(),
-        mNoRepeatNgramSizeDevice, localDecoderDomain, maxSeqLen, mUseNoRepeatNgramSize);
+        mNoRepeatNgramSizeDevice, localDecoderDomain, maxSeqLen, launchNoRepeatNgram);
     banBadWords(workspace->getDeviceRuntimeLogits(), outputs, inputs, workspace->getDeviceBatchSlots(),
         localDecoderDomain, maxSeqLen);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
 #include "dynamicDecodeLayer.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/kernels/decodingKernels.h"
+#include "tensorrt_llm/kernels/fusedGreedySamplingKernels.h"
+#include "tensorrt_llm/layers/defaultDecodingParams.h"
 #include "tensorrt_llm/layers/layerUtils.h"
 #include "tensorrt_llm/layers/layersFactory.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
@@ -91,6 +93,12 @@ void DynamicDecodeLayer<T>::allocateBuffer()
     mZeroParentIdsDevice
         = mBufferManager->gpu(ITensor::makeShape({2 * mDecoderDomain.getBatchSize()}), TRTDataType<TokenIdType>::value);
 
+    mFusedGreedySlotsHost
+        = mBufferManager->pinnedPool(ITensor::makeShape({mDecoderDomain.getBatchSize()}), TRTDataType<bool>::value);
+    auto fusedGreedySlots = BufferRange<bool>(*mFusedGreedySlotsHost);
+    std::fill(fusedGreedySlots.begin(), fusedGreedySlots.end(), false);
+    mFusedLogitsPtrsHost = mBufferManager->pinnedPool(ITensor::makeShape({}), TRTDataType<T*>::value);
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -167,6 +175,70 @@ void DynamicDecodeLayer<T>::setup(SizeType32 batchSize, SizeType32 beamWidth, Te
         layer->setup(batchSize, beamWidth, batchSlots, baseSetupParams, workspace);
     }
 
+    updateFusedGreedyEligibility(batchSize, batchSlots, setupParams);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
+template <typename T>
+void DynamicDecodeLayer<T>::updateFusedGreedyEligibility(SizeType32 batchSize, TensorConstPtr const& batchSlots,
+    std::shared_ptr<DynamicDecodeSetupParams> const& setupParams)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    auto fusedGreedySlots = BufferRange<bool>(*mFusedGreedySlotsHost);
+    auto const* batchSlotsPtr = bufferCast<SizeType32>(*batchSlots);
+
+    auto const samplingParams = std::dynamic_pointer_cast<SamplingSetupParams>(setupParams->decodingParams);
+    auto const& penaltyParams = setupParams->penaltyParams;
+    auto const& banWordsParams = setupParams->banWordsParams;
+
+    // Per-slot value of a [1] or [setupBatchSize] setup vector, falling back to the default.
+    auto const valueAt = [](auto const& optVec, SizeType32 bi, auto defaultValue)
+    {
+        using V = decltype(defaultValue);
+        if (!optVec.has_value() || optVec->empty())
+        {
+            return defaultValue;
+        }
+        return static_cast<V>(optVec->size() == 1 ? optVec->front() : optVec->at(bi));
+    };
+
+    for (SizeType32 bi = 0; bi < batchSize; ++bi)
+    {
+        bool eligible = mDecodingMode.isTopKorTopP() && samplingParams != nullptr;
+        if (eligible)
+        {
+            auto const topK = valueAt(samplingParams->runtimeTopK, bi, DefaultDecodingParams::getTopK());
+            auto const topP = valueAt(samplingParams->runtimeTopP, bi, DefaultDecodingParams::getTopP());
+            // Effective greedy after regularizeTopKTopP: topK 1, or neither topK nor topP requested.
+            // Temperature is excluded on purpose since the argmax is invariant to it.
+            eligible = topK == 1 || (topK <= 0 && topP <= 0.f);
+            eligible = eligible
+                && valueAt(samplingParams->runtimeMinP, bi, DefaultDecodingParams::getMinP())
+                    == DefaultDecodingParams::getMinP();
+            eligible = eligible && !valueAt(samplingParams->outputLogProbs, bi, false)
+                && !valueAt(samplingParams->cumLogProbs, bi, false);
+        }
+        if (eligible && penaltyParams)
+        {
+            eligible = valueAt(penaltyParams->repetitionPenalty, bi, DefaultDecodingParams::getRepetitionPenalty())
+                    == DefaultDecodingParams::getRepetitionPenalty()
+                && valueAt(penaltyParams->presencePenalty, bi, DefaultDecodingParams::getPresencePenalty())
+                    == DefaultDecodingParams::getPresencePenalty()
+                && valueAt(penaltyParams->frequencyPenalty, bi, DefaultDecodingParams::getFrequencyPenalty())
+                    == DefaultDecodingParams::getFrequencyPenalty()
+                && valueAt(penaltyParams->minLength, bi, DefaultDecodingParams::getMinLength())
+                    == DefaultDecodingParams::getMinLength();
+        }
+        if (eligible && banWordsParams)
+        {
+            eligible = valueAt(banWordsParams->noRepeatNgramSize, bi, DefaultDecodingParams::getNoRepeatNgramSize())
+                == DefaultDecodingParams::getNoRepeatNgramSize();
+        }
+        fusedGreedySlots[batchSlotsPtr[bi]] = eligible;
+    }
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -211,15 +283,24 @@ void DynamicDecodeLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> co
     prepareIdsPtrs(baseOutputs, params->batchSlots, localDecoderDomain.getBatchSize(),
         localDecoderDomain.getBeamWidth(), maxSeqLen);
 
-    for (auto& layer : mLayers)
+    if (canUseFusedGreedyPath(baseOutputs, params, localDecoderDomain))
     {
-        layer->forwardAsync(baseOutputs, baseInputs, workspace);
+        // A single fused kernel replaces the penalty/sampling/stop criteria chain and the next step
+        // token copy when the whole batch decodes greedily with default penalties and no word bans.
+        forwardFusedGreedy(baseOutputs, params, localDecoderDomain, workspace);
     }
+    else
+    {
+        for (auto& layer : mLayers)
+        {
+            layer->forwardAsync(baseOutputs, baseInputs, workspace);
+        }
 
-    // Copy nextIds and transpose logits when needed
-    prepareOutputData(baseOutputs, workspace->getDeviceBatchSlots(), localDecoderDomain.getBatchSize(),
-        mDecoderDomain.getBatchSize(), baseOutputs->beamWidth, maxSeqLen, mDecoderDomain.getMaxDecodingTokens(),
-        mOutputLogProbs, getStream());
+        // Copy nextIds and transpose logits when needed
+        prepareOutputData(baseOutputs, workspace->getDeviceBatchSlots(), localDecoderDomain.getBatchSize(),
+            mDecoderDomain.getBatchSize(), baseOutputs->beamWidth, maxSeqLen, mDecoderDomain.getMaxDecodingTokens(),
+            mOutputLogProbs, getStream());
+    }
 
     mCyclicStep += 1;
 
@@ -242,6 +323,84 @@ void DynamicDecodeLayer<T>::forwardSync(std::shared_ptr<BaseDecodingOutputs> con
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+template <typename T>
+bool DynamicDecodeLayer<T>::canUseFusedGreedyPath(std::shared_ptr<BaseDecodingOutputs> const& outputs,
+    std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& localDecoderDomain) const
+{
+    // The fused kernel produces a single greedy token per step with stop criteria reduced to the
+    // sequence length limit. Anything beyond that falls back to the layer chain.
+    bool eligible = mDecodingMode.isTopKorTopP() && !mDecodingMode.isUseExplicitEosStop();
+    eligible = eligible && localDecoderDomain.getBeamWidth() == 1 && outputs->beamWidth == 1;
+    eligible = eligible && mDecoderDomain.getMaxDecodingTokens() == 1;
+    eligible = eligible && !mOutputLogProbs && !outputs->numNewTokens;
+    eligible = eligible && !inputs->embeddingBias && !inputs->curTokensPerStep;
+    eligible = eligible && inputs->finished.has_value() && outputs->finished.has_value()
+        && outputs->sequenceLength.has_value();
+    eligible = eligible && inputs->banWordsInputs && inputs->banWordsInputs->maxBadWordsLen == 0;
+    eligible = eligible && inputs->stopCriteriaInputs && inputs->stopCriteriaInputs->maxStopWordsLen == 0
+        && inputs->stopCriteriaInputs->sequenceLimitLength.has_value();
+    if (!eligible)
+    {
+        return false;
+    }
+
+    auto const* batchSlotsPtr = bufferCast<SizeType32>(*inputs->batchSlots);
+    return allOfBatchSlots(
+        batchSlotsPtr, bufferCast<bool>(*mFusedGreedySlotsHost), localDecoderDomain.getBatchSize(), true);
+}
+
+template <typename T>
+void DynamicDecodeLayer<T>::forwardFusedGreedy(std::shared_ptr<BaseDecodingOutputs> const& outputs,
+    std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& localDecoderDomain,
+    std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    NVTX3_SCOPED_RANGE(DynamicDecodeLayer_forwardFusedGreedy);
+
+    auto const batchSize = localDecoderDomain.getBatchSize();
+
+    if (mFusedLogitsPtrsHost->data() == nullptr)
+    {
+        mFusedLogitsPtrsHost->reshape(ITensor::makeShape(
+            {static_cast<int32_t>(mRuntimeMaxSeqLen), static_cast<int32_t>(mDecoderDomain.getBatchSize())}));
+    }
+
+    // Stage per-step logits pointers with the same cyclic scheme as prepareIdsPtrs.
+    TensorPtr logitsPtrsHost = ITensor::slice(mFusedLogitsPtrsHost, mCyclicStep, 1);
+    logitsPtrsHost->squeeze(0);
+    auto logitsPtrsHostData = bufferCast<T const*>(*logitsPtrsHost);
+    for (SizeType32 bi = 0; bi < batchSize; bi++)
+    {
+        if (inputs->logitsVec)
+        {
+            TLLM_CHECK_WITH_INFO(inputs->logitsVec->size() == static_cast<size_t>(batchSize),
+                "Logits vector size (%lu) is not equal to the batchSize (%d)", inputs->logitsVec->size(), batchSize);
+            logitsPtrsHostData[bi] = bufferCastOrNull<T>(inputs->logitsVec.value()[bi]);
+        }
+        else
+        {
+            TensorConstPtr logitsForBatchIndex = ITensor::slice(inputs->logits.value(), ITensor::makeShape({bi}));
+            logitsPtrsHostData[bi] = bufferCastOrNull<T>(logitsForBatchIndex);
+        }
+    }
+
+    TensorPtr logitsPtrsHostSlice = ITensor::slice(logitsPtrsHost, 0, batchSize);
+    auto [logitsPtrsDeviceSlice] = workspace->mirrorInWorkspace(logitsPtrsHostSlice);
+
+    invokeFusedGreedySampling(reinterpret_cast<T const* const*>(bufferCast<T const*>(*logitsPtrsDeviceSlice)),
+        bufferCast<TokenIdType*>(*mOutputIdsPtrDevice), bufferCast<TokenIdType>(*outputs->newTokens),
+        bufferCast<SizeType32>(*outputs->sequenceLength.value()),
+        reinterpret_cast<FinishedState const*>(
+            bufferCast<FinishedState::UnderlyingType>(*inputs->finished.value())),
+        reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*outputs->finished.value())),
+        bufferCastOrNull<SizeType32>(outputs->finishedSum),
+        bufferCast<SizeType32>(*inputs->stopCriteriaInputs->sequenceLimitLength.value()),
+        bufferCast<TokenIdType>(*inputs->endIds), workspace->getDeviceBatchSlotsPtr(), batchSize,
+        mDecoderDomain.getVocabSize(), getStream());
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 template <typename T>
 void DynamicDecodeLayer<T>::prepareIdsPtrs(std::shared_ptr<BaseDecodingOutputs> const& outputs,
     BufferConstPtr batchSlots, SizeType32 batchSize, SizeType32 beamWidth, SizeType32 maxSeqLen)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -59,6 +59,17 @@ private:
 
     void prepareIdsPtrs(std::shared_ptr<BaseDecodingOutputs> const& outputs, BufferConstPtr batchSlots,
         runtime::SizeType32 batchSize, runtime::SizeType32 beamWidth, runtime::SizeType32 maxSeqLen);
+
+    //! @brief Update per-slot eligibility for the fused greedy decode path from the setup params.
+    void updateFusedGreedyEligibility(runtime::SizeType32 batchSize, TensorConstPtr const& batchSlots,
+        std::shared_ptr<DynamicDecodeSetupParams> const& setupParams);
+    //! @brief Check whether the whole batch of the current step can take the fused greedy decode path.
+    [[nodiscard]] bool canUseFusedGreedyPath(std::shared_ptr<BaseDecodingOutputs> const& outputs,
+        std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& localDecoderDomain) const;
+    //! @brief Run one decode step with a single fused kernel instead of the layer chain.
+    void forwardFusedGreedy(std::shared_ptr<BaseDecodingOutputs> const& outputs,
+        std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& localDecoderDomain,
+        std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace);
     void prepareOutputData(std::shared_ptr<BaseDecodingOutputs> const& outputs, BufferConstPtr batchSlots,
         runtime::SizeType32 batchSize, runtime::SizeType32 maxBatchSize, runtime::SizeType32 beamWidth,
         runtime::SizeType32 maxSeqLen, runtime::SizeType32 maxTokensPerStep, bool outputLogProbs, cudaStream_t stream);
@@ -76,6 +87,13 @@ private:
     TensorPtr mOutputIdsPtrDevice;
     TensorPtr mParentIdsPtrDevice;
 
+    //! Per-slot flags set in setup(). A slot is eligible for the fused greedy decode path when its
+    //! sampling config reduces to argmax (effective topK 1) with all penalties at default values and
+    //! no log probs requested.
+    TensorPtr mFusedGreedySlotsHost;
+    //! Staging of per-step logits pointers for the fused path, cyclic over [maxSeqLen, maxBatchSize].
+    TensorPtr mFusedLogitsPtrsHost;
+
     bool mHasDiffRuntimeArgs{false};
 
     bool mOutputLogProbs{false};
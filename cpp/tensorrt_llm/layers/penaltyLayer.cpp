@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -360,7 +360,18 @@ void PenaltyLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> const& b
         invokeAddBiasSoftMax(biasSoftmaxParams, penaltyParams.stream);
     }
 
-    invokeBatchApplyPenalty(penaltyParams);
+    // In the common temperature/bias-only configuration, a single vectorized pass over the logits is enough.
+    bool const temperatureBiasOnly = penaltyParams.repetitionPenalties == nullptr
+        && penaltyParams.presencePenalties == nullptr && penaltyParams.frequencyPenalties == nullptr
+        && penaltyParams.minLengths == nullptr && penaltyParams.vocabSizePadded % 2 == 0;
+    if (temperatureBiasOnly)
+    {
+        invokeBatchApplyTemperatureBias(penaltyParams);
+    }
+    else
+    {
+        invokeBatchApplyPenalty(penaltyParams);
+    }
     sync_check_cuda_error(penaltyParams.stream);
 
     mCyclicStep += 1;
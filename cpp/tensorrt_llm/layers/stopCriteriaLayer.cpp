@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -49,7 +49,13 @@ StopCriteriaLayer<T>::StopCriteriaLayer(executor::DecodingMode const& mode, Deco
         std::make_pair(ITensor::makeShape({1}), TRTDataType<SizeType32>::value),
         std::make_pair(ITensor::makeShape({decoderDomain.getBatchSize(), decoderDomain.getBeamWidth()}),
             TRTDataType<FinishedState::UnderlyingType>::value));
-    mWorkspaceSize = std::max(stopWordsWorkspaceSize, lengthCriterionWorkspaceSize);
+    auto const fusedCriteriaWorkspaceSize = DecodingLayerWorkspace::calculateRequiredWorkspaceSize(
+        std::make_pair(ITensor::makeShape({decoderDomain.getBatchSize()}), TRTDataType<SizeType32>::value),
+        std::make_pair(ITensor::makeShape({decoderDomain.getBatchSize()}), TRTDataType<TokenIdType*>::value),
+        std::make_pair(ITensor::makeShape({1}), TRTDataType<SizeType32>::value),
+        std::make_pair(ITensor::makeShape({decoderDomain.getBatchSize(), decoderDomain.getBeamWidth()}),
+            TRTDataType<FinishedState::UnderlyingType>::value));
+    mWorkspaceSize = std::max({stopWordsWorkspaceSize, lengthCriterionWorkspaceSize, fusedCriteriaWorkspaceSize});
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -81,17 +87,31 @@ void StopCriteriaLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> con
 
     TLLM_CHECK_WITH_INFO(inputs->stopCriteriaInputs, "stopCriteriaInputs for forward is not set");
 
-    if (mDecodingMode.isUseStopWords() && inputs->stopCriteriaInputs->maxStopWordsLen != 0)
-    {
-        checkStopWordsStopCriteria(outputs, inputs, localDecoderDomain, maxSeqLen, *mBufferManager, workspace);
-    }
-    if (mDecodingMode.isUseExplicitEosStop())
+    auto const useStopWords = mDecodingMode.isUseStopWords() && inputs->stopCriteriaInputs->maxStopWordsLen != 0;
+    auto const useExplicitEos = mDecodingMode.isUseExplicitEosStop();
+    auto const useMaxLength
+        = mDecodingMode.isUseMaxLengthStop() && inputs->stopCriteriaInputs->sequenceLimitLength.has_value();
+
+    if (localDecoderDomain.getBeamWidth() == 1 && (useStopWords || useExplicitEos || useMaxLength))
     {
-        checkEosToken(outputs, inputs, localDecoderDomain, *mBufferManager, workspace);
+        // Single fused launch for all enabled criteria instead of one small kernel per criterion.
+        checkFusedStopCriteria(outputs, inputs, localDecoderDomain, useStopWords, useExplicitEos, useMaxLength,
+            maxSeqLen, *mBufferManager, workspace);
     }
-    if (mDecodingMode.isUseMaxLengthStop() && inputs->stopCriteriaInputs->sequenceLimitLength)
+    else
     {
-        checkMaxLengthStopCriteria(outputs, inputs, localDecoderDomain, *mBufferManager, workspace);
+        if (useStopWords)
+        {
+            checkStopWordsStopCriteria(outputs, inputs, localDecoderDomain, maxSeqLen, *mBufferManager, workspace);
+        }
+        if (useExplicitEos)
+        {
+            checkEosToken(outputs, inputs, localDecoderDomain, *mBufferManager, workspace);
+        }
+        if (useMaxLength)
+        {
+            checkMaxLengthStopCriteria(outputs, inputs, localDecoderDomain, *mBufferManager, workspace);
+        }
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -173,6 +193,59 @@ void StopCriteriaLayer<T>::checkEosToken(std::shared_ptr<BaseDecodingOutputs>& o
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+template <typename T>
+void StopCriteriaLayer<T>::checkFusedStopCriteria(std::shared_ptr<BaseDecodingOutputs>& outputs,
+    std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain, bool useStopWords,
+    bool useExplicitEos, bool useMaxLength, SizeType32 maxSeqLen, BufferManager const& bufferManager,
+    std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    auto [stopWordsLengthsDevice, stopWordsPtrDevice, finishedSumDevice, finishedDevice] = workspace->mirrorInWorkspace(
+        useStopWords ? inputs->stopCriteriaInputs->stopWordsLengths.value_or(nullptr) : nullptr,
+        useStopWords ? inputs->stopCriteriaInputs->stopWordsPtr.value_or(nullptr) : nullptr,
+        useMaxLength ? outputs->finishedSum.value_or(nullptr) : nullptr, outputs->finished.value_or(nullptr));
+
+    kernels::FusedStopCriteriaParams params;
+    params.outputIds = bufferCast<TokenIdType const*>(*outputs->outputIdsPtr);
+    if (useStopWords)
+    {
+        params.stopWords
+            = stopWordsPtrDevice == nullptr ? nullptr : bufferCast<TokenIdType const*>(*stopWordsPtrDevice);
+        params.stopWordsLens
+            = stopWordsLengthsDevice == nullptr ? nullptr : bufferCast<SizeType32>(*stopWordsLengthsDevice);
+    }
+    if (useExplicitEos)
+    {
+        params.endIds = bufferCastOrNull<TokenIdType>(inputs->endIds);
+    }
+    if (useMaxLength)
+    {
+        params.sequenceLimitLength = bufferCastOrNull<SizeType32>(inputs->stopCriteriaInputs->sequenceLimitLength);
+        params.finishedSum = finishedSumDevice == nullptr ? nullptr : bufferCast<SizeType32>(*finishedSumDevice);
+    }
+    params.finished = finishedDevice == nullptr
+        ? nullptr
+        : reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*finishedDevice));
+    params.sequenceLengths = bufferCastOrNull<SizeType32>(outputs->sequenceLength);
+    params.numNewTokens = bufferCastOrNull<SizeType32>(outputs->numNewTokens);
+    params.batchSlots = workspace->getDeviceBatchSlotsPtr();
+    params.batchSize = decoderDomain.getBatchSize();
+    params.maxTokensPerStep = decoderDomain.getMaxDecodingTokens();
+    params.maxSeqLen = maxSeqLen;
+
+    invokeFusedStopCriteria(params, bufferManager.getStream().get());
+
+    if (finishedSumDevice != nullptr)
+    {
+        bufferManager.copy(*finishedSumDevice, *outputs->finishedSum.value());
+    }
+    if (finishedDevice != nullptr)
+    {
+        bufferManager.copy(*finishedDevice, *outputs->finished.value());
+    }
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 template class StopCriteriaLayer<float>;
 template class StopCriteriaLayer<half>;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -58,6 +58,11 @@ private:
     static void checkEosToken(std::shared_ptr<BaseDecodingOutputs>& outputs,
         std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain,
         runtime::BufferManager const& bufferManager, std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace);
+    //! \brief Applies all enabled criteria with a single fused kernel launch. Only used when beamWidth == 1.
+    static void checkFusedStopCriteria(std::shared_ptr<BaseDecodingOutputs>& outputs,
+        std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain, bool useStopWords,
+        bool useExplicitEos, bool useMaxLength, runtime::SizeType32 maxSeqLen,
+        runtime::BufferManager const& bufferManager, std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace);
 
 private:
     using BaseLayer::mDecoderDomain;
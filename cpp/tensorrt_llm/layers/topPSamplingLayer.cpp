@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -63,7 +63,10 @@ void TopPSamplingLayer<T>::allocateBuffer(SizeType32 batchSize)
     }
     else
     {
-        mWorkspaceSize = getAirTopPWorkspaceSize<T>(batchSize, mDecoderDomain.getVocabSizePadded(), mIsDeterministic);
+        // The adaptive dispatch in forwardAsync may fall back to the sort-based kernel,
+        // so reserve enough workspace for either algorithm.
+        mWorkspaceSize = std::max(getTopPWorkspaceSize<T>(batchSize, mDecoderDomain.getVocabSizePadded()),
+            getAirTopPWorkspaceSize<T>(batchSize, mDecoderDomain.getVocabSizePadded(), mIsDeterministic));
     }
 
     auto const batchSizeShape = ITensor::makeShape({batchSize});
@@ -281,9 +284,24 @@ void TopPSamplingLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> con
     }
     else
     {
-        params.blockNum = mAirTopPBlockNum;
-        params.isDeterministic = mIsDeterministic;
-        invokeBatchAirTopPSampling<T>(params, getStream());
+        // Batch-wide adaptive algorithm selection. AIR Top-P wins while it can spread several blocks per
+        // sample; once the block number calculation degenerates to one block per sample and the batch alone
+        // saturates the GPU, every block scans the whole vocab in multiple passes and the sort-based kernel
+        // is cheaper.
+        if (mAirTopPBlockNum > 1 || batchSize < mDeviceProp.multiProcessorCount)
+        {
+            params.blockNum = mAirTopPBlockNum;
+            params.isDeterministic = mIsDeterministic;
+            invokeBatchAirTopPSampling<T>(params, getStream());
+            mAirTopPLaunchCount += 1;
+        }
+        else
+        {
+            invokeBatchTopPSampling<T>(params, getStream());
+            mSortedTopPLaunchCount += 1;
+        }
+        TLLM_LOG_DEBUG(
+            "TopP sampling launch split: %zu AIR, %zu sort-based", mAirTopPLaunchCount, mSortedTopPLaunchCount);
     }
 
     sync_check_cuda_error(getStream());
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  * Copyright (c) 2021, NAVER Corp.  Authored by CLOVA.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -63,6 +63,10 @@ protected:
     bool mIsDeterministic{true};
     bool mIsAirTopP{false};
 
+    // Launch counters for the adaptive algorithm selection, exposed via debug logs.
+    std::size_t mAirTopPLaunchCount{0};
+    std::size_t mSortedTopPLaunchCount{0};
+
     using Base::mDecoderDomain;
 
 private:
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -108,6 +108,7 @@ void initBindings(nb::module_& m)
         .def("add_new_tokens", &GenLlmReq::addNewTokens, nb::arg("beam_tokens"))
         .def_prop_ro("num_draft_tokens", &GenLlmReq::getNumDraftTokens)
         .def("set_generated_tokens", &GenLlmReq::setGeneratedTokens, nb::arg("generated_beam_tokens"))
+        .def("rewind_tokens", &GenLlmReq::rewindTokens, nb::arg("num_tokens"))
         .def("pause", &GenLlmReq::pause, nb::arg("max_input_len"))
         .def_prop_rw("max_sent_token_len", &GenLlmReq::getMaxSentTokenLen, &GenLlmReq::setMaxSentTokenLen)
         .def_prop_ro("prompt_embedding_table", &GenLlmReq::getPromptEmbeddingTable)
@@ -115,6 +116,7 @@ void initBindings(nb::module_& m)
         .def_prop_ro("mrope_rotary_cos_sin", &GenLlmReq::getMropeRotaryCosSin)
         .def_prop_ro("bad_words_list", &GenLlmReq::getBadWordsList)
         .def_prop_rw("draft_logits", &GenLlmReq::getDraftLogits, &GenLlmReq::setDraftLogits)
+        .def_rw("logits_post_processor_bias_tensor", &GenLlmReq::mLogitsPostProcessorBiasTensor)
         .def_prop_ro("embedding_bias", &GenLlmReq::getEmbeddingBias)
         .def_prop_rw("lora_config", &GenLlmReq::getLoraConfig, &GenLlmReq::setLoraConfig)
         .def_prop_rw("lora_weights", &GenLlmReq::getLoraWeights, &GenLlmReq::setLoraWeights)
@@ -456,6 +458,15 @@ void initBindings(nb::module_& m)
         .def("get_state_indices", &tb::rnn_state_manager::RnnStateManager::getStateIndices, nb::arg("request_ids"),
             nb::arg("is_padding"), nb::call_guard<nb::gil_scoped_release>())
         .def("get_num_local_layers", &tb::rnn_state_manager::RnnStateManager::getNumLocalLayers,
+            nb::call_guard<nb::gil_scoped_release>())
+        .def("set_max_state_checkpoints", &tb::rnn_state_manager::RnnStateManager::setMaxStateCheckpoints,
+            nb::arg("max_state_checkpoints"), nb::call_guard<nb::gil_scoped_release>())
+        .def("store_state_checkpoint", &tb::rnn_state_manager::RnnStateManager::storeStateCheckpoint,
+            nb::arg("request_id"), nb::arg("prefix_key"), nb::arg("prefix_length"),
+            nb::call_guard<nb::gil_scoped_release>())
+        .def("try_restore_state_checkpoint", &tb::rnn_state_manager::RnnStateManager::tryRestoreStateCheckpoint,
+            nb::arg("request_id"), nb::arg("prefix_key"), nb::call_guard<nb::gil_scoped_release>())
+        .def("get_num_state_checkpoints", &tb::rnn_state_manager::RnnStateManager::getNumStateCheckpoints,
             nb::call_guard<nb::gil_scoped_release>());
 
     m.def(
@@ -129,6 +129,20 @@ void KVCacheManagerV2UtilsBindings::initBindings(nb::module_& module)
         nb::arg("tasks"), nb::arg("num_bytes"), nb::arg("stream"), nb::call_guard<nb::gil_scoped_release>(),
         "Copy data from device to device using CUDA kernels");
 
+    module.def(
+        "migrate_device_pages",
+        [](std::vector<MemAddress> const& dstPages, ssize_t dstTokensPerPage, ssize_t dstTokenBeg,
+            std::vector<MemAddress> const& srcPages, ssize_t srcTokensPerPage, ssize_t srcTokenBeg, ssize_t numTokens,
+            ssize_t bytesPerToken, uintptr_t stream) -> int
+        {
+            return migrateDevicePages(dstPages, dstTokensPerPage, dstTokenBeg, srcPages, srcTokensPerPage, srcTokenBeg,
+                numTokens, bytesPerToken, reinterpret_cast<CUstream>(stream));
+        },
+        nb::arg("dst_pages"), nb::arg("dst_tokens_per_page"), nb::arg("dst_token_beg"), nb::arg("src_pages"),
+        nb::arg("src_tokens_per_page"), nb::arg("src_token_beg"), nb::arg("num_tokens"), nb::arg("bytes_per_token"),
+        nb::arg("stream"), nb::call_guard<nb::gil_scoped_release>(),
+        "Re-block cache content between pools with different page geometries on device");
+
     module.def(
         "copy_batch_block_offsets_to_device",
         [](at::Tensor input, at::Tensor output, at::Tensor copyIndex, at::Tensor indexScales, at::Tensor kvOffset,
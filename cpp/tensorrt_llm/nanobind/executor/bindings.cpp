@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -142,6 +142,17 @@ void initBindings(nb::module_& m)
         .def_rw("iter_latency_ms", &tle::SpecDecodingStats::iterLatencyMS)
         .def_rw("draft_overhead", &tle::SpecDecodingStats::draftOverhead);
 
+    nb::class_<tle::KernelExperimentStats>(m, "KernelExperimentStats")
+        .def(nb::init<>())
+        .def_rw("name", &tle::KernelExperimentStats::name)
+        .def_rw("fraction_b", &tle::KernelExperimentStats::fractionB)
+        .def_rw("num_samples_a", &tle::KernelExperimentStats::numSamplesA)
+        .def_rw("num_samples_b", &tle::KernelExperimentStats::numSamplesB)
+        .def_rw("avg_latency_a_ms", &tle::KernelExperimentStats::avgLatencyAMS)
+        .def_rw("avg_latency_b_ms", &tle::KernelExperimentStats::avgLatencyBMS)
+        .def_rw("latency_histogram_a", &tle::KernelExperimentStats::latencyHistogramA)
+        .def_rw("latency_histogram_b", &tle::KernelExperimentStats::latencyHistogramB);
+
     nb::class_<tle::IterationStats>(m, "IterationStats")
         .def(nb::init<>())
         .def_rw("timestamp", &tle::IterationStats::timestamp)
@@ -161,6 +172,7 @@ void initBindings(nb::module_& m)
         .def_rw("static_batching_stats", &tle::IterationStats::staticBatchingStats)
         .def_rw("inflight_batching_stats", &tle::IterationStats::inflightBatchingStats)
         .def_rw("specdec_stats", &tle::IterationStats::specDecodingStats)
+        .def_rw("kernel_experiment_stats", &tle::IterationStats::kernelExperimentStats)
         .def("to_json_str",
             [](tle::IterationStats const& iterationStats)
             { return tle::JsonSerialization::toJsonStr(iterationStats); });
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -32,6 +32,9 @@
 #include <nanobind/stl/vector.h>
 #include <torch/extension.h>
 
+#include <limits>
+#include <type_traits>
+
 namespace nb = nanobind;
 namespace tle = tensorrt_llm::executor;
 
@@ -181,6 +184,71 @@ void Executor::shutdown()
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+nb::tuple Executor::awaitTokenEvents(std::optional<std::chrono::milliseconds> const& timeout)
+{
+    std::vector<tle::Response> responses;
+    {
+        // Await responses blocks until a response is received. Release GIL so that it can be ran in a background
+        // thread.
+        nb::gil_scoped_release release;
+        responses = mExecutor->awaitResponses(timeout);
+    }
+
+    // The flat arrays are filled in C++ and handed to numpy without copying; per-token marshalling into Python
+    // objects is what dominates binding cost at high aggregate token rates.
+    auto* reqIds = new std::vector<uint64_t>();
+    auto* tokens = new std::vector<int32_t>();
+    auto* logProbs = new std::vector<float>();
+    auto* finishedReqIds = new std::vector<uint64_t>();
+    nb::list fallbackResponses;
+
+    for (auto const& response : responses)
+    {
+        if (response.hasError())
+        {
+            fallbackResponses.append(nb::cast(response));
+            continue;
+        }
+        auto const& result = response.getResult();
+        if (result.outputTokenIds.size() != 1)
+        {
+            // Beam search results keep the full Response object; the flat stream targets streaming decode.
+            fallbackResponses.append(nb::cast(response));
+            continue;
+        }
+        auto const requestId = response.getRequestId();
+        auto const& beamTokens = result.outputTokenIds.front();
+        float const* beamLogProbs = nullptr;
+        if (result.logProbs.has_value() && !result.logProbs->empty()
+            && result.logProbs->front().size() >= beamTokens.size())
+        {
+            // The log probs vector accumulates over the request; take the entries matching this delta.
+            beamLogProbs = result.logProbs->front().data() + result.logProbs->front().size() - beamTokens.size();
+        }
+        for (std::size_t i = 0; i < beamTokens.size(); ++i)
+        {
+            reqIds->push_back(requestId);
+            tokens->push_back(beamTokens[i]);
+            logProbs->push_back(beamLogProbs != nullptr ? static_cast<float>(beamLogProbs[i])
+                                                        : std::numeric_limits<float>::quiet_NaN());
+        }
+        if (result.isFinal)
+        {
+            finishedReqIds->push_back(requestId);
+        }
+    }
+
+    auto const makeArray = [](auto* vec)
+    {
+        using VecT = std::remove_pointer_t<decltype(vec)>;
+        using T = typename VecT::value_type;
+        nb::capsule owner(vec, [](void* ptr) noexcept { delete static_cast<VecT*>(ptr); });
+        return nb::ndarray<nb::numpy, T>(vec->data(), {vec->size()}, owner);
+    };
+    return nb::make_tuple(
+        makeArray(reqIds), makeArray(tokens), makeArray(logProbs), makeArray(finishedReqIds), fallbackResponses);
+}
+
 void Executor::initBindings(nb::module_& m)
 {
     nb::class_<Executor>(m, "Executor")
@@ -213,6 +281,11 @@ void Executor::initBindings(nb::module_& m)
             nb::overload_cast<std::vector<tle::IdType> const&, std::optional<std::chrono::milliseconds> const&>(
                 &Executor::awaitResponses),
             nb::arg("ids"), nb::arg("timeout") = nb::none())
+        .def("await_token_events", &Executor::awaitTokenEvents, nb::arg("timeout") = nb::none(),
+            "Opt-in fast path beside await_responses: drains ready responses into flat numpy arrays (req_ids, "
+            "tokens, log_probs, finished_req_ids, fallback_responses) without creating a Python object per token. "
+            "log_probs entries are NaN when log probs were not requested. Responses that cannot be flattened "
+            "(errors, beam search) are returned as Response objects in fallback_responses.")
         .def("get_num_responses_ready", &Executor::getNumResponsesReady, nb::arg("id") = nb::none())
         .def("cancel_request", &Executor::cancelRequest, nb::arg("id") = nb::none())
         .def("get_latest_iteration_stats", &Executor::getLatestIterationStats)
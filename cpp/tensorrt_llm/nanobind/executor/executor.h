@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -85,6 +85,10 @@ public:
         return mExecutor->awaitResponses(requestIds, timeout);
     }
 
+    // Opt-in fast path beside awaitResponses: drains ready responses into flat per-token arrays without creating a
+    // Python object per token. Returns (req_ids, tokens, log_probs, finished_req_ids, fallback_responses).
+    [[nodiscard]] nb::tuple awaitTokenEvents(std::optional<std::chrono::milliseconds> const& timeout = std::nullopt);
+
     [[nodiscard]] tle::SizeType32 getNumResponsesReady(std::optional<tle::IdType> const& requestId = std::nullopt) const
     {
         return mExecutor->getNumResponsesReady(requestId);
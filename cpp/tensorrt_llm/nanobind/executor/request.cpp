@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -203,17 +203,19 @@ void initRequestBindings(nb::module_& m)
     auto outputConfigGetstate = [](tle::OutputConfig const& self)
     {
         return nb::make_tuple(self.returnLogProbs, self.returnContextLogits, self.returnGenerationLogits,
-            self.excludeInputFromOutput, self.returnEncoderOutput, self.returnPerfMetrics, self.additionalModelOutputs);
+            self.excludeInputFromOutput, self.returnEncoderOutput, self.returnPerfMetrics, self.additionalModelOutputs,
+            self.numTopLogprobs, self.returnPromptLogprobs);
     };
     auto outputConfigSetstate = [](tle::OutputConfig& outputConfig, nb::tuple const& state)
     {
-        if (state.size() != 7)
+        if (state.size() != 9)
         {
             throw std::runtime_error("Invalid OutputConfig state!");
         }
         new (&outputConfig) tle::OutputConfig(nb::cast<bool>(state[0]), nb::cast<bool>(state[1]),
             nb::cast<bool>(state[2]), nb::cast<bool>(state[3]), nb::cast<bool>(state[4]), nb::cast<bool>(state[5]),
-            nb::cast<std::optional<std::vector<tle::AdditionalModelOutput>>>(state[6]));
+            nb::cast<std::optional<std::vector<tle::AdditionalModelOutput>>>(state[6]),
+            nb::cast<tle::SizeType32>(state[7]), nb::cast<bool>(state[8]));
     };
     nb::class_<tle::OutputConfig>(m, "OutputConfig")
         .def(
@@ -221,17 +223,19 @@ void initRequestBindings(nb::module_& m)
             [](tle::OutputConfig& self, std::optional<bool> return_log_probs, std::optional<bool> return_context_logits,
                 std::optional<bool> return_generation_logits, std::optional<bool> exclude_input_from_output,
                 std::optional<bool> return_encoder_output, std::optional<bool> return_perf_metrics,
-                std::optional<std::vector<tle::AdditionalModelOutput>> additional_model_outputs)
+                std::optional<std::vector<tle::AdditionalModelOutput>> additional_model_outputs,
+                std::optional<tle::SizeType32> num_top_logprobs, std::optional<bool> return_prompt_logprobs)
             {
                 new (&self) tle::OutputConfig(return_log_probs.value_or(false), return_context_logits.value_or(false),
                     return_generation_logits.value_or(false), exclude_input_from_output.value_or(false),
                     return_encoder_output.value_or(false), return_perf_metrics.value_or(false),
-                    additional_model_outputs);
+                    additional_model_outputs, num_top_logprobs.value_or(0), return_prompt_logprobs.value_or(false));
             },
             nb::arg("return_log_probs") = nb::none(), nb::arg("return_context_logits") = nb::none(),
             nb::arg("return_generation_logits") = nb::none(), nb::arg("exclude_input_from_output") = nb::none(),
             nb::arg("return_encoder_output") = nb::none(), nb::arg("return_perf_metrics") = nb::none(),
-            nb::arg("additional_model_outputs") = nb::none())
+            nb::arg("additional_model_outputs") = nb::none(), nb::arg("num_top_logprobs") = nb::none(),
+            nb::arg("return_prompt_logprobs") = nb::none())
         .def_rw("return_log_probs", &tle::OutputConfig::returnLogProbs)
         .def_rw("return_context_logits", &tle::OutputConfig::returnContextLogits)
         .def_rw("return_generation_logits", &tle::OutputConfig::returnGenerationLogits)
@@ -239,6 +243,8 @@ void initRequestBindings(nb::module_& m)
         .def_rw("return_encoder_output", &tle::OutputConfig::returnEncoderOutput)
         .def_rw("return_perf_metrics", &tle::OutputConfig::returnPerfMetrics)
         .def_rw("additional_model_outputs", &tle::OutputConfig::additionalModelOutputs)
+        .def_rw("num_top_logprobs", &tle::OutputConfig::numTopLogprobs)
+        .def_rw("return_prompt_logprobs", &tle::OutputConfig::returnPromptLogprobs)
         .def("__getstate__", outputConfigGetstate)
         .def("__setstate__", outputConfigSetstate);
 
@@ -852,11 +858,11 @@ void initRequestBindings(nb::module_& m)
     auto requestPerfMetricsGetstate = [](tle::RequestPerfMetrics const& self)
     {
         return nb::make_tuple(self.timingMetrics, self.kvCacheMetrics, self.speculativeDecoding, self.firstIter,
-            self.lastIter, self.iter);
+            self.lastIter, self.iter, self.attributedGpuTimeMs);
     };
     auto requestPerfMetricsSetstate = [](tle::RequestPerfMetrics& self, nb::tuple const& state)
     {
-        if (state.size() != 6)
+        if (state.size() != 7)
         {
             throw std::runtime_error("Invalid RequestPerfMetrics state!");
         }
@@ -865,7 +871,7 @@ void initRequestBindings(nb::module_& m)
             nb::cast<tle::RequestPerfMetrics::SpeculativeDecodingMetrics>(state[2]),
             nb::cast<std::optional<tle::IterationType>>(state[3]),
             nb::cast<std::optional<tle::IterationType>>(state[4]),
-            nb::cast<std::optional<tle::IterationType>>(state[5])};
+            nb::cast<std::optional<tle::IterationType>>(state[5]), nb::cast<float>(state[6])};
     };
 
     // There's a circular dependency between the declaration of the TimingMetrics and RequestPerfMetrics bindings.
@@ -877,6 +883,7 @@ void initRequestBindings(nb::module_& m)
         .def_rw("first_iter", &tle::RequestPerfMetrics::firstIter)
         .def_rw("last_iter", &tle::RequestPerfMetrics::lastIter)
         .def_rw("iter", &tle::RequestPerfMetrics::iter)
+        .def_rw("attributed_gpu_time_ms", &tle::RequestPerfMetrics::attributedGpuTimeMs)
         .def("__getstate__", requestPerfMetricsGetstate)
         .def("__setstate__", requestPerfMetricsSetstate);
 
@@ -887,7 +894,7 @@ void initRequestBindings(nb::module_& m)
 
     auto resultSetstate = [](tle::Result& self, nb::tuple const& state)
     {
-        if (state.size() != 14)
+        if (state.size() != 16)
         {
             throw std::runtime_error("Invalid Request state!");
         }
@@ -906,6 +913,9 @@ void initRequestBindings(nb::module_& m)
         result.avgDecodedTokensPerIter = nb::cast<float>(state[11]);
         result.contextPhaseParams = nb::cast<std::optional<tle::ContextPhaseParams>>(state[12]);
         result.requestPerfMetrics = nb::cast<std::optional<tle::RequestPerfMetrics>>(state[13]);
+        result.topLogprobs
+            = nb::cast<std::optional<std::vector<std::vector<std::pair<tle::TokenIdType, float>>>>>(state[14]);
+        result.promptLogprobs = nb::cast<std::optional<std::vector<float>>>(state[15]);
         new (&self) tle::Result(result);
     };
 
@@ -913,7 +923,8 @@ void initRequestBindings(nb::module_& m)
     {
         return nb::make_tuple(self.isFinal, self.outputTokenIds, self.cumLogProbs, self.logProbs, self.contextLogits,
             self.generationLogits, self.encoderOutput, self.finishReasons, self.sequenceIndex, self.isSequenceFinal,
-            self.decodingIter, self.avgDecodedTokensPerIter, self.contextPhaseParams, self.requestPerfMetrics);
+            self.decodingIter, self.avgDecodedTokensPerIter, self.contextPhaseParams, self.requestPerfMetrics,
+            self.topLogprobs, self.promptLogprobs);
     };
 
     nb::class_<tle::Result>(m, "Result")
@@ -922,6 +933,8 @@ void initRequestBindings(nb::module_& m)
         .def_rw("output_token_ids", &tle::Result::outputTokenIds)
         .def_rw("cum_log_probs", &tle::Result::cumLogProbs, nb::arg("cum_log_probs").none())
         .def_rw("log_probs", &tle::Result::logProbs, nb::arg("log_probs").none())
+        .def_rw("top_logprobs", &tle::Result::topLogprobs, nb::arg("top_logprobs").none())
+        .def_rw("prompt_logprobs", &tle::Result::promptLogprobs, nb::arg("prompt_logprobs").none())
         .def_rw("context_logits", &tle::Result::contextLogits, nb::arg("context_logits").none())
         .def_rw("generation_logits", &tle::Result::generationLogits, nb::arg("generation_logits").none())
         .def_rw("spec_dec_fast_logits_info", &tle::Result::specDecFastLogitsInfo,
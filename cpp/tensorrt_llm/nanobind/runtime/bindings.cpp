@@ -238,6 +238,8 @@ void initBindings(nb::module_& m)
         .def("get_sequence_lengths",
             nb::overload_cast<tr::SizeType32>(&tr::decoder::DecoderState::getSequenceLengths, nb::const_),
             nb::arg("batch_idx"), nb::call_guard<nb::gil_scoped_release>())
+        .def("set_sequence_lengths", &tr::decoder::DecoderState::setSequenceLengths, nb::arg("batch_idx"),
+            nb::arg("beam_lengths"), nb::arg("buffer_manager"), nb::call_guard<nb::gil_scoped_release>())
         .def_prop_ro("all_new_tokens", &tr::decoder::DecoderState::getAllNewTokens)
         .def_prop_ro("finished_sum", &tr::decoder::DecoderState::getFinishedSum)
         .def_prop_ro("finish_reasons", &tr::decoder::DecoderState::getFinishReasons)
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,6 +16,7 @@
  */
 #include "recvPlugin.h"
 
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
@@ -55,6 +56,10 @@ nvinfer1::IPluginV2DynamicExt* RecvPlugin::clone() const noexcept
 {
     auto* plugin = new RecvPlugin(*this);
     plugin->setPluginNamespace(mNamespace.c_str());
+    // The overlap resources are created in initialize() and owned per instance.
+    plugin->mRecvStream = nullptr;
+    plugin->mRecvReadyEvent = nullptr;
+    plugin->mRecvDoneEvent = nullptr;
     return plugin;
 }
 
@@ -94,7 +99,21 @@ int RecvPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc, nvinfer1::P
         size *= inputDesc[0].dims.d[i];
     }
     TLLM_LOG_DEBUG("start ncclRecv with size %d", size);
-    NCCLCHECK(ncclRecv(outputs[0], size, (*getDtypeMap())[inputDesc[0].type], 0, mComm, stream));
+    if (mRecvStream != nullptr)
+    {
+        // The recv result is a true dependency of the downstream layers, so the compute stream
+        // has to wait for it; running the blocking NCCL kernel on a side stream still keeps it
+        // off the engine stream so the paired overlapped send can progress independently.
+        TLLM_CUDA_CHECK(cudaEventRecord(mRecvReadyEvent, stream));
+        TLLM_CUDA_CHECK(cudaStreamWaitEvent(mRecvStream, mRecvReadyEvent, 0));
+        NCCLCHECK(ncclRecv(outputs[0], size, (*getDtypeMap())[inputDesc[0].type], 0, mComm, mRecvStream));
+        TLLM_CUDA_CHECK(cudaEventRecord(mRecvDoneEvent, mRecvStream));
+        TLLM_CUDA_CHECK(cudaStreamWaitEvent(stream, mRecvDoneEvent, 0));
+    }
+    else
+    {
+        NCCLCHECK(ncclRecv(outputs[0], size, (*getDtypeMap())[inputDesc[0].type], 0, mComm, stream));
+    }
     TLLM_LOG_DEBUG("end ncclRecv with size %d", size);
 
     return 0;
@@ -141,6 +160,13 @@ int RecvPlugin::initialize() noexcept
     setenv("NCCL_RUNTIME_CONNECT", "0", 0);
 #endif // _WIN32
     NCCLCHECK(ncclCommInitRank(&mComm, 2, id, 1));
+
+    if (tensorrt_llm::common::getEnvPPCommOverlap())
+    {
+        TLLM_CUDA_CHECK(cudaStreamCreateWithFlags(&mRecvStream, cudaStreamNonBlocking));
+        TLLM_CUDA_CHECK(cudaEventCreateWithFlags(&mRecvReadyEvent, cudaEventDisableTiming));
+        TLLM_CUDA_CHECK(cudaEventCreateWithFlags(&mRecvDoneEvent, cudaEventDisableTiming));
+    }
     return 0;
 }
 
@@ -150,6 +176,16 @@ void RecvPlugin::terminate() noexcept
     {
         return;
     }
+    if (mRecvStream != nullptr)
+    {
+        cudaStreamSynchronize(mRecvStream);
+        cudaEventDestroy(mRecvReadyEvent);
+        cudaEventDestroy(mRecvDoneEvent);
+        cudaStreamDestroy(mRecvStream);
+        mRecvStream = nullptr;
+        mRecvReadyEvent = nullptr;
+        mRecvDoneEvent = nullptr;
+    }
     NCCLCHECK(ncclCommDestroy(mComm));
 }
 
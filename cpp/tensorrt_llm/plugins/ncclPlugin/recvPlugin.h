@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -18,6 +18,7 @@
 
 #include "tensorrt_llm/plugins/common/plugin.h"
 #include <cassert>
+#include <cuda_runtime_api.h>
 #include <string>
 #include <vector>
 
@@ -64,6 +65,13 @@ private:
     ncclComm_t mComm; // TODO: Remove this
     int mSrcRank;
     nvinfer1::DataType mType;
+
+    // Overlapped recv path (TRTLLM_PP_COMM_OVERLAP): ncclRecv runs on a dedicated stream,
+    // bracketed by events against the compute stream, so the blocking NCCL kernel does not
+    // occupy the engine's execution stream.
+    cudaStream_t mRecvStream{nullptr};
+    cudaEvent_t mRecvReadyEvent{nullptr};
+    cudaEvent_t mRecvDoneEvent{nullptr};
 };
 
 class RecvPluginCreator : public BaseCreator
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,6 +16,8 @@
  */
 #include "sendPlugin.h"
 
+#include "tensorrt_llm/common/dataType.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
@@ -56,6 +58,13 @@ nvinfer1::IPluginV2DynamicExt* SendPlugin::clone() const noexcept
 {
     auto* plugin = new SendPlugin(*this);
     plugin->setPluginNamespace(mNamespace.c_str());
+    // The overlap resources are created in initialize() and owned per instance.
+    plugin->mSendStream = nullptr;
+    plugin->mStagingReadyEvents = {};
+    plugin->mSendDoneEvents = {};
+    plugin->mStagingBuffers = {};
+    plugin->mStagingCapacity = 0;
+    plugin->mStagingIdx = 0;
     return plugin;
 }
 
@@ -96,7 +105,37 @@ int SendPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc, nvinfer1::P
     }
 
     TLLM_LOG_DEBUG("start ncclSend with size %d", size);
-    NCCLCHECK(ncclSend(inputs[0], size, (*getDtypeMap())[inputDesc[0].type], 1, mComm, stream));
+    if (mSendStream != nullptr)
+    {
+        size_t const bytes = size * tensorrt_llm::common::getDTypeSize(inputDesc[0].type);
+        int const slot = mStagingIdx;
+        if (bytes > mStagingCapacity)
+        {
+            for (int i = 0; i < 2; ++i)
+            {
+                TLLM_CUDA_CHECK(cudaEventSynchronize(mSendDoneEvents[i]));
+                if (mStagingBuffers[i] != nullptr)
+                {
+                    TLLM_CUDA_CHECK(cudaFree(mStagingBuffers[i]));
+                }
+                TLLM_CUDA_CHECK(cudaMalloc(&mStagingBuffers[i], bytes));
+            }
+            mStagingCapacity = bytes;
+        }
+        // Reuse a staging slot only once its previous send has drained; with two slots this
+        // keeps one transfer in flight while the compute stream moves on.
+        TLLM_CUDA_CHECK(cudaStreamWaitEvent(stream, mSendDoneEvents[slot], 0));
+        TLLM_CUDA_CHECK(cudaMemcpyAsync(mStagingBuffers[slot], inputs[0], bytes, cudaMemcpyDeviceToDevice, stream));
+        TLLM_CUDA_CHECK(cudaEventRecord(mStagingReadyEvents[slot], stream));
+        TLLM_CUDA_CHECK(cudaStreamWaitEvent(mSendStream, mStagingReadyEvents[slot], 0));
+        NCCLCHECK(ncclSend(mStagingBuffers[slot], size, (*getDtypeMap())[inputDesc[0].type], 1, mComm, mSendStream));
+        TLLM_CUDA_CHECK(cudaEventRecord(mSendDoneEvents[slot], mSendStream));
+        mStagingIdx ^= 1;
+    }
+    else
+    {
+        NCCLCHECK(ncclSend(inputs[0], size, (*getDtypeMap())[inputDesc[0].type], 1, mComm, stream));
+    }
     TLLM_LOG_DEBUG("end ncclSend with size %d", size);
     return 0;
 }
@@ -144,6 +183,18 @@ int SendPlugin::initialize() noexcept
     setenv("NCCL_RUNTIME_CONNECT", "0", 0);
 #endif // _WIN32
     NCCLCHECK(ncclCommInitRank(&mComm, 2, id, 0));
+
+    if (tensorrt_llm::common::getEnvPPCommOverlap())
+    {
+        TLLM_CUDA_CHECK(cudaStreamCreateWithFlags(&mSendStream, cudaStreamNonBlocking));
+        for (int i = 0; i < 2; ++i)
+        {
+            TLLM_CUDA_CHECK(cudaEventCreateWithFlags(&mStagingReadyEvents[i], cudaEventDisableTiming));
+            TLLM_CUDA_CHECK(cudaEventCreateWithFlags(&mSendDoneEvents[i], cudaEventDisableTiming));
+            // Mark both slots as drained for their first use.
+            TLLM_CUDA_CHECK(cudaEventRecord(mSendDoneEvents[i], mSendStream));
+        }
+    }
     return 0;
 }
 
@@ -153,6 +204,24 @@ void SendPlugin::terminate() noexcept
     {
         return;
     }
+    if (mSendStream != nullptr)
+    {
+        cudaStreamSynchronize(mSendStream);
+        for (int i = 0; i < 2; ++i)
+        {
+            cudaEventDestroy(mStagingReadyEvents[i]);
+            cudaEventDestroy(mSendDoneEvents[i]);
+            if (mStagingBuffers[i] != nullptr)
+            {
+                cudaFree(mStagingBuffers[i]);
+                mStagingBuffers[i] = nullptr;
+            }
+        }
+        cudaStreamDestroy(mSendStream);
+        mSendStream = nullptr;
+        mStagingCapacity = 0;
+        mStagingIdx = 0;
+    }
     NCCLCHECK(ncclCommDestroy(mComm));
 }
 
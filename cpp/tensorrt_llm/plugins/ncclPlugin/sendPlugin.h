@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2022 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,6 +17,8 @@
 #pragma once
 
 #include "tensorrt_llm/plugins/common/plugin.h"
+#include <array>
+#include <cuda_runtime_api.h>
 #include <string>
 #include <vector>
 
@@ -63,6 +65,16 @@ private:
     ncclComm_t mComm; // TODO: Remove this
     int mTgtRank;
     nvinfer1::DataType mType;
+
+    // Overlapped send path (TRTLLM_PP_COMM_OVERLAP): the boundary activation is copied into a
+    // double-buffered staging tensor on the compute stream and ncclSend runs on a dedicated
+    // stream, so subsequent compute is not serialized behind the transfer.
+    cudaStream_t mSendStream{nullptr};
+    std::array<cudaEvent_t, 2> mStagingReadyEvents{};
+    std::array<cudaEvent_t, 2> mSendDoneEvents{};
+    std::array<void*, 2> mStagingBuffers{};
+    size_t mStagingCapacity{0};
+    int mStagingIdx{0};
 };
 
 class SendPluginCreator : public BaseCreator
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2022 NVIDIA CORPORATION &
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION &
  * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -111,10 +111,10 @@ std::vector<WeightOnlyGroupwiseQuantGemmPluginProfiler::Config> WeightOnlyGroupw
 
 bool WeightOnlyGroupwiseQuantGemmPluginProfiler::checkTactic(int m, int n, int k, Config const& tactic) const
 {
-    // stop to profile Cuda kernel for m >= 16
+    // stop to profile Cuda kernel for m beyond the tiled GEMV range
     if (tactic.enableCudaKernel)
     {
-        return m < 16;
+        return m <= tensorrt_llm::kernels::weight_only::kMaxSupportedM;
     }
     return true;
 }
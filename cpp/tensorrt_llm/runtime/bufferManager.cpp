@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,9 +20,13 @@
 #include "tensorrt_llm/common/memoryUtils.h"
 #include "tllmBuffers.h"
 
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <cuda_runtime_api.h>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace tc = tensorrt_llm::common;
 
@@ -281,4 +285,52 @@ void BufferManager::memoryPoolTrimTo(std::size_t size)
     }
     mPool->memoryPoolTrimTo(size);
 }
+
+namespace
+{
+std::array<std::atomic<std::size_t>, BufferManager::kNumTransferClasses>& transferredBytesCounters()
+{
+    static std::array<std::atomic<std::size_t>, BufferManager::kNumTransferClasses> counters{};
+    return counters;
+}
+} // namespace
+
+BufferManager::CudaStreamPtr BufferManager::getTransferStream(TransferClass transferClass)
+{
+    auto const classIdx = static_cast<std::size_t>(transferClass);
+    TLLM_CHECK(classIdx < kNumTransferClasses);
+
+    static std::mutex mutex;
+    static std::unordered_map<int, std::array<CudaStreamPtr, kNumTransferClasses>> streamsPerDevice;
+
+    auto const device = tc::getDevice();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& streams = streamsPerDevice[device];
+    if (!streams[classIdx])
+    {
+        int leastPriority{0};
+        int greatestPriority{0};
+        TLLM_CUDA_CHECK(cudaDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority));
+        // Lower numbers are higher priority; classes not listed here use the default priority.
+        auto const priority = transferClass == TransferClass::kLATENCY ? greatestPriority
+            : transferClass == TransferClass::kOFFLOAD                 ? leastPriority
+                                                                       : 0;
+        streams[classIdx] = std::make_shared<CudaStream>(cudaStreamNonBlocking, priority);
+    }
+    return streams[classIdx];
+}
+
+void BufferManager::accountTransfer(TransferClass transferClass, std::size_t bytes)
+{
+    auto const classIdx = static_cast<std::size_t>(transferClass);
+    TLLM_CHECK(classIdx < kNumTransferClasses);
+    transferredBytesCounters()[classIdx].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+std::size_t BufferManager::getTransferredBytes(TransferClass transferClass)
+{
+    auto const classIdx = static_cast<std::size_t>(transferClass);
+    TLLM_CHECK(classIdx < kNumTransferClasses);
+    return transferredBytesCounters()[classIdx].load(std::memory_order_relaxed);
+}
 } // namespace tensorrt_llm::runtime
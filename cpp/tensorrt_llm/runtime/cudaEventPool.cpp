@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/cudaEventPool.h"
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace tensorrt_llm::runtime
+{
+
+namespace
+{
+
+/// @brief The maximum number of devices per node this feature supports. Increase when/if this value becomes too small.
+constexpr std::size_t maxDevicePerNode = 64;
+
+/// @brief One pool per event creation flags, appended on first use.
+struct FlagsEntry
+{
+    unsigned int mFlags;
+    CudaEventPool* mPool;
+};
+
+/// @brief Ensures thread safe creation of the per-device pools.
+std::mutex poolRegistryMutex{};
+
+/// @brief The pools for each device. Entries are appended under poolRegistryMutex and published through
+/// mEntryCount, so lookups on the hot path are lock-free. Pools are deliberately never destroyed: events may be
+/// recycled during static teardown, after any registry destructor would have run.
+struct DeviceRegistry
+{
+    std::atomic<std::size_t> mEntryCount{0};
+    std::array<FlagsEntry, 8> mEntries{};
+};
+
+std::array<DeviceRegistry, maxDevicePerNode> poolRegistry{};
+
+} // namespace
+
+CudaEventPool& CudaEventPool::instance(unsigned int flags)
+{
+    auto const deviceId = common::getDevice();
+    TLLM_CHECK_WITH_INFO(static_cast<std::size_t>(deviceId) < maxDevicePerNode,
+        "Device id %d exceeds the maximum number of devices per node supported by CudaEventPool.", deviceId);
+    auto& registry = poolRegistry[deviceId];
+    auto const publishedCount = registry.mEntryCount.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < publishedCount; ++i)
+    {
+        if (registry.mEntries[i].mFlags == flags)
+        {
+            return *registry.mEntries[i].mPool;
+        }
+    }
+    std::lock_guard<std::mutex> lock{poolRegistryMutex};
+    auto const count = registry.mEntryCount.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (registry.mEntries[i].mFlags == flags)
+        {
+            return *registry.mEntries[i].mPool;
+        }
+    }
+    TLLM_CHECK_WITH_INFO(
+        count < registry.mEntries.size(), "Too many distinct event creation flags requested from CudaEventPool.");
+    auto* pool = new CudaEventPool{deviceId, flags};
+    registry.mEntries[count] = FlagsEntry{flags, pool};
+    registry.mEntryCount.store(count + 1, std::memory_order_release);
+    return *pool;
+}
+
+CudaEventPool::CudaEventPool(int deviceId, unsigned int flags)
+    : mDeviceId{deviceId}
+    , mFlags{flags}
+    , mCells{std::make_unique<Cell[]>(kCapacity)}
+{
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of two");
+    for (std::size_t i = 0; i < kCapacity; ++i)
+    {
+        mCells[i].mGeneration.store(i, std::memory_order_relaxed);
+        mCells[i].mEvent = nullptr;
+    }
+    TLLM_LOG_DEBUG("Created CudaEventPool for device %d with flags %u", deviceId, flags);
+}
+
+CudaEvent CudaEventPool::acquire()
+{
+    auto pos = mTakePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = mCells[pos & (kCapacity - 1)];
+        auto const generation = cell.mGeneration.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::int64_t>(generation) - static_cast<std::int64_t>(pos + 1);
+        if (diff == 0)
+        {
+            if (mTakePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                auto* event = cell.mEvent;
+                cell.mGeneration.store(pos + kCapacity, std::memory_order_release);
+                return CudaEvent{event, &CudaEventPool::recycle, this};
+            }
+        }
+        else if (diff < 0)
+        {
+            // The ring is empty; fall back to creating a fresh event.
+            cudaEvent_t event{};
+            TLLM_CUDA_CHECK(::cudaEventCreate(&event, mFlags));
+            TLLM_LOG_TRACE("Created event %p for pool %p", event, this);
+            return CudaEvent{event, &CudaEventPool::recycle, this};
+        }
+        else
+        {
+            pos = mTakePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void CudaEventPool::recycle(cudaEvent_t event, void* poolPtr)
+{
+    auto* pool = static_cast<CudaEventPool*>(poolPtr);
+    auto pos = pool->mPutPos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = pool->mCells[pos & (kCapacity - 1)];
+        auto const generation = cell.mGeneration.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::int64_t>(generation) - static_cast<std::int64_t>(pos);
+        if (diff == 0)
+        {
+            if (pool->mPutPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.mEvent = event;
+                cell.mGeneration.store(pos + 1, std::memory_order_release);
+                return;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The ring is full; fall back to destroying the event.
+            TLLM_CUDA_CHECK_FREE_RESOURCE(::cudaEventDestroy(event));
+            TLLM_LOG_TRACE("Destroyed event %p from pool %p", event, pool);
+            return;
+        }
+        else
+        {
+            pos = pool->mPutPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace tensorrt_llm::runtime
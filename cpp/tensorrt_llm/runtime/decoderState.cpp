@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -533,6 +533,16 @@ TensorPtr DecoderState::getSequenceLengths(SizeType32 batchIdx) const
     return ITensor::at(mJointDecodingOutput->lengths, {batchIdx});
 }
 
+void DecoderState::setSequenceLengths(
+    SizeType32 batchIdx, std::vector<SizeType32> const& beamLengths, BufferManager const& bufferManager)
+{
+    auto sequenceLengths = getSequenceLengths(batchIdx);
+    TLLM_CHECK_WITH_INFO(beamLengths.size() <= sequenceLengths->getSize(),
+        "Expected at most %zu beam lengths, got %zu.", sequenceLengths->getSize(), beamLengths.size());
+    auto slice = ITensor::slice(sequenceLengths, 0, static_cast<SizeType32>(beamLengths.size()));
+    bufferManager.copy(beamLengths.data(), *slice, MemoryType::kCPU);
+}
+
 TensorPtr DecoderState::getAllNewTokens() const
 {
     return mJointDecodingOutput->newTokensSteps;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 
 #include "tensorrt_llm/runtime/decodingLayerWorkspace.h"
 
+#include <algorithm>
 #include <utility>
 
 tensorrt_llm::runtime::DecodingLayerWorkspace::DecodingLayerWorkspace(std::shared_ptr<BufferManager> bufferManager,
@@ -75,16 +76,27 @@ tensorrt_llm::runtime::DecodingLayerWorkspace::getDeviceRuntimeLogits() const
 
 void tensorrt_llm::runtime::DecodingLayerWorkspace::resize(size_t minSize)
 {
-    if (mWorkspaceDeviceBuffer->getSizeInBytes() < minSize)
+    auto const currentSize = mWorkspaceDeviceBuffer->getSizeInBytes();
+    if (currentSize < minSize)
     {
-        mWorkspaceDeviceBuffer->resize(minSize);
+        // Grow geometrically so that alternating decoding modes or batch compositions quickly reach their
+        // high-water mark and later mode switches never allocate on the critical path. The freed backing
+        // memory returns to the buffer manager's CUDA memory pool and is reused by the larger allocation.
+        auto const newSize = tensorrt_llm::common::alignSize(
+            std::max(minSize, 2 * currentSize), tensorrt_llm::common::kCudaMemAlign);
+        TLLM_LOG_DEBUG(
+            "Growing decoding workspace from %zu to %zu bytes (%zu bytes requested)", currentSize, newSize, minSize);
+        mWorkspaceDeviceBuffer->resize(newSize);
     }
 }
 
 tensorrt_llm::runtime::DecodingLayerWorkspace::TensorPtr
 tensorrt_llm::runtime::DecodingLayerWorkspace::getWorkspaceAsDeviceTensor(ITensor::Shape shape, nvinfer1::DataType type)
 {
-    auto const sizeInBytes = ITensor::volume(shape) * BufferDataType(type).getSize();
+    auto const sizeInBytes = static_cast<size_t>(ITensor::volume(shape)) * BufferDataType(type).getSize();
+    TLLM_CHECK_WITH_INFO(sizeInBytes <= mWorkspaceDeviceBuffer->getSizeInBytes(),
+        "Requested a workspace tensor of %zu bytes, but the workspace only holds %zu bytes", sizeInBytes,
+        mWorkspaceDeviceBuffer->getSizeInBytes());
     return std::make_shared<GenericTensor<BorrowingAllocator<MemoryType::kGPU>>>(
         shape, type, BorrowingAllocator<MemoryType::kGPU>{mWorkspaceDeviceBuffer->data(), sizeInBytes});
 }
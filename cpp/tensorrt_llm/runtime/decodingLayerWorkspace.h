@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -102,7 +102,8 @@ public:
     }
 
     ///@brief Ensures the workspace has at least the provided space in bytes. Does nothing if the workspace is already
-    /// at least as large.
+    /// at least as large. Grows geometrically and never shrinks, so the workspace settles at its high-water mark and
+    /// repeated mode or batch-size changes stop allocating.
     void resize(size_t minSize);
 
     ///@brief Given a collection of tuples of tensor shapes and data types, returns the memory aligned size required to
@@ -130,13 +131,16 @@ public:
     auto mirrorInWorkspace(Args&&... args)
     {
         auto* lastTensorEndPtr = reinterpret_cast<std::int8_t*>(mWorkspaceDeviceBuffer->data());
-        auto tensorFactory = [&lastTensorEndPtr, this](auto const& tensor)
+        auto* const workspaceEndPtr = lastTensorEndPtr + mWorkspaceDeviceBuffer->getSizeInBytes();
+        auto tensorFactory = [&lastTensorEndPtr, workspaceEndPtr, this](auto const& tensor)
         {
             if (tensor == nullptr)
             {
                 return std::unique_ptr<GenericTensor<BorrowingAllocator<MemoryType::kGPU>>>{};
             }
             auto const sizeInBytes = tensor->getSizeInBytes();
+            TLLM_CHECK_WITH_INFO(lastTensorEndPtr + sizeInBytes <= workspaceEndPtr,
+                "Mirroring a tensor of %zu bytes exceeds the remaining workspace", sizeInBytes);
             auto const borrowingAllocator = BorrowingAllocator<MemoryType::kGPU>{lastTensorEndPtr, sizeInBytes};
             auto res = std::make_unique<GenericTensor<BorrowingAllocator<MemoryType::kGPU>>>(
                 tensor->getShape(), tensor->getDataType(), borrowingAllocator);
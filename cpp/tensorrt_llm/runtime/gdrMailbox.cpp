@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/gdrMailbox.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+
+namespace tensorrt_llm::runtime
+{
+
+bool GdrMailbox::supported()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return gdrcopy::initialize();
+#endif
+}
+
+GdrMailbox::GdrMailbox(size_t sizeBytes)
+    : mSizeBytes(sizeBytes)
+{
+    TLLM_CHECK_WITH_INFO(sizeBytes > 0, "GdrMailbox size must be non-zero.");
+    TLLM_CHECK_WITH_INFO(supported(), "GDRCopy is not available; check GdrMailbox::supported() before constructing.");
+    mHandle = gdrcopy::open();
+    TLLM_CHECK_WITH_INFO(mHandle != nullptr, "gdr_open() failed.");
+    gdrcopy::gdrCudaMalloc(&mHostPtr, &mDevicePtr, mSizeBytes, &mMemDesc, mHandle);
+}
+
+GdrMailbox::~GdrMailbox()
+{
+    try
+    {
+        if (mMemDesc != nullptr)
+        {
+            gdrcopy::gdrCudaFree(mMemDesc, mHandle);
+        }
+        if (mHandle != nullptr)
+        {
+            gdrcopy::close(mHandle);
+        }
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_ERROR("Failed to release GdrMailbox resources: %s", e.what());
+    }
+}
+
+void GdrMailbox::hostWrite(size_t offsetBytes, void const* src, size_t sizeBytes)
+{
+    TLLM_CHECK_WITH_INFO(offsetBytes + sizeBytes <= mSizeBytes, "GdrMailbox write out of bounds.");
+    auto* dst = static_cast<char*>(mHostPtr) + offsetBytes;
+    TLLM_CHECK_WITH_INFO(
+        gdrcopy::copy_to_mapping(mMemDesc->gdrMh, dst, src, sizeBytes) == 0, "GDR copy_to_mapping failed.");
+    // Flush the write-combining buffer so the data is visible to the device.
+    gdrcopy::wc_store_fence();
+}
+
+void GdrMailbox::hostRead(size_t offsetBytes, void* dst, size_t sizeBytes) const
+{
+    TLLM_CHECK_WITH_INFO(offsetBytes + sizeBytes <= mSizeBytes, "GdrMailbox read out of bounds.");
+    auto const* src = static_cast<char const*>(mHostPtr) + offsetBytes;
+    TLLM_CHECK_WITH_INFO(
+        gdrcopy::copy_from_mapping(mMemDesc->gdrMh, dst, src, sizeBytes) == 0, "GDR copy_from_mapping failed.");
+}
+
+} // namespace tensorrt_llm::runtime
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/moeLoadBalancer/gdrwrap.h"
+
+#include <cstddef>
+
+namespace tensorrt_llm::runtime
+{
+
+/// @brief A small block of device memory whose contents the host can read and write directly
+/// through a GDRCopy BAR mapping.
+///
+/// Kernels see an ordinary device pointer; the host accesses the same words through the pinned
+/// write-combined mapping. Exchanging a few bytes this way avoids the launch and synchronization
+/// cost of a cudaMemcpy, which makes the mailbox suitable for tiny flag/counter exchanges on
+/// latency-critical paths. Host writes are flushed with a write-combining store fence, so a value
+/// written from the host is visible to subsequently launched kernels.
+///
+/// Callers must check supported() before constructing; the constructor throws when GDRCopy is
+/// unavailable. Host-side accessors are not synchronized against each other - concurrent host
+/// access to the same words requires external ordering.
+class GdrMailbox
+{
+public:
+    /// @brief Whether GDRCopy is usable on this system (library and driver present).
+    /// Idempotent; initializes the GDRCopy library on first call.
+    static bool supported();
+
+    /// @brief Allocate a mailbox of sizeBytes device bytes with a host BAR mapping.
+    explicit GdrMailbox(size_t sizeBytes);
+
+    ~GdrMailbox();
+
+    GdrMailbox(GdrMailbox const&) = delete;
+    GdrMailbox& operator=(GdrMailbox const&) = delete;
+
+    /// @brief Device pointer to the mailbox, for use by kernels and stream-ordered copies.
+    [[nodiscard]] void* getDevicePtr() const noexcept
+    {
+        return mDevicePtr;
+    }
+
+    [[nodiscard]] size_t getSizeBytes() const noexcept
+    {
+        return mSizeBytes;
+    }
+
+    /// @brief Write sizeBytes from src into the mailbox at offsetBytes and flush the WC buffer.
+    void hostWrite(size_t offsetBytes, void const* src, size_t sizeBytes);
+
+    /// @brief Read sizeBytes from the mailbox at offsetBytes into dst.
+    void hostRead(size_t offsetBytes, void* dst, size_t sizeBytes) const;
+
+    /// @brief Typed convenience write of a single value at index (in units of T).
+    template <typename T>
+    void writeValue(size_t index, T value)
+    {
+        hostWrite(index * sizeof(T), &value, sizeof(T));
+    }
+
+    /// @brief Typed convenience read of a single value at index (in units of T).
+    template <typename T>
+    [[nodiscard]] T readValue(size_t index) const
+    {
+        T value{};
+        hostRead(index * sizeof(T), &value, sizeof(T));
+        return value;
+    }
+
+private:
+    gdr_t mHandle{nullptr};
+    gdrcopy::GdrMemDesc* mMemDesc{nullptr};
+    void* mHostPtr{nullptr};
+    void* mDevicePtr{nullptr};
+    size_t mSizeBytes{0};
+};
+
+} // namespace tensorrt_llm::runtime
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include "tensorrt_llm/kernels/decodingKernels.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/cudaEvent.h"
+#include "tensorrt_llm/runtime/cudaEventPool.h"
 
 #include <algorithm>
 #include <cassert>
@@ -163,18 +164,17 @@ CudaEvent GptDecoderBatched::forwardAsync(
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
 
-    auto eventStart = CudaEvent{};
+    auto eventStart = CudaEventPool::instance().acquire();
     mRuntimeStream->record(eventStart);
     mDecoderStream->wait(eventStart.get());
 
     forwardDispatch(decoderState, input);
 
-    CudaEvent event{};
-    mDecoderStream->record(event);
-    mRuntimeStream->wait(event);
-
-    CudaEvent eventStop{};
-    mRuntimeStream->record(eventStop);
+    // Record completion on the decoder stream only. The runtime stream is deliberately not made to wait on
+    // the decoder here, so work submitted to it afterwards (e.g. the next engine forward) can overlap with
+    // sampling. Callers that consume decoder outputs must order on the returned event instead.
+    auto eventStop = CudaEventPool::instance().acquire();
+    mDecoderStream->record(eventStop);
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
     return eventStop;
 }
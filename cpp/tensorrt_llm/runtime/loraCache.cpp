@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 
@@ -619,104 +620,133 @@ std::vector<LoraCache::TaskLayerModuleConfig> LoraCache::copyToPages(TensorPtr s
     }
 
     std::vector<LoraCache::TaskLayerModuleConfig> pageLocations(rowIndices.size());
-    for (SizeType32 i = 0; i < static_cast<SizeType32>(rowIndices.size()); ++i)
+    auto copyFn = [&rowIndices, &rowPage, &rowSlot, &pageLocations, weights, config, &pages, &moduleIdToModule,
+                      &manager, pageWidth, tpSize, tpRank, pageIds](SizeType32 i)
     {
-        auto copyFn = [i = i, &rowIndices, &rowPage, &rowSlot, &pageLocations, weights, config, &pages,
-                          &moduleIdToModule, &manager, pageWidth, tpSize, tpRank, pageIds]()
-        {
-            auto const row = rowIndices[i];
-            auto const currPage = rowPage[i];
-            auto const currSlot = rowSlot[i];
-
-            lora::LoraModuleConfig const loraConfig(ITensor::slice(config, row, 1));
+        auto const row = rowIndices[i];
+        auto const currPage = rowPage[i];
+        auto const currSlot = rowSlot[i];
 
-            auto const layerId = loraConfig.layerId;
-            auto const adapterSize = loraConfig.adapterSize;
-
-            bool const isDora = loraConfig.isDora;
-            auto const modId = loraConfig.moduleId;
+        lora::LoraModuleConfig const loraConfig(ITensor::slice(config, row, 1));
 
-            auto const& module = moduleIdToModule.at(modId);
-            auto const localSize = module.localTotalSize(adapterSize, tpSize, isDora);
-            auto const rowSlots = common::ceilDiv(localSize, pageWidth);
+        auto const layerId = loraConfig.layerId;
+        auto const adapterSize = loraConfig.adapterSize;
+
+        bool const isDora = loraConfig.isDora;
+        auto const modId = loraConfig.moduleId;
+
+        auto const& module = moduleIdToModule.at(modId);
+        auto const localSize = module.localTotalSize(adapterSize, tpSize, isDora);
+        auto const rowSlots = common::ceilDiv(localSize, pageWidth);
+
+        auto const inDim = module.inDim();
+        auto const outDim = module.outDim();
+        auto const localOutDim = module.localOutDim(tpSize);
+        auto const inSize = module.inSize(adapterSize);
+        auto const outSize = module.outSize(adapterSize);
+        auto const localInSize = module.localInSize(adapterSize, tpSize);
+        auto const localOutSize = module.localOutSize(adapterSize, tpSize);
+        auto const magnitudeVecSize = isDora ? outDim : 0;
+        auto const localMagnitudeVecSize = module.localScalesSize(tpSize, isDora);
+
+        TLLM_CHECK(module.inDimFirst() == false);
+        TLLM_CHECK(module.outDimFirst() == true);
+        TLLM_CHECK(module.inTpSplitDim() == 1 || module.inTpSplitDim() == -1);
+        TLLM_CHECK(module.outTpSplitDim() == 0 || module.outTpSplitDim() == -1);
+
+        auto const splitIn = module.inTpSplitDim() == 1;
+        auto const splitOut = module.outTpSplitDim() == 0;
+
+        TensorPtr rowWeights = ITensor::view(
+            ITensor::slice(weights, row, 1), ITensor::makeShape({inSize + outSize + magnitudeVecSize}));
+        TensorPtr weightsIn
+            = ITensor::view(ITensor::slice(rowWeights, 0, inSize), ITensor::makeShape({adapterSize, inDim}));
+        TensorPtr weightsOut
+            = ITensor::view(ITensor::slice(rowWeights, inSize, outSize), ITensor::makeShape({outDim, adapterSize}));
+        TensorPtr magnitudeVec = ITensor::view(
+            ITensor::slice(rowWeights, inSize + outSize, magnitudeVecSize), ITensor::makeShape({magnitudeVecSize}));
+
+        TensorPtr pageSlice = ITensor::slice(pages.at(currPage), currSlot, rowSlots);
+        SizeType32 pageSliceSize = ITensor::volume(pageSlice->getShape());
+        TensorPtr pageFlatView = ITensor::view(pageSlice, ITensor::makeShape({pageSliceSize}));
+        TensorPtr targetWeightsIn = ITensor::slice(pageFlatView, 0, localInSize);
+        TensorPtr targetWeightsOut = ITensor::slice(pageFlatView, localInSize, localOutSize);
+        TensorPtr targetMagnitudeVec
+            = ITensor::slice(pageFlatView, localInSize + localOutSize, localMagnitudeVecSize);
+
+        if (!splitIn)
+        {
+            manager.copy(*weightsIn, *targetWeightsIn);
+        }
+        else
+        {
+            splitTransposeCpu(*targetWeightsIn, *weightsIn, tpSize, tpRank);
+        }
 
-            auto const inDim = module.inDim();
-            auto const outDim = module.outDim();
-            auto const localOutDim = module.localOutDim(tpSize);
-            auto const inSize = module.inSize(adapterSize);
-            auto const outSize = module.outSize(adapterSize);
-            auto const localInSize = module.localInSize(adapterSize, tpSize);
-            auto const localOutSize = module.localOutSize(adapterSize, tpSize);
-            auto const magnitudeVecSize = isDora ? outDim : 0;
-            auto const localMagnitudeVecSize = module.localScalesSize(tpSize, isDora);
-
-            TLLM_CHECK(module.inDimFirst() == false);
-            TLLM_CHECK(module.outDimFirst() == true);
-            TLLM_CHECK(module.inTpSplitDim() == 1 || module.inTpSplitDim() == -1);
-            TLLM_CHECK(module.outTpSplitDim() == 0 || module.outTpSplitDim() == -1);
-
-            auto const splitIn = module.inTpSplitDim() == 1;
-            auto const splitOut = module.outTpSplitDim() == 0;
-
-            TensorPtr rowWeights = ITensor::view(
-                ITensor::slice(weights, row, 1), ITensor::makeShape({inSize + outSize + magnitudeVecSize}));
-            TensorPtr weightsIn
-                = ITensor::view(ITensor::slice(rowWeights, 0, inSize), ITensor::makeShape({adapterSize, inDim}));
-            TensorPtr weightsOut
-                = ITensor::view(ITensor::slice(rowWeights, inSize, outSize), ITensor::makeShape({outDim, adapterSize}));
-            TensorPtr magnitudeVec = ITensor::view(
-                ITensor::slice(rowWeights, inSize + outSize, magnitudeVecSize), ITensor::makeShape({magnitudeVecSize}));
-
-            TensorPtr pageSlice = ITensor::slice(pages.at(currPage), currSlot, rowSlots);
-            SizeType32 pageSliceSize = ITensor::volume(pageSlice->getShape());
-            TensorPtr pageFlatView = ITensor::view(pageSlice, ITensor::makeShape({pageSliceSize}));
-            TensorPtr targetWeightsIn = ITensor::slice(pageFlatView, 0, localInSize);
-            TensorPtr targetWeightsOut = ITensor::slice(pageFlatView, localInSize, localOutSize);
-            TensorPtr targetMagnitudeVec
-                = ITensor::slice(pageFlatView, localInSize + localOutSize, localMagnitudeVecSize);
-
-            if (!splitIn)
+        if (!splitOut)
+        {
+            manager.copy(*weightsOut, *targetWeightsOut);
+            if (isDora)
             {
-                manager.copy(*weightsIn, *targetWeightsIn);
+                manager.copy(*magnitudeVec, *targetMagnitudeVec);
             }
-            else
+        }
+        else
+        {
+            TensorPtr source = ITensor::view(
+                ITensor::slice(
+                    ITensor::view(weightsOut, ITensor::makeShape({tpSize, localOutDim, adapterSize})), tpRank, 1),
+                ITensor::makeShape({localOutDim, adapterSize}));
+            manager.copy(*source, *targetWeightsOut);
+            if (isDora)
             {
-                splitTransposeCpu(*targetWeightsIn, *weightsIn, tpSize, tpRank);
+                TensorPtr magSource = ITensor::view(
+                    ITensor::slice(ITensor::view(magnitudeVec, ITensor::makeShape({tpSize, localMagnitudeVecSize})),
+                        tpRank, 1),
+                    ITensor::makeShape({localMagnitudeVecSize}));
+                manager.copy(*magSource, *targetMagnitudeVec);
             }
+        }
 
-            if (!splitOut)
-            {
-                manager.copy(*weightsOut, *targetWeightsOut);
-                if (isDora)
-                {
-                    manager.copy(*magnitudeVec, *targetMagnitudeVec);
-                }
-            }
-            else
-            {
-                TensorPtr source = ITensor::view(
-                    ITensor::slice(
-                        ITensor::view(weightsOut, ITensor::makeShape({tpSize, localOutDim, adapterSize})), tpRank, 1),
-                    ITensor::makeShape({localOutDim, adapterSize}));
-                manager.copy(*source, *targetWeightsOut);
-                if (isDora)
+        pageLocations[i] = LoraCache::TaskLayerModuleConfig{pageIds.at(currPage), currSlot, localInSize,
+            localOutSize, modId, layerId, adapterSize, static_cast<SizeType32>(rowSlots),
+            reinterpret_cast<std::int64_t>(targetWeightsIn->data()),
+            reinterpret_cast<std::int64_t>(targetWeightsOut->data()),
+            isDora ? std::optional<std::int64_t>(reinterpret_cast<std::int64_t>(targetMagnitudeVec->data()))
+                   : std::nullopt};
+    };
+
+    // The rows are independent of each other, so fan the host-side copies and split/transposes of
+    // large multi-layer adapters out over a few threads to keep the insert latency low.
+    auto const numRowsToCopy = static_cast<SizeType32>(rowIndices.size());
+    auto const numThreads = std::max<SizeType32>(
+        1, std::min({static_cast<SizeType32>(std::thread::hardware_concurrency()), numRowsToCopy, SizeType32{8}}));
+    if (numThreads > 1)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (SizeType32 tid = 0; tid < numThreads; ++tid)
+        {
+            threads.emplace_back(
+                [&copyFn, tid, numThreads, numRowsToCopy]()
                 {
-                    TensorPtr magSource = ITensor::view(
-                        ITensor::slice(ITensor::view(magnitudeVec, ITensor::makeShape({tpSize, localMagnitudeVecSize})),
-                            tpRank, 1),
-                        ITensor::makeShape({localMagnitudeVecSize}));
-                    manager.copy(*magSource, *targetMagnitudeVec);
-                }
-            }
-
-            pageLocations[i] = LoraCache::TaskLayerModuleConfig{pageIds.at(currPage), currSlot, localInSize,
-                localOutSize, modId, layerId, adapterSize, static_cast<SizeType32>(rowSlots),
-                reinterpret_cast<std::int64_t>(targetWeightsIn->data()),
-                reinterpret_cast<std::int64_t>(targetWeightsOut->data()),
-                isDora ? std::optional<std::int64_t>(reinterpret_cast<std::int64_t>(targetMagnitudeVec->data()))
-                       : std::nullopt};
-        };
-        copyFn();
+                    for (SizeType32 i = tid; i < numRowsToCopy; i += numThreads)
+                    {
+                        copyFn(i);
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    else
+    {
+        for (SizeType32 i = 0; i < numRowsToCopy; ++i)
+        {
+            copyFn(i);
+        }
     }
 
     TLLM_LOG_DEBUG("%s stop", __PRETTY_FUNCTION__);
@@ -863,6 +893,7 @@ void LoraCache::copyTask(TaskIdType taskId, LoraCache& deviceCache, bool markDon
         TensorPtr dest
             = ITensor::view(ITensor::slice(ITensor::view(newPagePtr, flatPageShape), 0, copySize), copyShape);
         deviceCache.mDeviceBufferManagers[bufferManagerOffset]->copy(*source, *dest);
+        BufferManager::accountTransfer(BufferManager::TransferClass::kWEIGHTS, source->getSizeInBytes());
         deviceCache.mDeviceBufferManagers[bufferManagerOffset]->getStream().record(copyEvents[eventIdx++]);
         bufferManagerOffset = (bufferManagerOffset + 1) % deviceCache.mDeviceBufferManagers.size();
     }
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/memoryPressureWatchdog.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/runtime/memoryCounters.h"
+
+namespace tensorrt_llm::runtime
+{
+
+MemoryPressureWatchdog::MemoryPressureWatchdog(float elevatedFreeFraction, float criticalFreeFraction)
+    : mElevatedFreeFraction{elevatedFreeFraction}
+    , mCriticalFreeFraction{criticalFreeFraction}
+{
+    TLLM_CHECK_WITH_INFO(0.F < criticalFreeFraction && criticalFreeFraction < elevatedFreeFraction
+            && elevatedFreeFraction < 1.F,
+        "Memory pressure thresholds must satisfy 0 < critical (%f) < elevated (%f) < 1", criticalFreeFraction,
+        elevatedFreeFraction);
+}
+
+MemoryPressureWatchdog::PressureLevel MemoryPressureWatchdog::sample()
+{
+    std::size_t freeMem{0};
+    std::size_t totalMem{0};
+    TLLM_CUDA_CHECK(cudaMemGetInfo(&freeMem, &totalMem));
+
+    auto const freeFraction = static_cast<float>(freeMem) / static_cast<float>(totalMem);
+    auto newLevel = PressureLevel::kNone;
+    if (freeFraction < mCriticalFreeFraction)
+    {
+        newLevel = PressureLevel::kCritical;
+    }
+    else if (freeFraction < mElevatedFreeFraction)
+    {
+        newLevel = PressureLevel::kElevated;
+    }
+
+    if (newLevel != mLevel)
+    {
+        auto const& counters = MemoryCounters::getInstance();
+        if (newLevel > mLevel)
+        {
+            TLLM_LOG_WARNING("Device memory pressure rose to level %d: %s free of %s. %s",
+                static_cast<int>(newLevel), MemoryCounters::bytesToString(freeMem).c_str(),
+                MemoryCounters::bytesToString(totalMem).c_str(), counters.toString().c_str());
+        }
+        else
+        {
+            TLLM_LOG_INFO("Device memory pressure dropped to level %d: %s free of %s.", static_cast<int>(newLevel),
+                MemoryCounters::bytesToString(freeMem).c_str(), MemoryCounters::bytesToString(totalMem).c_str());
+        }
+        mLevel = newLevel;
+    }
+    return mLevel;
+}
+
+} // namespace tensorrt_llm::runtime
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include "hostAccessibleDeviceAllocator.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/kernels/moeLoadBalance/moeLoadBalanceKernels.h"
 #include "topologyDetector.h"
 #include <algorithm>
@@ -189,6 +190,63 @@ void doPlacement(tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo, float*
         }
     }
     assert(pq.empty());
+
+    // 5. Slot-affinity pass. The greedy loop above fills each rank's local slots in arrival order,
+    // so an expert that stays on a rank between iterations can still land in a different local
+    // slot, and the weight updater would stream its full weights from host memory again for
+    // nothing. Permuting each rank's new assignment to keep experts in the local slots they
+    // already occupy leaves only the experts genuinely new to the rank to be copied. Permutation
+    // within a rank changes neither the per-rank load nor the expert-to-global-slot mapping
+    // semantics, since prepareGpuPlacementInfo rebuilds the replica offsets from rankExpertIds.
+    auto const& oldRankExpertIds = cpuPlacement->oldRankExpertIds;
+    if (static_cast<int>(oldRankExpertIds.size()) == metaInfo.epSize)
+    {
+        for (int rank = 0; rank < metaInfo.epSize; ++rank)
+        {
+            auto& newIds = rankExpertIds[rank];
+            auto const& oldIds = oldRankExpertIds[rank];
+            if (static_cast<int>(oldIds.size()) != metaInfo.slotCountPerRank)
+            {
+                continue;
+            }
+            std::vector<int> remainingCount(metaInfo.expertCount, 0);
+            for (int slotId = 0; slotId < metaInfo.slotCountPerRank; ++slotId)
+            {
+                remainingCount[newIds[slotId]]++;
+            }
+            // Keep slots whose old expert is still assigned to this rank.
+            std::vector<int> reordered(metaInfo.slotCountPerRank, -1);
+            for (int slotId = 0; slotId < metaInfo.slotCountPerRank; ++slotId)
+            {
+                int oldExpertId = oldIds[slotId];
+                if (oldExpertId >= 0 && oldExpertId < metaInfo.expertCount && remainingCount[oldExpertId] > 0)
+                {
+                    reordered[slotId] = oldExpertId;
+                    remainingCount[oldExpertId]--;
+                }
+            }
+            // Fill the remaining slots with the experts new to this rank, in assignment order.
+            std::vector<int> newExperts;
+            for (int slotId = 0; slotId < metaInfo.slotCountPerRank; ++slotId)
+            {
+                int expertId = newIds[slotId];
+                if (remainingCount[expertId] > 0)
+                {
+                    newExperts.push_back(expertId);
+                    remainingCount[expertId]--;
+                }
+            }
+            size_t nextNewExpert = 0;
+            for (int slotId = 0; slotId < metaInfo.slotCountPerRank; ++slotId)
+            {
+                if (reordered[slotId] < 0)
+                {
+                    reordered[slotId] = newExperts[nextNewExpert++];
+                }
+            }
+            newIds = std::move(reordered);
+        }
+    }
 }
 
 namespace
@@ -431,6 +489,10 @@ void SingleLayerMoeLoadBalancer::setInitialWeightAssignments(std::vector<int> co
 void SingleLayerMoeLoadBalancer::createResources()
 {
     // Statistic Info
+    // A longer raw window keeps more per-iteration histograms in the device-side ring buffer,
+    // and a lower decay factor makes the load factor react faster to bursty expert skew.
+    mStatisticInfo.rawDataWindowSize = tensorrt_llm::common::getEnvMoeLoadBalanceStatisticWindowSize();
+    mStatisticInfo.decayFactor = tensorrt_llm::common::getEnvMoeLoadBalanceStatisticDecayFactor();
     allocateStatisticInfo(mMetaInfo, &mStatisticInfo);
 
     mCpuPlacementInfo.rankExpertIds.resize(mMetaInfo.epSize);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -454,6 +454,48 @@ void TopologyDetector::freeCurrentGpuNumaMemory(void* ptr, size_t memorySize)
     numa_free(ptr, memorySize);
 }
 
+void* TopologyDetector::tryAllocateCurrentGpuPinnedNumaMemory(size_t memorySize)
+{
+#ifdef __linux__
+    if (numa_available() == -1)
+    {
+        return nullptr;
+    }
+    int numaId = getCurrentGpuNumaId();
+    if (numaId < 0)
+    {
+        return nullptr;
+    }
+    void* ptr = numa_alloc_onnode(memorySize, numaId);
+    if (ptr == nullptr)
+    {
+        TLLM_LOG_WARNING("Failed to allocate %zu B on NUMA node %d.", memorySize, numaId);
+        return nullptr;
+    }
+    auto const status = cudaHostRegister(ptr, memorySize, cudaHostRegisterDefault);
+    if (status != cudaSuccess)
+    {
+        TLLM_LOG_WARNING("Failed to page-lock NUMA-placed host memory: %s. Falling back to cudaHostAlloc.",
+            cudaGetErrorString(status));
+        // Clear the sticky error so subsequent CUDA calls are not affected.
+        (void) cudaGetLastError();
+        numa_free(ptr, memorySize);
+        return nullptr;
+    }
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void TopologyDetector::freeCurrentGpuPinnedNumaMemory(void* ptr, size_t memorySize)
+{
+#ifdef __linux__
+    TLLM_CUDA_CHECK(cudaHostUnregister(ptr));
+    numa_free(ptr, memorySize);
+#endif
+}
+
 std::string TopologyDetector::getCpuArchitecture()
 {
     return mCpuArchitecture;
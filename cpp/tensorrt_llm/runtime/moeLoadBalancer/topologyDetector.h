@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -75,9 +75,29 @@ public:
     // Frees a memory region allocated by allocateCurrentGpuNumaMemory.
     void freeCurrentGpuNumaMemory(void* ptr, size_t memorySize);
 
+    // Allocates page-locked host memory on the CPU NUMA node associated with the current GPU.
+    // Returns nullptr when NUMA placement is unavailable so callers can fall back to cudaHostAlloc.
+    void* tryAllocateCurrentGpuPinnedNumaMemory(size_t memorySize);
+
+    // Frees a memory region allocated by tryAllocateCurrentGpuPinnedNumaMemory.
+    void freeCurrentGpuPinnedNumaMemory(void* ptr, size_t memorySize);
+
     // Returns the detected CPU architecture (e.g., "x86_64", "aarch64").
     std::string getCpuArchitecture();
 
+    // Returns the mapping from GPU ID to the NUMA node it is attached to.
+    // Detection happens once in the constructor, so the map is stable afterwards.
+    std::map<int, int> const& getGpuToNumaMap() const
+    {
+        return mGpuToNumaMap;
+    }
+
+    // Returns the mapping from NUMA node ID to the GPUs attached to it.
+    std::map<int, std::vector<int>> const& getNumaToGpuMap() const
+    {
+        return mNumaToGpuMap;
+    }
+
 #ifdef __linux__
     // Getters for precomputed CPU affinity masks
     const struct bitmask* getStrictCpuMaskForGpu(int gpuId) const;
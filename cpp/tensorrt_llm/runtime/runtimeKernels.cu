@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2022 NVIDIA CORPORATION &
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2026 NVIDIA CORPORATION &
  * AFFILIATES. All rights reserved. SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -117,6 +117,70 @@ void invokeGatherBatch(IBuffer& buffer, IBuffer const& values, IBuffer const& sl
     gatherBatch<<<gridSize, blockSize, 0, stream.get()>>>(data, sparseValues, indices, size);
 }
 
+//! @param descs expected shape [gridDim.y]
+__global__ void fillRegions(FillRegionDesc const* descs)
+{
+    auto const& desc = descs[blockIdx.y];
+    auto* dst = static_cast<std::uint8_t*>(desc.dst);
+    auto const numBytes = desc.sizeInBytes;
+    auto const tidx = static_cast<std::uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    auto const stride = static_cast<std::uint64_t>(blockDim.x) * gridDim.x;
+
+    bool const aligned4 = reinterpret_cast<std::uintptr_t>(dst) % sizeof(std::uint32_t) == 0
+        && numBytes % sizeof(std::uint32_t) == 0;
+    if (aligned4)
+    {
+        auto* dstWords = reinterpret_cast<std::uint32_t*>(dst);
+        auto const numWords = numBytes / sizeof(std::uint32_t);
+        for (auto idx = tidx; idx < numWords; idx += stride)
+        {
+            dstWords[idx] = desc.pattern;
+        }
+    }
+    else
+    {
+        for (auto idx = tidx; idx < numBytes; idx += stride)
+        {
+            dst[idx] = static_cast<std::uint8_t>(desc.pattern >> (idx % sizeof(std::uint32_t) * 8));
+        }
+    }
+}
+
+//! @param descs expected shape [gridDim.y]
+__global__ void copyRegions(CopyRegionDesc const* descs)
+{
+    auto const& desc = descs[blockIdx.y];
+    auto const* src = static_cast<std::uint8_t const*>(desc.src);
+    auto* dst = static_cast<std::uint8_t*>(desc.dst);
+    auto const numBytes = desc.sizeInBytes;
+    auto const tidx = static_cast<std::uint64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    auto const stride = static_cast<std::uint64_t>(blockDim.x) * gridDim.x;
+
+    bool const aligned16 = reinterpret_cast<std::uintptr_t>(src) % 16 == 0
+        && reinterpret_cast<std::uintptr_t>(dst) % 16 == 0;
+    if (aligned16)
+    {
+        auto const numVecs = numBytes / 16;
+        auto const* srcVec = reinterpret_cast<uint4 const*>(src);
+        auto* dstVec = reinterpret_cast<uint4*>(dst);
+        for (auto idx = tidx; idx < numVecs; idx += stride)
+        {
+            dstVec[idx] = srcVec[idx];
+        }
+        for (auto idx = numVecs * 16 + tidx; idx < numBytes; idx += stride)
+        {
+            dst[idx] = src[idx];
+        }
+    }
+    else
+    {
+        for (auto idx = tidx; idx < numBytes; idx += stride)
+        {
+            dst[idx] = src[idx];
+        }
+    }
+}
+
 template <typename VecT>
 __global__ void copyBatch(uint8_t const* srcData, uint8_t* dstData, SizeType64 const* srcOffsets,
     SizeType64 const* dstOffsets, SizeType64 const* sizes, SizeType64 const dataTypeSize)
@@ -360,6 +424,30 @@ void invokeGatherBatch(IBuffer& buffer, IBuffer const& values, IBuffer const& sl
     }
 }
 
+void invokeFillRegionsBatch(FillRegionDesc const* descs, SizeType32 numDescs, CudaStream const& stream)
+{
+    if (numDescs == 0)
+    {
+        return;
+    }
+    // The region sizes live on the device, so launch a fixed number of blocks per region;
+    // housekeeping regions are small enough that a handful of blocks each covers them.
+    dim3 const blockSize{256};
+    dim3 const gridSize{8, static_cast<std::uint32_t>(numDescs)};
+    fillRegions<<<gridSize, blockSize, 0, stream.get()>>>(descs);
+}
+
+void invokeCopyRegionsBatch(CopyRegionDesc const* descs, SizeType32 numDescs, CudaStream const& stream)
+{
+    if (numDescs == 0)
+    {
+        return;
+    }
+    dim3 const blockSize{256};
+    dim3 const gridSize{8, static_cast<std::uint32_t>(numDescs)};
+    copyRegions<<<gridSize, blockSize, 0, stream.get()>>>(descs);
+}
+
 void invokeCopyBatch(IBuffer const& srcBuffer, IBuffer& dstBuffer, IBuffer const& srcOffsets, IBuffer const& dstOffsets,
     IBuffer const& sizes, std::size_t maxStride, CudaStream const& stream)
 {
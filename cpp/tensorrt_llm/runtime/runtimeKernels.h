@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -43,6 +43,34 @@ void invokeGatherBatch(IBuffer& buffer, IBuffer const& values, IBuffer const& sl
 void invokeCopyBatch(IBuffer const& srcBuffer, IBuffer& dstBuffer, IBuffer const& srcOffsets, IBuffer const& dstOffsets,
     IBuffer const& sizes, std::size_t maxStride, CudaStream const& stream);
 
+//! \brief Descriptor for one contiguous region in a batched fill launch.
+struct FillRegionDesc
+{
+    void* dst;
+    std::uint64_t sizeInBytes;
+    std::uint32_t pattern; //!< 4-byte fill pattern, repeated bytewise for narrower element types.
+};
+
+//! \brief Descriptor for one contiguous region in a batched copy launch.
+struct CopyRegionDesc
+{
+    void const* src;
+    void* dst;
+    std::uint64_t sizeInBytes;
+};
+
+//! \brief Fill a batch of unrelated regions with a single kernel launch.
+//! \details \p descs must point to \p numDescs descriptors in device-visible memory. Unlike \c invokeFillBatch,
+//! the regions may live in different buffers of different data types, so the per-tensor fill and memset launches
+//! of per-iteration housekeeping (buffer reset, slot init) collapse into one.
+void invokeFillRegionsBatch(FillRegionDesc const* descs, SizeType32 numDescs, CudaStream const& stream);
+
+//! \brief Copy a batch of unrelated contiguous regions with a single kernel launch.
+//! \details \p descs must point to \p numDescs descriptors in device-visible memory. Unlike \c invokeCopyBatch,
+//! the regions may live in different buffers (including pinned host memory), so scattered per-iteration
+//! housekeeping copies collapse into one launch.
+void invokeCopyRegionsBatch(CopyRegionDesc const* descs, SizeType32 numDescs, CudaStream const& stream);
+
 void scatterTensor(ITensor& output, ITensor const& input, SizeType32 beamWidth, CudaStream const& stream);
 
 void tileTensor(ITensor& output, ITensor const& input, SizeType32 beamWidth, CudaStream const& stream);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,20 @@
  */
 
 #include "tensorrt_llm/runtime/tllmBuffers.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/runtime/moeLoadBalancer/topologyDetector.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+// Pointers handed out by the NUMA-aware pinned path; they must be released through
+// TopologyDetector instead of cudaFreeHost.
+std::mutex numaPinnedMutex;
+std::unordered_set<void*> numaPinnedPtrs;
+} // namespace
 
 namespace tensorrt_llm::runtime
 {
@@ -25,6 +39,37 @@ typename PoolAllocator<TAllocator>::PoolType& PoolAllocator<TAllocator>::getPool
     return pool;
 }
 
+void PinnedAllocator::allocateImpl(PointerType* ptr, std::size_t n)
+{
+    if (common::getEnvNumaAwareExecutor())
+    {
+        auto* numaPtr = TopologyDetector::getInstance().tryAllocateCurrentGpuPinnedNumaMemory(n);
+        if (numaPtr != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(numaPinnedMutex);
+            numaPinnedPtrs.insert(numaPtr);
+            *ptr = numaPtr;
+            return;
+        }
+    }
+    TLLM_CUDA_CHECK(::cudaHostAlloc(ptr, n, cudaHostAllocDefault));
+}
+
+void PinnedAllocator::deallocateImpl(PointerType ptr, std::size_t n)
+{
+    {
+        std::lock_guard<std::mutex> lock(numaPinnedMutex);
+        auto it = numaPinnedPtrs.find(ptr);
+        if (it != numaPinnedPtrs.end())
+        {
+            numaPinnedPtrs.erase(it);
+            TopologyDetector::getInstance().freeCurrentGpuPinnedNumaMemory(ptr, n);
+            return;
+        }
+    }
+    TLLM_CUDA_CHECK_FREE_RESOURCE(::cudaFreeHost(ptr));
+}
+
 MulticastTensorView::MulticastTensorView(std::weak_ptr<MulticastTensor> const& tensor, ViewType viewType)
     : mTensor(tensor)
     , mViewType(viewType)
@@ -112,6 +157,92 @@ MemoryType MulticastTensorView::getMemoryType() const
     return lock()->getMemoryType();
 }
 
+CudaPagedWorkspace::CudaPagedWorkspace(std::size_t reservedSize, int device)
+    : mDevice(device)
+{
+    CUmemAllocationProp const prop{CU_MEM_ALLOCATION_TYPE_PINNED, CU_MEM_HANDLE_TYPE_NONE,
+        {
+            CU_MEM_LOCATION_TYPE_DEVICE,
+            mDevice,
+        }};
+    TLLM_CU_CHECK(cuMemGetAllocationGranularity(&mGranularity, &prop, CU_MEM_ALLOC_GRANULARITY_RECOMMENDED));
+    mReservedSize = pageAligned(reservedSize);
+    TLLM_CU_CHECK(cuMemAddressReserve(&mAddress, mReservedSize, 0, {}, 0));
+}
+
+CudaPagedWorkspace::~CudaPagedWorkspace()
+{
+    if (mCommittedSize > 0)
+    {
+        TLLM_CU_CHECK_FREE_RESOURCE(cuMemUnmap(mAddress, mCommittedSize));
+        for (auto const& [handle, size] : mHandles)
+        {
+            TLLM_CU_CHECK_FREE_RESOURCE(cuMemRelease(handle));
+        }
+        MemoryCounters::getInstance().deallocate(MemoryType::kGPU, mCommittedSize);
+    }
+    TLLM_CU_CHECK_FREE_RESOURCE(cuMemAddressFree(mAddress, mReservedSize));
+}
+
+void CudaPagedWorkspace::ensureCapacity(std::size_t size)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const newCommittedSize = pageAligned(size);
+    if (newCommittedSize <= mCommittedSize)
+    {
+        return;
+    }
+    TLLM_CHECK_WITH_INFO(newCommittedSize <= mReservedSize,
+        "CudaPagedWorkspace: requested capacity %zu B exceeds the reserved address range of %zu B", size,
+        mReservedSize);
+
+    auto const growSize = newCommittedSize - mCommittedSize;
+    CUmemAllocationProp const prop{CU_MEM_ALLOCATION_TYPE_PINNED, CU_MEM_HANDLE_TYPE_NONE,
+        {
+            CU_MEM_LOCATION_TYPE_DEVICE,
+            mDevice,
+        }};
+    CUmemGenericAllocationHandle handle{};
+    TLLM_CU_CHECK(cuMemCreate(&handle, growSize, &prop, 0));
+    try
+    {
+        TLLM_CU_CHECK(cuMemMap(mAddress + mCommittedSize, growSize, 0, handle, 0));
+        CUmemAccessDesc const desc{{
+                                       CU_MEM_LOCATION_TYPE_DEVICE,
+                                       mDevice,
+                                   },
+            CU_MEM_ACCESS_FLAGS_PROT_READWRITE};
+        TLLM_CU_CHECK(cuMemSetAccess(mAddress + mCommittedSize, growSize, &desc, 1));
+    }
+    catch (...)
+    {
+        TLLM_CU_CHECK_FREE_RESOURCE(cuMemRelease(handle));
+        throw;
+    }
+    mHandles.emplace_back(handle, growSize);
+    mCommittedSize = newCommittedSize;
+    MemoryCounters::getInstance().allocate(MemoryType::kGPU, growSize);
+    TLLM_LOG_DEBUG("CudaPagedWorkspace: committed %zu B, now %zu B of %zu B reserved", growSize, mCommittedSize,
+        mReservedSize);
+}
+
+std::shared_ptr<CudaPagedWorkspace> CudaPagedWorkspace::getOrCreateShared(int device)
+{
+    static std::mutex sharedMutex;
+    static std::unordered_map<int, std::shared_ptr<CudaPagedWorkspace>> sharedWorkspaces;
+
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    auto it = sharedWorkspaces.find(device);
+    if (it == sharedWorkspaces.end())
+    {
+        std::size_t freeMem{0};
+        std::size_t totalMem{0};
+        TLLM_CUDA_CHECK(cudaMemGetInfo(&freeMem, &totalMem));
+        it = sharedWorkspaces.emplace(device, std::make_shared<CudaPagedWorkspace>(totalMem, device)).first;
+    }
+    return it->second;
+}
+
 // explicit instantiations
 template class PoolAllocator<PinnedAllocator>;
 } // namespace tensorrt_llm::runtime
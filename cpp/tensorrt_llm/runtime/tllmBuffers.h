@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -168,16 +168,11 @@ public:
     PinnedAllocator() noexcept = default;
 
 protected:
-    void allocateImpl(PointerType* ptr, std::size_t n) // NOLINT(readability-convert-member-functions-to-static)
-    {
-        TLLM_CUDA_CHECK(::cudaHostAlloc(ptr, n, cudaHostAllocDefault));
-    }
+    // Defined in tllmBuffers.cpp: honors TRTLLM_NUMA_AWARE_EXECUTOR by placing the allocation on
+    // the CPU NUMA node of the current GPU, falling back to cudaHostAlloc.
+    void allocateImpl(PointerType* ptr, std::size_t n);
 
-    void deallocateImpl( // NOLINT(readability-convert-member-functions-to-static)
-        PointerType ptr, [[maybe_unused]] std::size_t n)
-    {
-        TLLM_CUDA_CHECK_FREE_RESOURCE(::cudaFreeHost(ptr));
-    }
+    void deallocateImpl(PointerType ptr, std::size_t n);
 };
 
 class HostAllocator : public BaseAllocator<HostAllocator, MemoryType::kCPU>
@@ -531,6 +526,59 @@ protected:
     }
 };
 
+//! \brief A GPU workspace backed by CUDA virtual memory with on-demand page commit.
+//!
+//! \details A large virtual address range is reserved up front and backing pages are committed lazily as the
+//! requested capacity grows. Several clients with non-overlapping peaks (e.g. the execution contexts of multiple
+//! TRT optimization profiles) can share one workspace whose physical footprint is the maximum, not the sum, of
+//! their peak requirements. Committed memory is tracked in MemoryCounters and only returned on destruction.
+class CudaPagedWorkspace
+{
+public:
+    //! \param reservedSize Size of the virtual address range to reserve. Bounds the capacity the workspace can
+    //! ever grow to; no physical memory is committed until ensureCapacity is called.
+    //! \param device The device to commit memory on.
+    CudaPagedWorkspace(std::size_t reservedSize, int device);
+
+    CudaPagedWorkspace(CudaPagedWorkspace const&) = delete;
+    CudaPagedWorkspace& operator=(CudaPagedWorkspace const&) = delete;
+
+    ~CudaPagedWorkspace();
+
+    [[nodiscard]] void* data() const noexcept
+    {
+        return reinterpret_cast<void*>(mAddress);
+    }
+
+    //! \brief Currently committed backing memory in bytes.
+    [[nodiscard]] std::size_t getCapacity() const noexcept
+    {
+        return mCommittedSize;
+    }
+
+    //! \brief Grow the committed backing memory to at least size bytes. No-op when already large enough.
+    void ensureCapacity(std::size_t size);
+
+    //! \brief The workspace shared by all clients on the given device, created on first use with a reservation
+    //! covering the device's total memory.
+    static std::shared_ptr<CudaPagedWorkspace> getOrCreateShared(int device);
+
+private:
+    [[nodiscard]] std::size_t pageAligned(std::size_t size) const noexcept
+    {
+        return (size + mGranularity - 1) / mGranularity * mGranularity;
+    }
+
+    int mDevice;
+    std::size_t mGranularity;
+    std::size_t mReservedSize;
+    std::size_t mCommittedSize{0};
+    CUdeviceptr mAddress{};
+    //! One handle and size per committed region, in address order.
+    std::vector<std::pair<CUmemGenericAllocationHandle, std::size_t>> mHandles;
+    std::mutex mMutex;
+};
+
 // Adopted from https://github.com/NVIDIA/TensorRT/blob/release/8.6/samples/common/buffers.h
 
 //!
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,11 +16,13 @@
 #include "tllmRuntime.h"
 #include "common.h"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/common/safetensors.h"
 #include "tensorrt_llm/executor/tensor.h"
 #include "tensorrt_llm/kernels/userbuffers/ub_interface.h"
+#include "tensorrt_llm/runtime/tllmBuffers.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 #include "tllmLogger.h"
 #include "tllmStreamReaders.h"
@@ -78,11 +80,26 @@ void setWeightStreaming(nvinfer1::ICudaEngine& engine, float const gpuWeightsPer
 {
     if (gpuWeightsPercent < 1)
     {
-        int64_t streamableSize = engine.getStreamableWeightsSize();
-        int64_t budget = gpuWeightsPercent * streamableSize;
+        TLLM_CHECK_WITH_INFO(
+            gpuWeightsPercent >= 0, "gpuWeightsPercent must be in [0, 1], got %f.", gpuWeightsPercent);
+        int64_t const streamableSize = engine.getStreamableWeightsSize();
+        if (streamableSize == 0)
+        {
+            TLLM_LOG_WARNING(
+                "gpuWeightsPercent is %f but the engine has no streamable weights; it was likely built without "
+                "weight streaming enabled. The setting has no effect.",
+                gpuWeightsPercent);
+            return;
+        }
+        auto const budget = static_cast<int64_t>(gpuWeightsPercent * static_cast<double>(streamableSize));
         TLLM_LOG_INFO("Set gpu weights percent to %f, which is %lld bytes. Valid range: %lld bytes - %lld bytes.",
-            gpuWeightsPercent, budget, 0, streamableSize);
-        engine.setWeightStreamingBudgetV2(budget);
+            gpuWeightsPercent, budget, 0ll, streamableSize);
+        TLLM_CHECK_WITH_INFO(engine.setWeightStreamingBudgetV2(budget), "Failed to set weight streaming budget.");
+        // Weights above the budget are streamed from host memory at enqueue time. The device bytes
+        // they would have occupied stay free, so a free-memory-fraction KV cache configuration
+        // automatically converts the savings into cache capacity.
+        TLLM_LOG_INFO("[MemUsageChange] Weight streaming keeps %lld bytes of weights off the GPU.",
+            streamableSize - budget);
     }
 }
 
@@ -191,6 +208,7 @@ TllmRuntime::TllmRuntime(RawEngine const& rawEngine, nvinfer1::ILogger* logger,
     , mBufferManager{mStream, true} // Ensure to trim the memory pool on destruction.
     , mRuntime{nvinfer1::createInferRuntime(static_cast<bool>(logger) ? *logger : defaultLogger)}
     , mUseShapeInference{useShapeInference}
+    , mUseGpuDirectStorage{useGpuDirectStorage}
     , mUserBufferEnabled{false}
 {
     auto const startTime = std::chrono::high_resolution_clock::now();
@@ -205,6 +223,17 @@ TllmRuntime::TllmRuntime(RawEngine const& rawEngine, nvinfer1::ILogger* logger,
             auto reader = GDSStreamReader(rawEngine.getPath());
             mEngine.reset(mRuntime->deserializeCudaEngine(reader));
         }
+        else if (tensorrt_llm::common::getEnvEngineMmapLoad())
+        {
+            TLLM_LOG_INFO("mmap is used to load the engine!");
+            mEngineMmap = std::make_unique<MmappedEngineFile>(rawEngine.getPath());
+            // Stripe the page-in pipeline by device so node-local ranks don't thrash the same disk
+            // regions; the mapping stays alive for the runtime's lifetime.
+            int device{0};
+            TLLM_CUDA_CHECK(cudaGetDevice(&device));
+            mEngineMmap->prefetch(tensorrt_llm::common::getEnvEngineLoadPrefetchThreads(), device);
+            mEngine.reset(mRuntime->deserializeCudaEngine(mEngineMmap->data(), mEngineMmap->size()));
+        }
         else
         {
             auto reader = StreamReader(rawEngine.getPath());
@@ -232,14 +261,32 @@ TllmRuntime::TllmRuntime(RawEngine const& rawEngine, nvinfer1::ILogger* logger,
     assessLikelihoodOfRuntimeAllocation(*mEngine, *mEngineInspector);
     setWeightStreaming(getEngine(), gpuWeightsPercent);
     auto const devMemorySize = mEngine->getDeviceMemorySizeV2();
-    mEngineBuffer = mBufferManager.gpu(devMemorySize);
-    // Print context memory size for CI/CD to track.
-    TLLM_LOG_INFO("[MemUsageChange] Allocated %.2f MiB for execution context memory.",
-        static_cast<double>(devMemorySize) / 1048576.0);
+    if (tensorrt_llm::common::getEnvSharedPagedWorkspace())
+    {
+        // Draw the activation memory from the device-wide paged workspace. Backing pages are committed up to the
+        // largest peak over all runtimes sharing the workspace instead of reserving each runtime's peak separately.
+        int device{0};
+        TLLM_CUDA_CHECK(cudaGetDevice(&device));
+        mPagedWorkspace = CudaPagedWorkspace::getOrCreateShared(device);
+        mPagedWorkspace->ensureCapacity(devMemorySize);
+        TLLM_LOG_INFO("[MemUsageChange] Using %.2f MiB of the shared paged workspace (%.2f MiB committed) for "
+                      "execution context memory.",
+            static_cast<double>(devMemorySize) / 1048576.0,
+            static_cast<double>(mPagedWorkspace->getCapacity()) / 1048576.0);
+    }
+    else
+    {
+        mEngineBuffer = mBufferManager.gpu(devMemorySize);
+        // Print context memory size for CI/CD to track.
+        TLLM_LOG_INFO("[MemUsageChange] Allocated %.2f MiB for execution context memory.",
+            static_cast<double>(devMemorySize) / 1048576.0);
+    }
 
     cacheTensorNames();
 }
 
+TllmRuntime::~TllmRuntime() = default;
+
 void TllmRuntime::cacheTensorNames()
 {
     for (std::int32_t i = 0; i < mEngine->getNbIOTensors(); ++i)
@@ -256,7 +303,7 @@ void TllmRuntime::cacheTensorNames()
     }
 }
 
-nvinfer1::IExecutionContext& TllmRuntime::addContext(std::int32_t profileIndex)
+nvinfer1::IExecutionContext& TllmRuntime::addContext(std::int32_t profileIndex, bool dedicatedDeviceMemory)
 {
     TLLM_CHECK(0 <= profileIndex && profileIndex < mEngine->getNbOptimizationProfiles());
     mContexts.emplace_back(mEngine->createExecutionContextWithoutDeviceMemory());
@@ -272,7 +319,22 @@ nvinfer1::IExecutionContext& TllmRuntime::addContext(std::int32_t profileIndex)
         }
     }
     auto& context = *mContexts.back();
-    context.setDeviceMemoryV2(mEngineBuffer->data(), static_cast<int64_t>(mEngineBuffer->getCapacity()));
+    if (dedicatedDeviceMemory)
+    {
+        auto const devMemorySize = mEngine->getDeviceMemorySizeV2();
+        auto& contextBuffer = mDedicatedContextBuffers.emplace_back(mBufferManager.gpu(devMemorySize));
+        TLLM_LOG_INFO("[MemUsageChange] Allocated %.2f MiB of dedicated execution context memory.",
+            static_cast<double>(devMemorySize) / 1048576.0);
+        context.setDeviceMemoryV2(contextBuffer->data(), static_cast<int64_t>(contextBuffer->getCapacity()));
+    }
+    else if (mPagedWorkspace)
+    {
+        context.setDeviceMemoryV2(mPagedWorkspace->data(), static_cast<int64_t>(mEngine->getDeviceMemorySizeV2()));
+    }
+    else
+    {
+        context.setDeviceMemoryV2(mEngineBuffer->data(), static_cast<int64_t>(mEngineBuffer->getCapacity()));
+    }
 
     if (tensorrt_llm::common::Logger::getLogger()->isEnabled(tensorrt_llm::common::Logger::TRACE)
         && mContexts.size() == 1)
@@ -486,14 +548,20 @@ void TllmRuntime::clearContexts()
         context.reset();
     }
     mContexts.clear();
+    mDedicatedContextBuffers.clear();
 }
 
 bool TllmRuntime::executeContext(SizeType32 contextIndex) const
+{
+    return executeContext(contextIndex, *mStream);
+}
+
+bool TllmRuntime::executeContext(SizeType32 contextIndex, CudaStream const& stream) const
 {
     NVTX3_FUNC_RANGE();
     auto& context = getContext(contextIndex);
-    auto res = context.enqueueV3(mStream->get());
-    sync_check_cuda_error(mStream->get());
+    auto res = context.enqueueV3(stream.get());
+    sync_check_cuda_error(stream.get());
     return res;
 }
 
@@ -815,6 +883,20 @@ void TllmRuntime::loadManagedWeights(RawEngine const& rawEngine, int localRank)
         auto weightPath
             = enginePath->parent_path() / ("rank" + std::to_string(localRank) + "_managed_weights.safetensors");
         auto managed_weights = common::safetensors::ISafeTensor::open(weightPath.string().c_str());
+        auto gdsReader = std::unique_ptr<GDSStreamReader>{};
+        if (mUseGpuDirectStorage)
+        {
+            auto reader = std::make_unique<GDSStreamReader>(weightPath);
+            if (reader->isOpen())
+            {
+                TLLM_LOG_INFO("GDS is used to load the managed weights!");
+                gdsReader = std::move(reader);
+            }
+            else
+            {
+                TLLM_LOG_WARNING("GDS is unavailable for managed weights, falling back to host reads.");
+            }
+        }
         for (auto const& name : managed_weights->keys())
         {
             TLLM_LOG_DEBUG("Loading managed weight: %s", name.c_str());
@@ -822,7 +904,16 @@ void TllmRuntime::loadManagedWeights(RawEngine const& rawEngine, int localRank)
             TLLM_CHECK(weight->dtype() == engine.getTensorDataType(name.c_str()));
             auto weightsDevice
                 = std::shared_ptr<ITensor>{manager.allocate(MemoryType::kGPU, weight->trtDims(), weight->dtype())};
-            manager.copy(weight->data(), *weightsDevice, MemoryType::kCPU);
+            if (gdsReader)
+            {
+                // Read the payload straight into the device buffer, bypassing the host copy.
+                gdsReader->seek(weight->fileOffset(), nvinfer1::SeekPosition::kSET);
+                gdsReader->read(weightsDevice->data(), weight->sizeInBytes(), mStream->get());
+            }
+            else
+            {
+                manager.copy(weight->data(), *weightsDevice, MemoryType::kCPU);
+            }
             mManagedWeightsMap.insert(std::make_pair(name, weightsDevice));
         }
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,8 +30,12 @@
 #include <string>
 #include <vector>
 
+class MmappedEngineFile;
+
 namespace tensorrt_llm::runtime
 {
+class CudaPagedWorkspace;
+
 class TllmRuntime
 {
 public:
@@ -40,6 +44,9 @@ public:
     explicit TllmRuntime(RawEngine const& rawEngine, nvinfer1::ILogger* logger, bool useGpuDirectStorage = false,
         float gpuWeightsPercent = 1.0f, bool useShapeInference = true);
 
+    // Defined in tllmRuntime.cpp where MmappedEngineFile is complete.
+    ~TllmRuntime();
+
     SizeType32 getNbContexts() const
     {
         return static_cast<SizeType32>(mContexts.size());
@@ -71,7 +78,11 @@ public:
         return optProfileId;
     }
 
-    nvinfer1::IExecutionContext& addContext(std::int32_t profileIndex);
+    /// @brief Create an execution context for the given optimization profile.
+    /// @details By default, all contexts share the same activation memory and therefore must not execute
+    /// concurrently. Pass dedicatedDeviceMemory = true to give the context its own activation memory so it can be
+    /// enqueued on a separate stream while another context is running.
+    nvinfer1::IExecutionContext& addContext(std::int32_t profileIndex, bool dedicatedDeviceMemory = false);
 
     void clearContexts();
 
@@ -93,6 +104,11 @@ public:
 
     bool executeContext(SizeType32 contextIndex) const;
 
+    /// @brief Enqueue the context on the given stream instead of the runtime stream.
+    /// @details The caller is responsible for fencing against other work: the context must have been created with
+    /// dedicated device memory if another context may be executing at the same time.
+    bool executeContext(SizeType32 contextIndex, CudaStream const& stream) const;
+
     CudaStream const& getStream() const;
 
     BufferManager::CudaStreamPtr getStreamPtr()
@@ -223,13 +239,22 @@ private:
     BufferManager::CudaStreamPtr mStream;
     BufferManager mBufferManager;
     std::unique_ptr<nvinfer1::IRuntime> mRuntime;
+    // Backing mapping when the engine was deserialized zero-copy from an mmapped file.
+    // Must outlive mEngine.
+    std::unique_ptr<MmappedEngineFile> mEngineMmap;
     std::unique_ptr<nvinfer1::ICudaEngine> mEngine;
     BufferManager::IBufferPtr mEngineBuffer;
+    // Device-wide paged workspace used instead of mEngineBuffer when TRTLLM_SHARED_PAGED_WORKSPACE is set.
+    std::shared_ptr<CudaPagedWorkspace> mPagedWorkspace;
+    // Activation memory of contexts created with dedicatedDeviceMemory == true.
+    std::vector<BufferManager::IBufferPtr> mDedicatedContextBuffers;
     std::vector<std::unique_ptr<nvinfer1::IExecutionContext>> mContexts;
     std::unique_ptr<ITensor> mDummyTensor;
     std::unique_ptr<nvinfer1::IEngineInspector> mEngineInspector;
     std::unique_ptr<LayerProfiler> mLayerProfiler;
     bool mUseShapeInference;
+    // Remembered so loadManagedWeights can also read straight into device buffers via GDS.
+    bool mUseGpuDirectStorage;
     TensorMap mManagedWeightsMap;
     // List of input tensor names.
     // Names of static tensors are removed from this list when setStaticInputTensors is called.
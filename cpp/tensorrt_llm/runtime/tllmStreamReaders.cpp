@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,13 +18,20 @@
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/logger.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <cufile.h>
 #include <dlfcn.h>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <sys/mman.h>
+#include <thread>
 #include <unistd.h>
+#include <vector>
 
 // Non-GDS StreamReader
 
@@ -54,6 +61,89 @@ int64_t StreamReader::read(void* destination, int64_t nbBytes)
     return mFile.gcount();
 }
 
+// Memory-mapped engine file
+
+MmappedEngineFile::MmappedEngineFile(std::filesystem::path const& filePath)
+{
+    mFd = ::open(filePath.string().c_str(), O_RDONLY);
+    TLLM_CHECK_WITH_INFO(mFd >= 0, "Error opening engine file: " + filePath.string());
+
+    auto const fileSize = ::lseek(mFd, 0, SEEK_END);
+    TLLM_CHECK_WITH_INFO(fileSize > 0, "Error determining size of engine file: " + filePath.string());
+    mSize = static_cast<size_t>(fileSize);
+
+    mData = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFd, 0);
+    TLLM_CHECK_WITH_INFO(mData != MAP_FAILED, "Error mapping engine file: " + filePath.string());
+
+    // Sequential deserialization benefits from aggressive readahead on untouched regions.
+    if (::madvise(mData, mSize, MADV_SEQUENTIAL) != 0)
+    {
+        TLLM_LOG_DEBUG("madvise(MADV_SEQUENTIAL) failed for engine mapping: %s", strerror(errno));
+    }
+}
+
+MmappedEngineFile::~MmappedEngineFile()
+{
+    if (mData != nullptr && mData != MAP_FAILED)
+    {
+        ::munmap(mData, mSize);
+    }
+    if (mFd >= 0)
+    {
+        ::close(mFd);
+    }
+}
+
+void MmappedEngineFile::prefetch(int numThreads, int stripeIndex) const
+{
+    if (numThreads <= 0 || mSize == 0)
+    {
+        return;
+    }
+
+    auto constexpr kChunkSize = size_t{16} << 20; // 16 MiB
+    auto constexpr kPageSize = size_t{4096};
+    auto const numChunks = (mSize + kChunkSize - 1) / kChunkSize;
+    numThreads = static_cast<int>(std::min<size_t>(numThreads, numChunks));
+    // Rotate the starting chunk per loader so up to 8 node-local ranks fan out over the file
+    // instead of all hammering the same region at once.
+    auto const rotation = (static_cast<size_t>(std::max(stripeIndex, 0)) % 8) * numChunks / 8;
+
+    auto const startTime = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads);
+    for (int t = 0; t < numThreads; ++t)
+    {
+        workers.emplace_back(
+            [this, t, numThreads, numChunks, rotation]
+            {
+                auto volatile checksum = uint8_t{0};
+                for (size_t c = t; c < numChunks; c += numThreads)
+                {
+                    auto const chunk = (c + rotation) % numChunks;
+                    auto const begin = chunk * kChunkSize;
+                    auto const end = std::min(begin + kChunkSize, mSize);
+                    auto const* base = static_cast<uint8_t const*>(mData);
+                    ::madvise(const_cast<uint8_t*>(base) + begin, end - begin, MADV_WILLNEED);
+                    // Touch one byte per page to force the pages in.
+                    for (size_t offset = begin; offset < end; offset += kPageSize)
+                    {
+                        checksum = checksum ^ base[offset];
+                    }
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    auto const elapsedMs
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - startTime);
+    TLLM_LOG_INFO("Paged in %zu MiB of engine mapping with %d threads in %lld ms", mSize >> 20, numThreads,
+        static_cast<long long>(elapsedMs.count()));
+}
+
 // StreamReader using GDS
 
 GDSStreamReader::GDSStreamReader(std::filesystem::path const& filePath)
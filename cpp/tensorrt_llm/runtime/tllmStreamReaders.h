@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -34,6 +34,39 @@ private:
     std::ifstream mFile;
 };
 
+//! Read-only memory mapping of a serialized engine file. Deserialization can consume the mapped
+//! region directly (zero-copy); pages are faulted in lazily or ahead of time via prefetch().
+class MmappedEngineFile final
+{
+public:
+    explicit MmappedEngineFile(std::filesystem::path const& filePath);
+
+    ~MmappedEngineFile();
+
+    MmappedEngineFile(MmappedEngineFile const&) = delete;
+    MmappedEngineFile& operator=(MmappedEngineFile const&) = delete;
+
+    [[nodiscard]] void const* data() const
+    {
+        return mData;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return mSize;
+    }
+
+    //! Pages the mapping in with numThreads workers issuing reads chunk by chunk, keeping the NVMe
+    //! queue fed. The chunk visiting order is rotated by stripeIndex so concurrent loaders (one per
+    //! GPU rank) start on different file regions instead of thrashing the same disk stripes.
+    void prefetch(int numThreads, int stripeIndex) const;
+
+private:
+    int mFd{-1};
+    void* mData{nullptr};
+    size_t mSize{0};
+};
+
 class GDSStreamReader final : public nvinfer1::IStreamReaderV2
 {
 public:
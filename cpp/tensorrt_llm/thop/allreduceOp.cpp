@@ -19,6 +19,7 @@
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/common/customAllReduceUtils.h"
 #include "tensorrt_llm/common/dataType.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/mcastDevMemUtils.h"
 #include "tensorrt_llm/common/ncclUtils.h"
 #include "tensorrt_llm/common/nvmlWrapper.h"
@@ -55,10 +56,14 @@
 #include <nvml.h>
 #include <torch/extension.h>
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <fstream>
 #include <limits>
+#include <sstream>
+#include <unordered_map>
 #include <unordered_set>
 
 // using namespace nvinfer1;
@@ -284,26 +289,24 @@ public:
 
         AllReduceStrategyType runtime_strategy = selectImplementation(seq_len, hidden_size);
 
+        // When runtime calibration is enabled, the measured dispatch table replaces the built-in
+        // lookup-table thresholds for the strategies it covers.
+        if (mStrategy == AllReduceStrategyType::AUTO && tensorrt_llm::common::getEnvAllReduceCalibration()
+            && (runtime_strategy == AllReduceStrategyType::NCCL || runtime_strategy == AllReduceStrategyType::ONESHOT
+                || runtime_strategy == AllReduceStrategyType::TWOSHOT
+                || runtime_strategy == AllReduceStrategyType::MIN_LATENCY
+                || runtime_strategy == AllReduceStrategyType::NCCL_SYMMETRIC))
+        {
+            runtime_strategy = calibrateImplementation(
+                runtime_strategy, input, residual, norm_weight, scale, bias, trigger_completion_at_end, workspace);
+        }
+
         // Log runtime strategy
         auto const rank = getRank();
         TLLM_LOG_DEBUG(
             "AllReduceOp runtime strategy for rank %d: " + tensorrt_llm::kernels::toString(runtime_strategy), rank);
-        // Dispatch to different allreduce implementations
-        switch (runtime_strategy)
-        {
-        case AllReduceStrategyType::UB: return runUBAllReduce(input, residual, norm_weight, scale, bias);
-        case AllReduceStrategyType::NCCL: return runNCCLAllReduce(input, residual, norm_weight, scale, bias);
-        case AllReduceStrategyType::NCCL_SYMMETRIC:
-            return runNCCLAllReduceSymmetric(input, residual, norm_weight, scale, bias);
-        case AllReduceStrategyType::MIN_LATENCY:
-        case AllReduceStrategyType::ONESHOT:
-        case AllReduceStrategyType::TWOSHOT:
-            return runFusionAllReduce(
-                input, residual, norm_weight, scale, bias, trigger_completion_at_end, workspace, runtime_strategy);
-        case AllReduceStrategyType::LOWPRECISION:
-            return runLowPrecisionAllReduce(input, residual, norm_weight, scale, bias);
-        default: TORCH_CHECK(false, "Invalid runtime strategy"); return {};
-        }
+        return dispatchAllReduce(
+            runtime_strategy, input, residual, norm_weight, scale, bias, trigger_completion_at_end, workspace);
     }
 
     int initialize()
@@ -324,6 +327,28 @@ public:
     }
 
 private:
+    std::vector<torch::Tensor> dispatchAllReduce(AllReduceStrategyType strategy, torch::Tensor const& input,
+        torch::optional<torch::Tensor> const& residual, torch::optional<torch::Tensor> const& norm_weight,
+        torch::optional<torch::Tensor> const& scale, torch::optional<torch::Tensor> const& bias,
+        bool trigger_completion_at_end, torch::optional<torch::Tensor> workspace)
+    {
+        switch (strategy)
+        {
+        case AllReduceStrategyType::UB: return runUBAllReduce(input, residual, norm_weight, scale, bias);
+        case AllReduceStrategyType::NCCL: return runNCCLAllReduce(input, residual, norm_weight, scale, bias);
+        case AllReduceStrategyType::NCCL_SYMMETRIC:
+            return runNCCLAllReduceSymmetric(input, residual, norm_weight, scale, bias);
+        case AllReduceStrategyType::MIN_LATENCY:
+        case AllReduceStrategyType::ONESHOT:
+        case AllReduceStrategyType::TWOSHOT:
+            return runFusionAllReduce(
+                input, residual, norm_weight, scale, bias, trigger_completion_at_end, workspace, strategy);
+        case AllReduceStrategyType::LOWPRECISION:
+            return runLowPrecisionAllReduce(input, residual, norm_weight, scale, bias);
+        default: TORCH_CHECK(false, "Invalid runtime strategy"); return {};
+        }
+    }
+
     std::vector<torch::Tensor> runUBAllReduce(torch::Tensor const& input,
         torch::optional<torch::Tensor> const& residual, torch::optional<torch::Tensor> const& norm_weight,
         torch::optional<torch::Tensor> const& scale, torch::optional<torch::Tensor> const& bias)
@@ -1425,6 +1450,184 @@ private:
         }
     }
 
+    //! Runtime auto-tuning of the AUTO strategy. The first allreduce of each (hidden_size,
+    //! num-token bucket) benchmarks the eligible strategies with CUDA events and caches the
+    //! fastest one, so the dispatch table reflects the actual interconnect instead of the
+    //! compile-time thresholds, which are mistuned e.g. for PCIe-only nodes.
+    //!
+    //! All ranks run the same deterministic candidate schedule (the benchmarked collectives line
+    //! up across ranks), and the per-strategy timings are max-reduced over the group before the
+    //! winner is picked, so every rank arrives at the same decision.
+    AllReduceStrategyType calibrateImplementation(AllReduceStrategyType heuristic, torch::Tensor const& input,
+        torch::optional<torch::Tensor> const& residual, torch::optional<torch::Tensor> const& norm_weight,
+        torch::optional<torch::Tensor> const& scale, torch::optional<torch::Tensor> const& bias,
+        bool trigger_completion_at_end, torch::optional<torch::Tensor> workspace)
+    {
+        size_t const seq_len = input.size(0);
+        size_t const hidden_size = input.size(-1);
+
+        // One bucket per power-of-two token count, mirroring the static lookup table.
+        auto const token_bucket = static_cast<size_t>(std::log2(std::max<size_t>(seq_len, 1)));
+        auto const key = (hidden_size << 6) + token_bucket;
+
+        if (!mCalibrationCacheLoaded)
+        {
+            loadCalibrationCache();
+            mCalibrationCacheLoaded = true;
+        }
+
+        auto const it = mCalibratedStrategies.find(key);
+        if (it != mCalibratedStrategies.end())
+        {
+            return it->second;
+        }
+
+        // The fusion kernels need the Lamport workspace and a message that fits it; otherwise NCCL
+        // is the only candidate and there is nothing to measure.
+        auto const message_size_bytes = seq_len * hidden_size * tensorrt_llm::common::getDTypeSize(mType);
+        auto const max_workspace_size
+            = tensorrt_llm::utils::customAllReduceUtils::getMaxRequiredWorkspaceSize(mGroup.size());
+        bool const fusion_eligible
+            = workspace.has_value() && !ifFallbackToNCCL(seq_len, message_size_bytes, max_workspace_size);
+
+        std::vector<AllReduceStrategyType> candidates{AllReduceStrategyType::NCCL};
+        if (fusion_eligible)
+        {
+            candidates.push_back(AllReduceStrategyType::ONESHOT);
+            if (seq_len >= mGroup.size())
+            {
+                candidates.push_back(AllReduceStrategyType::TWOSHOT);
+            }
+        }
+
+        if (candidates.size() == 1)
+        {
+            mCalibratedStrategies.emplace(key, heuristic);
+            return heuristic;
+        }
+
+        auto stream = at::cuda::getCurrentCUDAStream(input.get_device());
+        constexpr int kWarmupIterations = 2;
+        constexpr int kTimingIterations = 5;
+
+        std::vector<float> elapsed_ms(candidates.size(), 0.f);
+        cudaEvent_t start{};
+        cudaEvent_t stop{};
+        TLLM_CUDA_CHECK(cudaEventCreate(&start));
+        TLLM_CUDA_CHECK(cudaEventCreate(&stop));
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            for (int iter = 0; iter < kWarmupIterations; ++iter)
+            {
+                dispatchAllReduce(candidates[i], input, residual, norm_weight, scale, bias, trigger_completion_at_end,
+                    workspace);
+            }
+            TLLM_CUDA_CHECK(cudaEventRecord(start, stream));
+            for (int iter = 0; iter < kTimingIterations; ++iter)
+            {
+                dispatchAllReduce(candidates[i], input, residual, norm_weight, scale, bias, trigger_completion_at_end,
+                    workspace);
+            }
+            TLLM_CUDA_CHECK(cudaEventRecord(stop, stream));
+            TLLM_CUDA_CHECK(cudaEventSynchronize(stop));
+            TLLM_CUDA_CHECK(cudaEventElapsedTime(&elapsed_ms[i], start, stop));
+        }
+        TLLM_CUDA_CHECK(cudaEventDestroy(start));
+        TLLM_CUDA_CHECK(cudaEventDestroy(stop));
+
+        // Max-reduce the timings so all ranks score each candidate by its slowest rank.
+        auto const options = torch::TensorOptions().dtype(torch::kFloat32).device(input.device());
+        auto times = torch::from_blob(
+            elapsed_ms.data(), {static_cast<int64_t>(elapsed_ms.size())}, torch::TensorOptions().dtype(torch::kFloat32))
+                         .to(options);
+        std::visit(overloaded{[&](std::shared_ptr<ncclComm_t>& rawComm) {
+                                  NCCLCHECK_THROW(ncclAllReduce(times.data_ptr(), times.mutable_data_ptr(),
+                                      times.numel(), ncclFloat, ncclMax, *rawComm, stream));
+                              },
+                       [&](c10::intrusive_ptr<c10d::ProcessGroup>& torchPg)
+                       {
+                           std::vector tensors{times};
+                           PGCHECK_THROW(torchPg->allreduce(tensors, {c10d::ReduceOp::MAX}));
+                       }},
+            mNcclComm);
+        auto const times_cpu = times.cpu();
+        auto const* times_ptr = times_cpu.data_ptr<float>();
+
+        size_t best = 0;
+        for (size_t i = 1; i < candidates.size(); ++i)
+        {
+            if (times_ptr[i] < times_ptr[best])
+            {
+                best = i;
+            }
+        }
+
+        auto const winner = candidates[best];
+        mCalibratedStrategies.emplace(key, winner);
+        TLLM_LOG_INFO("AllReduce calibration (tokens=%zu, hidden=%zu): selected %s (%.3f ms / %d iterations)", seq_len,
+            hidden_size, tensorrt_llm::kernels::toString(winner).c_str(), times_ptr[best], kTimingIterations);
+        writeCalibrationCache();
+        return winner;
+    }
+
+    //! Cache file identifying the topology the calibration was measured on. Empty when persistence
+    //! is disabled.
+    std::string calibrationCacheFile() const
+    {
+        auto const& dir = tensorrt_llm::common::getEnvAllReduceCalibrationCacheDir();
+        if (dir.empty())
+        {
+            return {};
+        }
+        std::ostringstream name;
+        name << dir << "/allreduce_calibration_sm" << tensorrt_llm::common::getSMVersion() << "_tp" << mGroup.size()
+             << "_dtype" << static_cast<int>(mType) << "_fusion" << static_cast<int>(mOp) << "_nvlink"
+             << static_cast<int>(mIsNVLINKSupported) << "_p2p" << static_cast<int>(mIsP2PSupported) << ".txt";
+        return name.str();
+    }
+
+    void loadCalibrationCache()
+    {
+        auto const file = calibrationCacheFile();
+        if (file.empty())
+        {
+            return;
+        }
+        std::ifstream in(file);
+        if (!in)
+        {
+            return;
+        }
+        size_t key{};
+        int strategy{};
+        while (in >> key >> strategy)
+        {
+            mCalibratedStrategies.emplace(key, static_cast<AllReduceStrategyType>(strategy));
+        }
+        TLLM_LOG_INFO(
+            "Loaded %zu calibrated allreduce strategies from %s", mCalibratedStrategies.size(), file.c_str());
+    }
+
+    void writeCalibrationCache() const
+    {
+        auto const file = calibrationCacheFile();
+        // All ranks hold the same table after the max-reduction; only the group leader writes.
+        if (file.empty() || getRank() != *mGroup.begin())
+        {
+            return;
+        }
+        std::ofstream out(file, std::ios::trunc);
+        if (!out)
+        {
+            TLLM_LOG_WARNING("Failed to write allreduce calibration cache %s", file.c_str());
+            return;
+        }
+        for (auto const& [key, strategy] : mCalibratedStrategies)
+        {
+            out << key << ' ' << static_cast<int>(strategy) << '\n';
+        }
+    }
+
     bool ifFallbackToNCCL(size_t seq_len, size_t message_size_bytes, size_t max_workspace_size)
     {
         // If messageSize is greater than maxWorkspaceSize or topology is unsuitable, use NCCL fallback.
@@ -1461,6 +1664,9 @@ private:
     AllReduceFusionOp mOp;
     float mEps;
     std::variant<std::shared_ptr<ncclComm_t>, c10::intrusive_ptr<c10d::ProcessGroup>> mNcclComm;
+    // Calibrated AUTO dispatch table: (hidden_size << 6) + log2(num_tokens) -> fastest measured strategy.
+    std::unordered_map<size_t, AllReduceStrategyType> mCalibratedStrategies;
+    bool mCalibrationCacheLoaded{false};
 };
 
 } // namespace
@@ -1810,10 +2016,24 @@ std::vector<torch::Tensor> mnnvlFusionAllReduce(torch::Tensor& input, torch::opt
     // Threshold to switch between one-shot and two-shot allreduce kernel
     // Empirical value, MSG size * World size
     constexpr size_t kOneShotSizeThreshold = 16 * 4 * 8192;
+    // Decode-regime batches go through the NVLS switch-reduction oneshot when available: shards
+    // are staged locally and pulled reduced through multimem.ld_reduce, roughly halving the
+    // NVLink traffic of the multicast-store oneshot.
+    constexpr int64_t kNvlsOneShotMaxTokens = 16;
+    static int const smVersion = tensorrt_llm::common::getSMVersion();
+    bool const useNvlsOneshot = smVersion >= 90 && numTokens <= kNvlsOneShotMaxTokens
+        && !tensorrt_llm::common::getEnvMnnvlDisableNvlsOneshot();
 
     if (numTokens * hiddenDim * allreduce_params.nRanks * input.itemsize() <= kOneShotSizeThreshold)
     {
-        tensorrt_llm::kernels::mnnvl::oneshotAllreduceFusionOp(allreduce_params);
+        if (useNvlsOneshot)
+        {
+            tensorrt_llm::kernels::mnnvl::oneshotNvlsAllreduceFusionOp(allreduce_params);
+        }
+        else
+        {
+            tensorrt_llm::kernels::mnnvl::oneshotAllreduceFusionOp(allreduce_params);
+        }
     }
     else
     {
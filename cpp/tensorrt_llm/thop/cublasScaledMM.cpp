@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (out) 1993-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (out) 1993-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,6 +17,7 @@
 #include "cublasScaledMMLut.h"
 #include "tensorrt_llm/common/cublasMMWrapper.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/kernels/userbuffers/ub_interface.h"
 #include "tensorrt_llm/plugins/common/plugin.h"
 #include "tensorrt_llm/plugins/gemmPlugin/gemmPlugin.h"
@@ -26,6 +27,12 @@
 #include <cublasLt.h>
 #include <torch/extension.h>
 
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+
 using torch::Tensor;
 
 TRTLLM_NAMESPACE_BEGIN
@@ -61,6 +68,104 @@ void set_algo_attr(cublasLtMatmulAlgo_t& algo, std::array<int, 8> const& attr_li
         cublasLtMatmulAlgoConfigSetAttribute(&algo, CUBLASLT_ALGO_CONFIG_CLUSTER_SHAPE_ID, &cga, sizeof(cga)));
 }
 
+//! Runtime-learned LUT overlay loaded from TRTLLM_CUBLAS_ALGO_LUT_FILE. Each line holds
+//!   <list> <mp2> <k> <n> <algo> <tile> <stages> <numsK> <reduction> <swizzle> <custom> <cga>
+//! where <list> is "bf16" or "fp8". Entries take precedence over the built-in tables, so shapes
+//! the static LUT misses (e.g. odd n/k from TP-sharded GQA heads) can be tuned once offline and
+//! reloaded at startup. Shapes that miss both tables are appended (deduplicated) to
+//! <file>.misses so the offline tuner knows what to benchmark next.
+class RuntimeAlgoLut
+{
+public:
+    static RuntimeAlgoLut& instance()
+    {
+        static RuntimeAlgoLut lut;
+        return lut;
+    }
+
+    [[nodiscard]] AlgoListType const* getList(cudaDataType_t aType) const
+    {
+        if (aType == CUDA_R_16BF || aType == CUDA_R_16F)
+        {
+            return mBf16List.empty() ? nullptr : &mBf16List;
+        }
+        if (aType == CUDA_R_8F_E4M3)
+        {
+            return mFp8List.empty() ? nullptr : &mFp8List;
+        }
+        return nullptr;
+    }
+
+    void recordMiss(cudaDataType_t aType, int32_t mp2, int32_t k, int32_t n)
+    {
+        if (mMissFilePath.empty())
+        {
+            return;
+        }
+        char const* listName = (aType == CUDA_R_8F_E4M3) ? "fp8" : "bf16";
+        std::lock_guard<std::mutex> lock(mMissMutex);
+        if (!mRecordedMisses.emplace(std::string(listName), mp2, k, n).second)
+        {
+            return;
+        }
+        std::ofstream missFile(mMissFilePath, std::ios::app);
+        if (missFile)
+        {
+            missFile << listName << " " << mp2 << " " << k << " " << n << "\n";
+        }
+    }
+
+private:
+    RuntimeAlgoLut()
+    {
+        auto const& lutFilePath = tensorrt_llm::common::getEnvCublasAlgoLutFile();
+        if (lutFilePath.empty())
+        {
+            return;
+        }
+        mMissFilePath = lutFilePath + ".misses";
+        std::ifstream lutFile(lutFilePath);
+        if (!lutFile)
+        {
+            TLLM_LOG_WARNING("Failed to open cublasLt algo LUT file %s", lutFilePath.c_str());
+            return;
+        }
+        std::string line;
+        size_t numEntries = 0;
+        while (std::getline(lutFile, line))
+        {
+            if (line.empty() || line.front() == '#')
+            {
+                continue;
+            }
+            std::istringstream entry(line);
+            std::string listName;
+            int32_t mp2{}, k{}, n{};
+            std::array<int, 8> attrs{};
+            entry >> listName >> mp2 >> k >> n;
+            for (auto& attr : attrs)
+            {
+                entry >> attr;
+            }
+            if (entry.fail() || (listName != "bf16" && listName != "fp8"))
+            {
+                TLLM_LOG_WARNING("Skipping malformed cublasLt algo LUT entry: %s", line.c_str());
+                continue;
+            }
+            auto& list = (listName == "fp8") ? mFp8List : mBf16List;
+            list[{mp2, k, n}] = attrs;
+            ++numEntries;
+        }
+        TLLM_LOG_INFO("Loaded %zu cublasLt algo LUT entries from %s", numEntries, lutFilePath.c_str());
+    }
+
+    AlgoListType mBf16List;
+    AlgoListType mFp8List;
+    std::string mMissFilePath;
+    std::mutex mMissMutex;
+    std::set<std::tuple<std::string, int32_t, int32_t, int32_t>> mRecordedMisses;
+};
+
 bool find_special_algo(cublasLtMatmulAlgo_t& algo, std::shared_ptr<CublasMMWrapper> const& cublasWrapper, int32_t m,
     int32_t n, int32_t k, cublasComputeType_t compType, cudaDataType_t scaleType, cudaDataType_t aType,
     cudaDataType_t bType, cudaDataType_t outType)
@@ -85,6 +190,20 @@ bool find_special_algo(cublasLtMatmulAlgo_t& algo, std::shared_ptr<CublasMMWrapp
             "No special cublasLt algo found for aType=%d, outType=%d, compType=%d\n", aType, outType, compType);
         return false;
     }
+    // The runtime-learned overlay takes precedence over the built-in tables.
+    auto& runtime_lut = RuntimeAlgoLut::instance();
+    if (auto const* runtime_list = runtime_lut.getList(aType))
+    {
+        if (auto algo_iter = runtime_list->find({mp2, k, n}); algo_iter != runtime_list->end())
+        {
+            int const algoID = algo_iter->second[0];
+            check_cuda_error(cublasLtMatmulAlgoInit(cublasWrapper->getCublasLtHandle(), compType, scaleType, aType,
+                bType, outType, outType, algoID, &algo));
+            TLLM_LOG_DEBUG("Found runtime cublasLt algo for m=%d, k=%d, n=%d\n", m, k, n);
+            set_algo_attr(algo, algo_iter->second);
+            return true;
+        }
+    }
     if (auto algo_iter = algo_list->find({mp2, k, n}); algo_iter != algo_list->end())
     {
         int const algoID = algo_iter->second[0];
@@ -95,6 +214,7 @@ bool find_special_algo(cublasLtMatmulAlgo_t& algo, std::shared_ptr<CublasMMWrapp
     }
     else
     {
+        runtime_lut.recordMiss(aType, mp2, k, n);
         int const algoID = 66; // CUBLASLT_MATMUL_ALGO_NVJET
         check_cuda_error(cublasLtMatmulAlgoInit(
             cublasWrapper->getCublasLtHandle(), compType, scaleType, aType, bType, outType, outType, algoID, &algo));
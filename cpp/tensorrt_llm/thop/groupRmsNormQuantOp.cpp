@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/dataType.h"
+#include "tensorrt_llm/common/opUtils.h"
+#include "tensorrt_llm/kernels/groupRmsNormKernels/groupRmsNormQuantKernels.h"
+#include "tensorrt_llm/runtime/torchUtils.h"
+#include "tensorrt_llm/thop/thUtils.h"
+
+#include <ATen/cuda/CUDAContext.h>
+#include <cstdint>
+#include <cuda_runtime.h>
+#include <stdexcept>
+#include <torch/extension.h>
+#include <vector>
+
+TRTLLM_NAMESPACE_BEGIN
+
+namespace torch_ext
+{
+
+// Fused (residual add +) RMSNorm + per-token scale compute + FP8 E4M3 quantization.
+// quant_outputs: FP8 normalized outputs, same shape as the inputs.
+// scale_outputs: per-token dequantization scales, one [batch_size] float tensor per input.
+// residuals/prenorm_outputs: when residuals are given, input + residual is normalized and the
+// pre-norm sum is written to prenorm_outputs for the next layer's residual stream.
+void groupRMSNormQuant(torch::TensorList const& inputs, torch::TensorList const& residuals,
+    torch::TensorList const& quant_outputs, torch::TensorList const& prenorm_outputs,
+    torch::TensorList const& scale_outputs, torch::TensorList const& weights, double eps, double weight_bias)
+{
+    TORCH_CHECK(!inputs.empty(), "Input tensor list cannot be empty.");
+    TORCH_CHECK(quant_outputs.size() == inputs.size(), "Quantized output list size must match inputs list size.");
+    TORCH_CHECK(scale_outputs.size() == inputs.size(), "Scale output list size must match inputs list size.");
+    uint32_t const num_inputs = inputs.size();
+    TORCH_CHECK(num_inputs <= 2, "Only up to 2 inputs are supported.");
+    auto const first_input = inputs[0];
+    TORCH_CHECK(first_input.dim() == 2, "Inputs must be 2D tensors [batch_size, hidden_dim].");
+    TORCH_CHECK(first_input.sizes()[0] > 0, "Batch size must be greater than 0.");
+    TORCH_CHECK(first_input.is_cuda(), "Inputs must be CUDA tensors.");
+    uint32_t const batch_size = first_input.sizes()[0];
+    auto const dtype = first_input.scalar_type();
+    auto const device = first_input.device();
+    bool const enable_residual = !residuals.empty();
+
+    if (!weights.empty())
+    {
+        TORCH_CHECK(weights.size() == num_inputs, "Weights list size must match inputs list size.");
+    }
+    if (enable_residual)
+    {
+        TORCH_CHECK(residuals.size() == num_inputs, "Residuals list size must match inputs list size.");
+        TORCH_CHECK(prenorm_outputs.size() == num_inputs,
+            "Pre-norm output list size must match inputs list size when residuals are given.");
+    }
+
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+        TORCH_CHECK(inputs[i].sizes()[0] == batch_size, "Inputs must have the same batch size.");
+        TORCH_CHECK(inputs[i].dim() == 2, "Inputs must be 2D tensors [batch_size, hidden_dim].");
+        TORCH_CHECK(inputs[i].device() == device, "Inputs must be on the same device.");
+        TORCH_CHECK(inputs[i].scalar_type() == dtype, "Inputs must be of the same type.");
+        TORCH_CHECK(inputs[i].strides()[1] == 1, "Inputs must be contiguous along the last dimension.");
+        TORCH_CHECK(quant_outputs[i].scalar_type() == torch::ScalarType::Float8_e4m3fn,
+            "Quantized outputs must be float8_e4m3fn tensors.");
+        TORCH_CHECK(quant_outputs[i].sizes() == inputs[i].sizes(), "Quantized outputs must match input shapes.");
+        TORCH_CHECK(quant_outputs[i].is_contiguous(), "Quantized outputs must be contiguous.");
+        TORCH_CHECK(scale_outputs[i].scalar_type() == torch::ScalarType::Float,
+            "Scale outputs must be float tensors.");
+        TORCH_CHECK(scale_outputs[i].numel() == batch_size, "Scale outputs must have one entry per token.");
+        if (enable_residual)
+        {
+            TORCH_CHECK(residuals[i].sizes() == inputs[i].sizes(), "Residuals must match input shapes.");
+            TORCH_CHECK(residuals[i].scalar_type() == dtype, "Residuals must be of the same type as inputs.");
+            TORCH_CHECK(residuals[i].strides() == inputs[i].strides(),
+                "Residuals and inputs must have the same strides.");
+            TORCH_CHECK(prenorm_outputs[i].sizes() == inputs[i].sizes(), "Pre-norm outputs must match input shapes.");
+            TORCH_CHECK(prenorm_outputs[i].scalar_type() == dtype,
+                "Pre-norm outputs must be of the same type as inputs.");
+            TORCH_CHECK(prenorm_outputs[i].strides() == inputs[i].strides(),
+                "Pre-norm outputs and inputs must have the same strides.");
+        }
+        if (!weights.empty())
+        {
+            TORCH_CHECK(
+                inputs[i].sizes()[1] == weights[i].sizes()[0], "Inputs and weights must have the same last dimension.");
+        }
+    }
+
+#define DISPATCH_QUANT_INPUT_SIZES(n)                                                                                  \
+    {                                                                                                                  \
+        tensorrt_llm::kernels::group_rms_norm::GroupRMSNormQuantParams<n> params;                                      \
+        for (size_t i = 0; i < n; ++i)                                                                                 \
+        {                                                                                                              \
+            params.inputs[i] = reinterpret_cast<float4*>(inputs[i].data_ptr());                                        \
+            params.input_last_dims[i] = inputs[i].sizes()[1];                                                          \
+            params.input_strides[i] = inputs[i].strides()[0];                                                          \
+            params.output_strides[i] = quant_outputs[i].strides()[0];                                                  \
+            params.quant_outputs[i] = quant_outputs[i].mutable_data_ptr();                                             \
+            params.scale_outputs[i] = scale_outputs[i].mutable_data_ptr<float>();                                      \
+            params.residuals[i] = enable_residual ? reinterpret_cast<float4 const*>(residuals[i].data_ptr()) : nullptr;\
+            params.prenorm_outputs[i]                                                                                  \
+                = enable_residual ? reinterpret_cast<float4*>(prenorm_outputs[i].mutable_data_ptr()) : nullptr;        \
+            if (!weights.empty())                                                                                      \
+            {                                                                                                          \
+                params.weights[i] = reinterpret_cast<float4 const*>(weights[i].data_ptr());                            \
+            }                                                                                                          \
+        }                                                                                                              \
+        /* Set remaining params */                                                                                     \
+        params.batch_size = batch_size;                                                                                \
+        params.num_inputs = n;                                                                                         \
+        params.eps = static_cast<float>(eps);                                                                          \
+        params.weight_bias = static_cast<float>(weight_bias);                                                          \
+        params.enable_weights = !weights.empty();                                                                      \
+        params.enable_residual = enable_residual;                                                                      \
+        params.stream = at::cuda::getCurrentCUDAStream(inputs[0].get_device());                                        \
+        /* Handle dtype conversion */                                                                                  \
+        switch (dtype)                                                                                                 \
+        {                                                                                                              \
+        case torch::ScalarType::Half: params.dtype = nvinfer1::DataType::kHALF; break;                                 \
+        case torch::ScalarType::BFloat16: params.dtype = nvinfer1::DataType::kBF16; break;                             \
+        case torch::ScalarType::Float: params.dtype = nvinfer1::DataType::kFLOAT; break;                               \
+        default: TORCH_CHECK(false, "Unsupported data type");                                                          \
+        }                                                                                                              \
+        tensorrt_llm::kernels::group_rms_norm::GroupRMSNormQuantKernelLauncher<n>(params);                             \
+        break;                                                                                                         \
+    }
+
+    switch (num_inputs)
+    {
+    case 1: DISPATCH_QUANT_INPUT_SIZES(1)
+    case 2: DISPATCH_QUANT_INPUT_SIZES(2)
+    default: TORCH_CHECK(false, "Unsupported number of inputs (max 2)");
+    }
+#undef DISPATCH_QUANT_INPUT_SIZES
+}
+
+} // namespace torch_ext
+
+TRTLLM_NAMESPACE_END
+
+TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
+{
+    m.impl("group_rms_norm_quant", &tensorrt_llm::torch_ext::groupRMSNormQuant);
+}
@@ -15,6 +15,7 @@
  */
 
 #include "tensorrt_llm/kernels/mamba2MTPSSMCache/mamba2MTPSSMCache.h"
+#include "tensorrt_llm/kernels/mamba2MTPSSMCache/mamba2MTPStateRestore.h"
 #include "tensorrt_llm/thop/thUtils.h"
 
 namespace th = torch;
@@ -210,6 +211,52 @@ void mamba2_mtp_ssm_cache_update(th::Tensor ssm, th::Tensor x, th::Tensor dt, th
     tk::invokeMamba2MTPSSMCacheUpdate(params, stream);
 }
 
+void mamba2_mtp_state_restore(th::Tensor dst_states, th::Tensor src_states, th::Tensor dst_state_indices,
+    th::Tensor src_state_indices, th::Tensor accepted_steps)
+{
+    TORCH_CHECK(dst_states.dim() >= 3 && dst_states.is_cuda() && dst_states.is_contiguous(),
+        "dst_states should be a contiguous CUDA tensor of shape [num_layers, dst_slots, ...]");
+    TORCH_CHECK(src_states.dim() == dst_states.dim() + 1 && src_states.is_cuda() && src_states.is_contiguous(),
+        "src_states should be a contiguous CUDA tensor of shape [num_layers, src_slots, cache_steps, ...]");
+    auto device = dst_states.device();
+    TORCH_CHECK(src_states.device() == device && src_states.dtype() == dst_states.dtype(),
+        "src_states should have the same device and dtype as dst_states");
+
+    int const num_layers = dst_states.size(0);
+    TORCH_CHECK(src_states.size(0) == num_layers, "src_states and dst_states should have the same number of layers");
+    int64_t state_elems = 1;
+    for (int64_t d = 2; d < dst_states.dim(); ++d)
+    {
+        TORCH_CHECK(
+            src_states.size(d + 1) == dst_states.size(d), "src_states and dst_states state shapes do not match");
+        state_elems *= dst_states.size(d);
+    }
+
+    int const num_seqs = dst_state_indices.size(0);
+    for (auto const* idx : {&dst_state_indices, &src_state_indices, &accepted_steps})
+    {
+        TORCH_CHECK(idx->dim() == 1 && idx->size(0) == num_seqs && idx->dtype() == torch::kInt32
+                && idx->device() == device && idx->is_contiguous(),
+            "index tensors should be contiguous int32 [num_seqs] CUDA tensors");
+    }
+
+    tk::Mamba2MTPStateRestoreParams params;
+    params.dst_states = dst_states.data_ptr();
+    params.src_states = src_states.const_data_ptr();
+    params.dst_indices = static_cast<int32_t const*>(dst_state_indices.const_data_ptr());
+    params.src_indices = static_cast<int32_t const*>(src_state_indices.const_data_ptr());
+    params.accepted_steps = static_cast<int32_t const*>(accepted_steps.const_data_ptr());
+    params.num_layers = num_layers;
+    params.num_seqs = num_seqs;
+    params.dst_slots = static_cast<int>(dst_states.size(1));
+    params.src_slots = static_cast<int>(src_states.size(1));
+    params.cache_steps = static_cast<int>(src_states.size(2));
+    params.state_bytes = state_elems * dst_states.element_size();
+
+    auto stream = at::cuda::getCurrentCUDAStream().stream();
+    tk::invokeMamba2MTPStateRestore(params, stream);
+}
+
 } // namespace torch_ext
 
 TRTLLM_NAMESPACE_END
@@ -225,9 +272,14 @@ TORCH_LIBRARY_FRAGMENT(trtllm, m)
         "Tensor? intermediate_states_indices, "
         "Tensor? retrieve_parent_token, "
         "int cache_steps, int pad_slot_id, bool disable_state_update) -> ()");
+    m.def(
+        "mamba2_mtp_state_restore(Tensor dst_states, Tensor src_states, "
+        "Tensor dst_state_indices, Tensor src_state_indices, "
+        "Tensor accepted_steps) -> ()");
 }
 
 TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
 {
     m.impl("mamba2_mtp_ssm_cache_update", &tensorrt_llm::torch_ext::mamba2_mtp_ssm_cache_update);
+    m.impl("mamba2_mtp_state_restore", &tensorrt_llm::torch_ext::mamba2_mtp_state_restore);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,8 +44,11 @@ enum MoeA2AMetaInfoIndex : int64_t
     TOPK_TARGET_RANKS_OFFSET_INDEX = 6,
     TOPK_SEND_INDICES_OFFSET_INDEX = 7,
     EPLB_GATHERED_STATS_OFFSET_INDEX = 8,
-    PAYLOAD_DATA_OFFSET_INDEX = 9,
-    NUM_METAINFO_FIELDS = 10
+    // Node-local replication queue (hierarchical dispatch): counter + descriptors
+    REPLICA_COUNTER_OFFSET_INDEX = 9,
+    REPLICA_DESCS_OFFSET_INDEX = 10,
+    PAYLOAD_DATA_OFFSET_INDEX = 11,
+    NUM_METAINFO_FIELDS = 12
 };
 
 using MoeA2ADataOffsets = std::array<int64_t, NUM_METAINFO_FIELDS>;
@@ -62,6 +65,8 @@ inline std::vector<std::pair<char const*, int64_t>> getMoeA2AMetaInfoIndexPairs(
         {"MOE_A2A_TOPK_TARGET_RANKS_OFFSET_INDEX", TOPK_TARGET_RANKS_OFFSET_INDEX},
         {"MOE_A2A_TOPK_SEND_INDICES_OFFSET_INDEX", TOPK_SEND_INDICES_OFFSET_INDEX},
         {"MOE_A2A_EPLB_GATHERED_STATS_OFFSET_INDEX", EPLB_GATHERED_STATS_OFFSET_INDEX},
+        {"MOE_A2A_REPLICA_COUNTER_OFFSET_INDEX", REPLICA_COUNTER_OFFSET_INDEX},
+        {"MOE_A2A_REPLICA_DESCS_OFFSET_INDEX", REPLICA_DESCS_OFFSET_INDEX},
         {"MOE_A2A_PAYLOAD_DATA_OFFSET_INDEX", PAYLOAD_DATA_OFFSET_INDEX},
         {"MOE_A2A_NUM_METAINFO_FIELDS", NUM_METAINFO_FIELDS},
     };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -95,6 +95,17 @@ MoeA2ADataOffsets calculateOffsets(int epSize, int maxNumTokens, int eplbStatsNu
     offsets[EPLB_GATHERED_STATS_OFFSET_INDEX] = offset;
     offset += static_cast<size_t>(epSize) * static_cast<size_t>(eplbStatsNumExperts) * SIZEOF_INT32;
 
+    // replica counter for hierarchical dispatch (own cacheline: remote ranks increment it atomically)
+    offset = alignOffset(offset, CACHELINE_ALIGNMENT);
+    offsets[REPLICA_COUNTER_OFFSET_INDEX] = offset;
+    offset += SIZEOF_INT32;
+
+    // replica descriptors: [epSize, maxNumTokens] (each source queues at most one entry per token)
+    offset = alignOffset(offset, CACHELINE_ALIGNMENT);
+    offsets[REPLICA_DESCS_OFFSET_INDEX] = offset;
+    offset += static_cast<size_t>(epSize) * static_cast<size_t>(maxNumTokens)
+        * sizeof(tensorrt_llm::kernels::moe_comm::ReplicaDescriptor);
+
     // payload data
     offset = alignOffset(offset, CACHELINE_ALIGNMENT);
     offsets[PAYLOAD_DATA_OFFSET_INDEX] = offset;
@@ -317,6 +328,20 @@ std::tuple<std::vector<torch::Tensor>, int64_t, torch::Tensor> moeA2ADispatchOp(
 
     params.token_selected_experts = tokenSelectedExperts.data_ptr<int32_t>();
 
+    // Hierarchical dispatch: send each token across the inter-node fabric once per node and
+    // replicate to sibling ranks over node-local NVLink. The node size is taken from the MPI
+    // local session, which assumes the EP group is laid out contiguously across nodes; the
+    // feature stays off unless that size evenly divides epSize.
+    params.ranks_per_node = 1;
+    if (tensorrt_llm::common::getEnvMoeA2ANodeAggregation())
+    {
+        static int const localRanks = tensorrt_llm::mpi::MpiComm::localSession().getSize();
+        if (localRanks > 1 && localRanks < epSize && epSize % localRanks == 0)
+        {
+            params.ranks_per_node = localRanks;
+        }
+    }
+
     params.num_payloads = num_payloads;
     std::copy(payloadDescriptors.begin(), payloadDescriptors.end(), &params.payloads[0]);
 
@@ -334,6 +359,19 @@ std::tuple<std::vector<torch::Tensor>, int64_t, torch::Tensor> moeA2ADispatchOp(
             = reinterpret_cast<int*>(targetWorkSpacePtr + offsets[RECV_COUNTERS_OFFSET_INDEX]);
         params.completion_flags[target_rank]
             = reinterpret_cast<uint32_t*>(targetWorkSpacePtr + offsets[DISPATCH_COMPLETION_FLAGS_OFFSET_INDEX]);
+        if (params.ranks_per_node > 1)
+        {
+            params.replica_counters[target_rank]
+                = reinterpret_cast<int*>(targetWorkSpacePtr + offsets[REPLICA_COUNTER_OFFSET_INDEX]);
+            params.replica_descs[target_rank]
+                = reinterpret_cast<tensorrt_llm::kernels::moe_comm::ReplicaDescriptor*>(
+                    targetWorkSpacePtr + offsets[REPLICA_DESCS_OFFSET_INDEX]);
+        }
+        else
+        {
+            params.replica_counters[target_rank] = nullptr;
+            params.replica_descs[target_rank] = nullptr;
+        }
         if (enableEplb)
         {
             params.eplb_gathered_stats[target_rank]
@@ -370,6 +408,11 @@ std::tuple<std::vector<torch::Tensor>, int64_t, torch::Tensor> moeA2ADispatchOp(
     cudaError_t result = cudaGetLastError();
     TORCH_CHECK(result == cudaSuccess, "moe_a2a_dispatch kernel launch failed: ", cudaGetErrorString(result));
 
+    // Hierarchical dispatch epilogue: replicate node-deduplicated payloads from node-local leaders
+    tensorrt_llm::kernels::moe_comm::moe_a2a_node_replicate_launch(params);
+    result = cudaGetLastError();
+    TORCH_CHECK(result == cudaSuccess, "moe_a2a_node_replicate kernel launch failed: ", cudaGetErrorString(result));
+
     // Create tensor views for the current rank's receive buffers only
     std::vector<torch::Tensor> recvTensors;
     for (int payload_idx = 0; payload_idx < num_payloads; payload_idx++)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -91,6 +91,21 @@ WeightOnlyQuantGemmRunner::WeightOnlyQuantGemmRunner(at::ScalarType activation_d
     mConfigs = mGemmRunner->getConfigs();
     TORCH_CHECK(!mConfigs.empty(), "Failed to get CUTLASS configs for WeightOnlyQuantGemmRunner with activation type ",
         c10::toString(mActivationDtype), ", weight type ", c10::toString(mWeightDtype));
+
+    // Expose the batched GEMV fast path as an extra tactic so the autotuner can pick it
+    // per shape; for small-m decode it often beats every CUTLASS config.
+    mArch = tensorrt_llm::common::getSMVersion();
+    if (mActivationDtype == at::ScalarType::Half)
+    {
+        mCudaKernelType = weight_dtype == at::ScalarType::QUInt4x2 ? weight_only::KernelType::FP16Int4PerChannel
+                                                                   : weight_only::KernelType::FP16Int8PerChannel;
+    }
+    else
+    {
+        mCudaKernelType = weight_dtype == at::ScalarType::QUInt4x2 ? weight_only::KernelType::BF16Int4PerChannel
+                                                                   : weight_only::KernelType::BF16Int8PerChannel;
+    }
+    mCudaKernelEnabled = weight_only::is_supported(mArch, mCudaKernelType);
 }
 
 at::Tensor WeightOnlyQuantGemmRunner::runGemm(at::Tensor const& mat_a, at::Tensor const& mat_b,
@@ -125,6 +140,17 @@ at::Tensor WeightOnlyQuantGemmRunner::runGemm(at::Tensor const& mat_a, at::Tenso
 
     auto stream = at::cuda::getCurrentCUDAStream(mat_a.get_device());
 
+    auto const numCutlassConfigs = static_cast<int64_t>(mConfigs.size());
+    // The batched GEMV fast path covers m up to kMaxSupportedM (see WeightOnlyQuantGemmPluginProfiler::checkTactic).
+    if (mCudaKernelEnabled && config_idx == numCutlassConfigs && m <= weight_only::kMaxSupportedM)
+    {
+        weight_only::Params params{mat_a.data_ptr(), nullptr, mat_b.data_ptr(), weight_scales.data_ptr(), nullptr,
+            nullptr, out.data_ptr(), 1.f, static_cast<int>(m), static_cast<int>(real_n), static_cast<int>(k), 0,
+            mCudaKernelType};
+        weight_only::kernel_launcher(mArch, params, stream);
+        return out;
+    }
+
     auto workspace_size = mGemmRunner->getWorkspaceSize(m, real_n, k);
     at::Tensor workspace;
     char* workspace_ptr = nullptr;
@@ -136,7 +162,7 @@ at::Tensor WeightOnlyQuantGemmRunner::runGemm(at::Tensor const& mat_a, at::Tenso
     }
 
     tensorrt_llm::cutlass_extensions::CutlassGemmConfig gemm_config_to_use;
-    if (config_idx >= 0 && config_idx < getNumConfigs())
+    if (config_idx >= 0 && config_idx < numCutlassConfigs)
     {
         gemm_config_to_use = mConfigs.at(config_idx);
     }
@@ -154,7 +180,12 @@ at::Tensor WeightOnlyQuantGemmRunner::runGemm(at::Tensor const& mat_a, at::Tenso
 int64_t WeightOnlyQuantGemmRunner::getNumConfigs() const
 {
     TORCH_CHECK(mGemmRunner, "WeightOnlyQuantGemmRunner not initialized properly.");
-    return static_cast<int64_t>(mConfigs.size());
+    return static_cast<int64_t>(mConfigs.size()) + (mCudaKernelEnabled ? 1 : 0);
+}
+
+bool WeightOnlyQuantGemmRunner::isCudaKernelEnabled() const
+{
+    return mCudaKernelEnabled;
 }
 
 } // namespace torch_ext
@@ -166,5 +197,6 @@ TORCH_LIBRARY_FRAGMENT(trtllm, m)
     m.class_<tensorrt_llm::torch_ext::WeightOnlyQuantGemmRunner>("WeightOnlyQuantGemmRunner")
         .def(torch::init<at::ScalarType, at::ScalarType>())
         .def("run_gemm", &tensorrt_llm::torch_ext::WeightOnlyQuantGemmRunner::runGemm)
-        .def("get_num_configs", &tensorrt_llm::torch_ext::WeightOnlyQuantGemmRunner::getNumConfigs);
+        .def("get_num_configs", &tensorrt_llm::torch_ext::WeightOnlyQuantGemmRunner::getNumConfigs)
+        .def("is_cuda_kernel_enabled", &tensorrt_llm::torch_ext::WeightOnlyQuantGemmRunner::isCudaKernelEnabled);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2025-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/kernels/cutlass_kernels/cutlass_heuristic.h"
 #include "tensorrt_llm/kernels/cutlass_kernels/fpA_intB_gemm/fpA_intB_gemm.h"
+#include "tensorrt_llm/kernels/weightOnlyBatchedGemv/kernelLauncher.h"
 #include "tensorrt_llm/thop/thUtils.h"
 #include "tensorrt_llm/thop/userbuffersTensor.h"
 
@@ -44,13 +45,21 @@ public:
     at::Tensor runGemm(at::Tensor const& mat_a, at::Tensor const& mat_b, at::Tensor const& weight_scales,
         int64_t config_idx, bool to_userbuffers, std::optional<c10::ScalarType> out_dtype);
 
+    //! Number of tunable configs: the CUTLASS configs plus, when supported on this arch,
+    //! one extra tactic (the last index) selecting the batched GEMV fast path.
     int64_t getNumConfigs() const;
 
+    //! Whether the batched GEMV fast path is available as the last tactic.
+    bool isCudaKernelEnabled() const;
+
 private:
     WeightOnlyQuantGemmRunnerPtr mGemmRunner;
     at::ScalarType mActivationDtype;
     at::ScalarType mWeightDtype;
     std::vector<tensorrt_llm::cutlass_extensions::CutlassGemmConfig> mConfigs;
+    int mArch;
+    bool mCudaKernelEnabled{false};
+    weight_only::KernelType mCudaKernelType;
 };
 
 } // namespace torch_ext
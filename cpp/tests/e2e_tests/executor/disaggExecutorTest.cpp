@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -182,6 +182,7 @@ void runDisaggTest(tensorrt_llm::testing::disaggexecutor::DisaggExecutorLeader&
 
     std::unordered_map<IdType, SizeType32> reqIdToBatchId;
     std::unordered_map<SizeType32, std::vector<BeamTokens>> tokens;
+    std::unordered_map<SizeType32, std::vector<std::vector<VecLogProbs>>> accumLogProbs;
     auto [givenInputLengths, nbGivenInputs, maxInputLength] = getGivenInputLengths(givenInput, modelIds.padId);
     auto const* const givenInputData = tr::bufferCast<TokenIdType const>(givenInput);
 
@@ -232,6 +233,8 @@ void runDisaggTest(tensorrt_llm::testing::disaggexecutor::DisaggExecutorLeader&
             auto retReqId = executor.enqueueRequests({requests[i]});
             reqIds.push_back(retReqId.front());
             tokens[i] = std::move(resultTokens);
+            accumLogProbs[i]
+                = std::vector<std::vector<VecLogProbs>>(numReturnSequences, std::vector<VecLogProbs>(beamWidth));
             reqIdToBatchId[retReqId.front()] = i;
         }
 
@@ -273,7 +276,20 @@ void runDisaggTest(tensorrt_llm::testing::disaggexecutor::DisaggExecutorLeader&
                     }
 
                     auto& cumLogProbs = result.cumLogProbs;
-                    auto& logProbs = result.logProbs;
+                    auto logProbs = result.logProbs;
+                    if (streaming && !returnAllGeneratedTokens && logProbs.has_value())
+                    {
+                        // Streamed responses only carry the new tokens' logprobs; accumulate them
+                        // like the tokens above before verifying.
+                        auto& reqLogProbs = accumLogProbs.at(batchId).at(seqIdx);
+                        for (SizeType32 beam = 0; beam < beamWidth; ++beam)
+                        {
+                            auto& beamLogProbs = reqLogProbs.at(beam);
+                            beamLogProbs.insert(
+                                beamLogProbs.end(), logProbs->at(beam).begin(), logProbs->at(beam).end());
+                        }
+                        logProbs = reqLogProbs;
+                    }
                     auto& beamTokens = tokens.at(batchId).at(seqIdx);
                     testData.verifyLogProbs(outConfig.returnLogProbs, streaming, outConfig.excludeInputFromOutput,
                         givenInputLengths.at(batchId), beamWidth, beamTokens, cumLogProbs, logProbs, batchId,
@@ -319,6 +335,7 @@ void runDisaggTest(DisaggExecutorOrchestrator& executor, tensorrt_llm::runtime::
 
     std::unordered_map<IdType, SizeType32> reqIdToBatchId;
     std::unordered_map<SizeType32, std::vector<BeamTokens>> tokens;
+    std::unordered_map<SizeType32, std::vector<std::vector<VecLogProbs>>> accumLogProbs;
     // std::unordered_map<IdType, IdType> gGenIdIdTogContextId;
     auto [givenInputLengths, nbGivenInputs, maxInputLength] = getGivenInputLengths(givenInput, modelIds.padId);
     auto const* const givenInputData = tr::bufferCast<TokenIdType const>(givenInput);
@@ -370,6 +387,8 @@ void runDisaggTest(DisaggExecutorOrchestrator& executor, tensorrt_llm::runtime::
             auto retReqId = executor.enqueueContext({requests[i]}, std::nullopt);
             reqIds.push_back(retReqId.front());
             tokens[i] = std::move(resultTokens);
+            accumLogProbs[i]
+                = std::vector<std::vector<VecLogProbs>>(numReturnSequences, std::vector<VecLogProbs>(beamWidth));
             reqIdToBatchId[retReqId.front()] = i;
         }
 
@@ -431,7 +450,20 @@ void runDisaggTest(DisaggExecutorOrchestrator& executor, tensorrt_llm::runtime::
                     }
 
                     auto& cumLogProbs = result.cumLogProbs;
-                    auto& logProbs = result.logProbs;
+                    auto logProbs = result.logProbs;
+                    if (streaming && !returnAllGeneratedTokens && logProbs.has_value())
+                    {
+                        // Streamed responses only carry the new tokens' logprobs; accumulate them
+                        // like the tokens above before verifying.
+                        auto& reqLogProbs = accumLogProbs.at(batchId).at(seqIdx);
+                        for (SizeType32 beam = 0; beam < beamWidth; ++beam)
+                        {
+                            auto& beamLogProbs = reqLogProbs.at(beam);
+                            beamLogProbs.insert(
+                                beamLogProbs.end(), logProbs->at(beam).begin(), logProbs->at(beam).end());
+                        }
+                        logProbs = reqLogProbs;
+                    }
                     auto& beamTokens = tokens.at(batchId).at(seqIdx);
                     testData.verifyLogProbs(outConfig.returnLogProbs, streaming, outConfig.excludeInputFromOutput,
                         givenInputLengths.at(batchId), beamWidth, beamTokens, cumLogProbs, logProbs, batchId,
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -1963,12 +1963,14 @@ void runTest(Executor& executor, fs::path const& inputPath, ModelIds const& mode
         auto const reqIds = executor.enqueueRequests(requests);
 
         std::unordered_map<SizeType32, std::vector<BeamTokens>> tokens;
+        std::unordered_map<SizeType32, std::vector<std::vector<VecLogProbs>>> accumLogProbs;
         std::unordered_map<IdType, SizeType32> reqIdToBatchId;
 
         for (SizeType32 req = 0; req < reqIds.size(); ++req)
         {
             std::vector<BeamTokens> resultTokens(numSequences, BeamTokens(numReturnBeams));
             tokens[req] = std::move(resultTokens);
+            accumLogProbs[req] = std::vector<std::vector<VecLogProbs>>(numSequences, std::vector<VecLogProbs>(numReturnBeams));
             reqIdToBatchId[reqIds.at(req)] = req;
         }
 
@@ -2019,7 +2021,20 @@ void runTest(Executor& executor, fs::path const& inputPath, ModelIds const& mode
                     }
 
                     auto const& cumLogProbs = result.cumLogProbs;
-                    auto const& logProbs = result.logProbs;
+                    auto logProbs = result.logProbs;
+                    if (streaming && !returnAllGeneratedTokens && logProbs.has_value())
+                    {
+                        // Streamed responses only carry the new tokens' logprobs; accumulate them
+                        // like the tokens above before verifying.
+                        auto& reqLogProbs = accumLogProbs.at(batchId).at(seqIdx);
+                        for (SizeType32 beam = 0; beam < numReturnBeams; ++beam)
+                        {
+                            auto& beamLogProbs = reqLogProbs.at(beam);
+                            beamLogProbs.insert(
+                                beamLogProbs.end(), logProbs->at(beam).begin(), logProbs->at(beam).end());
+                        }
+                        logProbs = reqLogProbs;
+                    }
                     auto const& beamTokens = tokens.at(batchId).at(seqIdx);
                     EXPECT_EQ(beamTokens.size(), numReturnBeams);
 
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -141,6 +141,41 @@ TEST_F(LRUPolicyTest, LRUTest)
     ASSERT_EQ(std::get<0>(policy->getFreeBlock(0))->getBlockId(), block1->getBlockId());
 }
 
+TEST_F(LRUPolicyTest, ScanResistantEvictionTest)
+{
+    policy->setScanResistantEviction(true);
+
+    BlockKey key({1, 2, 3});
+
+    // scanBlock holds cached content that was never re-hit; hotBlock's content was reused once.
+    auto scanBlock = std::get<0>(policy->getFreeBlock(0));
+    policy->claimBlock(scanBlock);
+    scanBlock->setBlockKey(key, true);
+
+    auto hotBlock = std::get<0>(policy->getFreeBlock(0));
+    policy->claimBlock(hotBlock);
+    hotBlock->setBlockKey(key, true);
+    hotBlock->markReused();
+
+    // Plain LRU would evict hotBlock before scanBlock after this release order.
+    policy->releaseBlock(hotBlock);
+    policy->releaseBlock(scanBlock);
+
+    // The never-reused block queues at the front and is evicted first, ahead of the untouched blocks.
+    auto evicted = std::get<0>(policy->getFreeBlock(0));
+    EXPECT_EQ(evicted->getBlockId(), scanBlock->getBlockId());
+    policy->claimBlock(evicted);
+
+    // The reused block went to the back: everything else is evicted before it.
+    for (int i = 0; i < NUM_PRIMARY_BLOCKS - 2; i++)
+    {
+        auto block = std::get<0>(policy->getFreeBlock(0));
+        EXPECT_NE(block->getBlockId(), hotBlock->getBlockId());
+        policy->claimBlock(block);
+    }
+    EXPECT_EQ(std::get<0>(policy->getFreeBlock(0))->getBlockId(), hotBlock->getBlockId());
+}
+
 TEST_F(LRUPolicyTest, PriorityTest)
 {
     // Test that min priority blocks don't get offloaded
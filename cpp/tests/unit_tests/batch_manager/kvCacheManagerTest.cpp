@@ -163,7 +163,7 @@ TEST_F(KVCacheManagerTest, BlockManagerTest)
 
     auto constexpr requestId = 42;
 
-    // Test: last block NOT shared (inputLength not aligned to tokensPerBlock)
+    // Test: partially filled last context block stays shared among beams copy-on-write
     auto constexpr numTokensNotAligned = numTokens - 1;
     auto inputTokensNotAligned = makeInputTokens(numTokensNotAligned);
     auto llmReq0 = std::make_shared<LlmRequest>(
@@ -172,8 +172,7 @@ TEST_F(KVCacheManagerTest, BlockManagerTest)
     blockManager.holdSequence(seq0.getRequestId());
     (void) blockManager.addSequence(
         seq0, numTokensNotAligned, numBlocksPerBeam, *llmReq0, maxAttentionWindow, /*isEnableBlockReuse=*/false);
-    auto constexpr occupiedBlocks = (numBlocksPerBeam - 1) + beamWidth;
-    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - occupiedBlocks);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - numBlocksPerBeam);
     auto const& ids = seq0.getCacheBlockIds(maxAttentionWindow);
     std::set<std::int32_t> idSet{};
     EXPECT_EQ(ids.size(), beamWidth);
@@ -182,6 +181,18 @@ TEST_F(KVCacheManagerTest, BlockManagerTest)
         EXPECT_EQ(beam.size(), blocksInPrimaryPool / beamWidth);
         idSet.insert(beam.begin(), beam.end());
     }
+    EXPECT_EQ(idSet.size(), numBlocksPerBeam);
+
+    // First generation token diverges the beams: the shared last block is split into per-beam copies.
+    seq0.addNewTokens(1);
+    blockManager.adjustBlocksIfNeeded(seq0);
+    auto constexpr occupiedBlocks = (numBlocksPerBeam - 1) + beamWidth;
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - occupiedBlocks);
+    idSet.clear();
+    for (auto const& beam : seq0.getCacheBlockIds(maxAttentionWindow))
+    {
+        idSet.insert(beam.begin(), beam.end());
+    }
     EXPECT_EQ(idSet.size(), occupiedBlocks);
     blockManager.releaseBlocks(seq0);
     EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool);
@@ -228,14 +239,22 @@ TEST_F(KVCacheManagerTest, BlockManagerTest)
     EXPECT_THROW((void) blockManager.addSequence(seq2, numTokensNotAligned, numBlocksPerBeam, *llmReq4,
                      maxAttentionWindow, /*isEnableBlockReuse=*/false),
         std::runtime_error);
-    // no more blocks
+    // Diverge both sequences so they occupy their full per-beam footprint.
+    seq0c.addNewTokens(1);
+    blockManager.adjustBlocksIfNeeded(seq0c);
+    seq1.addNewTokens(1);
+    blockManager.adjustBlocksIfNeeded(seq1);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - 2 * occupiedBlocks);
+    // A third sequence can still be admitted on shared blocks (copy-on-write overcommit) ...
     auto llmReq5 = std::make_shared<LlmRequest>(
         LlmRequest::RequestIdType{requestId + 2}, maxNewTokens, inputTokensNotAligned, samplingConfig, isStreaming);
     GenerationRequest seq3{requestId + 2, numTokensNotAligned, beamWidth, blockManager.getWindowSizesMetadata()};
     blockManager.holdSequence(seq3.getRequestId());
-    EXPECT_THROW((void) blockManager.addSequence(seq3, numTokensNotAligned, numBlocksPerBeam, *llmReq5,
-                     maxAttentionWindow, /*isEnableBlockReuse=*/false),
-        std::runtime_error);
+    EXPECT_NO_THROW((void) blockManager.addSequence(
+        seq3, numTokensNotAligned, numBlocksPerBeam, *llmReq5, maxAttentionWindow, /*isEnableBlockReuse=*/false));
+    // ... but splitting its shared last block at divergence exhausts the pool.
+    seq3.addNewTokens(1);
+    EXPECT_THROW(blockManager.adjustBlocksIfNeeded(seq3), std::runtime_error);
 }
 
 template <typename T>
@@ -3283,7 +3302,8 @@ TEST_P(KVCacheManagerTest, KVCacheManagerTest)
     auto llmReq0 = std::make_shared<LlmRequest>(
         LlmRequest::RequestIdType{requestId}, maxNewTokens, inputTokens0, samplingConfig, isStreaming);
     EXPECT_NO_THROW(kvCacheManager.addSequenceBatch({{{requestId, inputLength, maxBeamWidth}}}, {std::ref(*llmReq0)}));
-    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocks - maxBeamWidth);
+    // The partially filled last context block is shared among beams copy-on-write until divergence.
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocks - 1);
 
     tr::ITensor::SharedPtr kvCacheBlockOffsets = tr::BufferManager::cpu(
         tr::ITensor::makeShape({expectedNumPools, maxNumSequences * maxBeamWidth, 2, maxBlocksPerSeq}),
@@ -3334,6 +3354,7 @@ TEST_P(KVCacheManagerTest, KVCacheManagerTest)
                 runningSum += offsetBetweenBlocks;
             }
             {
+                // The last context block is still shared, so all beams reference the same offsets.
                 auto const block = numSharedBlocks;
                 for (auto beam = 0; beam < maxBeamWidth; ++beam)
                 {
@@ -3343,8 +3364,8 @@ TEST_P(KVCacheManagerTest, KVCacheManagerTest)
                     auto const vOffset = blockOffsetsPtr[vOffsetIdx];
                     EXPECT_EQ(kOffset.get(), runningSum) << "beam:" << beam << " block:" << block;
                     ASSERT_EQ(vOffset.get(), runningSum + 1) << "beam:" << beam << " block:" << block;
-                    runningSum += offsetBetweenBlocks;
                 }
+                runningSum += offsetBetweenBlocks;
             }
             {
                 auto const block = numSharedBlocks + 1;
@@ -3362,6 +3383,7 @@ TEST_P(KVCacheManagerTest, KVCacheManagerTest)
         }
     }
 
+    // First generated token diverges the beams: the shared last context block is split into per-beam copies.
     EXPECT_NO_THROW(kvCacheManager.addToken(requestId));
     EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocks - maxBeamWidth);
     EXPECT_NO_THROW(kvCacheManager.addToken(requestId));
@@ -3377,11 +3399,11 @@ TEST_P(KVCacheManagerTest, KVCacheManagerTest)
             inputTokensLoop, samplingConfig, isStreaming);
         EXPECT_NO_THROW(
             kvCacheManager.addSequenceBatch({{{requestId, inputLength, maxBeamWidth}}}, {std::ref(*llmReqLoop)}));
-        currentNumBlocks -= numSharedBlocks + maxBeamWidth;
+        currentNumBlocks -= numSharedBlocks + 1;
         EXPECT_EQ(blockManager.getNumFreeBlocks(), currentNumBlocks);
         EXPECT_NO_THROW(kvCacheManager.addToken(requestId));
         EXPECT_NO_THROW(kvCacheManager.addToken(requestId));
-        currentNumBlocks -= maxBeamWidth;
+        currentNumBlocks -= 2 * maxBeamWidth - 1;
         EXPECT_EQ(blockManager.getNumFreeBlocks(), currentNumBlocks);
     }
     EXPECT_EQ(blockManager.getNumFreeBlocks(), 0);
@@ -4843,7 +4865,8 @@ TEST_P(KVCacheManagerTest, DISABLED_KVCacheManagerSinkTokenLengthTest)
     auto llmReq0 = std::make_shared<LlmRequest>(
         LlmRequest::RequestIdType{requestId}, maxNewTokens, inputTokens0, samplingConfig, isStreaming);
     EXPECT_NO_THROW(kvCacheManager.addSequenceBatch({{{requestId, inputLength, maxBeamWidth}}}, {std::ref(*llmReq0)}));
-    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocksCtx - maxBeamWidth);
+    // The partially filled last context block is shared among beams copy-on-write until divergence.
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocksCtx - 1);
 
     tr::ITensor::SharedPtr kvCacheBlockOffsets = tr::BufferManager::cpu(
         tr::ITensor::makeShape({expectedNumPools, maxNumSequences * maxBeamWidth, 2, maxBlocksPerSeq}),
@@ -4890,6 +4913,7 @@ TEST_P(KVCacheManagerTest, DISABLED_KVCacheManagerSinkTokenLengthTest)
                 runningSum += offsetBetweenBlocks;
             }
             {
+                // The last context block is still shared, so all beams reference the same offsets.
                 auto const block = numSharedBlocksCtx;
                 for (auto beam = 0; beam < maxBeamWidth; ++beam)
                 {
@@ -4899,17 +4923,17 @@ TEST_P(KVCacheManagerTest, DISABLED_KVCacheManagerSinkTokenLengthTest)
                     auto const vOffset = blockOffsetsPtr[vOffsetIdx];
                     EXPECT_EQ(kOffset.get(), runningSum) << "beam:" << beam << " block:" << block;
                     ASSERT_EQ(vOffset.get(), runningSum + 1) << "beam:" << beam << " block:" << block;
-                    runningSum += offsetBetweenBlocks;
                 }
+                runningSum += offsetBetweenBlocks;
             }
         }
     }
 
-    // replace the shared block with unshared blocks
+    // replace the shared block with unshared blocks (copy-on-write divergence)
     EXPECT_NO_THROW(kvCacheManager.addToken(requestId));
-    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocksCtx - maxBeamWidth * 2 + 1);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocksCtx - maxBeamWidth);
     EXPECT_NO_THROW(kvCacheManager.addToken(requestId));
-    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocksCtx - maxBeamWidth * 2 + 1);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numSharedBlocksCtx - maxBeamWidth);
     EXPECT_NO_THROW((void) kvCacheManager.removeSequence(requestId));
     EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks);
 
@@ -4922,13 +4946,13 @@ TEST_P(KVCacheManagerTest, DISABLED_KVCacheManagerSinkTokenLengthTest)
             LlmRequest::RequestIdType{nextRequestId}, maxNewTokens, inputTokensLoop, samplingConfig, isStreaming);
         EXPECT_NO_THROW(
             kvCacheManager.addSequenceBatch({{{nextRequestId, inputLength, maxBeamWidth}}}, {std::ref(*llmReqLoop)}));
-        currentNumBlocks -= numSharedBlocksCtx + maxBeamWidth;
+        currentNumBlocks -= numSharedBlocksCtx + 1;
         EXPECT_EQ(blockManager.getNumFreeBlocks(), currentNumBlocks);
         EXPECT_NO_THROW(kvCacheManager.addToken(nextRequestId));
         currentNumBlocks -= maxBeamWidth - 1;
         EXPECT_EQ(blockManager.getNumFreeBlocks(), currentNumBlocks);
     }
-    auto numUsedBlocks = maxNumSequences * (numSharedBlocksCtx + maxBeamWidth * 2 - 1);
+    auto numUsedBlocks = maxNumSequences * (numSharedBlocksCtx + maxBeamWidth);
     EXPECT_EQ(blockManager.getNumFreeBlocks(), totalNumBlocks - numUsedBlocks);
 }
 
@@ -5008,7 +5032,8 @@ TEST_P(KVCacheManagerTest, KVCacheManagerBatchTest)
             inputTokensLoop, samplingConfig, isStreaming);
         EXPECT_NO_THROW(
             kvCacheManager.addSequenceBatch({{{requestId, inputLength, maxBeamWidth}}}, {std::ref(*llmReqLoop)}));
-        auto const currentNumBlocks = totalNumBlocks - (requestId + 1) * (numSharedBlocks + maxBeamWidth);
+        // The partially filled last context block is shared among beams copy-on-write until divergence.
+        auto const currentNumBlocks = totalNumBlocks - (requestId + 1) * (numSharedBlocks + 1);
         EXPECT_EQ(blockManager.getNumFreeBlocks(), currentNumBlocks);
     }
 
@@ -5062,7 +5087,7 @@ TEST_P(KVCacheManagerTest, KVCacheManagerBatchTest)
                     }
                     runningSum += offsetBetweenBlocks;
                 }
-                // Unshared blocks
+                // Last context block: still shared, so all beams reference the same offsets
                 auto const block = numSharedBlocks;
                 {
                     for (auto beam = 0; beam < maxBeamWidth; ++beam)
@@ -5075,8 +5100,8 @@ TEST_P(KVCacheManagerTest, KVCacheManagerBatchTest)
                         auto const vOffset = blockOffsetsPtr[vOffsetIdx];
                         EXPECT_EQ(kOffset.get(), runningSum) << "beam:" << beam << " block:" << block;
                         ASSERT_EQ(vOffset.get(), runningSum + 1) << "beam:" << beam << " block:" << block;
-                        runningSum += offsetBetweenBlocks;
                     }
+                    runningSum += offsetBetweenBlocks;
                 }
             }
         }
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/batch_manager/sequenceSlotManager.h"
+#include <gtest/gtest.h>
+
+using tensorrt_llm::batch_manager::SequenceSlotManager;
+
+TEST(SequenceSlotManagerTest, AssignFreeReuse)
+{
+    SequenceSlotManager manager{2, /*maxSequenceIdleMicroseconds=*/60'000'000};
+
+    auto const slotA = manager.getSequenceSlot(true, 1);
+    auto const slotB = manager.getSequenceSlot(true, 2);
+    ASSERT_TRUE(slotA.has_value());
+    ASSERT_TRUE(slotB.has_value());
+    EXPECT_NE(slotA.value(), slotB.value());
+
+    // Table full: a third sequence cannot be admitted.
+    EXPECT_FALSE(manager.getSequenceSlot(true, 3).has_value());
+
+    // Continuation lookups return the assigned slot.
+    EXPECT_EQ(manager.getSequenceSlot(false, 1), slotA);
+
+    // Freeing recycles the slot immediately.
+    manager.freeSequenceSlot(1);
+    auto const slotC = manager.getSequenceSlot(true, 3);
+    ASSERT_TRUE(slotC.has_value());
+    EXPECT_EQ(slotC.value(), slotA.value());
+}
+
+TEST(SequenceSlotManagerTest, DuplicateStartDoesNotLeakSlot)
+{
+    SequenceSlotManager manager{2, /*maxSequenceIdleMicroseconds=*/60'000'000};
+
+    auto const slotA = manager.getSequenceSlot(true, 1);
+    ASSERT_TRUE(slotA.has_value());
+
+    // A repeated start flag for the same sequence id must return the existing slot without
+    // claiming a second one from the free list.
+    auto const slotDup = manager.getSequenceSlot(true, 1);
+    ASSERT_TRUE(slotDup.has_value());
+    EXPECT_EQ(slotDup.value(), slotA.value());
+
+    // The remaining slot is still available for another sequence.
+    EXPECT_TRUE(manager.getSequenceSlot(true, 2).has_value());
+}
+
+TEST(SequenceSlotManagerTest, FreeUnknownSequenceIsNoOp)
+{
+    SequenceSlotManager manager{1, /*maxSequenceIdleMicroseconds=*/60'000'000};
+
+    manager.freeSequenceSlot(42);
+    EXPECT_TRUE(manager.getSequenceSlot(true, 1).has_value());
+}
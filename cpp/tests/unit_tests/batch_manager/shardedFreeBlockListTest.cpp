@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/batch_manager/shardedFreeBlockList.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+using tensorrt_llm::batch_manager::kv_cache_manager::ShardedFreeBlockList;
+
+using IntPtr = std::shared_ptr<int>;
+
+TEST(ShardedFreeBlockListTest, PushPopSingleThread)
+{
+    ShardedFreeBlockList<IntPtr> list{4};
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.tryPop(), nullptr);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        list.push(std::make_shared<int>(i));
+    }
+    EXPECT_EQ(list.size(), 10);
+
+    std::set<int> popped;
+    for (int i = 0; i < 10; ++i)
+    {
+        auto block = list.tryPop();
+        ASSERT_NE(block, nullptr);
+        popped.insert(*block);
+    }
+    EXPECT_EQ(popped.size(), 10);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.tryPop(), nullptr);
+}
+
+TEST(ShardedFreeBlockListTest, StealingFindsBlocksInOtherShards)
+{
+    // One producer thread fills its home shard; consumers on other threads must still find every block.
+    ShardedFreeBlockList<IntPtr> list{8};
+
+    std::thread producer(
+        [&list]
+        {
+            for (int i = 0; i < 64; ++i)
+            {
+                list.push(std::make_shared<int>(i));
+            }
+        });
+    producer.join();
+
+    std::atomic<int> numPopped{0};
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 4; ++t)
+    {
+        consumers.emplace_back(
+            [&list, &numPopped]
+            {
+                while (auto block = list.tryPop())
+                {
+                    numPopped.fetch_add(1);
+                }
+            });
+    }
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+    EXPECT_EQ(numPopped.load(), 64);
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(ShardedFreeBlockListTest, DrainReturnsEverything)
+{
+    ShardedFreeBlockList<IntPtr> list{4};
+    for (int i = 0; i < 17; ++i)
+    {
+        list.push(std::make_shared<int>(i));
+    }
+
+    auto drained = list.drain();
+    EXPECT_EQ(drained.size(), 17);
+    EXPECT_TRUE(list.empty());
+
+    std::set<int> values;
+    for (auto const& block : drained)
+    {
+        values.insert(*block);
+    }
+    EXPECT_EQ(values.size(), 17);
+}
+
+TEST(ShardedFreeBlockListTest, ConcurrentPushPop)
+{
+    ShardedFreeBlockList<IntPtr> list{0}; // default shard count
+    constexpr int kNumThreads = 8;
+    constexpr int kPerThread = 500;
+
+    std::atomic<int> numPopped{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        threads.emplace_back(
+            [&list, &numPopped]
+            {
+                for (int i = 0; i < kPerThread; ++i)
+                {
+                    list.push(std::make_shared<int>(i));
+                    if (i % 2 == 0)
+                    {
+                        if (auto block = list.tryPop())
+                        {
+                            numPopped.fetch_add(1);
+                        }
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(list.size() + numPopped.load(), kNumThreads * kPerThread);
+}
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -97,3 +97,36 @@ TEST(DynamicBatchConfig, RuntimeMaxNumTokens)
     // gen heavy fall back
     EXPECT_EQ(dynamicBatchTuner.getRuntimeMaxNumTokens(4000), 4096);
 }
+
+TEST(DynamicBatchConfig, FeedbackScale)
+{
+    DynamicBatchConfig dynamicBatchConfig(true, true, 3);
+    DynamicBatchTuner dynamicBatchTuner(dynamicBatchConfig);
+
+    // Before any iteration latency is recorded, the feedback scale is neutral and the
+    // heuristic results are unchanged.
+    EXPECT_EQ(dynamicBatchTuner.getFeedbackScale(), 1.0);
+    EXPECT_EQ(dynamicBatchTuner.getRuntimeBatchSize(2049), 2048);
+
+    // First full evaluation window: the controller starts probing upwards.
+    for (int i = 0; i < 64; ++i)
+    {
+        dynamicBatchTuner.recordIterationLatency(10.0, 32);
+    }
+    EXPECT_GT(dynamicBatchTuner.getFeedbackScale(), 1.0);
+
+    // A window with clearly worse throughput makes the controller back off and probe the
+    // other direction.
+    for (int i = 0; i < 64; ++i)
+    {
+        dynamicBatchTuner.recordIterationLatency(10.0, 8);
+    }
+    EXPECT_LT(dynamicBatchTuner.getFeedbackScale(), 1.0);
+
+    // The scaled batch size never exceeds the capacity limit.
+    EXPECT_LE(dynamicBatchTuner.getRuntimeBatchSize(2049), 2049);
+
+    // Zero-latency or idle iterations are ignored.
+    dynamicBatchTuner.recordIterationLatency(0.0, 32);
+    dynamicBatchTuner.recordIterationLatency(10.0, 0);
+}
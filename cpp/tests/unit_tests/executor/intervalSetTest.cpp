@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 
+using tensorrt_llm::executor::CompactIdSet;
 using tensorrt_llm::executor::IntervalSet;
 using tensorrt_llm::executor::IdType;
 
@@ -221,4 +222,71 @@ TEST_F(IntervalSetTest, testTerminatedReqIdIntervals)
     }
 }
 
+TEST(CompactIdSetTest, testPublicAPI)
+{
+    CompactIdSet<IdType> idSet;
+    EXPECT_FALSE(idSet.contains(0));
+    EXPECT_EQ(idSet.getNumElements(), 0);
+    idSet.insert(0);
+    idSet.insert(1);
+    idSet.insert(4);
+    idSet.insert(6);
+    EXPECT_TRUE(idSet.contains(0));
+    EXPECT_TRUE(idSet.contains(4));
+    EXPECT_FALSE(idSet.contains(2125));
+    EXPECT_EQ(idSet.getNumElements(), 4);
+    idSet.insert(6);
+    idSet.insert(4);
+    idSet.insert(1);
+    idSet.insert(0);
+    EXPECT_EQ(idSet.getNumElements(), 4);
+    EXPECT_FALSE(idSet.contains(9));
+    EXPECT_FALSE(idSet.contains(3));
+    idSet.clear();
+    EXPECT_EQ(idSet.getNumElements(), 0);
+    EXPECT_FALSE(idSet.contains(0));
+}
+
+TEST(CompactIdSetTest, testNonMonotonicInsert)
+{
+    CompactIdSet<IdType> idSet;
+    // Interleave two reused ID ranges in a non-monotonic order.
+    for (IdType i = 0; i < 1000; i++)
+    {
+        idSet.insert(999 - i);
+        idSet.insert(100000 + i * 7);
+    }
+    EXPECT_EQ(idSet.getNumElements(), 2000);
+    for (IdType i = 0; i < 1000; i++)
+    {
+        EXPECT_TRUE(idSet.contains(i));
+        EXPECT_TRUE(idSet.contains(100000 + i * 7));
+        EXPECT_FALSE(idSet.contains(100001 + i * 7));
+    }
+}
+
+TEST(CompactIdSetTest, testCompaction)
+{
+    CompactIdSet<IdType> idSet;
+    // Insert a dense range large enough to trigger compaction of fully populated words.
+    constexpr IdType numIds = 64 * 64 * 4;
+    for (IdType i = 0; i < numIds; i++)
+    {
+        idSet.insert(i);
+    }
+    EXPECT_EQ(idSet.getNumElements(), numIds);
+    // Compaction folds full words into intervals, leaving few (if any) bitmap words behind.
+    EXPECT_LT(idSet.getNumBitmapWords(), 64);
+    for (IdType i = 0; i < numIds; i++)
+    {
+        EXPECT_TRUE(idSet.contains(i));
+        idSet.insert(i);
+    }
+    EXPECT_EQ(idSet.getNumElements(), numIds);
+    EXPECT_FALSE(idSet.contains(numIds));
+    idSet.clear();
+    EXPECT_EQ(idSet.getNumElements(), 0);
+    EXPECT_EQ(idSet.getNumBitmapWords(), 0);
+}
+
 } // namespace
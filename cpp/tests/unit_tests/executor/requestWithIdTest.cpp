@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -16,9 +16,12 @@
  */
 
 #include "tensorrt_llm/executor/requestWithId.h"
+#include "tensorrt_llm/executor/tokenSpanPool.h"
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 using ::testing::_;
 using ::testing::Invoke;
 
@@ -84,3 +87,49 @@ TEST(RequestWithIdTest, serializeDeserialize)
             req.getExternalDraftTokensConfig().value().getTokens());
     }
 }
+
+TEST(RequestWithIdTest, serializeDeduplicatesSharedPrefixes)
+{
+    VecTokens prefix(1024);
+    std::iota(prefix.begin(), prefix.end(), 0);
+
+    auto tokensA = prefix;
+    tokensA.push_back(42);
+    auto tokensB = prefix;
+    tokensB.push_back(43);
+
+    std::vector<RequestWithId> both;
+    both.emplace_back(RequestWithId{Request(tokensA, 10), 1});
+    both.emplace_back(RequestWithId{Request(tokensB, 10), 2});
+    std::vector<RequestWithId> single;
+    single.emplace_back(RequestWithId{Request(tokensA, 10), 1});
+
+    auto serializedBoth = RequestWithId::serializeReqWithIds(both);
+    auto serializedSingle = RequestWithId::serializeReqWithIds(single);
+
+    // The second request ships its shared 1024-token prefix as chunk back-references.
+    EXPECT_LT(serializedBoth.size(), 2 * serializedSingle.size() - prefix.size() * sizeof(TokenIdType) / 2);
+
+    auto reqWithIdsOut = RequestWithId::deserializeReqWithIds(serializedBoth);
+    ASSERT_EQ(reqWithIdsOut.size(), 2);
+    EXPECT_EQ(reqWithIdsOut.at(0).req.getInputTokenIds(), tokensA);
+    EXPECT_EQ(reqWithIdsOut.at(1).req.getInputTokenIds(), tokensB);
+}
+
+TEST(TokenSpanPoolTest, internReturnsSharedSpan)
+{
+    auto& pool = TokenSpanPool::getInstance();
+
+    VecTokens tokens(512);
+    std::iota(tokens.begin(), tokens.end(), 1000);
+
+    auto span1 = pool.intern(tokens.data(), tokens.size());
+    auto span2 = pool.intern(tokens.data(), tokens.size());
+    EXPECT_EQ(span1.get(), span2.get());
+    EXPECT_EQ(*span1, tokens);
+
+    tokens.back() += 1;
+    auto span3 = pool.intern(tokens.data(), tokens.size());
+    EXPECT_NE(span1.get(), span3.get());
+    EXPECT_EQ(*span3, tokens);
+}
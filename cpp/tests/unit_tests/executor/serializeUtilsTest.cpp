@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -55,6 +55,8 @@ void compareRequestPerfMetrics(texec::RequestPerfMetrics const& lh, texec::Reque
     EXPECT_EQ(lh.firstIter, rh.firstIter);
     EXPECT_EQ(lh.lastIter, rh.lastIter);
     EXPECT_EQ(lh.iter, rh.iter);
+
+    EXPECT_EQ(lh.attributedGpuTimeMs, rh.attributedGpuTimeMs);
 }
 
 void compareKvCacheStats(texec::KvCacheStats const& lh, texec::KvCacheStats const& rh)
@@ -355,6 +357,7 @@ TEST(SerializeUtilsTest, RequestPerfMetrics)
     texec::RequestPerfMetrics::KvCacheMetrics kvCacheMetrics{1, 2, 3, 4, 5};
 
     texec::RequestPerfMetrics val{timingMetrics, kvCacheMetrics, 1000, 1001, 1002, 0.6f};
+    val.attributedGpuTimeMs = 12.5f;
 
     testSerializeDeserialize(val);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2023-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -59,7 +59,8 @@ struct Buffers
 
 /// Execute a given example GEMM computation
 template <typename ElementT, typename LayoutB, typename ElementD2x>
-Result run(std::string description, Options& options, Buffers<ElementT, LayoutB, ElementD2x> buffers)
+Result run(std::string description, Options& options, Buffers<ElementT, LayoutB, ElementD2x> buffers,
+    GatedActivation activation = GatedActivation::kSwiglu)
 {
 
     // Display test description
@@ -74,7 +75,7 @@ Result run(std::string description, Options& options, Buffers<ElementT, LayoutB,
 
     // Instantiate CUTLASS kernel depending on templates
     std::shared_ptr<CutlassFusedGatedGemmRunnerInterface> runner
-        = std::make_shared<CutlassFusedGatedGemmRunner<typename CutlassToTllmTypeAdapter<ElementT>::type>>();
+        = std::make_shared<CutlassFusedGatedGemmRunner<typename CutlassToTllmTypeAdapter<ElementT>::type>>(activation);
 
     // Using the arguments, query for extra workspace required for matrix multiplication computation
     size_t workspace_size
@@ -175,10 +176,10 @@ Result run(std::string description, Options& options, Buffers<ElementT, LayoutB,
     return result;
 }
 
-template <typename ElementT_>
-using Activation = cutlass::epilogue::thread::SiLu<ElementT_>;
-
-TEST(GemmSwigluRunner, Sm90FP8)
+/// Shared body for the gated activation variants. ActivationFn must match the device-side
+/// activation selected by the GatedActivation kind.
+template <template <class> class ActivationFn>
+void runSm90Fp8Test(GatedActivation activation, std::string const& description)
 {
     using ElementT = cutlass::float_e4m3_t;
     using ElementAccumulatorT = float;
@@ -317,7 +318,7 @@ TEST(GemmSwigluRunner, Sm90FP8)
         {
             auto s = options.scale_output
                 * ElementComputeT(options.scale_d0 * buffers.tensor_ref_d_2x.host_view().ref().at({i, j}))
-                * Activation<ElementComputeT>{}(options.scale_d1 * buffers.tensor_ref_d_2x.at({i, j + half_n}));
+                * ActivationFn<ElementComputeT>{}(options.scale_d1 * buffers.tensor_ref_d_2x.at({i, j + half_n}));
             auto t = converter(s);
             buffers.tensor_ref_d.host_view().ref().at({i, j}) = t;
         }
@@ -335,7 +336,7 @@ TEST(GemmSwigluRunner, Sm90FP8)
     //
 
 #ifdef COMPILE_HOPPER_TMA_GEMMS
-    Result hopperFp8 = run("SM90 FP8 WS GEMM", options, buffers);
+    Result hopperFp8 = run(description, options, buffers, activation);
     EXPECT_TRUE(hopperFp8.passed);
 #else  // COMPILE_HOPPER_TMA_GEMMS
     std::cout << "[TensorRT LLM Error][GemmSwigluRunnerTest] Please recompile with support for hopper by passing "
@@ -344,6 +345,16 @@ TEST(GemmSwigluRunner, Sm90FP8)
 #endif // COMPILE_HOPPER_TMA_GEMMS
 }
 
+TEST(GemmSwigluRunner, Sm90FP8)
+{
+    runSm90Fp8Test<cutlass::epilogue::thread::SiLu>(GatedActivation::kSwiglu, "SM90 FP8 WS GEMM");
+}
+
+TEST(GemmSwigluRunner, Sm90FP8Geglu)
+{
+    runSm90Fp8Test<cutlass::epilogue::thread::GELU>(GatedActivation::kGeglu, "SM90 FP8 WS GEMM (GeGLU)");
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/kernels/lookupKernels.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
+#include "tensorrt_llm/runtime/iTensor.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace tk = tensorrt_llm::kernels;
+
+using namespace tensorrt_llm::runtime;
+
+namespace
+{
+
+template <typename T>
+class FusedGatherLookUpTest : public testing::Test
+{
+public:
+    using TensorPtr = ITensor::SharedPtr;
+
+    void SetUp() override
+    {
+        mStream = std::make_shared<CudaStream>();
+        mBufferManager = std::make_shared<BufferManager>(mStream);
+    }
+
+    void runTest(int tokenNum, int vocabShardSize, int vocabShardOffset, int promptRows, int mmRows, int nEmbed)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> valueDist(-1.f, 1.f);
+
+        auto constexpr dtype = TRTDataType<T>::value;
+        std::vector<T> vocabWeight(static_cast<size_t>(vocabShardSize) * nEmbed);
+        std::vector<T> promptTable(static_cast<size_t>(promptRows) * nEmbed);
+        std::vector<T> mmFeatures(static_cast<size_t>(mmRows) * nEmbed);
+        for (auto* table : {&vocabWeight, &promptTable, &mmFeatures})
+        {
+            for (auto& value : *table)
+            {
+                value = static_cast<T>(valueDist(generator));
+            }
+        }
+
+        // Mix the three sources across the batch and include out-of-shard vocab rows, which must
+        // write zeros just like the plain partitioned lookup.
+        std::vector<int32_t> sources(tokenNum);
+        std::vector<int32_t> rows(tokenNum);
+        std::uniform_int_distribution<int32_t> sourceDist(0, 2);
+        std::uniform_int_distribution<int32_t> vocabDist(0, 2 * vocabShardSize);
+        std::uniform_int_distribution<int32_t> promptDist(0, promptRows - 1);
+        std::uniform_int_distribution<int32_t> mmDist(0, mmRows - 1);
+        for (int i = 0; i < tokenNum; ++i)
+        {
+            sources[i] = sourceDist(generator);
+            switch (static_cast<tk::EmbeddingGatherSource>(sources[i]))
+            {
+            case tk::EmbeddingGatherSource::kVOCAB: rows[i] = vocabDist(generator); break;
+            case tk::EmbeddingGatherSource::kPROMPT: rows[i] = promptDist(generator); break;
+            case tk::EmbeddingGatherSource::kMULTIMODAL: rows[i] = mmDist(generator); break;
+            }
+        }
+
+        auto vocabWeightDevice = mBufferManager->copyFrom(vocabWeight, MemoryType::kGPU);
+        auto promptTableDevice = mBufferManager->copyFrom(promptTable, MemoryType::kGPU);
+        auto mmFeaturesDevice = mBufferManager->copyFrom(mmFeatures, MemoryType::kGPU);
+        auto sourcesDevice = mBufferManager->copyFrom(sources, MemoryType::kGPU);
+        auto rowsDevice = mBufferManager->copyFrom(rows, MemoryType::kGPU);
+        auto outputDevice
+            = mBufferManager->gpu(ITensor::makeShape({static_cast<SizeType32>(tokenNum), nEmbed}), dtype);
+
+        tk::invokeFusedGatherLookUp<T, T, int32_t>(bufferCast<T>(*outputDevice), bufferCast<int32_t>(*sourcesDevice),
+            bufferCast<int32_t>(*rowsDevice), bufferCast<T>(*vocabWeightDevice), bufferCast<T>(*promptTableDevice),
+            bufferCast<T>(*mmFeaturesDevice), tokenNum, vocabShardOffset, vocabShardSize, nEmbed,
+            /*perTokenScales=*/nullptr, mStream->get());
+
+        auto outputHost = mBufferManager->copyFrom(*outputDevice, MemoryType::kCPU);
+        mStream->synchronize();
+
+        auto const* output = bufferCast<T>(*outputHost);
+        for (int i = 0; i < tokenNum; ++i)
+        {
+            for (int j = 0; j < nEmbed; ++j)
+            {
+                float expected = 0.f;
+                switch (static_cast<tk::EmbeddingGatherSource>(sources[i]))
+                {
+                case tk::EmbeddingGatherSource::kVOCAB:
+                {
+                    auto const wordIndex = rows[i] - vocabShardOffset;
+                    if (wordIndex >= 0 && wordIndex < vocabShardSize)
+                    {
+                        expected = static_cast<float>(vocabWeight[static_cast<size_t>(wordIndex) * nEmbed + j]);
+                    }
+                    break;
+                }
+                case tk::EmbeddingGatherSource::kPROMPT:
+                    expected = static_cast<float>(promptTable[static_cast<size_t>(rows[i]) * nEmbed + j]);
+                    break;
+                case tk::EmbeddingGatherSource::kMULTIMODAL:
+                    expected = static_cast<float>(mmFeatures[static_cast<size_t>(rows[i]) * nEmbed + j]);
+                    break;
+                }
+                EXPECT_EQ(static_cast<float>(output[static_cast<size_t>(i) * nEmbed + j]), expected)
+                    << "token " << i << " col " << j << " source " << sources[i];
+            }
+        }
+    }
+
+protected:
+    std::shared_ptr<CudaStream> mStream;
+    std::shared_ptr<BufferManager> mBufferManager;
+};
+
+using FloatAndHalfTypes = testing::Types<float, half>;
+TYPED_TEST_SUITE(FusedGatherLookUpTest, FloatAndHalfTypes);
+
+TYPED_TEST(FusedGatherLookUpTest, MixedSources)
+{
+    this->runTest(/*tokenNum=*/96, /*vocabShardSize=*/128, /*vocabShardOffset=*/0, /*promptRows=*/16, /*mmRows=*/24,
+        /*nEmbed=*/64);
+}
+
+TYPED_TEST(FusedGatherLookUpTest, PartitionedVocabShard)
+{
+    this->runTest(/*tokenNum=*/64, /*vocabShardSize=*/64, /*vocabShardOffset=*/64, /*promptRows=*/8, /*mmRows=*/8,
+        /*nEmbed=*/96);
+}
+
+} // namespace
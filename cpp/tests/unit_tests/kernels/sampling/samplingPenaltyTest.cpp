@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -38,6 +38,7 @@ struct TemperatureTestParam
     TensorPtr temperatures;
     int32_t temperaturesSize;
     int32_t maxTokensPerStep{1};
+    bool useFastPath{false};
 
     TemperatureTestParam& setBatchSize(int32_t bs)
     {
@@ -69,6 +70,12 @@ struct TemperatureTestParam
         return *this;
     }
 
+    TemperatureTestParam& setUseFastPath(bool fastPath)
+    {
+        useFastPath = fastPath;
+        return *this;
+    }
+
     std::string toString() const
     {
         return tc::fmtstr("TemperatureTestParam[batch=%d, vocab=%d, temperatures=%s]", batchSize, vocabSize,
@@ -262,7 +269,14 @@ public:
             nullptr, nullptr, nullptr, mBatchSize, 1, 1, mVocabSize, mVocabSizePadded, nullptr, nullptr, nullptr,
             nullptr, nullptr, nullptr, bufferCast<int32_t>(*mBatchSlots), mMaxTokensPerStep,
             bufferCast<int32_t>(*mTokensPerStep), nullptr, mStream->get()};
-        tk::invokeBatchApplyPenalty(penaltyParams);
+        if (param.useFastPath)
+        {
+            tk::invokeBatchApplyTemperatureBias(penaltyParams);
+        }
+        else
+        {
+            tk::invokeBatchApplyPenalty(penaltyParams);
+        }
         auto logitsOutHost = mBufferManager->copyFrom(*mOutLogitsDevice, MemoryType::kCPU);
 
         mStream->synchronize();
@@ -374,6 +388,58 @@ TYPED_TEST(TemperaturePenaltyTest, LargeVocabTokensPerStep)
                       .setMaxTokensPerStep(4));
 }
 
+TYPED_TEST(TemperaturePenaltyTest, FastPathMixed)
+{
+    int32_t batchSize = 6;
+    int32_t maxBatchSize = 2 * batchSize;
+    TensorPtr temperaturesHost = BufferManager::pinned(ITensor::makeShape({maxBatchSize}), nvinfer1::DataType::kFLOAT);
+    for (int32_t i = 0; i < maxBatchSize; ++i)
+    {
+        bufferCast<float>(*temperaturesHost)[i] = 0.53f + 0.2f * i;
+    }
+    this->runTest(TemperatureTestParam()
+                      .setBatchSize(batchSize)
+                      .setVocabSize(4)
+                      .setTemperaturesSize(maxBatchSize)
+                      .setTemperatures(temperaturesHost)
+                      .setUseFastPath(true));
+}
+
+TYPED_TEST(TemperaturePenaltyTest, FastPathLargeVocab)
+{
+    int32_t batchSize = 6;
+    int32_t maxBatchSize = 2 * batchSize;
+    TensorPtr temperaturesHost = BufferManager::pinned(ITensor::makeShape({maxBatchSize}), nvinfer1::DataType::kFLOAT);
+    for (int32_t i = 0; i < maxBatchSize; ++i)
+    {
+        bufferCast<float>(*temperaturesHost)[i] = 0.53f + 0.2f * i;
+    }
+    this->runTest(TemperatureTestParam()
+                      .setBatchSize(batchSize)
+                      .setVocabSize(50001)
+                      .setTemperaturesSize(maxBatchSize)
+                      .setTemperatures(temperaturesHost)
+                      .setUseFastPath(true));
+}
+
+TYPED_TEST(TemperaturePenaltyTest, FastPathLargeVocabTokensPerStep)
+{
+    int32_t batchSize = 6;
+    int32_t maxBatchSize = 2 * batchSize;
+    TensorPtr temperaturesHost = BufferManager::pinned(ITensor::makeShape({maxBatchSize}), nvinfer1::DataType::kFLOAT);
+    for (int32_t i = 0; i < maxBatchSize; ++i)
+    {
+        bufferCast<float>(*temperaturesHost)[i] = 0.53f + 0.2f * i;
+    }
+    this->runTest(TemperatureTestParam()
+                      .setBatchSize(batchSize)
+                      .setVocabSize(8)
+                      .setTemperaturesSize(maxBatchSize)
+                      .setTemperatures(temperaturesHost)
+                      .setMaxTokensPerStep(4)
+                      .setUseFastPath(true));
+}
+
 struct RepetitionPenaltyTestCase
 {
     int32_t batchSize;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -428,6 +428,74 @@ public:
         verifyExplicitEOSCriteriaResults(seed, batchSize);
     }
 
+    tk::FusedStopCriteriaParams makeFusedStopCriteriaParams(SizeType32 batchSize)
+    {
+        tk::FusedStopCriteriaParams params;
+        params.outputIds = reinterpret_cast<TokenIdType const**>(bufferCast<int64_t>(*mOutputIdsPtr));
+        params.finished
+            = reinterpret_cast<tk::FinishedState*>(bufferCast<tk::FinishedState::UnderlyingType>(*mFinished));
+        params.sequenceLengths = bufferCast<SizeType32>(*mSequenceLengths);
+        params.batchSlots = bufferCast<SizeType32>(*mBatchSlots);
+        params.batchSize = batchSize;
+        params.maxTokensPerStep = mMaxTokensPerStep;
+        params.maxSeqLen = mMaxSeqLen;
+        return params;
+    }
+
+    void runFusedMaxLengthCriteriaTest(SizeType32 seed, SizeType32 batchSize)
+    {
+        initData(seed, {}, 0, batchSize, /* beamWidth */ 1);
+
+        auto params = makeFusedStopCriteriaParams(batchSize);
+        params.sequenceLimitLength = bufferCast<SizeType32>(*mSequenceLengthLimits);
+        params.finishedSum = bufferCast<SizeType32>(*mFinishedSum);
+        tk::invokeFusedStopCriteria(params, mStream->get());
+
+        verifyMaxSeqLenStopCriteriaResults(seed, batchSize, /* beamWidth */ 1);
+    }
+
+    void runFusedStopWordsCriteriaTest(std::vector<std::vector<std::vector<SizeType32>>> const& stopWords,
+        SizeType32 batchSize, std::vector<SizeType32> tokensPerStep = {})
+    {
+        SizeType32 maxStopWordsLen = 0;
+        for (auto const& batchStopWords : stopWords)
+        {
+            SizeType32 stopWordsLen = 0;
+            for (auto const& words : batchStopWords)
+            {
+                stopWordsLen += words.size();
+            }
+            if (stopWordsLen == batchStopWords.size())
+            {
+                stopWordsLen += 1;
+            }
+            maxStopWordsLen = std::max(maxStopWordsLen, stopWordsLen);
+        }
+
+        initData(0, stopWords, maxStopWordsLen, batchSize, /* beamWidth */ 1, tokensPerStep);
+
+        auto params = makeFusedStopCriteriaParams(batchSize);
+        params.stopWords = bufferCast<TokenIdType const*>(*mStopWordsPtr);
+        params.stopWordsLens = bufferCast<SizeType32>(*mStopWordsLen);
+        params.numNewTokens = tokensPerStep.size() ? bufferCast<SizeType32>(*mTokensPerStep) : nullptr;
+        tk::invokeFusedStopCriteria(params, mStream->get());
+
+        verifyStopWordsStopCriteriaResults(
+            0, stopWords, maxStopWordsLen, batchSize, /* beamWidth */ 1, tokensPerStep.size());
+    }
+
+    void runFusedExplicitEOSCriteriaTest(SizeType32 seed, SizeType32 batchSize)
+    {
+        initData(seed, {}, 0, batchSize, /* beamWidth */ 1);
+
+        auto params = makeFusedStopCriteriaParams(batchSize);
+        params.endIds = bufferCast<TokenIdType>(*mEndIds);
+        params.numNewTokens = bufferCast<SizeType32>(*mTokensPerStep);
+        tk::invokeFusedStopCriteria(params, mStream->get());
+
+        verifyExplicitEOSCriteriaResults(seed, batchSize);
+    }
+
 protected:
     std::shared_ptr<tensorrt_llm::runtime::BufferManager> mBufferManager;
     std::shared_ptr<tensorrt_llm::runtime::CudaStream> mStream;
@@ -620,4 +688,49 @@ TEST_F(StopCriteriaKernelsTest, explicitEOSCriteria)
     }
 }
 
+TEST_F(StopCriteriaKernelsTest, fusedMaxLengthCriteriaBS1Test)
+{
+    SizeType32 constexpr seeds = 64;
+    SizeType32 constexpr batchSize = 1;
+    for (SizeType32 seed = 0; seed < seeds; ++seed)
+    {
+        this->runFusedMaxLengthCriteriaTest(seed, batchSize);
+    }
+}
+
+TEST_F(StopCriteriaKernelsTest, fusedMaxLengthCriteriaBS1024Test)
+{
+    SizeType32 constexpr seeds = 64;
+    SizeType32 constexpr batchSize = 1024;
+    for (SizeType32 seed = 0; seed < seeds; ++seed)
+    {
+        this->runFusedMaxLengthCriteriaTest(seed, batchSize);
+    }
+}
+
+TEST_F(StopCriteriaKernelsTest, fusedStopWordsCriteriaBS4MultipleTokensMultipleWordsTest)
+{
+    SizeType32 constexpr batchSize = 4;
+    // Expected to match {12, 13} for the 5th instance in the batch
+    this->runFusedStopWordsCriteriaTest({{{2}}, {{}}, {{}}, {{}}, {{15}, {12, 13}}, {{}}, {{1}, {8, 9}}, {{}}}, batchSize);
+}
+
+TEST_F(StopCriteriaKernelsTest, fusedStopWordsCriteriaBS4MultipleTokensMultipleWordsTestMultipleTokensPerStep)
+{
+    SizeType32 constexpr batchSize = 4;
+    // Expected to match {8, 9} and {12, 13}
+    this->runFusedStopWordsCriteriaTest(
+        {{{2}}, {{}}, {{}}, {{}}, {{15}, {12, 13}}, {{}}, {{1}, {8, 9}}, {{}}}, batchSize, {2, 5, 3, 4});
+}
+
+TEST_F(StopCriteriaKernelsTest, fusedExplicitEOSCriteria)
+{
+    SizeType32 constexpr seeds = 64;
+    SizeType32 constexpr batchSize = 1024;
+    for (SizeType32 seed = 0; seed < seeds; ++seed)
+    {
+        this->runFusedExplicitEOSCriteriaTest(seed, batchSize);
+    }
+}
+
 } // end of namespace
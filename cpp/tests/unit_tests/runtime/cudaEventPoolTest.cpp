@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuda_runtime_api.h>
+#include <gtest/gtest.h>
+
+#include "tensorrt_llm/runtime/cudaEventPool.h"
+#include "tensorrt_llm/runtime/cudaStream.h"
+
+#include <thread>
+#include <vector>
+
+using namespace tensorrt_llm::runtime;
+
+TEST(CudaEventPool, AcquiredEventIsUsable)
+{
+    auto& pool = CudaEventPool::instance();
+    auto event = pool.acquire();
+    ASSERT_NE(event.get(), nullptr);
+
+    CudaStream stream{};
+    stream.record(event);
+    event.synchronize();
+}
+
+TEST(CudaEventPool, RecycledEventIsReused)
+{
+    auto& pool = CudaEventPool::instance();
+    cudaEvent_t recycled{};
+    {
+        auto event = pool.acquire();
+        recycled = event.get();
+    }
+    // The recycled handle must come back within one pass over the free list.
+    bool reused = false;
+    std::vector<CudaEvent> held;
+    held.reserve(CudaEventPool::kCapacity);
+    for (std::size_t i = 0; i < CudaEventPool::kCapacity && !reused; ++i)
+    {
+        held.push_back(pool.acquire());
+        reused = held.back().get() == recycled;
+    }
+    EXPECT_TRUE(reused);
+}
+
+TEST(CudaEventPool, DistinctFlagsUseDistinctPools)
+{
+    auto& defaultPool = CudaEventPool::instance();
+    auto& blockingPool = CudaEventPool::instance(cudaEventBlockingSync | cudaEventDisableTiming);
+    EXPECT_NE(&defaultPool, &blockingPool);
+    EXPECT_EQ(&defaultPool, &CudaEventPool::instance());
+    EXPECT_EQ(&blockingPool, &CudaEventPool::instance(cudaEventBlockingSync | cudaEventDisableTiming));
+}
+
+TEST(CudaEventPool, ConcurrentAcquireRelease)
+{
+    auto constexpr numThreads = 8;
+    auto constexpr numIterations = 1000;
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back(
+            []()
+            {
+                auto& pool = CudaEventPool::instance();
+                for (int i = 0; i < numIterations; ++i)
+                {
+                    auto eventA = pool.acquire();
+                    auto eventB = pool.acquire();
+                    EXPECT_NE(eventA.get(), nullptr);
+                    EXPECT_NE(eventB.get(), nullptr);
+                    EXPECT_NE(eventA.get(), eventB.get());
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
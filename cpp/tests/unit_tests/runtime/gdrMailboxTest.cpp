@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <cuda_runtime.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/runtime/gdrMailbox.h"
+
+// Skip all tests on Windows
+#ifndef _WIN32
+
+namespace tensorrt_llm::runtime
+{
+
+namespace
+{
+
+class GdrMailboxTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!GdrMailbox::supported())
+        {
+            GTEST_SKIP() << "GDRCopy library not found or failed to initialize. Skipping all tests.";
+        }
+    }
+
+    const size_t TEST_SIZE = 256;
+};
+
+TEST_F(GdrMailboxTest, HostWriteVisibleOnDevice)
+{
+    GdrMailbox mailbox(TEST_SIZE);
+    ASSERT_NE(mailbox.getDevicePtr(), nullptr);
+    EXPECT_EQ(mailbox.getSizeBytes(), TEST_SIZE);
+
+    std::vector<char> h_src(TEST_SIZE);
+    for (size_t i = 0; i < TEST_SIZE; ++i)
+    {
+        h_src[i] = static_cast<char>(i % 256);
+    }
+    mailbox.hostWrite(0, h_src.data(), TEST_SIZE);
+
+    // Verify through the ordinary device pointer.
+    std::vector<char> h_dst(TEST_SIZE, 0);
+    TLLM_CUDA_CHECK(cudaMemcpy(h_dst.data(), mailbox.getDevicePtr(), TEST_SIZE, cudaMemcpyDeviceToHost));
+    EXPECT_EQ(memcmp(h_src.data(), h_dst.data(), TEST_SIZE), 0);
+}
+
+TEST_F(GdrMailboxTest, DeviceWriteVisibleOnHost)
+{
+    GdrMailbox mailbox(TEST_SIZE);
+
+    std::vector<char> h_src(TEST_SIZE);
+    for (size_t i = 0; i < TEST_SIZE; ++i)
+    {
+        h_src[i] = static_cast<char>((i + 1) % 256);
+    }
+    TLLM_CUDA_CHECK(cudaMemcpy(mailbox.getDevicePtr(), h_src.data(), TEST_SIZE, cudaMemcpyHostToDevice));
+    TLLM_CUDA_CHECK(cudaDeviceSynchronize());
+
+    std::vector<char> h_dst(TEST_SIZE, 0);
+    mailbox.hostRead(0, h_dst.data(), TEST_SIZE);
+    EXPECT_EQ(memcmp(h_src.data(), h_dst.data(), TEST_SIZE), 0);
+}
+
+TEST_F(GdrMailboxTest, TypedAccessors)
+{
+    GdrMailbox mailbox(TEST_SIZE);
+
+    mailbox.writeValue<uint32_t>(0, 0xdeadbeef);
+    mailbox.writeValue<uint32_t>(3, 42);
+
+    uint32_t h_words[4] = {};
+    TLLM_CUDA_CHECK(cudaMemcpy(h_words, mailbox.getDevicePtr(), sizeof(h_words), cudaMemcpyDeviceToHost));
+    EXPECT_EQ(h_words[0], 0xdeadbeefu);
+    EXPECT_EQ(h_words[3], 42u);
+
+    EXPECT_EQ(mailbox.readValue<uint32_t>(0), 0xdeadbeefu);
+    EXPECT_EQ(mailbox.readValue<uint32_t>(3), 42u);
+}
+
+TEST_F(GdrMailboxTest, OutOfBoundsAccessThrows)
+{
+    GdrMailbox mailbox(TEST_SIZE);
+
+    uint64_t value = 0;
+    EXPECT_THROW(mailbox.hostWrite(TEST_SIZE - sizeof(value) + 1, &value, sizeof(value)), std::exception);
+    EXPECT_THROW(mailbox.hostRead(TEST_SIZE, &value, sizeof(value)), std::exception);
+}
+
+} // namespace
+} // namespace tensorrt_llm::runtime
+
+#endif // _WIN32
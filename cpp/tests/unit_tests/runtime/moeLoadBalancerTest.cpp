@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -291,6 +291,45 @@ INSTANTIATE_TEST_SUITE_P(PlacementTests, MoePlacementTest,
         return name;
     });
 
+// Verify the slot-affinity pass: experts that stay on a rank between iterations should keep their
+// local slots, so the weight updater only streams the experts that are genuinely new to the rank.
+TEST(MoePlacementSlotAffinityTest, KeepsResidentExpertsInTheirSlots)
+{
+    int constexpr expertCount = 4;
+    int constexpr slotCountPerRank = 2;
+    int constexpr epSize = 2;
+    tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo{expertCount, 2, 0, epSize, slotCountPerRank};
+
+    MoePlacementCpuInfo cpuPlacement;
+    cpuPlacement.expertReplicaCount = {1, 1, 1, 1};
+    cpuPlacement.rankExpertIds.resize(epSize);
+    for (int i = 0; i < epSize; i++)
+    {
+        cpuPlacement.rankExpertIds[i].resize(slotCountPerRank, -1);
+    }
+    // Equal loads keep the expert-to-rank assignment stable across calls; only the local slot
+    // order could differ from the old placement.
+    std::vector<float> expertLoadFactors(expertCount, 1.0f);
+
+    doPlacement(metaInfo, expertLoadFactors.data(), &cpuPlacement);
+
+    // Use a per-rank reversed copy of the result as the old placement; the affinity pass should
+    // restore exactly that slot order since each rank keeps the same expert set.
+    cpuPlacement.oldRankExpertIds = cpuPlacement.rankExpertIds;
+    for (int i = 0; i < epSize; i++)
+    {
+        std::reverse(cpuPlacement.oldRankExpertIds[i].begin(), cpuPlacement.oldRankExpertIds[i].end());
+    }
+
+    doPlacement(metaInfo, expertLoadFactors.data(), &cpuPlacement);
+
+    for (int i = 0; i < epSize; i++)
+    {
+        EXPECT_EQ(cpuPlacement.rankExpertIds[i], cpuPlacement.oldRankExpertIds[i])
+            << "Rank " << i << " should keep resident experts in their old slots";
+    }
+}
+
 // Iteration control parameter structure
 struct IterConfig
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <vector>
@@ -328,3 +329,89 @@ TEST_F(RuntimeKernelTest, CopyBatchStride5)
 {
     testCopyBatch(5, *mManager, *mStream);
 }
+
+TEST_F(RuntimeKernelTest, FillRegionsBatch)
+{
+    auto bufferInt32 = mManager->gpu(tr::ITensor::makeShape({17}), nvinfer1::DataType::kINT32);
+    auto bufferFloat = mManager->gpu(tr::ITensor::makeShape({64}), nvinfer1::DataType::kFLOAT);
+    auto bufferInt8 = mManager->gpu(tr::ITensor::makeShape({9}), nvinfer1::DataType::kINT8);
+    tr::kernels::invokeFill(*bufferInt8, std::int8_t{7}, *mStream);
+
+    float constexpr floatValue{3.5F};
+    std::uint32_t floatPattern{};
+    std::memcpy(&floatPattern, &floatValue, sizeof(floatValue));
+
+    std::vector<tr::kernels::FillRegionDesc> fillDescs;
+    fillDescs.push_back({bufferInt32->data(), bufferInt32->getSizeInBytes(), 0xFFFFFFFFU});
+    fillDescs.push_back({bufferFloat->data(), bufferFloat->getSizeInBytes(), floatPattern});
+    // Zero all but the first element to exercise the unaligned byte path.
+    fillDescs.push_back({bufferInt8->data(1), bufferInt8->getSizeInBytes() - 1, 0U});
+
+    auto descTable = mManager->gpu(fillDescs.size() * sizeof(tr::kernels::FillRegionDesc));
+    mManager->copy(fillDescs.data(), *descTable);
+    tr::kernels::invokeFillRegionsBatch(reinterpret_cast<tr::kernels::FillRegionDesc const*>(descTable->data()),
+        static_cast<tr::SizeType32>(fillDescs.size()), *mStream);
+
+    auto hostInt32 = mManager->copyFrom(*bufferInt32, tr::MemoryType::kCPU);
+    auto hostFloat = mManager->copyFrom(*bufferFloat, tr::MemoryType::kCPU);
+    auto hostInt8 = mManager->copyFrom(*bufferInt8, tr::MemoryType::kCPU);
+    mStream->synchronize();
+
+    auto const* int32Ptr = tr::bufferCast<std::int32_t>(*hostInt32);
+    for (std::size_t i = 0; i < hostInt32->getSize(); ++i)
+    {
+        EXPECT_EQ(int32Ptr[i], -1) << "Error at index " << i;
+    }
+    auto const* floatPtr = tr::bufferCast<float>(*hostFloat);
+    for (std::size_t i = 0; i < hostFloat->getSize(); ++i)
+    {
+        EXPECT_EQ(floatPtr[i], floatValue) << "Error at index " << i;
+    }
+    auto const* int8Ptr = tr::bufferCast<std::int8_t>(*hostInt8);
+    EXPECT_EQ(int8Ptr[0], 7);
+    for (std::size_t i = 1; i < hostInt8->getSize(); ++i)
+    {
+        EXPECT_EQ(int8Ptr[i], 0) << "Error at index " << i;
+    }
+}
+
+TEST_F(RuntimeKernelTest, CopyRegionsBatch)
+{
+    std::size_t constexpr sizeInt32{33};
+    std::size_t constexpr sizeInt8{13};
+    std::vector<std::int32_t> srcInt32(sizeInt32);
+    std::iota(srcInt32.begin(), srcInt32.end(), 1);
+    std::vector<std::int8_t> srcInt8(sizeInt8);
+    std::iota(srcInt8.begin(), srcInt8.end(), std::int8_t{-5});
+
+    auto srcInt32Device = mManager->copyFrom(srcInt32, tr::MemoryType::kGPU);
+    auto srcInt8Device = mManager->copyFrom(srcInt8, tr::MemoryType::kGPU);
+    auto dstInt32Device = mManager->gpu(sizeInt32, nvinfer1::DataType::kINT32);
+    // The second region lands in pinned host memory, like the decoder readbacks.
+    auto dstInt8Pinned = tr::BufferManager::pinned(sizeInt8, nvinfer1::DataType::kINT8);
+    mManager->setZero(*dstInt32Device);
+    mManager->setZero(*dstInt8Pinned);
+
+    std::vector<tr::kernels::CopyRegionDesc> copyDescs;
+    copyDescs.push_back({srcInt32Device->data(), dstInt32Device->data(), srcInt32Device->getSizeInBytes()});
+    copyDescs.push_back({srcInt8Device->data(), dstInt8Pinned->data(), srcInt8Device->getSizeInBytes()});
+
+    auto descTable = mManager->gpu(copyDescs.size() * sizeof(tr::kernels::CopyRegionDesc));
+    mManager->copy(copyDescs.data(), *descTable);
+    tr::kernels::invokeCopyRegionsBatch(reinterpret_cast<tr::kernels::CopyRegionDesc const*>(descTable->data()),
+        static_cast<tr::SizeType32>(copyDescs.size()), *mStream);
+
+    auto hostInt32 = mManager->copyFrom(*dstInt32Device, tr::MemoryType::kCPU);
+    mStream->synchronize();
+
+    auto const* int32Ptr = tr::bufferCast<std::int32_t>(*hostInt32);
+    for (std::size_t i = 0; i < sizeInt32; ++i)
+    {
+        EXPECT_EQ(int32Ptr[i], srcInt32[i]) << "Error at index " << i;
+    }
+    auto const* int8Ptr = tr::bufferCast<std::int8_t>(*dstInt8Pinned);
+    for (std::size_t i = 0; i < sizeInt8; ++i)
+    {
+        EXPECT_EQ(int8Ptr[i], srcInt8[i]) << "Error at index " << i;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2022-2026, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -95,6 +95,41 @@ TEST_F(TllmBuffersTest, CudaAllocator)
     EXPECT_THROW(allocator.deallocate(ptr, size), std::runtime_error);
 }
 
+TEST_F(TllmBuffersTest, CudaPagedWorkspace)
+{
+    if (mDeviceCount == 0)
+    {
+        GTEST_SKIP() << noDeviceSkipReason;
+    }
+
+    auto constexpr reservedSize = std::size_t(1) << 26; // 64 MiB
+    auto& counters = MemoryCounters::getInstance();
+    auto const initialGpu = counters.getGpu();
+    {
+        CudaPagedWorkspace workspace{reservedSize, mStream->getDevice()};
+        EXPECT_NE(workspace.data(), nullptr);
+        EXPECT_EQ(workspace.getCapacity(), 0);
+
+        workspace.ensureCapacity(std::size_t(1) << 20);
+        auto const firstCapacity = workspace.getCapacity();
+        EXPECT_GE(firstCapacity, std::size_t(1) << 20);
+        EXPECT_EQ(counters.getGpu(), initialGpu + firstCapacity);
+        TLLM_CUDA_CHECK(cudaMemset(workspace.data(), 0xA5, firstCapacity));
+
+        // Growing to a size that is already committed is a no-op.
+        workspace.ensureCapacity(1);
+        EXPECT_EQ(workspace.getCapacity(), firstCapacity);
+
+        workspace.ensureCapacity(std::size_t(1) << 24);
+        EXPECT_GE(workspace.getCapacity(), std::size_t(1) << 24);
+        TLLM_CUDA_CHECK(cudaMemset(workspace.data(), 0x5A, workspace.getCapacity()));
+        TLLM_CUDA_CHECK(cudaDeviceSynchronize());
+
+        EXPECT_THROW(workspace.ensureCapacity(2 * reservedSize), std::runtime_error);
+    }
+    EXPECT_EQ(counters.getGpu(), initialGpu);
+}
+
 TEST_F(TllmBuffersTest, PinnedAllocator)
 {
     auto constexpr size = 1024;
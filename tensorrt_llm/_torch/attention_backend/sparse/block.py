@@ -0,0 +1,387 @@
+import math
+from typing import List, Optional, Tuple, Union
+
+import torch
+
+import tensorrt_llm
+import tensorrt_llm.bindings
+from tensorrt_llm._torch.attention_backend.trtllm import (
+    TrtllmAttention, TrtllmAttentionMetadata)
+from tensorrt_llm._torch.pyexecutor.llm_request import LlmRequestState
+from tensorrt_llm._torch.pyexecutor.resource_manager import KVCacheManager
+from tensorrt_llm.bindings import DataType
+from tensorrt_llm.bindings.executor import KvCacheConfig
+from tensorrt_llm.bindings.internal.batch_manager import \
+    CacheType as CacheTypeCpp
+from tensorrt_llm.mapping import Mapping
+from tensorrt_llm.models.modeling_utils import QuantConfig
+
+ModelConfig = tensorrt_llm.bindings.ModelConfig
+
+
+class BlockSparseTrtllmAttentionMetadata(TrtllmAttentionMetadata):
+
+    def __post_init__(self):
+        super().__post_init__()
+        if self.sparse_attention_config is None:
+            raise ValueError("Sparse attention config is not set")
+        self.block_size = self.sparse_attention_config.block_size
+        self.window_size = self.sparse_attention_config.window_size
+        self.prompt_budget = self.sparse_attention_config.prompt_budget
+        self.sink_blocks = self.sparse_attention_config.sink_blocks
+        self.recency_blocks = self.sparse_attention_config.recency_blocks
+
+        capture_graph = self.is_cuda_graph
+
+        # Sparse kv indices offsets for each sequence in context phase
+        self.sparse_offsets_ctx_cuda = self.get_empty(
+            self.cuda_graph_buffers,
+            (self.max_num_sequences + 1, ),
+            dtype=torch.int32,
+            cache_name="sparse_offsets_ctx_cuda",
+            capture_graph=capture_graph,
+        )
+        self.sparse_offsets_ctx = torch.zeros_like(self.sparse_offsets_ctx_cuda,
+                                                   device='cpu',
+                                                   dtype=torch.int32)
+
+        # Sparse attn indices offsets for each sequence in generation phase
+        self.sparse_offsets_gen_cuda = self.get_empty(
+            self.cuda_graph_buffers,
+            (self.max_num_sequences + 1, ),
+            dtype=torch.int32,
+            cache_name="sparse_offsets_gen_cuda",
+            capture_graph=capture_graph,
+        )
+        self.sparse_offsets_gen = torch.zeros_like(self.sparse_offsets_gen_cuda,
+                                                   device='cpu',
+                                                   dtype=torch.int32)
+
+    def prepare(self):
+        if self.kv_cache_manager is not None:
+            num_contexts = self.num_contexts
+            num_generations = self.num_generations
+            num_requests = num_contexts + num_generations
+
+            for i in range(num_requests):
+                if i < num_contexts:
+                    self.kv_cache_params.num_cached_tokens_per_seq[i] = 0
+                else:
+                    if self.prompt_lens[i] > self.prompt_budget:
+                        self.kv_cache_params.num_cached_tokens_per_seq[
+                            i] += self.prompt_budget - self.prompt_lens[i]
+
+        super().prepare()
+
+        # Update prompt lens for sparse attention
+        if self.kv_cache_manager is not None:
+            _prompt_lens = self.prompt_lens.copy()
+            for i in range(num_requests):
+                if i >= num_contexts:
+                    _prompt_lens[i] = min(_prompt_lens[i], self.prompt_budget)
+            _prompt_lens = torch.tensor(_prompt_lens,
+                                        dtype=torch.int,
+                                        device='cpu')
+            self.prompt_lens_cpu[:self.num_seqs].copy_(_prompt_lens)
+            self.prompt_lens_cuda[:self.num_seqs].copy_(
+                self.prompt_lens_cpu[:self.num_seqs], non_blocking=True)
+            self.prompt_lens_cuda_runtime = self.prompt_lens_cuda[:self.
+                                                                  num_seqs]
+            self.prompt_lens_cpu_runtime = self.prompt_lens_cpu[:self.num_seqs]
+
+        # -------------------------------- Context phase --------------------------------
+        # Sequences shorter than the prompt budget keep their full KV cache.
+        ctx_lens = self.prompt_lens_cpu[:self.num_contexts]
+        sparse_counts_ctx = torch.minimum(
+            ctx_lens, torch.tensor(self.prompt_budget, dtype=torch.int32))
+
+        self.sparse_offsets_ctx[1:self.num_contexts + 1] = torch.cumsum(
+            sparse_counts_ctx, dim=0)
+        self.sparse_offsets_ctx_cuda[:self.num_contexts + 1].copy_(
+            self.sparse_offsets_ctx[:self.num_contexts + 1], non_blocking=True)
+
+        self.total_sparse_ctx_indices = self.sparse_offsets_ctx[
+            self.num_contexts].item()
+
+        # -------------------------------- Generation phase --------------------------------
+        # Each generation step attends to the sink blocks plus the most recent blocks.
+        num_kv_blocks = (self.kv_lens[self.num_contexts:self.num_seqs] +
+                         self.block_size - 1) // self.block_size
+        max_attended_blocks = torch.tensor(self.sink_blocks +
+                                           self.recency_blocks,
+                                           dtype=torch.int32)
+        sparse_counts_gen = torch.minimum(num_kv_blocks, max_attended_blocks)
+
+        self.num_kv_blocks = num_kv_blocks
+        self.sparse_offsets_gen[1:self.num_generations + 1] = torch.cumsum(
+            sparse_counts_gen, dim=0)
+        self.sparse_offsets_gen_cuda[:self.num_generations + 1].copy_(
+            self.sparse_offsets_gen[:self.num_generations + 1],
+            non_blocking=True)
+
+        self.total_sparse_gen_indices = self.sparse_offsets_gen[
+            self.num_generations].item()
+
+
+class BlockSparseTrtllmAttention(TrtllmAttention):
+    """
+    Native (training-free) block-sparse attention.
+        - Context phase: per-head block importance scoring over the prompt; only the
+          top-scoring KV blocks plus an observation window are written to the KV cache.
+        - Generation phase: attends to the sink blocks plus the most recent blocks of
+          the pruned cache via the paged block-sparse attention path.
+    """
+
+    Metadata = BlockSparseTrtllmAttentionMetadata
+
+    def __init__(
+            self,
+            layer_idx: int,
+            num_heads: int,
+            head_dim: int,
+            num_kv_heads: Optional[int] = None,
+            quant_config: Optional[QuantConfig] = None,
+            q_scaling: Optional[float] = None,
+            sparse_attention_config: Optional["SparseAttentionConfig"] = None,
+            **kwargs):
+        super().__init__(layer_idx,
+                         num_heads,
+                         head_dim,
+                         sparse_attention_config=sparse_attention_config,
+                         num_kv_heads=num_kv_heads,
+                         quant_config=quant_config,
+                         q_scaling=q_scaling,
+                         **kwargs)
+        self.block_size = sparse_attention_config.block_size
+        self.window_size = sparse_attention_config.window_size
+        self.prompt_budget = sparse_attention_config.prompt_budget
+        self.sink_blocks = sparse_attention_config.sink_blocks
+        self.recency_blocks = sparse_attention_config.recency_blocks
+
+    def _score_blocks(self, q_req: torch.Tensor,
+                      k_req: torch.Tensor) -> torch.Tensor:
+        """
+        Score prompt KV blocks by their attention mass from the observation window.
+
+        Returns per-head token indices of the selected blocks plus the observation
+        window, sorted in ascending order, with shape [num_kv_heads, prompt_budget].
+        """
+        seq_len = k_req.size(0)
+        window_size = self.window_size
+        block_size = self.block_size
+        device = q_req.device
+
+        num_groups = self.num_heads // self.num_kv_heads
+
+        # [num_kv_heads, window_size * num_groups, head_dim]
+        q_window = q_req[seq_len - window_size:].view(
+            window_size, self.num_kv_heads, num_groups,
+            self.head_dim).permute(1, 0, 2, 3).reshape(self.num_kv_heads, -1,
+                                                       self.head_dim)
+        # [num_kv_heads, head_dim, seq_len]
+        k_all = k_req.permute(1, 2, 0)
+
+        scores = torch.baddbmm(
+            torch.empty(1, 1, 1, device=device, dtype=q_window.dtype),
+            q_window,
+            k_all,
+            beta=0.0,
+            alpha=1.0 / math.sqrt(self.head_dim))
+
+        # Causal mask: window token w sits at position seq_len - window_size + w.
+        positions = torch.arange(
+            seq_len - window_size, seq_len,
+            device=device).repeat_interleave(num_groups)
+        key_positions = torch.arange(seq_len, device=device)
+        scores = scores.masked_fill(
+            key_positions[None, None, :] > positions[None, :, None],
+            float('-inf'))
+
+        # [num_kv_heads, seq_len]
+        scores = torch.softmax(scores, dim=-1,
+                               dtype=torch.float32).sum(dim=1)
+
+        # Aggregate token scores into block scores over the prefix (full blocks only).
+        prefix_len = seq_len - window_size
+        num_prefix_blocks = prefix_len // block_size
+        block_scores = scores[:, :num_prefix_blocks * block_size].view(
+            self.num_kv_heads, num_prefix_blocks, block_size).sum(dim=-1)
+
+        # Attention sinks are always kept.
+        block_scores[:, :self.sink_blocks] = float('inf')
+
+        num_budget_blocks = (self.prompt_budget - window_size) // block_size
+        selected_blocks = block_scores.topk(num_budget_blocks, dim=-1).indices
+
+        # Expand block indices to token indices and append the observation window.
+        token_indices = (
+            selected_blocks.unsqueeze(-1) * block_size +
+            torch.arange(block_size, device=device)).view(
+                self.num_kv_heads, -1)
+        window_indices = torch.arange(
+            prefix_len, seq_len,
+            device=device).unsqueeze(0).expand(self.num_kv_heads, -1)
+        token_indices = torch.cat([token_indices, window_indices], dim=-1)
+        return torch.sort(token_indices, dim=-1).values.int()
+
+    def sparse_kv_predict(
+        self,
+        q: torch.Tensor,
+        k: Optional[torch.Tensor],
+        metadata: BlockSparseTrtllmAttentionMetadata,
+        **kwargs,
+    ) -> Tuple[Optional[torch.Tensor], Optional[torch.Tensor]]:
+        """
+        Predict sparse KV indices for the context phase.
+
+        For prompts longer than the prompt budget, selects the most important KV
+        blocks per head; shorter prompts keep their full KV cache.
+        """
+        num_contexts = metadata.num_contexts
+        if num_contexts == 0 or metadata.num_ctx_tokens == 0:
+            return None, None
+
+        q_hidden_size = self.num_heads * self.head_dim
+        k_hidden_size = self.num_kv_heads * self.head_dim
+
+        per_request_indices: List[torch.Tensor] = []
+        token_start = 0
+        any_pruned = False
+        for i in range(num_contexts):
+            seq_len = int(metadata.prompt_lens_cpu[i])
+            token_end = token_start + seq_len
+            if seq_len <= self.prompt_budget:
+                per_request_indices.append(
+                    torch.arange(seq_len, device=q.device,
+                                 dtype=torch.int32).unsqueeze(0).expand(
+                                     self.num_kv_heads, -1))
+            else:
+                any_pruned = True
+                if k is None:
+                    qkv_req = q[token_start:token_end]
+                    q_req = qkv_req[:, :q_hidden_size].view(
+                        seq_len, self.num_heads, self.head_dim)
+                    k_req = qkv_req[:, q_hidden_size:q_hidden_size +
+                                    k_hidden_size].view(
+                                        seq_len, self.num_kv_heads,
+                                        self.head_dim)
+                else:
+                    q_req = q[token_start:token_end].view(
+                        seq_len, self.num_heads, self.head_dim)
+                    k_req = k[token_start:token_end].view(
+                        seq_len, self.num_kv_heads, self.head_dim)
+                per_request_indices.append(self._score_blocks(q_req, k_req))
+            token_start = token_end
+
+        if not any_pruned:
+            return None, None
+
+        sparse_kv_indices = torch.cat(per_request_indices,
+                                      dim=-1).contiguous()
+        sparse_kv_offsets = metadata.sparse_offsets_ctx_cuda[:num_contexts + 1]
+        return sparse_kv_indices, sparse_kv_offsets
+
+    def sparse_attn_predict(
+        self,
+        q: torch.Tensor,
+        k: Optional[torch.Tensor],
+        metadata: BlockSparseTrtllmAttentionMetadata,
+        **kwargs,
+    ) -> Tuple[Optional[torch.Tensor], Optional[torch.Tensor]]:
+        """
+        Predict sparse attn indices (at block granularity) for the generation phase.
+
+        Generation attends to the sink blocks plus the most recent blocks; the
+        important middle-of-prompt blocks survive via the context-phase pruning, so
+        the recency window covers the pruned prompt rather than the raw one.
+        """
+        num_generations = metadata.num_generations
+        if num_generations == 0:
+            return None, None
+
+        device = q.device
+        max_attended_blocks = self.sink_blocks + self.recency_blocks
+
+        per_request_blocks: List[torch.Tensor] = []
+        for i in range(num_generations):
+            num_blocks = int(metadata.num_kv_blocks[i])
+            if num_blocks <= max_attended_blocks:
+                blocks = torch.arange(num_blocks,
+                                      device=device,
+                                      dtype=torch.int32)
+            else:
+                blocks = torch.cat([
+                    torch.arange(self.sink_blocks,
+                                 device=device,
+                                 dtype=torch.int32),
+                    torch.arange(num_blocks - self.recency_blocks,
+                                 num_blocks,
+                                 device=device,
+                                 dtype=torch.int32)
+                ])
+            per_request_blocks.append(blocks)
+
+        sparse_attn_indices = torch.cat(per_request_blocks).unsqueeze(0).expand(
+            self.num_kv_heads, -1).contiguous()
+        sparse_attn_offsets = metadata.sparse_offsets_gen_cuda[:
+                                                               num_generations +
+                                                               1]
+        return sparse_attn_indices, sparse_attn_offsets
+
+
+class BlockSparseKVCacheManager(KVCacheManager):
+
+    def __init__(
+        self,
+        kv_cache_config: KvCacheConfig,
+        kv_cache_type: CacheTypeCpp,
+        *,
+        num_layers: int,
+        num_kv_heads: Union[int, List[Optional[int]]],
+        head_dim: int,
+        tokens_per_block: int,
+        max_seq_len: int,
+        max_batch_size: int,
+        mapping: Mapping,
+        dtype: DataType = DataType.HALF,
+        spec_config: Optional["DecodingBaseConfig"] = None,
+        layer_mask: Optional[List[bool]] = None,
+        max_num_tokens: int = 8192,
+        model_config: Optional[ModelConfig] = None,
+        max_beam_width: int = 1,
+        sparse_attn_config: Optional["SparseAttentionConfig"] = None,
+        **kwargs,
+    ) -> None:
+        assert not kv_cache_config.enable_block_reuse, \
+            "Block-sparse attention requires block reuse to be disabled in KV cache config"
+        super().__init__(
+            kv_cache_config,
+            kv_cache_type,
+            num_layers=num_layers,
+            num_kv_heads=num_kv_heads,
+            head_dim=head_dim,
+            tokens_per_block=tokens_per_block,
+            max_seq_len=max_seq_len,
+            max_batch_size=max_batch_size,
+            mapping=mapping,
+            dtype=dtype,
+            spec_config=spec_config,
+            layer_mask=layer_mask,
+            max_num_tokens=max_num_tokens,
+            model_config=model_config,
+            max_beam_width=max_beam_width,
+            **kwargs,
+        )
+        self.prompt_budget = sparse_attn_config.prompt_budget
+
+    def update_resources(self,
+                         scheduled_batch,
+                         attn_metadata=None,
+                         kv_cache_dtype_byte_size=None):
+        # After the context phase, only prompt_budget tokens are kept in the cache;
+        # release the blocks holding the pruned tail.
+        for request in scheduled_batch.context_requests:
+            if request.state != LlmRequestState.GENERATION_COMPLETE:
+                seq_len = request.get_num_tokens(0)
+                rewind_len = max(seq_len - 1 - self.prompt_budget, 0)
+                self.rewind_kv_cache(request, rewind_len)
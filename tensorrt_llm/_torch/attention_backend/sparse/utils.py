@@ -1,6 +1,7 @@
 from tensorrt_llm._torch.attention_backend.trtllm import TrtllmAttention
 from tensorrt_llm._torch.pyexecutor.resource_manager import KVCacheManager
 
+from .block import BlockSparseKVCacheManager, BlockSparseTrtllmAttention
 from .dsa import DSACacheManager, DSATrtllmAttention
 from .rocket import (RocketKVCacheManager, RocketTrtllmAttention,
                      RocketVanillaAttention)
@@ -10,6 +11,8 @@ def get_sparse_attn_kv_cache_manager(
         sparse_attn_config: "SparseAttentionConfig"):
     if sparse_attn_config.algorithm == "rocket":
         return RocketKVCacheManager
+    elif sparse_attn_config.algorithm == "block_sparse":
+        return BlockSparseKVCacheManager
     elif sparse_attn_config.algorithm == "dsa":
         return DSACacheManager
     elif sparse_attn_config.algorithm == "skip_softmax":
@@ -34,6 +37,8 @@ def get_trtllm_sparse_attn_attention_backend(
         sparse_attn_config: "SparseAttentionConfig"):
     if sparse_attn_config.algorithm == "rocket":
         return RocketTrtllmAttention
+    elif sparse_attn_config.algorithm == "block_sparse":
+        return BlockSparseTrtllmAttention
     elif sparse_attn_config.algorithm == "dsa":
         return DSATrtllmAttention
     elif sparse_attn_config.algorithm == "skip_softmax":
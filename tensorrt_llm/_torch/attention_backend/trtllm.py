@@ -1680,24 +1680,26 @@ class TrtllmAttentionMetadata(AttentionMetadata):
                     # Considering that these spec-dec params are accessed consecutively (without padding) in the attention Op,
                     # we need to write them consecutively when setting them.
                     # For the next drafter layers, we will prepare these spec-dec params in the drafting loops.
+                    # The first drafter layer sees a linear chain, so the cached device-resident
+                    # causal offsets/packed mask of the linear-tree path apply verbatim; copying
+                    # from them keeps this branch free of per-iteration host tensors and H2D
+                    # copies when the tree is reconfigured.
+                    width = max_draft_len + 1
                     # position_offsets
-                    position_offset = torch.arange(
-                        max_draft_len + 1,
-                        dtype=torch.int,
-                        device='cpu',
-                        pin_memory=prefer_pinned()).repeat(batch_size)
+                    position_offsets = generate_spec_decoding_position_offsets(
+                        self.max_num_requests, max_draft_len)
                     self.spec_decoding_position_offsets.reshape(
-                        -1)[:(max_draft_len + 1) * batch_size].copy_(
-                            position_offset, non_blocking=True)
+                        -1)[:width * batch_size].copy_(
+                            position_offsets[:batch_size].reshape(-1),
+                            non_blocking=True)
                     # packed_mask
-                    dummy_idx = torch.arange(max_draft_len + 1)
-                    spec_decoding_packed_mask = torch.pow(
-                        2, dummy_idx + 1) - 1  # [max_draft_len + 1]
-                    spec_decoding_packed_mask = spec_decoding_packed_mask.repeat(
-                        batch_size)  # [batch_size * (max_draft_len + 1)]
+                    packed_mask = generate_spec_decoding_packed_mask(
+                        self.max_num_requests, max_draft_len)
+                    num_blocks = packed_mask.shape[-1]
                     self.spec_decoding_packed_mask.reshape(
-                        -1)[:(max_draft_len + 1) * batch_size].copy_(
-                            spec_decoding_packed_mask, non_blocking=True)
+                        -1)[:width * num_blocks * batch_size].copy_(
+                            packed_mask[:batch_size].reshape(-1),
+                            non_blocking=True)
                     self.generate_spec_decoding_generation_length(
                         runtime_draft_len=max_draft_len)
 
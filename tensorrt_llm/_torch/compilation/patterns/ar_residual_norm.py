@@ -603,6 +603,156 @@ def register_ub_patterns(custom_passes: List[PatternMatcherPass],
                 extra_check=extra_check,
             )
 
+        def register_fused_moe_prologue(custom_pass: PatternMatcherPass):
+            trtllm_fused_moe_default = CallFunction(
+                torch.ops.trtllm.fused_moe.default,
+                KeywordArg('moe_input'),
+                KeywordArg('token_selected_experts'),
+                KeywordArg('token_final_scales'),
+                KeywordArg('fc1_expert_weights'),
+                KeywordArg('fc1_expert_biases'),
+                KeywordArg('fc2_expert_weights'),
+                KeywordArg('fc2_expert_biases'),
+                KeywordArg('output_dtype'),
+                KeywordArg('quant_scales'),
+                KeywordArg('input_sf'),
+                KeywordArg('swizzled_input_sf'),
+                KeywordArg('swiglu_alpha'),
+                KeywordArg('swiglu_beta'),
+                KeywordArg('swiglu_limit'),
+                KeywordArg('tp_size'),
+                KeywordArg('tp_rank'),
+                KeywordArg('ep_size'),
+                KeywordArg('ep_rank'),
+                KeywordArg('cluster_size'),
+                KeywordArg('cluster_rank'),
+                KeywordArg('enable_alltoall'),
+                KeywordArg('use_deepseek_fp8_block_scale'),
+                KeywordArg('use_w4_group_scaling'),
+                KeywordArg('use_int8_woq_per_channel'),
+                KeywordArg('use_mxfp8_act_scaling'),
+                KeywordArg('min_latency_mode'),
+                KeywordArg('use_fused_finalize'),
+                KeywordArg('tune_max_num_tokens'),
+                KeywordArg('tuner_num_tokens'),
+                KeywordArg('tuner_top_k'),
+                KeywordArg('activation_type'),
+                KeywordArg('unpadded_hidden_size'),
+                KeywordArg('out_tensor'),
+                KeywordArg('to_userbuffers'))
+            moe_output = CallFunction(getitem, trtllm_fused_moe_default, 0)
+            ub_copy = CallFunction(torch.ops.trtllm.copy_to_userbuffers,
+                                   moe_output)
+
+            def empty_fused_moe_prologue_pattern(
+                moe_input: torch.Tensor,
+                token_selected_experts: torch.Tensor,
+                token_final_scales: torch.Tensor,
+                fc1_expert_weights: torch.Tensor,
+                fc1_expert_biases: Optional[torch.Tensor],
+                fc2_expert_weights: torch.Tensor,
+                fc2_expert_biases: Optional[torch.Tensor],
+                output_dtype: torch.dtype,
+                quant_scales: List[torch.Tensor],
+                input_sf: Optional[torch.Tensor],
+                swizzled_input_sf: bool,
+                swiglu_alpha: Optional[torch.Tensor],
+                swiglu_beta: Optional[torch.Tensor],
+                swiglu_limit: Optional[torch.Tensor],
+                tp_size: int,
+                tp_rank: int,
+                ep_size: int,
+                ep_rank: int,
+                cluster_size: int,
+                cluster_rank: int,
+                enable_alltoall: bool,
+                use_deepseek_fp8_block_scale: bool,
+                use_w4_group_scaling: bool,
+                use_int8_woq_per_channel: bool,
+                use_mxfp8_act_scaling: bool,
+                min_latency_mode: bool,
+                use_fused_finalize: bool,
+                tune_max_num_tokens: int,
+                tuner_num_tokens: Optional[int],
+                tuner_top_k: Optional[int],
+                activation_type: int,
+                unpadded_hidden_size: Optional[int],
+                out_tensor: Optional[torch.Tensor],
+                to_userbuffers: bool,
+            ):
+                return
+
+            def target_fused_moe_prologue_pattern(
+                moe_input: torch.Tensor,
+                token_selected_experts: torch.Tensor,
+                token_final_scales: torch.Tensor,
+                fc1_expert_weights: torch.Tensor,
+                fc1_expert_biases: Optional[torch.Tensor],
+                fc2_expert_weights: torch.Tensor,
+                fc2_expert_biases: Optional[torch.Tensor],
+                output_dtype: torch.dtype,
+                quant_scales: List[torch.Tensor],
+                input_sf: Optional[torch.Tensor],
+                swizzled_input_sf: bool,
+                swiglu_alpha: Optional[torch.Tensor],
+                swiglu_beta: Optional[torch.Tensor],
+                swiglu_limit: Optional[torch.Tensor],
+                tp_size: int,
+                tp_rank: int,
+                ep_size: int,
+                ep_rank: int,
+                cluster_size: int,
+                cluster_rank: int,
+                enable_alltoall: bool,
+                use_deepseek_fp8_block_scale: bool,
+                use_w4_group_scaling: bool,
+                use_int8_woq_per_channel: bool,
+                use_mxfp8_act_scaling: bool,
+                min_latency_mode: bool,
+                use_fused_finalize: bool,
+                tune_max_num_tokens: int,
+                tuner_num_tokens: Optional[int],
+                tuner_top_k: Optional[int],
+                activation_type: int,
+                unpadded_hidden_size: Optional[int],
+                out_tensor: Optional[torch.Tensor],
+                to_userbuffers: bool,
+            ):
+                moe_output = torch.ops.trtllm.fused_moe(
+                    moe_input, token_selected_experts, token_final_scales,
+                    fc1_expert_weights, fc1_expert_biases, fc2_expert_weights,
+                    fc2_expert_biases, output_dtype, quant_scales, input_sf,
+                    swizzled_input_sf, swiglu_alpha, swiglu_beta, swiglu_limit,
+                    tp_size, tp_rank, ep_size, ep_rank, cluster_size,
+                    cluster_rank, enable_alltoall, use_deepseek_fp8_block_scale,
+                    use_w4_group_scaling, use_int8_woq_per_channel,
+                    use_mxfp8_act_scaling, min_latency_mode, use_fused_finalize,
+                    tune_max_num_tokens, tuner_num_tokens, tuner_top_k,
+                    activation_type, unpadded_hidden_size, None, True)
+                return moe_output[0]
+
+            def extra_check(match: Match) -> bool:
+                # The finalize epilogue owns the output only in the standard
+                # path: min latency mode returns multiple tensors and an
+                # externally provided out_tensor must not be redirected.
+                if match.kwargs.get('min_latency_mode') is not False:
+                    return False
+                if match.kwargs.get('out_tensor') is not None:
+                    return False
+                if match.kwargs.get('to_userbuffers') is not False:
+                    return False
+                return True
+
+            register_replacement(
+                empty_fused_moe_prologue_pattern,
+                target_fused_moe_prologue_pattern,
+                [],
+                fwd_only,
+                custom_pass,
+                search_fn_pattern=ub_copy,
+                extra_check=extra_check,
+            )
+
         def register_mm_prologue(custom_pass: PatternMatcherPass):
             aten_mm_default = CallFunction(aten.mm.default, KeywordArg('mm0_a'),
                                            KeywordArg('mm0_b'))
@@ -666,6 +816,7 @@ def register_ub_patterns(custom_passes: List[PatternMatcherPass],
 
         register_scaled_mm_prologue(custom_pass)
         register_nvfp4_gemm_prologue(custom_pass)
+        register_fused_moe_prologue(custom_pass)
         register_mm_prologue(custom_pass)
         register_add_prologue(custom_pass)
 
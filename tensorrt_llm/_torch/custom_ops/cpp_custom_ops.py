@@ -562,6 +562,35 @@ def _register_fake():
     ) -> List[torch.Tensor]:
         return outputs
 
+    # Fused (residual add +) RMSNorm + per-token scale + FP8 quantization
+    @torch.library.custom_op("trtllm::group_rms_norm_quant",
+                             mutates_args=("quant_outputs", "prenorm_outputs",
+                                           "scale_outputs"))
+    def group_rms_norm_quant(
+        inputs: List[torch.Tensor],
+        residuals: List[torch.Tensor],
+        quant_outputs: List[torch.Tensor],
+        prenorm_outputs: List[torch.Tensor],
+        scale_outputs: List[torch.Tensor],
+        weights: List[torch.Tensor],
+        eps: float,
+        weight_bias: float,
+    ) -> None:
+        pass
+
+    @group_rms_norm_quant.register_fake
+    def _(
+        inputs: List[torch.Tensor],
+        residuals: List[torch.Tensor],
+        quant_outputs: List[torch.Tensor],
+        prenorm_outputs: List[torch.Tensor],
+        scale_outputs: List[torch.Tensor],
+        weights: List[torch.Tensor],
+        eps: float,
+        weight_bias: float,
+    ) -> None:
+        pass
+
     @torch.library.register_fake(
         "trtllm::mtp_sampling_and_accepted_draft_tokens_op")
     def _(logits: torch.Tensor, draft_tokens: torch.Tensor,
@@ -209,8 +209,22 @@ def fused_moe(
     activation_type: int = int(ActivationType.Swiglu),
     unpadded_hidden_size: Optional[int] = None,
     out_tensor: Optional[torch.Tensor] = None,
+    to_userbuffers: bool = False,
 ) -> List[torch.Tensor]:
 
+    # Write the finalize output directly into a userbuffers tensor so a following
+    # UB allreduce can consume it in place, skipping one read+write of the hidden states.
+    if to_userbuffers:
+        assert out_tensor is None, "to_userbuffers cannot be combined with out_tensor"
+        assert not min_latency_mode, "to_userbuffers is not supported in min latency mode"
+        if use_int8_woq_per_channel:
+            hidden_size = fc2_expert_weights.shape[2]
+        else:
+            hidden_size = fc2_expert_weights.shape[1]
+        out_tensor = torch.ops.trtllm.create_userbuffers_tensor(
+            [input.shape[0], unpadded_hidden_size or hidden_size],
+            output_dtype)
+
     tuner = AutoTuner.get()
     # Only the non-alltoall case is considered for profiling in the warmup phase.
     # Therefore, to get the correct tactics during the actual inference, the inputs to the tuner should be the same as when not using alltoall.
@@ -296,6 +310,10 @@ def fused_moe(
     # (custom op output cannot be the same tensor as input).
     # Callers should use out_tensor directly when they provide it.
     if out_tensor is not None and not min_latency_mode:
+        # The userbuffers-backed output is created inside this op, so returning
+        # it does not alias an input.
+        if to_userbuffers:
+            return [out_tensor]
         return []
 
     return output if min_latency_mode else [output]
@@ -334,7 +352,8 @@ def _(input: torch.Tensor,
       tuner_top_k: Optional[int] = None,
       activation_type: ActivationType = ActivationType.Swiglu,
       unpadded_hidden_size: Optional[int] = None,
-      out_tensor: Optional[torch.Tensor] = None):
+      out_tensor: Optional[torch.Tensor] = None,
+      to_userbuffers: bool = False):
     seq_len = input.shape[0]
     if use_int8_woq_per_channel:
         # Note: The weight shape for INT8 weight only quantization is different, i.e.,
@@ -1292,7 +1311,14 @@ class WeightOnlyQuantGemmRunner(TunableRunner):
 
     def get_valid_tactics(self, inputs: List[torch.Tensor],
                           profile: OptimizationProfile, **kwargs) -> List[int]:
-        return list(range(self.weight_only_quant_gemm_runner.get_num_configs()))
+        tactics = list(range(
+            self.weight_only_quant_gemm_runner.get_num_configs()))
+        # The last tactic is the batched GEMV fast path, which only supports
+        # m < 16; drop it for larger profiled shapes.
+        if self.weight_only_quant_gemm_runner.is_cuda_kernel_enabled(
+        ) and inputs[0].shape[0] >= 16:
+            tactics = tactics[:-1]
+        return tactics
 
     def forward(
         self,
@@ -1105,6 +1105,7 @@ class SpecDecOneEngineForCausalLM(DecoderModelForCausalLM[TModel, TConfig],
         return_context_logits: bool = False,
         spec_metadata: Optional[SpecMetadata] = None,
         resource_manager=None,
+        gather_ids: Optional[torch.Tensor] = None,
         **kwargs,
     ) -> torch.Tensor:
         hidden_states = self.model(
@@ -1157,6 +1158,7 @@ class SpecDecOneEngineForCausalLM(DecoderModelForCausalLM[TModel, TConfig],
                 self.lm_head,
                 attn_metadata,
                 return_context_logits,
+                gather_ids=gather_ids,
             )
 
         return logits
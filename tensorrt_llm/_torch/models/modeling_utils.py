@@ -575,6 +575,7 @@ class DecoderModelForCausalLM(nn.Module,
         return_context_logits: bool = False,
         spec_metadata: Optional[SpecMetadata] = None,
         lora_params: Optional[dict] = None,
+        gather_ids: Optional[torch.Tensor] = None,
         **kwargs,
     ) -> torch.Tensor:
 
@@ -592,6 +593,7 @@ class DecoderModelForCausalLM(nn.Module,
             self.lm_head,
             attn_metadata,
             return_context_logits,
+            gather_ids=gather_ids,
         )
 
     def load_weights(self,
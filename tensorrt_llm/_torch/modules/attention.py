@@ -1403,6 +1403,9 @@ class MLA(nn.Module):
 
         self.aux_stream = aux_stream
         self.ln_events = [torch.cuda.Event(), torch.cuda.Event()]
+        # Events used to pipeline chunked-prefill latent KV loads on the aux stream.
+        self.chunk_prefetch_events = [torch.cuda.Event(), torch.cuda.Event()]
+        self.chunk_append_event = torch.cuda.Event()
 
         self.rope_fusion = self.mqa.support_fused_rope()
         self.rotary_emb = None
@@ -2146,7 +2149,7 @@ class MLA(nn.Module):
         origin_kv_lens_runtime = attn_metadata.kv_lens_runtime
         origin_ctx_total_kv_len = attn_metadata.host_total_kv_lens[0]
 
-        for loop_idx in range(chunked_loop_num):
+        def load_chunk(loop_idx: int):
             # {b, chunked_unit_size, h, kv_lora_rank + qk_rope_head_dim} zero padded
             # fetch `loop_idx` chunk from kv cache
             temp_cu_chunked_seq_len = attn_metadata.cu_chunked_seq_len[loop_idx]
@@ -2182,12 +2185,41 @@ class MLA(nn.Module):
                                                      -1)),
                 dim=-1)
             chunked_k = chunked_k.view(-1, self.num_heads_tp * self.qk_head_dim)
+            return chunked_k, chunked_v, total_ctx_chunked_tokens
+
+        # Pipeline the latent KV load and up-projection of chunk N+1 on the aux
+        # stream against the attention of chunk N on the main stream, so the
+        # memory-bound cache gather overlaps with the compute-bound FMHA.
+        main_stream = torch.cuda.current_stream()
+        use_aux_stream = self.aux_stream is not None and chunked_loop_num > 1
+        pipeline = [None, None]
+        if use_aux_stream:
+            # The aux stream must observe the latent cache appended above.
+            self.chunk_append_event.record()
+            with torch.cuda.stream(self.aux_stream):
+                self.chunk_append_event.wait()
+                pipeline[0] = load_chunk(0)
+                self.chunk_prefetch_events[0].record()
 
-            # release pytorch activation memory
-            chunked_compressed_kv = None
-            chunked_k_pe = None
-            chunked_kv = None
-            chunked_k_nope = None
+        for loop_idx in range(chunked_loop_num):
+            if use_aux_stream:
+                slot = loop_idx % 2
+                self.chunk_prefetch_events[slot].wait()
+                chunked_k, chunked_v, total_ctx_chunked_tokens = pipeline[slot]
+                pipeline[slot] = None
+                # The chunk tensors were allocated on the aux stream; keep the
+                # caching allocator from recycling them while the main stream
+                # still reads them.
+                chunked_k.record_stream(main_stream)
+                chunked_v.record_stream(main_stream)
+                if loop_idx + 1 < chunked_loop_num:
+                    next_slot = (loop_idx + 1) % 2
+                    with torch.cuda.stream(self.aux_stream):
+                        pipeline[next_slot] = load_chunk(loop_idx + 1)
+                        self.chunk_prefetch_events[next_slot].record()
+            else:
+                chunked_k, chunked_v, total_ctx_chunked_tokens = load_chunk(
+                    loop_idx)
 
             # copy chunked_seq_len to replace kv_lens_runtime
             attn_metadata.kv_lens_runtime = attn_metadata.host_chunked_seq_len[
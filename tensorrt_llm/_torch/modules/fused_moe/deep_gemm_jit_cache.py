@@ -0,0 +1,90 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Sharing of DeepGEMM JIT artifacts across replicas.
+
+DeepGEMM compiles a kernel the first time a shape is seen and stores the
+artifact in its JIT cache directory (``DG_JIT_CACHE_DIR``) under a directory
+whose name includes a hash of the kernel signature, so the cache is already
+content addressed at directory granularity. These helpers seed the local cache
+from a shared directory (for example a fleet-wide read-only mount) before
+warmup and publish newly compiled artifacts back afterwards, so a shape
+compiled on one replica never stalls another.
+"""
+
+import os
+import shutil
+import uuid
+from pathlib import Path
+from typing import Iterator
+
+from tensorrt_llm.logger import logger
+
+
+def get_jit_cache_dir() -> Path:
+    """Returns the directory DeepGEMM uses for JIT-compiled kernel artifacts."""
+    cache_dir = os.environ.get("DG_JIT_CACHE_DIR")
+    if cache_dir:
+        return Path(cache_dir)
+    return Path.home() / ".deep_gemm"
+
+
+def _iter_artifact_dirs(root: Path) -> Iterator[Path]:
+    """Yields leaf directories holding kernel artifacts (directories with files)."""
+    for dirpath, _, filenames in os.walk(root):
+        if filenames:
+            yield Path(dirpath)
+
+
+def _copy_missing_artifacts(src_root: Path, dst_root: Path) -> int:
+    """Copies artifact directories present in src_root but not in dst_root.
+
+    Each directory is staged next to its destination and renamed into place, so
+    concurrent replicas syncing against the same shared directory either see a
+    complete artifact or none at all. Losing the rename race is not an error:
+    the winner published identical content.
+    """
+    num_copied = 0
+    if not src_root.is_dir():
+        return num_copied
+    for src_dir in _iter_artifact_dirs(src_root):
+        dst_dir = dst_root / src_dir.relative_to(src_root)
+        if dst_dir.exists():
+            continue
+        staging_dir = dst_dir.with_name(f".tmp.{dst_dir.name}.{uuid.uuid4().hex}")
+        try:
+            dst_dir.parent.mkdir(parents=True, exist_ok=True)
+            shutil.copytree(src_dir, staging_dir)
+            os.rename(staging_dir, dst_dir)
+            num_copied += 1
+        except OSError as e:
+            logger.debug(f"Skipping DeepGEMM artifact {dst_dir}: {e}")
+            shutil.rmtree(staging_dir, ignore_errors=True)
+    return num_copied
+
+
+def seed_jit_cache_from_shared(shared_dir: str) -> int:
+    """Copies artifacts from the shared cache into the local JIT cache.
+
+    Returns the number of artifact directories copied.
+    """
+    return _copy_missing_artifacts(Path(shared_dir), get_jit_cache_dir())
+
+
+def publish_jit_cache_to_shared(shared_dir: str) -> int:
+    """Copies locally compiled artifacts into the shared cache.
+
+    Returns the number of artifact directories copied.
+    """
+    return _copy_missing_artifacts(get_jit_cache_dir(), Path(shared_dir))
@@ -544,6 +544,89 @@ class DeepGemmFusedMoE(CutlassFusedMoE):
             workspaces.append(workspace)
         return workspaces
 
+    # Grouped GEMM shapes already compiled ahead of time, shared across layers since layers with
+    # identical dimensions reuse the same DeepGEMM kernels.
+    _precompiled_gemm_shapes = set()
+
+    def precompile_grouped_gemms(self, token_counts: List[int]) -> int:
+        """Ahead-of-time compiles the DeepGEMM grouped GEMM kernels for a corpus of token counts.
+
+        DeepGEMM JIT-compiles on the first call with a new shape, which stalls the serving path
+        for seconds when an unseen token-count shape appears. Running the two grouped GEMMs once
+        per corpus entry with near-empty masked inputs populates the JIT cache up front; the
+        actual compute is negligible because masked_m keeps all groups at a single row.
+
+        Returns the number of corpus entries compiled (deduplicated across identically shaped
+        layers).
+        """
+        if not self.has_deepseek_fp8_block_scales:
+            return 0
+
+        num_experts = self.expert_size_per_partition
+        hidden_size = self.hidden_size
+        intermediate_size = self.intermediate_size_per_partition
+        top_k = self.routing_method.top_k
+        masked_m = torch.ones(num_experts,
+                              dtype=torch.int32,
+                              device=self.w3_w1_weight.device)
+
+        num_compiled = 0
+        for num_tokens in sorted(set(token_counts)):
+            if num_tokens <= 0:
+                continue
+            num_tokens = min(num_tokens, self.moe_max_num_tokens)
+            m_max = fp8_utils.align(num_tokens, 128)
+            expected_m = (num_tokens * top_k + num_experts -
+                          1) // num_experts
+            shape_key = (num_experts, m_max, expected_m, hidden_size,
+                         intermediate_size)
+            if shape_key in DeepGemmFusedMoE._precompiled_gemm_shapes:
+                continue
+
+            # Mirror the buffer layout of run_moe; the buffer contents are irrelevant for
+            # compilation and the outputs are discarded.
+            workspace = self.get_workspace(m_max, 128)
+            m_padded = fp8_utils.align(m_max, 4)
+            scale_k = fp8_utils.ceil_div(hidden_size, 128)
+            scale_k_padded = fp8_utils.align(scale_k, 4)
+            act_input_fp8 = set_strides(workspace["workspace_0"], num_experts,
+                                        m_max, hidden_size)
+            act_input_sf = set_strides(workspace["workspace_sf"], num_experts,
+                                       scale_k_padded // 4, m_padded)
+            h1 = set_strides(workspace["workspace_1"], num_experts, m_max,
+                             intermediate_size * 2)
+            deepgemm_fp8_group_blockwise_gemm(
+                d=h1,
+                a=act_input_fp8,
+                b=self.w3_w1_weight,
+                sfa=act_input_sf,
+                sfb=self.quant_scales[0],
+                masked_m=masked_m,
+                expected_m=expected_m,
+            )
+
+            act_input_fp8 = set_strides(workspace["workspace_0"], num_experts,
+                                        m_max, intermediate_size)
+            scale_k = fp8_utils.ceil_div(intermediate_size, 128)
+            scale_k_padded = fp8_utils.align(scale_k, 4)
+            act_input_sf = set_strides(workspace["workspace_sf"], num_experts,
+                                       scale_k_padded // 4, m_padded)
+            h3 = set_strides(workspace["workspace_1"], num_experts, m_max,
+                             hidden_size)
+            deepgemm_fp8_group_blockwise_gemm(
+                d=h3,
+                a=act_input_fp8,
+                b=self.w2_weight,
+                sfa=act_input_sf,
+                sfb=self.quant_scales[1],
+                masked_m=masked_m,
+                expected_m=expected_m,
+            )
+
+            DeepGemmFusedMoE._precompiled_gemm_shapes.add(shape_key)
+            num_compiled += 1
+        return num_compiled
+
     def _get_quant_method(self):
         if self.quant_config is not None and self.quant_config.layer_quant_mode.has_any_quant(
                 exclude_kv_cache=True):
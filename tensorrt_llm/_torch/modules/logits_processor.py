@@ -1,3 +1,5 @@
+from typing import Optional
+
 import torch
 import torch.nn as nn
 
@@ -14,9 +16,14 @@ class LogitsProcessor(nn.Module):
                 hidden_states: torch.Tensor,
                 lm_head: Linear,
                 attn_metadata: AttentionMetadata,
-                return_context_logits: bool = False) -> torch.Tensor:
+                return_context_logits: bool = False,
+                gather_ids: Optional[torch.Tensor] = None) -> torch.Tensor:
 
-        if not return_context_logits:
+        if gather_ids is not None:
+            # Select the requested positions before the LM head so the
+            # vocab-size GEMM only runs for tokens whose logits are consumed.
+            hidden_states = hidden_states[gather_ids]
+        elif not return_context_logits:
             if attn_metadata is not None:
                 last_tokens = torch.cumsum(
                     attn_metadata.seq_lens_cuda,
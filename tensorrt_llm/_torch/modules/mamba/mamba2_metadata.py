@@ -242,8 +242,10 @@ class Mamba2Metadata:
             ]
             indices = kv_cache_manager.get_state_indices(
                 batch_request_ids, is_padding)
-            for i, idx in enumerate(indices):
-                self.state_indices_cpu[i] = idx
+            # Stage the whole batch in one copy instead of per-element tensor
+            # writes, which each dispatch a scalar fill.
+            self.state_indices_cpu[:batch_size] = torch.tensor(
+                indices, dtype=torch.int32)
             self.state_indices[:batch_size].copy_(
                 self.state_indices_cpu[:batch_size], non_blocking=True)
 
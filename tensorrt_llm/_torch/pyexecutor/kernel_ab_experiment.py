@@ -0,0 +1,192 @@
+# Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""In-production A/B experiments between interchangeable kernel implementations.
+
+A :class:`KernelABExperiment` deterministically routes a configurable fraction
+of invocations of a dispatch site to an alternative ("B") implementation and
+accumulates per-variant latency statistics, so that the two implementations can
+be compared on live traffic without a separate benchmarking run. Latencies are
+captured with non-blocking CUDA events and harvested lazily on subsequent
+invocations, so measurement never synchronizes the stream. The accumulated
+statistics are exported through ``IterationStats.kernel_experiment_stats``.
+"""
+
+import math
+import os
+from collections import deque
+from dataclasses import dataclass, field
+from typing import Deque, List, NamedTuple, Optional
+
+import torch
+
+from tensorrt_llm.logger import logger
+
+# Number of log2-spaced latency buckets. Bucket i counts samples in
+# [2**(i - 4), 2**(i - 3)) ms, i.e. bucket 0 starts at 1/16 ms; out-of-range
+# samples are clamped into the first/last bucket.
+NUM_LATENCY_BUCKETS = 16
+_BUCKET_OFFSET = 4
+
+
+@dataclass
+class KernelABExperimentSnapshot:
+    """Accumulated per-variant statistics of a :class:`KernelABExperiment`."""
+    name: str
+    fraction_b: float
+    num_samples_a: int = 0
+    num_samples_b: int = 0
+    avg_latency_a_ms: float = 0.0
+    avg_latency_b_ms: float = 0.0
+    latency_histogram_a: List[int] = field(
+        default_factory=lambda: [0] * NUM_LATENCY_BUCKETS)
+    latency_histogram_b: List[int] = field(
+        default_factory=lambda: [0] * NUM_LATENCY_BUCKETS)
+
+
+class _PendingMeasurement(NamedTuple):
+    variant_b: bool
+    start: torch.cuda.Event
+    end: torch.cuda.Event
+
+
+class _VariantAccumulator:
+
+    def __init__(self):
+        self.num_samples = 0
+        self.total_latency_ms = 0.0
+        self.histogram = [0] * NUM_LATENCY_BUCKETS
+
+    def add(self, latency_ms: float) -> None:
+        self.num_samples += 1
+        self.total_latency_ms += latency_ms
+        if latency_ms > 0.0:
+            bucket = math.floor(math.log2(latency_ms)) + _BUCKET_OFFSET
+        else:
+            bucket = 0
+        bucket = min(max(bucket, 0), NUM_LATENCY_BUCKETS - 1)
+        self.histogram[bucket] += 1
+
+    @property
+    def avg_latency_ms(self) -> float:
+        if self.num_samples == 0:
+            return 0.0
+        return self.total_latency_ms / self.num_samples
+
+
+class KernelABExperiment:
+    """Routes a fraction of invocations to variant B and records latencies.
+
+    Routing is deterministic: invocation ``i`` is routed to variant B iff
+    ``floor((i + 1) * fraction_b) > floor(i * fraction_b)``, which spreads the
+    B samples evenly over time and makes runs reproducible. One measurement is
+    recorded per ``begin``/``end`` pair; pairs whose end event has not
+    completed yet stay pending and are folded into the statistics once
+    ``torch.cuda.Event.query`` reports them done.
+    """
+
+    # Bound on outstanding event pairs; if the stream falls this far behind,
+    # measurement is skipped rather than growing the queue without limit.
+    MAX_PENDING_MEASUREMENTS = 128
+
+    def __init__(self, name: str, fraction_b: float):
+        if not 0.0 < fraction_b <= 1.0:
+            raise ValueError(
+                f"fraction_b must be in (0, 1], got {fraction_b}")
+        self.name = name
+        self.fraction_b = fraction_b
+        self._invocation_count = 0
+        self._pending: Deque[_PendingMeasurement] = deque()
+        self._accumulators = {
+            False: _VariantAccumulator(),
+            True: _VariantAccumulator(),
+        }
+        self._current: Optional[_PendingMeasurement] = None
+
+    def use_variant_b(self) -> bool:
+        """Decides the variant for the next invocation and advances the counter."""
+        i = self._invocation_count
+        self._invocation_count += 1
+        return (math.floor((i + 1) * self.fraction_b) >
+                math.floor(i * self.fraction_b))
+
+    def begin(self, variant_b: bool) -> None:
+        """Records the start event of a measurement on the current stream."""
+        self._harvest()
+        if (self._current is not None
+                or len(self._pending) >= self.MAX_PENDING_MEASUREMENTS):
+            return
+        measurement = _PendingMeasurement(
+            variant_b=variant_b,
+            start=torch.cuda.Event(enable_timing=True),
+            end=torch.cuda.Event(enable_timing=True),
+        )
+        measurement.start.record()
+        self._current = measurement
+
+    def end(self) -> None:
+        """Records the end event matching the last :meth:`begin`."""
+        if self._current is None:
+            return
+        self._current.end.record()
+        self._pending.append(self._current)
+        self._current = None
+
+    def _harvest(self) -> None:
+        while self._pending and self._pending[0].end.query():
+            measurement = self._pending.popleft()
+            latency_ms = measurement.start.elapsed_time(measurement.end)
+            self._accumulators[measurement.variant_b].add(latency_ms)
+
+    def get_snapshot(self) -> KernelABExperimentSnapshot:
+        """Returns the statistics accumulated so far (completed samples only)."""
+        self._harvest()
+        acc_a = self._accumulators[False]
+        acc_b = self._accumulators[True]
+        return KernelABExperimentSnapshot(
+            name=self.name,
+            fraction_b=self.fraction_b,
+            num_samples_a=acc_a.num_samples,
+            num_samples_b=acc_b.num_samples,
+            avg_latency_a_ms=acc_a.avg_latency_ms,
+            avg_latency_b_ms=acc_b.avg_latency_ms,
+            latency_histogram_a=list(acc_a.histogram),
+            latency_histogram_b=list(acc_b.histogram),
+        )
+
+    @classmethod
+    def from_env(cls, name: str) -> Optional["KernelABExperiment"]:
+        """Creates an experiment from ``TRTLLM_KERNEL_AB_FRACTION``, or None.
+
+        The environment variable gives the fraction of invocations routed to
+        variant B; unset, empty, or 0 disables the experiment.
+        """
+        value = os.environ.get("TRTLLM_KERNEL_AB_FRACTION", "")
+        if not value:
+            return None
+        try:
+            fraction_b = float(value)
+        except ValueError:
+            logger.warning(
+                f"Ignoring invalid TRTLLM_KERNEL_AB_FRACTION={value!r}")
+            return None
+        if fraction_b <= 0.0:
+            return None
+        if fraction_b > 1.0:
+            logger.warning(
+                f"Clamping TRTLLM_KERNEL_AB_FRACTION={fraction_b} to 1.0")
+            fraction_b = 1.0
+        logger.info(
+            f"Kernel A/B experiment '{name}' enabled with fraction_b={fraction_b}"
+        )
+        return cls(name, fraction_b)
@@ -323,6 +323,9 @@ class PythonMambaCacheManager(BaseResourceManager):
                                                         dtype=torch.int32)
         # save mamba state indices for requests
         self.state_indices_list: List[int] = []
+        # state indices currently resident in the device buffer; lets
+        # _prepare_mamba_cache_blocks skip the upload when unchanged
+        self.uploaded_state_indices: Optional[List[int]] = None
         # save intermediate state indices for requests
         self.intermediate_state_indices = torch.arange(max_batch_size,
                                                        dtype=torch.int32,
@@ -353,11 +356,17 @@ class PythonMambaCacheManager(BaseResourceManager):
                 block = self.mamba_cache_free_blocks.pop()
                 self.mamba_cache_index[r] = block
                 self.state_indices_list.append(block)
+        # In steady-state decode the batch membership and slot assignment are
+        # unchanged from the previous iteration, so the device buffer already
+        # holds the right indices; skip the host tensor build and H2D copy.
+        if self.state_indices_list == self.uploaded_state_indices:
+            return
         self.state_indices[:len(self.state_indices_list)].copy_(
             torch.tensor(self.state_indices_list,
                          dtype=torch.int32,
                          pin_memory=prefer_pinned()),
             non_blocking=True)
+        self.uploaded_state_indices = list(self.state_indices_list)
 
     def prepare_resources(self, scheduled_batch: ScheduledRequests):
         context_ids = [
@@ -393,12 +402,19 @@ class PythonMambaCacheManager(BaseResourceManager):
         assert len(request_ids) == len(is_padding), (
             "request_ids and is_padding must have the same size")
 
+        # Fast path: no padding, so no free slot search is needed.
+        if not any(is_padding):
+            return [self.mamba_cache_index[req_id] for req_id in request_ids]
+
         used_slots = {
             self.mamba_cache_index[req_id]
             for req_id, pad in zip(request_ids, is_padding) if not pad
         }
-        available_slots = iter(
-            sorted(set(range(self.state_indices.numel())) - used_slots))
+        # Yield free slots lazily in ascending order: only as many slots as
+        # there are padding entries are ever searched, instead of
+        # materializing and sorting the full complement of the slot range.
+        available_slots = (slot for slot in range(self.state_indices.numel())
+                           if slot not in used_slots)
 
         def slot_for(req_id: int, pad: bool):
             if pad:
@@ -453,6 +469,7 @@ class PythonMambaCacheManager(BaseResourceManager):
         """Release tensor memory."""
         # Clear state indices
         self.state_indices = torch.tensor([])
+        self.uploaded_state_indices = None
 
         # Clear mamba cache states
         if isinstance(self.mamba_cache, self.SpeculativeState):
@@ -470,33 +487,34 @@ class PythonMambaCacheManager(BaseResourceManager):
 
         torch.cuda.empty_cache()
 
-    @torch.compile(options={"max-autotune": True})
     def update_mamba_states(self, attn_metadata: "AttentionMetadata",
                             num_accepted_tokens: torch.Tensor):
         batch_size = attn_metadata.num_seqs
         num_contexts = attn_metadata.num_contexts
         num_gens = batch_size - num_contexts
-        num_accepted_draft_tokens = num_accepted_tokens[
-            num_contexts:num_contexts + num_gens] - 1
+        num_accepted_draft_tokens = (
+            num_accepted_tokens[num_contexts:num_contexts + num_gens] -
+            1).to(torch.int32)
         state_indices_d = self.state_indices[num_contexts:num_contexts +
                                              num_gens]
-
-        conv_states = self.mamba_cache.conv
-        ssm_states = self.mamba_cache.temporal
-
-        intermediate_state_cache = self.mamba_cache.intermediate_ssm
-        intermediate_conv_window_cache = self.mamba_cache.intermediate_conv_window
-
         src_state_indices = self.intermediate_state_indices[:num_gens]
 
-        accepted_ssm_state = intermediate_state_cache[:, src_state_indices,
-                                                      num_accepted_draft_tokens]
-        ssm_states[:, state_indices_d, :] = accepted_ssm_state
-
-        accepted_conv_state = intermediate_conv_window_cache[:,
-                                                             src_state_indices,
-                                                             num_accepted_draft_tokens]
-        conv_states[:, state_indices_d, :] = accepted_conv_state
+        # Restore the checkpoint at the last accepted draft position for all layers in one
+        # launch per state cache, so rejected drafts roll back without recomputing the scan.
+        torch.ops.trtllm.mamba2_mtp_state_restore(
+            self.mamba_cache.temporal,
+            self.mamba_cache.intermediate_ssm,
+            state_indices_d,
+            src_state_indices,
+            num_accepted_draft_tokens,
+        )
+        torch.ops.trtllm.mamba2_mtp_state_restore(
+            self.mamba_cache.conv,
+            self.mamba_cache.intermediate_conv_window,
+            state_indices_d,
+            src_state_indices,
+            num_accepted_draft_tokens,
+        )
 
 
 class MambaCacheManager(BaseResourceManager):
@@ -726,6 +726,10 @@ class PyTorchModelEngine(ModelEngine):
         Orchestrates the warmup process by calling specialized warmup methods for
         torch.compile, the autotuner, and CUDA graphs.
         """
+        # Compile the DeepGEMM shape corpus before anything else so no shape JITs on the
+        # serving path; this only needs weights, not KV cache.
+        self._run_deep_gemm_precompile()
+
         kv_cache_manager = resource_manager.get_resource_manager(
             self.kv_cache_manager_key)
 
@@ -819,6 +823,62 @@ class PyTorchModelEngine(ModelEngine):
                     f"{num_gen_tokens} generation tokens. Skipping.")
                 torch.cuda.empty_cache()
 
+    def _run_deep_gemm_precompile(self) -> None:
+        """Ahead-of-time compiles DeepGEMM grouped GEMM kernels for a configured shape corpus.
+
+        TRTLLM_DEEP_GEMM_PRECOMPILE_TOKEN_COUNTS holds a comma-separated list of per-iteration
+        token counts to compile for (unset disables the pass). If
+        TRTLLM_DEEP_GEMM_SHARED_CACHE_DIR points at a directory shared between replicas, the
+        local JIT cache is seeded from it first and newly compiled artifacts are published back,
+        so each shape is compiled once per fleet rather than once per replica.
+        """
+        corpus_env = os.environ.get("TRTLLM_DEEP_GEMM_PRECOMPILE_TOKEN_COUNTS",
+                                    "")
+        if not corpus_env.strip():
+            return
+        try:
+            token_counts = [
+                int(value) for value in corpus_env.split(",") if value.strip()
+            ]
+        except ValueError:
+            logger.warning(
+                f"Ignoring invalid TRTLLM_DEEP_GEMM_PRECOMPILE_TOKEN_COUNTS: {corpus_env}"
+            )
+            return
+
+        try:
+            from ..modules.fused_moe.fused_moe_deepgemm import DeepGemmFusedMoE
+        except ImportError:
+            return
+        from ..modules.fused_moe.deep_gemm_jit_cache import (
+            publish_jit_cache_to_shared, seed_jit_cache_from_shared)
+
+        shared_cache_dir = os.environ.get("TRTLLM_DEEP_GEMM_SHARED_CACHE_DIR")
+        if shared_cache_dir:
+            num_seeded = seed_jit_cache_from_shared(shared_cache_dir)
+            logger.info(
+                f"Seeded {num_seeded} DeepGEMM artifacts from {shared_cache_dir}"
+            )
+
+        moe_modules = [
+            module for module in self.model.modules()
+            if isinstance(module, DeepGemmFusedMoE)
+        ]
+        if moe_modules:
+            num_compiled = sum(
+                module.precompile_grouped_gemms(token_counts)
+                for module in moe_modules)
+            torch.cuda.synchronize()
+            logger.info(
+                f"Precompiled DeepGEMM grouped GEMMs for {num_compiled} shape(s) "
+                f"from a corpus of {len(token_counts)} token count(s)")
+
+        if shared_cache_dir:
+            num_published = publish_jit_cache_to_shared(shared_cache_dir)
+            logger.info(
+                f"Published {num_published} DeepGEMM artifacts to {shared_cache_dir}"
+            )
+
     def _run_autotuner_warmup(self, resource_manager: ResourceManager):
         """Runs a forward pass to populate the autotuner cache."""
         if not self.llm_args.enable_autotuner:
@@ -3916,6 +3976,12 @@ class PyTorchModelEngine(ModelEngine):
         else:
             return self.model.forward(**kwargs)
 
+    @functools.cached_property
+    def _support_gather_before_lm_head(self) -> bool:
+        """True if the model's forward can select hidden states before the LM head."""
+        return 'gather_ids' in inspect.signature(
+            type(self.model).forward).parameters
+
     @nvtx_range("_forward_step")
     def _forward_step(self,
                       inputs: Dict[str, Any],
@@ -3925,13 +3991,22 @@ class PyTorchModelEngine(ModelEngine):
         if inputs.get('spec_metadata', None):
             gather_ids = inputs['spec_metadata'].gather_ids
 
-        # For simplicity, just return all the the logits if we have special gather_ids
-        # from speculative decoding.
-        outputs = self.model_forward(
-            **inputs,
-            return_context_logits=gather_ids is not None
-            or gather_context_logits,
-        )
+        if (gather_ids is not None and not gather_context_logits
+                and self._support_gather_before_lm_head):
+            # Select the hidden states of the gathered positions before the LM
+            # head, so the vocab-size GEMM only runs for tokens whose logits
+            # are actually consumed.
+            outputs = self.model_forward(**inputs, gather_ids=gather_ids)
+            # The logits are already gathered; skip the post-forward gather.
+            gather_ids = None
+        else:
+            # For simplicity, just return all the the logits if we have special gather_ids
+            # from speculative decoding and the model cannot gather before the LM head.
+            outputs = self.model_forward(
+                **inputs,
+                return_context_logits=gather_ids is not None
+                or gather_context_logits,
+            )
 
         if self.without_logits:
             return outputs
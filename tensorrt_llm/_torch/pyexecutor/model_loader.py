@@ -517,6 +517,17 @@ class ModelLoader:
                 f"{type(config.pretrained_config).__name__}: {e}. "
                 f"AllReduce pre-allocation will be skipped.")
 
+        if self.llm_args.enable_min_latency:
+            architectures = getattr(config.pretrained_config, "architectures",
+                                    None) or []
+            if "Llama4ForConditionalGeneration" not in architectures:
+                logger.warning(
+                    f"enable_min_latency is set but {architectures or 'this model'} "
+                    f"has no min-latency model implementation, so the flag has no "
+                    f"effect. For small-batch decode latency, CUDA graphs with "
+                    f"padding (cuda_graph_config.enable_padding) cover the generic "
+                    f"launch-overhead path.")
+
         validate_and_set_kv_cache_quant(config,
                                         self.llm_args.kv_cache_config.dtype)
         validate_and_set_mamba_ssm_cache_dtype(
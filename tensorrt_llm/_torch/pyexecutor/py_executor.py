@@ -25,7 +25,8 @@ from tensorrt_llm._utils import (customized_gc_thresholds, is_trace_enabled,
                                  set_thread_local_mpi_comm, trace_func)
 from tensorrt_llm.bindings.executor import (DisServingRequestStats,
                                             FinishReason, InflightBatchingStats,
-                                            IterationStats, KvCacheStats,
+                                            IterationStats,
+                                            KernelExperimentStats, KvCacheStats,
                                             RequestStage, RequestStats,
                                             SpecDecodingStats,
                                             StaticBatchingStats)
@@ -1047,6 +1048,16 @@ class PyExecutor:
             scheduled_requests: ScheduledRequests
     ) -> Optional[List[RequestStats]]:
 
+        # Membership below is by request id: probing the scheduled lists
+        # directly makes the scheduled flag cost O(batch) per request and
+        # the whole pass quadratic at high request counts.
+        scheduled_req_ids = {
+            req.request_id
+            for req in scheduled_requests.context_requests
+        }
+        scheduled_req_ids.update(
+            req.request_id for req in scheduled_requests.generation_requests)
+
         def get_req_stats(req: LlmRequest) -> RequestStats:
             req_stat = RequestStats()
             req_stat.id = req.request_id
@@ -1058,7 +1069,7 @@ class PyExecutor:
             req_stat.reused_blocks_per_request = req.reused_blocks
             req_stat.missed_blocks_per_request = req.missed_blocks
             req_stat.kv_cache_hit_rate_per_request = req.kv_cache_hit_rate
-            req_stat.scheduled = req in scheduled_requests.context_requests or req in scheduled_requests.generation_requests
+            req_stat.scheduled = req.request_id in scheduled_req_ids
             if req.llm_request_type == LlmRequestType.LLMREQUEST_TYPE_CONTEXT_ONLY or req.llm_request_type == LlmRequestType.LLMREQUEST_TYPE_GENERATION_ONLY:
                 req_stat.dis_serving_stats = DisServingRequestStats()
                 req_stat.dis_serving_stats.kv_cache_transfer_ms = req.kv_cache_transfer_time_ms
@@ -1198,6 +1209,21 @@ class PyExecutor:
             # Calculate draft overhead
             stats.specdec_stats.draft_overhead = 0.0 if iter_latency_ms <= 0.0 else float(
                 draft_latency_ms) / float(iter_latency_ms)
+
+        sampler_ab_experiment = getattr(self.sampler, '_sampler_ab_experiment',
+                                        None)
+        if sampler_ab_experiment is not None:
+            snapshot = sampler_ab_experiment.get_snapshot()
+            experiment_stats = KernelExperimentStats()
+            experiment_stats.name = snapshot.name
+            experiment_stats.fraction_b = snapshot.fraction_b
+            experiment_stats.num_samples_a = snapshot.num_samples_a
+            experiment_stats.num_samples_b = snapshot.num_samples_b
+            experiment_stats.avg_latency_a_ms = snapshot.avg_latency_a_ms
+            experiment_stats.avg_latency_b_ms = snapshot.avg_latency_b_ms
+            experiment_stats.latency_histogram_a = snapshot.latency_histogram_a
+            experiment_stats.latency_histogram_b = snapshot.latency_histogram_b
+            stats.kernel_experiment_stats = experiment_stats
         return stats
 
     def _append_iter_stats(self,
@@ -1,5 +1,6 @@
 import copy
 import enum
+import heapq
 import math
 import os
 from abc import ABC, abstractmethod
@@ -180,31 +181,34 @@ def request_context(is_draft: bool, scheduled_requests: ScheduledRequests):
 
 
 def _locate_accepted_draft_tokens(requests: List[LlmRequest]):
-    num_accepted_draft_tokens = []
+    # Offsets are a prefix sum over per-request accepted counts; compute them
+    # on the host so the whole payload can ship in one copy.
+    num_accepted_draft_tokens_offset = [0]
     accepted_draft_tokens_indices = []
     rewind_draft_token_separate_adjustments = []
     # for context requests, the py_num_accepted_draft_tokens = 0, and py_num_accepted_draft_tokens_indices = []
     for seq in requests:
-        num_accepted_draft_tokens.append(seq.py_num_accepted_draft_tokens)
+        num_accepted_draft_tokens_offset.append(
+            num_accepted_draft_tokens_offset[-1] +
+            seq.py_num_accepted_draft_tokens)
         rewind_draft_token_separate_adjustments.append(
             seq.py_rewind_draft_token_separate_adjustment)
         accepted_draft_tokens_indices.extend(
             seq.py_num_accepted_draft_tokens_indices)
-    batch_size = len(requests)
-    num_accepted_draft_tokens_offset = torch.zeros(batch_size + 1,
-                                                   dtype=torch.int32,
-                                                   device='cuda')
-    num_accepted_draft_tokens_offset[1:] = torch.cumsum(torch.tensor(
-        num_accepted_draft_tokens, dtype=torch.int32),
-                                                        dim=0)
-    accepted_draft_tokens_indices = torch.tensor(accepted_draft_tokens_indices,
-                                                 dtype=torch.int32,
-                                                 device='cuda')
-    rewind_draft_token_separate_adjustments = torch.tensor(
-        rewind_draft_token_separate_adjustments,
-        dtype=torch.int32,
-        device='cuda')
-    return num_accepted_draft_tokens_offset, accepted_draft_tokens_indices, rewind_draft_token_separate_adjustments
+    # Pack all three arrays into a single pinned staging tensor and upload
+    # them with one non-blocking H2D copy instead of three blocking pageable
+    # copies plus a device-side zeros + cumsum.
+    offsets_len = len(num_accepted_draft_tokens_offset)
+    indices_len = len(accepted_draft_tokens_indices)
+    packed_host = torch.tensor(num_accepted_draft_tokens_offset +
+                               accepted_draft_tokens_indices +
+                               rewind_draft_token_separate_adjustments,
+                               dtype=torch.int32,
+                               pin_memory=prefer_pinned())
+    packed_device = packed_host.to('cuda', non_blocking=True)
+    return (packed_device[:offsets_len],
+            packed_device[offsets_len:offsets_len + indices_len],
+            packed_device[offsets_len + indices_len:])
 
 
 def _update_kv_cache_draft_token_location(cache_manager,
@@ -2878,7 +2882,12 @@ class SlotManager:
     def __init__(self, max_num_requests: int):
         self.max_num_requests = max_num_requests
         self.slot_mapping = dict()
-        self.free_slots = set(range(max_num_requests))
+        # Min-heap so add_slot always hands out the lowest free slot. Active
+        # slots stay dense near zero, which keeps slot-indexed device buffers
+        # (sampler state, speculative buffers, mamba cache) touching a small
+        # contiguous prefix and makes slot assignment deterministic across
+        # runs instead of following set iteration order.
+        self.free_slots = list(range(max_num_requests))
 
     def get_slot(self, request_id: int):
         return self.slot_mapping.get(request_id, None)
@@ -2902,14 +2911,14 @@ class SlotManager:
 
         if len(self.free_slots) == 0:
             raise ValueError("No free slots")
-        slot = self.free_slots.pop()
+        slot = heapq.heappop(self.free_slots)
         self.slot_mapping[request_id] = slot
         return slot
 
     def remove_slot(self, request_id: int):
         if request_id in self.slot_mapping:
             slot = self.slot_mapping.pop(request_id)
-            self.free_slots.add(slot)
+            heapq.heappush(self.free_slots, slot)
 
     def shutdown(self):
         req_ids_list = list(self.slot_mapping.keys())
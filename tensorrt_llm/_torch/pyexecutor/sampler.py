@@ -77,6 +77,7 @@ from ..flashinfer_utils import IS_FLASHINFER_AVAILABLE
 from ..speculative.interface import get_force_num_accepted_tokens
 from ..speculative.spec_tree_manager import SpecTreeManager
 from .finish_reason import FinishedState
+from .kernel_ab_experiment import KernelABExperiment
 from .llm_request import LlmRequest, LlmRequestState, get_draft_token_length
 from .resource_manager import ResourceManager, ResourceManagerType
 from .sampling_utils import (
@@ -2151,10 +2152,16 @@ class TorchSampler(Sampler[SampleStateTorch], AsyncWorkerMixin):
         self._grouped_sampler_cls: (
             Type["FlashInferGroupedStrategySampler"] | Type[SimpleGroupedStrategySampler]
         )
+        # A/B experiment between the FlashInfer (A) and torch reference (B) grouped
+        # samplers; only meaningful when FlashInfer is selected as the default.
+        self._sampler_ab_experiment: KernelABExperiment | None = None
         if IS_FLASHINFER_AVAILABLE and not args.disable_flashinfer_sampling:
             from .sampling_utils_flashinfer import FlashInferGroupedStrategySampler
 
             self._grouped_sampler_cls = FlashInferGroupedStrategySampler
+            self._sampler_ab_experiment = KernelABExperiment.from_env(
+                "grouped_sampler_flashinfer_vs_torch"
+            )
         else:
             self._grouped_sampler_cls = SimpleGroupedStrategySampler
 
@@ -2246,24 +2253,44 @@ class TorchSampler(Sampler[SampleStateTorch], AsyncWorkerMixin):
         )
 
     @staticmethod
+    def _stop_words_meta(request: LlmRequest) -> tuple[int, frozenset[int] | None]:
+        """Return (max stop word length, single-token stop set) for a request.
+
+        The stop word list is fixed for the lifetime of a request while this is
+        consulted for every generated token, so the derived values are memoized
+        on the request, keyed by the identity of `py_stop_words_list`.
+        """
+        words = request.py_stop_words_list
+        meta = getattr(request, "_py_stop_words_meta", None)
+        if meta is not None and meta[0] is words:
+            return meta[1], meta[2]
+        tokens, prefix_sum = words
+        if -1 in prefix_sum:
+            prefix_sum = prefix_sum[: prefix_sum.index(-1)]
+        max_stop_word_length = prefix_sum[0] if prefix_sum else 0
+        for i in range(1, len(prefix_sum)):
+            word_length = prefix_sum[i] - prefix_sum[i - 1]
+            max_stop_word_length = max(max_stop_word_length, word_length)
+        single_token_stops = (
+            frozenset(tokens[: len(prefix_sum)]) if max_stop_word_length == 1 else None
+        )
+        request._py_stop_words_meta = (words, max_stop_word_length, single_token_stops)
+        return max_stop_word_length, single_token_stops
+
+    @classmethod
     def _meet_stop_token_criteria(
-        request: LlmRequest, new_token: int, beam_idx: int = DEFAULT_BEAM_IDX
+        cls, request: LlmRequest, new_token: int, beam_idx: int = DEFAULT_BEAM_IDX
     ) -> bool:
         if request.py_stop_words_list:
             assert isinstance(request.py_stop_words_list, list), (
                 "request.py_stop_words_list should be a list"
             )
             stop_words_list, prefix_sum = request.py_stop_words_list
-
-            # Determine max stop word length to decide optimization path
-            max_stop_word_length = prefix_sum[0] if prefix_sum else 0
-            for i in range(1, len(prefix_sum)):
-                word_length = prefix_sum[i] - prefix_sum[i - 1]
-                max_stop_word_length = max(max_stop_word_length, word_length)
+            max_stop_word_length, single_token_stops = cls._stop_words_meta(request)
 
             # Fast path: all stop words are single tokens
             if max_stop_word_length == 1:
-                return new_token in stop_words_list
+                return new_token in single_token_stops
 
             # Slow path: at least one multi-token stop word exists
             tokens = request.get_tokens(beam_idx)
@@ -3634,10 +3661,22 @@ class TorchSampler(Sampler[SampleStateTorch], AsyncWorkerMixin):
     ) -> _BatchedSamplingResult:
         cuda_device = logits_cuda.device
 
+        # When an A/B experiment is active, route this invocation to either the
+        # default grouped sampler (A) or the torch reference sampler (B). The
+        # variant is chosen per batched invocation, because grouping, metadata
+        # and sampling must all come from the same implementation.
+        grouped_sampler_cls = self._grouped_sampler_cls
+        ab_experiment = self._sampler_ab_experiment
+        if ab_experiment is not None:
+            use_variant_b = ab_experiment.use_variant_b()
+            if use_variant_b:
+                grouped_sampler_cls = SimpleGroupedStrategySampler
+            ab_experiment.begin(use_variant_b)
+
         grouped_requests = self._request_grouper.group_requests_by_strategy_key(
             requests,
             pin_memory=prefer_pinned(),
-            strategy_to_key=self._grouped_sampler_cls.strategy_grouping_key,
+            strategy_to_key=grouped_sampler_cls.strategy_grouping_key,
             seq_slots=seq_slots,
             vocab_size=logits_cuda.size(1),  # Dummy value; strategy should already be cached
         )
@@ -3646,7 +3685,7 @@ class TorchSampler(Sampler[SampleStateTorch], AsyncWorkerMixin):
             grouped_requests,
             seq_slots,
             seq_lens,
-            get_metadata_type_for_group_fn=self._grouped_sampler_cls.get_metadata_type_for_group,
+            get_metadata_type_for_group_fn=grouped_sampler_cls.get_metadata_type_for_group,
         )
         generator_cuda = self.get_generator(cuda_device)
 
@@ -3770,7 +3809,7 @@ class TorchSampler(Sampler[SampleStateTorch], AsyncWorkerMixin):
             ]
 
             group_next_tokens_cuda, group_softmax_cuda, group_temperature_cuda = (
-                self._grouped_sampler_cls.sample_grouped_strategies(
+                grouped_sampler_cls.sample_grouped_strategies(
                     strategy_key,
                     group_strategies_per_step,
                     group_logits_cuda,
@@ -3867,6 +3906,9 @@ class TorchSampler(Sampler[SampleStateTorch], AsyncWorkerMixin):
         if needs_d2t:
             self._apply_d2t(batch_next_tokens_cuda_int, model_outputs)
 
+        if ab_experiment is not None:
+            ab_experiment.end()
+
         return _BatchedSamplingResult(
             batch_req_indices=batch_req_indices,
             batch_next_tokens_cuda_int=batch_next_tokens_cuda_int,
@@ -107,7 +107,6 @@ class ADPRouter(ABC):
 
         return DefaultADPRouter(dist=dist)
 
-    @abstractmethod
     def create_rank_state(
         self,
         active_requests: list[LlmRequest],
@@ -115,6 +114,12 @@ class ADPRouter(ABC):
     ) -> RankState:
         """Create local RankState from current rank's active and new requests.
 
+        num_active_tokens counts live tokens (prompt plus tokens generated so
+        far) rather than only the original prompt length: decoding grows a
+        request's KV footprint and per-step attention cost every iteration,
+        so prompt-only accounting makes a rank full of long-running
+        generations look as lightly loaded as a freshly started one.
+
         Args:
             active_requests: Currently active LlmRequests on this rank.
             new_requests: New requests popped from the waiting queue.
@@ -122,7 +127,21 @@ class ADPRouter(ABC):
         Returns:
             RankState for this rank, to be serialized and allgathered.
         """
-        raise NotImplementedError
+        if self.dist.has_cp_helix:
+            # Helix partitions the prompt across CP ranks, so
+            # max_beam_num_tokens only covers this rank's slice; use the full
+            # context length plus the tokens generated since admission.
+            num_active_tokens = sum(
+                req.total_input_len_cp + (req.max_beam_num_tokens - req.py_prompt_len)
+                for req in active_requests
+            )
+        else:
+            num_active_tokens = sum(req.max_beam_num_tokens for req in active_requests)
+        return RankState(
+            rank=self.dist.tp_rank,
+            num_active_requests=len(active_requests),
+            num_active_tokens=num_active_tokens,
+        )
 
     def gather_all_rank_states(
         self,
@@ -180,21 +199,6 @@ class DefaultADPRouter(ADPRouter):
            (descending) for better load balancing.
     """
 
-    def create_rank_state(
-        self,
-        active_requests: list[LlmRequest],
-        new_requests: list[RequestQueueItem],
-    ) -> RankState:
-        if self.dist.has_cp_helix:
-            num_active_tokens = sum(req.total_input_len_cp for req in active_requests)
-        else:
-            num_active_tokens = sum(req.py_orig_prompt_len for req in active_requests)
-        return RankState(
-            rank=self.dist.tp_rank,
-            num_active_requests=len(active_requests),
-            num_active_tokens=num_active_tokens,
-        )
-
     def route_requests(
         self,
         all_rank_states: list[RankState],
@@ -349,21 +353,6 @@ class KVCacheAwareADPRouter(ADPRouter):
         self.load_balance_weight = load_balance_weight
         self._all_ranks_prefix_matches: List[Dict[int, int]] = []
 
-    def create_rank_state(
-        self,
-        active_requests: list[LlmRequest],
-        new_requests: list[RequestQueueItem],
-    ) -> RankState:
-        if self.dist.has_cp_helix:
-            num_active_tokens = sum(req.total_input_len_cp for req in active_requests)
-        else:
-            num_active_tokens = sum(req.py_orig_prompt_len for req in active_requests)
-        return RankState(
-            rank=self.dist.tp_rank,
-            num_active_requests=len(active_requests),
-            num_active_tokens=num_active_tokens,
-        )
-
     def gather_prefix_matches(
         self,
         new_requests: list[RequestQueueItem],
@@ -79,7 +79,15 @@ class ScheduledRequests:
         return self.context_requests_chunking + self.context_requests_last_chunk
 
     def all_requests(self) -> RequestList:
-        return self.context_requests + self.generation_requests
+        # Build the combined list in one pass instead of going through the
+        # `context_requests` property, which would materialize an intermediate
+        # list just to concatenate it again. This method is called several
+        # times per executor iteration.
+        return [
+            *self.context_requests_chunking,
+            *self.context_requests_last_chunk,
+            *self.generation_requests,
+        ]
 
     def append_context_request(self, request: LlmRequest) -> None:
         if request.is_last_context_chunk:
@@ -588,21 +596,30 @@ class PyMicroBatchScheduler(MicroBatchScheduler):
                 return (0, 0)  # (has_value=False, value=0) - comes first
             return (1, lora_id)  # (has_value=True, value) - sorted by value
 
+        def sort_by_lora_id(requests: RequestList) -> None:
+            # In the common no-LoRA case every key is equal and the sort is a
+            # semantic no-op; skip the O(n log n) pass (mirrors sortRequests in
+            # inflightBatchingUtils.cpp).
+            if any(
+                getattr(req, "lora_task_id", None) is not None for req in requests
+            ):
+                requests.sort(key=get_lora_task_id)
+
         if chunks_present:
             # Partition: non-last-chunk first, last-chunk at end
             not_last_chunk = [r for r in context_requests if not r.is_last_context_chunk]
             last_chunk = [r for r in context_requests if r.is_last_context_chunk]
             # Sort each group by lora_task_id
-            not_last_chunk.sort(key=get_lora_task_id)
-            last_chunk.sort(key=get_lora_task_id)
+            sort_by_lora_id(not_last_chunk)
+            sort_by_lora_id(last_chunk)
             # Rebuild the list in-place
             context_requests.clear()
             context_requests.extend(not_last_chunk)
             context_requests.extend(last_chunk)
         else:
-            context_requests.sort(key=get_lora_task_id)
+            sort_by_lora_id(context_requests)
 
-        generation_requests.sort(key=get_lora_task_id)
+        sort_by_lora_id(generation_requests)
 
     def _set_ctx_requests_chunk_size(
         self,
@@ -641,8 +658,63 @@ class PyMicroBatchScheduler(MicroBatchScheduler):
 
         capacity is a compute-token budget (non-reusable only). Tokens covered by the reusable
         KV-cache prefix are not charged against it.
+
+        Simulating the rounds one unit_size at a time costs O(longest_context / unit_size)
+        passes over the request list per scheduling call. After r complete rounds every
+        request's chunk is simply min(r * unit_size, cap), where cap folds in the remaining
+        context length and max_context_length, so the aggregate compute after r rounds is a
+        monotone closed form. We binary-search the largest complete round count that fits
+        the budget and jump straight to that state; while complete rounds fit in aggregate,
+        the per-request capacity check can never fire mid-round, so this is exactly
+        equivalent. Only the final partial round is simulated with the original loop,
+        which then terminates in a few passes.
         """
-        num_compute_tokens = 0
+        if not requests:
+            return
+
+        caps = []
+        reusables = []
+        remainings = []
+        max_rounds = 0
+        for req in requests:
+            remaining = req.context_remaining_length
+            cap = remaining
+            if self.max_context_length is not None and remaining > self.max_context_length:
+                # Chunks are offered in unit_size steps and any step whose clamped size
+                # exceeds max_context_length is rejected, so the reachable cap is the
+                # largest unit-aligned size within the limit.
+                cap = (self.max_context_length // unit_size) * unit_size
+            caps.append(cap)
+            reusables.append(
+                min(
+                    req.estimated_reusable_tokens if req.is_first_context_chunk else 0,
+                    remaining,
+                )
+            )
+            remainings.append(remaining)
+            max_rounds = max(max_rounds, -(-cap // unit_size))
+
+        def consumed_after(rounds: int) -> int:
+            return sum(
+                _reuse_adjusted_compute(min(rounds * unit_size, cap), reusable, remaining)
+                for cap, reusable, remaining in zip(caps, reusables, remainings)
+            )
+
+        complete_rounds = max_rounds
+        if capacity is not None:
+            lo, hi = 0, max_rounds
+            while lo < hi:
+                mid = lo + (hi - lo + 1) // 2
+                if consumed_after(mid) <= capacity:
+                    lo = mid
+                else:
+                    hi = mid - 1
+            complete_rounds = lo
+
+        for req, cap in zip(requests, caps):
+            req.context_chunk_size = min(complete_rounds * unit_size, cap)
+
+        num_compute_tokens = consumed_after(complete_rounds)
         num_tokens_single_loop = 1
 
         # C++ Loop: while ((!capacity || numCtxTokens < capacity) && numTokensSingleLoop)
@@ -899,7 +899,8 @@ class ModelDrafter(Drafter):
         # This enables overlap scheduling: process old batch while new batch is prepared
         self._process_previous_draft_results(resource_manager)
 
-        num_draft_reqs = len(draft_batch.all_requests())
+        draft_requests = draft_batch.all_requests()
+        num_draft_reqs = len(draft_requests)
         if self.use_static_draft_loop:
             # Only update target inputs, cleanup will be done in executor loop
             self._update_draft_tokens_for_target_inputs(
@@ -915,7 +916,7 @@ class ModelDrafter(Drafter):
             sampler_event.record()
 
             sample_state = SampleState(
-                requests=draft_batch.all_requests(),
+                requests=draft_requests,
                 device=SampleStateTensors(
                     new_tokens=outputs["new_draft_tokens"]),
                 host=SampleStateTensors(new_tokens=new_tokens_host),
@@ -420,9 +420,15 @@ class SpecTreeManager:
             raise RuntimeError(
                 "compute_spec_dec_mask_matrix() is not supported in dynamic tree mode"
             )
-        for i, path in enumerate(self.eagle_paths[0]):
-            indices = path[path > -1]
-            self.spec_dec_mask_matrix[0][i, indices] = 1
+        # Scatter all path entries with a single indexed write instead of a Python loop
+        # issuing one small H2D index copy per tree row, so (re)configuring the tree does
+        # not serialize on the host.
+        paths = self.eagle_paths[0]
+        valid = paths > -1
+        rows = torch.arange(paths.shape[0]).unsqueeze(1).expand_as(paths)[valid]
+        cols = paths[valid].to(torch.int64)
+        mask = self.spec_dec_mask_matrix[0]
+        mask[rows.to(mask.device), cols.to(mask.device)] = 1
 
     def compute_spec_dec_packed_mask(self, mask_matrix, packed_mask):
         bs, num_tokens, num_tokens_attend = mask_matrix.shape
@@ -0,0 +1,194 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+SageAttention Calibration Cache
+
+Per-layer auto-calibration for SageAttention INT8 QK quantization. A short
+calibration window measures the Q/K activation statistics of each attention
+layer and decides whether INT8 QK is numerically safe for it; decisions are
+persisted to an on-disk JSON cache keyed by (model, layer, head-group) so
+subsequent runs skip calibration entirely. A runtime guardrail periodically
+re-checks the observed ranges and falls the layer back to the non-INT8 path
+when they drift beyond the calibrated envelope.
+"""
+
+import json
+import os
+import threading
+from functools import lru_cache
+from pathlib import Path
+from typing import Optional
+
+import torch
+
+from tensorrt_llm.logger import logger
+
+# INT8 QK is considered safe when the crest factor (amax / rms) of both Q and
+# K stays below this bound. Per-block scaling absorbs smooth range variation,
+# but strong within-block outliers exhaust the 8-bit grid.
+DEFAULT_CREST_FACTOR_THRESHOLD = 64.0
+# Runtime amax may exceed the calibrated amax by this factor before the
+# guardrail trips.
+DEFAULT_GUARDRAIL_MARGIN = 2.0
+
+
+class SageCalibrationCache:
+    """Disk-backed cache of per-layer SageAttention calibration records.
+
+    One JSON file per model key, holding one record per (layer, head-group).
+    Writes go through a temp file plus rename so concurrent processes never
+    observe a torn file. A missing or unreadable cache simply means every
+    layer recalibrates.
+    """
+
+    def __init__(self, cache_dir: str, model_key: str):
+        self._path = Path(cache_dir) / f"sage_calib_{model_key}.json"
+        self._lock = threading.Lock()
+        self._records = self._load()
+
+    @staticmethod
+    def resolve_cache_dir(cache_dir: Optional[str] = None) -> Optional[str]:
+        """Resolve the cache directory from the argument or the environment."""
+        return cache_dir or os.environ.get("TRTLLM_SAGE_CALIB_CACHE_DIR") or None
+
+    @staticmethod
+    def record_key(layer_idx: int, num_heads: int, num_kv_heads: int, head_dim: int) -> str:
+        return f"layer{layer_idx}_h{num_heads}_kv{num_kv_heads}_d{head_dim}"
+
+    def _load(self) -> dict:
+        try:
+            with open(self._path) as f:
+                return json.load(f)
+        except FileNotFoundError:
+            return {}
+        except (OSError, json.JSONDecodeError) as e:
+            logger.warning(f"Ignoring unreadable SageAttention calibration cache {self._path}: {e}")
+            return {}
+
+    def get(self, key: str) -> Optional[dict]:
+        with self._lock:
+            return self._records.get(key)
+
+    def put(self, key: str, record: dict) -> None:
+        with self._lock:
+            self._records[key] = record
+            try:
+                self._path.parent.mkdir(parents=True, exist_ok=True)
+                tmp_path = self._path.with_suffix(f".tmp.{os.getpid()}")
+                with open(tmp_path, "w") as f:
+                    json.dump(self._records, f, indent=2, sort_keys=True)
+                tmp_path.replace(self._path)
+            except OSError as e:
+                # Persistence is best-effort; the in-memory record still applies.
+                logger.warning(f"Failed to persist SageAttention calibration cache {self._path}: {e}")
+
+
+@lru_cache(maxsize=None)
+def get_calibration_cache(cache_dir: str, model_key: str) -> SageCalibrationCache:
+    """Return the process-wide cache instance so all layers share one file."""
+    return SageCalibrationCache(cache_dir, model_key)
+
+
+class SageLayerCalibrator:
+    """Decides per call whether one attention layer may run INT8 QK.
+
+    With no cached record, the first ``calib_steps`` calls measure Q/K amax
+    and crest factor, then the decision is persisted. With a cached record,
+    calibration is skipped and only the guardrail remains: every
+    ``recheck_interval`` calls the current amax is compared against the
+    calibrated envelope, and a violation permanently falls the layer back to
+    the non-INT8 path (and updates the cache so future runs start safe).
+
+    The statistics reductions synchronize with the GPU, so they only run
+    during calibration and on recheck steps.
+    """
+
+    def __init__(
+        self,
+        cache: SageCalibrationCache,
+        key: str,
+        calib_steps: int = 8,
+        recheck_interval: int = 64,
+        crest_factor_threshold: float = DEFAULT_CREST_FACTOR_THRESHOLD,
+        guardrail_margin: float = DEFAULT_GUARDRAIL_MARGIN,
+    ):
+        self._cache = cache
+        self._key = key
+        self._calib_steps = calib_steps
+        self._recheck_interval = recheck_interval
+        self._crest_factor_threshold = crest_factor_threshold
+        self._guardrail_margin = guardrail_margin
+        self._step = 0
+        self._record = cache.get(key)
+        if self._record is not None:
+            logger.debug(f"SageAttention calibration cache hit for {key}: {self._record}")
+
+    @staticmethod
+    def _measure(t: torch.Tensor) -> tuple:
+        t = t.float()
+        amax = t.abs().amax().item()
+        rms = t.square().mean().sqrt().item()
+        return amax, amax / max(rms, torch.finfo(torch.float32).tiny)
+
+    def observe(self, q: torch.Tensor, k: torch.Tensor) -> bool:
+        """Record statistics for this call and return whether INT8 QK may be used."""
+        self._step += 1
+        if self._record is None:
+            q_amax, q_crest = self._measure(q)
+            k_amax, k_crest = self._measure(k)
+            pending = getattr(self, "_pending", None)
+            if pending is None:
+                pending = {"q_amax": 0.0, "k_amax": 0.0, "q_crest": 0.0, "k_crest": 0.0}
+            pending["q_amax"] = max(pending["q_amax"], q_amax)
+            pending["k_amax"] = max(pending["k_amax"], k_amax)
+            pending["q_crest"] = max(pending["q_crest"], q_crest)
+            pending["k_crest"] = max(pending["k_crest"], k_crest)
+            self._pending = pending
+            if self._step >= self._calib_steps:
+                int8_ok = (
+                    pending["q_crest"] <= self._crest_factor_threshold
+                    and pending["k_crest"] <= self._crest_factor_threshold
+                )
+                self._record = dict(pending, int8_ok=int8_ok)
+                self._cache.put(self._key, self._record)
+                if not int8_ok:
+                    logger.info(
+                        f"SageAttention INT8 QK disabled for {self._key}: crest factor "
+                        f"q={pending['q_crest']:.1f} k={pending['k_crest']:.1f} exceeds "
+                        f"{self._crest_factor_threshold}"
+                    )
+            # Run the calibration window in the safe non-INT8 path.
+            return False
+
+        if not self._record["int8_ok"]:
+            return False
+
+        if self._step % self._recheck_interval == 0:
+            q_amax, _ = self._measure(q)
+            k_amax, _ = self._measure(k)
+            if (
+                q_amax > self._record["q_amax"] * self._guardrail_margin
+                or k_amax > self._record["k_amax"] * self._guardrail_margin
+            ):
+                logger.warning(
+                    f"SageAttention INT8 QK guardrail tripped for {self._key}: observed "
+                    f"amax q={q_amax:.3g} k={k_amax:.3g} outside the calibrated envelope "
+                    f"(q={self._record['q_amax']:.3g} k={self._record['k_amax']:.3g}); "
+                    "falling back to the non-INT8 path for this layer."
+                )
+                self._record = dict(self._record, int8_ok=False)
+                self._cache.put(self._key, self._record)
+                return False
+        return True
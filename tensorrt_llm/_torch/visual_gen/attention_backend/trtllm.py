@@ -1,4 +1,4 @@
-# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
@@ -30,6 +30,7 @@ from ...attention_backend.interface import AttentionRuntimeFeatures, PredefinedA
 from ...attention_backend.trtllm import TrtllmAttention as BaseTrtllmAttention
 from ...attention_backend.trtllm import TrtllmAttentionMetadata as BaseTrtllmAttentionMetadata
 from .interface import AttentionBackend, AttentionTensorLayout
+from .sage_calibration import SageCalibrationCache, SageLayerCalibrator, get_calibration_cache
 
 
 class TrtllmAttentionMetadata:
@@ -183,7 +184,9 @@ class TrtllmAttention(BaseTrtllmAttention, AttentionBackend):
         sage_attn_num_elts_per_blk_q: int = 0,
         sage_attn_num_elts_per_blk_k: int = 0,
         sage_attn_num_elts_per_blk_v: int = 0,
-        sage_attn_qk_int8: bool = False,
+        sage_attn_qk_int8: Union[bool, str] = False,
+        sage_attn_calib_cache_dir: Optional[str] = None,
+        sage_attn_calib_model_key: Optional[str] = None,
     ):
         num_kv_heads = num_kv_heads or num_heads
 
@@ -199,12 +202,25 @@ class TrtllmAttention(BaseTrtllmAttention, AttentionBackend):
         self.sage_attn_num_elts_per_blk_q = sage_attn_num_elts_per_blk_q
         self.sage_attn_num_elts_per_blk_k = sage_attn_num_elts_per_blk_k
         self.sage_attn_num_elts_per_blk_v = sage_attn_num_elts_per_blk_v
-        self.sage_attn_qk_int8 = sage_attn_qk_int8
         self._use_sage_attn = (
             sage_attn_num_elts_per_blk_q > 0
             or sage_attn_num_elts_per_blk_k > 0
             or sage_attn_num_elts_per_blk_v > 0
         )
+        # "auto" calibrates whether INT8 QK is safe for this layer, persisting
+        # the decision to the on-disk cache and guarding it at runtime.
+        self._sage_calibrator: Optional[SageLayerCalibrator] = None
+        if sage_attn_qk_int8 == "auto":
+            self.sage_attn_qk_int8 = False
+            cache_dir = SageCalibrationCache.resolve_cache_dir(sage_attn_calib_cache_dir)
+            if self._use_sage_attn and cache_dir is not None:
+                model_key = sage_attn_calib_model_key or "default"
+                key = SageCalibrationCache.record_key(layer_idx, num_heads, num_kv_heads, head_dim)
+                self._sage_calibrator = SageLayerCalibrator(
+                    get_calibration_cache(cache_dir, model_key), key
+                )
+        else:
+            self.sage_attn_qk_int8 = bool(sage_attn_qk_int8)
 
         # TRTLLM expects flat [B*S, H*D] format
         self._preferred_layout = AttentionTensorLayout.NHD
@@ -282,6 +298,9 @@ class TrtllmAttention(BaseTrtllmAttention, AttentionBackend):
             q_flat = q.reshape(batch_size * seq_len, -1)
             k_flat = k.reshape(batch_size * kv_seq_len, -1)
             v_flat = v.reshape(batch_size * kv_seq_len, -1)
+            qk_int8 = self.sage_attn_qk_int8
+            if self._sage_calibrator is not None:
+                qk_int8 = self._sage_calibrator.observe(q_flat, k_flat)
             output = super().forward(
                 q=q_flat,
                 k=k_flat,
@@ -291,7 +310,7 @@ class TrtllmAttention(BaseTrtllmAttention, AttentionBackend):
                 sage_attn_num_elts_per_blk_q=self.sage_attn_num_elts_per_blk_q,
                 sage_attn_num_elts_per_blk_k=self.sage_attn_num_elts_per_blk_k,
                 sage_attn_num_elts_per_blk_v=self.sage_attn_num_elts_per_blk_v,
-                sage_attn_qk_int8=self.sage_attn_qk_int8,
+                sage_attn_qk_int8=qk_int8,
             )
         else:
             if k is None and v is None:
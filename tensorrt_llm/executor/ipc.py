@@ -6,7 +6,7 @@ import pickle  # nosec B403
 import threading
 import time
 import traceback
-from queue import Queue
+from queue import Empty, Queue
 from typing import Any, Optional
 
 import zmq
@@ -187,8 +187,8 @@ class ZeroMqQueue:
         with nvtx_range_debug("send", color="blue", category="IPC"):
             if self.use_hmac_encryption or self.socket_type == zmq.ROUTER:
                 # Need manual serialization for encryption or ROUTER multipart
-                data = self._prepare_data(obj)
-                self._send_data(data, routing_id=routing_id)
+                frames = self._prepare_data(obj)
+                self._send_data(frames, routing_id=routing_id)
             else:
                 # Standard socket without encryption - use pyobj directly
                 self.socket.send_pyobj(obj)
@@ -214,9 +214,9 @@ class ZeroMqQueue:
         self._check_thread_safety()
         with nvtx_range_debug("send", color="blue", category="IPC"):
 
-            data = self._prepare_data(obj)
+            frames = self._prepare_data(obj)
             try:
-                self._send_data(data, flags=zmq.NOBLOCK)
+                self._send_data(frames, flags=zmq.NOBLOCK)
             except zmq.Again:
                 if retry > 0:
                     time.sleep(wait_time)
@@ -230,8 +230,8 @@ class ZeroMqQueue:
         try:
             if self.use_hmac_encryption or self.socket_type == zmq.ROUTER:
                 # Need manual serialization for encryption or ROUTER multipart
-                data = self._prepare_data(obj)
-                await self._send_data_async(data, routing_id=routing_id)
+                frames = self._prepare_data(obj)
+                await self._send_data_async(frames, routing_id=routing_id)
             else:
                 # Standard socket without encryption
                 await self.socket.send_pyobj(obj)
@@ -250,9 +250,8 @@ class ZeroMqQueue:
         self._check_thread_safety()
         try:
             if self.use_hmac_encryption:
-                data = pickle.dumps(obj)  # nosec B301
-                signed_data = self._sign_data(data)
-                await self.socket.send(signed_data, flags=zmq.NOBLOCK)
+                frames = self._prepare_data(obj)
+                await self.socket.send_multipart(frames, flags=zmq.NOBLOCK)
             else:
                 await self.socket.send_pyobj(obj, flags=zmq.NOBLOCK)
         except Exception as e:
@@ -298,18 +297,19 @@ class ZeroMqQueue:
             try:
                 # Try non-blocking receive
                 if self.socket_type == zmq.ROUTER:
-                    identity, data = await self.socket.recv_multipart(
+                    identity, *frames = await self.socket.recv_multipart(
                         flags=zmq.NOBLOCK)
                     self._last_identity = identity
-                    obj = self._parse_data(data)
+                    obj = self._parse_data(frames)
                     if return_identity:
                         return obj, identity
                     else:
                         return obj
                 else:
                     if self.use_hmac_encryption:
-                        data = await self.socket.recv(flags=zmq.NOBLOCK)
-                        obj = self._parse_data(data)
+                        frames = await self.socket.recv_multipart(
+                            flags=zmq.NOBLOCK)
+                        obj = self._parse_data(frames)
                     else:
                         obj = await self.socket.recv_pyobj(flags=zmq.NOBLOCK)
 
@@ -349,26 +349,32 @@ class ZeroMqQueue:
 
     def _sign_data(self, data_before_encoding: bytes) -> bytes:
         """Generate HMAC for data."""
-        hmac_signature = hmac.new(self.hmac_key, data_before_encoding,
-                                  hashlib.sha256).digest()
-        return data_before_encoding + hmac_signature
+        return hmac.new(self.hmac_key, data_before_encoding,
+                        hashlib.sha256).digest()
 
     def __del__(self):
         self.close()
 
-    def _prepare_data(self, obj: Any) -> bytes:
-        """Serialize object and optionally add HMAC signature."""
+    def _prepare_data(self, obj: Any) -> list[bytes]:
+        """Serialize object into message frames, with optional HMAC signature.
+
+        The signature travels as a separate ZMQ frame so that the pickled
+        payload is never copied into a concatenated buffer; for large
+        payloads (logits, multimodal data) that copy dominates send cost.
+        """
         data = pickle.dumps(obj)  # nosec B301
         if self.use_hmac_encryption:
-            return self._sign_data(data)
-        return data
+            return [data, self._sign_data(data)]
+        return [data]
 
-    def _parse_data(self, data: bytes) -> Any:
-        """Parse data and optionally verify HMAC signature."""
+    def _parse_data(self, frames: list[bytes]) -> Any:
+        """Parse message frames and optionally verify HMAC signature."""
         if self.use_hmac_encryption:
-            # Split data and HMAC
-            message_data = data[:-32]
-            actual_hmac = data[-32:]
+            if len(frames) != 2:
+                raise RuntimeError(
+                    f"Expected [payload, hmac] frames, got {len(frames)} frames"
+                )
+            message_data, actual_hmac = frames
 
             # Verify HMAC
             if not self._verify_hmac(message_data, actual_hmac):
@@ -376,46 +382,46 @@ class ZeroMqQueue:
 
             return pickle.loads(message_data)  # nosec B301
         else:
-            return pickle.loads(data)  # nosec B301
+            return pickle.loads(frames[0])  # nosec B301
 
     def _send_data(self,
-                   data: bytes,
+                   frames: list[bytes],
                    flags: int = 0,
                    routing_id: Optional[bytes] = None):
-        """Send data using appropriate API based on socket type."""
+        """Send message frames using appropriate API based on socket type."""
         if self.socket_type == zmq.ROUTER:
             identity = routing_id if routing_id is not None else self._last_identity
             if identity is None:
                 raise ValueError("ROUTER socket requires identity")
-            self.socket.send_multipart([identity, data], flags=flags)
+            self.socket.send_multipart([identity, *frames], flags=flags)
         else:
-            self.socket.send(data, flags=flags)
+            self.socket.send_multipart(frames, flags=flags)
 
     async def _send_data_async(self,
-                               data: bytes,
+                               frames: list[bytes],
                                routing_id: Optional[bytes] = None):
         """Async version of _send_data."""
         if self.socket_type == zmq.ROUTER:
             identity = routing_id if routing_id is not None else self._last_identity
             if identity is None:
                 raise ValueError("ROUTER socket requires identity")
-            await self.socket.send_multipart([identity, data])
+            await self.socket.send_multipart([identity, *frames])
         else:
-            await self.socket.send(data)
+            await self.socket.send_multipart(frames)
 
     def _recv_data(self, return_identity: bool = False) -> Any:
         """Receive data using appropriate API based on socket type."""
         if self.socket_type == zmq.ROUTER:
-            identity, data = self.socket.recv_multipart()
+            identity, *frames = self.socket.recv_multipart()
             self._last_identity = identity  # Store for replies
-            obj = self._parse_data(data)
+            obj = self._parse_data(frames)
             if return_identity:
                 return obj, identity
             return obj
         else:
             if self.use_hmac_encryption:
-                data = self.socket.recv()
-                obj = self._parse_data(data)
+                frames = self.socket.recv_multipart()
+                obj = self._parse_data(frames)
             else:
                 obj = self.socket.recv_pyobj()
 
@@ -426,16 +432,16 @@ class ZeroMqQueue:
     async def _recv_data_async(self, return_identity: bool = False) -> Any:
         """Async version of _recv_data."""
         if self.socket_type == zmq.ROUTER:
-            identity, data = await self.socket.recv_multipart()
+            identity, *frames = await self.socket.recv_multipart()
             self._last_identity = identity  # Store for replies
-            obj = self._parse_data(data)
+            obj = self._parse_data(frames)
             if return_identity:
                 return obj, identity
             return obj
         else:
             if self.use_hmac_encryption:
-                data = await self.socket.recv()
-                obj = self._parse_data(data)
+                frames = await self.socket.recv_multipart()
+                obj = self._parse_data(frames)
             else:
                 obj = await self.socket.recv_pyobj()
 
@@ -509,18 +515,24 @@ class FusedIpcQueue:
             return
 
         def send_task():
-            while True:
-                qsize = self.sending_queue.qsize()
-                if qsize > 0:
-                    qsize = min(self.fuse_size, qsize)
-                    self._obj_counter += qsize
-                    message = [
-                        self.sending_queue.get_nowait() for _ in range(qsize)
-                    ]
-                    self.queue.put(message)
-                    self._message_counter += 1
-                else:
-                    time.sleep(0.001)
+            # Block on the first object instead of polling with a fixed
+            # sleep: objects are forwarded as soon as they arrive, and
+            # whatever accumulated while the previous batch was on the wire
+            # is drained into the same message. Returning after each batch
+            # lets ManagedThread honor its stop event.
+            try:
+                message = [self.sending_queue.get(timeout=0.1)]
+            except Empty:
+                return True
+            while len(message) < self.fuse_size:
+                try:
+                    message.append(self.sending_queue.get_nowait())
+                except Empty:
+                    break
+            self._obj_counter += len(message)
+            self.queue.put(message)
+            self._message_counter += 1
+            return True
 
         self._send_thread = ManagedThread(send_task,
                                           name="fused_send_thread",
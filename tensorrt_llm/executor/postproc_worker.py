@@ -161,11 +161,21 @@ class PostprocWorker:
                 out = result_handler(record, args)
             else:
                 # This should only be called in streaming mode, and each time it
-                # produces a single output.
+                # produces a single output. Ship only the diff of the output so
+                # the payload stays proportional to the new tokens; the client
+                # re-accumulates in GenerationResultBase._apply_output_diff.
+                from .result import CompletionOutputDiff
                 out = record.outputs[0]
+                if getattr(record, "_streaming", False) and len(
+                        record._outputs) == 1:
+                    include_prompt_logprobs = bool(
+                        out.prompt_logprobs) and not getattr(
+                            record, "_prompt_logprobs_sent", False)
+                    if include_prompt_logprobs:
+                        record._prompt_logprobs_sent = True
+                    out = CompletionOutputDiff.from_output(
+                        out, include_prompt_logprobs)
 
-            # TODO: Keep only the diff token_ids and text in streaming mode when
-            # result_handler is not set
             return out, metrics_dict, perf_metrics, disaggregated_params
 
     async def _batched_put(self):
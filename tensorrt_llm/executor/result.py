@@ -161,6 +161,52 @@ class CompletionOutput:
         return self.logprobs[self._last_logprobs_len:]
 
 
+@dataclass(slots=True)
+class CompletionOutputDiff:
+    """A per-chunk delta of a CompletionOutput.
+
+    Postprocess workers ship this in streaming mode instead of the whole
+    accumulated CompletionOutput, so the per-chunk IPC payload stays
+    proportional to the new tokens rather than the response so far.
+
+    The rewind fields handle stop-string/stop-word trimming that crosses a
+    chunk boundary: they tell the client how many trailing chars/entries of
+    its accumulated state the worker retracted before this diff applies.
+    """
+    index: int
+    text_diff: str = ""
+    token_ids_diff: List[int] = field(default_factory=list)
+    logprobs_diff: TokenLogprobs | List[float] = field(default_factory=list)
+    text_rewind: int = 0
+    token_ids_rewind: int = 0
+    logprobs_rewind: int = 0
+    cumulative_logprob: Optional[float] = None
+    prompt_logprobs: Optional[TokenLogprobs] = None
+    finish_reason: Optional[Literal['stop', 'length', 'timeout',
+                                    'cancelled']] = None
+    stop_reason: Optional[Union[int, str]] = None
+
+    @staticmethod
+    def from_output(output: CompletionOutput,
+                    include_prompt_logprobs: bool) -> "CompletionOutputDiff":
+        return CompletionOutputDiff(
+            index=output.index,
+            text_diff=output.text_diff,
+            token_ids_diff=output.token_ids_diff,
+            logprobs_diff=output.logprobs_diff if output.logprobs else [],
+            text_rewind=max(0, output._last_text_len - len(output.text)),
+            token_ids_rewind=max(
+                0, output._last_token_ids_len - len(output.token_ids)),
+            logprobs_rewind=max(
+                0, output._last_logprobs_len -
+                len(output.logprobs)) if output.logprobs is not None else 0,
+            cumulative_logprob=output.cumulative_logprob,
+            prompt_logprobs=output.prompt_logprobs
+            if include_prompt_logprobs and output.prompt_logprobs else None,
+            finish_reason=output.finish_reason,
+            stop_reason=output.stop_reason)
+
+
 class GenerationResultBase:
     ''' This holds the core logic of the GenerationResult class. '''
 
@@ -406,6 +452,37 @@ class GenerationResultBase:
         if self._done:
             self.do_tracing(output, req_perf_metrics_dict)
 
+    def _apply_output_diff(self, diff: CompletionOutputDiff) -> None:
+        """Apply a streamed CompletionOutputDiff onto the retained output.
+
+        The worker and this side accumulate in lockstep, so after rewinding
+        any retracted tail the diff extends exactly what the previous chunk
+        left behind; the _last_* markers keep the *_diff properties valid
+        for users of the streaming API.
+        """
+        output = self._outputs[0]
+        output._last_text_len = len(output.text) - diff.text_rewind
+        output._last_token_ids_len = len(output.token_ids) - \
+            diff.token_ids_rewind
+        output._last_logprobs_len = len(output.logprobs) - \
+            diff.logprobs_rewind
+        if diff.text_rewind:
+            output.text = output.text[:-diff.text_rewind]
+        output.text += diff.text_diff
+        if diff.token_ids_rewind:
+            del output.token_ids[-diff.token_ids_rewind:]
+        output.token_ids.extend(diff.token_ids_diff)
+        if diff.logprobs_rewind:
+            del output.logprobs[-diff.logprobs_rewind:]
+        if diff.logprobs_diff:
+            output.logprobs += diff.logprobs_diff
+        if diff.cumulative_logprob is not None:
+            output.cumulative_logprob = diff.cumulative_logprob
+        if diff.prompt_logprobs:
+            output.prompt_logprobs = diff.prompt_logprobs
+        output.finish_reason = diff.finish_reason
+        output.stop_reason = diff.stop_reason
+
     @print_traceback_on_error
     @nvtx_range_debug("handle_response",
                       color="red",
@@ -423,8 +500,10 @@ class GenerationResultBase:
 
         if isinstance(response, PostprocWorker.Output):
             self._done = response.is_final
-            if isinstance(response.res, CompletionOutput):
+            if isinstance(response.res, CompletionOutputDiff):
                 # in streaming mode
+                self._apply_output_diff(response.res)
+            elif isinstance(response.res, CompletionOutput):
                 self._outputs[0] = response.res
             else:
                 self._outputs[0]._postprocess_result = response.res
@@ -714,6 +793,21 @@ class DetokenizedGenerationResultBase(GenerationResultBase):
         )
         self.tokenizer = tokenizer
         self._streaming = streaming
+        # Stop strings are immutable once the request is submitted; resolve
+        # them once instead of per streamed chunk.
+        self._stop_strs: Optional[List[str]] = None
+        self._max_stop_len = 0
+
+    def _get_stop_strs(self) -> List[str]:
+        if self._stop_strs is None:
+            self._stop_strs = [
+                stop_reason for stop_reason, _ in
+                self.sampling_params._get_stop_reasons_and_words()
+                if isinstance(stop_reason, str)
+            ]
+            self._max_stop_len = max(
+                (len(s) for s in self._stop_strs), default=0)
+        return self._stop_strs
 
     def _handle_response(self, response: "GenerationExecutor.Response"):
         GenerationResultBase._handle_response(self, response)
@@ -731,9 +825,10 @@ class DetokenizedGenerationResultBase(GenerationResultBase):
         if self.sampling_params.detokenize and self.tokenizer is not None:
             for beam_output in self.outputs:
                 beam_output._last_text_len = len(beam_output.text)
-                if hasattr(
-                        self.tokenizer, 'decode_incrementally'
-                ) and self._streaming and not self.sampling_params.use_beam_search:
+                incremental = hasattr(
+                    self.tokenizer, 'decode_incrementally'
+                ) and self._streaming and not self.sampling_params.use_beam_search
+                if incremental:
                     beam_output.text, beam_output._incremental_states = self.tokenizer.decode_incrementally(
                         beam_output.token_ids_diff,
                         prev_text=beam_output.text,
@@ -750,12 +845,19 @@ class DetokenizedGenerationResultBase(GenerationResultBase):
                     beam_output.finish_reason == 'stop'
                     or beam_output.finish_reason == 'length')
 
-                if is_generating or is_finished_with_stop_or_length:
-                    for stop_reason, _ in self.sampling_params._get_stop_reasons_and_words(
-                    ):
-                        if isinstance(stop_reason,
-                                      str) and stop_reason in beam_output.text:
-                            stop_pos = beam_output.text.find(stop_reason)
+                if ((is_generating or is_finished_with_stop_or_length)
+                        and self._get_stop_strs()):
+                    # The incremental decode only ever appends to the previous
+                    # text, so earlier chunks were already scanned; a new match
+                    # can at most straddle the chunk boundary. Without that
+                    # guarantee (full re-decode), scan from the beginning.
+                    search_start = max(
+                        0, beam_output._last_text_len -
+                        self._max_stop_len + 1) if incremental else 0
+                    for stop_reason in self._get_stop_strs():
+                        stop_pos = beam_output.text.find(
+                            stop_reason, search_start)
+                        if stop_pos != -1:
                             if not self.sampling_params.include_stop_str_in_output:
                                 beam_output.text = beam_output.text[:stop_pos]
                             else:
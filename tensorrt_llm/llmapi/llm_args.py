@@ -309,6 +309,52 @@ class RocketSparseAttentionConfig(BaseSparseAttentionConfig):
         return self.page_size
 
 
+class BlockSparseAttentionConfig(BaseSparseAttentionConfig):
+    """
+    Configuration for native block-sparse attention.
+    """
+    algorithm: Literal["block_sparse"] = "block_sparse"
+    block_size: int = Field(
+        default=32,
+        description="The KV block granularity for importance scoring and "
+        "generation-phase block skipping.")
+    window_size: int = Field(
+        default=32,
+        description="The observation window (in tokens) at the end of the "
+        "prompt used to score KV blocks; the window is always kept.")
+    prompt_budget: int = Field(
+        default=4096,
+        description="Number of prompt KV tokens kept per head after the "
+        "context phase; prompts at or below the budget are not pruned.")
+    sink_blocks: int = Field(
+        default=1,
+        description="Number of leading KV blocks that are always attended.")
+    recency_blocks: int = Field(
+        default=64,
+        description="Number of trailing KV blocks attended in the generation "
+        "phase, in addition to the sink blocks.")
+
+    @model_validator(mode='after')
+    def validate_block_sparse_config(self) -> 'BlockSparseAttentionConfig':
+        if self.prompt_budget <= self.window_size:
+            raise ValueError("prompt_budget must be larger than window_size")
+        if (self.prompt_budget - self.window_size) % self.block_size != 0:
+            raise ValueError(
+                "prompt_budget - window_size must be a multiple of block_size")
+        if self.sink_blocks > (self.prompt_budget -
+                               self.window_size) // self.block_size:
+            raise ValueError(
+                "sink_blocks must not exceed the block budget "
+                "(prompt_budget - window_size) // block_size")
+        return self
+
+    def supports_backend(self, backend: str) -> bool:
+        return backend == "pytorch"
+
+    def get_indices_block_size(self) -> int:
+        return self.block_size
+
+
 class DeepSeekSparseAttentionConfig(BaseSparseAttentionConfig):
     """
     Configuration for DeepSeek Sparse Attention.
@@ -2319,6 +2365,7 @@ SpeculativeConfig: TypeAlias = Annotated[
 SparseAttentionConfig: TypeAlias = Annotated[
     Union[
         RocketSparseAttentionConfig,
+        BlockSparseAttentionConfig,
         DeepSeekSparseAttentionConfig,
         SkipSoftmaxAttentionConfig,
     ],
@@ -81,6 +81,27 @@ class ChatPostprocArgs(PostprocArgs):
         )
 
 
+def _decode_token_cached(token_id: int,
+                         tokenizer: TransformersTokenizer) -> Tuple[str, list]:
+    """Decode a single token id, memoizing (text, utf-8 bytes) per tokenizer.
+
+    Decoding a lone token id is context-free, and the logprobs path decodes
+    every sampled token plus all of its top-logprob alternatives on every
+    streamed chunk. The cache is attached to the tokenizer so it is shared
+    across requests and bounded by the vocabulary size.
+    """
+    cache = getattr(tokenizer, "_single_token_decode_cache", None)
+    if cache is None:
+        cache = {}
+        tokenizer._single_token_decode_cache = cache
+    entry = cache.get(token_id)
+    if entry is None:
+        token = tokenizer.decode(token_id)
+        entry = (token, list(token.encode("utf-8", errors="replace")))
+        cache[token_id] = entry
+    return entry
+
+
 def create_logprobs(token_ids: List[int], tokenizer: TransformersTokenizer,
                     logprobs: List[float] | TokenLogprobs,
                     top_logprobs: bool) -> ChatCompletionLogProbs:
@@ -89,10 +110,10 @@ def create_logprobs(token_ids: List[int], tokenizer: TransformersTokenizer,
     content: List[ChatCompletionLogProbsContent] = []
     for token_id, logprob in zip(token_ids, logprobs):
         logprob: float | dict[int, Logprob]
-        token = tokenizer.decode(token_id)
+        token, token_bytes = _decode_token_cached(token_id, tokenizer)
         chat_logprob = ChatCompletionLogProbsContent(
             token=token,
-            bytes=list(token.encode("utf-8", errors="replace")),
+            bytes=token_bytes,
         )
         if isinstance(logprob, dict):
             if token_id in logprob:
@@ -100,9 +121,10 @@ def create_logprobs(token_ids: List[int], tokenizer: TransformersTokenizer,
                 if top_logprobs:
                     chat_logprob.top_logprobs = [
                         ChatCompletionLogProbsContent(
-                            token=(tk := tokenizer.decode(tid)),
+                            token=(decoded := _decode_token_cached(
+                                tid, tokenizer))[0],
                             logprob=max(logprob.logprob, -9999.0),
-                            bytes=list(tk.encode("utf-8", errors="replace")))
+                            bytes=decoded[1])
                         for tid, logprob in logprob.items()
                     ]
         else:
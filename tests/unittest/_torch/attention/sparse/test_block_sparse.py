@@ -0,0 +1,64 @@
+import pytest
+import torch
+from utils.llm_data import llm_models_root
+from utils.util import getSMVersion
+
+from tensorrt_llm import LLM, SamplingParams
+from tensorrt_llm.llmapi import BlockSparseAttentionConfig, KvCacheConfig
+
+
+def test_config_validation():
+    config = BlockSparseAttentionConfig()
+    assert config.algorithm == "block_sparse"
+    assert config.get_indices_block_size() == config.block_size
+    assert config.supports_backend("pytorch")
+    assert not config.supports_backend("tensorrt")
+
+    with pytest.raises(ValueError):
+        BlockSparseAttentionConfig(prompt_budget=16, window_size=32)
+
+    with pytest.raises(ValueError):
+        # prompt_budget - window_size not a multiple of block_size
+        BlockSparseAttentionConfig(prompt_budget=100,
+                                   window_size=32,
+                                   block_size=32)
+
+    with pytest.raises(ValueError):
+        BlockSparseAttentionConfig(prompt_budget=96,
+                                   window_size=32,
+                                   block_size=32,
+                                   sink_blocks=4)
+
+
+@pytest.mark.skipif(getSMVersion() < 100,
+                    reason="Block-sparse generation requires SM100 (Blackwell)")
+@pytest.mark.parametrize("model_name",
+                         ["llama-3.1-model/Llama-3.1-8B-Instruct"])
+def test_model(model_name):
+    model_dir = str(llm_models_root() / model_name)
+    kv_cache_config = KvCacheConfig(free_gpu_memory_fraction=0.7,
+                                    enable_block_reuse=False)
+
+    sparse_attention_config = BlockSparseAttentionConfig(
+        block_size=32,
+        window_size=32,
+        prompt_budget=2048,
+    )
+
+    llm = LLM(
+        model=model_dir,
+        backend="pytorch",
+        kv_cache_config=kv_cache_config,
+        attn_backend="TRTLLM",
+        sparse_attention_config=sparse_attention_config,
+        max_batch_size=8,
+        max_seq_len=20480,
+        max_num_tokens=81920,
+        cuda_graph_config=None,
+    )
+
+    prompt = "The capital of France is a city famous for the Eiffel Tower. " * 200
+    sampling_params = SamplingParams(max_tokens=32)
+    with llm:
+        outputs = llm.generate([prompt], sampling_params)
+    assert len(outputs[0].outputs[0].text) > 0
@@ -216,28 +216,30 @@ class TestDefaultADPRouter:
     def test_create_rank_state_default(self):
         dist = _mock_dist(tp_rank=0, has_cp_helix=False)
         router = DefaultADPRouter(dist=dist)
-        req1 = Mock(py_orig_prompt_len=100)
-        req2 = Mock(py_orig_prompt_len=200)
+        # Live tokens: prompt plus tokens generated so far.
+        req1 = Mock(max_beam_num_tokens=120)
+        req2 = Mock(max_beam_num_tokens=230)
         state = router.create_rank_state(active_requests=[req1, req2], new_requests=[])
         assert state.rank == 0
         assert state.num_active_requests == 2
-        assert state.num_active_tokens == 300
+        assert state.num_active_tokens == 350
 
     def test_create_rank_state_cp_helix(self):
         dist = _mock_dist(tp_rank=1, has_cp_helix=True)
         router = DefaultADPRouter(dist=dist)
-        req1 = Mock(total_input_len_cp=150)
-        req2 = Mock(total_input_len_cp=250)
+        # Full context length plus generated tokens (local prompt is a slice).
+        req1 = Mock(total_input_len_cp=150, py_prompt_len=40, max_beam_num_tokens=45)
+        req2 = Mock(total_input_len_cp=250, py_prompt_len=60, max_beam_num_tokens=60)
         state = router.create_rank_state(active_requests=[req1, req2], new_requests=[])
         assert state.rank == 1
         assert state.num_active_requests == 2
-        assert state.num_active_tokens == 400
+        assert state.num_active_tokens == 405
 
     def test_gather_all_rank_states(self):
         dist = _mock_dist(tp_rank=0, tp_size=2, has_cp_helix=False)
         dist.tp_allgather.return_value = [[0, 1, 10], [1, 2, 20]]
         router = DefaultADPRouter(dist=dist)
-        req = Mock(py_orig_prompt_len=10)
+        req = Mock(max_beam_num_tokens=10)
         states = router.gather_all_rank_states([req])
         assert len(states) == 2
         assert states[0] == RankState(rank=0, num_active_requests=1, num_active_tokens=10)
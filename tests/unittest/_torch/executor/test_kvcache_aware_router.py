@@ -94,22 +94,22 @@ class TestKVCacheAwareADPRouter:
         mgr = _mock_kv_cache_manager()
         router = KVCacheAwareADPRouter(dist=dist, kv_cache_manager=mgr)
 
-        req1 = Mock(py_orig_prompt_len=100)
-        req2 = Mock(py_orig_prompt_len=200)
+        req1 = Mock(max_beam_num_tokens=120)
+        req2 = Mock(max_beam_num_tokens=230)
         state = router.create_rank_state([req1, req2], [])
         assert state.rank == 0
         assert state.num_active_requests == 2
-        assert state.num_active_tokens == 300
+        assert state.num_active_tokens == 350
 
     def test_create_rank_state_cp_helix(self):
         dist = _mock_dist(tp_rank=1, has_cp_helix=True)
         mgr = _mock_kv_cache_manager()
         router = KVCacheAwareADPRouter(dist=dist, kv_cache_manager=mgr)
 
-        req1 = Mock(total_input_len_cp=150)
+        req1 = Mock(total_input_len_cp=150, py_prompt_len=40, max_beam_num_tokens=45)
         state = router.create_rank_state([req1], [])
         assert state.rank == 1
-        assert state.num_active_tokens == 150
+        assert state.num_active_tokens == 155
 
     # -- gather_prefix_matches tests --
 
@@ -299,3 +299,49 @@ class TestMamba2MTPSSMCache:
             f"Too many intermediate_states mismatches: {mismatch_frac:.6f} "
             f"(> 0.01%), max diff = {inter_diff.max().item():.4f}"
         )
+
+
+@skip_unsupported
+class TestMamba2MTPStateRestore:
+    """Tests for the mamba2_mtp_state_restore CUDA kernel."""
+
+    @pytest.mark.parametrize("dtype", [torch.bfloat16, torch.float32])
+    @pytest.mark.parametrize(
+        "state_shape",
+        [
+            (16, 32, 64),  # vectorized copy path
+            (3, 5),  # word-wise fallback path
+        ],
+    )
+    def test_matches_torch_indexing(self, dtype, state_shape):
+        torch.manual_seed(0)
+        device = "cuda"
+        num_layers = 4
+        dst_slots = 8
+        src_slots = 6
+        cache_steps = 5
+        num_seqs = 5
+
+        dst_states = (
+            torch.randn((num_layers, dst_slots) + state_shape, device=device, dtype=dtype) * 0.5
+        )
+        src_states = (
+            torch.randn((num_layers, src_slots, cache_steps) + state_shape, device=device, dtype=dtype)
+            * 0.5
+        )
+        dst_ref = dst_states.clone()
+
+        dst_indices = torch.randperm(dst_slots, device=device)[:num_seqs].to(torch.int32)
+        src_indices = torch.randperm(src_slots, device=device)[:num_seqs].to(torch.int32)
+        accepted_steps = torch.randint(
+            0, cache_steps, (num_seqs,), device=device, dtype=torch.int32
+        )
+
+        torch.ops.trtllm.mamba2_mtp_state_restore(
+            dst_states, src_states, dst_indices, src_indices, accepted_steps
+        )
+
+        dst_ref[:, dst_indices.long()] = src_states[
+            :, src_indices.long(), accepted_steps.long()
+        ]
+        torch.testing.assert_close(dst_states, dst_ref, rtol=0, atol=0)
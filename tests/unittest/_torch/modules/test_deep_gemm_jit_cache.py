@@ -0,0 +1,75 @@
+# Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from tensorrt_llm._torch.modules.fused_moe.deep_gemm_jit_cache import (
+    get_jit_cache_dir, publish_jit_cache_to_shared, seed_jit_cache_from_shared)
+
+
+def _make_artifact(root, name, content="so"):
+    kernel_dir = root / "cache" / name
+    kernel_dir.mkdir(parents=True)
+    (kernel_dir / "kernel.cubin").write_text(content)
+    return kernel_dir
+
+
+def test_get_jit_cache_dir_honors_env(tmp_path, monkeypatch):
+    monkeypatch.setenv("DG_JIT_CACHE_DIR", str(tmp_path / "dg"))
+    assert get_jit_cache_dir() == tmp_path / "dg"
+
+
+def test_seed_copies_missing_artifacts(tmp_path, monkeypatch):
+    local = tmp_path / "local"
+    shared = tmp_path / "shared"
+    monkeypatch.setenv("DG_JIT_CACHE_DIR", str(local))
+    _make_artifact(shared, "kernel.gemm.aaaa")
+    _make_artifact(shared, "kernel.gemm.bbbb")
+
+    assert seed_jit_cache_from_shared(str(shared)) == 2
+    assert (local / "cache" / "kernel.gemm.aaaa" / "kernel.cubin").exists()
+    assert (local / "cache" / "kernel.gemm.bbbb" / "kernel.cubin").exists()
+    # A second seed is a no-op.
+    assert seed_jit_cache_from_shared(str(shared)) == 0
+
+
+def test_seed_keeps_existing_artifacts(tmp_path, monkeypatch):
+    local = tmp_path / "local"
+    shared = tmp_path / "shared"
+    monkeypatch.setenv("DG_JIT_CACHE_DIR", str(local))
+    _make_artifact(local, "kernel.gemm.aaaa", content="local")
+    _make_artifact(shared, "kernel.gemm.aaaa", content="shared")
+
+    assert seed_jit_cache_from_shared(str(shared)) == 0
+    assert (local / "cache" / "kernel.gemm.aaaa" /
+            "kernel.cubin").read_text() == "local"
+
+
+def test_publish_copies_new_artifacts(tmp_path, monkeypatch):
+    local = tmp_path / "local"
+    shared = tmp_path / "shared"
+    monkeypatch.setenv("DG_JIT_CACHE_DIR", str(local))
+    _make_artifact(shared, "kernel.gemm.aaaa")
+    _make_artifact(local, "kernel.gemm.aaaa")
+    _make_artifact(local, "kernel.gemm.cccc")
+
+    assert publish_jit_cache_to_shared(str(shared)) == 1
+    assert (shared / "cache" / "kernel.gemm.cccc" / "kernel.cubin").exists()
+    # No stray staging directories are left behind.
+    assert all(not path.name.startswith(".tmp.")
+               for path in (shared / "cache").iterdir())
+
+
+def test_missing_source_is_a_noop(tmp_path, monkeypatch):
+    monkeypatch.setenv("DG_JIT_CACHE_DIR", str(tmp_path / "local"))
+    assert seed_jit_cache_from_shared(str(tmp_path / "absent")) == 0
+    assert publish_jit_cache_to_shared(str(tmp_path / "shared")) == 0
@@ -0,0 +1,103 @@
+# Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+
+import pytest
+
+from tensorrt_llm._torch.pyexecutor.kernel_ab_experiment import (
+    NUM_LATENCY_BUCKETS, KernelABExperiment, _VariantAccumulator)
+
+
+@pytest.mark.parametrize("fraction_b", [0.1, 0.25, 0.5, 1.0])
+def test_routing_fraction_is_exact(fraction_b: float):
+    experiment = KernelABExperiment("test", fraction_b)
+    num_invocations = 1000
+    num_b = sum(experiment.use_variant_b() for _ in range(num_invocations))
+    assert num_b == math.floor(num_invocations * fraction_b)
+
+
+def test_routing_is_deterministic():
+    decisions = [
+        tuple(
+            KernelABExperiment("test", 0.3).use_variant_b()
+            for _ in range(100)) for _ in range(2)
+    ]
+    assert decisions[0] == decisions[1]
+
+
+def test_routing_spreads_b_samples():
+    # With fraction_b=0.25, exactly one of every 4 consecutive invocations
+    # should be routed to variant B.
+    experiment = KernelABExperiment("test", 0.25)
+    decisions = [experiment.use_variant_b() for _ in range(100)]
+    for start in range(0, 100, 4):
+        assert sum(decisions[start:start + 4]) == 1
+
+
+def test_invalid_fraction_rejected():
+    for fraction_b in (0.0, -0.5, 1.5):
+        with pytest.raises(ValueError):
+            KernelABExperiment("test", fraction_b)
+
+
+def test_from_env_disabled_by_default(monkeypatch):
+    monkeypatch.delenv("TRTLLM_KERNEL_AB_FRACTION", raising=False)
+    assert KernelABExperiment.from_env("test") is None
+    monkeypatch.setenv("TRTLLM_KERNEL_AB_FRACTION", "0")
+    assert KernelABExperiment.from_env("test") is None
+    monkeypatch.setenv("TRTLLM_KERNEL_AB_FRACTION", "not-a-number")
+    assert KernelABExperiment.from_env("test") is None
+
+
+def test_from_env_enabled(monkeypatch):
+    monkeypatch.setenv("TRTLLM_KERNEL_AB_FRACTION", "0.125")
+    experiment = KernelABExperiment.from_env("test")
+    assert experiment is not None
+    assert experiment.fraction_b == 0.125
+    # Values above 1 are clamped.
+    monkeypatch.setenv("TRTLLM_KERNEL_AB_FRACTION", "2.0")
+    experiment = KernelABExperiment.from_env("test")
+    assert experiment is not None
+    assert experiment.fraction_b == 1.0
+
+
+def test_histogram_bucketing():
+    acc = _VariantAccumulator()
+    # Bucket i covers [2**(i - 4), 2**(i - 3)) ms.
+    acc.add(0.01)  # below bucket 0 lower bound -> clamped to bucket 0
+    acc.add(1.0 / 16)  # bucket 0 lower bound
+    acc.add(0.5)  # bucket 3
+    acc.add(1.0)  # bucket 4
+    acc.add(1.5)  # bucket 4
+    acc.add(1e9)  # clamped to last bucket
+    assert acc.histogram[0] == 2
+    assert acc.histogram[3] == 1
+    assert acc.histogram[4] == 2
+    assert acc.histogram[NUM_LATENCY_BUCKETS - 1] == 1
+    assert acc.num_samples == 6
+    assert acc.avg_latency_ms == pytest.approx(acc.total_latency_ms / 6)
+
+
+def test_snapshot_without_samples():
+    experiment = KernelABExperiment("sampler_ab", 0.5)
+    snapshot = experiment.get_snapshot()
+    assert snapshot.name == "sampler_ab"
+    assert snapshot.fraction_b == 0.5
+    assert snapshot.num_samples_a == 0
+    assert snapshot.num_samples_b == 0
+    assert snapshot.avg_latency_a_ms == 0.0
+    assert snapshot.avg_latency_b_ms == 0.0
+    assert len(snapshot.latency_histogram_a) == NUM_LATENCY_BUCKETS
+    assert len(snapshot.latency_histogram_b) == NUM_LATENCY_BUCKETS